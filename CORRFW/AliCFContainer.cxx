@@ -28,6 +28,7 @@
 #include "AliCFGridSparse.h"
 #include "AliCFContainer.h"
 #include "TAxis.h"
+#include "TList.h"
 //____________________________________________________________________
 ClassImp(AliCFContainer)
 
@@ -123,6 +124,25 @@ void AliCFContainer::Fill(const Double_t *var, Int_t istep, Double_t weight)
   fGrid[istep]->Fill(var,weight);
 }
 
+//____________________________________________________________________
+void AliCFContainer::SetFillBufferSize(Int_t n)
+{
+  //
+  // Each step keeps up to n entries before adding them to its grid,
+  // set n=0 to fill the grids entry by entry
+  //
+  for (Int_t istep=0; istep<fNStep; istep++) fGrid[istep]->SetFillBufferSize(n);
+}
+
+//____________________________________________________________________
+void AliCFContainer::FlushFillBuffers() const
+{
+  //
+  // Adds the buffered entries of all the steps to the grids
+  //
+  for (Int_t istep=0; istep<fNStep; istep++) fGrid[istep]->FlushFillBuffer();
+}
+
 //____________________________________________________________________
 TH1* AliCFContainer::Project(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3) const
 {
@@ -209,6 +229,7 @@ Long64_t AliCFContainer::Merge(TCollection* list)
   // Merge a list of AliCorrection objects with this (needed for
   // PROOF). 
   // Returns the number of merged objects (including this).
+  // The grids of each step are merged all together with AliCFGridSparse::Merge()
 
   if (!list)
     return 0;
@@ -220,13 +241,24 @@ Long64_t AliCFContainer::Merge(TCollection* list)
   TObject* obj;
   
   Int_t count = 0;
+  TList* grids = new TList[fNStep];
   while ((obj = iter())) {
     AliCFContainer* entry = dynamic_cast<AliCFContainer*> (obj);
     if (entry == 0) 
       continue;
-    this->Add(entry);
     count++;
+    if ((entry->GetNStep()      != fNStep)          ||
+        (entry->GetNVar()       != GetNVar())       ||
+        (entry->GetNBinsTotal() != GetNBinsTotal())) {
+      AliError("Different number of steps/sensitive variables/grid elements: cannot add the containers");
+      continue;
+    }
+    for (Int_t istep=0; istep<fNStep; istep++) grids[istep].Add(entry->GetGrid(istep));
+  }
+  for (Int_t istep=0; istep<fNStep; istep++) {
+    if (!grids[istep].IsEmpty()) fGrid[istep]->Merge(&grids[istep]);
   }
+  delete [] grids;
 
   return count+1;
 }
@@ -62,6 +62,8 @@ class AliCFContainer : public AliCFFrame
   virtual Int_t GetNStep() const {return fNStep;};
   virtual void  SetNStep(Int_t nStep) {fNStep=nStep;}
   virtual void  Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void  SetFillBufferSize(Int_t n) ; // buffers n entries per step before adding them to the grids (see AliCFGridSparse::SetFillBufferSize)
+  virtual void  FlushFillBuffers() const ;   // adds the buffered entries to the grids
 
   virtual Float_t  GetOverFlows (Int_t var,Int_t istep,Bool_t excl=kFALSE) const;
   virtual Float_t  GetUnderFlows(Int_t var,Int_t istep,Bool_t excl=kFALSE) const ;
@@ -24,11 +24,13 @@
 //--------------------------------------------------------------------//
 //
 //
+#include <algorithm>
 #include "AliCFGridSparse.h"
 #include "THnSparse.h"
 #include "AliLog.h"
 #include "TMath.h"
 #include "TROOT.h"
+#include "TBuffer.h"
 #include "TH1D.h"
 #include "TH2D.h"
 #include "TH3D.h"
@@ -38,11 +40,24 @@
 //____________________________________________________________________
 ClassImp(AliCFGridSparse)
 
+namespace {
+  // bin content collected from several grids, to be added in one pass
+  struct MergedCell {
+    Long64_t fCell;
+    Double_t fContent;
+    Double_t fError2;
+  };
+  bool CompareBuffered(const std::pair<Long64_t,Double_t>& a, const std::pair<Long64_t,Double_t>& b) {return a.first < b.first;}
+  bool CompareMerged(const MergedCell& a, const MergedCell& b) {return a.fCell < b.fCell;}
+}
+
 //____________________________________________________________________
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer()
 {
   // default constructor
 }
@@ -50,7 +65,9 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer()
 {
   // default constructor
 }
@@ -58,7 +75,9 @@ AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer()
 {
   //
   // main constructor
@@ -80,7 +99,9 @@ AliCFGridSparse::~AliCFGridSparse()
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer()
 {
   //
   // copy constructor
@@ -127,8 +148,130 @@ void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
   // Fill the grid,
   // given a set of values of the input variable, 
   // with weight (by default w=1)
+  // If a fill buffer is set, the entry is only binned here and added to the grid later
+  //
+  if (fFillBufferSize<=0) {
+    fData->Fill(var,weight);
+    return;
+  }
+  Long64_t cell = 0;
+  for (Int_t iVar=GetNVar()-1; iVar>=0; iVar--) {
+    TAxis* axis = fData->GetAxis(iVar);
+    cell = cell * (axis->GetNbins()+2) + axis->FindBin(var[iVar]);
+  }
+  fFillBuffer.push_back(std::make_pair(cell,weight));
+  if ((Int_t)fFillBuffer.size() >= fFillBufferSize) FlushFillBuffer();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::SetFillBufferSize(Int_t n)
+{
+  //
+  // Keep up to n entries before adding them to the grid : the buffered entries are sorted by bin,
+  // so that each distinct bin is looked up only once in the THnSparse.
+  // The buffer is flushed when full and before any access to the grid (including streaming),
+  // FlushFillBuffer() can also be called explicitly, e.g. at the end of each event.
+  // The per-axis statistics of the THnSparse (sum of w*x) are not filled for the buffered entries.
+  //
+  FlushFillBuffer();
+  fFillBufferSize = 0;
+  if (n<=0) return;
+  if (!CanLinearise()) {
+    AliWarning("Too many bins to buffer the entries, the grid will be filled entry by entry");
+    return;
+  }
+  fFillBufferSize = n;
+  fFillBuffer.reserve(n);
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FlushFillBuffer() const
+{
+  //
+  // Adds the buffered entries to the grid, summing the entries of the same bin first
+  //
+  if (fFillBuffer.empty()) return;
+
+  std::stable_sort(fFillBuffer.begin(),fFillBuffer.end(),CompareBuffered);
+  const Bool_t errors = fData->GetCalculateErrors();
+  Int_t* bin = new Int_t[GetNVar()];
+  for (UInt_t iEntry=0; iEntry<fFillBuffer.size(); ) {
+    const Long64_t cell = fFillBuffer[iEntry].first;
+    Double_t sumw = 0., sumw2 = 0.;
+    for ( ; iEntry<fFillBuffer.size() && fFillBuffer[iEntry].first==cell; iEntry++) {
+      sumw  += fFillBuffer[iEntry].second;
+      sumw2 += fFillBuffer[iEntry].second * fFillBuffer[iEntry].second;
+    }
+    GetCellCoordinates(cell,bin);
+    Long64_t index = fData->GetBin(bin,kTRUE);
+    fData->AddBinContent(index,sumw);
+    if (errors) fData->AddBinError2(index,sumw2);
+  }
+  delete [] bin;
+  fData->SetEntries(fData->GetEntries() + fFillBuffer.size());
+  fFillBuffer.clear();
+}
+
+//____________________________________________________________________
+Bool_t AliCFGridSparse::CanLinearise() const
+{
+  //
+  // true if all the cells, including under/overflows, can be numbered with a Long64_t
+  //
+  Double_t nCells = 1.;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) nCells *= fData->GetAxis(iVar)->GetNbins()+2;
+  return nCells < 9.e18;
+}
+
+//____________________________________________________________________
+Bool_t AliCFGridSparse::HasSameBinning(const AliCFGridSparse* aGrid) const
+{
+  //
+  // same number of variables and of bins in each variable
+  //
+  if (aGrid->GetNVar() != GetNVar()) return kFALSE;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    if (aGrid->GetNBins(iVar) != GetNBins(iVar)) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//____________________________________________________________________
+Long64_t AliCFGridSparse::GetCell(const Int_t* bin) const
+{
+  //
+  // linearised bin coordinates (first variable runs fastest)
   //
-  fData->Fill(var,weight);
+  Long64_t cell = 0;
+  for (Int_t iVar=GetNVar()-1; iVar>=0; iVar--) cell = cell * (fData->GetAxis(iVar)->GetNbins()+2) + bin[iVar];
+  return cell;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::GetCellCoordinates(Long64_t cell, Int_t* bin) const
+{
+  //
+  // bin coordinates of a linearised cell
+  //
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    const Int_t nCells = fData->GetAxis(iVar)->GetNbins()+2;
+    bin[iVar] = cell % nCells;
+    cell /= nCells;
+  }
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::Streamer(TBuffer &R__b)
+{
+  //
+  // Stream an object of class AliCFGridSparse : the buffered entries are added to the grid before writing
+  //
+  if (R__b.IsReading()) {
+    R__b.ReadClassBuffer(AliCFGridSparse::Class(),this);
+  } else {
+    FlushFillBuffer();
+    R__b.WriteClassBuffer(AliCFGridSparse::Class(),this);
+  }
 }
 
 //___________________________________________________________________
@@ -139,6 +282,7 @@ AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, cons
   // axis ranges can be defined in arrays varMin, varMax
   // If useBins=true, varMin and varMax are taken as bin numbers
   //
+  FlushFillBuffer();
 
   // binning for new grid
   Int_t* bins = new Int_t[nVars];
@@ -191,6 +335,7 @@ Float_t AliCFGridSparse::GetEntries() const
   //
   // total entries (including overflows and underflows)
   //
+  FlushFillBuffer();
 
   return fData->GetEntries();
 }
@@ -201,6 +346,7 @@ Float_t AliCFGridSparse::GetElement(Long_t index) const
   //
   // Returns content of grid element index 
   //
+  FlushFillBuffer();
   
   return fData->GetBinContent(index);
 }
@@ -210,6 +356,7 @@ Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
   //
   // Get the content in a bin corresponding to a set of bin indexes
   //
+  FlushFillBuffer();
   return fData->GetBinContent(bin);
 
 }  
@@ -219,6 +366,7 @@ Float_t AliCFGridSparse::GetElement(const Double_t *var) const
   //
   // Get the content in a bin corresponding to a set of input variables
   //
+  FlushFillBuffer();
 
   Long_t index = fData->GetBin(var,kFALSE);
   if (index<0) return 0.;
@@ -231,6 +379,7 @@ Float_t AliCFGridSparse::GetElementError(Long_t index) const
   //
   // Returns the error on the content 
   //
+  FlushFillBuffer();
 
   return fData->GetBinError(index);
 }
@@ -240,6 +389,7 @@ Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
  //
   // Get the error in a bin corresponding to a set of bin indexes
   //
+  FlushFillBuffer();
   return fData->GetBinError(bin);
 
 }  
@@ -249,6 +399,7 @@ Float_t AliCFGridSparse::GetElementError(const Double_t *var) const
   //
   // Get the error in a bin corresponding to a set of input variables
   //
+  FlushFillBuffer();
 
   Long_t index=fData->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
   if (index<0) return 0.;
@@ -261,6 +412,7 @@ void AliCFGridSparse::SetElement(Long_t index, Float_t val)
   //
   // Sets grid element value
   //
+  FlushFillBuffer();
   Int_t* bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //affects the bin coordinates
   SetElement(bin,val);
@@ -273,6 +425,7 @@ void AliCFGridSparse::SetElement(const Int_t *bin, Float_t val)
   //
   // Sets grid element of bin indeces bin to val
   //
+  FlushFillBuffer();
   fData->SetBinContent(bin,val);
 }
 //____________________________________________________________________
@@ -281,6 +434,7 @@ void AliCFGridSparse::SetElement(const Double_t *var, Float_t val)
   //
   // Set the content in a bin to value val corresponding to a set of input variables
   //
+  FlushFillBuffer();
   Long_t index=fData->GetBin(var,kTRUE); //THnSparse index: allocate the cell
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //trick to access the array of bins
@@ -294,6 +448,7 @@ void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
   //
   // Sets grid element iel error to val (linear indexing) in AliCFFrame
   //
+  FlushFillBuffer();
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin);
   SetElementError(bin,val);
@@ -306,6 +461,7 @@ void AliCFGridSparse::SetElementError(const Int_t *bin, Float_t val)
   //
   // Sets grid element error of bin indeces bin to val
   //
+  FlushFillBuffer();
   fData->SetBinError(bin,val);
 }
 //____________________________________________________________________
@@ -314,6 +470,7 @@ void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val)
   //
   // Set the error in a bin to value val corresponding to a set of input variables
   //
+  FlushFillBuffer();
   Long_t index=fData->GetBin(var); //THnSparse index
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //trick to access the array of bins
@@ -327,6 +484,7 @@ void AliCFGridSparse::SumW2()
   //
   //set calculation of the squared sum of the weighted entries
   //
+  FlushFillBuffer();
   if(!fSumW2){
     fData->CalculateErrors(kTRUE); 
   }
@@ -339,6 +497,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
   //
   //add aGrid to the current one
   //
+  FlushFillBuffer();
 
   if (aGrid->GetNVar() != GetNVar()){
     AliError("Different number of variables, cannot add the grids");
@@ -355,6 +514,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   //
   //Add aGrid1 and aGrid2 and deposit the result into the current one
   //
+  FlushFillBuffer();
 
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliInfo("Different number of variables, cannot add the grids");
@@ -374,6 +534,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
   //
   // Multiply aGrid to the current one
   //
+  FlushFillBuffer();
 
   if (aGrid->GetNVar() != GetNVar()) {
     AliError("Different number of variables, cannot multiply the grids");
@@ -392,6 +553,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   //
   //Multiply aGrid1 and aGrid2 and deposit the result into the current one
   //
+  FlushFillBuffer();
 
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliError("Different number of variables, cannot multiply the grids");
@@ -414,6 +576,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
   //
   // Divide aGrid to the current one
   //
+  FlushFillBuffer();
 
   if (aGrid->GetNVar() != GetNVar()) {
     AliError("Different number of variables, cannot divide the grids");
@@ -435,6 +598,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
   //Divide aGrid1 and aGrid2 and deposit the result into the current one
   //binomial errors are supported
   //
+  FlushFillBuffer();
 
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliError("Different number of variables, cannot divide the grids");
@@ -457,6 +621,7 @@ void AliCFGridSparse::Rebin(const Int_t* group)
   // Please notice that the original number of bins on
   // a given axis has to be divisible by the rebin group.
   //
+  FlushFillBuffer();
 
   for(Int_t i=0;i<GetNVar();i++){
     if (group[i]!=1) AliInfo(Form(" merging bins along dimension %i in groups of %i bins", i,group[i]));
@@ -472,6 +637,7 @@ void AliCFGridSparse::Scale(Long_t index, const Double_t *fact)
   //
   //scale content of a certain cell by (positive) fact (with error)
   //
+  FlushFillBuffer();
 
   if (GetElement(index)==0 || fact[0]==0) return;
 
@@ -488,6 +654,7 @@ void AliCFGridSparse::Scale(const Int_t *bin, const Double_t *fact)
   //
   //scale content of a certain cell by (positive) fact (with error)
   //
+  FlushFillBuffer();
   if(GetElement(bin)==0 || fact[0]==0)return;
 
   Double_t in[2], out[2];
@@ -504,6 +671,7 @@ void AliCFGridSparse::Scale(const Double_t *var, const Double_t *fact)
   //
   //scale content of a certain cell by (positive) fact (with error)
   //
+  FlushFillBuffer();
   if(GetElement(var)==0 || fact[0]==0)return;
 
   Double_t in[2], out[2];
@@ -520,6 +688,7 @@ void AliCFGridSparse::Scale(const Double_t* fact)
   //
   //scale contents of the whole grid by fact
   //
+  FlushFillBuffer();
 
   for (Long_t iel=0; iel<GetNFilledBins(); iel++) {
     Scale(iel,fact);
@@ -530,6 +699,7 @@ Long_t AliCFGridSparse::GetEmptyBins() const {
   //
   // Get empty bins 
   //
+  FlushFillBuffer();
 
   return (GetNBinsTotal() - GetNFilledBins()) ;
 } 
@@ -540,6 +710,7 @@ Int_t AliCFGridSparse::CheckStats(Double_t thr) const
   //
   // Count the cells below a certain threshold
   //
+  FlushFillBuffer();
   Int_t ncellsLow=0;
   for (Int_t i=0; i<GetNBinsTotal(); i++) {
     if (GetElement(i)<thr) ncellsLow++;
@@ -553,6 +724,7 @@ Double_t AliCFGridSparse::GetIntegral() const
   //
   // Get full Integral
   //
+  FlushFillBuffer();
   return fData->ComputeIntegral();  
 } 
 
@@ -562,7 +734,11 @@ Long64_t AliCFGridSparse::Merge(TCollection* list)
   //
   // Merge a list of AliCFGridSparse with this (needed for PROOF). 
   // Returns the number of merged objects (including this).
+  // The grids with the same binning are merged in one pass : their bins are collected with
+  // linearised coordinates and sorted, then each distinct bin is added to this grid once.
+  // The other grids are added one by one.
   //
+  FlushFillBuffer();
 
   if (!list)
     return 0;
@@ -574,13 +750,61 @@ Long64_t AliCFGridSparse::Merge(TCollection* list)
   TObject* obj;
   
   Int_t count = 0;
+  const Bool_t linear = CanLinearise();
+  std::vector<const THnSparse*> sameBinning;
+  Bool_t errors = fData->GetCalculateErrors();
   while ((obj = iter->Next())) {
     AliCFGridSparse* entry = dynamic_cast<AliCFGridSparse*> (obj);
     if (entry == 0) 
       continue;
-    this->Add(entry);
     count++;
+    if (!linear || !HasSameBinning(entry)) {
+      this->Add(entry);
+      continue;
+    }
+    if (!fSumW2 && entry->GetSumW2()) SumW2();
+    sameBinning.push_back(entry->GetGrid());
+    errors |= entry->GetGrid()->GetCalculateErrors();
   }
+  delete iter;
+  if (sameBinning.empty()) return count+1;
+
+  // errors are propagated if any of the grids has them, as in THnSparse::Add()
+  if (errors && !fData->GetCalculateErrors()) fData->Sumw2();
+
+  std::vector<MergedCell> cells;
+  Long64_t nBins = 0;
+  for (UInt_t iGrid=0; iGrid<sameBinning.size(); iGrid++) nBins += sameBinning[iGrid]->GetNbins();
+  cells.reserve(nBins);
+  Int_t* bin = new Int_t[GetNVar()];
+  Double_t entries = 0.;
+  for (UInt_t iGrid=0; iGrid<sameBinning.size(); iGrid++) {
+    const THnSparse* grid = sameBinning[iGrid];
+    for (Long64_t iBin=0; iBin<grid->GetNbins(); iBin++) {
+      MergedCell cell;
+      cell.fContent = grid->GetBinContent(iBin,bin);
+      cell.fError2  = errors ? grid->GetBinError2(iBin) : 0.;
+      cell.fCell    = GetCell(bin);
+      cells.push_back(cell);
+    }
+    entries += grid->GetEntries();
+  }
+  std::stable_sort(cells.begin(),cells.end(),CompareMerged);
+
+  for (UInt_t iCell=0; iCell<cells.size(); ) {
+    const Long64_t cell = cells[iCell].fCell;
+    Double_t content = 0., error2 = 0.;
+    for ( ; iCell<cells.size() && cells[iCell].fCell==cell; iCell++) {
+      content += cells[iCell].fContent;
+      error2  += cells[iCell].fError2;
+    }
+    GetCellCoordinates(cell,bin);
+    Long64_t index = fData->GetBin(bin,kTRUE);
+    fData->AddBinContent(index,content);
+    if (errors) fData->AddBinError2(index,error2);
+  }
+  delete [] bin;
+  fData->SetEntries(fData->GetEntries() + entries);
 
   return count+1;
 }
@@ -603,9 +827,12 @@ void AliCFGridSparse::Copy(TObject& c) const
   //
   // copy function
   //
+  FlushFillBuffer();
   AliCFFrame::Copy(c);
   AliCFGridSparse& target = (AliCFGridSparse &) c;
   target.fSumW2 = fSumW2 ;
+  target.fFillBufferSize = fFillBufferSize ;
+  target.fFillBuffer.clear();
   if (fData) {
     target.fData = (THnSparse*)fData->Clone();
   }
@@ -620,6 +847,7 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   // therefore varMin and varMax must have their dimensions equal to GetNVar()
   // If useBins=true, varMin and varMax are taken as bin numbers
   // if varmin or varmax point to null, all the range is taken, including over- and underflows
+  FlushFillBuffer();
 
   THnSparse* clone = (THnSparse*)fData->Clone();
   if (varMin != 0x0 && varMax != 0x0) {
@@ -746,6 +974,7 @@ Float_t AliCFGridSparse::GetOverFlows(Int_t ivar, Bool_t exclusive) const
   // Returns overflows in variable ivar
   // Set 'exclusive' to true for an exclusive check on variable ivar
   //
+  FlushFillBuffer();
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t ovfl=0.;
@@ -772,6 +1001,7 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
   // Returns exclusive overflows in variable ivar
   // Set 'exclusive' to true for an exclusive check on variable ivar
   //
+  FlushFillBuffer();
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t unfl=0.;
@@ -797,6 +1027,7 @@ void AliCFGridSparse::Smooth() {
   //
   // smoothing function: TO USE WITH CARE
   //
+  FlushFillBuffer();
 
   AliInfo("Your GridSparse is going to be smoothed");
   AliInfo(Form("N TOTAL  BINS : %li",GetNBinsTotal()));
@@ -8,6 +8,7 @@
 // Author:S.Arcelli, silvia.arcelli@cern.ch
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "AliCFFrame.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -37,7 +38,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual void       GetBinLimits(Int_t ivar, Double_t * array) const ;
   virtual Double_t * GetBinLimits(Int_t ivar) const ;
   virtual Long_t     GetNBinsTotal() const ;
-  virtual Long_t     GetNFilledBins() const {return fData->GetNbins();}
+  virtual Long_t     GetNFilledBins() const {FlushFillBuffer(); return fData->GetNbins();}
   virtual Int_t      GetNBins(Int_t ivar) const {return fData->GetAxis(ivar)->GetNbins();}
   virtual Int_t *    GetNBins() const ;
   virtual Float_t    GetBinCenter(Int_t ivar,Int_t ibin) const ;
@@ -56,6 +57,9 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Int_t      GetBinIndex(Int_t ivar, Int_t ind) const ;
 
   virtual void    Fill(const Double_t *var, Double_t weight=1.);
+  virtual void    SetFillBufferSize(Int_t n); // number of entries kept before being added to the grid (0 : entries are added one by one)
+  Int_t           GetFillBufferSize() const {return fFillBufferSize;}
+  virtual void    FlushFillBuffer() const;    // adds the buffered entries to the grid
   virtual Float_t GetEntries()const;
   virtual Float_t GetElement(Long_t iel)               const; 
   virtual Float_t GetElement(const Int_t *bin)         const; 
@@ -100,7 +104,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual Long64_t Merge(TCollection* list);
 
   virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
-  THnSparse   *    GetGrid() const {return fData;}
+  THnSparse   *    GetGrid() const {FlushFillBuffer(); return fData;}
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
   virtual Float_t GetUnderFlows(Int_t var, Bool_t excl=kFALSE) const;
@@ -118,12 +122,18 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  Bool_t   CanLinearise() const ;                                  // whether the cells (with under/overflows) can be numbered with a Long64_t
+  Bool_t   HasSameBinning(const AliCFGridSparse* aGrid) const ;
+  Long64_t GetCell(const Int_t* bin) const ;                       // linearised bin coordinates
+  void     GetCellCoordinates(Long64_t cell, Int_t* bin) const ;
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
+  Int_t       fFillBufferSize ; // Maximum number of buffered entries, 0 if the entries are added to fData one by one
+  mutable std::vector<std::pair<Long64_t,Double_t> > fFillBuffer ; //! Buffered entries : linearised bin and weight
 
-  ClassDef(AliCFGridSparse,3);
+  ClassDef(AliCFGridSparse,4);
 };
 
 
@@ -57,6 +57,11 @@
 // found in AliCFUnfolding::CalculateCorrelatedErrors()                //
 // Author: marta.verweij@cern.ch                                       //
 //                                                                     //
+// Without smoothing, the iterations run on a compact copy of the      //
+// conditional matrix (one row of entries per measured cell) and the   //
+// unfoldings of the randomized spectra used for the correlated errors //
+// can be spread over several threads with ::SetNThreads               //
+//                                                                     //
 // An optional possibility is to smooth the unfolded spectrum at the   //
 // end of each iteration, either using a fit function                  //
 // (only if #dimensions <=3)                                           //
@@ -84,6 +89,8 @@
 //---------------------------------------------------------------------//
 
 
+#include <atomic>
+#include <thread>
 #include "AliCFUnfolding.h"
 #include "TMath.h"
 #include "TAxis.h"
@@ -130,7 +137,15 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fNThreads(1),
+  fCSRRowStart(),
+  fCSRTrueCell(),
+  fCSRConditional(),
+  fCSRBin(),
+  fMeasuredCellCoord(),
+  fTrueCellCoord(),
+  fTrueCellIndex()
 {
   //
   // default constructor
@@ -174,7 +189,15 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fNThreads(1),
+  fCSRRowStart(),
+  fCSRTrueCell(),
+  fCSRConditional(),
+  fCSRBin(),
+  fMeasuredCellCoord(),
+  fTrueCellCoord(),
+  fTrueCellIndex()
 {
   //
   // named constructor
@@ -257,6 +280,7 @@ void AliCFUnfolding::Init() {
 
   // create the matrix of conditional probabilities P(M|T)
   CreateConditional(); //done only once at initialization
+  BuildCSR();
   
   // create the frame of the inverse response matrix
   fInverseResponse  = (THnSparse*) fResponse->Clone();
@@ -350,6 +374,11 @@ void AliCFUnfolding::Unfold() {
   // several iterations are performed until a reasonable chi2 or convergence criterion is reached
   //
 
+  if (!fUseSmoothing) { // the smoothing needs the THnSparse of each iteration
+    UnfoldWithCSR();
+    return;
+  }
+
   Int_t iIterBayes     = 0 ;
   Double_t convergence = 0.;
 
@@ -457,6 +486,8 @@ void AliCFUnfolding::CalculateCorrelatedErrors() {
 
 
   //Do fNRandomIterations = bayes iterations performed
+  if (!fUseSmoothing) UnfoldRandomizedWithCSR();
+  else
   for (int i=0; i<fNRandomIterations; i++) {
     
     // reset prior to original one
@@ -620,6 +651,318 @@ void AliCFUnfolding::CreateConditional() {
 }
 //______________________________________________________________
 
+void AliCFUnfolding::BuildCSR() {
+  //
+  // Converts the conditional matrix into a compressed row storage : 
+  // each measured cell holds the list of its (true cell, P(M|T)) entries.
+  // The cells are numbered in order of appearance in fConditional, and the entries
+  // of a row keep the order of the bins, so that the sums are done in the same order
+  // as in the THnSparse iterations
+  //
+
+  fCSRRowStart.clear();
+  fCSRTrueCell.clear();
+  fCSRConditional.clear();
+  fCSRBin.clear();
+  fMeasuredCellCoord.clear();
+  fTrueCellCoord.clear();
+  fTrueCellIndex.clear();
+
+  std::map<Long64_t,Int_t> measuredCellIndex;
+  std::vector<std::vector<Long64_t> > rowBins;
+  for (Long64_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
+    fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    Long64_t keyM = 0;
+    for (Int_t iVar=fNVariables-1; iVar>=0; iVar--) keyM = keyM * (fConditional->GetAxis(iVar)->GetNbins()+2) + fCoordinatesN_M[iVar];
+    std::pair<std::map<Long64_t,Int_t>::iterator,bool> cellM = measuredCellIndex.insert(std::make_pair(keyM,(Int_t)rowBins.size()));
+    if (cellM.second) {
+      rowBins.push_back(std::vector<Long64_t>());
+      fMeasuredCellCoord.insert(fMeasuredCellCoord.end(),fCoordinatesN_M,fCoordinatesN_M+fNVariables);
+    }
+    rowBins[cellM.first->second].push_back(iBin);
+    std::pair<std::map<Long64_t,Int_t>::iterator,bool> cellT = fTrueCellIndex.insert(std::make_pair(TrueCellKey(fCoordinatesN_T),(Int_t)(fTrueCellCoord.size()/fNVariables)));
+    if (cellT.second) fTrueCellCoord.insert(fTrueCellCoord.end(),fCoordinatesN_T,fCoordinatesN_T+fNVariables);
+  }
+
+  fCSRRowStart.push_back(0);
+  for (UInt_t iRow=0; iRow<rowBins.size(); iRow++) {
+    for (UInt_t iEntry=0; iEntry<rowBins[iRow].size(); iEntry++) {
+      Long64_t iBin = rowBins[iRow][iEntry];
+      Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
+      GetCoordinates();
+      fCSRTrueCell.push_back(fTrueCellIndex[TrueCellKey(fCoordinatesN_T)]);
+      fCSRConditional.push_back(conditionalValue);
+      fCSRBin.push_back(iBin);
+    }
+    fCSRRowStart.push_back(fCSRConditional.size());
+  }
+  AliInfo(Form("Conditional matrix : %d entries, %d measured cells, %d true cells",(Int_t)fCSRConditional.size(),(Int_t)rowBins.size(),(Int_t)(fTrueCellCoord.size()/fNVariables)));
+}
+
+//______________________________________________________________
+
+Long64_t AliCFUnfolding::TrueCellKey(const Int_t* coord) const {
+  //
+  // linearised coordinate (including under/overflows) in true space
+  //
+  Long64_t key = 0;
+  for (Int_t iVar=fNVariables-1; iVar>=0; iVar--) key = key * (fConditional->GetAxis(fNVariables+iVar)->GetNbins()+2) + coord[iVar];
+  return key;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::GetCellContents(const THnSparse* hist, const std::vector<Int_t>& cellCoord, std::vector<Double_t>& values) const {
+  //
+  // copies the content of hist in the cells of coordinates cellCoord
+  //
+  values.resize(cellCoord.size()/fNVariables);
+  for (UInt_t iCell=0; iCell<values.size(); iCell++) values[iCell] = hist->GetBinContent(&cellCoord[iCell*fNVariables]);
+}
+
+//______________________________________________________________
+
+Double_t AliCFUnfolding::GetPriorCells(const THnSparse* prior, std::vector<Double_t>& values, std::vector<Char_t>& filled, Int_t& nEmpty) const {
+  //
+  // copies the prior in the true cells, filled tells which cells are bins of the prior
+  // returns the contribution to the convergence criterion of the prior bins outside the true cells,
+  // where the unfolded spectrum is always empty. nEmpty counts those with a null content.
+  //
+  const Int_t nTrue = fTrueCellCoord.size()/fNVariables;
+  values.assign(nTrue,0.);
+  filled.assign(nTrue,0);
+  nEmpty = 0;
+  Double_t outside = 0.;
+  std::vector<Int_t> coord(fNVariables);
+  for (Long64_t iBin=0; iBin<prior->GetNbins(); iBin++) {
+    Double_t priorValue = prior->GetBinContent(iBin,&coord[0]);
+    std::map<Long64_t,Int_t>::const_iterator cell = fTrueCellIndex.find(TrueCellKey(&coord[0]));
+    if (cell != fTrueCellIndex.end()) {
+      values[cell->second] = priorValue;
+      filled[cell->second] = 1;
+    }
+    else if (priorValue > 0.) outside += 1.;
+    else nEmpty++;
+  }
+  return outside;
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::UnfoldCSR(const std::vector<Double_t>& eff, const std::vector<Double_t>& meas,
+                                std::vector<Double_t>& prior, std::vector<Char_t>& priorFilled, Double_t priorOutside,
+                                std::vector<Double_t>& unfolded, std::vector<Double_t>& estMeasured, std::vector<Double_t>& priorTimesEff,
+                                Bool_t stopAtConvergence, Double_t& convergence, Int_t& nEmptyPrior) const {
+  //
+  // Bayes iterations on the compact conditional matrix : same steps as
+  // CreateEstMeasured(), CreateInvResponse(), CreateUnfolded() and GetConvergence()
+  // the inverse response is not stored, each entry is used right away.
+  // The prior is updated in place and the number of the last iteration is returned, as in Unfold().
+  // Only reads the members, so it can run concurrently on different inputs
+  //
+  const Int_t nTrue     = prior.size();
+  const Int_t nMeasured = fCSRRowStart.size()-1;
+  priorTimesEff.resize(nTrue);
+  estMeasured.resize(nMeasured);
+
+  Int_t iIterBayes = 0;
+  for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) {
+    for (Int_t iTrue=0; iTrue<nTrue; iTrue++) priorTimesEff[iTrue] = prior[iTrue] * eff[iTrue];
+
+    // M(i) = SUM_k { COND(i,k) * T(k) * E (k)}
+    for (Int_t iMeas=0; iMeas<nMeasured; iMeas++) {
+      Double_t est = 0.;
+      for (Int_t iEntry=fCSRRowStart[iMeas]; iEntry<fCSRRowStart[iMeas+1]; iEntry++) {
+        Double_t fill = fCSRConditional[iEntry] * priorTimesEff[fCSRTrueCell[iEntry]];
+        if (fill>0.) est += fill;
+      }
+      estMeasured[iMeas] = est;
+    }
+
+    // T(i) = SUM_k { INV(i,k) * M(k) } / E(i) with INV(i,j) = COND(i,j) * T(j) * E(j) / M(i)
+    unfolded.assign(nTrue,0.);
+    for (Int_t iMeas=0; iMeas<nMeasured; iMeas++) {
+      const Double_t estMeasuredValue = estMeasured[iMeas];
+      if (!(estMeasuredValue>0.)) continue;
+      for (Int_t iEntry=fCSRRowStart[iMeas]; iEntry<fCSRRowStart[iMeas+1]; iEntry++) {
+        const Int_t iTrue = fCSRTrueCell[iEntry];
+        if (!(eff[iTrue]>0.)) continue;
+        Double_t invResponseValue = fCSRConditional[iEntry] * priorTimesEff[iTrue] / estMeasuredValue;
+        Double_t fill = invResponseValue * meas[iMeas] / eff[iTrue];
+        if (fill>0.) unfolded[iTrue] += fill;
+      }
+    }
+
+    convergence = priorOutside;
+    for (Int_t iTrue=0; iTrue<nTrue; iTrue++) {
+      if (!priorFilled[iTrue]) continue;
+      Double_t priorValue = prior[iTrue];
+      if (priorValue > 0.) convergence += ((priorValue-unfolded[iTrue])/priorValue)*((priorValue-unfolded[iTrue])/priorValue);
+      else nEmptyPrior++;
+    }
+
+    if (stopAtConvergence && fMaxConvergence>0. && convergence<fMaxConvergence) break;
+
+    // update the prior distribution
+    prior = unfolded;
+    for (Int_t iTrue=0; iTrue<nTrue; iTrue++) priorFilled[iTrue] = (unfolded[iTrue]>0.);
+    priorOutside = 0.;
+  }
+  return iIterBayes;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::SetTrueCells(THnSparse* hist, const std::vector<Double_t>& values, const std::vector<Char_t>* filled) const {
+  //
+  // resets hist and fills the true cells with zero errors : the cells flagged in filled if given,
+  // otherwise the cells with a positive value
+  //
+  hist->Reset();
+  for (UInt_t iCell=0; iCell<values.size(); iCell++) {
+    if (filled ? !(*filled)[iCell] : !(values[iCell]>0.)) continue;
+    const Int_t* coord = &fTrueCellCoord[iCell*fNVariables];
+    hist->SetBinError  (coord,0.);
+    hist->SetBinContent(coord,values[iCell]);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::UnfoldWithCSR() {
+  //
+  // Unfold() without smoothing : the spectra are copied once into the cells of the compact
+  // conditional matrix, iterated there, and the results are copied back to the THnSparse
+  //
+
+  std::vector<Double_t> eff, meas, prior, unfolded, estMeasured, priorTimesEff;
+  std::vector<Char_t> priorFilled;
+  Int_t nEmptyPrior = 0;
+  GetCellContents(fEfficiency,fTrueCellCoord,eff);
+  GetCellContents(fMeasured,fMeasuredCellCoord,meas);
+  Double_t priorOutside = GetPriorCells(fPrior,prior,priorFilled,nEmptyPrior);
+
+  Double_t convergence = 0.;
+  Int_t iIterBayes = UnfoldCSR(eff,meas,prior,priorFilled,priorOutside,unfolded,estMeasured,priorTimesEff,fNCalcCorrErrors==0,convergence,nEmptyPrior);
+  AliDebug(0,Form("convergence at iteration %d is %e",iIterBayes,convergence));
+  if (nEmptyPrior>0) AliWarning(Form("%d empty prior bins over the iterations added 0 to the convergence criterion",nEmptyPrior));
+  if (fNCalcCorrErrors==0 && iIterBayes<fMaxNumIterations) {
+    fNRandomIterations = iIterBayes;
+    AliDebug(0,Form("convergence is met at iteration %d",iIterBayes));
+  }
+
+  // copy back the results of the last iteration
+  SetTrueCells(fUnfolded,unfolded);
+  if (iIterBayes>0) SetTrueCells(fPrior,prior,&priorFilled);
+  fMeasuredEstimate->Reset();
+  for (UInt_t iMeas=0; iMeas<estMeasured.size(); iMeas++) {
+    if (!(estMeasured[iMeas]>0.)) continue;
+    const Int_t* coord = &fMeasuredCellCoord[iMeas*fNVariables];
+    fMeasuredEstimate->SetBinContent(coord,estMeasured[iMeas]);
+    fMeasuredEstimate->SetBinError  (coord,0.);
+  }
+  for (UInt_t iMeas=0; iMeas<estMeasured.size(); iMeas++) {
+    for (Int_t iEntry=fCSRRowStart[iMeas]; iEntry<fCSRRowStart[iMeas+1]; iEntry++) {
+      Double_t fill = (estMeasured[iMeas]>0. ? fCSRConditional[iEntry] * priorTimesEff[fCSRTrueCell[iEntry]] / estMeasured[iMeas] : 0.);
+      if (fill>0. || fInverseResponse->GetBinContent(fCSRBin[iEntry])>0.) {
+        fInverseResponse->SetBinContent(fCSRBin[iEntry],fill);
+        fInverseResponse->SetBinError  (fCSRBin[iEntry],0.);
+      }
+    }
+  }
+
+  if (fNCalcCorrErrors == 0) {
+    fUnfoldedFinal = (THnSparse*) fUnfolded->Clone() ;
+    AliInfo("\n================================================\nFinished bayes iteration, now calculating errors...\n================================================\n");
+    fNCalcCorrErrors = 1;
+    CalculateCorrelatedErrors();
+  }
+
+  if (fNCalcCorrErrors >1 ) {
+    AliInfo(Form("\n\n=======================\nFinished at iteration %d : convergence is %e and you required it to be < %e\n=======================\n\n",iIterBayes,convergence,fMaxConvergence));
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::UnfoldRandomizedWithCSR() {
+  //
+  // Steps 1 to 4 of CalculateCorrelatedErrors() on the compact conditional matrix.
+  // All the randomized spectra are drawn first, in the same sequence as in the THnSparse
+  // iterations, then unfolded on fNThreads threads. The delta profile is filled afterwards
+  // in the order of the randomized spectra, so the result does not depend on the number of threads
+  //
+
+  const Int_t nRandom = fNRandomIterations;
+  if (nRandom<=0) return;
+
+  std::vector<std::vector<Double_t> > eff(nRandom), meas(nRandom), unfolded(nRandom);
+  for (Int_t i=0; i<nRandom; i++) {
+    CreateRandomizedDist();
+    GetCellContents(fRandomEfficiency,fTrueCellCoord,eff[i]);
+    GetCellContents(fRandomMeasured,fMeasuredCellCoord,meas[i]);
+  }
+
+  std::vector<Double_t> priorOrig;
+  std::vector<Char_t> priorOrigFilled;
+  Int_t nEmptyOrig = 0;
+  const Double_t priorOrigOutside = GetPriorCells(fPriorOrig,priorOrig,priorOrigFilled,nEmptyOrig);
+
+  std::vector<Double_t> lastPrior(priorOrig);
+  std::vector<Char_t> lastPriorFilled(priorOrigFilled);
+  std::vector<Int_t> nEmptyPrior(nRandom,nEmptyOrig);
+  auto unfoldRandomized = [&](Int_t i) {
+    std::vector<Double_t> prior(priorOrig), estMeasured, priorTimesEff;
+    std::vector<Char_t> priorFilled(priorOrigFilled);
+    Double_t convergence = 0.;
+    UnfoldCSR(eff[i],meas[i],prior,priorFilled,priorOrigOutside,unfolded[i],estMeasured,priorTimesEff,kFALSE,convergence,nEmptyPrior[i]);
+    if (i==nRandom-1) {
+      lastPrior.swap(prior);
+      lastPriorFilled.swap(priorFilled);
+    }
+  };
+
+  const Int_t nThreads = TMath::Min(TMath::Max(fNThreads,1),nRandom);
+  if (nThreads==1) {
+    for (Int_t i=0; i<nRandom; i++) unfoldRandomized(i);
+  }
+  else {
+    std::atomic<Int_t> next(0);
+    std::vector<std::thread> workers;
+    for (Int_t iThread=0; iThread<nThreads; iThread++) {
+      workers.push_back(std::thread([&]() {
+        for (Int_t i=next++; i<nRandom; i=next++) unfoldRandomized(i);
+      }));
+    }
+    for (UInt_t iThread=0; iThread<workers.size(); iThread++) workers[iThread].join();
+  }
+  AliInfo(Form("Unfolded %d randomized distributions on %d thread(s)",nRandom,nThreads));
+
+  Int_t nEmpty = 0;
+  for (Int_t i=0; i<nRandom; i++) nEmpty += nEmptyPrior[i];
+  if (nEmpty>0) AliWarning(Form("%d empty prior bins over the randomized unfoldings added 0 to the convergence criterion",nEmpty));
+
+  for (Int_t i=0; i<nRandom; i++) {
+    SetTrueCells(fUnfolded,unfolded[i]);
+    FillDeltaUnfoldedProfile();
+  }
+
+  // leave the spectra of the last randomized unfolding, as the THnSparse iterations do
+  SetTrueCells(fPrior,lastPrior,&lastPriorFilled);
+  if (fResponse) delete fResponse ;
+  fResponse = (THnSparse*) fRandomResponse->Clone();
+  fResponse->SetTitle("Response");
+  if (fEfficiency) delete fEfficiency ;
+  fEfficiency = (THnSparse*) fRandomEfficiency->Clone();
+  fEfficiency->SetTitle("Efficiency");
+  if (fMeasured)   delete fMeasured   ;
+  fMeasured = (THnSparse*) fRandomMeasured->Clone();
+  fMeasured->SetTitle("Measured");
+}
+
+//______________________________________________________________
+
 Int_t AliCFUnfolding::GetDOF() {
   //
   // number of dof = number of bins
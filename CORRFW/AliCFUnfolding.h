@@ -10,6 +10,8 @@
 // Author : renaud.vernet@cern.ch                                     //
 //--------------------------------------------------------------------//
 
+#include <map>
+#include <vector>
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -36,6 +38,7 @@ class AliCFUnfolding : public TNamed {
   }
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
+  void SetNThreads(Int_t n = 1) {fNThreads = n;} // number of threads over which the unfoldings of the randomized spectra are distributed
 
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
@@ -111,6 +114,16 @@ class AliCFUnfolding : public TNamed {
   THnSparse     *fDeltaUnfoldedN;    // Entries of the delta-unfolded distribution (count for each bin)
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
+  Int_t          fNThreads;          // Number of threads for the unfoldings of the randomized spectra
+
+  /* compact representation of the conditional matrix, used by the iterations when no smoothing is requested */
+  std::vector<Int_t>       fCSRRowStart;        //! first entry of each measured cell (one more element than measured cells)
+  std::vector<Int_t>       fCSRTrueCell;        //! true cell of each entry
+  std::vector<Double_t>    fCSRConditional;     //! P(M|T) of each entry
+  std::vector<Long64_t>    fCSRBin;             //! bin of each entry in fConditional / fInverseResponse
+  std::vector<Int_t>       fMeasuredCellCoord;  //! coordinates of the measured cells (fNVariables per cell)
+  std::vector<Int_t>       fTrueCellCoord;      //! coordinates of the true cells (fNVariables per cell)
+  std::map<Long64_t,Int_t> fTrueCellIndex;      //! true cell of a linearised true coordinate
 
 
   // functions
@@ -132,7 +145,20 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  /* iterations on the compact conditional matrix */
+  void     BuildCSR();                  // converts the conditional matrix to the compact representation
+  Long64_t TrueCellKey(const Int_t* coord) const; // linearised coordinate in true space
+  void     GetCellContents(const THnSparse* hist, const std::vector<Int_t>& cellCoord, std::vector<Double_t>& values) const;
+  Double_t GetPriorCells(const THnSparse* prior, std::vector<Double_t>& values, std::vector<Char_t>& filled, Int_t& nEmpty) const;
+  Int_t    UnfoldCSR(const std::vector<Double_t>& eff, const std::vector<Double_t>& meas,
+                     std::vector<Double_t>& prior, std::vector<Char_t>& priorFilled, Double_t priorOutside,
+                     std::vector<Double_t>& unfolded, std::vector<Double_t>& estMeasured, std::vector<Double_t>& priorTimesEff,
+                     Bool_t stopAtConvergence, Double_t& convergence, Int_t& nEmptyPrior) const;
+  void     SetTrueCells(THnSparse* hist, const std::vector<Double_t>& values, const std::vector<Char_t>* filled = 0x0) const;
+  void     UnfoldWithCSR();             // Unfold() on the compact representation
+  void     UnfoldRandomizedWithCSR();   // unfolds the randomized spectra on the compact representation
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
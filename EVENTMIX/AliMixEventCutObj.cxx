@@ -15,6 +15,8 @@
 #include "AliAODVertex.h"
 #include "AliEventplane.h"
 
+#include <TMath.h>
+
 #include "AliMixEventCutObj.h"
 
 ClassImp(AliMixEventCutObj)
@@ -27,13 +29,15 @@ AliMixEventCutObj::AliMixEventCutObj(AliMixEventCutObj::EEPAxis_t type, Float_t
    fCutMax(max),
    fCutStep(step),
    fCutSmallVal(0),
-   fCurrentVal(min)
+   fCurrentVal(min),
+   fBinLowEdges()
 {
    //
    // Default constructor
    //
    AliDebug(AliLog::kDebug + 5, "<-");
    if (fCutStep < 1e-5) AliError("fCutStep is too small !!! This cut will not work !!!");
+   else InitBinEdges();
    AliDebug(AliLog::kDebug + 5, "->");
 }
 
@@ -45,7 +49,8 @@ AliMixEventCutObj::AliMixEventCutObj(const AliMixEventCutObj &obj) : TObject(obj
    fCutMax(obj.fCutMax),
    fCutStep(obj.fCutStep),
    fCutSmallVal(obj.fCutSmallVal),
-   fCurrentVal(obj.fCurrentVal)
+   fCurrentVal(obj.fCurrentVal),
+   fBinLowEdges(obj.fBinLowEdges)
 {
    //
    // Copy constructor
@@ -69,6 +74,7 @@ AliMixEventCutObj &AliMixEventCutObj::operator=(const AliMixEventCutObj &obj)
       fCutStep = obj.fCutStep;
       fCutSmallVal = obj.fCutSmallVal;
       fCurrentVal = obj.fCurrentVal;
+      fBinLowEdges = obj.fBinLowEdges;
 //       fNoMore = obj.fNoMore;
    }
    return *this;
@@ -137,6 +143,13 @@ Int_t AliMixEventCutObj::GetBinNumber(Float_t num) const
    // Returns bin (index) number in current cut.
    // Returns -1 in case of out of range
    //
+   if (fBinLowEdges.GetSize() > 0) {
+      // bins are ordered, so only the last one starting below num can match
+      Int_t iBin = (Int_t)TMath::BinarySearch((Long64_t)fBinLowEdges.GetSize(), fBinLowEdges.GetArray(), num);
+      if (iBin < 0) return -1;
+      if (num < fBinLowEdges[iBin] + fCutStep - fCutSmallVal) return iBin + 1;
+      return -1;
+   }
    Int_t binNum = 0;
    for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) {
       binNum++;
@@ -146,7 +159,19 @@ Int_t AliMixEventCutObj::GetBinNumber(Float_t num) const
    }
    return -1;
 }
-
+//_________________________________________________________________________________________________
+void AliMixEventCutObj::InitBinEdges()
+{
+   //
+   // Caches the lower bin edges exactly as GetBinNumber steps through them,
+   // so that the bin of a value can be found with a binary search
+   //
+   Int_t nBins = 0;
+   for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) nBins++;
+   fBinLowEdges.Set(nBins);
+   Int_t iBin = 0;
+   for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) fBinLowEdges[iBin++] = iCurrent;
+}
 //_________________________________________________________________________________________________
 Int_t AliMixEventCutObj::GetIndex(AliVEvent *ev)
 {
@@ -8,6 +8,8 @@
 //        Martin Vala (martin.vala@cern.ch)
 //
 
+#include <algorithm>
+
 #include <TEntryList.h>
 
 #include "AliLog.h"
@@ -23,7 +25,10 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fUseCompactEntryLists(kFALSE),
+   fBinStrides(),
+   fCompactEntryLists()
 {
    //
    // Default constructor.
@@ -37,7 +42,10 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fUseCompactEntryLists(obj.fUseCompactEntryLists),
+   fBinStrides(obj.fBinStrides),
+   fCompactEntryLists(obj.fCompactEntryLists)
 {
    //
    // Copy constructor
@@ -59,6 +67,9 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fUseCompactEntryLists = obj.fUseCompactEntryLists;
+      fBinStrides = obj.fBinStrides;
+      fCompactEntryLists = obj.fCompactEntryLists;
    }
    return *this;
 }
@@ -97,7 +108,7 @@ void AliMixEventPool::Print(const Option_t *option) const
    TEntryList *el;
    for (Int_t i = 0; i < fListOfEntryList.GetEntries(); i++) {
       el = (TEntryList *) fListOfEntryList.At(i);
-      AliDebug(AliLog::kDebug, Form("EntryList[%d] %lld", i, el->GetN()));
+      AliDebug(AliLog::kDebug, Form("EntryList[%d] %lld", i, GetNEntries(i + 1)));
    }
 }
 //_________________________________________________________________________________________________
@@ -111,10 +122,31 @@ Int_t AliMixEventPool::Init()
    fBinNumber++;
    AliDebug(AliLog::kDebug, Form("fBinnumber = %d", fBinNumber));
    AddEntryList();
+   InitBinStrides();
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
 }
 
+//_________________________________________________________________________________________________
+void AliMixEventPool::InitBinStrides()
+{
+   //
+   // Entry lists are created with the first cut running fastest, so the list of
+   // an event is 1 + sum((index_i - 1) * stride_i) with stride_i = prod_(j<i) nbins_j
+   //
+   Int_t numCuts = fListOfEventCuts.GetEntriesFast();
+   fBinStrides.Set(numCuts);
+   Int_t stride = 1;
+   AliMixEventCutObj *cut;
+   for (Int_t i = 0; i < numCuts; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
+      cut->InitBinEdges();
+      fBinStrides[i] = stride;
+      stride *= cut->GetNumberOfBins();
+   }
+   if (fUseCompactEntryLists) fCompactEntryLists.resize(fListOfEntryList.GetEntriesFast());
+}
+
 //_________________________________________________________________________________________________
 void AliMixEventPool::CreateEntryListsRecursivly(Int_t index)
 {
@@ -173,16 +205,37 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
       AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
       return kFALSE;
    }
-   Int_t idEntryList = -1;
-   TEntryList *el =  FindEntryList(ev, idEntryList);
-   if (el) {
+   AliDebug(AliLog::kDebug + 5, "->");
+   return AddEntry(entry, FindEntryListIndex(ev));
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventPool::AddEntry(Long64_t entry, Int_t idEntryList)
+{
+   //
+   // Adds entry to entry list idEntryList (as returned by FindEntryList)
+   //
+   if (entry < 0 || idEntryList < 1 || idEntryList > fListOfEntryList.GetEntriesFast()) {
+      AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
+      return kFALSE;
+   }
+   if (fUseCompactEntryLists) {
+      if ((Int_t)fCompactEntryLists.size() < fListOfEntryList.GetEntriesFast()) fCompactEntryLists.resize(fListOfEntryList.GetEntriesFast());
+      std::vector<Long64_t> &entries = fCompactEntryLists[idEntryList - 1];
+      // entries come in increasing order, so normally this is just an append
+      if (entries.empty() || entry > entries.back()) {
+         entries.push_back(entry);
+      } else {
+         std::vector<Long64_t>::iterator it = std::lower_bound(entries.begin(), entries.end(), entry);
+         if (*it != entry) entries.insert(it, entry);
+      }
+   } else {
+      TEntryList *el = (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+      if (!el) return kFALSE;
       el->Enter(entry);
-      AliDebug(AliLog::kDebug, Form("Entry %lld was added with idEntryList %d !!!", entry, idEntryList));
-      return kTRUE;
    }
-   AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
-   AliDebug(AliLog::kDebug + 5, "->");
-   return kFALSE;
+   AliDebug(AliLog::kDebug, Form("Entry %lld was added with idEntryList %d !!!", entry, idEntryList));
+   return kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -192,49 +245,66 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
    // Find entrlist in list of entrlist
    //
    AliDebug(AliLog::kDebug + 5, "<-");
+   if (fListOfEventCuts.GetEntriesFast() < 1) return 0;
+   idEntryList = FindEntryListIndex(ev);
+   if (idEntryList < 1) return 0;
+   AliDebug(AliLog::kDebug + 5, "->");
+   // index which start with 0 (idEntryList-1)
+   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::FindEntryListIndex(AliVEvent *ev)
+{
+   //
+   // Returns index (starting from 1) of entry list for event ev
+   // and -1 if the event is outside of any cut
+   //
    Int_t num = fListOfEventCuts.GetEntriesFast();
-   if (num < 1) return 0;
-   Int_t *indexes = new Int_t[num] ;
-   Int_t *lenght = new Int_t[num];
-   Int_t i = 0;
-   TObjArrayIter next(&fListOfEventCuts);
+   if (num < 1) return -1;
+   if (fBinStrides.GetSize() != num) InitBinStrides();
+   Int_t idEntryList = 1;
+   Int_t index;
    AliMixEventCutObj *cut;
-   while ((cut = (AliMixEventCutObj *) next())) {
-      indexes[i] = cut->GetIndex(ev);
-      if (indexes[i] < 0) {
+   for (Int_t i = 0; i < num; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.UncheckedAt(i);
+      index = cut->GetIndex(ev);
+      if (index < 0) {
          AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
-         delete [] indexes;
-         delete [] lenght;
-         return 0;
+         return -1;
       }
-      lenght[i] = cut->GetNumberOfBins();
-      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
-      i++;
+      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, index));
+      idEntryList += (index - 1) * fBinStrides[i];
    }
-   idEntryList = 0;
-   SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
    AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
-   // index which start with 0 (idEntryList-1)
-   delete [] indexes;
-   delete [] lenght;
-   AliDebug(AliLog::kDebug + 5, "->");
-   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   return idEntryList;
 }
 
 //_________________________________________________________________________________________________
-void AliMixEventPool::SearchIndexRecursive(Int_t num, Int_t *i, Int_t *d, Int_t &index)
+Long64_t AliMixEventPool::GetNEntries(Int_t idEntryList) const
 {
    //
-   // Search for index of entrylist
+   // Returns number of entries in entry list idEntryList
    //
-   AliDebug(AliLog::kDebug + 5, "<-");
-   if (num > 0) {
-      index += (i[num] - 1) * d[num - 1];
-      SearchIndexRecursive(num - 1, i, d, index);
-   } else {
-      index += i[num];
+   if (idEntryList < 1 || idEntryList > fListOfEntryList.GetEntriesFast()) return 0;
+   if (fUseCompactEntryLists) {
+      if (idEntryList > (Int_t)fCompactEntryLists.size()) return 0;
+      return fCompactEntryLists[idEntryList - 1].size();
    }
-   AliDebug(AliLog::kDebug + 5, "->");
+   TEntryList *el = (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   return el ? el->GetN() : 0;
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventPool::GetEntry(Int_t idEntryList, Long64_t i) const
+{
+   //
+   // Returns i-th entry of entry list idEntryList (-1 if out of range)
+   //
+   if (i < 0 || i >= GetNEntries(idEntryList)) return -1;
+   if (fUseCompactEntryLists) return fCompactEntryLists[idEntryList - 1][i];
+   TEntryList *el = (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   return el->GetEntry((Int_t)i);
 }
 
 //_________________________________________________________________________________________________
@@ -245,47 +315,28 @@ Bool_t AliMixEventPool::SetCutValuesFromBinIndex(Int_t index)
    //
 
    Int_t numCuts = fListOfEventCuts.GetEntriesFast();
-   Int_t *lenght = new Int_t[numCuts];
-   Int_t *indexes = new Int_t[numCuts];
+   if (fBinStrides.GetSize() != numCuts) InitBinStrides();
    Long64_t timesNum = 1;
    AliMixEventCutObj *cut;
-   Int_t i = 0, j = 0;
+   Int_t i = 0;
    for (i = 0; i < numCuts; i++) {
       cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
-      cut->Reset();
-      lenght[i] = cut->GetNumberOfBins();
-      indexes[i] = 1;
-      timesNum *= lenght[i];
+      timesNum *= cut->GetNumberOfBins();
    }
 
    if (index < 0 || index >= timesNum) {
 //       AliError(Form("index=%d is out of range !!!", index));
-      delete [] lenght;
-      delete [] indexes;
       return kFALSE;
    }
 
-   Long64_t indexNum = index;
-   for (i = 0; i < numCuts; i++) {
-      timesNum = 1;
-      for (j = 0; j < numCuts - i - 1; j++) timesNum *= lenght[j];
-      indexNum /= timesNum;
-      indexes[numCuts - i - 1] = indexNum + 1;
-      index -= indexNum * timesNum;
-      indexNum = index;
-   }
-
+   Int_t binIndex;
    for (i = 0; i < numCuts; i++) {
       cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
-      for (j = 0; j < indexes[i]; j++) cut->AddStep();
+      binIndex = (index / fBinStrides[i]) % cut->GetNumberOfBins() + 1;
+      cut->SetCurrentValueToIndex(binIndex);
       cut->PrintCurrentInterval();
-
+      AliDebug(AliLog::kDebug, Form("indexes[%d]=%d", i, binIndex));
    }
 
-   for (i = 0; i < numCuts; i++) AliDebug(AliLog::kDebug, Form("indexes[%d]=%d", i, indexes[i]));
-
-   delete [] lenght;
-   delete [] indexes;
-
    return kTRUE;
 }
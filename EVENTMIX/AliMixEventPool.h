@@ -13,6 +13,8 @@
 
 #include <TObjArray.h>
 #include <TNamed.h>
+#include <TArrayI.h>
+#include <vector>
 
 class TEntryList;
 class AliMixEventCutObj;
@@ -31,11 +33,16 @@ public:
    Int_t       Init();
 
    void        CreateEntryListsRecursivly(Int_t index);
-   void        SearchIndexRecursive(Int_t num, Int_t *i, Int_t *d, Int_t &index);
    TEntryList *AddEntryList();
 
    Bool_t      AddEntry(Long64_t entry, AliVEvent *ev);
+   Bool_t      AddEntry(Long64_t entry, Int_t idEntryList);
    TEntryList *FindEntryList(AliVEvent *ev, Int_t &idEntryList);
+   Int_t       FindEntryListIndex(AliVEvent *ev);
+
+   // number of entries and i-th entry of entry list idEntryList (as returned by FindEntryList)
+   Long64_t    GetNEntries(Int_t idEntryList) const;
+   Long64_t    GetEntry(Int_t idEntryList, Long64_t i) const;
 
    void        AddCut(AliMixEventCutObj *cut);
 
@@ -48,6 +55,9 @@ public:
    void        SetMixNumber(Int_t numMix) { fMixNumber = numMix; }
    Int_t       GetBufferSize() const { return fBufferSize; }
    Int_t       GetMixNumber() const { return fMixNumber; }
+   // store entries in sorted Long64_t vectors instead of the TEntryLists (which then stay empty)
+   void        SetUseCompactEntryLists(Bool_t b = kTRUE) { fUseCompactEntryLists = b; }
+   Bool_t      GetUseCompactEntryLists() const { return fUseCompactEntryLists; }
 
 private:
 
@@ -57,8 +67,14 @@ private:
    Int_t       fBinNumber;             // bin number
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
+   Bool_t      fUseCompactEntryLists;  // entries are kept in fCompactEntryLists
+
+   TArrayI     fBinStrides;            //! entry list index stride of each cut
+   std::vector<std::vector<Long64_t> > fCompactEntryLists; //! sorted entries per entry list
+
+   void        InitBinStrides();
 
-   ClassDef(AliMixEventPool, 1)
+   ClassDef(AliMixEventPool, 2)
 };
 
 #endif
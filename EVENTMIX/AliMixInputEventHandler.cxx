@@ -37,6 +37,8 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fDoMixExtra(kTRUE),
    fDoMixIfNotEnoughEvents(kTRUE),
    fDoMixEventGetEntryAuto(kTRUE),
+   fMixCacheSize(0),
+   fMixAsyncPrefetch(kTRUE),
    fCurrentEntry(0),
    fCurrentEntryMain(0),
    fCurrentEntryMix(0),
@@ -153,6 +155,7 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
    for (Int_t i = 0; i < fInputHandlers.GetEntries(); i++) {
       AliDebug(AliLog::kDebug + 5, Form("fInputHandlers[%d]", i));
       mixIHI = new AliMixInputHandlerInfo(fMixIntupHandlerInfoTmp->GetName(), fMixIntupHandlerInfoTmp->GetTitle());
+      mixIHI->SetCache(fMixCacheSize, fMixAsyncPrefetch);
       if (doPrepareEntry) mixIHI->PrepareEntry(che, -1, (AliInputEventHandler *)InputEventHandler(i), fAnalysisType);
       AliDebug(AliLog::kDebug + 5, Form("chain[%d]->GetEntries() = %lld", i, mixIHI->GetChain()->GetEntries()));
       fMixTrees.Add(mixIHI);
@@ -297,8 +300,6 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    Long64_t zeroChainEntries = fMixIntupHandlerInfoTmp->GetChain()->GetEntries() - inEvHMain->GetTree()->GetTree()->GetEntries();
    // fill entry
    Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
-   // fills entry
-   if (fEventPool && inEvHMain) fEventPool->AddEntry(currentMainEntry, inEvHMain->GetEvent());
    // start of
    AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ BEGIN SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
    // reset mix number
@@ -306,7 +307,11 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    Long64_t elNum = 0;
    TEntryList *el = 0;
    Int_t idEntryList = -1;
-   if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   if (fEventPool) {
+      // finds entry list of the event and fills entry to it
+      el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+      if (el) fEventPool->AddEntry(currentMainEntry, idEntryList);
+   }
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
       AliDebug(AliLog::kDebug + 3, Form("-> fEntryCounter == 0"));
@@ -320,7 +325,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
       UserExecMixAllTasks(fEntryCounter, -1, fEntryCounter, -1, 0);
       return kTRUE;
    } else {
-      elNum = el->GetN();
+      elNum = fEventPool->GetNEntries(idEntryList);
       if (elNum < fBufferSize + 1) {
          UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
          AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (%lld) LESS THEN BUFFER +++++++++++++++++++", fEntryCounter, elNum));
@@ -339,7 +344,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
          if (elNum >= fBufferSize) {
             Long64_t entryInEntryList =  elNum - 2 - counter;
             if (entryInEntryList < 0) break;
-            entryMix = el->GetEntry(entryInEntryList);
+            entryMix = fEventPool->GetEntry(idEntryList, entryInEntryList);
          }
       }
       AliDebug(AliLog::kDebug + 5, Form("Handler[%d] entryMix %lld ", counter, entryMix));
@@ -398,7 +403,6 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Long64_t zeroChainEntries = fMixIntupHandlerInfoTmp->GetChain()->GetEntries() - inEvHMain->GetTree()->GetTree()->GetEntries();
    // fill entry
    Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
-   if (fEventPool && inEvHMain) fEventPool->AddEntry(currentMainEntry, inEvHMain->GetEvent());
    // start of
    AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ BEGIN SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
    // reset mix number
@@ -406,7 +410,11 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Long64_t elNum = 0;
    Int_t idEntryList = -1;
    TEntryList *el = 0;
-   if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   if (fEventPool) {
+      // finds entry list of the event and fills entry to it
+      el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+      if (el) fEventPool->AddEntry(currentMainEntry, idEntryList);
+   }
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
       // runs UserExecMix for all tasks, if needed
@@ -426,7 +434,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
          return kTRUE;
       }
    } else {
-      elNum = el->GetN();
+      elNum = fEventPool->GetNEntries(idEntryList);
       if (elNum < fBufferSize + 1) {
          if (fDoMixIfNotEnoughEvents) {
             // include main event in to counter in this case (so idEntryList>0)
@@ -462,7 +470,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
       Long64_t entryInEntryList =  elNum - 2 - counter;
       AliDebug(AliLog::kDebug + 3, Form("entryInEntryList=%lld", entryInEntryList));
       if (entryInEntryList < 0) break;
-      entryMix = el->GetEntry(entryInEntryList);
+      entryMix = fEventPool->GetEntry(idEntryList, entryInEntryList);
       AliDebug(AliLog::kDebug + 3, Form("entryMix=%lld", entryMix));
       if (entryMix < 0) break;
       entryMixReal = entryMix;
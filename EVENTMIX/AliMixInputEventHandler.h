@@ -70,6 +70,8 @@ public:
    Bool_t                  IsMixingIfNotEnoughEvents() { return fDoMixIfNotEnoughEvents;}
 
    void                    DoMixEventGetEntryAuto(Bool_t doAuto=kTRUE) { fDoMixEventGetEntryAuto = doAuto; }
+   // read cache (and background prefetching) for the trees of mixed events
+   void                    SetMixCache(Long64_t cacheSize, Bool_t asyncPrefetch=kTRUE) { fMixCacheSize = cacheSize; fMixAsyncPrefetch = asyncPrefetch; }
 
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
@@ -89,6 +91,8 @@ private:
    Bool_t                  fDoMixExtra;            // mix extra events to get enough combinations
    Bool_t                  fDoMixIfNotEnoughEvents;// mix events if they don't have enough events to mix
    Bool_t                  fDoMixEventGetEntryAuto;// flag for preparing mixed events automatically (default on)
+   Long64_t                fMixCacheSize;          // read cache size for mixed events (<= 0: no cache)
+   Bool_t                  fMixAsyncPrefetch;      // prefetch mixed events in background thread
 
    // mixing info
    Long64_t fCurrentEntry;       //! current entry number (adds 1 for every event processed on each worker)
@@ -110,7 +114,7 @@ private:
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include <TChain.h>
 #include <TFile.h>
 #include <TChainElement.h>
+#include <TTreeCache.h>
 
 #include "AliLog.h"
 #include "AliInputEventHandler.h"
@@ -24,7 +25,9 @@ AliMixInputHandlerInfo::AliMixInputHandlerInfo(const char *name, const char *tit
    fChain(0),
    fChainEntriesArray(),
    fZeroEntryNumber(0),
-   fNeedNotify(kFALSE)
+   fNeedNotify(kFALSE),
+   fCacheSize(0),
+   fAsyncPrefetch(kTRUE)
 {
    //
    // Default constructor.
@@ -131,6 +134,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain = new TChain(te->GetName());
          fChain->AddFile(te->GetTitle());
          fChain->GetEntry(0);
+         SetupReadCache();
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
       }
@@ -149,6 +153,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain = new TChain(te->GetName());
          fChain->AddFile(te->GetTitle());
          fChain->GetEntry(0);
+         SetupReadCache();
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
          eh->Notify(te->GetTitle());
@@ -180,3 +185,22 @@ Long64_t AliMixInputHandlerInfo::GetEntries()
    if (fChain) return fChain->GetEntries();
    return -1;
 }
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::SetupReadCache()
+{
+   //
+   // Mixed events are read one by one with random access, which goes to the
+   // file for every basket. A read cache fetches whole clusters instead and,
+   // with async prefetching, the next ones in a background thread, so the
+   // recent events of a bin are usually in memory already when requested
+   //
+   if (!fChain || fCacheSize <= 0) return;
+   fChain->SetCacheSize(fCacheSize);
+   fChain->AddBranchToCache("*", kTRUE);
+   TFile *file = fChain->GetCurrentFile();
+   if (!file) return;
+   TTreeCache *cache = dynamic_cast<TTreeCache *>(file->GetCacheRead(fChain));
+   if (cache && fAsyncPrefetch) cache->SetEnablePrefetching(kTRUE);
+   AliDebug(AliLog::kDebug, Form("Read cache %lld (prefetching %d) for %s", fCacheSize, fAsyncPrefetch, file->GetName()));
+}
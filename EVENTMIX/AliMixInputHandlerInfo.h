@@ -30,6 +30,8 @@ public:
    void PrepareEntry(TChainElement *te, Long64_t entry, AliInputEventHandler *eh, Option_t *opt);
 
    void SetZeroEntryNumber(Long64_t num) { fZeroEntryNumber = num; }
+   // read cache for the tree of mixed events (cacheSize <= 0: no cache)
+   void SetCache(Long64_t cacheSize, Bool_t asyncPrefetch = kTRUE) { fCacheSize = cacheSize; fAsyncPrefetch = asyncPrefetch; }
    TChainElement *GetEntryInTree(Long64_t &entry);
    Long64_t      GetEntries();
 
@@ -38,11 +40,15 @@ private:
    TArrayI   fChainEntriesArray;   // array of entries of every chaing
    Long64_t  fZeroEntryNumber;     // zero entry number (will be used when we will delete not needed chains)
    Bool_t    fNeedNotify;          // flag if Notify is needed for current input handler
+   Long64_t  fCacheSize;           // size of read cache of fChain (<= 0: no cache)
+   Bool_t    fAsyncPrefetch;       // read cache prefetches in background thread
+
+   void      SetupReadCache();
 
    AliMixInputHandlerInfo(const AliMixInputHandlerInfo &handler);
    AliMixInputHandlerInfo &operator=(const AliMixInputHandlerInfo &handler);
 
-   ClassDef(AliMixInputHandlerInfo, 1); // Mix Input Handler info
+   ClassDef(AliMixInputHandlerInfo, 2); // Mix Input Handler info
 };
 
 #endif // ALIMIXINPUTHANDLERINFO_H
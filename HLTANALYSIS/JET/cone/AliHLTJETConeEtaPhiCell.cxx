@@ -109,8 +109,35 @@ void AliHLTJETConeEtaPhiCell::Clear( Option_t* /*option*/ ) {
   // see header file for class documentation
 
   if ( fTrackList )
-    delete fTrackList;
-  fTrackList = NULL;
+    fTrackList->Clear();
+
+  fPt      = 0.;
+  fEta     = 0.;
+  fPhi     = 0.;
+  fNTracks = 0;
+
+  return;
+}
+
+//##################################################################################
+void AliHLTJETConeEtaPhiCell::Set( Int_t etaIdx, Int_t phiIdx, Int_t trackType ) {
+  // see header file for class documentation
+
+  HLTDebug("New cell for track type %d etaIdx %d - phiIdx %d", trackType, etaIdx, phiIdx );
+
+  fEtaIdx    = etaIdx;
+  fPhiIdx    = phiIdx;
+  fTrackType = trackType;
+
+  if ( fTrackList )
+    fTrackList->Clear();
+  else
+    fTrackList = new TObjArray(20); // XXXXXX 20
+
+  fPt      = 0.;
+  fEta     = 0.;
+  fPhi     = 0.;
+  fNTracks = 0;
 
   return;
 }
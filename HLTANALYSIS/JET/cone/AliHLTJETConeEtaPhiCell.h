@@ -46,6 +46,11 @@ public:
    * ---------------------------------------------------------------------------------
    */
   
+  /** Standard constructor, used by TClonesArray::ConstructedAt
+   *  the cell is set up with Set before tracks are added
+   */
+  AliHLTJETConeEtaPhiCell();
+
   /** Constructor for ESD tracks */
   AliHLTJETConeEtaPhiCell( Int_t etaIdx, Int_t phiIdx, AliESDtrack* track );
 
@@ -55,9 +60,18 @@ public:
   /** Destructor */
   ~AliHLTJETConeEtaPhiCell();
 
-  /** A destructor like class, called by TClonesArray->Clear("C") */
+  /** A destructor like class, called by TClonesArray->Clear("C") 
+   *  the track list is kept for the next use of the cell
+   */
   void Clear(Option_t* option = "");
 
+  /** Set up an empty cell, reusing its track list
+   *  @param etaIdx    cell eta index
+   *  @param phiIdx    cell phi index
+   *  @param trackType type of tracks (TrackType_t)
+   */
+  void Set( Int_t etaIdx, Int_t phiIdx, Int_t trackType );
+
   /*
    * ---------------------------------------------------------------------------------
    *                                     Getter
@@ -105,9 +119,6 @@ public:
 
  private:
 
-  /** Standard constructor prohibited */
-  AliHLTJETConeEtaPhiCell();
-
   /** copy constructor prohibited */
   AliHLTJETConeEtaPhiCell(const AliHLTJETConeEtaPhiCell&);
 
@@ -159,16 +159,8 @@ Int_t AliHLTJETConeGrid::FillTrack( TParticle* particle, const Float_t* aEtaPhi,
   // -- Fill track in primary region
   // ---------------------------
   
-  // -- Create new cell and add track to cell
-  if (! fGrid->UncheckedAt( aGridIdx[kIdxPrimary] ) ) {
-    new( (*fGrid ) [aGridIdx[kIdxPrimary]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiPrimary], 
-								      particle );
-  }
-  // -- Add track to existing cell
-  else {
-    (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxPrimary]]))->AddTrack(particle);
-  }
+  // -- Get cell (create it if needed) and add track to cell
+  GetCell( aGridIdx[kIdxPrimary], aGridIdx[kIdxEtaPrimary], aGridIdx[kIdxPhiPrimary], kTrackMC )->AddTrack(particle);
 
   // ---------------------------
   // -- Fill track in outter region
@@ -177,16 +169,8 @@ Int_t AliHLTJETConeGrid::FillTrack( TParticle* particle, const Float_t* aEtaPhi,
   // -- if it has to be filled
   if ( iResult == 1 ) {
 
-    // -- Create new cell and add track to cell
-    if (! fGrid->UncheckedAt( aGridIdx[kIdxOutter] ) ) {
-      new( (*fGrid) [aGridIdx[kIdxOutter]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiOutter], 
-								      particle );
-    }
-    // -- Add track to existing cell
-    else {
-      (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxOutter]]))->AddTrack(particle);
-    }
+    // -- Get cell (create it if needed) and add track to cell
+    GetCell( aGridIdx[kIdxOutter], aGridIdx[kIdxEtaPrimary], aGridIdx[kIdxPhiOutter], kTrackMC )->AddTrack(particle);
   }
 
   return 0;
@@ -211,16 +195,8 @@ Int_t AliHLTJETConeGrid::FillTrack( AliESDtrack *esdTrack, const Float_t* aEtaPh
   // -- Fill track in primary region
   // ---------------------------
   
-  // -- Create new cell and add track to cell
-  if (! fGrid->UncheckedAt( aGridIdx[kIdxPrimary] ) ) {
-    new( (*fGrid ) [aGridIdx[kIdxPrimary]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiPrimary], 
-								      esdTrack );
-  }
-  // -- Add track to existing cell
-  else {
-    (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxPrimary]]))->AddTrack(esdTrack);
-  }
+  // -- Get cell (create it if needed) and add track to cell
+  GetCell( aGridIdx[kIdxPrimary], aGridIdx[kIdxEtaPrimary], aGridIdx[kIdxPhiPrimary], kTrackESD )->AddTrack(esdTrack);
    
   // ---------------------------
   // -- Fill track in outter region
@@ -229,16 +205,8 @@ Int_t AliHLTJETConeGrid::FillTrack( AliESDtrack *esdTrack, const Float_t* aEtaPh
   // -- if it has to be filled
   if ( iResult == 1 ) {
     
-    // -- Create new cell and add track to cell
-    if (! fGrid->UncheckedAt( aGridIdx[kIdxOutter] ) ) {
-      new( (*fGrid) [aGridIdx[kIdxOutter]] ) AliHLTJETConeEtaPhiCell( aGridIdx[kIdxEtaPrimary], 
-								      aGridIdx[kIdxPhiOutter], 
-								      esdTrack );
-    }
-    // -- Add track to existing cell
-    else {
-      (reinterpret_cast<AliHLTJETConeEtaPhiCell*> ((*fGrid)[aGridIdx[kIdxOutter]]))->AddTrack(esdTrack);
-    }
+    // -- Get cell (create it if needed) and add track to cell
+    GetCell( aGridIdx[kIdxOutter], aGridIdx[kIdxEtaPrimary], aGridIdx[kIdxPhiOutter], kTrackESD )->AddTrack(esdTrack);
   }
   
   return 0;
@@ -301,6 +269,21 @@ void AliHLTJETConeGrid::SetCellIter( const Int_t etaIdx, const Int_t phiIdx ) {
  * ---------------------------------------------------------------------------------
  */
 
+//##################################################################################
+AliHLTJETConeEtaPhiCell* AliHLTJETConeGrid::GetCell( Int_t cellIdx, Int_t etaIdx, Int_t phiIdx, Int_t trackType ) {
+  // see header file for class documentation
+
+  AliHLTJETConeEtaPhiCell* cell = reinterpret_cast<AliHLTJETConeEtaPhiCell*> (fGrid->UncheckedAt(cellIdx));
+  if ( cell )
+    return cell;
+
+  // -- Empty in this event : reuse the cell object kept from a previous event
+  cell = reinterpret_cast<AliHLTJETConeEtaPhiCell*> (fGrid->ConstructedAt(cellIdx));
+  cell->Set( etaIdx, phiIdx, trackType );
+
+  return cell;
+}
+
 //##################################################################################
 Int_t AliHLTJETConeGrid::GetCellIndex( const Float_t* aEtaPhi, Int_t* aGridIdx ) {
   // see header file for class documentation
@@ -30,6 +30,7 @@
 #include "AliHLTLogging.h"
 #include "AliHLTJETBase.h"
 
+class AliHLTJETConeEtaPhiCell;
 /**
  * @class  AliHLTJETConeGrid
  * Eta-Phi grid of the cone finder
@@ -175,6 +176,17 @@ private:
    */
   Int_t GetCellIndex( const Float_t* aEtaPhi, Int_t* aGridIdx );
 
+  /** Get the cell at cellIdx, set up a new one if the cell is still empty
+   *  The cell objects and their track lists are kept in fGrid and reused
+   *  from event to event.
+   *  @param cellIdx   1D index of the cell
+   *  @param etaIdx    eta index of the cell
+   *  @param phiIdx    phi index of the cell
+   *  @param trackType type of tracks (TrackType_t)
+   *  @return          ptr to cell
+   */
+  AliHLTJETConeEtaPhiCell* GetCell( Int_t cellIdx, Int_t etaIdx, Int_t phiIdx, Int_t trackType );
+
   /*
    * ---------------------------------------------------------------------------------
    *                             Members - private
@@ -52,6 +52,7 @@
 #include "AliCentrality.h"
 #include "AliOADBCentrality.h"
 #include "AliOADBContainer.h"
+#include "AliOADBContainerCache.h"
 #include "AliMultiplicity.h"
 #include "AliAODHandler.h"
 #include "AliAODHeader.h"
@@ -1492,7 +1493,14 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     nTracks    = h!=0 ? (Short_t)h->GetTPConlyRefMultiplicity():-1;
   }
 
-  if (esd) {
+  // the candle tracks and the FMD hits are the most expensive estimators:
+  // count them only if their percentile or QA histogram is filled
+  const Bool_t needCND = fFillHistos || fHtempCND || fHtempCNDtrue;
+  const Bool_t needFMD = fFillHistos || fHtempFMD || fHtempFMDtrue;
+
+  if (!needCND) {
+    multCND = 0;
+  } else if (esd) {
     Short_t nTrTPCcandle = 0;
     for (Int_t iTracks = 0; iTracks < esd->GetNumberOfTracks(); iTracks++) {
 
@@ -1546,7 +1554,7 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   }
   spdCorr = AliESDUtils::GetCorrSPD2(nClusters[1],zvtx);
   
-  if (esd) {
+  if (esd && needFMD) {
     // ***** FMD info
     AliESDFMD *fmd = esd->GetFMDData();
     Float_t totalMultA = 0;
@@ -2008,8 +2016,9 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   TString fileName =(Form("%s/COMMON/CENTRALITY/data/centrality.root", AliAnalysisManager::GetOADBPath()));
   AliInfo(Form("Setup Centrality Selection for run %d with file %s\n",fCurrentRun,fileName.Data()));
 
-  AliOADBContainer *con = new AliOADBContainer("OADB");
-  con->InitFromFile(fileName,"Centrality");
+  // shared with other tasks, the histograms are only read
+  AliOADBContainer *con = AliOADBContainerCache::GetContainer(fileName,"Centrality");
+  if (!con) AliFatal(Form("Cannot read the centrality OADB container from %s", fileName.Data()));
 
   AliOADBCentrality*  centOADB = 0;
   centOADB = (AliOADBCentrality*)(con->GetObject(fCurrentRun));
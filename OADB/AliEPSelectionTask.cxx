@@ -110,6 +110,7 @@ AliAnalysisTaskSE(),
   AliInfo("Event Plane Selection enabled.");
   for(Int_t i = 0; i < 4; ++i) {
      fPhiDist[i] = 0;
+     fPhiDistIntegral[i] = -1;
   }
   for(Int_t i = 0; i < 2; ++i) {
      fQDist[i] = 0;
@@ -162,6 +163,7 @@ AliEPSelectionTask::AliEPSelectionTask(const char *name):
   DefineOutput(1, TList::Class());
   for(Int_t i = 0; i < 4; i++) {
      fPhiDist[i] = 0;
+     fPhiDistIntegral[i] = -1;
   }
   for(Int_t i = 0; i < 2; ++i) {
      fQDist[i] = 0;
@@ -470,14 +472,17 @@ TVector2 AliEPSelectionTask::GetQ(AliEventplane* EP, TObjArray* tracklist)
     track = dynamic_cast<AliVTrack*> (tracklist->At(i));
     if (track) {
       weight = GetWeight(track);
+      // track contribution, computed once
+      const Double_t qx = weight*cos(2*track->Phi())/rms[0];
+      const Double_t qy = weight*sin(2*track->Phi())/rms[1];
     if (fSaveTrackContribution){
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-      EP->GetQContributionXArray()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-      EP->GetQContributionYArray()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+      EP->GetQContributionXArray()->AddAt(qx,idtemp);
+      EP->GetQContributionYArray()->AddAt(qy,idtemp);
      }
-     mQx += (weight*cos(2*track->Phi())/rms[0]);
-     mQy += (weight*sin(2*track->Phi())/rms[1]);
+     mQx += qx;
+     mQy += qy;
     }
   }
   mQ.Set(mQx-(mean[0]/rms[0]), mQy-(mean[1]/rms[1]));
@@ -510,6 +515,8 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
       weight = GetWeight(track);
+      const Double_t qx = weight*cos(2*track->Phi())/rms[0];
+      const Double_t qy = weight*sin(2*track->Phi())/rms[1];
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
@@ -517,39 +524,39 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       if( trackcounter1 < int(nt/2.) && trackcounter2 < int(nt/2.)){
         float random = rn.Rndm();
         if(random < .5){
-          mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+          mQx1 += qx;
+          mQy1 += qy;
           if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+            EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+            EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
           }
           trackcounter1++;
         }
         else {
-          mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+          mQx2 += qx;
+          mQy2 += qy;
           if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+            EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+            EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
           }
           trackcounter2++;
         }
       }
       else if( trackcounter1 >= int(nt/2.)){
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += qx;
+        mQy2 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
         }
         trackcounter2++;
       }
       else {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += qx;
+        mQy1 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
         }
         trackcounter1++;
       }
@@ -561,23 +568,25 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
       weight = GetWeight(track);
+      const Double_t qx = weight*cos(2*track->Phi())/rms[0];
+      const Double_t qy = weight*sin(2*track->Phi())/rms[1];
       Double_t eta = track->Eta();
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
       if (eta > fEtaGap/2.) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += qx;
+        mQy1 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
         }
       } else if (eta < -1.*fEtaGap/2.) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += qx;
+        mQy2 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
         }
       }
     }
@@ -588,23 +597,25 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
       weight = GetWeight(track);
+      const Double_t qx = weight*cos(2*track->Phi())/rms[0];
+      const Double_t qy = weight*sin(2*track->Phi())/rms[1];
       Short_t cha = track->Charge();
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
       if (cha > 0) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += qx;
+        mQy1 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
         }
       } else if (cha < 0) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += qx;
+        mQy2 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
         }
       }
     }
@@ -697,7 +708,14 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
   if(track) phiDist = SelectPhiDist(track);
 
   if (fUsePhiWeight && phiDist && track) {
-    Double_t nParticles = phiDist->Integral();
+    // integral of the distribution, computed once per run (reset in SetPhiDist)
+    Double_t nParticles = 0;
+    Int_t idist = 0;
+    while (idist < 4 && phiDist != fPhiDist[idist]) idist++;
+    if (idist < 4) {
+      if (fPhiDistIntegral[idist] < 0) fPhiDistIntegral[idist] = phiDist->Integral();
+      nParticles = fPhiDistIntegral[idist];
+    } else nParticles = phiDist->Integral();
     Double_t nPhibins = phiDist->GetNbinsX();
 
     Double_t Phi = track->Phi();
@@ -814,6 +832,7 @@ void AliEPSelectionTask::SetPhiDist()
   AliInfo("No Phi-weights available. All Phi weights set to 1");
   SetUsePhiWeight(kFALSE);
   }
+  for (Int_t i = 0; i < 4; i++) fPhiDistIntegral[i] = -1;
 }
 
 //__________________________________________________________________________
@@ -864,6 +883,7 @@ void AliEPSelectionTask::SetPersonalPhiDistribution(const char* infilename, char
   TObject* list = f.Get(listname);
   fPhiDist[0] = (TH1F*)list->FindObject("fHOutPhi");
   if (!fPhiDist[0]) AliFatal("Phi Distribution not found!!!");
+  fPhiDistIntegral[0] = -1;
 
   f.Close();
 }
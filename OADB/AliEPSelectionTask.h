@@ -97,6 +97,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   AliOADBContainer* fQxContainer;	//! OADB Container for Q_x vector
   AliOADBContainer* fQyContainer;	//! OADB Container for Q_y vector
   TH1F*	 fPhiDist[4];			// array of Phi distributions used to calculate phi weights
+  Double_t fPhiDistIntegral[4];		//! integrals of fPhiDist, -1 until computed
   THnSparse *fSparseDist;               //! THn for eta-charge phi-weighting
   TProfile* fQDist[2];			// array of TProfiles with mean+rms for recentering
   TH1F *fHruns;                         // information about runwise statistics of phi-weights
@@ -119,7 +120,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TH2F*	 fHOutDiff;			//! control histogram: Difference of MC RP and EP - only filled if fUseMCRP is true!
   TH2F*  fHOutleadPTPsi;		//! control histogram: emission angle of leading pT track vs EP angle
 
-  ClassDef(AliEPSelectionTask,4); 
+  ClassDef(AliEPSelectionTask,5); 
 };
 
 #endif
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 using std::array;
+#include <map>
 #include <memory>
 using std::string;
 using std::vector;
@@ -35,6 +36,40 @@ using std::vector;
 ClassImp(AliEventCutsContainer);
 ClassImp(AliEventCuts);
 
+namespace {
+  /// Outcome of the selection of the last event, shared by all the AliEventCuts with the same configuration
+  struct SharedSelection {
+    Long64_t          fEntry;
+    const AliVEvent*  fEvent;
+    unsigned long     fEventId;
+    unsigned long     fFlag;
+    float             fCentPercentiles[2];
+    AliVVertex*       fPrimaryVertex;
+    double            fVertexDeltaZ;
+  };
+
+  std::map<unsigned long long, SharedSelection>& SharedSelections() {
+    static std::map<unsigned long long, SharedSelection> selections;
+    return selections;
+  }
+
+  /// FNV-1a hash of the cut configuration
+  class ConfigurationHasher {
+    public:
+      ConfigurationHasher() : fHash{14695981039346656037ull} {}
+      template<typename T> void Add(const T& value) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+          fHash ^= bytes[i];
+          fHash *= 1099511628211ull;
+        }
+      }
+      template<typename T> void AddArray(const T* values, int n) { for (int i = 0; i < n; ++i) Add(values[i]); }
+      void AddString(const std::string& str) { Add(str.size()); AddArray(str.data(), str.size()); }
+      unsigned long long fHash;
+  };
+}
+
 
 
 /// Standard constructor with null selection
@@ -93,6 +128,7 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fCentEstimators{"V0M","CL0"},
   fCentPercentiles{-1.f},
   fPrimaryVertex{nullptr},
+  fVertexDeltaZ{0.},
   fNewEvent{true},
   fOverrideAutoTriggerMask{false},
   fOverrideAutoPileUpCuts{false},
@@ -139,6 +175,95 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     AddQAplotsToList();
   }
 
+  /// The selection is evaluated only once per event for all the instances with the same configuration,
+  /// the QA histograms are filled by each instance.
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  const unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
+  SharedSelection& shared = SharedSelections()[ConfigurationHash()];
+  if (shared.fEvent == ev && shared.fEntry == entry && shared.fEventId == evid) {
+    fFlag = shared.fFlag;
+    fCentPercentiles[0] = shared.fCentPercentiles[0];
+    fCentPercentiles[1] = shared.fCentPercentiles[1];
+    fPrimaryVertex = shared.fPrimaryVertex;
+    fVertexDeltaZ = shared.fVertexDeltaZ;
+    if (fUseVariablesCorrelationCuts || fTOFvsFB32[0]) ComputeTrackMultiplicity(ev); /// cheap, the multiplicities are attached to the event
+  } else {
+    SelectEvent(ev);
+    shared.fEntry = entry;
+    shared.fEvent = ev;
+    shared.fEventId = evid;
+    shared.fFlag = fFlag;
+    shared.fCentPercentiles[0] = fCentPercentiles[0];
+    shared.fCentPercentiles[1] = fCentPercentiles[1];
+    shared.fPrimaryVertex = fPrimaryVertex;
+    shared.fVertexDeltaZ = fVertexDeltaZ;
+  }
+  const AliVVertex* vtx = fPrimaryVertex;
+  const double dz = fVertexDeltaZ;
+  const int ntrkl = ev->GetMultiplicity()->GetNumberOfTracklets();
+  if (fUseMultiplicityDependentPileUpCuts) {
+    if (ntrkl < 20) fSPDpileupMinContributors = 3;
+    else if (ntrkl < 50) fSPDpileupMinContributors = 4;
+    else fSPDpileupMinContributors = 5;
+  }
+
+  /// Ignore SPD/tracks vertex position and reconstruction individual flags
+  bool allcuts = CheckNormalisationMask(kPassesAllCuts);
+  if (allcuts) {
+    fFlag |= BIT(kAllCuts);
+  }
+  if (fCutStats) {
+    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
+      if (TESTBIT(fFlag,iCut)) {
+        fCutStats->Fill(iCut);
+        if (TESTBIT(fFlag,kTrigger)) {
+          fCutStatsAfterTrigger->Fill(iCut);
+        }
+        if (TESTBIT(fFlag,kMultiplicity)) {
+          fCutStatsAfterMultSelection->Fill(iCut);
+        }
+      }
+    }
+  }
+
+  /// Filling normalisation histogram
+  array <NormMask,5> norm_masks {
+    kAnyEvent,
+    kTriggeredEvent,
+    kPassesNonVertexRelatedSelections,
+    kHasReconstructedVertex,
+    kPassesAllCuts
+  };
+  for (int iC = 0; iC < 5; ++iC) {
+    if (CheckNormalisationMask(norm_masks[iC])) {
+      if (fNormalisationHist) {
+        fNormalisationHist->Fill(iC);
+      }
+    }
+  }
+
+  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
+  for (int befaft = 0; befaft < 2; ++befaft) {
+    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
+    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
+    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
+    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
+    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
+    if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
+    if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
+    if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
+    if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
+    if (fVZEROvsTPCout[befaft]) fVZEROvsTPCout[befaft]->Fill(fContainer.fMultTrkTPCout,fContainer.fMultVZERO);
+    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
+  }
+
+  return true;
+}
+
+/// Evaluates all the cuts on the event and sets fFlag, fCentPercentiles, fPrimaryVertex and fVertexDeltaZ
+///
+void AliEventCuts::SelectEvent(AliVEvent *ev) {
   /// Event selection flag, as soon as the event does not pass one cut this becomes false.
   fFlag = BIT(kNoCuts);
 
@@ -207,6 +332,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
       (!vtSPD->IsFromVertexerZ() || vtSPDdispersion <= fMaxDispersionSPDvertex) /// vertex dispersion cut for run1, only for ESD
      ) // quality cut on vertexer SPD z
     fFlag |= BIT(kVertexQuality);  
+  fVertexDeltaZ = dz;
 
   /// Pile-up rejection
   bool usePileUpMV = (fUseCombinedMVSPDcut && vtx != vtSPD) || fPileUpCutMV;
@@ -283,58 +409,71 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
         || fMC || !fUseVariablesCorrelationCuts)
       fFlag |= BIT(kCorrelations);
   } else fFlag |= BIT(kCorrelations);
+}
 
-  /// Ignore SPD/tracks vertex position and reconstruction individual flags
-  bool allcuts = CheckNormalisationMask(kPassesAllCuts);
-  if (allcuts) {
-    fFlag |= BIT(kAllCuts);
-  }
-  if (fCutStats) {
-    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
-      if (TESTBIT(fFlag,iCut)) {
-        fCutStats->Fill(iCut);
-        if (TESTBIT(fFlag,kTrigger)) {
-          fCutStatsAfterTrigger->Fill(iCut);
-        }
-        if (TESTBIT(fFlag,kMultiplicity)) {
-          fCutStatsAfterMultSelection->Fill(iCut);
-        }
-      }
-    }
-  }
-
-  /// Filling normalisation histogram
-  array <NormMask,5> norm_masks {
-    kAnyEvent,
-    kTriggeredEvent,
-    kPassesNonVertexRelatedSelections,
-    kHasReconstructedVertex,
-    kPassesAllCuts
-  };
-  for (int iC = 0; iC < 5; ++iC) {
-    if (CheckNormalisationMask(norm_masks[iC])) {
-      if (fNormalisationHist) {
-        fNormalisationHist->Fill(iC);
-      }
-    }
-  }
-
-  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
-  for (int befaft = 0; befaft < 2; ++befaft) {
-    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
-    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
-    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
-    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
-    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
-    if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
-    if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
-    if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
-    if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
-    if (fVZEROvsTPCout[befaft]) fVZEROvsTPCout[befaft]->Fill(fContainer.fMultTrkTPCout,fContainer.fMultVZERO);
-    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
+/// Hash of all the settings entering the event selection: instances with the same hash
+/// take the same decision for the same event.
+///
+unsigned long long AliEventCuts::ConfigurationHash() const {
+  ConfigurationHasher hash;
+  hash.Add(fMC);
+  hash.Add(fRequireTrackVertex);
+  hash.Add(fMinVtz);
+  hash.Add(fMaxVtz);
+  hash.Add(fMaxDeltaSpdTrackAbsolute);
+  hash.Add(fMaxDeltaSpdTrackNsigmaSPD);
+  hash.Add(fMaxDeltaSpdTrackNsigmaTrack);
+  hash.Add(fMaxResolutionSPDvertex);
+  hash.Add(fMaxDispersionSPDvertex);
+  hash.Add(fCheckAODvertex);
+  hash.Add(fRejectDAQincomplete);
+  hash.Add(fRequiredSolenoidPolarity);
+  hash.Add(fUseCombinedMVSPDcut);
+  hash.Add(fUseMultiplicityDependentPileUpCuts);
+  hash.Add(fUseSPDpileUpCut);
+  if (!fUseMultiplicityDependentPileUpCuts) hash.Add(fSPDpileupMinContributors); /// otherwise set from the event
+  hash.Add(fSPDpileupMinZdist);
+  hash.Add(fSPDpileupNsigmaZdist);
+  hash.Add(fSPDpileupNsigmaDiamXY);
+  hash.Add(fSPDpileupNsigmaDiamZ);
+  hash.Add(fTrackletBGcut);
+  hash.Add(fPileUpCutMV);
+  hash.Add(fUtils.GetMinPlpContribMV());
+  hash.Add(fUtils.GetMaxPlpChi2MV());
+  hash.Add(fUtils.GetMinWDistMV());
+  hash.Add(fUtils.GetCheckPlpFromDifferentBCMV());
+  hash.Add(fUtils.GetASPDCvsTCut());
+  hash.Add(fUtils.GetBSPDCvsTCut());
+  hash.Add(fCentralityFramework);
+  hash.Add(fMinCentrality);
+  hash.Add(fMaxCentrality);
+  hash.Add(fSelectInelGt0);
+  hash.Add(fUseVariablesCorrelationCuts);
+  hash.Add(fUseEstimatorsCorrelationCut);
+  hash.Add(fUseStrongVarCorrelationCut);
+  hash.AddArray(fEstimatorsCorrelationCoef, 2);
+  hash.AddArray(fEstimatorsSigmaPars, 4);
+  hash.AddArray(fDeltaEstimatorNsigma, 2);
+  hash.AddArray(fTOFvsFB32correlationPars, 4);
+  hash.AddArray(fTOFvsFB32sigmaPars, 6);
+  hash.AddArray(fTOFvsFB32nSigmaCut, 2);
+  hash.AddArray(fESDvsTPConlyLinearCut, 2);
+  if (fMultiplicityV0McorrCut) {
+    TString formula = fMultiplicityV0McorrCut->GetExpFormula();
+    if (formula.IsNull()) hash.Add(fMultiplicityV0McorrCut); /// compiled function: not shared
+    hash.AddString(formula.Data());
+    hash.AddArray(fMultiplicityV0McorrCut->GetParameters(), fMultiplicityV0McorrCut->GetNpar());
   }
-
-  return true;
+  hash.AddArray(fFB128vsTrklLinearCut, 2);
+  hash.AddArray(fVZEROvsTPCoutPolCut, 5);
+  hash.Add(fRequireExactTriggerMask);
+  hash.Add(fTriggerMask);
+  hash.Add(fTriggerClasses.size());
+  for (const std::string& myClass : fTriggerClasses) hash.AddString(myClass);
+  hash.AddString(fCentEstimators[0]);
+  hash.AddString(fCentEstimators[1]);
+  hash.Add(fMultSelectionEvCuts);
+  return hash.fHash;
 }
 
 void AliEventCuts::AddQAplotsToList(TList *qaList, bool addCorrelationPlots) {
@@ -545,22 +684,32 @@ void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
   tmp_cont->fMultTrkFB32TOF = 0;
   tmp_cont->fMultTrkTPC = 0;
   tmp_cont->fMultTrkTPCout = 0;
-  for (int it = 0; it < nTracks; it++) {
-    if (isAOD) {
-      AliAODTrack* trk = (AliAODTrack*)ev->GetTrack(it);
+  if (isAOD) {
+    /// Single pass over the AOD track array: all the counters are accumulated from the filter map and
+    /// status masks, the TOF and acceptance requirements are evaluated only for the FB32 tracks.
+    TClonesArray* tracks = static_cast<AliAODEvent*>(ev)->GetTracks();
+    const int nAODtracks = tracks ? tracks->GetEntriesFast() : 0;
+    int nTPCout = 0, nFB32 = 0, nFB32TOF = 0, nFB32Acc = 0, nFB128 = 0;
+    for (int it = 0; it < nAODtracks; it++) {
+      const AliAODTrack* trk = static_cast<const AliAODTrack*>(tracks->UncheckedAt(it));
       if (!trk) continue;
-      if ((trk->GetStatus() & AliESDtrack::kTPCout) &&
-          trk->GetID() > 0) tmp_cont->fMultTrkTPCout++;
-      if (trk->TestFilterBit(32)) {
-        tmp_cont->fMultTrkFB32++;
-        if ( TMath::Abs(trk->GetTOFsignalDz()) <= 10. && trk->GetTOFsignal() >= 12000. && trk->GetTOFsignal() <= 25000.)
-          tmp_cont->fMultTrkFB32TOF++;
-        if ((fabs(trk->Eta()) < 0.8) && (trk->GetTPCNcls() >= 70) && (trk->Pt() >= 0.2) && (trk->Pt() < 50))
-          tmp_cont->fMultTrkFB32Acc++;
-      }
-      if (trk->TestFilterBit(128))
-        tmp_cont->fMultTrkTPC++;
-    } else {
+      const unsigned int filterMap = trk->GetFilterMap();
+      nTPCout += bool(trk->GetStatus() & AliESDtrack::kTPCout) & (trk->GetID() > 0);
+      nFB128 += bool(filterMap & 128u);
+      if (!(filterMap & 32u)) continue;
+      nFB32++;
+      const double tof = trk->GetTOFsignal();
+      nFB32TOF += (TMath::Abs(trk->GetTOFsignalDz()) <= 10.) & (tof >= 12000.) & (tof <= 25000.);
+      const double pt = trk->Pt();
+      nFB32Acc += (fabs(trk->Eta()) < 0.8) & (trk->GetTPCNcls() >= 70) & (pt >= 0.2) & (pt < 50);
+    }
+    tmp_cont->fMultTrkTPCout = nTPCout;
+    tmp_cont->fMultTrkFB32 = nFB32;
+    tmp_cont->fMultTrkFB32TOF = nFB32TOF;
+    tmp_cont->fMultTrkFB32Acc = nFB32Acc;
+    tmp_cont->fMultTrkTPC = nFB128;
+  } else {
+    for (int it = 0; it < nTracks; it++) {
       AliESDtrack* esdTrack = (AliESDtrack*)ev->GetTrack(it);
       if (!esdTrack) continue;
 
@@ -105,6 +105,8 @@ class AliEventCuts : public TList {
     float             GetCentrality (unsigned int estimator = 0) const;
     std::string       GetCentralityEstimator (unsigned int estimator = 0) const;
     const AliVVertex* GetPrimaryVertex() const { return fPrimaryVertex; }
+    /// Track multiplicities used by the correlation cuts, computed once per event and shared by all the AliEventCuts
+    const AliEventCutsContainer& GetTrackMultiplicities(AliVEvent *ev) { ComputeTrackMultiplicity(ev); return fContainer; }
 
     void          SetCentralityEstimators (std::string first = "V0M", std::string second = "CL0") { fCentEstimators[0] = first; fCentEstimators[1] = second; }
     void          SetCentralityRange (float min, float max) { fMinCentrality = min; fMaxCentrality = max; }
@@ -173,6 +175,8 @@ class AliEventCuts : public TList {
     AliEventCuts operator=(const AliEventCuts& copy);
     void          AutomaticSetup (AliVEvent *ev);
     void          ComputeTrackMultiplicity(AliVEvent *ev);
+    void          SelectEvent(AliVEvent *ev);
+    unsigned long long ConfigurationHash() const;
     template<typename F> F PolN(F x, F* coef, int n);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
@@ -183,6 +187,7 @@ class AliEventCuts : public TList {
     std::string   fCentEstimators[2];             ///< Centrality estimators: the first is used as main estimators, that is correlated with the second to monitor spurious events.
     float         fCentPercentiles[2];            ///< Centrality percentiles
     AliVVertex   *fPrimaryVertex;                 //!<! Primary vertex pointer
+    double        fVertexDeltaZ;                  //!<! Difference between the track and the SPD vertex z
 
     ///
     bool          fNewEvent;                      ///<  True if the AliVEvent identifier in the AcceptEvent and fIdentifier are different
@@ -211,7 +216,7 @@ class AliEventCuts : public TList {
     AliESDtrackCuts* fFB32trackCuts; //!<! Cuts corresponding to FB32 in the ESD (used only for correlations cuts in ESDs)
     AliESDtrackCuts* fTPConlyCuts;   //!<! Cuts corresponding to the standalone TPC cuts in the ESDs (used only for correlations cuts in ESDs)
 
-    ClassDef(AliEventCuts,9)
+    ClassDef(AliEventCuts,10)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
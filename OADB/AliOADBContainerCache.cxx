@@ -0,0 +1,94 @@
+/**************************************************************************
+ * Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//                      Implementation of   Class AliOADBContainerCache
+// Process-wide cache of the OADB containers, keyed by file and container
+// name.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TH1.h"
+#include "TString.h"
+#include "TSystem.h"
+#include "AliLog.h"
+#include "AliOADBContainer.h"
+#include "AliOADBContainerCache.h"
+
+ClassImp(AliOADBContainerCache)
+
+namespace {
+  typedef std::map<std::string, AliOADBContainer*> ContainerMap;
+
+  ContainerMap& Containers() {
+    static ContainerMap containers;
+    return containers;
+  }
+
+  std::mutex& ContainersMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+AliOADBContainer* AliOADBContainerCache::GetContainer(const char* fileName, const char* containerName){
+  // returns the container named containerName in the OADB file fileName,
+  // reading it from the file the first time it is requested; 0 if not found
+  TString path(fileName);
+  gSystem->ExpandPathName(path);
+  std::string key(path.Data());
+  key.append("#").append(containerName);
+
+  std::lock_guard<std::mutex> lock(ContainersMutex());
+  ContainerMap& containers = Containers();
+  ContainerMap::iterator it = containers.find(key);
+  if (it != containers.end()) return it->second;
+
+  // read the container and close the file again, without touching the current directory
+  TDirectory::TContext context;
+  Bool_t oldStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  AliOADBContainer* container = 0;
+  TFile* file = TFile::Open(path);
+  if (!file || !file->IsOpen()) {
+    AliErrorClass(Form("Cannot open OADB file %s", path.Data()));
+  } else {
+    container = dynamic_cast<AliOADBContainer*>(file->Get(containerName));
+    if (!container) AliErrorClass(Form("OADB file %s does not contain a container named %s", path.Data(), containerName));
+  }
+  delete file;
+  TH1::AddDirectory(oldStatus);
+
+  if (container) {
+    AliInfoClass(Form("Read OADB container %s from %s", containerName, path.Data()));
+    containers[key] = container;
+  }
+  return container;
+}
+
+//-------------------------------------------------------------------------------------------------
+void AliOADBContainerCache::ClearCache(){
+  // deletes all cached containers, invalidating all objects obtained from them
+  std::lock_guard<std::mutex> lock(ContainersMutex());
+  ContainerMap& containers = Containers();
+  for (ContainerMap::iterator it = containers.begin(); it != containers.end(); ++it) delete it->second;
+  containers.clear();
+}
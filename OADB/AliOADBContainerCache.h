@@ -0,0 +1,27 @@
+#ifndef ALIOADBCONTAINERCACHE_H
+#define ALIOADBCONTAINERCACHE_H
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//               Class AliOADBContainerCache
+// Process-wide cache of the OADB containers, keyed by file and container
+// name. Each container is read only once per process, however many tasks
+// and runs ask for it. The containers and the objects they hold are shared:
+// callers must not modify or delete them, and clone an object if they need
+// to change it.
+//-------------------------------------------------------------------------
+
+#include <TObject.h>
+
+class AliOADBContainer;
+
+class AliOADBContainerCache : public TObject {
+public:
+  static AliOADBContainer* GetContainer(const char* fileName, const char* containerName);
+  static void ClearCache();
+
+  ClassDef(AliOADBContainerCache, 0)
+};
+
+#endif
@@ -65,6 +65,7 @@
 //   Origin: Jan Fiete Grosse-Oetringhaus, CERN 
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
+#include <algorithm>
 #include <vector>
 
 #include <Riostream.h>
@@ -96,6 +97,7 @@
 #include "TPRegexp.h"
 #include "TFile.h"
 #include "AliOADBContainer.h"
+#include "AliOADBContainerCache.h"
 #include "AliOADBPhysicsSelection.h"
 #include "AliOADBFillingScheme.h"
 #include "AliOADBTriggerAnalysis.h"
@@ -111,6 +113,26 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+/// Trigger class string "+TRIGGER1,TRIGGER1b -TRIGGER2 #XXX &YY *ZZ" compiled for the current run
+struct CompiledTriggerClass {
+  std::vector<Int_t> fRequired;  ///< indices in CompiledTriggerClasses::fRegexps which have to match
+  std::vector<Int_t> fRejected;  ///< indices in CompiledTriggerClasses::fRegexps which must not match
+  std::vector<Int_t> fBCs;       ///< accepted bunch crossings, no requirement if empty
+  UInt_t fReturnCode;            ///< YY, returned if the event passes
+  FormulaAndBits* fOnline;       ///< hardware trigger logic for ZZ
+  FormulaAndBits* fOffline;      ///< offline trigger logic for ZZ
+};
+
+/// All collision and background trigger classes, compiled once per run by CompileTriggerClasses()
+class CompiledTriggerClasses : public std::vector<CompiledTriggerClass> {
+public:
+  CompiledTriggerClasses() : fValid(kFALSE), fRegexps(), fMatched(), fParams() {}
+  Bool_t fValid;                   ///< false if the trigger classes have to be compiled again
+  std::vector<TPRegexp*> fRegexps; ///< distinct regexps of all classes
+  std::vector<Char_t> fMatched;    ///< per event: -1 if the regexp is not evaluated yet, otherwise the result
+  std::vector<Double_t> fParams;   ///< parameters of the trigger logic TFormula
+};
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -132,7 +154,9 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
-fTriggerToRegexp(new StringToRegexp())
+fTriggerToRegexp(new StringToRegexp()),
+fCompiledTriggers(new CompiledTriggerClasses()),
+fTriggerDecisions(new AliTriggerAnalysis::DecisionCache())
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -162,7 +186,9 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
- fTriggerToRegexp(new StringToRegexp())
+ fTriggerToRegexp(new StringToRegexp()),
+ fCompiledTriggers(new CompiledTriggerClasses()),
+ fTriggerDecisions(new AliTriggerAnalysis::DecisionCache())
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -179,6 +205,8 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
   delete fTriggerToRegexp;
+  delete fCompiledTriggers;
+  delete fTriggerDecisions;
 }
 
 UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const {
@@ -259,6 +287,72 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
   return returnCode;
 }
 
+/// Parse the collision and background trigger classes once for the current run.
+/// Same syntax as in CheckTriggerClass(); the regexps of the required and rejected
+/// triggers are shared among the classes and the trigger logic formulas are looked up
+/// already here, so that IsCollisionCandidate() does not need to handle strings.
+void AliPhysicsSelection::CompileTriggerClasses() {
+  struct Util {
+    static Int_t atoi(const char*& str) {
+      Int_t ret = 0;
+      while (*str && *str != ' ')
+        ret = 10 * ret + (*str++ - '0');
+      return ret;
+    }
+  };
+
+  CompiledTriggerClasses& compiled = *fCompiledTriggers;
+  compiled.clear();
+  compiled.fRegexps.clear();
+
+  Int_t nColl = fCollTrigClasses.GetEntries();
+  Int_t nBG   = fBGTrigClasses.GetEntries();
+  std::string str;
+  for (Int_t i=0; i<nColl+nBG; i++) {
+    const char* trigger = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
+    CompiledTriggerClass cls;
+    cls.fReturnCode = AliVEvent::kUserDefined;
+    Int_t triggerLogic = 0;
+    while (*trigger) {
+      // required or rejected triggers
+      if (*trigger == '+' || *trigger == '-') {
+        Bool_t required = (*trigger == '+');
+        trigger++;
+        const char* begin = trigger;
+        while (*trigger && *trigger != ' ')
+          trigger++;
+        str.assign(begin, trigger);
+        TPRegexp* re = &FindRegexp(str);
+        Int_t index = std::find(compiled.fRegexps.begin(), compiled.fRegexps.end(), re) - compiled.fRegexps.begin();
+        if (index == (Int_t) compiled.fRegexps.size()) compiled.fRegexps.push_back(re);
+        (required ? cls.fRequired : cls.fRejected).push_back(index);
+        continue;
+      }
+      // bunch crossing
+      if (*trigger == '#') {
+        cls.fBCs.push_back(Util::atoi(++trigger));
+        continue;
+      }
+      // return value
+      if (*trigger == '&') {
+        cls.fReturnCode = Util::atoi(++trigger);
+        continue;
+      }
+      // triggerLogic value
+      if (*trigger == '*') {
+        triggerLogic = Util::atoi(++trigger);
+        continue;
+      }
+      trigger++;
+    }
+    cls.fOnline  = &FindForumla(fPSOADB->GetHardwareTrigger(triggerLogic));
+    cls.fOffline = &FindForumla(fPSOADB->GetOfflineTrigger(triggerLogic));
+    compiled.push_back(cls);
+  }
+  compiled.fMatched.resize(compiled.fRegexps.size());
+  compiled.fValid = kTRUE;
+}
+
 /// Evaluate if the given event fulfills a given trigger logic
 ///
 /// \param event Pointer to the current event
@@ -286,6 +380,24 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
   return trg_formula.EvalPar(dummy_val, paras.data());
 }
 
+/// Same as above, for a trigger logic already looked up by CompileTriggerClasses()
+Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
+						 AliTriggerAnalysis* triggerAnalysis,
+						 FormulaAndBits& formula_and_bits, Bool_t offline){
+  auto& trg_formula = formula_and_bits.first;
+  auto& bits = formula_and_bits.second;
+  auto& paras = fCompiledTriggers->fParams; // reused, no allocation per event
+  paras.resize(bits.size());
+  auto offline_flag = offline ? AliTriggerAnalysis::kOfflineFlag : 0;
+  for (size_t i = 0; i < bits.size(); ++i) {
+    typedef AliTriggerAnalysis::Trigger Trigger;
+    Trigger bit = static_cast<Trigger>(bits[i] | offline_flag);
+    paras[i] = triggerAnalysis->EvaluateTrigger(event, bit);
+  }
+  Double_t dummy_val[] = {0};
+  return trg_formula.EvalPar(dummy_val, paras.data());
+}
+
 //______________________________________________________________________________
 UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   // checks if the given event is a collision candidate
@@ -302,25 +414,43 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
+  if (!fCompiledTriggers->fValid) CompileTriggerClasses();
+  CompiledTriggerClasses& compiled = *fCompiledTriggers;
+
+  // the fired trigger classes are matched lazily, each regexp at most once per event
+  TString classes = event->GetFiredTriggerClasses();
+  AliDebug(AliLog::kDebug+1, Form("Processing event with triggers %s", classes.Data()));
+  std::fill(compiled.fMatched.begin(), compiled.fMatched.end(), -1);
+  Int_t bc = event->GetBunchCrossNumber();
+
+  // all trigger analysis objects have the same parameters, each trigger is evaluated once per event
+  fTriggerDecisions->NewEvent();
+
   UInt_t accept = 0;
-  Int_t nColl = fCollTrigClasses.GetEntries();
-  Int_t nBG   = fBGTrigClasses.GetEntries();
-  for (Int_t i=0; i<nColl+nBG; i++) {
-    const char* triggerClass = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
-    AliDebug(AliLog::kDebug+1, Form("Processing trigger class %s", triggerClass));
-    
+  for (Int_t i=0; i<(Int_t) compiled.size(); i++) {
+    const CompiledTriggerClass& cls = compiled[i];
     AliTriggerAnalysis* triggerAnalysis = static_cast<AliTriggerAnalysis*> (fTriggerAnalysis.At(i));
     triggerAnalysis->FillTriggerClasses(event);
-    
-    Int_t triggerLogic = 0;
-    UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
-    if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+
+    Bool_t pass = kTRUE;
+    for (size_t j=0; pass && j<cls.fRequired.size(); j++) {
+      Char_t& matched = compiled.fMatched[cls.fRequired[j]];
+      if (matched < 0) matched = compiled.fRegexps[cls.fRequired[j]]->Match(classes, "", 0, 1);
+      pass = (matched == 1);
+    }
+    for (size_t j=0; pass && j<cls.fRejected.size(); j++) {
+      Char_t& matched = compiled.fMatched[cls.fRejected[j]];
+      if (matched < 0) matched = compiled.fRegexps[cls.fRejected[j]]->Match(classes, "", 0, 1);
+      pass = (matched == 0);
+    }
+    if (pass && !cls.fBCs.empty()) pass = (std::find(cls.fBCs.begin(), cls.fBCs.end(), bc) != cls.fBCs.end());
+    if (!pass) continue;
+    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, *cls.fOnline, kFALSE);
+    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, *cls.fOffline, kTRUE);
     triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
-    accept |= singleTriggerResult;
+    accept |= cls.fReturnCode;
   }
   
   if (accept) AliDebug(AliLog::kDebug, Form("Accepted event as collision candidate with bit mask %d", accept));
@@ -359,32 +489,35 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   Bool_t oldStatus = TH1::AddDirectoryStatus();
   TH1::AddDirectory(kFALSE);
   
-  /// Open OADB file and fetch OADB objects
+  /// Fetch OADB objects; the containers are read once per process and shared, we keep our own copies
   TString oadbfilename = AliPhysicsSelection::GetOADBFileName();
   
-  TFile * foadb = TFile::Open(oadbfilename);
-  if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
-  
   if(!fPSOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
     AliInfo("Using Standard OADB");
-    AliOADBContainer * psContainer = (AliOADBContainer*) foadb->Get("physSel");
+    AliOADBContainer * psContainer = AliOADBContainerCache::GetContainer(oadbfilename, "physSel");
     if (!psContainer) AliFatal("Cannot fetch OADB container for Physics selection");
-    fPSOADB = (AliOADBPhysicsSelection*) psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
-    if (!fPSOADB) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
+    TObject* psObject = psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
+    if (!psObject) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
+    delete fPSOADB;
+    fPSOADB = (AliOADBPhysicsSelection*) psObject->Clone();
   } else {
     AliInfo("Using Custom OADB");
   }
   if(!fFillOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * fillContainer = (AliOADBContainer*) foadb->Get("fillScheme");
+    AliOADBContainer * fillContainer = AliOADBContainerCache::GetContainer(oadbfilename, "fillScheme");
     if (!fillContainer) AliFatal("Cannot fetch OADB container for filling scheme");
-    fFillOADB = (AliOADBFillingScheme*) fillContainer->GetObject(runNumber, "Default",fPassName);
-    if (!fFillOADB) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
+    TObject* fillObject = fillContainer->GetObject(runNumber, "Default",fPassName);
+    if (!fillObject) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
+    delete fFillOADB;
+    fFillOADB = (AliOADBFillingScheme*) fillObject->Clone();
   }
   if(!fTriggerOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * triggerContainer = (AliOADBContainer*) foadb->Get("trigAnalysis");
+    AliOADBContainer * triggerContainer = AliOADBContainerCache::GetContainer(oadbfilename, "trigAnalysis");
     if (!triggerContainer) AliFatal("Cannot fetch OADB container for trigger analysis");
-    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerContainer->GetObject(runNumber, "Default",fPassName);
-    if (!fTriggerOADB) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
+    TObject* triggerObject = triggerContainer->GetObject(runNumber, "Default",fPassName);
+    if (!triggerObject) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
+    delete fTriggerOADB;
+    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerObject->Clone(); // thresholds are updated below
     fTriggerOADB->Print();
   }
   
@@ -483,11 +616,13 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
       triggerAnalysis->SetAnalyzeMC(fMC);
       triggerAnalysis->ApplyPileupCuts(fPileupCutsEnabled);
       triggerAnalysis->EnableHistograms(fIsPP);
+      triggerAnalysis->SetDecisionCache(fTriggerDecisions);
       fTriggerAnalysis.Add(triggerAnalysis);
     }
   }
   
   fCurrentRun = runNumber;
+  fCompiledTriggers->fValid = kFALSE; // the trigger logic may change with the OADB object
 
   TH1::AddDirectory(oldStatus);
   return kTRUE;
@@ -112,7 +112,8 @@ fHistFMDSum(0),
 fHistT0(0),
 fHistOFOvsTKLAcc(0),
 fHistV0MOnVsOfAcc(0),
-fTriggerClasses(new TMap)
+fTriggerClasses(new TMap),
+fDecisionCache(0)
 {
   // constructor
   fHistList->SetName("histos");
@@ -425,6 +426,20 @@ Bool_t AliTriggerAnalysis::IsTriggerBitFired(const AliVEvent* event, ULong64_t t
 
 //-------------------------------------------------------------------------------------------------
 Int_t AliTriggerAnalysis::EvaluateTrigger(const AliVEvent* event, Trigger trigger){
+  // evaluates a given trigger, at most once per event if a decision cache is set
+  if (!fDecisionCache) return EvaluateTriggerNoCache(event, trigger);
+  Int_t key = (UInt_t) trigger % (UInt_t) kStartOfFlags + ((trigger & kOfflineFlag) ? kStartOfFlags : 0);
+  Int_t decision = 0;
+  if (!fDecisionCache->Get(key, decision)) {
+    decision = EvaluateTriggerNoCache(event, trigger);
+    fDecisionCache->Set(key, decision);
+  }
+  return decision;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Int_t AliTriggerAnalysis::EvaluateTriggerNoCache(const AliVEvent* event, Trigger trigger){
   // evaluates a given trigger
   // trigger combinations are not supported, for that see IsOfflineTriggerFired
 
@@ -42,6 +42,21 @@ public:
 
   static const char* GetTriggerName(Trigger trigger);
 
+  /// Results of EvaluateTrigger() for the current event, keyed by trigger and offline flag.
+  /// Can be shared by instances with the same parameters; the owner calls NewEvent() for each event.
+  class DecisionCache {
+  public:
+    DecisionCache() : fEventId(1) { for (Int_t i=0; i<kNKeys; i++) { fValue[i] = 0; fValueEventId[i] = 0; } }
+    void NewEvent() { fEventId++; }
+    Bool_t Get(Int_t key, Int_t& value) const { if (fValueEventId[key] != fEventId) return kFALSE; value = fValue[key]; return kTRUE; }
+    void Set(Int_t key, Int_t value) { fValue[key] = value; fValueEventId[key] = fEventId; }
+    enum { kNKeys = 2*kStartOfFlags };
+  private:
+    UInt_t fEventId;              // current event
+    Int_t  fValue[kNKeys];        // decisions
+    UInt_t fValueEventId[kNKeys]; // event for which the decision is stored
+  };
+
   AliTriggerAnalysis(TString name="default");
   virtual ~AliTriggerAnalysis();
   void EnableHistograms(Bool_t isLowFlux = kFALSE);
@@ -50,6 +65,8 @@ public:
   void SetParameters(AliOADBTriggerAnalysis* oadb);
   Bool_t IsTriggerFired(const AliVEvent* event, Trigger trigger);
   Int_t EvaluateTrigger(const AliVEvent* event, Trigger trigger);
+  void SetDecisionCache(DecisionCache* cache) { fDecisionCache = cache; }
+  DecisionCache* GetDecisionCache() const { return fDecisionCache; }
   Bool_t IsTriggerBitFired(const AliVEvent* event, ULong64_t tclass) const;
   Bool_t IsOfflineTriggerFired(const AliVEvent* event, Trigger trigger);
   
@@ -98,6 +115,7 @@ public:
   void Browse(TBrowser *b);
 
 protected:
+  Int_t EvaluateTriggerNoCache(const AliVEvent* event, Trigger trigger);
   Int_t FMDHitCombinations(const AliESDEvent* aEsd, AliceSide side, Int_t fillHists = 0);
   
   TH1F* fSPDGFOEfficiency;   //! FO efficiency applied in SPDFiredChips. function of chip number (bin 1..400: first layer; 401..1200: second layer)
@@ -165,8 +183,9 @@ protected:
   TH2F* fHistV0MOnVsOfAcc;   //! V0M online vs V0M offline distribution for threshold efficiency studies
 
   TMap* fTriggerClasses;     // counts the active trigger classes (uses the full string)
+  DecisionCache* fDecisionCache; //! decisions of the current event, not owned
   
-  ClassDef(AliTriggerAnalysis, 35)
+  ClassDef(AliTriggerAnalysis, 36)
 private:
   AliTriggerAnalysis(const AliTriggerAnalysis&);
   AliTriggerAnalysis& operator=(const AliTriggerAnalysis&);
@@ -25,6 +25,7 @@ ClassImp(AliMultEstimator);
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
   TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fFormulaInput(0), fFormulaVariables(), fFormulaParameters(),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
   // Constructor
@@ -32,6 +33,7 @@ fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 }
 AliMultEstimator::AliMultEstimator(const char * name, const char * title, TString lInitDef):
 TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fFormulaInput(0), fFormulaVariables(), fFormulaParameters(),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
     //Named, titled, definition constructor
@@ -46,11 +48,14 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fFormulaInput(0),
+fFormulaVariables(),
+fFormulaParameters(),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
 {
-  if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+  //Variables are not copied: set up again for the input at the first Evaluate
 }
 //________________________________________________________________
 AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
@@ -66,7 +71,8 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     
     if (fFormula) delete fFormula;
     fFormula = 0;
-    if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    fFormulaInput = 0;
+    fFormulaVariables.clear();
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -109,18 +115,35 @@ Float_t AliMultEstimator::GetZ() const {
 //________________________________________________________________
 void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
 {
+    //Only the variables appearing in the definition become parameters,
+    //numbered in order of appearance in the input. Their pointers are kept
+    //so that Evaluate does not need to look them up in the input
+    if (fFormula) delete fFormula;
+    fFormula = 0;
+    fFormulaVariables.clear();
+    fFormulaInput = lInput;
+    if (!lInput) return;
+    
     TString expr = fDefinition;
     Int_t   nVar = lInput->GetNVariables();
     for (Int_t i = 0; i < nVar; i++) {
-        TString repl(Form("[%d]", i));
-        TString lVarName = lInput->GetVariable(i)->GetName();
+        const AliMultVariable* v = lInput->GetVariable(i);
+        TString lVarName = v->GetName();
         //IMPORTANT: this is necessary as names may have a common component!
         //Example: fAmplitude_V0A and fAmplitude_V0AEq
         //Required in syntax: parenthesis around all variables
         lVarName.Append (")");
         lVarName.Prepend("(");
+        if (!expr.Contains(lVarName)) continue;
+        TString repl(Form("[%d]", (Int_t) fFormulaVariables.size()));
         expr.ReplaceAll(lVarName, repl);
+        fFormulaVariables.push_back(v);
     }
+    fFormulaParameters.assign(fFormulaVariables.size(), 0.);
+    
+    //Estimator which is just one variable: no formula needed
+    if (fFormulaVariables.size() == 1 && expr.Strip(TString::kBoth) == "[0]") return;
+    
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
@@ -129,12 +152,13 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
 {
-    if (!fFormula) return fValue = 0;
-    for (Int_t i = 0; i < lInput->GetNVariables(); i++) {
-        AliMultVariable* v = lInput->GetVariable(i);
-        fFormula->SetParameter(i, v->IsInteger() ?
-                               v->GetValueInteger() :
-                               v->GetValue());
+    if (lInput != fFormulaInput) SetupFormula(lInput);
+    const Int_t nPar = fFormulaVariables.size();
+    for (Int_t i = 0; i < nPar; i++) {
+        const AliMultVariable* v = fFormulaVariables[i];
+        fFormulaParameters[i] = v->IsInteger() ? v->GetValueInteger() : v->GetValue();
     }
-    return fValue = fFormula->Eval(0);
+    if (!fFormula) return fValue = (nPar == 1 ? fFormulaParameters[0] : 0);
+    Double_t x[1] = {0};
+    return fValue = fFormula->EvalPar(x, fFormulaParameters.data());
 }
@@ -1,7 +1,9 @@
 #ifndef AliMultEstimator_H
 #define AliMultEstimator_H
 #include <TNamed.h>
+#include <vector>
 class AliMultInput;
+class AliMultVariable;
 class TFormula;
 
 class AliMultEstimator : public TNamed {
@@ -52,12 +54,15 @@ private:
     Float_t fMean;   // estimator mean value
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
+    const AliMultInput* fFormulaInput;            //! input the formula was set up for
+    std::vector<const AliMultVariable*> fFormulaVariables; //! variables used, parameter i is variable i
+    std::vector<Double_t> fFormulaParameters;     //! parameter values for TFormula::EvalPar
     
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
     Float_t fAnchorPoint;       //Raw value below which
     Float_t fAnchorPercentile;  //Percentile of X-section at anchor point
     
-    ClassDef(AliMultEstimator, 1)
+    ClassDef(AliMultEstimator, 2)
 };
 #endif
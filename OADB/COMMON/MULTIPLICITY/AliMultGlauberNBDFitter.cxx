@@ -20,6 +20,7 @@
 #include "TF1.h"
 #include "TStopwatch.h"
 #include "TVirtualFitter.h"
+#include "Math/PdfFuncMathCore.h"
 
 ClassImp(AliMultGlauberNBDFitter);
 
@@ -47,6 +48,7 @@ fFitOptions("R0")
   
   //Ancestor histo
   fhNanc = new TH1D("fhNanc", "", 1000, -0.5, 999.5);
+  for(Int_t iNanc=0; iNanc<1000; iNanc++) fNanc[iNanc] = 0.;
   
   //NBD
   fNBD = new TF1("fNBD","ROOT::Math::negative_binomial_pdf(x,[0],[1])",0,800);
@@ -84,6 +86,7 @@ fFitOptions("R0")
   
   //Ancestor histo
   fhNanc = new TH1D("fhNanc", "", 1000, -0.5, 999.5);
+  for(Int_t iNanc=0; iNanc<1000; iNanc++) fNanc[iNanc] = 0.;
   
   //NBD
   fNBD = new TF1("fNBD","ROOT::Math::negative_binomial_pdf(x,[0],[1])",0,800);
@@ -138,17 +141,19 @@ Double_t AliMultGlauberNBDFitter::ProbDistrib(Double_t *x, Double_t *par)
       fhNanc->Fill(TMath::Floor(fNpart[ibin]*par[2] + fNcoll[ibin]*(1-par[2]) + 0.5),fContent[ibin]);
     }
     fhNanc->Scale(1./fhNanc->Integral());
+    //Flat copy for the loop below: bin iNanc+1 holds Nanc = iNanc
+    for(Int_t iNanc=0; iNanc<1000; iNanc++) fNanc[iNanc] = fhNanc->GetBinContent(iNanc+1);
   }
   //______________________________________________________
   //Actually ealuate function
+  //The NBD is evaluated directly with the function behind fNBD,
+  //without setting the parameters of the TF1 for each ancestor
   for(Long_t iNanc = 1; iNanc<900; iNanc++){
     Double_t lThisMu = ((Double_t)iNanc)*par[0];
     Double_t lThisk = ((Double_t)iNanc)*par[1];
     Double_t lpval = TMath::Power(1+lThisMu/lThisk,-1);
-    fNBD->SetParameter(1,lThisk);
-    fNBD->SetParameter(0,lpval);
-    Double_t lMult = fNBD->Eval(lMultValue);
-    lProbability += fhNanc->GetBinContent(fhNanc->FindBin(iNanc))*lMult;
+    Double_t lMult = ROOT::Math::negative_binomial_pdf(lMultValue,lpval,lThisk);
+    lProbability += fNanc[iNanc]*lMult;
   }
   //______________________________________________________
   return par[3]*lProbability;
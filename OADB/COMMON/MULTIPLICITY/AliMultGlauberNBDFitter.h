@@ -61,6 +61,7 @@ private:
   
   //Reference histo
   TH1D *fhNanc; //basic ancestor distribution
+  Double_t fNanc[1000]; //! content of fhNanc, indexed by the number of ancestors
   TH2 *fhNpNc; //correlation between Npart and Ncoll
   TH1 *fhV0M; //basic ancestor distribution
   
@@ -83,6 +84,6 @@ private:
   
   TString fFitOptions; 
   
-  ClassDef(AliMultGlauberNBDFitter, 1);
+  ClassDef(AliMultGlauberNBDFitter, 2);
 };
 #endif
@@ -28,9 +28,32 @@
 #include "TFile.h"
 #include "TStopwatch.h"
 #include "TArrayL64.h"
+#include <algorithm>
 
 ClassImp(AliMultSelectionCalibrator);
 
+namespace {
+    //Descending order of the values, as TMath::Sort(..., kTRUE)
+    struct CompareValuesDesc {
+        CompareValuesDesc(const Double_t *values) : fValues(values) {}
+        Bool_t operator()(Long64_t i1, Long64_t i2) const { return fValues[i1] > fValues[i2]; }
+        const Double_t *fValues;
+    };
+
+    //Arrange index[first,last) such that the requested (sorted, distinct) positions
+    //hold the entries they would hold after a full descending sort, recursing on
+    //the middle position to keep this at O(N log(npos))
+    void SelectPositionsDesc(const Double_t *values, Long64_t *index, Long64_t first, Long64_t last,
+                             const Long64_t *positions, Long_t npos) {
+        if( npos<1 || last-first<2 ) return;
+        const Long_t lMid = npos/2;
+        const Long64_t lPos = positions[lMid];
+        std::nth_element(index+first, index+lPos, index+last, CompareValuesDesc(values));
+        SelectPositionsDesc(values, index, first, lPos, positions, lMid);
+        SelectPositionsDesc(values, index, lPos+1, last, positions+lMid+1, npos-lMid-1);
+    }
+}
+
 AliMultSelectionCalibrator::AliMultSelectionCalibrator() : TNamed(), 
 fInput(0), fSelection(0), lDesiredBoundaries(0), lNDesiredBoundaries(0),
 fRunToUseAsDefault(-1), fMaxEventsPerRun(1e+9), fCheckTriggerType(kFALSE), fTrigType(AliVEvent::kAny), fPrefilterOnly(kFALSE),
@@ -423,6 +446,8 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     //FIXME Receive as parameter from the test macro
     Double_t lNrawBoundaries[1000];
     Double_t lMiddleOfBins[1000];
+    Long64_t lPositions[1000];
+    Long64_t lSortedPositions[1000];
 
     for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
         //place squarely at the middle to ensure it's all fine
@@ -524,13 +549,8 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
         for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
             if( ! ( fSelection->GetEstimator(iEst)->IsInteger() ) ) {
                 //==== Floating Point Calibration Engine ====
-                lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
-                cout<<"--- Sorting estimator "<<fSelection->GetEstimator(iEst)->GetName()<<"..."<<flush;
-                
-                TMath::Sort(ntot,sTree[iRun]->GetV1(), index.GetArray() );
-                cout<<" Done! Getting Boundaries... "<<flush;
-                
                 //Special override in case anchored estimator
+                //(counted first: the draw below has to stay in the tree buffer)
                 if( fSelection->GetEstimator(iEst)->GetUseAnchor() ){
                     cout<<"Anchoring... "<<flush;
                     //Require determination of index after which values are to be discarded
@@ -538,15 +558,11 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                     TString lCondition = fSelection->GetEstimator(iEst)->GetDefinition();
                     lCondition.Append(Form("> %.10f",fSelection->GetEstimator(iEst)->GetAnchorPoint() ) );
                     lAcceptedEvents = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),lCondition.Data(),"goff");
-                    lRunStats[iRun] = lAcceptedEvents;
                 }
-                lNrawBoundaries[0] = 0.0; //Defined OK even if anchored
-                //Overwrite lower boundary in case this has a negative minimum...
-                if ( lMinEst[iEst][iRun] < 0 ) {
-                    lNrawBoundaries[0] = lMinEst[iEst][iRun];
-                    cout<<"Min Value Override, Negative..."<<flush;
-                }
-                
+                lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
+                if( fSelection->GetEstimator(iEst)->GetUseAnchor() ) lRunStats[iRun] = lAcceptedEvents;
+
+                //Positions of the boundaries in the descending order of the estimator
                 for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
                     Long64_t position = (Long64_t) ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) );
                     
@@ -559,6 +575,35 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                         position = (Long64_t) ( ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) ) * lScalingFactor );
                         if(position > ntot-1 ) position = ntot-1; //protection !
                     }
+                    lPositions[lB] = position;
+                }
+
+                //Only the entries at the boundary positions are needed: partial
+                //selection instead of a full sort (same values at these positions)
+                cout<<"--- Sorting estimator "<<fSelection->GetEstimator(iEst)->GetName()<<"..."<<flush;
+                if( ntot > 0 ){
+                    Long64_t *lIndex = index.GetArray();
+                    for( Long64_t iEntry=0; iEntry<ntot; iEntry++) lIndex[iEntry] = iEntry;
+                    Long_t lNPos = 0;
+                    for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
+                        //out of range positions end up at the first entry when looked up
+                        lSortedPositions[lNPos++] = ( lPositions[lB]>=0 && lPositions[lB]<ntot ) ? lPositions[lB] : 0;
+                    }
+                    std::sort(lSortedPositions, lSortedPositions+lNPos);
+                    lNPos = std::unique(lSortedPositions, lSortedPositions+lNPos) - lSortedPositions;
+                    SelectPositionsDesc(sTree[iRun]->GetV1(), lIndex, 0, ntot, lSortedPositions, lNPos);
+                }
+                cout<<" Done! Getting Boundaries... "<<flush;
+                
+                lNrawBoundaries[0] = 0.0; //Defined OK even if anchored
+                //Overwrite lower boundary in case this has a negative minimum...
+                if ( lMinEst[iEst][iRun] < 0 ) {
+                    lNrawBoundaries[0] = lMinEst[iEst][iRun];
+                    cout<<"Min Value Override, Negative..."<<flush;
+                }
+                
+                for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
+                    Long64_t position = lPositions[lB];
                     //cout<<"Position requested: "<<position<<flush;
                     sTree[iRun]->GetEntry( index[position] );
                     //Calculate the estimator with this input, please
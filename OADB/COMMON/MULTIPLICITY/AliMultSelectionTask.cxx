@@ -82,6 +82,7 @@ class AliESDAD; //AD
 
 //For MultSelection Framework
 #include "AliOADBContainer.h"
+#include "AliOADBContainerCache.h"
 #include "AliOADBMultSelection.h"
 #include "AliMultEstimator.h"
 #include "AliMultVariable.h"
@@ -1778,13 +1779,11 @@ void AliMultSelectionTask::UserExec(Option_t *)
         
         //Determine Quantiles from calibration histogram
         TH1F *lThisCalibHisto = 0x0;
-        TString lThisCalibHistoName;
         Float_t lThisQuantile = -1;
         for(Long_t iEst=0; iEst<lSelection->GetNEstimators(); iEst++) {
             //Changed: no need for run number, object already matches required one
-            lThisCalibHistoName = Form("hCalib_%s",lSelection->GetEstimator(iEst)->GetName());
-            lThisCalibHisto = 0x0;
-            lThisCalibHisto = fOadbMultSelection->GetCalibHisto( lThisCalibHistoName );
+            //Histograms are looked up by name once per run, in AliOADBMultSelection::Setup
+            lThisCalibHisto = fOadbMultSelection->GetCalibHistoForEstimator( iEst );
             if ( ! lThisCalibHisto ) {
                 lThisQuantile = AliMultSelectionCuts::kNoCalib;
                 if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile;
@@ -2141,16 +2140,13 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
         lOADBref = Form("BYPASS: %s", fAlternateOADBFullManualBypass.Data());
     }
     
-    //Open File without calling InitFromFile, don't load it all!
-    TFile * foadb = TFile::Open(fileName);
-    if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileName.Data()));
+    //Container is read once per process and shared with other tasks: copy what is changed
+    AliOADBContainer * MultContainer = AliOADBContainerCache::GetContainer(fileName, "MultSel");
+    if(!MultContainer) AliFatal(Form("Cannot open OADB file %s or it does not contain OADBContainer named MultSel, stopping here", fileName.Data()));
     
     //Managed to open, save name of opened OADB file
     lHistTitle.Append(Form(", OADB: %s",lOADBref.Data()));
     
-    AliOADBContainer * MultContainer = (AliOADBContainer*) foadb->Get("MultSel");
-    if(!MultContainer) AliFatal(Form("OADB file %s does not contain OADBContainer named MultSel, stopping here", fileName.Data()));
-    
     //Get Object for this run!
     TObject *lObjAcquired = 0x0;
     
@@ -2232,16 +2228,9 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
         //Managed to open, save name of opened OADB file
         lHistTitle.Append(Form(", muOADB: %s",lmuOADBref.Data()));
         
-        //Open fileNameAlter
-        TFile * foadbAlter = 0x0;
-        foadbAlter = TFile::Open(fileNameAlter);
-        
-        //Check existence, please
-        if(!foadbAlter) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
-        if(!foadbAlter->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
-        
-        AliOADBContainer * MultContainerAlter = (AliOADBContainer*) foadbAlter->Get("MultSel");
-        if(!MultContainerAlter) AliFatal(Form("OADB file %s does not contain OADBContainer named MultSel, stopping here", fileNameAlter.Data()));
+        //Shared container, only read here
+        AliOADBContainer * MultContainerAlter = AliOADBContainerCache::GetContainer(fileNameAlter, "MultSel");
+        if(!MultContainerAlter) AliFatal(Form("Cannot open OADB file %s or it does not contain OADBContainer named MultSel, stopping here", fileNameAlter.Data()));
         
         //Get Object for this run
         TObject *lObjAcquiredAlter = 0x0;
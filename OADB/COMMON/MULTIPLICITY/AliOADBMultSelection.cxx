@@ -17,7 +17,7 @@ ClassImp(AliOADBMultSelection);
 //________________________________________________________________
 //Constructors/Destructor
 AliOADBMultSelection::AliOADBMultSelection() :
-TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0), fEstimatorCalib()
 {
     // constructor
     // fCalibList = new TList();
@@ -29,7 +29,8 @@ AliOADBMultSelection::AliOADBMultSelection(const AliOADBMultSelection& o)
 fCalibList(0),
 fEventCuts(0),
 fSelection(0),
-fMap(0)
+fMap(0),
+fEstimatorCalib()
 {
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
@@ -41,7 +42,7 @@ fMap(0)
 }
 //________________________________________________________________
 AliOADBMultSelection::AliOADBMultSelection(const char * name, const char * title) :
-TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0), fEstimatorCalib()
 {
     // constructor
     fCalibList = new TList();
@@ -61,6 +62,7 @@ AliOADBMultSelection& AliOADBMultSelection::operator=(const AliOADBMultSelection
         delete fMap;
         fMap = 0;
     }
+    fEstimatorCalib.clear();
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
     TIter next(o.fCalibList);
@@ -231,11 +233,13 @@ void AliOADBMultSelection::Setup()
         delete fMap;
         fMap = 0;
     }
+    fEstimatorCalib.clear();
     AliMultSelection* sel = GetMultSelection();
     if (!sel) return;
     
     fMap = new TMap;
     fMap->SetOwner(false);
+    fEstimatorCalib.assign(sel->GetNEstimators(), 0);
     
     for(Long_t iEst=0; iEst<sel->GetNEstimators(); iEst++) {
         AliMultEstimator* e = sel->GetEstimator(iEst);
@@ -246,6 +250,7 @@ void AliOADBMultSelection::Setup()
         if (!h) continue;
         
         fMap->Add(e, h);
+        fEstimatorCalib[iEst] = h;
     }
 }
 
@@ -2,6 +2,7 @@
 #define ALIOADBMULTSELECTION_H
 
 #include <TNamed.h>
+#include <vector>
 #include <AliMultSelection.h>
 class TBrowser;
 class TH1F;
@@ -39,6 +40,8 @@ public:
     //Use internal map
     void Setup();
     TH1F* FindHisto(AliMultEstimator* e);
+    TH1F* GetCalibHistoForEstimator(Long_t iEst) const
+    { return (iEst >= 0 && iEst < (Long_t) fEstimatorCalib.size()) ? fEstimatorCalib[iEst] : 0; }
     void Print(Option_t* option="") const;
     
 private:
@@ -46,7 +49,8 @@ private:
     AliMultSelectionCuts * fEventCuts; // EventCuts
     AliMultSelection     * fSelection; // Definition of Estimators
     TMap*                  fMap; //! Map estimator to histogram
-    ClassDef(AliOADBMultSelection, 1)
+    std::vector<TH1F*>     fEstimatorCalib; //! Histogram of each estimator, by estimator index
+    ClassDef(AliOADBMultSelection, 2)
     
     
 };
@@ -47,6 +47,7 @@ ClassImp(AliAnaCaloTrackCorrMaker) ;
 AliAnaCaloTrackCorrMaker::AliAnaCaloTrackCorrMaker() :
 TObject(),
 fReader(0),                   fCaloUtils(0),
+fReaderIsShared(kFALSE),
 fOutputContainer(new TList ), fAnalysisContainer(new TList ),
 fProcessEvent(1),
 fMakeHisto(kFALSE),           fMakeAOD(kFALSE),
@@ -99,6 +100,7 @@ AliAnaCaloTrackCorrMaker::AliAnaCaloTrackCorrMaker(const AliAnaCaloTrackCorrMake
 TObject(),
 fReader(),   //(new AliCaloTrackReader(*maker.fReader)),
 fCaloUtils(),//(new AliCalorimeterUtils(*maker.fCaloUtils)),
+fReaderIsShared(kFALSE),
 fOutputContainer(new TList()), fAnalysisContainer(new TList()),
 fProcessEvent(maker.fProcessEvent),
 fMakeHisto(maker.fMakeHisto),  fMakeAOD(maker.fMakeAOD),
@@ -181,7 +183,7 @@ AliAnaCaloTrackCorrMaker::~AliAnaCaloTrackCorrMaker()
     delete fAnalysisContainer ;
   }
   
-  if (fReader)    delete fReader ;
+  if (fReader && !fReaderIsShared) delete fReader ;
   if (fCaloUtils) delete fCaloUtils ;
   
   if(fCuts)
@@ -863,7 +865,7 @@ TList *AliAnaCaloTrackCorrMaker::GetOutputContainer()
   
   // Histograms defined and filled in this class, just get the pointers
   // and add them to the list.
-  if(GetReader()->GetWeightUtils()->IsMCCrossSectionCalculationOn())
+  if(GetReader()->GetWeightUtils()->IsMCCrossSectionCalculationOn() && !fReaderIsShared)
   {
     TList * templist =  GetReader()->GetWeightUtils()->GetCreateOutputHistograms();
       
@@ -878,19 +880,23 @@ TList *AliAnaCaloTrackCorrMaker::GetOutputContainer()
   
   // --------------------------------
   // Add control histograms in Reader
+  // Shared reader, in the output of the owner maker
   // --------------------------------
   
-  TList * templist =  fReader->GetCreateControlHistograms();
-  templist->SetOwner(kFALSE); //Owner is fOutputContainer.
-    
-  for(Int_t ih = 0; ih < templist->GetEntries() ; ih++)
-  {        
-    //if ( fSumw2 ) ((TH1*) templist->At(ih))->Sumw2();
-    
-    //printf("histo %d %p %s\n",ih,templist->At(ih), templist->At(ih)->GetName());
+  if ( !fReaderIsShared )
+  {
+    TList * templist =  fReader->GetCreateControlHistograms();
+    templist->SetOwner(kFALSE); //Owner is fOutputContainer.
     
-    //Add histogram to general container
-    fOutputContainer->Add(templist->At(ih)) ;
+    for(Int_t ih = 0; ih < templist->GetEntries() ; ih++)
+    {        
+      //if ( fSumw2 ) ((TH1*) templist->At(ih))->Sumw2();
+      
+      //printf("histo %d %p %s\n",ih,templist->At(ih), templist->At(ih)->GetName());
+      
+      //Add histogram to general container
+      fOutputContainer->Add(templist->At(ih)) ;
+    }
   }
   
   delete templist;
@@ -960,10 +966,13 @@ void AliAnaCaloTrackCorrMaker::Init()
   if ( fAnaDebug >= 0 )
     (AliAnalysisManager::GetAnalysisManager())->AddClassDebug(this->ClassName(),fAnaDebug);
 
-  // Initialize reader
-  GetReader()->Init();
+  // Initialize reader, done by the owner maker if shared
+  if ( !fReaderIsShared )
+  {
+    GetReader()->Init();
 
-  GetReader()->SetCaloUtils(GetCaloUtils()); // pass the calo utils pointer to the reader
+    GetReader()->SetCaloUtils(GetCaloUtils()); // pass the calo utils pointer to the reader
+  }
 
   // Activate debug level in calo utils
   if ( fCaloUtils->GetDebug() >= 0 )
@@ -1073,8 +1082,9 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   // Set the AODB calibration, bad channels etc. parameters at least once
   fCaloUtils->AccessOADB(fReader->GetInputEvent());
   
-  // Tell the reader to fill the data in the 3 detector lists
-  Bool_t ok = fReader->FillInputEvent(iEntry, currentFileName);
+  // Tell the reader to fill the data in the 3 detector lists,
+  // only for the first maker of the event if the reader is shared
+  Bool_t ok = fReader->FillInputEventOnce(iEntry, currentFileName);
   
   // Access pointers, and trigger mask check needed in mixing case
   AliAnalysisManager   *manager      = AliAnalysisManager::GetAnalysisManager();
@@ -1099,7 +1109,7 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   if(!ok)
   {
     AliDebug(1,Form("*** Skip event *** %d",iEntry));
-    fReader->ResetLists();
+    if ( !fReader->IsSharedByMakers() ) fReader->ResetLists();
     return ;
   }
   
@@ -1139,7 +1149,8 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
     
   }
 	
-  fReader->ResetLists();
+  // A shared reader keeps the lists for the other makers, cleared with the next event
+  if ( !fReader->IsSharedByMakers() ) fReader->ResetLists();
   
   // In case of mixing analysis, non triggered events are used,
   // do not fill control histograms for a non requested triggered event
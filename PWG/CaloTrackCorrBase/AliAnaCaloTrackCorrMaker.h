@@ -87,6 +87,12 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   void    SetCaloUtils(AliCalorimeterUtils * cu) { fCaloUtils = cu ; }
   void    SetReader(AliCaloTrackReader * re)     { fReader = re    ; }
   
+  /// Use the reader of another maker with the same reader settings. The input lists
+  /// are filled once per event by the first maker executed, this maker does not own,
+  /// initialize or store the control histograms of the reader. Not meant for delta AOD output.
+  void    SetSharedReader(AliCaloTrackReader * re) { fReader = re ; fReaderIsShared = kTRUE ; re->SwitchOnSharedByMakers() ; }
+  Bool_t  IsReaderShared()           const { return fReaderIsShared; }
+  
   AliCaloTrackReader  * GetReader()        { if (!fReader)    fReader    = new AliCaloTrackReader () ;
                                              return fReader        ; }
   	
@@ -114,6 +120,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
     
   AliCalorimeterUtils *  fCaloUtils ;                ///<  Pointer to AliCalorimeterUtils.
   
+  Bool_t   fReaderIsShared ;                         ///<  Reader owned by another maker, see SetSharedReader().
+  
   TList *  fOutputContainer ;                        //!<! Output histograms container.
     
   TList *  fAnalysisContainer ;                      ///<  List with analysis pointers.
@@ -206,7 +214,7 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   AliAnaCaloTrackCorrMaker & operator = (const AliAnaCaloTrackCorrMaker & ) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrMaker,27) ;
+  ClassDef(AliAnaCaloTrackCorrMaker,28) ;
   /// \endcond
 
 } ;
@@ -104,6 +104,8 @@ fMixedEvent(NULL),           fNMixedEvent(0),                 fVertex(NULL),
 fListMixedTracksEvents(),    fListMixedCaloEvents(),
 fLastMixedTracksEvent(-1),   fLastMixedCaloEvent(-1),
 fWriteOutputDeltaAOD(kFALSE),
+fSharedByMakers(kFALSE),     fSharedFilledEvent(0x0),         fSharedFilledEntry(-1),
+fSharedFilledEventId(0),     fSharedFilledAccepted(kFALSE),
 fEMCALClustersListName(""),  fEMCALCellsListName(""),  
 fZvtxCut(0.),
 fAcceptFastCluster(kFALSE),  fRemoveLEDEvents(0),
@@ -1267,6 +1269,38 @@ Bool_t AliCaloTrackReader::IsPileUpFromNotSPDAndNotEMCal() const
   else                                            return kFALSE;
 }
 
+//___________________________________________________________________________________
+/// Call FillInputEvent(), only once per event if the reader is shared by several makers.
+/// In that case the lists filled for the first maker of the event are kept for
+/// the others, and cleared here when the next event is filled.
+///
+/// \param iEntry: entry in the tree
+/// \param currentFileName: name of the current file, not used
+///
+/// \return the result of FillInputEvent() for this event
+///
+/// Called by the analysis maker.
+//___________________________________________________________________________________
+Bool_t AliCaloTrackReader::FillInputEventOnce(Int_t iEntry, const char * currentFileName)
+{
+  if ( !fSharedByMakers ) return FillInputEvent(iEntry, currentFileName);
+  
+  ULong64_t eventId = 0;
+  if ( fInputEvent ) eventId = ((ULong64_t)(fInputEvent->GetBunchCrossNumber())<<32) + fInputEvent->GetTimeStamp();
+  
+  if ( fSharedFilledEvent == fInputEvent && fSharedFilledEntry == iEntry && fSharedFilledEventId == eventId )
+    return fSharedFilledAccepted;
+  
+  ResetLists();
+  
+  fSharedFilledEvent    = fInputEvent;
+  fSharedFilledEntry    = iEntry;
+  fSharedFilledEventId  = eventId;
+  fSharedFilledAccepted = FillInputEvent(iEntry, currentFileName);
+  
+  return fSharedFilledAccepted;
+}
+
 //___________________________________________________________________________________
 /// Event and tracks/clusters filtering method. Main steps:
 /// * Accept/reject the event looking to the triggers, vertex, pile-up, time stamps, 
@@ -3147,6 +3181,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("    \n") ;
  
   printf("Write delta AOD =     %d\n",     fWriteOutputDeltaAOD) ;
+  printf("Shared by makers =    %d\n",     fSharedByMakers) ;
   printf("Recalculate Clusters = %d, E linearity = %d\n",    fRecalculateClusters, fCorrectELinearity) ;
   
   printf("Use Triggers selected in SE base class %d; If not what Trigger Mask? %d; MB Trigger Mask for mixed %d \n",
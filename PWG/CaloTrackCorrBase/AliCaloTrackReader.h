@@ -110,6 +110,11 @@ public:
   void            SwitchOffWriteDeltaAOD()                 { fWriteOutputDeltaAOD = kFALSE ; }
   Bool_t          WriteDeltaAODToFile()              const { return fWriteOutputDeltaAOD   ; } 
   
+  // Reader used by several makers, input lists filled once per event
+  void            SwitchOnSharedByMakers()                 { fSharedByMakers = kTRUE       ; }
+  void            SwitchOffSharedByMakers()                { fSharedByMakers = kFALSE      ; }
+  Bool_t          IsSharedByMakers()                 const { return fSharedByMakers        ; }
+  
   virtual TList * GetCreateControlHistograms() ;
   void            SetControlHistogramEnergyBinning(Int_t nBins, Float_t emin, Float_t emax)
   { fEnergyHistogramNbins = nBins ; fEnergyHistogramLimit[0] = emin; fEnergyHistogramLimit[1] = emax ; }
@@ -285,6 +290,7 @@ public:
   // Filling/ filtering / detector information access methods
   
   virtual Bool_t   FillInputEvent(Int_t iEntry, const char *currentFileName)  ;
+  Bool_t           FillInputEventOnce(Int_t iEntry, const char *currentFileName)  ;
   virtual void     FillInputCTS() ;
   virtual void     FillInputEMCAL() ;
   virtual void     FillInputEMCALAlgorithm(AliVCluster * clus, Int_t iclus) ;
@@ -903,6 +909,12 @@ public:
    
   Bool_t           fWriteOutputDeltaAOD;           ///<  Write the created delta AOD objects into file.  
   
+  Bool_t           fSharedByMakers;                ///<  Reader used by several makers, fill the input lists only for the first one in each event.
+  const AliVEvent* fSharedFilledEvent;             //!<! Input event the lists were filled for, shared reader.
+  Int_t            fSharedFilledEntry;             //!<! Entry the lists were filled for, shared reader.
+  ULong64_t        fSharedFilledEventId;           //!<! Bunch crossing and time stamp of the event the lists were filled for, shared reader.
+  Bool_t           fSharedFilledAccepted;          //!<! Result of FillInputEvent() for the filled event, shared reader.
+  
   Int_t            fV0ADC[2]    ;                  ///<  Integrated V0 signal.
   Int_t            fV0Mul[2]    ;                  ///<  Integrated V0 Multiplicity.
 
@@ -1024,7 +1036,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,82) ;
+  ClassDef(AliCaloTrackReader,83) ;
   /// \endcond
 
 } ;
@@ -54,7 +54,9 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fConeTracks(),
+fConeClusters()
 {
   InitParameters();
 }
@@ -396,6 +398,105 @@ void AliIsolationCut::InitParameters()
   fDistMinToTrigger = -1.; // no effect
 }
 
+//_________________________________________________________________________________________________________________________________
+/// Compute the kinematics of the tracks or clusters of a list, unless already done for
+/// the same list in this event. The kinematics do not depend on the candidate or the cone size.
+///
+/// \param cache: kinematics of the list entries, filled
+/// \param list: list of tracks (AliVTrack) or clusters (AliVCluster), or of AliCaloTrackParticle for mixed events
+/// \param isCluster: list of clusters
+/// \param reader: pointer to AliCaloTrackReader, for the event and the vertex
+/// \param pid: pointer to AliCaloPID, used for the cluster track matching flags
+//_________________________________________________________________________________________________________________________________
+void AliIsolationCut::FillConeListCache(ConeListCache & cache, TObjArray * list, Bool_t isCluster,
+                                        AliCaloTrackReader * reader, AliCaloPID * pid)
+{
+  Int_t nEntries = list->GetEntries();
+  
+  if ( cache.fList       == list                     && 
+       cache.fInputEvent == reader->GetInputEvent()  &&
+       cache.fEvent      == reader->GetEventNumber() &&
+       cache.fEntries    == nEntries                 &&
+       cache.fPID        == pid                         ) return ;
+  
+  cache.fList       = list;
+  cache.fInputEvent = reader->GetInputEvent();
+  cache.fEvent      = reader->GetEventNumber();
+  cache.fEntries    = nEntries;
+  cache.fPID        = pid;
+  
+  cache.fType.assign(nEntries, 0 );
+  cache.fID  .assign(nEntries, -1);
+  cache.fTM  .assign(nEntries, -1);
+  cache.fPt  .assign(nEntries, 0.);
+  cache.fEta .assign(nEntries, 0.);
+  cache.fPhi .assign(nEntries, 0.);
+  
+  Float_t pt  = -100. ;
+  Float_t eta = -100. ;
+  Float_t phi = -100. ;
+  
+  for(Int_t ipr = 0; ipr < nEntries; ipr++)
+  {
+    TObject * obj = list->At(ipr);
+    
+    AliVTrack   * track = 0x0;
+    AliVCluster * calo  = 0x0;
+    if ( !isCluster ) track = dynamic_cast<AliVTrack   *>(obj) ;
+    else              calo  = dynamic_cast<AliVCluster *>(obj) ;
+    
+    if ( track )
+    {
+      cache.fType[ipr] = 1;
+      cache.fID  [ipr] = reader->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
+      
+      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      pt  = fTrackVector.Pt();
+      eta = fTrackVector.Eta();
+      phi = fTrackVector.Phi() ;
+    }
+    else if ( calo )
+    {
+      cache.fType[ipr] = 1;
+      cache.fID  [ipr] = calo->GetID();
+      
+      // Get the index where the cluster comes, to retrieve the corresponding vertex
+      Int_t evtIndex = 0 ;
+      if (reader->GetMixedEvent())
+        evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+      
+      // Assume that come from vertex in straight line
+      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+      
+      pt  = fMomentum.Pt()  ;
+      eta = fMomentum.Eta() ;
+      phi = fMomentum.Phi() ;
+    }
+    else
+    {// Mixed event stored in AliCaloTrackParticles
+      AliCaloTrackParticle * partmix = dynamic_cast<AliCaloTrackParticle*>(obj) ;
+      if(!partmix)
+      {
+        if ( !isCluster ) AliWarning("Wrong track data type, continue");
+        else              AliWarning("Wrong calo data type, continue");
+        continue;
+      }
+      
+      cache.fType[ipr] = 2;
+      
+      pt  = partmix->Pt();
+      eta = partmix->Eta();
+      phi = partmix->Phi() ;
+    }
+    
+    if ( phi < 0 ) phi+=TMath::TwoPi();
+    
+    cache.fPt [ipr] = pt ;
+    cache.fEta[ipr] = eta;
+    cache.fPhi[ipr] = phi;
+  }
+}
+
 //________________________________________________________________________________
 /// Declare a candidate particle isolated depending on the
 /// cluster or track particle multiplicity and/or momentum.
@@ -464,50 +565,35 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
+    FillConeListCache(fConeTracks, plCTS, kFALSE, reader, pid);
+    
     for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
     {
-      AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
+      // Wrong track data type, warned when filling the cache
+      if ( fConeTracks.fType[ipr] == 0 ) continue ;
       
-      if(track)
+      // In case of isolation of single tracks or conversion photon (2 tracks) or pi0 (4 tracks),
+      // do not count the candidate or the daughters of the candidate
+      // in the isolation conte
+      if ( fConeTracks.fType[ipr] == 1 &&
+           pCandidate->GetDetectorTag() == AliFiducialCut::kCTS ) // make sure conversions are tagged as kCTS!!!
       {
-        // In case of isolation of single tracks or conversion photon (2 tracks) or pi0 (4 tracks),
-        // do not count the candidate or the daughters of the candidate
-        // in the isolation conte
-        if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS ) // make sure conversions are tagged as kCTS!!!
-        {
-          Int_t  trackID   = reader->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
-          Bool_t contained = kFALSE;
-          
-          for(Int_t i = 0; i < 4; i++) 
-          {
-            if( trackID == pCandidate->GetTrackLabel(i) ) contained = kTRUE;
-          }
-          
-          if ( contained ) continue ;
-        }
+        Int_t  trackID   = fConeTracks.fID[ipr] ;
+        Bool_t contained = kFALSE;
         
-        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-        pt  = fTrackVector.Pt();
-        eta = fTrackVector.Eta();
-        phi = fTrackVector.Phi() ;
-      }
-      else
-      {// Mixed event stored in AliCaloTrackParticles
-        AliCaloTrackParticle * trackmix = dynamic_cast<AliCaloTrackParticle*>(plCTS->At(ipr)) ;
-        if(!trackmix)
+        for(Int_t i = 0; i < 4; i++) 
         {
-          AliWarning("Wrong track data type, continue");
-          continue;
+          if( trackID == pCandidate->GetTrackLabel(i) ) contained = kTRUE;
         }
         
-        pt  = trackmix->Pt();
-        eta = trackmix->Eta();
-        phi = trackmix->Phi() ;
+        if ( contained ) continue ;
       }
       
-      // ** Calculate distance between candidate and tracks **
+      pt  = fConeTracks.fPt [ipr];
+      eta = fConeTracks.fEta[ipr];
+      phi = fConeTracks.fPhi[ipr];
       
-      if ( phi < 0 ) phi+=TMath::TwoPi();
+      // ** Calculate distance between candidate and tracks **
       
       rad = Radius(etaC, phiC, eta, phi);
       
@@ -569,7 +655,7 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
             reftracks->SetName(tempo);
             reftracks->SetOwner(kFALSE);
           }
-          reftracks->Add(track);
+          reftracks->Add(dynamic_cast<AliVTrack*>(plCTS->At(ipr)));
         }
         
         coneptsumTrack+=pt;
@@ -610,53 +696,35 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
+    FillConeListCache(fConeClusters, plNe, kTRUE, reader, pid);
+    
     for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
     {
-      AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
+      // Wrong calo data type, warned when filling the cache
+      if ( fConeClusters.fType[ipr] == 0 ) continue ;
       
-      if(calo)
+      if ( fConeClusters.fType[ipr] == 1 )
       {
-        // Get the index where the cluster comes, to retrieve the corresponding vertex
-        Int_t evtIndex = 0 ;
-        if (reader->GetMixedEvent())
-          evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
-        
-        
         // Do not count the candidate (photon or pi0) or the daughters of the candidate
-        if(calo->GetID() == pCandidate->GetCaloLabel(0) ||
-           calo->GetID() == pCandidate->GetCaloLabel(1)   ) continue ;
+        if(fConeClusters.fID[ipr] == pCandidate->GetCaloLabel(0) ||
+           fConeClusters.fID[ipr] == pCandidate->GetCaloLabel(1)   ) continue ;
         
-        // Skip matched clusters with tracks in case of neutral+charged analysis
-        if(fIsTMClusterInConeRejected)
+        // Skip matched clusters with tracks in case of neutral+charged analysis,
+        // checked once per event
+        if(fIsTMClusterInConeRejected && fPartInCone == kNeutralAndCharged)
         {
-          if( fPartInCone == kNeutralAndCharged &&
-             pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
-        }
-        
-        // Assume that come from vertex in straight line
-        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-        
-        pt  = fMomentum.Pt()  ;
-        eta = fMomentum.Eta() ;
-        phi = fMomentum.Phi() ;
-      }
-      else
-      {// Mixed event stored in AliCaloTrackParticles
-        AliCaloTrackParticle * calomix = dynamic_cast<AliCaloTrackParticle*>(plNe->At(ipr)) ;
-        if(!calomix)
-        {
-          AliWarning("Wrong calo data type, continue");
-          continue;
+          if( fConeClusters.fTM[ipr] < 0 )
+            fConeClusters.fTM[ipr] = pid->IsTrackMatched((AliVCluster *) plNe->At(ipr),reader->GetCaloUtils(),reader->GetInputEvent()) ? 1 : 0 ;
+          
+          if( fConeClusters.fTM[ipr] == 1 ) continue ;
         }
-        
-        pt  = calomix->Pt();
-        eta = calomix->Eta();
-        phi = calomix->Phi() ;
       }
       
-      // ** Calculate distance between candidate and tracks **
+      pt  = fConeClusters.fPt [ipr];
+      eta = fConeClusters.fEta[ipr];
+      phi = fConeClusters.fPhi[ipr];
       
-      if( phi < 0 ) phi+=TMath::TwoPi();
+      // ** Calculate distance between candidate and tracks **
       
       rad = Radius(etaC, phiC, eta, phi);
       
@@ -726,7 +794,7 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
             refclusters->SetName(tempo);
             refclusters->SetOwner(kFALSE);
           }
-          refclusters->Add(calo);
+          refclusters->Add(dynamic_cast<AliVCluster *>(plNe->At(ipr)));
         }
         
         coneptsumCluster+=pt;
@@ -19,11 +19,13 @@
 //_________________________________________________________________________
 
 // --- ROOT system ---
+#include <vector>
 #include <TObject.h>
 class TObjArray ;
 #include <TLorentzVector.h>
 
 // --- ANALYSIS system ---
+class AliVEvent ;
 class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID;
@@ -112,6 +114,27 @@ class AliIsolationCut : public TObject {
     
  private:
 
+  /// Kinematics of the entries of a list of tracks or clusters passed to MakeIsolationCut(),
+  /// computed once per event and reused for all the candidates and cone sizes.
+  struct ConeListCache {
+    ConeListCache() : fList(0x0), fInputEvent(0x0), fEvent(-1), fEntries(-1), fPID(0x0),
+                      fType(), fID(), fTM(), fPt(), fEta(), fPhi() { ; }
+    const TObjArray   * fList;       ///< List the values were computed for.
+    const AliVEvent   * fInputEvent; ///< Input event at that time.
+    Int_t               fEvent;      ///< Reader event number at that time.
+    Int_t               fEntries;    ///< Entries of the list at that time.
+    const AliCaloPID  * fPID;        ///< PID used for the track matching flags.
+    std::vector<Char_t>  fType;      ///< 0 wrong data type, 1 track or cluster, 2 mixed event particle.
+    std::vector<Int_t>   fID;        ///< Track ID given by the reader or cluster ID.
+    std::vector<Char_t>  fTM;        ///< Cluster matched to a track, -1 not checked yet.
+    std::vector<Float_t> fPt;        ///< Transverse momentum.
+    std::vector<Float_t> fEta;       ///< Pseudorapidity.
+    std::vector<Float_t> fPhi;       ///< Azimuthal angle, in [0,2pi].
+  };
+
+  void       FillConeListCache(ConeListCache & cache, TObjArray * list, Bool_t isCluster,
+                               AliCaloTrackReader * reader, AliCaloPID * pid) ;
+
   Float_t    fConeSize ;         ///< Size of the isolation cone
 
   Float_t    fPtThreshold ;      ///< Minimum pt of the particles in the cone or sum in cone (UE pt mean in the forward region cone)
@@ -140,6 +163,10 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  ConeListCache fConeTracks;     //!<! Kinematics of the tracks in the last track list.
+
+  ConeListCache fConeClusters;   //!<! Kinematics of the clusters in the last cluster list.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -147,7 +174,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,11) ;
+  ClassDef(AliIsolationCut,12) ;
   /// \endcond
 
 } ;
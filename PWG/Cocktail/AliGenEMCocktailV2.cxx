@@ -150,10 +150,16 @@ Double_t AliGenEMCocktailV2::GetYWeight(Int_t np, TParticle* part) {
   if (!fUseYWeighting) return 1.;
 
   Double_t weight = 0.;
-  if (fPtYDistribution[np]) {
-    if (part->Pt() > fPtYDistribution[np]->GetXaxis()->GetXmin() && part->Pt() < fPtYDistribution[np]->GetXaxis()->GetXmin()) {
-      if (part->Y() > fPtYDistribution[np]->GetYaxis()->GetXmin() && part->Y() < fPtYDistribution[np]->GetYaxis()->GetXmin()) {
-        weight = fPtYDistribution[np]->GetBinContent(fPtYDistribution[np]->GetXaxis()->FindBin(part->Pt()), fPtYDistribution[np]->GetYaxis()->FindBin(part->Y()));
+  TH2F* ptYDistribution = fPtYDistribution[np];
+  if (ptYDistribution) {
+    // pt and y are computed once, each call of TParticle::Pt() and Y() redoes the sqrt/log
+    TAxis* xAxis = ptYDistribution->GetXaxis();
+    TAxis* yAxis = ptYDistribution->GetYaxis();
+    Double_t pt = part->Pt();
+    if (pt > xAxis->GetXmin() && pt < xAxis->GetXmin()) {
+      Double_t y = part->Y();
+      if (y > yAxis->GetXmin() && y < yAxis->GetXmin()) {
+        weight = ptYDistribution->GetBinContent(xAxis->FindBin(pt), yAxis->FindBin(y));
         if (weight)
           return weight;
         else
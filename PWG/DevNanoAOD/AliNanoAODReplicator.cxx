@@ -46,6 +46,9 @@ class AliAODRecoDecay;
 #include "AliPIDResponse.h"
 #include <iostream>
 #include <cassert>
+#include <map>
+#include <set>
+#include <vector>
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
@@ -76,6 +79,23 @@ using std::endl;
 
 ClassImp(AliNanoAODReplicator)
 
+namespace {
+  /// Tracks needed by the copied V0 and cascade vertices, with the vertices they belong to
+  typedef std::map<TObject*, std::vector<AliAODVertex*> > KeepTracksMap;
+
+  void KeepDaughters(KeepTracksMap &keepTracks, AliAODVertex *copiedVertex)
+  {
+    // remember the daughters of copiedVertex, they are added back when the nano tracks are created
+    Int_t nDaughter = copiedVertex->GetNDaughters();
+    for (int nD = 0; nD<nDaughter; nD++) {
+      std::vector<AliAODVertex*> &vertices = keepTracks[copiedVertex->GetDaughter(nD)];
+      if (vertices.empty() || vertices.back() != copiedVertex)
+        vertices.push_back(copiedVertex);
+    }
+    copiedVertex->RemoveDaughters();
+  }
+}
+
 //_____________________________________________________________________________
 AliNanoAODReplicator::AliNanoAODReplicator() :
 AliAODBranchReplicator(), 
@@ -573,7 +593,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   }
 
   // NOTE cascades have to be before V0s as AliAODEvent::FixCascades needs sane V0 information
-  std::map<AliAODVertex*, std::vector<TObject*> > keepTracks;
+  KeepTracksMap keepTracks;
   if (fSaveCascades) {
     TIter nextC(const_cast<AliAODEvent&>(source).GetCascades());
     AliAODcascade* cascade;
@@ -585,17 +605,11 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 
       // bachelor track and xi vertex
       AliAODVertex* copiedXi = new((*fVertices)[nvertices++]) AliAODVertex(*(cascade->GetDecayVertexXi()));
-      Int_t nDaughter = copiedXi->GetNDaughters();
-      for (int nD = 0; nD<nDaughter; nD++)
-        keepTracks[copiedXi].push_back(copiedXi->GetDaughter(nD));
-      copiedXi->RemoveDaughters();
+      KeepDaughters(keepTracks, copiedXi);
       
       // v0 vertex and tracks
       AliAODVertex* copiedV0Vertex = new((*fVertices)[nvertices++]) AliAODVertex(*(cascade->GetSecondaryVtx()));
-      nDaughter = copiedV0Vertex->GetNDaughters();
-      for (int nD = 0; nD<nDaughter; nD++)
-        keepTracks[copiedV0Vertex].push_back(copiedV0Vertex->GetDaughter(nD));
-      copiedV0Vertex->RemoveDaughters();
+      KeepDaughters(keepTracks, copiedV0Vertex);
       
       // NOTE we don't have AliAODcascade::SetDecayVertexXi so have to use copy constructor here
       //AliAODcascade* nanoCascade = new((*fCascades)[n++]) AliAODcascade(*cascade); 
@@ -622,10 +636,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       nanoV0->SetSecondaryVtx(copiedVertex);
 
       // needed tracks
-      Int_t nDaughter = copiedVertex->GetNDaughters();
-      for (int nD = 0; nD<nDaughter; nD++)
-        keepTracks[copiedVertex].push_back(copiedVertex->GetDaughter(nD));
-      copiedVertex->RemoveDaughters();
+      KeepDaughters(keepTracks, copiedVertex);
     }
     // Printf("n(tracks) = %d n(V0) = %d -> %d", source.GetNumberOfTracks(), source.GetNumberOfV0s(), nV0s);
   }
@@ -642,7 +653,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   }
 
   // Photons
-  std::list<Int_t> trackIDs;
+  std::set<Int_t> trackIDs;
   if (fSaveConversionPhotons) {
     Int_t nConvPhotons = 0;
     static AliV0ReaderV1* photonReader = (AliV0ReaderV1*) AliAnalysisManager::GetAnalysisManager()->GetTask("ConvGammaAODProduction");
@@ -655,8 +666,8 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       auto *photonCandidate = dynamic_cast<AliAODConversionPhoton *>(gammaArray->At(iGamma));
       if (fConversionPhotonCuts && !fConversionPhotonCuts->IsSelected(photonCandidate))
         continue;
-      trackIDs.push_back(photonCandidate->GetTrackLabelPositive());
-      trackIDs.push_back(photonCandidate->GetTrackLabelNegative());
+      trackIDs.insert(photonCandidate->GetTrackLabelPositive());
+      trackIDs.insert(photonCandidate->GetTrackLabelNegative());
       new((*fConversionPhotons)[nConvPhotons++]) AliAODConversionPhoton(*photonCandidate);
     }
   }
@@ -675,13 +686,12 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       selected = kTRUE;
     
     // store tracks needed for V0s
-    for (std::map<AliAODVertex*, std::vector<TObject*> >::iterator it = keepTracks.begin(); it != keepTracks.end(); it++) {
-      if (std::find(it->second.begin(), it->second.end(), aodtrack) != it->second.end())
-        selected = kTRUE;
-    }
+    KeepTracksMap::iterator keepIt = keepTracks.find(aodtrack);
+    if (keepIt != keepTracks.end())
+      selected = kTRUE;
     
     // store tracks needed for conversions
-    if (std::find(trackIDs.begin(), trackIDs.end(), aodtrack->GetID()) != trackIDs.end())
+    if (!trackIDs.empty() && trackIDs.count(aodtrack->GetID()))
       selected = kTRUE;
     
     if (!selected)
@@ -690,10 +700,9 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     AliNanoAODTrack* nanoTrack = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
 
     // replace referencs to stored tracks
-    for (std::map<AliAODVertex*, std::vector<TObject*> >::iterator it = keepTracks.begin(); it != keepTracks.end(); it++) {
-      auto daughterListIt = std::find(it->second.begin(), it->second.end(), aodtrack);
-      if (daughterListIt != it->second.end())
-        it->first->AddDaughter(nanoTrack);
+    if (keepIt != keepTracks.end()) {
+      for (std::vector<AliAODVertex*>::iterator it = keepIt->second.begin(); it != keepIt->second.end(); it++)
+        (*it)->AddDaughter(nanoTrack);
     }
 
     for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
@@ -20,7 +20,9 @@
 //     michele.floris@cern.ch
 //-------------------------------------------------------------------------
 
+#include <vector>
 #include <TVector3.h>
+#include <TClonesArray.h>
 #include "AliLog.h"
 #include "AliExternalTrackParam.h"
 #include "AliVVertex.h"
@@ -33,7 +35,130 @@
 
 ClassImp(AliNanoAODTrack)
 
+namespace {
+  /// Variables of the AOD track copied by the AliAODTrack constructor
+  enum EAODVar {
+    kVarPt,
+    kVarPhi,
+    kVarTheta,
+    kVarChi2perNDF,
+    kVarPosx,
+    kVarPosy,
+    kVarPosz,
+    kVarPosDCAx,
+    kVarPosDCAy,
+    kVarPosDCAz,
+    kVarPDCAx,
+    kVarPDCAy,
+    kVarPDCAz,
+    kVarDCA,
+    kVarRAtAbsorberEnd,
+    kVarTPCncls,
+    kVarID,
+    kVarTPCnclsF,
+    kVarTPCNCrossedRows,
+    kVarTrackPhiOnEMCal,
+    kVarTrackEtaOnEMCal,
+    kVarTrackPtOnEMCal,
+    kVarITSsignal,
+    kVarTPCsignal,
+    kVarTPCsignalTuned,
+    kVarTPCsignalN,
+    kVarTPCmomentum,
+    kVarTPCTgl,
+    kVarTOFsignal,
+    kVarIntegratedLength,
+    kVarTOFsignalTuned,
+    kVarHMPIDsignal,
+    kVarHMPIDoccupancy,
+    kVarTRDsignal,
+    kVarTRDChi2,
+    kVarTRDnSlices,
+    kVarTPCnclsS,
+    kVarFilterMap,
+    kVarTOFBunchCrossing,
+    kVarPx,
+    kVarPy,
+    kVarPz,
+    kVarCovMat
+  };
+
+  /// One column to fill: index in the mapping and variable to copy there
+  struct AODFillStep {
+    Int_t fIndex;
+    EAODVar fVar;
+  };
+
+  void AddFillStep(std::vector<AODFillStep> &plan, Int_t index, EAODVar var)
+  {
+    if (index < 0 || index >= AliNanoAODTrackMapping::GetInstance()->GetSize())
+      return;
+    AODFillStep step = { index, var };
+    plan.push_back(step);
+  }
+
+  /// Columns filled from the AOD tracks, built once from the mapping
+  /// (the mapping is a singleton and cannot change once created)
+  const std::vector<AODFillStep> &GetAODFillPlan()
+  {
+    static std::vector<AODFillStep> plan;
+    static Bool_t built = kFALSE;
+    if (built)
+      return plan;
+    built = kTRUE;
+
+    AliNanoAODTrackMapping *mapping = AliNanoAODTrackMapping::GetInstance();
+    AddFillStep(plan, mapping->GetPt(),               kVarPt);
+    AddFillStep(plan, mapping->GetPhi(),              kVarPhi);
+    AddFillStep(plan, mapping->GetTheta(),            kVarTheta);
+    AddFillStep(plan, mapping->GetChi2PerNDF(),       kVarChi2perNDF);
+    AddFillStep(plan, mapping->GetPosX(),             kVarPosx);
+    AddFillStep(plan, mapping->GetPosY(),             kVarPosy);
+    AddFillStep(plan, mapping->GetPosZ(),             kVarPosz);
+    AddFillStep(plan, mapping->GetPosDCAx(),          kVarPosDCAx);
+    AddFillStep(plan, mapping->GetPosDCAy(),          kVarPosDCAy);
+    AddFillStep(plan, mapping->GetPosDCAz(),          kVarPosDCAz);
+    AddFillStep(plan, mapping->GetPDCAX(),            kVarPDCAx);
+    AddFillStep(plan, mapping->GetPDCAY(),            kVarPDCAy);
+    AddFillStep(plan, mapping->GetPDCAZ(),            kVarPDCAz);
+    AddFillStep(plan, mapping->GetDCA(),              kVarDCA);
+    AddFillStep(plan, mapping->GetRAtAbsorberEnd(),   kVarRAtAbsorberEnd);
+    AddFillStep(plan, mapping->GetTPCncls(),          kVarTPCncls);
+    AddFillStep(plan, mapping->GetID(),               kVarID);
+    AddFillStep(plan, mapping->GetTPCnclsF(),         kVarTPCnclsF);
+    AddFillStep(plan, mapping->GetTPCNCrossedRows(),  kVarTPCNCrossedRows);
+    AddFillStep(plan, mapping->GetTrackPhiOnEMCal(),  kVarTrackPhiOnEMCal);
+    AddFillStep(plan, mapping->GetTrackEtaOnEMCal(),  kVarTrackEtaOnEMCal);
+    AddFillStep(plan, mapping->GetTrackPtOnEMCal(),   kVarTrackPtOnEMCal);
+    AddFillStep(plan, mapping->GetITSsignal(),        kVarITSsignal);
+    AddFillStep(plan, mapping->GetTPCsignal(),        kVarTPCsignal);
+    AddFillStep(plan, mapping->GetTPCsignalTuned(),   kVarTPCsignalTuned);
+    AddFillStep(plan, mapping->GetTPCsignalN(),       kVarTPCsignalN);
+    AddFillStep(plan, mapping->GetTPCmomentum(),      kVarTPCmomentum);
+    AddFillStep(plan, mapping->GetTPCTgl(),           kVarTPCTgl);
+    AddFillStep(plan, mapping->GetTOFsignal(),        kVarTOFsignal);
+    AddFillStep(plan, mapping->GetintegratedLength(), kVarIntegratedLength);
+    AddFillStep(plan, mapping->GetTOFsignalTuned(),   kVarTOFsignalTuned);
+    AddFillStep(plan, mapping->GetHMPIDsignal(),      kVarHMPIDsignal);
+    AddFillStep(plan, mapping->GetHMPIDoccupancy(),   kVarHMPIDoccupancy);
+    AddFillStep(plan, mapping->GetTRDsignal(),        kVarTRDsignal);
+    AddFillStep(plan, mapping->GetTRDChi2(),          kVarTRDChi2);
+    AddFillStep(plan, mapping->GetTRDnSlices(),       kVarTRDnSlices);
+    AddFillStep(plan, mapping->GetTPCnclsS(),         kVarTPCnclsS);
+    AddFillStep(plan, mapping->GetFilterMap(),        kVarFilterMap);
+    AddFillStep(plan, mapping->GetTOFBunchCrossing(), kVarTOFBunchCrossing);
+    AddFillStep(plan, mapping->GetPx(),               kVarPx);
+    AddFillStep(plan, mapping->GetPy(),               kVarPy);
+    AddFillStep(plan, mapping->GetPz(),               kVarPz);
+    AddFillStep(plan, mapping->GetCovMat(0),          kVarCovMat);
+    return plan;
+  }
+}
+
+
 Int_t AliNanoAODTrack::fgPIDIndexes[ENanoPIDResponse::kLAST][AliPID::kSPECIESC] = { -1 };
+Int_t AliNanoAODTrack::fgKinIndexes[AliNanoAODTrack::kNKinIndexes] = { -1 };
+Bool_t AliNanoAODTrack::fgKinIndexesLoaded = kFALSE;
   
 //______________________________________________________________________________
 AliNanoAODTrack::AliNanoAODTrack() : 
@@ -75,55 +200,59 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
   // Create internal structure
   AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize());
 
-  for (Int_t index = 0; index<AliNanoAODTrackMapping::GetInstance()->GetSize(); index++) {
-    TString varString = AliNanoAODTrackMapping::GetInstance()->GetVarName(index);
-
-    if     (varString == "pt"                     ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()               , aodTrack->Pt()                      );
-    else if(varString == "phi"                    ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()              , aodTrack->Phi()                     );
-    else if(varString == "theta"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()            , aodTrack->Theta()                   );
-    else if(varString == "chi2perNDF"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              );  
-    else if(varString == "posx"                   ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()             , position[0]                         );
-    else if(varString == "posy"                   ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()             , position[1]                         );
-    else if(varString == "posz"                   ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ()             , position[2]                         );
-    else if(varString == "posDCAx"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()          , aodTrack->XAtDCA()                  );
-    else if(varString == "posDCAy"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()          , aodTrack->YAtDCA()                  );
-    else if(varString == "posDCAz"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAz()          , aodTrack->ZAtDCA()                  );
-    else if(varString == "pDCAx"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAX()            , aodTrack->PxAtDCA()                 );
-    else if(varString == "pDCAy"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAY()            , aodTrack->PyAtDCA()                 );
-    else if(varString == "pDCAz"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()            , aodTrack->PzAtDCA()                 );
-    else if(varString == "DCA"                    ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetDCA()              , aodTrack->DCA()                     );
-    else if(varString == "RAtAbsorberEnd"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()   , aodTrack->GetRAtAbsorberEnd()       );
-    else if(varString == "TPCncls"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()          , aodTrack->GetTPCNcls()              );
-    else if(varString == "ID"                     ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetID()               , aodTrack->GetID()                   );
-    else if(varString == "TPCnclsF"               ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF()         , aodTrack->GetTPCNclsF()             );
-    else if(varString == "TPCNCrossedRows"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows()  , aodTrack->GetTPCNCrossedRows()      );
-    else if(varString == "TrackPhiOnEMCal"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal()  , aodTrack->GetTrackPhiOnEMCal()      );
-    else if(varString == "TrackEtaOnEMCal"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal()  , aodTrack->GetTrackEtaOnEMCal()      );
-    else if(varString == "TrackPtOnEMCal"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal()   , aodTrack->GetTrackPtOnEMCal()       );
-    else if(varString == "ITSsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetITSsignal()        , aodTrack->GetITSsignal()            );
-    else if(varString == "TPCsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignal()        , aodTrack->GetTPCsignal()            );
-    else if(varString == "TPCsignalTuned"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned()   , aodTrack->GetTPCsignalTunedOnData() );
-    else if(varString == "TPCsignalN"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN()       , aodTrack->GetTPCsignalN()           );
-    else if(varString == "TPCmomentum"            ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum()      , aodTrack->GetTPCmomentum()          );
-    else if(varString == "TPCTgl"                 ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCTgl()           , aodTrack->GetTPCTgl()               );
-    else if(varString == "TOFsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignal()        , aodTrack->GetTOFsignal()            );
-    else if(varString == "integratedLength"       ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetintegratedLength() , aodTrack->GetIntegratedLength()     );
-    else if(varString == "TOFsignalTuned"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned()   , aodTrack->GetTOFsignalTunedOnData() );
-    else if(varString == "HMPIDsignal"            ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal()      , aodTrack->GetHMPIDsignal()          );
-    else if(varString == "HMPIDoccupancy"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy()   , aodTrack->GetHMPIDoccupancy()       );
-    else if(varString == "TRDsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDsignal()        , aodTrack->GetTRDsignal()            );
-    else if(varString == "TRDChi2"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDChi2()          , aodTrack->GetTRDchi2()              );
-    else if(varString == "TRDnSlices"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices()       , aodTrack->GetNumberOfTRDslices()    );  
-    else if(varString == "TPCnclsS"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS()         , aodTrack->GetTPCnclsS()             );
-    else if(varString == "FilterMap"               ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetFilterMap()        , aodTrack->GetFilterMap()            );
-    else if(varString == "TOFBunchCrossing"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFBunchCrossing() , aodTrack->GetTOFBunchCrossing()     );
-    else if(varString == "covmat0"                 ) {
+  const std::vector<AODFillStep> &plan = GetAODFillPlan();
+  for (std::vector<AODFillStep>::const_iterator step = plan.begin(); step != plan.end(); ++step) {
+    switch (step->fVar) {
+      case kVarPt:               SetVar(step->fIndex, aodTrack->Pt()); break;
+      case kVarPhi:              SetVar(step->fIndex, aodTrack->Phi()); break;
+      case kVarTheta:            SetVar(step->fIndex, aodTrack->Theta()); break;
+      case kVarChi2perNDF:       SetVar(step->fIndex, aodTrack->Chi2perNDF()); break;
+      case kVarPosx:             SetVar(step->fIndex, position[0]); break;
+      case kVarPosy:             SetVar(step->fIndex, position[1]); break;
+      case kVarPosz:             SetVar(step->fIndex, position[2]); break;
+      case kVarPosDCAx:          SetVar(step->fIndex, aodTrack->XAtDCA()); break;
+      case kVarPosDCAy:          SetVar(step->fIndex, aodTrack->YAtDCA()); break;
+      case kVarPosDCAz:          SetVar(step->fIndex, aodTrack->ZAtDCA()); break;
+      case kVarPDCAx:            SetVar(step->fIndex, aodTrack->PxAtDCA()); break;
+      case kVarPDCAy:            SetVar(step->fIndex, aodTrack->PyAtDCA()); break;
+      case kVarPDCAz:            SetVar(step->fIndex, aodTrack->PzAtDCA()); break;
+      case kVarDCA:              SetVar(step->fIndex, aodTrack->DCA()); break;
+      case kVarRAtAbsorberEnd:   SetVar(step->fIndex, aodTrack->GetRAtAbsorberEnd()); break;
+      case kVarTPCncls:          SetVar(step->fIndex, aodTrack->GetTPCNcls()); break;
+      case kVarID:               SetVar(step->fIndex, aodTrack->GetID()); break;
+      case kVarTPCnclsF:         SetVar(step->fIndex, aodTrack->GetTPCNclsF()); break;
+      case kVarTPCNCrossedRows:  SetVar(step->fIndex, aodTrack->GetTPCNCrossedRows()); break;
+      case kVarTrackPhiOnEMCal:  SetVar(step->fIndex, aodTrack->GetTrackPhiOnEMCal()); break;
+      case kVarTrackEtaOnEMCal:  SetVar(step->fIndex, aodTrack->GetTrackEtaOnEMCal()); break;
+      case kVarTrackPtOnEMCal:   SetVar(step->fIndex, aodTrack->GetTrackPtOnEMCal()); break;
+      case kVarITSsignal:        SetVar(step->fIndex, aodTrack->GetITSsignal()); break;
+      case kVarTPCsignal:        SetVar(step->fIndex, aodTrack->GetTPCsignal()); break;
+      case kVarTPCsignalTuned:   SetVar(step->fIndex, aodTrack->GetTPCsignalTunedOnData()); break;
+      case kVarTPCsignalN:       SetVar(step->fIndex, aodTrack->GetTPCsignalN()); break;
+      case kVarTPCmomentum:      SetVar(step->fIndex, aodTrack->GetTPCmomentum()); break;
+      case kVarTPCTgl:           SetVar(step->fIndex, aodTrack->GetTPCTgl()); break;
+      case kVarTOFsignal:        SetVar(step->fIndex, aodTrack->GetTOFsignal()); break;
+      case kVarIntegratedLength: SetVar(step->fIndex, aodTrack->GetIntegratedLength()); break;
+      case kVarTOFsignalTuned:   SetVar(step->fIndex, aodTrack->GetTOFsignalTunedOnData()); break;
+      case kVarHMPIDsignal:      SetVar(step->fIndex, aodTrack->GetHMPIDsignal()); break;
+      case kVarHMPIDoccupancy:   SetVar(step->fIndex, aodTrack->GetHMPIDoccupancy()); break;
+      case kVarTRDsignal:        SetVar(step->fIndex, aodTrack->GetTRDsignal()); break;
+      case kVarTRDChi2:          SetVar(step->fIndex, aodTrack->GetTRDchi2()); break;
+      case kVarTRDnSlices:       SetVar(step->fIndex, aodTrack->GetNumberOfTRDslices()); break;
+      case kVarTPCnclsS:         SetVar(step->fIndex, aodTrack->GetTPCnclsS()); break;
+      case kVarFilterMap:        SetVar(step->fIndex, aodTrack->GetFilterMap()); break;
+      case kVarTOFBunchCrossing: SetVar(step->fIndex, aodTrack->GetTOFBunchCrossing()); break;
+      case kVarPx:               SetVar(step->fIndex, aodTrack->Px()); break;
+      case kVarPy:               SetVar(step->fIndex, aodTrack->Py()); break;
+      case kVarPz:               SetVar(step->fIndex, aodTrack->Pz()); break;
+      case kVarCovMat: {
         Double_t covMatrix[21];
         aodTrack->GetCovarianceXYZPxPyPz(covMatrix);
         for(Int_t i=0;i<21;i++){
             SetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i)       , covMatrix[i]                        );
         }
-        index+=20;
+        break;
+      }
     }
   }
 
@@ -367,19 +496,20 @@ template <typename T> void AliNanoAODTrack::SetP(const T *p, const Bool_t cartes
       Double_t pt2 = p[0]*p[0] + p[1]*p[1];
       Double_t pp  = TMath::Sqrt(pt2 + p[2]*p[2]);
         
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt() ,TMath::Sqrt(pt2)); // pt
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi() , (pt2 != 0.) ? TMath::Pi()+TMath::ATan2(-p[1], -p[0]) : -999); // phi
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta() , (pp != 0.) ? TMath::ACos(p[2] / pp) : -999.); // theta
+      SetVar(KinIndex(kIdxPt) ,TMath::Sqrt(pt2)); // pt
+      SetVar(KinIndex(kIdxPhi) , (pt2 != 0.) ? TMath::Pi()+TMath::ATan2(-p[1], -p[0]) : -999); // phi
+      SetVar(KinIndex(kIdxTheta) , (pp != 0.) ? TMath::ACos(p[2] / pp) : -999.); // theta
     } else {
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()      , p[0]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
+      SetVar(KinIndex(kIdxPt)      , p[0]);  
+      SetVar(KinIndex(kIdxPhi)     , p[1]);  
+      SetVar(KinIndex(kIdxTheta)   , p[2]);  
     }
   } else {
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()      , p[0]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
+      SetVar(KinIndex(kIdxPt)      , p[0]);  
+      SetVar(KinIndex(kIdxPhi)     , p[1]);  
+      SetVar(KinIndex(kIdxTheta)   , p[2]);  
   }
+  UpdateCartesianMomentum();
 }
 
 /*
@@ -604,3 +734,83 @@ Bool_t AliNanoAODTrack::InitPIDIndex()
   return anyFilled;
 }
 
+//______________________________________________________________________________
+void AliNanoAODTrack::LoadKinIndexes()
+{
+  // The mapping is a singleton which is not changed once created,
+  // the indices are resolved the first time they are needed
+  AliNanoAODTrackMapping *mapping = AliNanoAODTrackMapping::GetInstance();
+  fgKinIndexes[kIdxPt]         = mapping->GetPt();
+  fgKinIndexes[kIdxPhi]        = mapping->GetPhi();
+  fgKinIndexes[kIdxTheta]      = mapping->GetTheta();
+  fgKinIndexes[kIdxChi2PerNDF] = mapping->GetChi2PerNDF();
+  fgKinIndexes[kIdxPx]         = mapping->GetPx();
+  fgKinIndexes[kIdxPy]         = mapping->GetPy();
+  fgKinIndexes[kIdxPz]         = mapping->GetPz();
+  fgKinIndexesLoaded = kTRUE;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::UpdateCartesianMomentum()
+{
+  // keep the stored px, py, pz (if any) in sync with pt, phi, theta
+  Int_t indexPx = KinIndex(kIdxPx);
+  Int_t indexPy = KinIndex(kIdxPy);
+  Int_t indexPz = KinIndex(kIdxPz);
+  if (indexPx < 0 && indexPy < 0 && indexPz < 0)
+    return;
+  if (KinIndex(kIdxPt) < 0 || KinIndex(kIdxPhi) < 0 || KinIndex(kIdxTheta) < 0)
+    return;
+
+  Double_t pt = GetVar(KinIndex(kIdxPt));
+  Double_t phi = GetVar(KinIndex(kIdxPhi));
+  if (indexPx >= 0) SetVar(indexPx, pt * TMath::Cos(phi));
+  if (indexPy >= 0) SetVar(indexPy, pt * TMath::Sin(phi));
+  if (indexPz >= 0) SetVar(indexPz, pt / TMath::Tan(GetVar(KinIndex(kIdxTheta))));
+}
+
+//______________________________________________________________________________
+Int_t AliNanoAODTrack::GetVarColumn(const TClonesArray *tracks, Int_t index, Float_t *values)
+{
+  // Copy one variable of all the tracks in values
+  if (!tracks)
+    return 0;
+  if (index < 0) {
+    AliErrorClass(Form("Invalid index %d, variable not in the mapping", index));
+    return 0;
+  }
+
+  const Int_t nTracks = tracks->GetEntriesFast();
+  for (Int_t i = 0; i<nTracks; i++)
+    values[i] = static_cast<const AliNanoAODTrack *>(tracks->UncheckedAt(i))->GetVar(index);
+  return nTracks;
+}
+
+//______________________________________________________________________________
+Int_t AliNanoAODTrack::GetPxPyPzColumns(const TClonesArray *tracks, Float_t *px, Float_t *py, Float_t *pz)
+{
+  // Cartesian momentum of all the tracks, copied if stored in the mapping, computed otherwise
+  if (!tracks)
+    return 0;
+
+  const Int_t nTracks = tracks->GetEntriesFast();
+  if (KinIndex(kIdxPx) >= 0 && KinIndex(kIdxPy) >= 0 && KinIndex(kIdxPz) >= 0) {
+    GetVarColumn(tracks, KinIndex(kIdxPx), px);
+    GetVarColumn(tracks, KinIndex(kIdxPy), py);
+    GetVarColumn(tracks, KinIndex(kIdxPz), pz);
+    return nTracks;
+  }
+
+  const Int_t indexPt = KinIndex(kIdxPt);
+  const Int_t indexPhi = KinIndex(kIdxPhi);
+  const Int_t indexTheta = KinIndex(kIdxTheta);
+  for (Int_t i = 0; i<nTracks; i++) {
+    const AliNanoAODTrack *track = static_cast<const AliNanoAODTrack *>(tracks->UncheckedAt(i));
+    Double_t pt = track->GetVar(indexPt);
+    Double_t phi = track->GetVar(indexPhi);
+    px[i] = pt * TMath::Cos(phi);
+    py[i] = pt * TMath::Sin(phi);
+    pz[i] = pt / TMath::Tan(track->GetVar(indexTheta));
+  }
+  return nTracks;
+}
@@ -65,6 +65,7 @@ class AliTPCdEdxInfo;
 class AliAODEvent;
 class AliAODTrack;
 class AliESDTrack;
+class TClonesArray;
 
 class AliNanoAODTrack : public AliVTrack, public AliNanoAODStorage {
 
@@ -109,13 +110,14 @@ public:
   
   // kinematics
   virtual Double_t OneOverPt() const { return (Pt() != 0.) ? 1./Pt() : -999.; }
-  virtual Double_t Phi()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi());   }
-  virtual Double_t Theta()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()); }
+  virtual Double_t Phi()       const { return GetVar(KinIndex(kIdxPhi));   }
+  virtual Double_t Theta()     const { return GetVar(KinIndex(kIdxTheta)); }
   
-  virtual Double_t Px() const { return Pt() * TMath::Cos(Phi()); }
-  virtual Double_t Py() const { return Pt() * TMath::Sin(Phi()); }
-  virtual Double_t Pz() const { return Pt() / TMath::Tan(Theta()); }
-  virtual Double_t Pt() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()); }
+  // px, py, pz are taken from the mapping if stored, computed from pt, phi, theta otherwise
+  virtual Double_t Px() const { Int_t index = KinIndex(kIdxPx); return index >= 0 ? GetVar(index) : Pt() * TMath::Cos(Phi()); }
+  virtual Double_t Py() const { Int_t index = KinIndex(kIdxPy); return index >= 0 ? GetVar(index) : Pt() * TMath::Sin(Phi()); }
+  virtual Double_t Pz() const { Int_t index = KinIndex(kIdxPz); return index >= 0 ? GetVar(index) : Pt() / TMath::Tan(Theta()); }
+  virtual Double_t Pt() const { return GetVar(KinIndex(kIdxPt)); }
   virtual Double_t P()  const { return TMath::Sqrt(Pt()*Pt()+Pz()*Pz()); }
   virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
 
@@ -124,7 +126,7 @@ public:
   virtual Double_t Zv() const { return GetProdVertex() ? GetProdVertex()->GetZ() : -999.; }
   virtual Bool_t   XvYvZv(Double_t x[3]) const { x[0] = Xv(); x[1] = Yv(); x[2] = Zv(); return kTRUE; }
 
-  Double_t Chi2perNDF()  const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()); }  
+  Double_t Chi2perNDF()  const { return GetVar(KinIndex(kIdxChi2PerNDF)); }  
   virtual UShort_t GetTPCncls(Int_t /*row0*/=0, Int_t /*row1*/=159)  const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()); }
   virtual UShort_t GetTPCNcls()  const { return GetTPCncls(); }
 
@@ -335,10 +337,10 @@ public:
 
 
 
-  void SetOneOverPt(Double_t oneOverPt) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPt()] = 1. / oneOverPt; }
-  void SetPt(Double_t pt) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPt()] = pt; };
-  void SetPhi(Double_t phi) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPhi()] = phi; }
-  void SetTheta(Double_t theta) { fVars[AliNanoAODTrackMapping::GetInstance()->GetTheta()] = theta; }
+  void SetOneOverPt(Double_t oneOverPt) { fVars[KinIndex(kIdxPt)] = 1. / oneOverPt; UpdateCartesianMomentum(); }
+  void SetPt(Double_t pt) { fVars[KinIndex(kIdxPt)] = pt; UpdateCartesianMomentum(); };
+  void SetPhi(Double_t phi) { fVars[KinIndex(kIdxPhi)] = phi; UpdateCartesianMomentum(); }
+  void SetTheta(Double_t theta) { fVars[KinIndex(kIdxTheta)] = theta; UpdateCartesianMomentum(); }
   template <typename T> void SetP(const T *p, Bool_t cartesian = kTRUE);// TODO: WHAT IS THIS FOR?
   void SetP() {AliFatal("Not Implemented");}
 
@@ -346,7 +348,7 @@ public:
   void SetPxPyPzAtDCA(Double_t pX, Double_t pY, Double_t pZ) {fVars[AliNanoAODTrackMapping::GetInstance()->GetPDCAX()] = pX; fVars[AliNanoAODTrackMapping::GetInstance()->GetPDCAY()] = pY; fVars[AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()] = pZ;}
   
   void SetRAtAbsorberEnd(Double_t r) { fVars[AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()] = r; }
-  void SetChi2perNDF(Double_t chi2perNDF) { fVars[AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()] = chi2perNDF; }
+  void SetChi2perNDF(Double_t chi2perNDF) { fVars[KinIndex(kIdxChi2PerNDF)] = chi2perNDF; }
 
   // void SetITSClusterMap(UChar_t itsClusMap)                 { fITSMuonClusterMap = (fITSMuonClusterMap&0xffffff00)|(((UInt_t)itsClusMap)&0xff); }
   // void SetHitsPatternInTrigCh(UShort_t hitsPatternInTrigCh) { fITSMuonClusterMap = (fITSMuonClusterMap&0xffff00ff)|((((UInt_t)hitsPatternInTrigCh)&0xff)<<8); }
@@ -383,13 +385,35 @@ public:
   static const char* GetPIDVarName(ENanoPIDResponse r, AliPID::EParticleType p) {  return Form("PID.%d.%s", r, AliPID::ParticleShortName(p)); }
   static Bool_t InitPIDIndex();
 
+  // Columnar access: fill values[i] for all the tracks of the array (AliNanoAODTrack only),
+  // values must hold tracks->GetEntriesFast() entries. Return the number of tracks filled
+  static Int_t GetVarColumn(const TClonesArray *tracks, Int_t index, Float_t *values);
+  static Int_t GetPtColumn(const TClonesArray *tracks, Float_t *pt)       { return GetVarColumn(tracks, KinIndex(kIdxPt), pt);       }
+  static Int_t GetPhiColumn(const TClonesArray *tracks, Float_t *phi)     { return GetVarColumn(tracks, KinIndex(kIdxPhi), phi);     }
+  static Int_t GetThetaColumn(const TClonesArray *tracks, Float_t *theta) { return GetVarColumn(tracks, KinIndex(kIdxTheta), theta); }
+  static Int_t GetPxPyPzColumns(const TClonesArray *tracks, Float_t *px, Float_t *py, Float_t *pz);
+
 
   /// NanoAOD information that cannot be retrieved with the same interface of AliAODtrack
   bool   IsTRDrefit() { return fNanoFlags & ENanoFlags::kTRDrefit; }
 
 private :
 
+  /// Indices of the kinematic variables, resolved once from the mapping
+  enum EKinIndex {
+    kIdxPt = 0,
+    kIdxPhi,
+    kIdxTheta,
+    kIdxChi2PerNDF,
+    kIdxPx,
+    kIdxPy,
+    kIdxPz,
+    kNKinIndexes
+  };
 
+  static Int_t KinIndex(EKinIndex var) { if (!fgKinIndexesLoaded) LoadKinIndexes(); return fgKinIndexes[var]; }
+  static void  LoadKinIndexes();
+  void UpdateCartesianMomentum();
 
   // Momentum & position
   // FIXME: the following was replaced by posx, posy, posz. Check if the names make sense
@@ -399,6 +423,8 @@ private :
   UInt_t        fNanoFlags;  // nano flags
   
   static Int_t fgPIDIndexes[ENanoPIDResponse::kLAST][AliPID::kSPECIESC];
+  static Int_t fgKinIndexes[kNKinIndexes]; ///< mapping indices of the kinematic variables
+  static Bool_t fgKinIndexesLoaded;        ///< fgKinIndexes filled from the mapping
   
   const AliAODEvent* fAODEvent;     //! 
 
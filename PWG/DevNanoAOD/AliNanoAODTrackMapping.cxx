@@ -36,6 +36,7 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping() :
   fTPCNCrossedRows(-1), 
   fTrackPhiOnEMCal(-1), 
   fTrackEtaOnEMCal(-1), 
+  fTrackPtOnEMCal(-1),
   fITSsignal(-1),	  
   fTPCsignal(-1),	  
   fTPCsignalTuned(-1),  
@@ -58,7 +59,10 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping() :
   fcovmat{-1},
   fTOFchi2{-1},
   fTOFsignalDz{-1},
-  fTOFsignalDx{-1}
+  fTOFsignalDx{-1},
+  fPx(-1),
+  fPy(-1),
+  fPz(-1)
 { 
   /// default ctor
 
@@ -90,6 +94,7 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
   fTPCNCrossedRows(-1), 
   fTrackPhiOnEMCal(-1), 
   fTrackEtaOnEMCal(-1), 
+  fTrackPtOnEMCal(-1),
   fITSsignal(-1),	  
   fTPCsignal(-1),	  
   fTPCsignalTuned(-1),  
@@ -112,7 +117,10 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
   fcovmat{-1},
   fTOFchi2{-1},
   fTOFsignalDz{-1},
-  fTOFsignalDx{-1}
+  fTOFsignalDx{-1},
+  fPx(-1),
+  fPy(-1),
+  fPz(-1)
 {
   /// ctor
 
@@ -189,6 +197,9 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
     else if(var == "TOFchi2"          ) fTOFchi2           = index++;
     else if(var == "TOFsignalDz"      ) fTOFsignalDz       = index++;
     else if(var == "TOFsignalDx"      ) fTOFsignalDx       = index++;
+    else if(var == "px"               ) fPx                = index++;
+    else if(var == "py"               ) fPy                = index++;
+    else if(var == "pz"               ) fPz                = index++;
 
     else if (var.BeginsWith("cst") || var.BeginsWith("PID.")) {
       Info("AliNanoAODTrackMapping::AliNanoAODTrackMapping", "ADDING %i %i %s",index,fMapCstVar[var],var.Data());
@@ -250,6 +261,9 @@ Int_t AliNanoAODTrackMapping::GetVarIndex(TString varName){
     else if(varName == "TOFchi2"          ) return fTOFchi2          ;
     else if(varName == "TOFsignalDz"      ) return fTOFsignalDz      ;
     else if(varName == "TOFsignalDx"      ) return fTOFsignalDx      ;
+    else if(varName == "px"               ) return fPx               ;
+    else if(varName == "py"               ) return fPy               ;
+    else if(varName == "pz"               ) return fPz               ;
 
     std::map<TString,Int_t>::iterator it = fMapCstVar.find(varName); // FIXME: do I need to delete "it"?
     if(it != fMapCstVar.end()) {
@@ -308,6 +322,9 @@ const char * AliNanoAODTrackMapping::GetVarName(Int_t index) const {
     else if(index == fTOFchi2          )  return "TOFchi2"          ;
     else if(index == fTOFsignalDz      )  return "TOFsignalDz"      ;
     else if(index == fTOFsignalDx      )  return "TOFsignalDx"      ;
+    else if(index == fPx               )  return "px"               ;
+    else if(index == fPy               )  return "py"               ;
+    else if(index == fPz               )  return "pz"               ;
     
     for (Int_t i=0; i<21; i++){
         
@@ -83,6 +83,10 @@ public:
   Int_t GetTOFchi2()          const { return fTOFchi2;          }
   Int_t GetTOFsignalDz()      const { return fTOFsignalDz;      }
   Int_t GetTOFsignalDx()      const { return fTOFsignalDx;      }
+  //  Optional cartesian momentum, saves the trigonometry in Px(), Py(), Pz()
+  Int_t GetPx()               const { return fPx;               }
+  Int_t GetPy()               const { return fPy;               }
+  Int_t GetPz()               const { return fPz;               }
   
 
 
@@ -138,11 +142,14 @@ private:
   Int_t fTOFchi2;  ///< Mapping variables
   Int_t fTOFsignalDz;  ///< Mapping variables 
   Int_t fTOFsignalDx;  ///< Mapping variables
+  Int_t fPx;           ///< Mapping variable (optional)
+  Int_t fPy;           ///< Mapping variable (optional)
+  Int_t fPz;           ///< Mapping variable (optional)
 
   static AliNanoAODTrackMapping * fInstance; ///< instance, needed for the singleton implementation
   static TString fMappingString; ///< the string which this class was initialized with
   std::map<TString,int> fMapCstVar;// Map of indexes of custom variables: CACHE THIS TO CONST INTs IN YOUR TASK TO AVOID CONTINUOUS STRING COMPARISONS
-  ClassDef(AliNanoAODTrackMapping, 2)
+  ClassDef(AliNanoAODTrackMapping, 3)
   
 };
 
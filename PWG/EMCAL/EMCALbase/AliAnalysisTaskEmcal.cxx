@@ -25,6 +25,8 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
 #include <RVersion.h>
+#include <chrono>
+#include <ctime>
 #include <iostream>
 #include <memory>
 
@@ -33,6 +35,7 @@
 #include <TObject.h>
 #include <TObjString.h>
 #include <TH1F.h>
+#include <TH2D.h>
 #include <TProfile.h>
 #include <TSystem.h>
 #include <TFile.h>
@@ -134,6 +137,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fPtHardAndJetPtFactor(0.),
   fPtHardAndClusterPtFactor(0.),
   fPtHardAndTrackPtFactor(0.),
+  fUseStageProfiler(kFALSE),
   fRunNumber(-1),
   fAliEventCuts(kFALSE),
   fAliAnalysisUtils(nullptr),
@@ -180,7 +184,12 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fHistEventPlane(nullptr),
   fHistEventRejection(nullptr),
   fHistTriggerClasses(nullptr),
-  fHistTriggerClassesCorr(nullptr)
+  fHistTriggerClassesCorr(nullptr),
+  fHistStageProfile(nullptr),
+  fStageWallMark(0.),
+  fStageCpuMark(0.),
+  fTrigClassSelection(),
+  fTrigClassTokens()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -251,6 +260,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fPtHardAndJetPtFactor(0.),
   fPtHardAndClusterPtFactor(0.),
   fPtHardAndTrackPtFactor(0.),
+  fUseStageProfiler(kFALSE),
   fRunNumber(-1),
   fAliEventCuts(kFALSE),
   fAliAnalysisUtils(nullptr),
@@ -297,7 +307,12 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fHistEventPlane(nullptr),
   fHistEventRejection(nullptr),
   fHistTriggerClasses(nullptr),
-  fHistTriggerClassesCorr(nullptr)
+  fHistTriggerClassesCorr(nullptr),
+  fHistStageProfile(nullptr),
+  fStageWallMark(0.),
+  fStageCpuMark(0.),
+  fTrigClassSelection(),
+  fTrigClassTokens()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -392,6 +407,17 @@ void AliAnalysisTaskEmcal::UserCreateOutputObjects()
   if (fForceBeamType == kpp)
     fNcentBins = 1;
 
+  if (fUseStageProfiler) {
+    // Double precision needed to accumulate small per-event times over many events
+    fHistStageProfile = new TH2D("fHistStageProfile", "Calls and time per stage of UserExec", kNStageProfile, 0, kNStageProfile, 3, 0, 3);
+    const char *stagenames[kNStageProfile] = {"ExecOnce", "RetrieveEventObjects", "Bookkeeping", "IsEventSelected", "FillGeneralHistograms", "Run", "FillHistograms"};
+    for (Int_t istage = 0; istage < kNStageProfile; istage++) fHistStageProfile->GetXaxis()->SetBinLabel(istage + 1, stagenames[istage]);
+    fHistStageProfile->GetYaxis()->SetBinLabel(1, "Calls");
+    fHistStageProfile->GetYaxis()->SetBinLabel(2, "Wall time (s)");
+    fHistStageProfile->GetYaxis()->SetBinLabel(3, "CPU time (s)");
+    fOutput->Add(fHistStageProfile);
+  }
+
   if (!fGeneralHistograms)
     return;
 
@@ -612,6 +638,8 @@ Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
 
 void AliAnalysisTaskEmcal::UserExec(Option_t *option)
 {
+  StartStageProfile();
+
   // Recycle embedded events which do not pass the internal event selection in the embedding helper
   if (fRecycleUnusedEmbeddedEventsMode) {
     auto embeddingHelper = AliAnalysisTaskEmcalEmbeddingHelper::GetInstance();
@@ -620,6 +648,7 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
         fHistEventRejection->Fill("RecycleEmbeddedEvent",1);
         fHistEventCount->Fill("Rejected",1);
       }
+      ProfileStage(kStageBookkeeping);
       return;
     }
   }
@@ -627,6 +656,7 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
   if (!fLocalInitialized){
     ExecOnce();
     UserExecOnce();
+    ProfileStage(kStageExecOnce);
   }
 
   if (!fLocalInitialized)
@@ -635,9 +665,12 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
   if(fFileChanged){
     FileChanged();
     fFileChanged = kFALSE;
+    ProfileStage(kStageBookkeeping);
   }
 
-  if (!RetrieveEventObjects())
+  Bool_t retrieved = RetrieveEventObjects();
+  ProfileStage(kStageRetrieveEventObjects);
+  if (!retrieved)
     return;
 
   if(InputEvent()->GetRunNumber() != fRunNumber){
@@ -664,8 +697,11 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
     */
     fHistXsection->Fill(fPtHardBinGlobal, fPythiaHeader->GetXsection());
   }
+  ProfileStage(kStageBookkeeping);
 
-  if (IsEventSelected()) {
+  Bool_t selected = IsEventSelected();
+  ProfileStage(kStageIsEventSelected);
+  if (selected) {
     if (fGeneralHistograms) fHistEventCount->Fill("Accepted",1);
   }
   else {
@@ -674,24 +710,50 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
   }
 
   if (fGeneralHistograms && fCreateHisto) {
-    if (!FillGeneralHistograms())
+    Bool_t filled = FillGeneralHistograms();
+    ProfileStage(kStageFillGeneralHistograms);
+    if (!filled)
       return;
   }
 
-  if (!Run())
+  Bool_t processed = Run();
+  ProfileStage(kStageRun);
+  if (!processed)
     return;
 
   if (fCreateHisto) {
-    if (!FillHistograms())
+    Bool_t filled = FillHistograms();
+    ProfileStage(kStageFillHistograms);
+    if (!filled)
       return;
   }
 
   if (fCreateHisto && fOutput) {
     // information for this iteration of the UserExec in the container
     PostData(1, fOutput);
+    ProfileStage(kStageBookkeeping);
   }
 }
 
+void AliAnalysisTaskEmcal::StartStageProfile()
+{
+  if (!fHistStageProfile) return;
+  fStageWallMark = std::chrono::duration<Double_t>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  fStageCpuMark = static_cast<Double_t>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+void AliAnalysisTaskEmcal::ProfileStage(EStageProfile_t stage)
+{
+  if (!fHistStageProfile) return;
+  Double_t wall = std::chrono::duration<Double_t>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  Double_t cpu = static_cast<Double_t>(std::clock()) / CLOCKS_PER_SEC;
+  fHistStageProfile->Fill(stage, 0.5);
+  fHistStageProfile->Fill(stage, 1.5, wall - fStageWallMark);
+  fHistStageProfile->Fill(stage, 2.5, cpu - fStageCpuMark);
+  fStageWallMark = wall;
+  fStageCpuMark = cpu;
+}
+
 Bool_t AliAnalysisTaskEmcal::AcceptCluster(AliVCluster *clus, Int_t c) const
 {
   AliWarning("AliAnalysisTaskEmcal::AcceptCluster method is deprecated. Please use GetCusterContainer(c)->AcceptCluster(clus).");
@@ -1288,15 +1350,21 @@ Bool_t AliAnalysisTaskEmcal::IsTriggerSelected(){
     TString fired = InputEvent()->GetFiredTriggerClasses();
     if (!fired.Contains("-B-")) return kFALSE;
 
-    std::unique_ptr<TObjArray> arr(fTrigClass.Tokenize("|"));
-    if (!arr) return kFALSE;
+    // Split the selection only when it changes
+    if (fTrigClass != fTrigClassSelection) {
+      fTrigClassTokens.clear();
+      std::unique_ptr<TObjArray> arr(fTrigClass.Tokenize("|"));
+      if (arr) {
+        for (Int_t i=0;i<arr->GetEntriesFast();++i) {
+          TObject *obj = arr->At(i);
+          if (obj) fTrigClassTokens.push_back(obj->GetName());
+        }
+      }
+      fTrigClassSelection = fTrigClass;
+    }
     Bool_t match = false;
-    for (Int_t i=0;i<arr->GetEntriesFast();++i) {
-      TObject *obj = arr->At(i);
-      if (!obj) continue;
-
+    for (const TString &objStr : fTrigClassTokens) {
       //Check if requested trigger was fired
-      TString objStr = obj->GetName();
       if(fEMCalTriggerMode == kOverlapWithLowThreshold &&
           (objStr.Contains("J1") || objStr.Contains("J2") || objStr.Contains("G1") || objStr.Contains("G2"))) {
         // This is relevant for EMCal triggers with 2 thresholds
@@ -1318,7 +1386,7 @@ Bool_t AliAnalysisTaskEmcal::IsTriggerSelected(){
       else {
         // If this is not an EMCal trigger, or no particular treatment of EMCal triggers was requested,
         // simply check that the trigger was fired
-        if (fired.Contains(obj->GetName())) {
+        if (fired.Contains(objStr)) {
           match = 1;
           break;
         }
@@ -35,6 +35,7 @@
 #include <TH1F.h>
 #include <TRandom3.h>
 #include <TList.h>
+#include <TEnv.h>
 
 #include <AliLog.h>
 #include <AliAnalysisManager.h>
@@ -126,6 +127,9 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPtHardBin(-1),
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
+  fStageEmbeddedEvents(false),
+  fStagingWindow(100),
+  fEmbeddedEventReuse(1),
   fCreateHisto(true),
   fYAMLConfig(),
   fUseInternalEventSelection(false),
@@ -156,6 +160,10 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fLowerEntry(0),
   fUpperEntry(0),
   fOffset(0),
+  fStagedLowerEntry(0),
+  fStagedUpperEntry(0),
+  fEmbeddedEventUses(0),
+  fEmbeddedEventEntry(-1),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
   fHistManager(),
@@ -200,6 +208,9 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPtHardBin(-1),
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
+  fStageEmbeddedEvents(false),
+  fStagingWindow(100),
+  fEmbeddedEventReuse(1),
   fCreateHisto(true),
   fYAMLConfig(),
   fUseInternalEventSelection(false),
@@ -230,6 +241,10 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fLowerEntry(0),
   fUpperEntry(0),
   fOffset(0),
+  fStagedLowerEntry(0),
+  fStagedUpperEntry(0),
+  fEmbeddedEventUses(0),
+  fEmbeddedEventEntry(-1),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
   fHistManager(name),
@@ -326,6 +341,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("ptHardBin", fPtHardBin, false);
   res = fYAMLConfig.GetProperty("randomEventNumberAccess", fRandomEventNumberAccess, false);
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
+  res = fYAMLConfig.GetProperty("stageEmbeddedEvents", fStageEmbeddedEvents, false);
+  res = fYAMLConfig.GetProperty("stagingWindow", fStagingWindow, false);
+  res = fYAMLConfig.GetProperty("embeddedEventReuse", fEmbeddedEventReuse, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
   res = fYAMLConfig.GetProperty("printTimingInfoInLog", fPrintTimingInfoToLog, false);
   // More general embedding helper properties
@@ -844,6 +862,11 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       InitTree();
     }
 
+    // Move the staged window if the entry is outside of it
+    if (fStageEmbeddedEvents && (fCurrentEntry < fStagedLowerEntry || fCurrentEntry >= fStagedUpperEntry)) {
+      StageEmbeddedEvents();
+    }
+
     // Load current event
     // Can be a simple less than, because fFileNumber counts from 0.
     if (fFileNumber < fMaxNumberOfFiles) {
@@ -1235,6 +1258,13 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserCreateOutputObjects()
     histInternalEventCutsStats->GetYaxis()->SetTitle("Number of selected events");
   }
   
+  // Number of internal events each embedded event was used for
+  if (fEmbeddedEventReuse > 1) {
+    histName = "fHistEmbeddedEventUses";
+    histTitle = "Number of internal events each embedded event was used for;Number of internal events;Counts";
+    fHistManager.CreateTH1(histName, histTitle, fEmbeddedEventReuse, 0.5, fEmbeddedEventReuse + 0.5);
+  }
+
   // Time to execute InitTree()
   if (fPrintTimingInfoToLog) {
     histName = "fInitTreeCPUtime";
@@ -1323,6 +1353,9 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::SetupInputFiles()
     AliErrorStream() << "Number of input files (" << fFilenames.size() << ") is larger than the number of available files (" << fMaxNumberOfFiles << "). Something went wrong when adding some of those files to the TChain!\n";
   }
 
+  // Setup staging before any file of the chain is opened
+  SetupEmbeddedEventStaging();
+
   // Setup input event
   Bool_t res = InitEvent();
   if (!res) return kFALSE;
@@ -1461,6 +1494,16 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // Sets which entry to start if the try
   fCurrentEntry = fLowerEntry + fOffset;
 
+  // Size the cache for the window of staged events in the new tree and stage the first window
+  if (fStageEmbeddedEvents) {
+    Long64_t nEntries = fChain->GetTree()->GetEntries();
+    Long64_t cacheSize = nEntries > 0 ? 1.1 * fChain->GetTree()->GetZipBytes() / nEntries * fStagingWindow : 0;
+    fChain->SetCacheSize(TMath::Max(cacheSize, static_cast<Long64_t>(1 << 20)));
+    fChain->AddBranchToCache("*", kTRUE);
+    fChain->StopCacheLearningPhase();
+    StageEmbeddedEvents();
+  }
+
   // Keep track of the number of files that we have gone through
   // To start from 0, we only increment if fLowerEntry > 0
   if (fLowerEntry > 0) {
@@ -1510,6 +1553,44 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
 
 }
 
+/**
+ * Setup the staging of the embedded events, if enabled. Must be called before the files of the
+ * chain are opened.
+ *
+ * The staging relies on the tree cache: the compressed data of the entries of the staged window is
+ * read ahead by the asynchronous prefetching thread of TFile, and the baskets in the cache are
+ * decompressed in parallel by TTreeCacheUnzip. Accessing any entry of the window is then served
+ * from memory.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetupEmbeddedEventStaging()
+{
+  if (!fStageEmbeddedEvents) return;
+
+  if (fStagingWindow < 1) {
+    AliWarningStream() << "Staging window of " << fStagingWindow << " events is not valid. Staging one event at a time.\n";
+    fStagingWindow = 1;
+  }
+
+  AliInfo(TString::Format("Staging the embedded events in windows of %d events.", fStagingWindow));
+  gEnv->SetValue("TFile.AsyncPrefetching", 1);
+  fChain->SetParallelUnzip(kTRUE);
+  fStagedLowerEntry = 0;
+  fStagedUpperEntry = 0;
+}
+
+/**
+ * Stage the window of embedded events starting at the current entry, up to the end of the current tree.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::StageEmbeddedEvents()
+{
+  fStagedLowerEntry = fCurrentEntry;
+  fStagedUpperEntry = TMath::Min(fCurrentEntry + fStagingWindow, fUpperEntry);
+  AliDebugStream(3) << "Staging embedded events " << fStagedLowerEntry << "-" << fStagedUpperEntry << ".\n";
+
+  // The last entry of the range is included
+  fChain->SetCacheEntryRange(fStagedLowerEntry, fStagedUpperEntry - 1);
+}
+
 /**
  * Extract pythia information from a cross section file. Modified from AliAnalysisTaskEmcal::PythiaInfoFromFile().
  *
@@ -1650,6 +1731,24 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserExec(Option_t*)
     }
   }
 
+  // Reuse the current embedded event if it was not used for the requested number of internal events yet.
+  // The selection has to be checked again, since it depends on the vertex of the internal event.
+  // The entry is read again, since the tasks using the embedded event modify its objects in place
+  // (e.g. the cell corrections recalibrate the cells). The staged cache still holds the entry.
+  if (fEmbeddedEventUses > 0 && fEmbeddedEventUses < fEmbeddedEventReuse && CheckIsEmbeddedEventSelected()) {
+    fChain->GetEntry(fEmbeddedEventEntry);
+    SetEmbeddedEventProperties();
+    fEmbeddedEventUses++;
+    if (fCreateHisto && fOutput) {
+      PostData(1, fOutput);
+    }
+    return;
+  }
+  if (fCreateHisto && fEmbeddedEventReuse > 1 && fEmbeddedEventUses > 0) {
+    fHistManager.FillTH1("fHistEmbeddedEventUses", fEmbeddedEventUses);
+  }
+  fEmbeddedEventUses = 0;
+
   if (!fInitializedNewFile) {
     InitTree();
   }
@@ -1660,6 +1759,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserExec(Option_t*)
     AliError("Unable to get the event to embed. Nothing will be embedded.");
     return;
   }
+  fEmbeddedEventUses = 1;
+  // GetNextEntry() has already moved on to the next entry
+  fEmbeddedEventEntry = fCurrentEntry - 1;
 
   if (fCreateHisto && fOutput) {
     PostData(1, fOutput);
@@ -1882,6 +1984,9 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
+  tempSS << "Stage embedded events: " << fStageEmbeddedEvents << "\n";
+  tempSS << "Staging window: " << fStagingWindow << "\n";
+  tempSS << "Embedded event reuse: " << fEmbeddedEventReuse << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
   tempSS << "Number of files to embed: " << fFilenames.size() << "\n";
   tempSS << "YAML configuration path: \"" << fConfigurationPath << "\"\n";
@@ -51,6 +51,8 @@ class AliEmcalList;
  *   the "internal" event provided by the analysis manager
  * - Provide a public method GetExternalEvent() that allows to retrieve a pointer to
  *   the external event.
+ * - Optionally preload windows of embedded events into memory and use each embedded
+ *   event for several internal events (see SetStageEmbeddedEvents() and SetEmbeddedEventReuse()).
  *
  * Note that only one instance of this class is allowed in each train (singleton class).
  *
@@ -111,6 +113,9 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   TString GetTreeName()                                     const { return fTreeName; }
   Bool_t GetRandomEventNumberAccess()                       const { return fRandomEventNumberAccess; }
   Bool_t GetRandomFileAccess()                              const { return fRandomFileAccess; }
+  bool GetStageEmbeddedEvents()                             const { return fStageEmbeddedEvents; }
+  Int_t GetStagingWindow()                                  const { return fStagingWindow; }
+  Int_t GetEmbeddedEventReuse()                             const { return fEmbeddedEventReuse; }
   TString GetFilePattern()                                  const { return fFilePattern; }
   TString GetInputFilename()                                const { return fInputFilename; }
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
@@ -135,6 +140,14 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetRandomEventNumberAccess(Bool_t b)                       { fRandomEventNumberAccess = b; }
   /// Randomly select the first file to embed from the file list. Continues sequentially afterwards
   void SetRandomFileAccess(Bool_t b)                              { fRandomFileAccess = b; }
+  /**
+   * Preload the embedded events in windows of a given number of entries. The compressed data of the
+   * window is read ahead by a helper thread and decompressed by helper threads, such that the entries
+   * of the window are then accessed from memory.
+   */
+  void SetStageEmbeddedEvents(bool b = true, Int_t window = 100)  { fStageEmbeddedEvents = b; fStagingWindow = window; }
+  /// Use each embedded event for n consecutive internal events
+  void SetEmbeddedEventReuse(Int_t n)                             { fEmbeddedEventReuse = n; }
   /// Sets the file pattern to select AliEn files. This pattern is used as input to the alien_find command.
   void SetFilePattern(const char * pattern)                       { fFilePattern = pattern; }
   /**
@@ -299,6 +312,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          CheckIsEmbeddedEventSelected();
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            SetupEmbeddedEventStaging();
+  void            StageEmbeddedEvents() ;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   // Validation helper
   void            ValidatePhysicsSelectionForInternalEventSelection();
@@ -324,6 +339,9 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fPtHardBin        ; ///<  ptHard bin for the given pythia production
   Bool_t                                        fRandomEventNumberAccess; ///<  If true, it will start embedding from a random entry in the file rather than from the first
   Bool_t                                        fRandomFileAccess ; ///<  If true, it will start embedding from a random file in the input files list
+  bool                                          fStageEmbeddedEvents; ///<  If true, windows of embedded events are preloaded into memory by helper threads
+  Int_t                                         fStagingWindow    ; ///<  Number of embedded events preloaded at once if staging is enabled
+  Int_t                                         fEmbeddedEventReuse; ///<  Number of internal events each embedded event is used for
   bool                                          fCreateHisto      ; ///<  If true, create QA histograms
   PWG::Tools::AliYAMLConfiguration              fYAMLConfig       ; ///<  Hanldes configuration from YAML
 
@@ -358,6 +376,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fLowerEntry       ; //!<! First entry of the current tree to be used for embedding
   Int_t                                         fUpperEntry       ; //!<! Last entry of the current tree to be used for embedding
   Int_t                                         fOffset           ; //!<! Offset from fLowerEntry where the loop over the tree should start
+  Int_t                                         fStagedLowerEntry ; //!<! First entry of the window of staged embedded events
+  Int_t                                         fStagedUpperEntry ; //!<! Entry after the last entry of the window of staged embedded events
+  Int_t                                         fEmbeddedEventUses; //!<! Number of internal events the current embedded event was used for
+  Int_t                                         fEmbeddedEventEntry; //!<! Entry of the current embedded event, read again for each reuse
   UInt_t                                        fMaxNumberOfFiles ; //!<! Max number of files that are in the TChain
   UInt_t                                        fFileNumber       ; //!<! File number corresponding to the current tree
   THistManager                                  fHistManager      ; ///< Manages access to all histograms
@@ -382,7 +404,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 12);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 14);
   /// \endcond
 };
 #endif
@@ -0,0 +1,180 @@
+/**************************************************************************
+ * Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- standard c ---
+#include <algorithm>
+#include <climits>
+
+// --- Root ---
+#include <TMath.h>
+#include <TObjArray.h>
+
+// --- AliRoot ---
+#include "AliVCluster.h"
+
+#include "AliEMCALClusterGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEMCALClusterGrid) ;
+/// \endcond
+
+namespace {
+  /// Offset making the cell coordinates positive, 21 bits per coordinate in the key
+  const Long64_t kCellOffset = 1 << 20;
+  /// Above this number of cells per query a linear scan is faster
+  const Int_t kMaxCellsPerQuery = 125;
+}
+
+///
+/// Constructor.
+//_______________________________________________________
+AliEMCALClusterGrid::AliEMCALClusterGrid() :
+  TObject(),
+  fCellSize(100.),
+  fEntries(),
+  fIsBuilt(kFALSE)
+{
+}
+
+///
+/// Remove all clusters and set the cell size.
+/// The cell size should be the matching window used in the queries.
+///
+/// \param cellSize: size of the cells in cm
+//_______________________________________________________
+void AliEMCALClusterGrid::Reset(Double_t cellSize)
+{
+  fCellSize = cellSize > 1. ? cellSize : 1.;
+  fEntries.clear();
+  fIsBuilt = kFALSE;
+}
+
+///
+/// Add a cluster to the grid. Build() has to be called once all clusters are added.
+///
+/// \param index: index of the cluster, returned by FindClusters()
+/// \param pos: global position of the cluster as given by AliVCluster::GetPosition()
+//_______________________________________________________
+void AliEMCALClusterGrid::AddCluster(Int_t index, const Float_t pos[3])
+{
+  Entry entry;
+  entry.fCell  = GetCellKey(GetCell(pos[0]), GetCell(pos[1]), GetCell(pos[2]));
+  entry.fIndex = index;
+  entry.fPos[0] = pos[0];
+  entry.fPos[1] = pos[1];
+  entry.fPos[2] = pos[2];
+  fEntries.push_back(entry);
+  fIsBuilt = kFALSE;
+}
+
+///
+/// Add all clusters of an array to the grid, with their index in the array.
+/// Empty slots are skipped. Build() has to be called once all clusters are added.
+///
+/// \param clusterArr: array of AliVCluster
+/// \param onlyEMCAL: skip clusters which are not EMCal clusters
+//_______________________________________________________
+void AliEMCALClusterGrid::AddClusters(const TObjArray *clusterArr, Bool_t onlyEMCAL)
+{
+  if (!clusterArr) return;
+
+  Float_t clsPos[3] = {0.,0.,0.};
+  for (Int_t icl = 0; icl < clusterArr->GetEntriesFast(); icl++)
+  {
+    AliVCluster *cluster = dynamic_cast<AliVCluster*> (clusterArr->At(icl));
+    if (!cluster) continue;
+    if (onlyEMCAL && !cluster->IsEMCAL()) continue;
+
+    cluster->GetPosition(clsPos);
+    AddCluster(icl, clsPos);
+  }
+}
+
+///
+/// Sort the clusters by cell, to be called after adding the clusters and before the queries.
+//_______________________________________________________
+void AliEMCALClusterGrid::Build()
+{
+  std::sort(fEntries.begin(), fEntries.end());
+  fIsBuilt = kTRUE;
+}
+
+///
+/// Find the clusters within a distance from a position.
+///
+/// \param pos: global position, usually of the track extrapolated to the calorimeter surface
+/// \param window: maximum distance in cm
+/// \param indices: filled with the indices of the clusters with distance <= window, in increasing order
+///
+/// \return  the number of clusters found
+//_______________________________________________________
+Int_t AliEMCALClusterGrid::FindClusters(const Double_t pos[3], Double_t window, std::vector<Int_t> &indices) const
+{
+  indices.clear();
+  if (fEntries.empty()) return 0;
+
+  const Double_t window2 = window * window;
+  const Int_t nCells = TMath::CeilNint(window / fCellSize);
+
+  if (!fIsBuilt || (2 * nCells + 1) * (2 * nCells + 1) * (2 * nCells + 1) > kMaxCellsPerQuery)
+  {
+    // linear scan, same result
+    for (std::vector<Entry>::const_iterator it = fEntries.begin(); it != fEntries.end(); ++it)
+    {
+      const Double_t dx = pos[0] - it->fPos[0], dy = pos[1] - it->fPos[1], dz = pos[2] - it->fPos[2];
+      if (dx * dx + dy * dy + dz * dz <= window2) indices.push_back(it->fIndex);
+    }
+  }
+  else
+  {
+    const Int_t ix = GetCell(pos[0]), iy = GetCell(pos[1]), iz = GetCell(pos[2]);
+    Entry first;
+    first.fIndex = INT_MIN;
+    for (Int_t jx = ix - nCells; jx <= ix + nCells; jx++)
+    {
+      for (Int_t jy = iy - nCells; jy <= iy + nCells; jy++)
+      {
+        // cells adjacent in z are adjacent in the key, look them up in one go
+        first.fCell = GetCellKey(jx, jy, iz - nCells);
+        const Long64_t lastCell = GetCellKey(jx, jy, iz + nCells);
+        for (std::vector<Entry>::const_iterator it = std::lower_bound(fEntries.begin(), fEntries.end(), first);
+             it != fEntries.end() && it->fCell <= lastCell; ++it)
+        {
+          const Double_t dx = pos[0] - it->fPos[0], dy = pos[1] - it->fPos[1], dz = pos[2] - it->fPos[2];
+          if (dx * dx + dy * dy + dz * dz <= window2) indices.push_back(it->fIndex);
+        }
+      }
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+
+  return indices.size();
+}
+
+///
+/// \return  the cell number along one coordinate
+//_______________________________________________________
+Int_t AliEMCALClusterGrid::GetCell(Double_t x) const
+{
+  return TMath::FloorNint(x / fCellSize);
+}
+
+///
+/// \return  the key of a cell, ordered in x, then y, then z
+//_______________________________________________________
+Long64_t AliEMCALClusterGrid::GetCellKey(Int_t ix, Int_t iy, Int_t iz)
+{
+  return ((ix + kCellOffset) << 42) | ((iy + kCellOffset) << 21) | (iz + kCellOffset);
+}
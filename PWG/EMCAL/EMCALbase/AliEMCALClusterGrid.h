@@ -0,0 +1,74 @@
+#ifndef ALIEMCALCLUSTERGRID_H
+#define ALIEMCALCLUSTERGRID_H
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \class AliEMCALClusterGrid
+/// \ingroup EMCALUtils
+/// \brief Spatial index of the calorimeter clusters of one event, for track matching.
+///
+/// The cluster positions are sorted into cubic cells (in global x, y, z) with
+/// the size of the matching window. The clusters within a given distance from
+/// the extrapolated track position are then found looking only at the
+/// neighbouring cells, instead of computing the distance to all clusters of the
+/// event for each track. The selection is the same as the window cut
+/// applied by the track matchers (distance <= window).
+///
+/// Usage, once per event:
+/// ~~~{.cxx}
+/// AliEMCALClusterGrid grid;
+/// grid.Reset(window);
+/// for (Int_t icl = 0; icl < nClusters; icl++) grid.AddCluster(icl, clusterPosition);
+/// grid.Build();
+/// ...
+/// grid.FindClusters(trackPosition, window, candidates); // for each track
+/// ~~~
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <TObject.h>
+
+class TObjArray;
+
+class AliEMCALClusterGrid : public TObject {
+
+public:
+
+  AliEMCALClusterGrid();
+  virtual ~AliEMCALClusterGrid() {}
+
+  void     Reset(Double_t cellSize);
+  void     AddCluster(Int_t index, const Float_t pos[3]);
+  void     AddClusters(const TObjArray *clusterArr, Bool_t onlyEMCAL = kTRUE);
+  void     Build();
+
+  Int_t    FindClusters(const Double_t pos[3], Double_t window, std::vector<Int_t> &indices) const;
+
+  Int_t    GetNClusters()                          const { return fEntries.size() ; }
+  Double_t GetCellSize()                           const { return fCellSize        ; }
+
+private:
+
+  /// Cluster stored in the grid
+  struct Entry {
+    Long64_t fCell;    ///< key of the cell the cluster is in
+    Int_t    fIndex;   ///< index of the cluster in the event / cluster array
+    Float_t  fPos[3];  ///< global position of the cluster
+
+    bool operator<(const Entry &other) const { return fCell < other.fCell || (fCell == other.fCell && fIndex < other.fIndex); }
+  };
+
+  Int_t    GetCell(Double_t x)                     const;
+  static Long64_t GetCellKey(Int_t ix, Int_t iy, Int_t iz);
+
+  Double_t           fCellSize;   ///< size of the cells in cm
+  std::vector<Entry> fEntries;    //!<! clusters sorted by cell
+  Bool_t             fIsBuilt;    //!<! whether the clusters are sorted
+
+  ClassDef(AliEMCALClusterGrid, 1) ;
+};
+
+#endif // ALIEMCALCLUSTERGRID_H
@@ -13,6 +13,9 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+// C++ includes
+#include <vector>
+
 // ROOT includes
 #include <TH2F.h>
 #include <TArrayI.h>
@@ -35,6 +38,8 @@
 
 // EMCAL includes
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALClusterGrid.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliEMCALGeometry.h"
 #include "AliTrackerBase.h"
 #include "AliEMCALPIDUtils.h"
@@ -59,6 +64,10 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fUseL1PhaseInTimeRecalibration(kFALSE), fEMCALL1PhaseInTimeRecalibration(),
   fUseRunCorrectionFactors(kFALSE),       
   fRemoveBadChannels(kFALSE),             fRecalDistToBadChannels(kFALSE),        fEMCALBadChannelMap(),
+  fUseFlatCalibration(kFALSE),            fFlatCalibrationValid(kFALSE),
+  fFlatCellSM(),                          fFlatCellCol(),                         fFlatCellRow(),
+  fFlatCellEnergyFactor(),                fFlatCellTimeShift(),
+  fFlatCellStatus(),                      fFlatCellBad(),
   fNCellsFromEMCALBorder(0),              fNoEMCALBorderAtEta0(kTRUE),
   fRejectExoticCluster(kFALSE),           fRejectExoticCells(kFALSE), 
   fExoticCellFraction(0),                 fExoticCellDiffTime(0),                 fExoticCellMinAmplitude(0),
@@ -116,6 +125,10 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fUseRunCorrectionFactors(reco.fUseRunCorrectionFactors),   
   fRemoveBadChannels(reco.fRemoveBadChannels),               fRecalDistToBadChannels(reco.fRecalDistToBadChannels),
   fEMCALBadChannelMap(NULL),
+  fUseFlatCalibration(reco.fUseFlatCalibration),             fFlatCalibrationValid(kFALSE),
+  fFlatCellSM(),                                             fFlatCellCol(),                fFlatCellRow(),
+  fFlatCellEnergyFactor(),                                   fFlatCellTimeShift(),
+  fFlatCellStatus(),                                         fFlatCellBad(),
   fNCellsFromEMCALBorder(reco.fNCellsFromEMCALBorder),       fNoEMCALBorderAtEta0(reco.fNoEMCALBorderAtEta0),
   fRejectExoticCluster(reco.fRejectExoticCluster),           fRejectExoticCells(reco.fRejectExoticCells), 
   fExoticCellFraction(reco.fExoticCellFraction),             fExoticCellDiffTime(reco.fExoticCellDiffTime),               
@@ -208,6 +221,9 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   fRemoveBadChannels         = reco.fRemoveBadChannels;
   fRecalDistToBadChannels    = reco.fRecalDistToBadChannels;
   
+  fUseFlatCalibration        = reco.fUseFlatCalibration;
+  fFlatCalibrationValid      = kFALSE;
+  
   fNCellsFromEMCALBorder     = reco.fNCellsFromEMCALBorder;
   fNoEMCALBorderAtEta0       = reco.fNoEMCALBorderAtEta0;
   
@@ -415,19 +431,42 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
   
   Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0; 
   
-  if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)) 
+  if (fUseFlatCalibration)
   {
-    // cell absID does not exist
-    amp=0; time = 1.e9;
-    return kFALSE; 
+    if (!fFlatCalibrationValid || (Int_t)fFlatCellSM.size() != 24*48*geom->GetNumberOfSuperModules())
+      BuildFlatCalibrationTables(geom);
+    
+    imod = fFlatCellSM[absID];
+    if (imod < 0)
+    {
+      // cell absID does not exist
+      amp=0; time = 1.e9;
+      return kFALSE; 
+    }
+  }
+  else
+  {
+    if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)) 
+    {
+      // cell absID does not exist
+      amp=0; time = 1.e9;
+      return kFALSE; 
+    }
+    
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
   }
-  
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
 
   // Do not include bad channels found in analysis,
   if ( IsBadChannelsRemovalSwitchedOn() )
   {
-    Bool_t bad = GetEMCALChannelStatus(imod, ieta, iphi,status);
+    Bool_t bad = kFALSE;
+    if (fUseFlatCalibration)
+    {
+      status = fFlatCellStatus[absID];
+      bad    = fFlatCellBad[absID];
+    }
+    else
+      bad = GetEMCALChannelStatus(imod, ieta, iphi,status);
     
     if ( status > 0 )
       AliDebug(1,Form("Channel absId %d, status %d, set as bad %d",absID, status, bad));
@@ -438,7 +477,7 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
   //Recalibrate energy
   amp  = cells->GetCellAmplitude(absID);
   if (!fCellsRecalibrated && IsRecalibrationOn())
-    amp *= GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+    amp *= fUseFlatCalibration ? fFlatCellEnergyFactor[absID] : GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
   
   // Recalibrate time
   time = cells->GetCellTime(absID);
@@ -1283,6 +1322,7 @@ void AliEMCALRecoUtils::SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dea
   fBadStatusSelection[1] = dead; 
   fBadStatusSelection[2] = hot; 
   fBadStatusSelection[3] = warm; 
+  fFlatCalibrationValid  = kFALSE;
 }
 
 ///
@@ -1516,6 +1556,66 @@ void AliEMCALRecoUtils::InitParameters()
   fSmearClusterParam[2] = 0.00; // constant
 }
 
+///
+/// Copy the energy recalibration factors, the time shifts and the bad channel
+/// status of all the cells into flat arrays indexed by absId, so that the cell
+/// loops do not go through the geometry and a histogram bin lookup per cell.
+/// Called on the first use after a map was set or modified with the setters,
+/// that is once per run when the maps are loaded from OADB. Call
+/// ResetFlatCalibrationTables() after modifying the map histograms directly.
+///
+/// \param geom: AliEMCALGeometry pointer
+///
+//_____________________________________________________
+void AliEMCALRecoUtils::BuildFlatCalibrationTables(const AliEMCALGeometry* geom)
+{
+  if (!geom)
+  {
+    AliError("No geometry, cannot build the flat calibration tables");
+    return;
+  }
+  
+  const Int_t nCells = 24*48*geom->GetNumberOfSuperModules();
+  
+  fFlatCellSM          .assign(nCells, -1);
+  fFlatCellCol         .assign(nCells, -1);
+  fFlatCellRow         .assign(nCells, -1);
+  fFlatCellEnergyFactor.assign(nCells, 1.);
+  fFlatCellTimeShift   .assign(8*nCells, 0.);
+  fFlatCellStatus      .assign(nCells, 0);
+  fFlatCellBad         .assign(nCells, 0);
+  
+  const Int_t nTimeMaps = fEMCALTimeRecalibrationFactors ? TMath::Min(fEMCALTimeRecalibrationFactors->GetEntriesFast(), 8) : 0;
+  
+  Int_t imod = -1, iTower = -1, iIphi = -1, iIeta = -1, iphi = -1, ieta = -1, status = 0;
+  for (Int_t absId = 0; absId < nCells; absId++)
+  {
+    for (Int_t imap = 0; imap < nTimeMaps; imap++)
+    {
+      TH1F * hTime = (TH1F*) fEMCALTimeRecalibrationFactors->At(imap);
+      if (hTime) fFlatCellTimeShift[8*absId+imap] = (Float_t) hTime->GetBinContent(absId);
+    }
+    
+    if (!geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta)) continue;
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi,iIeta,iphi,ieta);
+    
+    fFlatCellSM [absId] = imod;
+    fFlatCellCol[absId] = ieta;
+    fFlatCellRow[absId] = iphi;
+    
+    if (fEMCALRecalibrationFactors && fEMCALRecalibrationFactors->At(imod))
+      fFlatCellEnergyFactor[absId] = GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+    
+    if (!fEMCALBadChannelMap || fEMCALBadChannelMap->At(imod))
+    {
+      fFlatCellBad   [absId] = GetEMCALChannelStatus(imod,ieta,iphi,status);
+      fFlatCellStatus[absId] = status;
+    }
+  }
+  
+  fFlatCalibrationValid = kTRUE;
+}
+
 ///
 /// Init EMCAL energy calibration factors container
 ///
@@ -1548,6 +1648,8 @@ void AliEMCALRecoUtils::InitEMCALRecalibrationFactors()
   fEMCALRecalibrationFactors->Compress();
   
   // In order to avoid rewriting the same histograms
+  fFlatCalibrationValid = kFALSE;
+  
   TH1::AddDirectory(oldStatus);    
 }
 
@@ -1593,6 +1695,8 @@ void AliEMCALRecoUtils::InitEMCALTimeRecalibrationFactors()
   fEMCALTimeRecalibrationFactors->Compress();
   
   // In order to avoid rewriting the same histograms
+  fFlatCalibrationValid = kFALSE;
+  
   TH1::AddDirectory(oldStatus);    
 }
 
@@ -1618,6 +1722,8 @@ void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
   fEMCALBadChannelMap->Compress();
   
   // In order to avoid rewriting the same histograms
+  fFlatCalibrationValid = kFALSE;
+  
   TH1::AddDirectory(oldStatus);    
 }
 
@@ -1681,6 +1787,10 @@ void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom,
   Int_t   absIdMax = -1;
   Float_t emax     = 0;
   
+  const Bool_t useFlat = fUseFlatCalibration && !fCellsRecalibrated && IsRecalibrationOn();
+  if (useFlat && (!fFlatCalibrationValid || (Int_t)fFlatCellSM.size() != 24*48*geom->GetNumberOfSuperModules()))
+    BuildFlatCalibrationTables(geom);
+  
   // Loop on the cells, get the cell amplitude and recalibration factor, multiply and and to the new energy
   for (Int_t icell = 0; icell < ncells; icell++)
   {
@@ -1688,7 +1798,19 @@ void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom,
     frac =  fraction[icell];
     if (frac < 1e-5) frac = 1; //in case of EMCAL, this is set as 0 since unfolding is off
     
-    if (!fCellsRecalibrated && IsRecalibrationOn()) 
+    if (useFlat && absId < (Int_t)fFlatCellSM.size())
+    {
+      imod = fFlatCellSM[absId];
+      if (fEMCALRecalibrationFactors->GetEntries() <= imod) 
+        continue;
+      irow   = fFlatCellRow[absId];
+      icol   = fFlatCellCol[absId];
+      factor = fFlatCellEnergyFactor[absId];
+      
+      AliDebug(2,Form("AliEMCALRecoUtils::RecalibrateClusterEnergy - recalibrate cell: module %d, col %d, row %d, cell fraction %f,recalibration factor %f, cell energy %f\n",
+                      imod,icol,irow,frac,factor,cells->GetCellAmplitude(absId)));
+    }
+    else if (!fCellsRecalibrated && IsRecalibrationOn()) 
     {
       // Energy  
       Int_t iTower = -1, iIphi = -1, iIeta = -1; 
@@ -1793,7 +1915,9 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
 void AliEMCALRecoUtils::RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & celltime, Bool_t isLGon) const
 {  
   if (!fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0) {
-    if(fLowGain)
+    if (fUseFlatCalibration && fFlatCalibrationValid && absId >= 0 && absId < (Int_t)fFlatCellSM.size())
+      celltime -= fFlatCellTimeShift[8*absId + bc%4 + 4*(fLowGain && isLGon)]*1.e-9;
+    else if(fLowGain)
       celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,isLGon)*1.e-9;
     else
       celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,kFALSE)*1.e-9;
@@ -2708,6 +2832,12 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     }
   }
   
+  // Index of the cluster positions, built once for all tracks
+  AliEMCALClusterGrid clusterGrid;
+  clusterGrid.Reset(fClusterWindow);
+  clusterGrid.AddClusters(clusterArr ? clusterArr : clusterArray);
+  clusterGrid.Build();
+  
   Int_t    matched=0;
   Double_t cv[21];
   TString  genName;
@@ -2834,7 +2964,7 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     // Extrapolate the track to EMCal surface, see AliEMCALRecoUtilsBase
     AliExternalTrackParam emcalParam(*trackParam);
     Float_t eta, phi, pt;
-    if (!ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt)) 
+    if (!AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt)) 
     {
       if (aodevent    && trackParam) delete trackParam;
       if (fITSTrackSA && trackParam) delete trackParam;
@@ -2859,9 +2989,9 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     Int_t index = -1;
     Float_t dEta = -999, dPhi = -999;
     if (!clusterArr) 
-      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, clusterArray, dEta, dPhi);  
+      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, clusterArray, dEta, dPhi, &clusterGrid);  
     else 
-      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, clusterArr  , dEta, dPhi);  
+      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, clusterArr  , dEta, dPhi, &clusterGrid);  
     
     
     if (index>-1) 
@@ -2934,7 +3064,7 @@ Int_t AliEMCALRecoUtils::FindMatchedClusterInEvent(const AliESDtrack *track,
   AliExternalTrackParam emcalParam(*trackParam);
   
   Float_t eta, phi, pt;  
-  if (!AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt))	
+  if (!AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt))	
   {
     if (fITSTrackSA) delete trackParam;
     return index;
@@ -2979,13 +3109,16 @@ Int_t AliEMCALRecoUtils::FindMatchedClusterInEvent(const AliESDtrack *track,
 /// \param clusterArr: input array of clusters
 /// \param dEta: found track-cluster match residual in eta direction
 /// \param dPhi: found track-cluster match residual in phi direction
+/// \param clusterGrid: optional index of the positions of the clusters in clusterArr, 
+///                     only the clusters within fClusterWindow are then looked at
 ///
 /// \return  the index of matched cluster to input track.
 //_______________________________________________________________________________________________
 Int_t  AliEMCALRecoUtils::FindMatchedClusterInClusterArr(const AliExternalTrackParam *emcalParam, 
                                                          AliExternalTrackParam *trkParam, 
                                                          const TObjArray * clusterArr, 
-                                                         Float_t &dEta, Float_t &dPhi)
+                                                         Float_t &dEta, Float_t &dPhi,
+                                                         const AliEMCALClusterGrid *clusterGrid)
 {  
   dEta=-999, dPhi=-999;
   Float_t dRMax = fCutR, dEtaMax=fCutEta, dPhiMax=fCutPhi;
@@ -2995,9 +3128,15 @@ Int_t  AliEMCALRecoUtils::FindMatchedClusterInClusterArr(const AliExternalTrackP
   Double_t exPos[3] = {0.,0.,0.};
   if (!emcalParam->GetXYZ(exPos)) return index;
 
+  // Candidate clusters inside the window, in increasing index order
+  std::vector<Int_t> candidates;
+  if (clusterGrid) clusterGrid->FindClusters(exPos, fClusterWindow, candidates);
+  const Int_t nCandidates = clusterGrid ? (Int_t) candidates.size() : clusterArr->GetEntriesFast();
+  
   Float_t clsPos[3] = {0.,0.,0.};
-  for (Int_t icl=0; icl<clusterArr->GetEntriesFast(); icl++)
+  for (Int_t icand=0; icand<nCandidates; icand++)
   {
+    Int_t icl = clusterGrid ? candidates[icand] : icand;
     AliVCluster *cluster = dynamic_cast<AliVCluster*> (clusterArr->At(icl)) ;
     
     if (!cluster || !cluster->IsEMCAL()) continue;
@@ -3657,6 +3796,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH
   TH2F *clone = new TH2F(*h);
   clone->SetDirectory(NULL);
   fEMCALRecalibrationFactors->AddAt(clone,iSM); 
+  fFlatCalibrationValid = kFALSE;
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) { 
@@ -3686,6 +3826,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
   TH2I *clone = new TH2I(*h);
   clone->SetDirectory(NULL);
   fEMCALBadChannelMap->AddAt(clone,iSM); 
+  fFlatCalibrationValid = kFALSE;
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map) { 
@@ -3715,6 +3856,7 @@ void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(Int_t bc, const
   TH1F *clone = new TH1F(*h);
   clone->SetDirectory(NULL);
   fEMCALTimeRecalibrationFactors->AddAt(clone,bc); 
+  fFlatCalibrationValid = kFALSE;
 }
 
 void AliEMCALRecoUtils::SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TObjArray *map) { 
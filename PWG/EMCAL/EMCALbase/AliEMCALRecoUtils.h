@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 // Root includes
+#include <vector>
 #include <TNamed.h>
 #include <TMath.h>
 class TObjArray;
@@ -53,6 +54,7 @@ class AliMCEvent;
 #include "AliEMCALRecoUtilsBase.h"
 class AliEMCALGeometry;
 class AliEMCALPIDUtils;
+class AliEMCALClusterGrid;
 class AliESDtrack;
 class AliExternalTrackParam;
 class AliVTrack;
@@ -163,6 +165,15 @@ public:
   void     RecalibrateCells(AliVCaloCells * cells, Int_t bc) ; // Energy and Time
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
+  void     SetCellsCalibrated()                          { fCellsRecalibrated = kTRUE ; }
+  Bool_t   AreCellsCalibrated()                    const { return fCellsRecalibrated  ; }
+
+  // Flat per absId copy of the energy, time and status maps, used by the cell loops
+  void     SwitchOnFlatCalibrationTables()               { fUseFlatCalibration = kTRUE  ; fFlatCalibrationValid = kFALSE ; }
+  void     SwitchOffFlatCalibrationTables()              { fUseFlatCalibration = kFALSE ; fFlatCalibrationValid = kFALSE ; }
+  Bool_t   AreFlatCalibrationTablesUsed()          const { return fUseFlatCalibration   ; }
+  void     ResetFlatCalibrationTables()                  { fFlatCalibrationValid = kFALSE ; }
+  void     BuildFlatCalibrationTables(const AliEMCALGeometry* geom) ;
 
   // Energy recalibration
   Bool_t   IsRecalibrationOn()                     const { return fRecalibration ; }
@@ -180,7 +191,7 @@ public:
     else return 1 ; } 
   void     SetEMCALChannelRecalibrationFactor(Int_t iSM , Int_t iCol, Int_t iRow, Double_t c = 1) { 
     if(!fEMCALRecalibrationFactors) InitEMCALRecalibrationFactors() ;
-    ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; }
+    ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; fFlatCalibrationValid = kFALSE ; }
   
   // Recalibrate channels energy with run dependent corrections
   Bool_t   IsRunDepRecalibrationOn()               const { return fUseRunCorrectionFactors ; }
@@ -189,6 +200,7 @@ public:
                                                            SwitchOnRecalibration()           ; }      
   // Time Recalibration  
   void     SetConstantTimeShift(Float_t shift)           { fConstantTimeShift = shift  ; }
+  Float_t  GetConstantTimeShift()                  const { return fConstantTimeShift   ; }
 
   void     RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & time,Bool_t isLGon = kFALSE) const;
   
@@ -205,7 +217,7 @@ public:
     else return 0 ; } 
   void     SetEMCALChannelTimeRecalibrationFactor(Int_t bc, Int_t absID, Double_t c = 0, Bool_t isLGon=kFALSE) { 
     if(!fEMCALTimeRecalibrationFactors) InitEMCALTimeRecalibrationFactors() ;
-    ((TH1F*)fEMCALTimeRecalibrationFactors->At(bc+4*isLGon))->SetBinContent(absID,c) ; }  
+    ((TH1F*)fEMCALTimeRecalibrationFactors->At(bc+4*isLGon))->SetBinContent(absID,c) ; fFlatCalibrationValid = kFALSE ; }  
   
   TH1F *   GetEMCALChannelTimeRecalibrationFactors(Int_t bc)const       { return (TH1F*)fEMCALTimeRecalibrationFactors->At(bc) ; }	
   void     SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map);
@@ -265,15 +277,15 @@ public:
   void     InitEMCALBadChannelStatusMap() ;
   void     SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dead, Bool_t hot, Bool_t warm);
   void     SetWarmChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; fFlatCalibrationValid = kFALSE; }
   void     SetDeadChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; fFlatCalibrationValid = kFALSE; }
   void     SetHotChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; } 
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; fFlatCalibrationValid = kFALSE; } 
   Bool_t   GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t & status) const ;
   void     SetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Double_t status = 1) { 
     if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap()               ;
-    ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; }
+    ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; fFlatCalibrationValid = kFALSE ; }
   TH2I *   GetEMCALChannelStatusMap(Int_t iSM)     const { return (TH2I*)fEMCALBadChannelMap->At(iSM) ; }
   void     SetEMCALChannelStatusMap(const TObjArray *map);
   void     SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h);
@@ -309,7 +321,8 @@ public:
   Int_t    FindMatchedClusterInClusterArr(const AliExternalTrackParam *emcalParam, 
                                           AliExternalTrackParam *trkParam, 
                                           const TObjArray * clusterArr, 
-                                          Float_t &dEta, Float_t &dPhi);
+                                          Float_t &dEta, Float_t &dPhi,
+                                          const AliEMCALClusterGrid *clusterGrid = 0x0);
  
   // Needed by analysis task in AliPhysics, could be removed once base class committed and analysis task is fixed.
   static Bool_t ExtrapolateTrackToCluster (AliExternalTrackParam *trkParam, const AliVCluster *cluster,
@@ -499,6 +512,17 @@ private:
                                          ///<   1- Set dead as good if false
                                          ///<   2- Set hot as good if false
                                          ///<   3- Set warm as good if false
+
+  // Flat calibration tables
+  Bool_t     fUseFlatCalibration;        ///< Read the maps through the flat per absId tables below, rebuilt whenever a map is changed with the setters
+  Bool_t     fFlatCalibrationValid;      //!<! The flat tables correspond to the current maps
+  std::vector<Short_t> fFlatCellSM;      //!<! Supermodule of each absId, -1 if the cell does not exist
+  std::vector<Short_t> fFlatCellCol;     //!<! Column of each absId in its supermodule
+  std::vector<Short_t> fFlatCellRow;     //!<! Row of each absId in its supermodule
+  std::vector<Float_t> fFlatCellEnergyFactor; //!<! Energy recalibration factor of each absId
+  std::vector<Float_t> fFlatCellTimeShift;    //!<! Time shift in ns, [absId*8+bc+4*isLG]
+  std::vector<Int_t>   fFlatCellStatus;       //!<! Bad channel map status of each absId
+  std::vector<Char_t>  fFlatCellBad;          //!<! Status declared bad with the current selection
   
   // Border cells
   Int_t      fNCellsFromEMCALBorder;     ///< Number of cells from EMCAL border the cell with maximum amplitude has to be.
@@ -559,7 +583,7 @@ private:
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
   
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 28) ;
+  ClassDef(AliEMCALRecoUtils, 29) ;
   /// \endcond
 
 };
@@ -0,0 +1,169 @@
+/**************************************************************************
+ * Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- standard c ---
+#include <cstring>
+#include <map>
+
+// --- AliRoot ---
+#include "AliAnalysisManager.h"
+#include "AliVEventHandler.h"
+#include "AliVEvent.h"
+#include "AliExternalTrackParam.h"
+#include "AliEMCALRecoUtilsBase.h"
+
+#include "AliEMCALTrackExtrapolationCache.h"
+
+namespace {
+  /// Starting point of an extrapolation: track parameters, radius, mass and step
+  struct ExtrapolationKey {
+    Double_t fVal[10];  ///< x, alpha, the 5 track parameters, radius, mass, step
+
+    bool operator<(const ExtrapolationKey &other) const { return memcmp(fVal, other.fVal, sizeof(fVal)) < 0; }
+  };
+
+  /// Result of an extrapolation
+  struct ExtrapolationResult {
+    Bool_t                fSuccess;  ///< return value of the extrapolation
+    Float_t               fEta;      ///< eta at the surface
+    Float_t               fPhi;      ///< phi at the surface
+    Float_t               fPt;       ///< pt at the surface
+    AliExternalTrackParam fParam;    ///< propagated track parameters
+  };
+
+  std::map<ExtrapolationKey, ExtrapolationResult> gExtrapolations;  ///< extrapolations of the current event
+  const AliVEvent *gEvent   = 0;      ///< event the extrapolations belong to
+  Long64_t         gEntry   = -1;     ///< entry the extrapolations belong to
+  Bool_t           gEnabled = kTRUE;  ///< whether the cache is used
+}
+
+///
+/// Extrapolate a track to the EMCal surface, or get the result of the same
+/// extrapolation done before in this event.
+/// Same interface as AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface().
+///
+/// \param trkParam: starting track parameters, propagated to the surface on return
+/// \param emcalR: radius of the surface
+/// \param mass: mass hypothesis
+/// \param step: step of the propagation
+/// \param eta: eta at the surface, -999 if the extrapolation failed
+/// \param phi: phi at the surface, -999 if the extrapolation failed
+/// \param pt: pt at the surface, -999 if the extrapolation failed
+///
+/// \return  kTRUE if the track could be extrapolated
+//_______________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(AliExternalTrackParam *trkParam, Double_t emcalR, Double_t mass,
+                                                                       Double_t step, Float_t &eta, Float_t &phi, Float_t &pt)
+{
+  eta = phi = pt = -999;
+  if (!trkParam) return kFALSE;
+
+  if (!gEnabled || !CheckEvent())
+  {
+    Bool_t success = AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(trkParam, emcalR, mass, step, eta, phi, pt);
+    if (!success) eta = phi = pt = -999;
+    return success;
+  }
+
+  ExtrapolationKey key;
+  key.fVal[0] = trkParam->GetX();
+  key.fVal[1] = trkParam->GetAlpha();
+  memcpy(key.fVal + 2, trkParam->GetParameter(), sizeof(Double_t) * 5);
+  key.fVal[7] = emcalR;
+  key.fVal[8] = mass;
+  key.fVal[9] = step;
+
+  std::map<ExtrapolationKey, ExtrapolationResult>::iterator it = gExtrapolations.find(key);
+  if (it == gExtrapolations.end())
+  {
+    ExtrapolationResult result;
+    result.fEta = -999;
+    result.fPhi = -999;
+    result.fPt  = -999;
+    result.fSuccess = AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(trkParam, emcalR, mass, step, result.fEta, result.fPhi, result.fPt);
+    if (!result.fSuccess) result.fEta = result.fPhi = result.fPt = -999;
+    result.fParam = *trkParam;
+    it = gExtrapolations.insert(std::make_pair(key, result)).first;
+  }
+  else
+  {
+    *trkParam = it->second.fParam;
+  }
+
+  eta = it->second.fEta;
+  phi = it->second.fPhi;
+  pt  = it->second.fPt;
+
+  return it->second.fSuccess;
+}
+
+///
+/// Switch the cache on or off (on by default). Switching it off clears it.
+//_______________________________________________________
+void AliEMCALTrackExtrapolationCache::SetEnabled(Bool_t b)
+{
+  gEnabled = b;
+  if (!gEnabled) Reset();
+}
+
+///
+/// \return  whether the cache is used
+//_______________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::IsEnabled()
+{
+  return gEnabled;
+}
+
+///
+/// Remove all stored extrapolations.
+//_______________________________________________________
+void AliEMCALTrackExtrapolationCache::Reset()
+{
+  gExtrapolations.clear();
+  gEvent = 0;
+  gEntry = -1;
+}
+
+///
+/// \return  the number of extrapolations stored for the current event
+//_______________________________________________________
+Int_t AliEMCALTrackExtrapolationCache::GetNEntries()
+{
+  return gExtrapolations.size();
+}
+
+///
+/// Reset the cache if the event has changed since the last call.
+///
+/// \return  kFALSE if the current event cannot be identified, the cache is then not used
+//_______________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::CheckEvent()
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr || !mgr->GetInputEventHandler()) return kFALSE;
+
+  const AliVEvent *event = mgr->GetInputEventHandler()->GetEvent();
+  if (!event) return kFALSE;
+
+  const Long64_t entry = mgr->GetCurrentEntry();
+  if (event != gEvent || entry != gEntry)
+  {
+    gExtrapolations.clear();
+    gEvent = event;
+    gEntry = entry;
+  }
+
+  return kTRUE;
+}
@@ -0,0 +1,47 @@
+#ifndef ALIEMCALTRACKEXTRAPOLATIONCACHE_H
+#define ALIEMCALTRACKEXTRAPOLATIONCACHE_H
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \class AliEMCALTrackExtrapolationCache
+/// \ingroup EMCALUtils
+/// \brief Per-event cache of the track extrapolations to the calorimeter surface, shared by all tasks.
+///
+/// Drop-in replacement of AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliExternalTrackParam*, ...).
+/// The result of the propagation (success flag, eta, phi and pt at the surface and the
+/// propagated track parameters) is stored on the first request, and returned to all
+/// further requests in the same event with the same starting track parameters, radius,
+/// mass and step, from any task of the train. Using the starting parameters rather than
+/// the track ID as key keeps the result identical to a new propagation, also when tasks
+/// start from different parameters (inner, outer or vertex) of the same track.
+///
+/// The cache is reset when the input event (or entry) of the analysis manager changes.
+/// Without analysis manager the track is propagated at each call.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include <Rtypes.h>
+
+class AliExternalTrackParam;
+
+class AliEMCALTrackExtrapolationCache {
+
+public:
+
+  static Bool_t ExtrapolateTrackToEMCalSurface(AliExternalTrackParam *trkParam, Double_t emcalR, Double_t mass,
+                                               Double_t step, Float_t &eta, Float_t &phi, Float_t &pt);
+
+  static void   SetEnabled(Bool_t b);
+  static Bool_t IsEnabled();
+  static void   Reset();
+  static Int_t  GetNEntries();
+
+private:
+
+  AliEMCALTrackExtrapolationCache();
+  static Bool_t CheckEvent();
+};
+
+#endif // ALIEMCALTRACKEXTRAPOLATIONCACHE_H
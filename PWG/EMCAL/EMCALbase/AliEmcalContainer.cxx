@@ -24,6 +24,7 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <cstring>
 #include <TClonesArray.h>
 #include "AliVEvent.h"
 #include "AliLog.h"
@@ -60,11 +61,17 @@ AliEmcalContainer::AliEmcalContainer():
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fCacheAcceptIndices(kFALSE),
+  fAcceptIndices(),
+  fAcceptIndicesValid(kFALSE),
+  fAcceptIndicesArray(0),
+  fAcceptIndicesNEntries(0),
   fClassName()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
   fVertex[2] = 0;
+  memset(fAcceptIndicesCuts, 0, sizeof(Double_t) * 10);
 }
 
 AliEmcalContainer::AliEmcalContainer(const char *name):
@@ -90,11 +97,17 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fCacheAcceptIndices(kFALSE),
+  fAcceptIndices(),
+  fAcceptIndicesValid(kFALSE),
+  fAcceptIndicesArray(0),
+  fAcceptIndicesNEntries(0),
   fClassName()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
   fVertex[2] = 0;
+  memset(fAcceptIndicesCuts, 0, sizeof(Double_t) * 10);
 }
 
 TObject *AliEmcalContainer::operator[](int index) const {
@@ -132,6 +145,7 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+  InvalidateAcceptIndices();
 
   if (!fClArrayName.IsNull() && !fClArray) {
     fClArray = dynamic_cast<TClonesArray*>(event->FindListObject(fClArrayName));
@@ -159,6 +173,8 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
 
 void AliEmcalContainer::NextEvent(const AliVEvent * event)
 {
+  InvalidateAcceptIndices();
+
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
@@ -168,6 +184,8 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
 }
 
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  if (fCacheAcceptIndices) return GetAcceptIndices().GetSize();
+
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
@@ -176,6 +194,43 @@ Int_t AliEmcalContainer::GetNAcceptEntries() const{
   return result;
 }
 
+const TArrayI& AliEmcalContainer::GetAcceptIndices() const
+{
+  if (fCacheAcceptIndices && IsAcceptIndexCacheValid()) return fAcceptIndices;
+
+  // single pass over the container, the array is shrunk to the number of accepted entries
+  const Int_t nEntries = GetNEntries();
+  fAcceptIndices.Set(nEntries);
+  Int_t acceptCounter = 0;
+  for (Int_t index = 0; index < nEntries; index++) {
+    UInt_t rejectionReason = 0;
+    if (AcceptObject(index, rejectionReason)) fAcceptIndices[acceptCounter++] = index;
+  }
+  fAcceptIndices.Set(acceptCounter);
+
+  if (fCacheAcceptIndices) StoreAcceptIndexCacheKey();
+
+  return fAcceptIndices;
+}
+
+Bool_t AliEmcalContainer::IsAcceptIndexCacheValid() const
+{
+  if (!fAcceptIndicesValid) return kFALSE;
+  if (fAcceptIndicesArray != fClArray || fAcceptIndicesNEntries != GetNEntries()) return kFALSE;
+
+  const Double_t cuts[10] = {fMinPt, fMaxPt, fMaxE, fMinE, fMinEta, fMaxEta, fMinPhi, fMaxPhi, Double_t(fMinMCLabel), Double_t(fMaxMCLabel)};
+  return memcmp(cuts, fAcceptIndicesCuts, sizeof(Double_t) * 10) == 0;
+}
+
+void AliEmcalContainer::StoreAcceptIndexCacheKey() const
+{
+  fAcceptIndicesArray = fClArray;
+  fAcceptIndicesNEntries = GetNEntries();
+  const Double_t cuts[10] = {fMinPt, fMaxPt, fMaxE, fMinE, fMinEta, fMaxEta, fMinPhi, fMaxPhi, Double_t(fMinMCLabel), Double_t(fMaxMCLabel)};
+  memcpy(fAcceptIndicesCuts, cuts, sizeof(Double_t) * 10);
+  fAcceptIndicesValid = kTRUE;
+}
+
 Int_t AliEmcalContainer::GetIndexFromLabel(Int_t lab) const
 { 
   if (fLabelMap) {
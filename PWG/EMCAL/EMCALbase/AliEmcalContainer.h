@@ -39,6 +39,7 @@ class AliVParticle;
 
 #include <TNamed.h>
 #include <TClonesArray.h>
+#include <TArrayI.h>
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterableContainer::operator_star_object<TObject> > AliEmcalIterableContainer;
@@ -228,6 +229,30 @@ class AliEmcalContainer : public TObject {
    * @return Number of accepted events in the container
    */
   Int_t                       GetNAcceptEntries() const;
+  /**
+   * @brief Indices of the accepted entries in the container
+   *
+   * If caching is enabled (see SetCacheAcceptIndices) the indices are
+   * determined only once per event and kinematic cuts, otherwise they
+   * are determined at each call.
+   * @return Indices of the accepted entries, in increasing order
+   */
+  const TArrayI&              GetAcceptIndices() const;
+  /**
+   * @brief Enable caching of the accepted indices
+   *
+   * The cache is reset in NextEvent and SetArray, and whenever the array or
+   * the kinematic cuts of the base class change. Cuts of derived classes
+   * must not be changed during an event while the cache is enabled,
+   * otherwise InvalidateAcceptIndices has to be called.
+   * @param[in] b If true the accepted indices are cached
+   */
+  void                        SetCacheAcceptIndices(Bool_t b)       { fCacheAcceptIndices = b; InvalidateAcceptIndices(); }
+  Bool_t                      GetCacheAcceptIndices()         const { return fCacheAcceptIndices        ; }
+  /**
+   * @brief Reset the cache of accepted indices
+   */
+  void                        InvalidateAcceptIndices()             { fAcceptIndicesValid = kFALSE      ; }
 
   /**
    * @brief Reset the iterator to a given index
@@ -372,6 +397,16 @@ class AliEmcalContainer : public TObject {
    */
   void                        GetVertexFromEvent(const AliVEvent * event);
 
+  /**
+   * @brief Check whether the cached accepted indices can be used
+   * @return True if the cache was built for the current array and kinematic cuts
+   */
+  Bool_t                      IsAcceptIndexCacheValid() const;
+  /**
+   * @brief Store the array and kinematic cuts the accepted indices were built for
+   */
+  void                        StoreAcceptIndexCacheKey() const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -394,6 +429,12 @@ class AliEmcalContainer : public TObject {
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  Bool_t                      fCacheAcceptIndices;      ///< if true the accepted indices are built once per event
+  mutable TArrayI             fAcceptIndices;           //!<! accepted indices (cache, or result of the last call of GetAcceptIndices)
+  mutable Bool_t              fAcceptIndicesValid;      //!<! whether fAcceptIndices is valid for the current event
+  mutable const TClonesArray *fAcceptIndicesArray;      //!<! array fAcceptIndices was built for
+  mutable Int_t               fAcceptIndicesNEntries;   //!<! number of entries of the array when fAcceptIndices was built
+  mutable Double_t            fAcceptIndicesCuts[10];   //!<! kinematic cuts and MC label range fAcceptIndices was built for
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -401,6 +442,6 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer(const AliEmcalContainer& obj); // copy constructor
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
 };
 #endif
@@ -115,6 +115,12 @@ void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor
       AliInfoStream() << "Histogram " << listObject->GetName() << " will not be scaled, because a scaling histogram" << std::endl;
       continue;
     }
+    // Timing information of the stage profiler in AliAnalysisTaskEmcal
+    if (histogram_name.Contains("fHistStageProfile"))
+    {
+      AliInfoStream() << "Histogram " << listObject->GetName() << " will not be scaled, because it contains timing information" << std::endl;
+      continue;
+    }
     if (histogram_class.Contains("TProfile"))
     {
       AliInfoStream() << "Histogram " << listObject->GetName() << " will not be scaled, because it is a TProfile" << std::endl;
@@ -211,12 +217,13 @@ bool AliEmcalList::IsScalingSupported(const TObject *scaleobject) const {
 //________________________________________________________________________
 Int_t AliEmcalList::GetFilledBinNumber(const TH1* hist) const
 {
-  AliInfoStream() << hist->GetName() << ": nbinsX=" << hist->GetNbinsX() << std::endl;;
+  // called for each list at each merge step: the dump of the bins is only printed in debug mode
+  AliDebugStream(1) << hist->GetName() << ": nbinsX=" << hist->GetNbinsX() << std::endl;
 
   Int_t binFound = 0;
   for(Int_t i=1; i<=hist->GetNbinsX(); i++)
   {
-    AliInfoStream() << hist->GetName() << ": bin=" << i << ", val=" << hist->GetBinContent(i) << std::endl;
+    AliDebugStream(2) << hist->GetName() << ": bin=" << i << ", val=" << hist->GetBinContent(i) << std::endl;
     if(hist->GetBinContent(i))
     {
       if(!binFound)
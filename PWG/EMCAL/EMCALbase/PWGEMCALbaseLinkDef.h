@@ -5,6 +5,8 @@
 #pragma link off all functions;
 
 #pragma link C++ class AliEMCALRecoUtils+;
+#pragma link C++ class AliEMCALClusterGrid+;
+#pragma link C++ class AliEMCALTrackExtrapolationCache+;
 
 #pragma link C++ class AliAnalysisTaskEmcalLight+;
 #pragma link C++ class AliAnalysisTaskEmcal+;
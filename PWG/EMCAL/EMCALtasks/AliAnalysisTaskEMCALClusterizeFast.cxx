@@ -20,6 +20,9 @@
 #include <TString.h>
 #include <TTree.h>
 #include <TArrayI.h>
+#include <algorithm>
+#include <functional>
+#include <utility>
 
 // --- AliRoot ---
 #include "AliAODCaloCluster.h"
@@ -90,11 +93,20 @@ AliAnalysisTaskEMCALClusterizeFast::AliAnalysisTaskEMCALClusterizeFast() :
   fRecalDistToBadChannels(kFALSE),
   fSetCellMCLabelFromCluster(0),
   fSetCellMCLabelFromEdepFrac(0),
+  fUseFlatClusterizer(kFALSE),
   fCaloCells(0),
   fCaloClusters(0),
   fEsd(0),
   fAod(0),
-  fGeom(0)
+  fGeom(0),
+  fFlatClusterizerOn(kFALSE),
+  fNeighbours(),
+  fFlatCellIds(),
+  fFlatCellE(),
+  fFlatCellTime(),
+  fFlatCellEFrac(),
+  fFlatCellMCLabel(),
+  fFlatCellCluster()
 { 
   // Constructor
 
@@ -145,11 +157,20 @@ AliAnalysisTaskEMCALClusterizeFast::AliAnalysisTaskEMCALClusterizeFast(const cha
   fRecalDistToBadChannels(kFALSE),
   fSetCellMCLabelFromCluster(0),
   fSetCellMCLabelFromEdepFrac(0),
+  fUseFlatClusterizer(kFALSE),
   fCaloCells(0),
   fCaloClusters(0),
   fEsd(0),
   fAod(0),
-  fGeom(0)
+  fGeom(0),
+  fFlatClusterizerOn(kFALSE),
+  fNeighbours(),
+  fFlatCellIds(),
+  fFlatCellE(),
+  fFlatCellTime(),
+  fFlatCellEFrac(),
+  fFlatCellMCLabel(),
+  fFlatCellCluster()
 { 
   // Constructor
 
@@ -239,13 +260,18 @@ void AliAnalysisTaskEMCALClusterizeFast::UserExec(Option_t *)
     return;
   }
 
-  FillDigitsArray();
+  if (fFlatClusterizerOn) {
+    FillFlatCells();
+  }
+  else {
+    FillDigitsArray();
 
-  if (fDoClusterize)
-    Clusterize();
+    if (fDoClusterize)
+      Clusterize();
 
-  if (fDoUpdateCells)
-    UpdateCells();
+    if (fDoUpdateCells)
+      UpdateCells();
+  }
 
   if (!fDoClusterize || (!fAttachClusters && !fOutputAODBranch) || !fCaloClusters)
     return;
@@ -349,34 +375,7 @@ void AliAnalysisTaskEMCALClusterizeFast::FillDigitsArray()
       // very rough
       // Copied and simplified from AliEMCALTenderSupply
       if (fSetCellMCLabelFromCluster || fSetCellMCLabelFromEdepFrac) 
-      {
-        for (Int_t i = 0; i < fgkTotalCellNumber; i++)
-        {
-          fCellLabels      [i] =-1 ;
-          fOrgClusterCellId[i] =-1 ;
-        }
-        
-        Int_t nClusters = InputEvent()->GetNumberOfCaloClusters();
-        for (Int_t i = 0; i < nClusters; i++) 
-        {
-          AliVCluster *clus =  InputEvent()->GetCaloCluster(i);
-          
-          if (!clus) continue;
-          
-          if (!clus->IsEMCAL()) continue ;
-          
-          Int_t      label = clus->GetLabel();
-          UShort_t * index = clus->GetCellsAbsId() ;
-          
-          for(Int_t icell=0; icell < clus->GetNCells(); icell++)
-          {
-            if(!fSetCellMCLabelFromEdepFrac) 
-              fCellLabels[index[icell]] = label;
-            
-            fOrgClusterCellId[index[icell]] = i ; // index of the original cluster
-          } // cell in cluster loop
-        } // cluster loop
-      }
+        SetCellLabelsFromClusters();
       
       Double_t avgE        = 0; // for background subtraction
       const Int_t ncells   = fCaloCells->GetNumberOfCells();
@@ -589,6 +588,258 @@ void AliAnalysisTaskEMCALClusterizeFast::FillDigitsArray()
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskEMCALClusterizeFast::SetCellLabelsFromClusters()
+{
+  // Store for each cell the index and MC label of the input cluster it belongs to
+
+  for (Int_t i = 0; i < fgkTotalCellNumber; i++)
+  {
+    fCellLabels      [i] =-1 ;
+    fOrgClusterCellId[i] =-1 ;
+  }
+  
+  Int_t nClusters = InputEvent()->GetNumberOfCaloClusters();
+  for (Int_t i = 0; i < nClusters; i++) 
+  {
+    AliVCluster *clus =  InputEvent()->GetCaloCluster(i);
+    
+    if (!clus) continue;
+    
+    if (!clus->IsEMCAL()) continue ;
+    
+    Int_t      label = clus->GetLabel();
+    UShort_t * index = clus->GetCellsAbsId() ;
+    
+    for(Int_t icell=0; icell < clus->GetNCells(); icell++)
+    {
+      if(!fSetCellMCLabelFromEdepFrac) 
+        fCellLabels[index[icell]] = label;
+      
+      fOrgClusterCellId[index[icell]] = i ; // index of the original cluster
+    } // cell in cluster loop
+  } // cluster loop
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskEMCALClusterizeFast::BuildNeighbourTable()
+{
+  // Precompute the side-sharing neighbours of each cell within its supermodule,
+  // and size the flat cell arrays to the number of cells of the geometry
+
+  const Int_t ncells = fGeom->GetNCells();
+  fNeighbours.assign(4*ncells, -1);
+  fFlatCellE.assign(ncells, 0);
+  fFlatCellTime.assign(ncells, 0);
+  fFlatCellEFrac.assign(ncells, 0);
+  fFlatCellMCLabel.assign(ncells, -1);
+  fFlatCellCluster.assign(ncells, -1);
+  fFlatCellIds.clear();
+
+  const Int_t dPhi[4] = {-1, 1,  0, 0};
+  const Int_t dEta[4] = { 0, 0, -1, 1};
+  for (Int_t absId = 0; absId < ncells; ++absId) {
+    Int_t imod = -1, iTower = -1, iIphi = -1, iIeta = -1, iphi = -1, ieta = -1;
+    if (!fGeom->GetCellIndex(absId, imod, iTower, iIphi, iIeta))
+      continue;
+    fGeom->GetCellPhiEtaIndexInSModule(imod, iTower, iIphi, iIeta, iphi, ieta);
+
+    for (Int_t k = 0; k < 4; ++k) {
+      Int_t nphi = iphi + dPhi[k];
+      Int_t neta = ieta + dEta[k];
+      if (nphi < 0 || nphi >= AliEMCALGeoParams::fgkEMCALRows || neta < 0 || neta >= AliEMCALGeoParams::fgkEMCALCols)
+        continue;
+      Int_t nId = fGeom->GetAbsCellIdFromCellIndexes(imod, nphi, neta);
+      if (nId < 0 || nId >= ncells)
+        continue;
+      // map back to reject indexes outside of the smaller supermodules
+      Int_t jmod = -1, jTower = -1, jIphi = -1, jIeta = -1, jphi = -1, jeta = -1;
+      if (!fGeom->GetCellIndex(nId, jmod, jTower, jIphi, jIeta))
+        continue;
+      fGeom->GetCellPhiEtaIndexInSModule(jmod, jTower, jIphi, jIeta, jphi, jeta);
+      if (jmod != imod || jphi != nphi || jeta != neta)
+        continue;
+      fNeighbours[4*absId+k] = nId;
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskEMCALClusterizeFast::FillFlatCells()
+{
+  // Fill the flat cell array used by the flat clusterizer
+
+  for (UInt_t i = 0; i < fFlatCellIds.size(); ++i) {
+    Int_t absId = fFlatCellIds[i];
+    fFlatCellE[absId]       = 0;
+    fFlatCellCluster[absId] = -1;
+  }
+  fFlatCellIds.clear();
+
+  if (fSetCellMCLabelFromCluster)
+    SetCellLabelsFromClusters();
+
+  const Int_t ncells = fCaloCells->GetNumberOfCells();
+  const Int_t maxId  = fFlatCellE.size();
+  for (Int_t icell = 0; icell < ncells; ++icell) 
+  {
+    Double_t cellTime=0, amp = 0, cellEFrac = 0;
+    Short_t  cellNumber=0;
+    Int_t cellMCLabel=-1;
+    if (fCaloCells->GetCell(icell, cellNumber, amp, cellTime, cellMCLabel, cellEFrac) != kTRUE)
+      break;
+
+    if (fSetCellMCLabelFromCluster) cellMCLabel = fCellLabels[cellNumber];
+
+    if (cellMCLabel > 0 && cellEFrac < 1e-6) 
+      cellEFrac = 1;
+
+    if (amp < 1e-6 || cellNumber < 0 || cellNumber >= maxId)
+      continue;
+
+    if(!AcceptCell(cellNumber)) continue;
+
+    fFlatCellE[cellNumber]       = amp;
+    fFlatCellTime[cellNumber]    = cellTime;
+    fFlatCellEFrac[cellNumber]   = cellEFrac;
+    fFlatCellMCLabel[cellNumber] = cellMCLabel;
+    fFlatCellIds.push_back(cellNumber);
+  }
+}
+
+//________________________________________________________________________________________
+void AliAnalysisTaskEMCALClusterizeFast::FlatCells2Clusters(TClonesArray *clus)
+{
+  // Clusterize the flat cell array and fill the clusters directly.
+  // Seeds above the clustering threshold are taken in decreasing energy order and grown
+  // through side-sharing neighbours above the minimum cell energy, as in the v1 clusterizer.
+  // Position and shower shape are computed by the reco utils from the cells.
+
+  // tracks array for track/cluster matching
+  TClonesArray *tarr = 0;
+  if (!fTrackName.IsNull()) {
+    tarr = dynamic_cast<TClonesArray*>(InputEvent()->FindListObject(fTrackName));
+    if (!tarr) {
+      AliError(Form("Cannot get tracks named %s", fTrackName.Data()));
+    }
+  }
+
+  const Double_t seedCut   = fRecParam->GetClusteringThreshold();
+  const Double_t minECut   = fRecParam->GetMinECut();
+  const Double_t locMaxCut = fRecParam->GetLocMaxCut();
+  const Double_t timeCut   = fRecParam->GetTimeCut();
+  const Double_t timeMin   = fRecParam->GetTimeMin();
+  const Double_t timeMax   = fRecParam->GetTimeMax();
+
+  std::vector<std::pair<Double_t,Int_t> > seeds;
+  seeds.reserve(fFlatCellIds.size());
+  for (UInt_t i = 0; i < fFlatCellIds.size(); ++i) {
+    Int_t absId = fFlatCellIds[i];
+    if (fFlatCellE[absId] > seedCut)
+      seeds.push_back(std::make_pair(fFlatCellE[absId], absId));
+  }
+  std::sort(seeds.begin(), seeds.end(), std::greater<std::pair<Double_t,Int_t> >());
+
+  std::vector<Int_t> members;
+  std::vector<std::pair<Double_t,Int_t> > cellLabels;
+  std::vector<Int_t> labels;
+
+  Int_t nout  = clus->GetEntries();
+  Int_t iclus = 0;
+  for (UInt_t iseed = 0; iseed < seeds.size(); ++iseed) 
+  {
+    Int_t seedId = seeds[iseed].second;
+    if (fFlatCellCluster[seedId] >= 0)
+      continue;
+    if (fFlatCellTime[seedId] < timeMin || fFlatCellTime[seedId] > timeMax)
+      continue;
+
+    members.clear();
+    members.push_back(seedId);
+    fFlatCellCluster[seedId] = iclus;
+    for (UInt_t m = 0; m < members.size(); ++m) {
+      Int_t absId = members[m];
+      for (Int_t k = 0; k < 4; ++k) {
+        Int_t nId = fNeighbours[4*absId+k];
+        if (nId < 0 || fFlatCellCluster[nId] >= 0)
+          continue;
+        if (fFlatCellE[nId] <= 0 || fFlatCellE[nId] < minECut)
+          continue;
+        if (fFlatCellTime[nId] < timeMin || fFlatCellTime[nId] > timeMax)
+          continue;
+        if (TMath::Abs(fFlatCellTime[nId] - fFlatCellTime[absId]) > timeCut)
+          continue;
+        fFlatCellCluster[nId] = iclus;
+        members.push_back(nId);
+      }
+    }
+
+    const Int_t ncells = members.size();
+    UShort_t   absIds[ncells];  
+    Double32_t ratios[ncells];
+    Double_t energy = 0, mcEnergy = 0;
+    Int_t nExMax = 0;
+    cellLabels.clear();
+
+    for (Int_t c = 0; c < ncells; ++c) 
+    {
+      Int_t absId = members[c];
+      absIds[c] = absId;
+      ratios[c] = 1;
+      energy += fFlatCellE[absId];
+
+      if (fFlatCellMCLabel[absId] > 0)
+        mcEnergy += fFlatCellEFrac[absId]*fFlatCellE[absId];
+      if (fFlatCellMCLabel[absId] >= 0)
+        cellLabels.push_back(std::make_pair(fFlatCellE[absId], fFlatCellMCLabel[absId]));
+
+      Bool_t isLocMax = kTRUE;
+      for (Int_t k = 0; k < 4 && isLocMax; ++k) {
+        Int_t nId = fNeighbours[4*absId+k];
+        if (nId >= 0 && fFlatCellCluster[nId] == iclus && fFlatCellE[absId] - fFlatCellE[nId] <= locMaxCut)
+          isLocMax = kFALSE;
+      }
+      if (isLocMax)
+        ++nExMax;
+    }
+    mcEnergy /= energy;
+
+    // MC labels ordered by the energy of the cells carrying them
+    std::sort(cellLabels.begin(), cellLabels.end(), std::greater<std::pair<Double_t,Int_t> >());
+    labels.clear();
+    for (UInt_t l = 0; l < cellLabels.size(); ++l) {
+      if (std::find(labels.begin(), labels.end(), cellLabels[l].second) == labels.end())
+        labels.push_back(cellLabels[l].second);
+    }
+
+    AliVCluster *c = static_cast<AliVCluster*>(clus->New(nout++));
+    c->SetType(AliVCluster::kEMCALClusterv1);
+    c->SetE(energy);
+    c->SetNCells(ncells);
+    c->SetCellsAbsId(absIds);
+    c->SetCellsAmplitudeFraction(ratios);
+    c->SetID(iclus);
+    c->SetEmcCpvDistance(-1);
+    c->SetChi2(-1);
+    c->SetTOF(fFlatCellTime[seedId]);  //time-of-flight of the seed (highest energy) cell
+    c->SetNExMax(nExMax);               //number of local maxima
+    c->SetMCEnergyFraction(mcEnergy);
+    if (!labels.empty())
+      c->SetLabel(&labels[0], labels.size());
+
+    fRecoUtils->RecalculateClusterPosition(fGeom, fCaloCells, c);
+    fRecoUtils->RecalculateClusterShowerShapeParameters(fGeom, fCaloCells, c);
+
+    //
+    // Track matching
+    //
+    if (tarr)
+      TrackClusterMatching(c, tarr);
+
+    ++iclus;
+  }
+}
+
 //________________________________________________________________________________________
 Bool_t AliAnalysisTaskEMCALClusterizeFast::AcceptCell(Int_t cellNumber) {
 
@@ -929,7 +1180,10 @@ void AliAnalysisTaskEMCALClusterizeFast::UpdateClusters()
 
   fCaloClusters->Compress();
   
-  RecPoints2Clusters(fCaloClusters);
+  if (fFlatClusterizerOn)
+    FlatCells2Clusters(fCaloClusters);
+  else
+    RecPoints2Clusters(fCaloClusters);
 }
 
 //________________________________________________________________________________________
@@ -1057,6 +1311,26 @@ void AliAnalysisTaskEMCALClusterizeFast::Init()
   fClusterizer->SetOutput(0);
   fClusterArr = const_cast<TObjArray *>(fClusterizer->GetRecPoints());
 
+  // Flat clusterizer: cells are used as they are, so only calibrated FEE cells are supported
+  fFlatClusterizerOn = kFALSE;
+  if (fUseFlatClusterizer) {
+    if (fInputCellType != kFEEData || fCalibData || fSubBackground || fDoUpdateCells || !fDoClusterize || fSetCellMCLabelFromEdepFrac) {
+      AliWarning("Flat clusterizer requires calibrated FEE cells, no background subtraction, no cell update and no edep-fraction labels; using digits and recpoints");
+    }
+    else {
+      if (!fRecoUtils) {
+        fRecoUtils = new AliEMCALRecoUtils;
+        fRecoUtils->SetW0(fRecParam->GetW0());
+      }
+      if (fRecoUtils->GetPositionAlgorithm() == AliEMCALRecoUtils::kUnchanged) {
+        AliInfo("Flat clusterizer: using global tower position algorithm");
+        fRecoUtils->SetPositionAlgorithm(AliEMCALRecoUtils::kPosTowerGlobal);
+      }
+      BuildNeighbourTable();
+      fFlatClusterizerOn = kTRUE;
+    }
+  }
+
   // Get the emcal cells
   if ((fInputCellType == kFEEData ||  fInputCellType == kFEEDataMCOnly || fInputCellType == kFEEDataExcludeMC) && !fCaloCells) {
     if (fCaloCellsName.IsNull()) {
@@ -27,6 +27,8 @@ class AliEMCALRecoUtils;
 class AliVCaloCells;
 class AliEMCALGeometry;
 
+#include <vector>
+
 #include "AliEMCALGeoParams.h"
 
 #include "AliAnalysisTaskSE.h"
@@ -69,6 +71,7 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   Int_t                  GetShiftEta()                                const   { return fShiftEta                     ; }
   Bool_t                 GetTRUShift()                                const   { return fTRUShift                     ; }
   InputCellType          GetInputCellType()                           const   { return fInputCellType                ; }
+  Bool_t                 GetUseFlatClusterizer()                      const   { return fUseFlatClusterizer           ; }
   void                   JustUnfold(Bool_t yesno)                             { fJustUnfold                  = yesno ; }
   void                   LoadOwnGeometryMatrices(Bool_t b)                    { fLoadGeomMatrices            = b     ; }
   void                   SetAODBranchName(const char *name)                   { fOutputAODBrName             = name  ; }
@@ -100,6 +103,7 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   void                   SetDoNonLinearity(Bool_t b)                          { fDoNonLinearity              = b     ; }
   void                   SetRecalDistToBadChannels(Bool_t b)                  { fRecalDistToBadChannels      = b     ; }
   void                   SetCellMCLabelFromCluster(Int_t s)                   { fSetCellMCLabelFromCluster   = s     ; }
+  void                   SetUseFlatClusterizer(Bool_t b)                      { fUseFlatClusterizer          = b     ; }
 
   // For backward compatibility
   const TString         &GetNewClusterArrayName()                     const   { return GetCaloClustersName()         ; }
@@ -120,6 +124,10 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   virtual void           CalibrateClusters();
   virtual void           TrackClusterMatching(AliVCluster *c, TClonesArray *tarr);
   virtual void           CopyClusters(TClonesArray *orig, TClonesArray *dest);
+  void                   SetCellLabelsFromClusters();
+  void                   BuildNeighbourTable();
+  virtual void           FillFlatCells();
+  virtual void           FlatCells2Clusters(TClonesArray *clus);
 
   Int_t                  fRun;                            //!run number
   TClonesArray          *fDigitsArr;                      //!digits array
@@ -172,6 +180,8 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   
   Bool_t                 fSetCellMCLabelFromEdepFrac;     // For MC generated with aliroot > v5-07-21, check the EDep information 
                                                           // stored in ESDs/AODs to set the cell MC labels
+
+  Bool_t                 fUseFlatClusterizer;             // clusterize directly from a flat cell array, without digits and recpoints (kFEEData only)
   
   AliVCaloCells         *fCaloCells;                      //!calo cells object
   TClonesArray          *fCaloClusters;                   //!calo clusters array       
@@ -179,10 +189,20 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   AliAODEvent           *fAod;                            //!aod event
   AliEMCALGeometry      *fGeom;                           //!geometry object
 
+  // Flat clusterizer
+  Bool_t                 fFlatClusterizerOn;              //!flat clusterizer usable with the current settings
+  std::vector<Int_t>     fNeighbours;                     //!absId -> 4 side-sharing neighbours in the same SM (-1 if none)
+  std::vector<Int_t>     fFlatCellIds;                    //!absIds of the cells accepted in the event
+  std::vector<Double_t>  fFlatCellE;                      //!cell energy by absId
+  std::vector<Double_t>  fFlatCellTime;                   //!cell time by absId
+  std::vector<Double_t>  fFlatCellEFrac;                  //!cell MC energy fraction by absId
+  std::vector<Int_t>     fFlatCellMCLabel;                //!cell MC label by absId
+  std::vector<Int_t>     fFlatCellCluster;                //!index of the cluster the cell was assigned to (-1 if none)
+
  private:
   AliAnalysisTaskEMCALClusterizeFast(const AliAnalysisTaskEMCALClusterizeFast&);            // not implemented
   AliAnalysisTaskEMCALClusterizeFast &operator=(const AliAnalysisTaskEMCALClusterizeFast&); // not implemented
 
-  ClassDef(AliAnalysisTaskEMCALClusterizeFast, 10);
+  ClassDef(AliAnalysisTaskEMCALClusterizeFast, 11);
 };
 #endif //ALIANALYSISTASKEMCALCLUSTERIZEFAST_H
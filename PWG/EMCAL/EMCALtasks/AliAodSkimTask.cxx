@@ -26,7 +26,9 @@ AliAodSkimTask::AliAodSkimTask(const char* name) :
   fDoCopyHeader(1),  fDoCopyVZERO(1),  fDoCopyTZERO(1),  fDoCopyVertices(1),  fDoCopyTOF(1), fDoCopyTracklets(1), fDoCopyTracks(1), fDoRemoveTracks(0), fDoCleanTracks(0),
   fDoRemCovMat(0), fDoRemPid(0), fDoCopyTrigger(1), fDoCopyPTrigger(0), fDoCopyCells(1), fDoCopyPCells(0), fDoCopyClusters(1), fDoCopyDiMuons(0),  fDoCopyTrdTracks(0),
   fDoCopyV0s(0), fDoCopyCascades(0), fDoCopyZDC(1), fDoCopyConv(0), fDoCopyMC(1), fDoCopyMCHeader(1), fDoVertWoRefs(0), fDoVertMain(0), fDoCleanTracklets(0),
-  fTrials(0), fPyxsec(0), fPytrials(0), fPypthardbin(0), fAOD(0), fAODMcHeader(0), fOutputList(0), fHevs(0), fHclus(0), fHtrack(0)
+  fSkimNames(), fSkimClusMinE(), fSkimTrackMinPt(), fSkimBoth(),
+  fTrials(0), fPyxsec(0), fPytrials(0), fPypthardbin(0), fAOD(0), fAODMcHeader(0), fOutputList(0), fHevs(0), fHclus(0), fHtrack(0),
+  fHskims(0), fSkimMask(0), fSkimMaskPar(0)
 {
   if (name) {
     DefineInput(0, TChain::Class());
@@ -44,6 +46,42 @@ AliAodSkimTask::~AliAodSkimTask()
   delete fHtrack;
 }
 
+void AliAodSkimTask::AddSkim(const char *name, Double_t clusMinE, Double_t trackMinPt, Bool_t both)
+{
+  // Additional skim evaluated in the same pass as the main selection. The event is written
+  // if any skim accepts it, and the mask of accepting skims is stored in the output AOD.
+  if (fSkimNames.size()>=31) {
+    AliError(Form("%s: Cannot add skim %s, at most 31 additional skims are supported",GetName(),name));
+    return;
+  }
+  fSkimNames.push_back(name);
+  fSkimClusMinE.push_back(clusMinE);
+  fSkimTrackMinPt.push_back(trackMinPt);
+  fSkimBoth.push_back(both);
+}
+
+Bool_t AliAodSkimTask::PassSkim(Double_t clusMinE, Double_t trackMinPt, Bool_t both, Double_t maxE, Double_t maxPt) const
+{
+  Bool_t storeE  = (clusMinE<=0)   || (maxE>clusMinE);
+  Bool_t storePt = (trackMinPt<=0) || (maxPt>trackMinPt);
+
+  Bool_t store = kFALSE;
+  if (both && clusMinE>0 && trackMinPt > 0){
+    // request that both conditions are full-filled for propagating the event
+    store     = (storeE && storePt);
+  } else if (!both && clusMinE>0 && trackMinPt > 0){
+    // request that at least one of the conditions is fullfilled
+    store     = (storeE || storePt);
+  } else if ( clusMinE>0 ){
+    store     = storeE;
+  } else if ( trackMinPt>0 ){
+    store     = storePt;
+  } else {
+    store     = kTRUE;
+  }
+  return store;
+}
+
 Bool_t AliAodSkimTask::KeepTrack(AliAODTrack *t)
 {
   if (!fDoRemoveTracks)
@@ -120,6 +158,16 @@ void AliAodSkimTask::UserCreateOutputObjects()
   fOutputList->Add(fHclus);
   fHtrack = new TH1F("hTrack",";p_{T} (GeV/c)",200,0,100);
   fOutputList->Add(fHtrack);
+  if (!fSkimNames.empty()) {
+    const Int_t nskims = fSkimNames.size()+1;
+    fHskims = new TH1F("hSkims","",nskims,-0.5,nskims-0.5);
+    fHskims->GetXaxis()->SetBinLabel(1,"main");
+    for (Int_t i=1;i<nskims;++i)
+      fHskims->GetXaxis()->SetBinLabel(i+1,fSkimNames[i-1]);
+    fOutputList->Add(fHskims);
+    fSkimMaskPar = new TParameter<Int_t>("AodSkimMask",0);
+    AddAODBranch("TParameter<Int_t>",&fSkimMaskPar);
+  }
   PostData(1, fOutputList);
 }
 
@@ -137,9 +185,19 @@ void AliAodSkimTask::UserExec(Option_t *)
   }
   oh->SetFillAOD(kFALSE);
 
-  // Accept event only if an EMCal-cluster with a minimum energy of fClusMinE has been found in the event
-  Bool_t storeE = kFALSE;
-  if (fClusMinE>0) {
+  // The cluster and track loops are done once for the main selection and all additional skims
+  Bool_t needClus  = (fClusMinE>0);
+  Bool_t needTrack = (fTrackMinPt>0);
+  for (UInt_t i=0; i<fSkimNames.size(); ++i) {
+    if (fSkimClusMinE[i]>0)
+      needClus = kTRUE;
+    if (fSkimTrackMinPt[i]>0)
+      needTrack = kTRUE;
+  }
+
+  // Highest EMCal-cluster energy, to be compared with the minimum energy of each selection
+  Double_t maxE = -1;
+  if (needClus) {
     TClonesArray *cls  = fAOD->GetCaloClusters();
     for (Int_t i=0; i<cls->GetEntriesFast(); ++i) {
       AliAODCaloCluster *clus = static_cast<AliAODCaloCluster*>(cls->At(i));
@@ -147,45 +205,42 @@ void AliAodSkimTask::UserExec(Option_t *)
         continue;
       Double_t e = clus->E();
       fHclus->Fill(e);
-      if (e>fClusMinE) {
-        storeE = kTRUE;
+      if (e>maxE) {
+        maxE = e;
       }
     }
-  } else {
-    storeE = kTRUE;
   }
 
-  // Accept event only if an track with a minimum pT of fTrackMinPt has been found in the event
-  Bool_t storePt = kFALSE;
-  if (fTrackMinPt > 0 ){
+  // Highest track pT, to be compared with the minimum pT of each selection
+  Double_t maxPt = -1;
+  if (needTrack) {
     TClonesArray *tracks = fAOD->GetTracks();
     for (Int_t i=0;i<tracks->GetEntries();++i) {
       AliAODTrack *t = static_cast<AliAODTrack*>(tracks->At(i));
       Double_t pt = t->Pt();
       fHtrack->Fill(pt);
-      if (pt>fTrackMinPt) {
-        storePt = kTRUE;
+      if (pt>maxPt) {
+        maxPt = pt;
       }
     }
-  } else {
-    storePt = kTRUE;
   }
 
-  Bool_t store = kFALSE;
-  if (fDoBothMinTrackAndClus && fClusMinE>0 && fTrackMinPt > 0){
-    // request that both conditions are full-filled for propagating the event
-    store     = (storeE && storePt);
-  } else if (!fDoBothMinTrackAndClus && fClusMinE>0 && fTrackMinPt > 0){
-    // request that at least one of the conditions is fullfilled
-    store     = (storeE || storePt);
-  } else if ( fClusMinE>0 ){
-    store     = storeE;
-  } else if ( fTrackMinPt>0 ){
-    store     = storePt;
-  } else {
-    store     = kTRUE;
+  fSkimMask = 0;
+  if (PassSkim(fClusMinE,fTrackMinPt,fDoBothMinTrackAndClus,maxE,maxPt))
+    fSkimMask |= 1;
+  for (UInt_t i=0; i<fSkimNames.size(); ++i) {
+    if (PassSkim(fSkimClusMinE[i],fSkimTrackMinPt[i],fSkimBoth[i],maxE,maxPt))
+      fSkimMask |= (1<<(i+1));
+  }
+  if (fHskims) {
+    for (UInt_t i=0; i<=fSkimNames.size(); ++i) {
+      if (fSkimMask&(1<<i))
+        fHskims->Fill(i);
+    }
   }
 
+  Bool_t store = (fSkimMask!=0);
+
   if (!store) {
     ++fTrials;
     fHevs->Fill(0);
@@ -193,6 +248,8 @@ void AliAodSkimTask::UserExec(Option_t *)
   }
 
   fHevs->Fill(1);
+  if (fSkimMaskPar)
+    fSkimMaskPar->SetVal(fSkimMask);
 
   oh->SetFillAOD(kTRUE);
   AliAODEvent *eout = dynamic_cast<AliAODEvent*>(oh->GetAOD());
@@ -10,6 +10,8 @@
 
 #include <AliAnalysisTaskSE.h>
 #include <TString.h>
+#include <TParameter.h>
+#include <vector>
 class AliAODMCHeader;
 class TH1F;
 
@@ -18,6 +20,8 @@ class AliAodSkimTask: public AliAnalysisTaskSE
   public:
     AliAodSkimTask(const char *name=0);
     virtual              ~AliAodSkimTask();
+    void                  AddSkim(const char *name, Double_t clusMinE, Double_t trackMinPt, Bool_t both=0);
+    UInt_t                GetSkimMask() const                 {return fSkimMask;}
     void                  SetCleanTracklets(Bool_t b)         {fDoCleanTracklets=b;}
     void                  SetCleanTracks(Bool_t b)            {fDoCleanTracks=b;}
     void                  SetClusMinE(Double_t v)             {fClusMinE=v;}
@@ -60,6 +64,7 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     Bool_t                UserNotify();
     void                  Terminate(Option_t* option);
     Bool_t                PythiaInfoFromFile(const char *currFile, Float_t &xsec, Float_t &trials, Int_t &pthard);
+    Bool_t                PassSkim(Double_t clusMinE, Double_t trackMinPt, Bool_t both, Double_t maxE, Double_t maxPt) const;
     Double_t              fClusMinE;              //  minimum cluster energy to accept event
     Double_t              fTrackMinPt;            //  minimum track pt to accept event
     Bool_t                fDoBothMinTrackAndClus; // switch to enable simultaneous filtering for minimum track and cluster cuts
@@ -95,6 +100,10 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     Bool_t                fDoVertWoRefs;          //  if true then do not copy TRefs in vertices
     Bool_t                fDoVertMain;            //  if true then only copy main vertices
     Bool_t                fDoCleanTracklets;      //  if true then clean tracklets
+    std::vector<TString>  fSkimNames;             //  names of additional skims
+    std::vector<Double_t> fSkimClusMinE;          //  minimum cluster energy per additional skim
+    std::vector<Double_t> fSkimTrackMinPt;        //  minimum track pt per additional skim
+    std::vector<Int_t>    fSkimBoth;              //  require both track and cluster cuts per additional skim
     UInt_t                fTrials;                //! events seen since last acceptance
     Float_t               fPyxsec;                //! pythia xsection
     Float_t               fPytrials;              //! pythia trials
@@ -105,12 +114,15 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     TH1F                 *fHevs;                  //! events processed/accepted
     TH1F                 *fHclus;                 //! cluster distribution
     TH1F                 *fHtrack;                //! track distribution
-    const char           *GetVersion() const { return "1.4"; }
+    TH1F                 *fHskims;                //! events accepted per skim
+    UInt_t                fSkimMask;              //! skims accepting the current event (bit 0 = main selection)
+    TParameter<Int_t>    *fSkimMaskPar;           //! skim mask written to the output AOD
+    const char           *GetVersion() const { return "1.5"; }
     virtual Bool_t        KeepTrack(AliAODTrack *t);
     virtual void          CleanTrack(AliAODTrack *t);
 
     AliAodSkimTask(const AliAodSkimTask&);             // not implemented
     AliAodSkimTask& operator=(const AliAodSkimTask&);  // not implemented
-    ClassDef(AliAodSkimTask, 6); // AliAodSkimTask
+    ClassDef(AliAodSkimTask, 7); // AliAodSkimTask
 };
 #endif
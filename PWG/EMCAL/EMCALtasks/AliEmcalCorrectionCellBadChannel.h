@@ -31,6 +31,8 @@ class AliEmcalCorrectionCellBadChannel : public AliEmcalCorrectionComponent {
   Bool_t Initialize();
   void UserCreateOutputObjects();
   Bool_t Run();
+  // Only in the fused cell pass without QA histograms, since these need the cells after each component
+  Bool_t CanFuseCellCorrection() const { return !fCreateHisto; }
   Bool_t CheckIfRunChanged();
   
 protected:
@@ -90,38 +90,70 @@ Bool_t AliEmcalCorrectionCellEnergyVariation::Run()
 {
   AliEmcalCorrectionComponent::Run();
   
+  // The cells are scaled later by the correction task, in one pass together with the other fused components
+  if (fFusedCellCorrection) {
+    fFusedCellCorrectionPending = kTRUE;
+    return kTRUE;
+  }
+  
+  // Loop over all EMCal cells
+  for (Int_t iCell = 0; iCell < fCaloCells->GetNumberOfCells(); iCell++){
+    ScaleCellEnergy(iCell);
+  }
+
+  return kTRUE;
+}
+
+/**
+ * Scale the energy of the cell at a given position in the cell collection
+ * @param iCell Position of the cell
+ */
+void AliEmcalCorrectionCellEnergyVariation::ScaleCellEnergy(Int_t iCell)
+{
   Short_t  absId  =-1;
   Double_t ecell = 0;
   Double_t tcell = 0;
   Double_t efrac = 0;
   Int_t  mclabel = -1;
   
-  // Loop over all EMCal cells
-  for (Int_t iCell = 0; iCell < fCaloCells->GetNumberOfCells(); iCell++){
-    
-    // Get cell
-    Bool_t getCellResult = fCaloCells->GetCell(iCell, absId, ecell, tcell, mclabel, efrac);
-    if (!getCellResult) {
-      AliWarning(TString::Format("Could not get cell %i from cell collection %s", iCell, fCaloCells->GetName()));
-    }
+  // Get cell
+  Bool_t getCellResult = fCaloCells->GetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+  if (!getCellResult) {
+    AliWarning(TString::Format("Could not get cell %i from cell collection %s", iCell, fCaloCells->GetName()));
+  }
+  
+  // Get high gain attribute in addition to cell
+  // NOTE: GetCellHighGain() uses the cell position, not cell index, and thus should _NOT_ be used!
+  Bool_t cellHighGain = fCaloCells->GetHighGain(iCell);
+  
+  // Scale cell energy by TF1, if supplied
+  if (fEnergyScaleFunction && ecell > fMinCellE && ecell < fMaxCellE) {
     
-    // Get high gain attribute in addition to cell
-    // NOTE: GetCellHighGain() uses the cell position, not cell index, and thus should _NOT_ be used!
-    Bool_t cellHighGain = fCaloCells->GetHighGain(iCell);
+    ecell *= fEnergyScaleFunction->Eval(ecell);
     
-    // Scale cell energy by TF1, if supplied
-    if (fEnergyScaleFunction && ecell > fMinCellE && ecell < fMaxCellE) {
-      
-      ecell *= fEnergyScaleFunction->Eval(ecell);
-      
-      if (ecell > 0.) {
-        fCaloCells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac, cellHighGain);
-      }
+    if (ecell > 0.) {
+      fCaloCells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac, cellHighGain);
     }
-    
   }
+}
 
-  return kTRUE;
+/**
+ * Scale one cell in the fused cell pass of the correction task
+ * @param iCell Position of the cell
+ */
+void AliEmcalCorrectionCellEnergyVariation::CorrectCellFused(Int_t iCell)
+{
+  ScaleCellEnergy(iCell);
+}
+
+/**
+ * Called by the correction task once the fused cell pass is done.
+ * @return False, the cells are not sorted by Run() either
+ */
+Bool_t AliEmcalCorrectionCellEnergyVariation::FinishFusedCellCorrection()
+{
+  fFusedCellCorrectionPending = kFALSE;
+  return kFALSE;
 }
 
 /**
@@ -30,11 +30,16 @@ class AliEmcalCorrectionCellEnergyVariation : public AliEmcalCorrectionComponent
   void UserCreateOutputObjects();
   void ExecOnce();
   Bool_t Run();
+  Bool_t CanFuseCellCorrection() const { return kTRUE; }
+  void CorrectCellFused(Int_t iCell);
+  Bool_t FinishFusedCellCorrection();
   
 protected:
   
   // Load cell energy scale function TF1 into fEnergyScaleFunction
   void LoadEnergyScaleFunction(const std::string & path, const std::string & name);
+  // Scale the energy of one cell
+  void ScaleCellEnergy(Int_t iCell);
   
   Double_t               fMinCellE;                       ///< Min cell E to perform scaling on
   Double_t               fMaxCellE;                       ///< Max cell E to perform scaling on
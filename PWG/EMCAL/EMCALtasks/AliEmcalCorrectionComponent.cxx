@@ -51,7 +51,18 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent() :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fFusedCellCorrection(kFALSE),
+  fFusedCellCorrectionPending(kFALSE),
+  fFusedCellSteps(0),
+  fFusedCellBunchCrossing(-1),
+  fFusedCellTablesRun(-1),
+  fFusedCellTablesSteps(0),
+  fFusedCellStatus(),
+  fFusedCellSM(),
+  fFusedCellEnergyFactor(),
+  fFusedCellTimeFactor(),
+  fFusedCellL1PhaseShift()
 
 {
   fVertex[0] = 0;
@@ -86,7 +97,18 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fFusedCellCorrection(kFALSE),
+  fFusedCellCorrectionPending(kFALSE),
+  fFusedCellSteps(0),
+  fFusedCellBunchCrossing(-1),
+  fFusedCellTablesRun(-1),
+  fFusedCellTablesSteps(0),
+  fFusedCellStatus(),
+  fFusedCellSM(),
+  fFusedCellEnergyFactor(),
+  fFusedCellTimeFactor(),
+  fFusedCellL1PhaseShift()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -206,12 +228,163 @@ void AliEmcalCorrectionComponent::UpdateCells()
   
   Int_t bunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
   
+  // The cells are corrected later by the correction task, in one pass together with the other fused components
+  if (fFusedCellCorrection) {
+    PrepareFusedCellCorrection(bunchCrossNo);
+    return;
+  }
+  
   if (fRecoUtils)
     fRecoUtils->RecalibrateCells(fCaloCells, bunchCrossNo);
   
   fCaloCells->Sort();
 }
 
+/**
+ * Record which steps of AliEMCALRecoUtils::RecalibrateCells() have to be applied to the cells of
+ * the current event, with the reco utils configured as they are now, and (re)fill the per cell
+ * tables if the run changed. Called by UpdateCells() in fused mode.
+ * @param[in] bunchCrossNo Bunch crossing number of the event
+ */
+void AliEmcalCorrectionComponent::PrepareFusedCellCorrection(Int_t bunchCrossNo)
+{
+  fFusedCellSteps = 0;
+  fFusedCellBunchCrossing = bunchCrossNo;
+  fFusedCellCorrectionPending = kTRUE;
+
+  if (!fRecoUtils) return;
+  if (!fRecoUtils->IsRecalibrationOn() && !fRecoUtils->IsTimeRecalibrationOn() && !fRecoUtils->IsBadChannelsRemovalSwitchedOn()) return;
+
+  fFusedCellSteps |= kFusedCellActive;
+  if (fRecoUtils->IsBadChannelsRemovalSwitchedOn()) fFusedCellSteps |= kFusedCellBadChannels;
+  if (!fRecoUtils->AreCellsCalibrated()) {
+    if (fRecoUtils->IsRecalibrationOn()) fFusedCellSteps |= kFusedCellRecalibration;
+    if (bunchCrossNo >= 0 && fRecoUtils->IsTimeRecalibrationOn()) {
+      fFusedCellSteps |= kFusedCellTimeRecalibration;
+      if (fRecoUtils->IsLGOn()) fFusedCellSteps |= kFusedCellLowGain;
+    }
+    if (bunchCrossNo >= 0 && fRecoUtils->IsL1PhaseInTimeRecalibrationOn()) fFusedCellSteps |= kFusedCellL1Phase;
+  }
+
+  // The calibration maps only change when the run changes (see CheckIfRunChanged())
+  if (fFusedCellTablesRun != fRun || (fFusedCellSteps & ~fFusedCellTablesSteps)) BuildFusedCellTables();
+}
+
+/**
+ * Fill the flat per cell tables with the bad channel status and the calibration factors of the
+ * reco utils, such that the fused cell pass does not need the geometry or the calibration histograms.
+ */
+void AliEmcalCorrectionComponent::BuildFusedCellTables()
+{
+  fFusedCellTablesRun = fRun;
+  fFusedCellTablesSteps = fFusedCellSteps;
+  fFusedCellStatus.clear();
+  fFusedCellSM.clear();
+  fFusedCellEnergyFactor.clear();
+  fFusedCellTimeFactor.clear();
+  fFusedCellL1PhaseShift.clear();
+
+  // Without geometry all cells are rejected, as in AliEMCALRecoUtils::AcceptCalibrateCell()
+  AliEMCALGeometry* geom = AliEMCALGeometry::GetInstance();
+  if (!geom) {
+    AliError("No instance of the geometry is available");
+    return;
+  }
+
+  const Int_t nSM = geom->GetNumberOfSuperModules();
+  const Int_t nCells = 24*48*nSM;
+  fFusedCellStatus.assign(nCells, 2);
+  fFusedCellSM.assign(nCells, -1);
+  if (fFusedCellSteps & kFusedCellRecalibration) fFusedCellEnergyFactor.assign(nCells, 1);
+  if (fFusedCellSteps & kFusedCellTimeRecalibration) fFusedCellTimeFactor.assign(8*nCells, 0);
+
+  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0;
+  for (Int_t absId = 0; absId < nCells; absId++) {
+    if (!geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta)) continue;
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
+
+    fFusedCellSM[absId] = imod;
+    fFusedCellStatus[absId] = (fFusedCellSteps & kFusedCellBadChannels) && fRecoUtils->GetEMCALChannelStatus(imod, ieta, iphi, status) ? 1 : 0;
+
+    if (fFusedCellSteps & kFusedCellRecalibration)
+      fFusedCellEnergyFactor[absId] = fRecoUtils->GetEMCALChannelRecalibrationFactor(imod, ieta, iphi);
+
+    if (fFusedCellSteps & kFusedCellTimeRecalibration) {
+      for (Int_t bc = 0; bc < 4; bc++) {
+        fFusedCellTimeFactor[(2*bc)*nCells + absId] = fRecoUtils->GetEMCALChannelTimeRecalibrationFactor(bc, absId, kFALSE);
+        if (fFusedCellSteps & kFusedCellLowGain)
+          fFusedCellTimeFactor[(2*bc+1)*nCells + absId] = fRecoUtils->GetEMCALChannelTimeRecalibrationFactor(bc, absId, kTRUE);
+      }
+    }
+  }
+
+  // Same shifts as AliEMCALRecoUtils::RecalibrateCellTimeL1Phase()
+  if (fFusedCellSteps & kFusedCellL1Phase) {
+    fFusedCellL1PhaseShift.assign(8*nSM, 0);
+    for (Int_t iSM = 0; iSM < nSM; iSM++) {
+      Int_t l1PhaseShift = fRecoUtils->GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
+      Int_t l1Phase = l1PhaseShift & 3;
+      Int_t l1shiftOffset = (l1PhaseShift>>2)*25;
+      for (Int_t bc = 0; bc < 4; bc++) {
+        Float_t offsetPerSM = bc >= l1Phase ? (bc - l1Phase)*25 : (bc - l1Phase + 4)*25;
+        fFusedCellL1PhaseShift[2*(4*iSM + bc)] = offsetPerSM*1.e-9;
+        fFusedCellL1PhaseShift[2*(4*iSM + bc) + 1] = l1shiftOffset*1.e-9;
+      }
+    }
+  }
+}
+
+/**
+ * Correct one cell in the fused cell pass. This gives the same result as the cell loop of
+ * AliEMCALRecoUtils::RecalibrateCells(), using the tables filled in BuildFusedCellTables().
+ * @param[in] iCell Position of the cell in the cells object
+ */
+void AliEmcalCorrectionComponent::CorrectCellFused(Int_t iCell)
+{
+  if (!(fFusedCellSteps & kFusedCellActive)) return;
+
+  Short_t  absId  =-1;
+  Float_t  ecell  = 0;
+  Double_t tcell  = -1;
+  Double_t ecellin = 0;
+  Double_t tcellin = 0;
+  Int_t  mclabel = -1;
+  Double_t efrac = 0;
+
+  fCaloCells->GetCell(iCell, absId, ecellin, tcellin, mclabel, efrac);
+
+  if (absId >= 0 && absId < (Int_t)fFusedCellStatus.size() && fFusedCellStatus[absId] == 0) {
+    ecell = ecellin;
+    if (fFusedCellSteps & kFusedCellRecalibration)
+      ecell *= fFusedCellEnergyFactor[absId];
+
+    tcell = tcellin;
+    tcell -= fRecoUtils->GetConstantTimeShift()*1e-9;
+    if (fFusedCellSteps & kFusedCellTimeRecalibration) {
+      Int_t lowGain = (fFusedCellSteps & kFusedCellLowGain) && !fCaloCells->GetHighGain(iCell);
+      tcell -= fFusedCellTimeFactor[(2*(fFusedCellBunchCrossing%4) + lowGain)*fFusedCellStatus.size() + absId]*1.e-9;
+    }
+    if (fFusedCellSteps & kFusedCellL1Phase) {
+      Int_t index = 2*(4*fFusedCellSM[absId] + fFusedCellBunchCrossing%4);
+      tcell -= fFusedCellL1PhaseShift[index];
+      tcell -= fFusedCellL1PhaseShift[index + 1];
+    }
+  }
+
+  fCaloCells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+}
+
+/**
+ * Called by the correction task once the fused cell pass is done.
+ * @return True if the cells have to be sorted, as done by UpdateCells()
+ */
+Bool_t AliEmcalCorrectionComponent::FinishFusedCellCorrection()
+{
+  fFusedCellCorrectionPending = kFALSE;
+  if (fFusedCellSteps & kFusedCellActive) fRecoUtils->SetCellsCalibrated();
+  return kTRUE;
+}
+
 /**
  * Check whether the run changed.
  */
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 class TH1F;
 #include <TNamed.h>
@@ -60,6 +61,13 @@ class AliEmcalCorrectionComponent : public TNamed {
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
 
+  // Fused cell correction pass, see AliEmcalCorrectionTask::RunFusedCellCorrections()
+  virtual Bool_t CanFuseCellCorrection() const { return kFALSE; }
+  virtual void CorrectCellFused(Int_t iCell);
+  virtual Bool_t FinishFusedCellCorrection();
+  void SetFusedCellCorrection(Bool_t b) { fFusedCellCorrection = b; }
+  Bool_t IsFusedCellCorrectionPending() const { return fFusedCellCorrectionPending; }
+
   // Containers and cells
   AliParticleContainer   *AddParticleContainer(const char *n)                    { return AliEmcalContainerUtils::AddContainer<AliParticleContainer>(n, fParticleCollArray); }
   AliTrackContainer      *AddTrackContainer(const char *n)                       { return AliEmcalContainerUtils::AddContainer<AliTrackContainer>(n, fParticleCollArray); }
@@ -110,6 +118,19 @@ class AliEmcalCorrectionComponent : public TNamed {
   /// Retrieve property
   template<typename T> bool GetProperty(std::string propertyName, T & property, bool requiredProperty = true, std::string correctionName = "");
  protected:
+  /// Steps of AliEMCALRecoUtils::RecalibrateCells() applied in the fused cell pass
+  enum FusedCellStep_t {
+    kFusedCellActive = 1<<0,            ///< RecalibrateCells() would process the cells
+    kFusedCellBadChannels = 1<<1,       ///< Bad channel removal
+    kFusedCellRecalibration = 1<<2,     ///< Energy recalibration
+    kFusedCellTimeRecalibration = 1<<3, ///< Time recalibration
+    kFusedCellLowGain = 1<<4,           ///< Time recalibration with separate low gain factors
+    kFusedCellL1Phase = 1<<5            ///< Time recalibration with the L1 phase
+  };
+
+  void PrepareFusedCellCorrection(Int_t bunchCrossNo);
+  void BuildFusedCellTables();
+
   PWG::Tools::AliYAMLConfiguration fYAMLConfig;           ///< Contains the %YAML configuration used to configure the component
   Bool_t                  fCreateHisto;                   ///< Flag to make some basic histograms
   Int_t                   fRun;                           //!<! Run number
@@ -136,12 +157,24 @@ class AliEmcalCorrectionComponent : public TNamed {
   TString                fBasePath;                       ///< Base folder path to get root files
   TString                fCustomBadChannelFilePath;       ///< Custom path to bad channel map OADB file
 
+  Bool_t                 fFusedCellCorrection;            //!<! UpdateCells() only prepares the fused cell pass of the correction task
+  Bool_t                 fFusedCellCorrectionPending;     //!<! Cells of the current event still to be corrected by the fused cell pass
+  UInt_t                 fFusedCellSteps;                 //!<! Steps (FusedCellStep_t) to apply in the fused cell pass of the current event
+  Int_t                  fFusedCellBunchCrossing;         //!<! Bunch crossing number of the current event
+  Int_t                  fFusedCellTablesRun;             //!<! Run for which the fused cell tables were filled
+  UInt_t                 fFusedCellTablesSteps;           //!<! Steps for which the fused cell tables were filled
+  std::vector<Char_t>    fFusedCellStatus;                //!<! Per absId: 0 accepted, 1 bad channel, 2 not existing
+  std::vector<Short_t>   fFusedCellSM;                    //!<! Per absId: super module
+  std::vector<Float_t>   fFusedCellEnergyFactor;          //!<! Per absId: energy recalibration factor
+  std::vector<Float_t>   fFusedCellTimeFactor;            //!<! Per (bc%4, gain) and absId: time recalibration factor in ns
+  std::vector<Double_t>  fFusedCellL1PhaseShift;          //!<! Per (SM, bc%4): the two L1 phase time shifts in s
+
  private:
   AliEmcalCorrectionComponent(const AliEmcalCorrectionComponent &);               // Not implemented
   AliEmcalCorrectionComponent &operator=(const AliEmcalCorrectionComponent &);    // Not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionComponent, 6); // EMCal correction component
+  ClassDef(AliEmcalCorrectionComponent, 7); // EMCal correction component
   /// \endcond
 };
 
@@ -49,6 +49,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fIsEsd(false),
   fEventInitialized(false),
   fRecycleUnusedEmbeddedEventsMode(false),
+  fFuseCellCorrections(false),
   fCent(0),
   fCentBin(-1),
   fMinCent(-999),
@@ -95,6 +96,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fIsEsd(false),
   fEventInitialized(false),
   fRecycleUnusedEmbeddedEventsMode(false),
+  fFuseCellCorrections(false),
   fCent(0),
   fCentBin(-1),
   fMinCent(-999),
@@ -141,6 +143,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fIsEsd(task.fIsEsd),
   fEventInitialized(task.fEventInitialized),
   fRecycleUnusedEmbeddedEventsMode(task.fRecycleUnusedEmbeddedEventsMode),
+  fFuseCellCorrections(task.fFuseCellCorrections),
   fCent(task.fCent),
   fCentBin(task.fCentBin),
   fMinCent(task.fMinCent),
@@ -205,6 +208,7 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fIsEsd, second.fIsEsd);
   swap(first.fEventInitialized, second.fEventInitialized);
   swap(first.fRecycleUnusedEmbeddedEventsMode, second.fRecycleUnusedEmbeddedEventsMode);
+  swap(first.fFuseCellCorrections, second.fFuseCellCorrections);
   swap(first.fCent, second.fCent);
   swap(first.fCentBin, second.fCentBin);
   swap(first.fMinCent, second.fMinCent);
@@ -300,6 +304,9 @@ void AliEmcalCorrectionTask::Initialize(bool removeDummyTask)
   // so embedded events can be "recycled"
   fYAMLConfig.GetProperty("recycleUnusedEmbeddedEventsMode", fRecycleUnusedEmbeddedEventsMode);
 
+  // Determine whether consecutive cell components correct the cells in a single pass
+  fYAMLConfig.GetProperty("fuseCellCorrections", fFuseCellCorrections, false);
+
   if (removeDummyTask == true) {
     RemoveDummyTask();
   }
@@ -1310,9 +1317,17 @@ Bool_t AliEmcalCorrectionTask::RetrieveEventObjects()
 /**
  * Executed each event. It sets run-by-run properties in the correction components and calls Run() for each
  * component.
+ *
+ * If fuseCellCorrections is enabled, consecutive components which support it (see
+ * AliEmcalCorrectionComponent::CanFuseCellCorrection()) and work on the same cells only prepare
+ * their correction in Run(). The cells are then corrected in one pass by RunFusedCellCorrections(),
+ * before the next component which is not fused is executed.
  */
 Bool_t AliEmcalCorrectionTask::Run()
 {
+  // Components whose cell correction is pending
+  std::vector <AliEmcalCorrectionComponent *> fusedComponents;
+
   // Run the initialization for all derived classes.
   for (auto component : fCorrectionComponents)
   {
@@ -1322,7 +1337,20 @@ Bool_t AliEmcalCorrectionTask::Run()
     component->SetCentrality(fCent);
     component->SetVertex(fVertex);
 
+    bool fuse = fFuseCellCorrections && component->CanFuseCellCorrection();
+    if (fusedComponents.size() > 0 && (!fuse || component->GetCaloCells() != fusedComponents.front()->GetCaloCells())) {
+      RunFusedCellCorrections(fusedComponents);
+    }
+    component->SetFusedCellCorrection(fuse);
+
     component->Run();
+
+    if (component->IsFusedCellCorrectionPending()) {
+      fusedComponents.push_back(component);
+    }
+  }
+  if (fusedComponents.size() > 0) {
+    RunFusedCellCorrections(fusedComponents);
   }
 
   PostData(1, fOutput);
@@ -1330,6 +1358,39 @@ Bool_t AliEmcalCorrectionTask::Run()
   return kTRUE;
 }
 
+/**
+ * Correct the cells in one pass for a sequence of fused components. For each cell, the
+ * components are applied in the execution order, which gives the same result as running
+ * them one after the other over all cells.
+ *
+ * @param[in,out] components Components whose cell correction is pending. Cleared afterwards.
+ */
+void AliEmcalCorrectionTask::RunFusedCellCorrections(std::vector <AliEmcalCorrectionComponent *> & components)
+{
+  AliVCaloCells * cells = components.front()->GetCaloCells();
+  const Int_t nCells = cells ? cells->GetNumberOfCells() : 0;
+  for (Int_t iCell = 0; iCell < nCells; iCell++)
+  {
+    for (auto component : components)
+    {
+      component->CorrectCellFused(iCell);
+    }
+  }
+
+  bool sortCells = false;
+  for (auto component : components)
+  {
+    if (component->FinishFusedCellCorrection()) {
+      sortCells = true;
+    }
+  }
+  if (cells && sortCells) {
+    cells->Sort();
+  }
+
+  components.clear();
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  */
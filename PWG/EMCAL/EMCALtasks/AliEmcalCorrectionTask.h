@@ -100,6 +100,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Set
   void                        SetForceBeamType(BeamType f)                          { fForceBeamType     = f                              ; }
   void                        SetNeedEmcalGeometry(Bool_t b)                        { fNeedEmcalGeom     = b                              ; }
+  void                        SetFuseCellCorrections(bool b)                        { fFuseCellCorrections = b                            ; }
   // Centrality options
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   void                        SetCentralityEstimator(const char * c)                { fCentEst           = c                              ; }
@@ -191,6 +192,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void RunFusedCellCorrections(std::vector <AliEmcalCorrectionComponent *> & components);
 
   // Initialization functions
   void InitializeConfiguration();
@@ -229,6 +231,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   bool                        fIsEsd;                      ///< File type
   bool                        fEventInitialized;           ///< If the event is initialized properly
   bool                        fRecycleUnusedEmbeddedEventsMode; ///< Allows the recycling of embedded events which fail internal event selection. See the embedding helper.
+  bool                        fFuseCellCorrections;        ///< Correct the cells in one pass for consecutive cell components which support it
   Double_t                    fCent;                       //!<! Event centrality
   Int_t                       fCentBin;                    //!<! Event centrality bin
   Double_t                    fMinCent;                    ///< min centrality for event selection
@@ -250,7 +253,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 6); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 7); // EMCal correction task
   /// \endcond
 };
 
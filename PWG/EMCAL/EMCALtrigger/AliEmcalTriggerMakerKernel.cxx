@@ -12,6 +12,7 @@
  * about the suitability of this software for any purpose. It is          *
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <cstring>
@@ -74,6 +75,7 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fSmearedEnergyTable(),
   fADCtoGeV(1.)
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
@@ -517,6 +519,9 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
+  // The smeared energy of the patches of all sizes is taken from the summed-area table
+  if(fPatchEnergySimpleSmeared) BuildSmearedEnergyTable();
+
   std::vector<AliEMCALTriggerRawPatch> patches;
   if (fPatchFinder) {
     if (useL0amp) {
@@ -566,12 +571,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -597,12 +597,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       fullpatch.SetSmearedEnergy(energysmear);
     }
     outputcont.push_back(fullpatch);
@@ -739,6 +734,27 @@ void AliEmcalTriggerMakerKernel::SetTriggerBitConfig(const AliEMCALTriggerBitCon
   fTriggerBitConfig = config;
 }
 
+void AliEmcalTriggerMakerKernel::BuildSmearedEnergyTable(){
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows();
+  const int stride = ncols + 1;
+  fSmearedEnergyTable.assign(stride * (nrows + 1), 0.);
+  for(int irow = 0; irow < nrows; irow++){
+    double rowsum = 0;
+    for(int icol = 0; icol < ncols; icol++){
+      rowsum += (*fPatchEnergySimpleSmeared)(icol, irow);
+      fSmearedEnergyTable[(irow + 1) * stride + icol + 1] = fSmearedEnergyTable[irow * stride + icol + 1] + rowsum;
+    }
+  }
+}
+
+double AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(int col, int row, int size) const {
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows();
+  const int stride = ncols + 1;
+  const int colmax = std::min(col + size, ncols), rowmax = std::min(row + size, nrows);
+  return fSmearedEnergyTable[rowmax * stride + colmax] - fSmearedEnergyTable[row * stride + colmax]
+       - fSmearedEnergyTable[rowmax * stride + col] + fSmearedEnergyTable[row * stride + col];
+}
+
 bool AliEmcalTriggerMakerKernel::HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const {
   const int kEtaMinPhos = 16, kEtaMaxPhos = 31, kPhiMinPhos = 64, kPhiMaxPhos = 99;
   if(patch.GetRowStart() + patch.GetPatchSize() -1 < kPhiMinPhos) return false;   // EMCAL Patch
@@ -489,6 +489,25 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Build the summed-area table of the smeared energy grid
+   *
+   * Entry (col, row) of the table contains the sum of the smeared
+   * energies of all FastORs with lower column and row, so that the
+   * smeared energy of any patch is obtained from four entries.
+   * Needs to be called once per event after the smearing.
+   */
+  void BuildSmearedEnergyTable();
+
+  /**
+   * @brief Get the smeared energy of a patch from the summed-area table
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Size of the patch (in FastORs)
+   * @return Sum of the smeared energies of the FastORs in the patch
+   */
+  double GetSmearedPatchEnergy(int col, int row, int size) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -524,12 +543,13 @@ protected:
   AliEMCALTriggerDataGrid<double>           *fPatchEnergySimpleSmeared;   //!<! Data grid for smeared energy values from cell energies
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
+  std::vector<double>                       fSmearedEnergyTable;          //!<! Summed-area table of the smeared energy grid, (cols+1) x (rows+1)
   Double_t                                  fRhoValues[kNIndRho];         //!<! Rho values for background subtraction (only online ADC)
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
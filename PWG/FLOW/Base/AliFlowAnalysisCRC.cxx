@@ -5011,17 +5011,9 @@ void AliFlowAnalysisCRC::InitializeArraysForCRC()
 
   for(Int_t r=0;r<fCRCnRun;r++) {
     fCRCIntRunsList[r] = NULL;
-    for(Int_t eg=0;eg<fCRCnEtaGap;eg++) {
-      for (Int_t h=0;h<fCRCnCen;h++) {
-        for(Int_t c=0;c<fCRCnCorr;c++) {
-          fCRCCorrPro[r][c][eg][h] = NULL;
-          fCRCSumWeigHist[r][c][eg][h] = NULL;
-        } // end of for(Int_t c=0;c<2;c++)
-        for(Int_t c=0;c<fCRCnNUA;c++) {
-          fCRCNUATermsPro[r][c][eg][h] = NULL;
-        } // end of for(Int_t c=0;c<4;c++)
-      } // end of for (Int_t h=0;h<fCRCnCen;h++)
-    } // for(Int_t eg=0;eg<fCRCnEtaGap;eg++)
+    fCRCCorrPro[r] = NULL;
+    fCRCSumWeigHist[r] = NULL;
+    fCRCNUATermsPro[r] = NULL;
   } // end of for(Int_t r=0;r<fCRCnRun;r++)
 
 } // end of AliFlowAnalysisCRC::InitializeArraysForCRC()
@@ -8325,50 +8317,50 @@ void AliFlowAnalysisCRC::CalculateCRCCorr()
               mR     += fCRCMult[c2][h]->GetBinContent(EBin);
             }
 
-            fCRCSumWeigHist[fRunBin][0][eg][fCenBin]->Fill(CRCBin-e,(mp+mR)*fCenWeightEbE);
-            fCRCSumWeigHist[fRunBin][1][eg][fCenBin]->Fill(CRCBin-e,fCenWeightEbE);
+            fCRCSumWeigHist[fRunBin]->Fill(CRCCorrBin(0,eg,fCenBin,0)+CRCBin-e,(mp+mR)*fCenWeightEbE);
+            fCRCSumWeigHist[fRunBin]->Fill(CRCCorrBin(1,eg,fCenBin,0)+CRCBin-e,fCenWeightEbE);
 
             if(mp>1 && mR>1) {
               dM2AB = mp*mR;
               twoAB = (p1n0kRe*dReR1n+p1n0kIm*dImR1n) / dM2AB;
 
-              fCRCCorrPro[fRunBin][0][eg][fCenBin]->Fill(CRCBin-e,twoAB,dM2AB*fCenWeightEbE);
+              fCRCCorrPro[fRunBin]->Fill(CRCCorrBin(0,eg,fCenBin,0)+CRCBin-e,twoAB,dM2AB*fCenWeightEbE);
               fCRCCorrProdTempHist[0][0][0]->SetBinContent(CRCBin,twoAB);
               fCRCCorrProdTempHist[0][1][0]->SetBinContent(CRCBin,dM2AB);
-              fCRCNUATermsPro[fRunBin][0][eg][fCenBin]->Fill(CRCBin-e,p1n0kRe/mp,mp*fCenWeightEbE);
-              fCRCNUATermsPro[fRunBin][1][eg][fCenBin]->Fill(CRCBin-e,dReR1n/mR,mR*fCenWeightEbE);
-              fCRCNUATermsPro[fRunBin][2][eg][fCenBin]->Fill(CRCBin-e,p1n0kIm/mp,mp*fCenWeightEbE);
-              fCRCNUATermsPro[fRunBin][3][eg][fCenBin]->Fill(CRCBin-e,dImR1n/mR,mR*fCenWeightEbE);
+              fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(0,eg,fCenBin,0)+CRCBin-e,p1n0kRe/mp,mp*fCenWeightEbE);
+              fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(1,eg,fCenBin,0)+CRCBin-e,dReR1n/mR,mR*fCenWeightEbE);
+              fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(2,eg,fCenBin,0)+CRCBin-e,p1n0kIm/mp,mp*fCenWeightEbE);
+              fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(3,eg,fCenBin,0)+CRCBin-e,dImR1n/mR,mR*fCenWeightEbE);
 
               // gamma terms
               if(VZAM>0. && VZCM>0.) {
                 Double_t GammaAB = ((p1n0kRe*dReR1n-p1n0kIm*dImR1n)*VZCRe + (p1n0kRe*dImR1n+p1n0kIm*dReR1n)*VZCIm) / dM2AB;
-                fCRCCorrPro[fRunBin][1][eg][fCenBin]->Fill(CRCBin-e,GammaAB,dM2AB*fCenWeightEbE);
+                fCRCCorrPro[fRunBin]->Fill(CRCCorrBin(1,eg,fCenBin,0)+CRCBin-e,GammaAB,dM2AB*fCenWeightEbE);
                 fCRCCorrProdTempHist[1][0][0]->SetBinContent(CRCBin,GammaAB);
                 fCRCCorrProdTempHist[1][1][0]->SetBinContent(CRCBin,dM2AB*fCenWeightEbE);
 
                 GammaAB = ((p1n0kRe*dReR1n-p1n0kIm*dImR1n)*VZARe + (p1n0kRe*dImR1n+p1n0kIm*dReR1n)*VZAIm) / dM2AB;
-                fCRCCorrPro[fRunBin][2][eg][fCenBin]->Fill(CRCBin-e,GammaAB,dM2AB*fCenWeightEbE);
+                fCRCCorrPro[fRunBin]->Fill(CRCCorrBin(2,eg,fCenBin,0)+CRCBin-e,GammaAB,dM2AB*fCenWeightEbE);
                 fCRCCorrProdTempHist[2][0][0]->SetBinContent(CRCBin,GammaAB);
                 fCRCCorrProdTempHist[2][1][0]->SetBinContent(CRCBin,dM2AB*fCenWeightEbE);
 
-                fCRCNUATermsPro[fRunBin][4][eg][fCenBin]->Fill(CRCBin-e,(p1n0kRe*VZARe+p1n0kIm*VZAIm)/mp,mp*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][5][eg][fCenBin]->Fill(CRCBin-e,(p1n0kIm*VZARe-p1n0kRe*VZAIm)/mp,mp*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][6][eg][fCenBin]->Fill(CRCBin-e,(p1n0kRe*VZCRe+p1n0kIm*VZCIm)/mp,mp*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][7][eg][fCenBin]->Fill(CRCBin-e,(p1n0kIm*VZCRe-p1n0kRe*VZCIm)/mp,mp*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(4,eg,fCenBin,0)+CRCBin-e,(p1n0kRe*VZARe+p1n0kIm*VZAIm)/mp,mp*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(5,eg,fCenBin,0)+CRCBin-e,(p1n0kIm*VZARe-p1n0kRe*VZAIm)/mp,mp*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(6,eg,fCenBin,0)+CRCBin-e,(p1n0kRe*VZCRe+p1n0kIm*VZCIm)/mp,mp*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(7,eg,fCenBin,0)+CRCBin-e,(p1n0kIm*VZCRe-p1n0kRe*VZCIm)/mp,mp*fCenWeightEbE);
 
-                fCRCNUATermsPro[fRunBin][8][eg][fCenBin]->Fill(CRCBin-e,(dReR1n*VZARe+dImR1n*VZAIm)/mR,mR*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][9][eg][fCenBin]->Fill(CRCBin-e,(dImR1n*VZARe-dReR1n*VZAIm)/mR,mR*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][10][eg][fCenBin]->Fill(CRCBin-e,(dReR1n*VZCRe+dImR1n*VZCIm)/mR,mR*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][11][eg][fCenBin]->Fill(CRCBin-e,(dImR1n*VZCRe-dReR1n*VZCIm)/mR,mR*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(8,eg,fCenBin,0)+CRCBin-e,(dReR1n*VZARe+dImR1n*VZAIm)/mR,mR*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(9,eg,fCenBin,0)+CRCBin-e,(dImR1n*VZARe-dReR1n*VZAIm)/mR,mR*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(10,eg,fCenBin,0)+CRCBin-e,(dReR1n*VZCRe+dImR1n*VZCIm)/mR,mR*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(11,eg,fCenBin,0)+CRCBin-e,(dImR1n*VZCRe-dReR1n*VZCIm)/mR,mR*fCenWeightEbE);
 
-                fCRCNUATermsPro[fRunBin][12][eg][fCenBin]->Fill(CRCBin-e,(p1n0kRe*dReR1n-p1n0kIm*dImR1n)/dM2AB,dM2AB*fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][13][eg][fCenBin]->Fill(CRCBin-e,(p1n0kIm*dReR1n+p1n0kRe*dImR1n)/dM2AB,dM2AB*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(12,eg,fCenBin,0)+CRCBin-e,(p1n0kRe*dReR1n-p1n0kIm*dImR1n)/dM2AB,dM2AB*fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(13,eg,fCenBin,0)+CRCBin-e,(p1n0kIm*dReR1n+p1n0kRe*dImR1n)/dM2AB,dM2AB*fCenWeightEbE);
 
-                fCRCNUATermsPro[fRunBin][0][eg][fCenBin]->Fill(fCRCnCR+1-e,VZCRe,fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][1][eg][fCenBin]->Fill(fCRCnCR+1-e,VZARe,fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][2][eg][fCenBin]->Fill(fCRCnCR+1-e,VZCIm,fCenWeightEbE);
-                fCRCNUATermsPro[fRunBin][3][eg][fCenBin]->Fill(fCRCnCR+1-e,VZAIm,fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(0,eg,fCenBin,0)+fCRCnCR+1-e,VZCRe,fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(1,eg,fCenBin,0)+fCRCnCR+1-e,VZARe,fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(2,eg,fCenBin,0)+fCRCnCR+1-e,VZCIm,fCenWeightEbE);
+                fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(3,eg,fCenBin,0)+fCRCnCR+1-e,VZAIm,fCenWeightEbE);
               }
 
             } else {
@@ -8393,20 +8385,20 @@ void AliFlowAnalysisCRC::CalculateCRCCorr()
         }
       }
       Double_t ResAB = VZARe*VZCRe+VZAIm*VZCIm;
-      fCRCCorrPro[fRunBin][3][eg][fCenBin]->Fill(1-e,ResAB,fCenWeightEbE);
+      fCRCCorrPro[fRunBin]->Fill(CRCCorrBin(3,eg,fCenBin,0)+1-e,ResAB,fCenWeightEbE);
       fCRCCorrProdTempHist[3][0][0]->SetBinContent(1,ResAB);
       fCRCCorrProdTempHist[3][1][0]->SetBinContent(1,fCenWeightEbE);
       ResAB = (VZARe*T2Re+VZAIm*T2Im)/mT;
-      fCRCCorrPro[fRunBin][3][eg][fCenBin]->Fill(2-e,ResAB,mT*fCenWeightEbE);
+      fCRCCorrPro[fRunBin]->Fill(CRCCorrBin(3,eg,fCenBin,0)+2-e,ResAB,mT*fCenWeightEbE);
       fCRCCorrProdTempHist[3][0][0]->SetBinContent(2,ResAB);
       fCRCCorrProdTempHist[3][1][0]->SetBinContent(2,fCenWeightEbE);
       ResAB = (T2Re*VZCRe+T2Im*VZCIm)/mT;
-      fCRCCorrPro[fRunBin][3][eg][fCenBin]->Fill(3-e,ResAB,mT*fCenWeightEbE);
+      fCRCCorrPro[fRunBin]->Fill(CRCCorrBin(3,eg,fCenBin,0)+3-e,ResAB,mT*fCenWeightEbE);
       fCRCCorrProdTempHist[3][0][0]->SetBinContent(3,ResAB);
       fCRCCorrProdTempHist[3][1][0]->SetBinContent(3,fCenWeightEbE);
 
-      fCRCNUATermsPro[fRunBin][4][eg][fCenBin]->Fill(fCRCnCR+1-e,T2Re/mT,mT*fCenWeightEbE);
-      fCRCNUATermsPro[fRunBin][5][eg][fCenBin]->Fill(fCRCnCR+1-e,T2Im/mT,mT*fCenWeightEbE);
+      fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(4,eg,fCenBin,0)+fCRCnCR+1-e,T2Re/mT,mT*fCenWeightEbE);
+      fCRCNUATermsPro[fRunBin]->Fill(CRCNUABin(5,eg,fCenBin,0)+fCRCnCR+1-e,T2Im/mT,mT*fCenWeightEbE);
     }
 
     for(Int_t k=0; k<fCRCnCorr; k++) {
@@ -11036,27 +11028,27 @@ void AliFlowAnalysisCRC::FinalizeCRCCorr()
           Double_t SumTwo=0., SumTwoCorr=0., SumWeig=0., SumTwoSq=0., SumWeigSq=0., SumMul=0., SumEv=0.;
 
           for(Int_t r=0;r<fCRCnRun;r++) {
-            fCRCCorrPro[r][k][eg][h]->GetXaxis()->SetRange(c,c);
-            fCRCCorrPro[r][k][eg][h]->GetStats(stats);
-            Double_t sumw   = stats[0];
-            Double_t sumw2  = stats[1];
-            Double_t sumwx  = stats[4];
-            Double_t sumwx2 = stats[5];
-            Double_t cosA = fCRCNUATermsPro[r][0][eg][h]->GetBinContent(c);
-            Double_t cosB = fCRCNUATermsPro[r][1][eg][h]->GetBinContent(c);
-            Double_t sinA = fCRCNUATermsPro[r][2][eg][h]->GetBinContent(c);
-            Double_t sinB = fCRCNUATermsPro[r][3][eg][h]->GetBinContent(c);
-            Double_t cosVZC = fCRCNUATermsPro[r][0][eg][h]->GetBinContent(fCRCnCR+1);
-            Double_t cosVZA = fCRCNUATermsPro[r][1][eg][h]->GetBinContent(fCRCnCR+1);
-            Double_t sinVZC = fCRCNUATermsPro[r][2][eg][h]->GetBinContent(fCRCnCR+1);
-            Double_t sinVZA = fCRCNUATermsPro[r][3][eg][h]->GetBinContent(fCRCnCR+1);
+            // sums of the bin, as GetStats() of the bin range would give them:
+            Int_t bin = CRCCorrBin(k,eg,h,c);
+            Double_t sumw   = fCRCCorrPro[r]->GetBinEntries(bin);
+            Double_t sumw2  = fCRCCorrPro[r]->GetBinSumw2()->fN ? fCRCCorrPro[r]->GetBinSumw2()->At(bin) : sumw;
+            Double_t sumwx  = fCRCCorrPro[r]->GetArray()[bin];
+            Double_t sumwx2 = fCRCCorrPro[r]->GetSumw2()->At(bin);
+            Double_t cosA = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(0,eg,h,c));
+            Double_t cosB = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(1,eg,h,c));
+            Double_t sinA = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(2,eg,h,c));
+            Double_t sinB = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(3,eg,h,c));
+            Double_t cosVZC = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(0,eg,h,fCRCnCR+1));
+            Double_t cosVZA = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(1,eg,h,fCRCnCR+1));
+            Double_t sinVZC = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(2,eg,h,fCRCnCR+1));
+            Double_t sinVZA = fCRCNUATermsPro[r]->GetBinContent(CRCNUABin(3,eg,h,fCRCnCR+1));
             if(sumw>0.) {
               SumTwo    += sumwx;
               SumWeig   += sumw;
               SumTwoSq  += sumwx2;
               SumWeigSq += sumw2;
-              SumMul    += fCRCSumWeigHist[r][0][eg][h]->GetBinContent(c);
-              SumEv     += fCRCSumWeigHist[r][1][eg][h]->GetBinContent(c);
+              SumMul    += fCRCSumWeigHist[r]->GetBinContent(CRCCorrBin(0,eg,h,c));
+              SumEv     += fCRCSumWeigHist[r]->GetBinContent(CRCCorrBin(1,eg,h,c));
               if(fNUAforCRC) {
                 Double_t NUACor = 0.;
                 if(k==0) NUACor = cosA*cosB + sinA*sinB;
@@ -11072,7 +11064,6 @@ void AliFlowAnalysisCRC::FinalizeCRCCorr()
                 SumTwoCorr += sumwx;
               }
             } // end of if(sumw>0.)
-            fCRCCorrPro[r][k][eg][h]->GetXaxis()->SetRange(0.,fCRCnCR);
           } // end of for(Int_t r=0;r<fCRCnRun;r++)
 
           if(SumWeig<=0) continue;
@@ -16052,25 +16043,15 @@ void AliFlowAnalysisCRC::GetPointersForCRC()
       cout<<"WARNING: CRCIntRunsList is NULL in AFAWQC::GPFCRC() !!!!"<<endl;
     }
 
-    for(Int_t eg=0;eg<fCRCnEtaGap;eg++) {
-      for (Int_t h=0;h<fCRCnCen;h++) {
-        for(Int_t c=0;c<fCRCnCorr;c++) {
-          // EbE Corr:
-          TProfile *CRCCorrPro = dynamic_cast<TProfile*>(fCRCIntRunsList[r]->FindObject(Form("fCRCCorrPro[%d][%d][%d][%d]",fRunList[r],c,eg,h)));
-          if(CRCCorrPro) { this->SetCRCCorrPro(CRCCorrPro,r,c,eg,h); }
-          else { cout<<"WARNING: CRCCorrPro is NULL in AFAWQC::GPFCRC() !!!!"<<endl; }
-          TH1D *CRCSumWeigHist = dynamic_cast<TH1D*>(fCRCIntRunsList[r]->FindObject(Form("fCRCSumWeigHist[%d][%d][%d][%d]",fRunList[r],c,eg,h)));
-          if(CRCSumWeigHist) { this->SetCRCSumWeigHist(CRCSumWeigHist,r,c,eg,h); }
-          else { cout<<"WARNING: CRCSumWeigHist is NULL in AFAWQC::GPFCRC() !!!!"<<endl; }
-        } // end of for(Int_t c=0;c<2;c++)
-        // NUA corrections:
-        for(Int_t c=0;c<fCRCnNUA;c++) {
-          TProfile *CRCNUATermsPro = dynamic_cast<TProfile*>(fCRCIntRunsList[r]->FindObject(Form("fCRCNUATermsPro[%d][%d][%d][%d]",fRunList[r],c,eg,h)));
-          if(CRCNUATermsPro) { this->SetCRCNUATermsPro(CRCNUATermsPro,r,c,eg,h); }
-          else { cout<<"WARNING: CRCNUATermsPro is NULL in AFAWQC::GPFCRC() !!!!"<<endl; }
-        } // end of for(Int_t c=0;c<4;c++)
-      } // end of for (Int_t h=0;h<fCRCnCen;h++)
-    } // end of for(Int_t eg=0;eg<fCRCnEtaGap;eg++)
+    TProfile *CRCCorrPro = dynamic_cast<TProfile*>(fCRCIntRunsList[r]->FindObject(Form("fCRCCorrPro[%d]",fRunList[r])));
+    if(CRCCorrPro) { this->SetCRCCorrPro(CRCCorrPro,r); }
+    else { cout<<"WARNING: CRCCorrPro is NULL in AFAWQC::GPFCRC() !!!!"<<endl; }
+    TH1D *CRCSumWeigHist = dynamic_cast<TH1D*>(fCRCIntRunsList[r]->FindObject(Form("fCRCSumWeigHist[%d]",fRunList[r])));
+    if(CRCSumWeigHist) { this->SetCRCSumWeigHist(CRCSumWeigHist,r); }
+    else { cout<<"WARNING: CRCSumWeigHist is NULL in AFAWQC::GPFCRC() !!!!"<<endl; }
+    TProfile *CRCNUATermsPro = dynamic_cast<TProfile*>(fCRCIntRunsList[r]->FindObject(Form("fCRCNUATermsPro[%d]",fRunList[r])));
+    if(CRCNUATermsPro) { this->SetCRCNUATermsPro(CRCNUATermsPro,r); }
+    else { cout<<"WARNING: CRCNUATermsPro is NULL in AFAWQC::GPFCRC() !!!!"<<endl; }
 
   } // end of for(Int_t r=0;r<fCRCnRun;r++)
 
@@ -17423,28 +17404,19 @@ void AliFlowAnalysisCRC::BookEverythingForCRC()
     fCRCIntRunsList[r]->SetOwner(kTRUE);
     fCRCIntRbRList->Add(fCRCIntRunsList[r]);
 
-    for(Int_t eg=0;eg<fCRCnEtaGap;eg++) {
-      for (Int_t h=0;h<fCRCnCen;h++) {
-        // correlations:
-        for(Int_t c=0;c<fCRCnCorr;c++) {
-          fCRCCorrPro[r][c][eg][h] = new TProfile(Form("fCRCCorrPro[%d][%d][%d][%d]",fRunList[r],c,eg,h),
-                                                  Form("fCRCCorrPro[%d][%d][%d][%d]",fRunList[r],c,eg,h),fCRCnCR,0.,1.*fCRCnCR,"s");
-          fCRCCorrPro[r][c][eg][h]->Sumw2();
-          fCRCIntRunsList[r]->Add(fCRCCorrPro[r][c][eg][h]);
-          fCRCSumWeigHist[r][c][eg][h] = new TH1D(Form("fCRCSumWeigHist[%d][%d][%d][%d]",fRunList[r],c,eg,h),
-                                                  Form("fCRCSumWeigHist[%d][%d][%d][%d]",fRunList[r],c,eg,h),fCRCnCR,0.,1.*fCRCnCR);
-          fCRCSumWeigHist[r][c][eg][h]->Sumw2();
-          fCRCIntRunsList[r]->Add(fCRCSumWeigHist[r][c][eg][h]);
-        }
-        // NUA:
-        for(Int_t c=0;c<fCRCnNUA;c++) {
-          fCRCNUATermsPro[r][c][eg][h] = new TProfile(Form("fCRCNUATermsPro[%d][%d][%d][%d]",fRunList[r],c,eg,h),
-                                                      Form("fCRCNUATermsPro[%d][%d][%d][%d]",fRunList[r],c,eg,h),fCRCnCR+1,0.,fCRCnCR+1.,"s");
-          fCRCNUATermsPro[r][c][eg][h]->Sumw2();
-          fCRCIntRunsList[r]->Add(fCRCNUATermsPro[r][c][eg][h]);
-        } // end of for(Int_t c=0;c<4;c++)
-      } // end of for (Int_t h=0;h<fCRCnCen;h++)
-    } // end of for(Int_t eg=0;eg<fCRCnEtaGap;eg++)
+    // one flat profile per run and quantity, see CRCCorrBin() and CRCNUABin() for the binning:
+    Int_t nCorrBins = fCRCnCorr*fCRCnEtaGap*fCRCnCen*fCRCnCR;
+    fCRCCorrPro[r] = new TProfile(Form("fCRCCorrPro[%d]",fRunList[r]),Form("fCRCCorrPro[%d]",fRunList[r]),nCorrBins,0.,1.*nCorrBins,"s");
+    fCRCCorrPro[r]->Sumw2();
+    fCRCIntRunsList[r]->Add(fCRCCorrPro[r]);
+    Int_t nSumWeigBins = 2*fCRCnEtaGap*fCRCnCen*fCRCnCR; // only sum of multiplicities and number of events
+    fCRCSumWeigHist[r] = new TH1D(Form("fCRCSumWeigHist[%d]",fRunList[r]),Form("fCRCSumWeigHist[%d]",fRunList[r]),nSumWeigBins,0.,1.*nSumWeigBins);
+    fCRCSumWeigHist[r]->Sumw2();
+    fCRCIntRunsList[r]->Add(fCRCSumWeigHist[r]);
+    Int_t nNUABins = fCRCnNUA*fCRCnEtaGap*fCRCnCen*(fCRCnCR+1);
+    fCRCNUATermsPro[r] = new TProfile(Form("fCRCNUATermsPro[%d]",fRunList[r]),Form("fCRCNUATermsPro[%d]",fRunList[r]),nNUABins,0.,1.*nNUABins,"s");
+    fCRCNUATermsPro[r]->Sumw2();
+    fCRCIntRunsList[r]->Add(fCRCNUATermsPro[r]);
   } // end of for(Int_t r=0;r<fCRCnRun;r++)
 
 } // end of AliFlowAnalysisCRC::BookEverythingForCRC()
@@ -807,12 +807,15 @@ public:
   void SetCRCNUATermsHist(TH1D* const TH, Int_t const c, Int_t const eg, Int_t const h) {this->fCRCNUATermsHist[c][eg][h] = TH;};
   TH1D* GetCRCNUATermsHist(Int_t const c, Int_t const eg, Int_t const h) const {return this->fCRCNUATermsHist[c][eg][h];};
 
-  void SetCRCCorrPro(TProfile* const TP, Int_t const r, Int_t const c, Int_t const eg, Int_t const h) {this->fCRCCorrPro[r][c][eg][h] = TP;};
-  TProfile* GetCRCCorrPro(Int_t const r, Int_t const c, Int_t const eg, Int_t const h) const {return this->fCRCCorrPro[r][c][eg][h];};
-  void SetCRCSumWeigHist(TH1D* const TH, Int_t const r, Int_t const c, Int_t const eg, Int_t const h) {this->fCRCSumWeigHist[r][c][eg][h] = TH;};
-  TH1D* GetCRCSumWeigHist(Int_t const r, Int_t const c, Int_t const eg, Int_t const h) const {return this->fCRCSumWeigHist[r][c][eg][h];};
-  void SetCRCNUATermsPro(TProfile* const TP, Int_t const r, Int_t const c, Int_t const eg, Int_t const h) {this->fCRCNUATermsPro[r][c][eg][h] = TP;};
-  TProfile* GetCRCNUATermsPro(Int_t const r, Int_t const c, Int_t const eg, Int_t const h) const {return this->fCRCNUATermsPro[r][c][eg][h];};
+  void SetCRCCorrPro(TProfile* const TP, Int_t const r) {this->fCRCCorrPro[r] = TP;};
+  TProfile* GetCRCCorrPro(Int_t const r) const {return this->fCRCCorrPro[r];};
+  void SetCRCSumWeigHist(TH1D* const TH, Int_t const r) {this->fCRCSumWeigHist[r] = TH;};
+  TH1D* GetCRCSumWeigHist(Int_t const r) const {return this->fCRCSumWeigHist[r];};
+  void SetCRCNUATermsPro(TProfile* const TP, Int_t const r) {this->fCRCNUATermsPro[r] = TP;};
+  TProfile* GetCRCNUATermsPro(Int_t const r) const {return this->fCRCNUATermsPro[r];};
+  // bins of fCRCCorrPro and fCRCSumWeigHist (c < 2), and of fCRCNUATermsPro, for correlation/term c, eta gap eg, centrality h and CRC bin:
+  Int_t CRCCorrBin(Int_t const c, Int_t const eg, Int_t const h, Int_t const bin) const {return ((c*fCRCnEtaGap+eg)*fCRCnCen+h)*fCRCnCR+bin;};
+  Int_t CRCNUABin(Int_t const c, Int_t const eg, Int_t const h, Int_t const bin) const {return ((c*fCRCnEtaGap+eg)*fCRCnCen+h)*(fCRCnCR+1)+bin;};
 
   // 12.e) Q Vectors:
   void SetCRCQnReHist(TProfile* const TH, Int_t const r, Int_t const h) {this->fCRCQnRe[r][h] = TH;};
@@ -1570,9 +1573,9 @@ private:
   TH1D *fCRCQRe[2][fCRCnHar]; //! real part [0=pos,1=neg][0=back,1=forw][m]
   TH1D *fCRCQIm[2][fCRCnHar]; //! imaginary part [0=pos,1=neg][0=back,1=forw][m]
   TH1D *fCRCMult[2][fCRCnHar]; //! imaginary part [0=pos,1=neg][0=back,1=forw][p][k]
-  TProfile *fCRCCorrPro[fCRCMaxnRun][fCRCnCorr][fCRCnEtaGap][fCRCMaxnCen]; //! correlation profile, [CRCBin][eg]
-  TH1D *fCRCSumWeigHist[fCRCMaxnRun][fCRCnCorr][fCRCnEtaGap][fCRCMaxnCen]; //! correlation weights histo, [CRCBin][eg]
-  TProfile *fCRCNUATermsPro[fCRCMaxnRun][fCRCnNUA][fCRCnEtaGap][fCRCMaxnCen]; //! NUA terms profile
+  TProfile *fCRCCorrPro[fCRCMaxnRun]; //! correlation profile, flat in [corr][eg][cen][CRCBin]
+  TH1D *fCRCSumWeigHist[fCRCMaxnRun]; //! correlation weights histo, flat in [0=mult,1=events][eg][cen][CRCBin]
+  TProfile *fCRCNUATermsPro[fCRCMaxnRun]; //! NUA terms profile, flat in [term][eg][cen][CRCBin]
 
   TH1D *fCRCCorrProdTempHist[fCRCnCorr][fCRCnEtaGap][fCRCMaxnCen]; //! temporary correlation products for covariances, [CRCBin][eg]
   TH1D *fCRCCorrHist[fCRCnCorr][fCRCnEtaGap][fCRCMaxnCen]; //! <<2'>>, [CRCBin][eg]
@@ -2107,7 +2110,7 @@ private:
   Bool_t fbFlagIsBadRunForC34;
   Bool_t fStoreExtraHistoForSubSampling;
 
-  ClassDef(AliFlowAnalysisCRC,74);
+  ClassDef(AliFlowAnalysisCRC,75);
 
 };
 
@@ -22,6 +22,8 @@
 
 #define AliFlowAnalysisWithQCumulants_cxx
 
+#include <algorithm>
+#include <vector>
 #include "Riostream.h"
 #include "AliFlowCommonConstants.h"
 #include "AliFlowCommonHist.h"
@@ -186,6 +188,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fEvaluateIntFlowNestedLoops(kFALSE),
  fEvaluateDiffFlowNestedLoops(kFALSE),
  fMaxAllowedMultiplicity(10),
+ fNestedLoopsSampledTuples(0),
  fEvaluateNestedLoops(NULL),
  fIntFlowDirectCorrelations(NULL),
  fIntFlowExtraDirectCorrelations(NULL),
@@ -217,6 +220,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  f8pCumulants(NULL),
  fMixedHarmonicProductOfEventWeights(NULL),
  fMixedHarmonicProductOfCorrelations(NULL),
+ fMixedHarmonicsRecursionCache(),
  // 10.) Control histograms:
  fControlHistogramsList(NULL), 
  fControlHistogramsFlags(NULL),
@@ -232,7 +236,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fUseBootstrap(kFALSE),
  fUseBootstrapVsM(kFALSE),
  fnSubsamples(10),
- fRandom(NULL),
+ fSubsampleIndexEBE(0),
  fBootstrapCorrelations(NULL),
  fBootstrapCumulants(NULL)
  {
@@ -369,6 +373,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
  Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
+ if(fUseBootstrap||fUseBootstrapVsM){fSubsampleIndexEBE = anEvent->GetSubsampleIndex(fnSubsamples);} // the same for all methods of this event
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -377,38 +382,42 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
                                                                                                                                                                                                                                                                                         
  // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
- AliFlowTrackSimple *aftsTrack = NULL;
+ anEvent->BuildTrackArrays(); // flat copy of the kinematics, weights and tags of the tracks
  Int_t n = fHarmonic; // shortcut for the harmonic 
+ // Without phi, pt and eta weights Q_{n,k} and S_{p,k} are taken from the Q-vectors cached in the event, shared with the other methods:
+ Bool_t bSharedQ = !(fUsePhiWeights && fPhiWeights && fnBinsPhi) && !(fUsePtWeights && fPtWeights && fnBinsPt)
+                   && !(fUseEtaWeights && fEtaWeights && fEtaBinWidth) && !(fExactNoRPs > 0) && n > 0;
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
-  aftsTrack=anEvent->GetTrack(i);
-  if(aftsTrack)
-  {
-   if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
-   if(aftsTrack->InRPSelection()) // RP condition:
-   {    
-    nCounterNoRPs++;
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
-    {
-     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
-    }
-    if(fUsePtWeights && fPtWeights && fnBinsPt) // determine pt weight for this particle:
-    {
-     wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
-    }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth) // determine eta weight for this particle: 
-    {
-     wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
-    }      
-    // Access track weight:
-    if(fUseTrackWeights)
-    {
-     wTrack = aftsTrack->Weight(); 
-    }
+  Bool_t bInRP = anEvent->TrackInRPSelection(i);
+  Bool_t bInPOI = anEvent->TrackInPOISelection(i);
+  if(!(bInRP || bInPOI)){continue;} // safety measure: consider only tracks which are RPs or POIs (empty slots have no tags)
+  if(bInRP) // RP condition:
+  {    
+   nCounterNoRPs++;
+   dPhi = anEvent->GetTrackPhi(i);
+   dPt  = anEvent->GetTrackPt(i);
+   dEta = anEvent->GetTrackEta(i);
+   if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
+   {
+    wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+   }
+   if(fUsePtWeights && fPtWeights && fnBinsPt) // determine pt weight for this particle:
+   {
+    wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
+   }              
+   if(fUseEtaWeights && fEtaWeights && fEtaBinWidth) // determine eta weight for this particle: 
+   {
+    wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
+   }      
+   // Access track weight:
+   if(fUseTrackWeights)
+   {
+    wTrack = anEvent->GetTrackWeight(i); 
+   }
+   if(!bSharedQ)
+   {
     // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
     for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
     {
@@ -426,12 +435,44 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
       (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
      }
     } 
-    // Differential flow:
-    if(fCalculateDiffFlow || fCalculate2DDiffFlow)
+   } // end of if(!bSharedQ)
+   // Differential flow:
+   if(fCalculateDiffFlow || fCalculate2DDiffFlow)
+   {
+    ptEta[0] = dPt; 
+    ptEta[1] = dEta; 
+    // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
+    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    {
+     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+     {
+      if(fCalculateDiffFlow)
+      {
+       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+       {
+        fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
+        fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+        if(m==0) // s_{p,k} does not depend on index m
+        {
+         fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+        } // end of if(m==0) // s_{p,k} does not depend on index m
+       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+      } // end of if(fCalculateDiffFlow) 
+      if(fCalculate2DDiffFlow)
+      {
+       fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
+       fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+       if(m==0) // s_{p,k} does not depend on index m
+       {
+        fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+       } // end of if(m==0) // s_{p,k} does not depend on index m
+      } // end of if(fCalculate2DDiffFlow)
+     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    // Checking if RP particle is also POI particle:      
+    if(bInPOI)
     {
-     ptEta[0] = dPt; 
-     ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
+     // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      {
       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -440,113 +481,97 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
        {
         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
         {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+         fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
+         fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
        } // end of if(fCalculateDiffFlow) 
        if(fCalculate2DDiffFlow)
        {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+        fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
+        fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
         if(m==0) // s_{p,k} does not depend on index m
         {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+         fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
         } // end of if(m==0) // s_{p,k} does not depend on index m
        } // end of if(fCalculate2DDiffFlow)
       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
-     {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
-      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-      {
-       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-       {
-        if(fCalculateDiffFlow)
-        {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
-        {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
-       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
-    } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
-   } // end of if(pTrack->InRPSelection())
-   if(aftsTrack->InPOISelection())
-   {
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
-    wPhi = 1.;
-    wPt  = 1.;
-    wEta = 1.;
-    wTrack = 1.;
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && aftsTrack->InRPSelection()) // determine phi weight for POI && RP particle:
-    {
-     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
-    }
-    if(fUsePtWeights && fPtWeights && fnBinsPt && aftsTrack->InRPSelection()) // determine pt weight for POI && RP particle:
-    {
-     wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
-    }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && aftsTrack->InRPSelection()) // determine eta weight for POI && RP particle: 
-    {
-     wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
-    }      
-    // Access track weight for POI && RP particle:
-    if(aftsTrack->InRPSelection() && fUseTrackWeights)
-    {
-     wTrack = aftsTrack->Weight(); 
-    }
-    ptEta[0] = dPt;
-    ptEta[1] = dEta;
-    // Calculate p_{m*n,k} ('p-vector' for POIs): 
-    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+    } // end of if(bInPOI)  
+   } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
+  } // end of if(pTrack->InRPSelection())
+  if(bInPOI)
+  {
+   dPhi = anEvent->GetTrackPhi(i);
+   dPt  = anEvent->GetTrackPt(i);
+   dEta = anEvent->GetTrackEta(i);
+   wPhi = 1.;
+   wPt  = 1.;
+   wEta = 1.;
+   wTrack = 1.;
+   if(fUsePhiWeights && fPhiWeights && fnBinsPhi && bInRP) // determine phi weight for POI && RP particle:
+   {
+    wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+   }
+   if(fUsePtWeights && fPtWeights && fnBinsPt && bInRP) // determine pt weight for POI && RP particle:
+   {
+    wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
+   }              
+   if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && bInRP) // determine eta weight for POI && RP particle: 
+   {
+    wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
+   }      
+   // Access track weight for POI && RP particle:
+   if(bInRP && fUseTrackWeights)
+   {
+    wTrack = anEvent->GetTrackWeight(i); 
+   }
+   ptEta[0] = dPt;
+   ptEta[1] = dEta;
+   // Calculate p_{m*n,k} ('p-vector' for POIs): 
+   for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+   {
+    for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
     {
-     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+     if(fCalculateDiffFlow)
      {
-      if(fCalculateDiffFlow)
-      {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
+      for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
       {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-   } // end of if(pTrack->InPOISelection())    
-  } else // to if(aftsTrack)
-    {
-     printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
-    }
+       fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
+       fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+      } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+     } // end of if(fCalculateDiffFlow) 
+     if(fCalculate2DDiffFlow)
+     {
+      fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
+      fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+     } // end of if(fCalculate2DDiffFlow)
+    } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+   } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+  } // end of if(pTrack->InPOISelection())    
  } // end of for(Int_t i=0;i<nPrim;i++) 
+ if(bSharedQ)
+ {
+  anEvent->BuildRPQVectors(12*n,8,fUseTrackWeights);
+  for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
+  {
+   for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+   {
+    (*fReQ)(m,k)=anEvent->GetRPQRe((m+1)*n,k); 
+    (*fImQ)(m,k)=anEvent->GetRPQIm((m+1)*n,k); 
+   } 
+  }
+  for(Int_t p=0;p<8;p++)
+  {
+   for(Int_t k=0;k<9;k++)
+   {     
+    (*fSpk)(p,k)=anEvent->GetRPQRe(0,k);
+   }
+  } 
+ } // end of if(bSharedQ)
 
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
  for(Int_t p=0;p<8;p++)
@@ -925,7 +950,12 @@ void AliFlowAnalysisWithQCumulants::EvaluateIntFlowNestedLoops(AliFlowEventSimpl
    this->CalculateIntFlowCorrectionsForNUACosTermsUsingParticleWeights(); // from Q-vectors (cos terms)
    this->EvaluateIntFlowCorrectionsForNUAWithNestedLoopsUsingParticleWeights(anEvent); // from nested loops (both sin and cos terms)   
   }
- } else if(nPrim>fMaxAllowedMultiplicity) // to if(nPrim>0 && nPrim<=fMaxAllowedMultiplicity)
+ } else if(nPrim>fMaxAllowedMultiplicity && fNestedLoopsSampledTuples>0 && !(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights))
+   {
+    // Too many tuples for exact nested loops, use a random sample of them instead:
+    this->CalculateIntFlowCorrelations(); // from Q-vectors
+    this->EvaluateIntFlowCorrelationsWithSampledNestedLoops(anEvent); // from sampled nested loops
+   } else if(nPrim>fMaxAllowedMultiplicity) // to if(nPrim>0 && nPrim<=fMaxAllowedMultiplicity)
    {
     cout<<endl;
     cout<<"Skipping the event because multiplicity is "<<nPrim<<". Too high to evaluate nested loops!"<<endl;
@@ -2791,11 +2821,7 @@ void AliFlowAnalysisWithQCumulants::BookEverythingForBootstrap()
  fBootstrapFlags->GetXaxis()->SetBinLabel(3,"fnSubsamples");
  fBootstrapList->Add(fBootstrapFlags);
 
- // b) Book local random generator:
- if(fUseBootstrap||fUseBootstrapVsM)
- { 
-  fRandom = new TRandom3(0); // if uiSeed is 0, the seed is determined uniquely in space and time via TUUID
- }
+ // b) The subsample of each event is taken from the flow event, see AliFlowEventSimple::GetSubsampleIndex():
 
  // c) Book all bootstrap objects:
  TString correlationFlag[4] = {"#LT#LT2#GT#GT","#LT#LT4#GT#GT","#LT#LT6#GT#GT","#LT#LT8#GT#GT"};
@@ -4813,4235 +4839,402 @@ void AliFlowAnalysisWithQCumulants::CalculateIntFlowCorrelations()
   fIntFlowCorrelationsAllPro->Fill(54.5,five3n2n3n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
   fIntFlowCorrelationsAllPro->Fill(55.5,five3n2n2n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
   fIntFlowCorrelationsAllPro->Fill(56.5,five5n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  fIntFlowCorrelationsAllPro->Fill(60.5,five6n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  fIntFlowCorrelationsAllPro->Fill(61.5,five4n1n1n3n3n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  if(fCalculateAllCorrelationsVsM)
-  {
-   fIntFlowCorrelationsAllVsMPro[52]->Fill(dMultiplicityBin,five3n3n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-   fIntFlowCorrelationsAllVsMPro[53]->Fill(dMultiplicityBin,five4n2n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-   fIntFlowCorrelationsAllVsMPro[54]->Fill(dMultiplicityBin,five3n2n3n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-   fIntFlowCorrelationsAllVsMPro[55]->Fill(dMultiplicityBin,five3n2n2n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-   fIntFlowCorrelationsAllVsMPro[56]->Fill(dMultiplicityBin,five5n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-   fIntFlowCorrelationsAllVsMPro[60]->Fill(dMultiplicityBin,five6n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-   fIntFlowCorrelationsAllVsMPro[61]->Fill(dMultiplicityBin,five4n1n1n3n3n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  }         
- } // end of if(dMult>4)
-
- // 6-particle:
- Double_t six3n2n1n3n2n1n = 0.; // <cos(n(3*phi1+2*phi2+1*phi3-3*phi4-2*phi5-1*phi6)>
- Double_t six3n3n2n2n1n1n = 0.; // <cos(n(3*phi1+3*phi2-2*phi3-2*phi4-1*phi5-1*phi6)>   
- if(dMult>5.)
- { 
-  six3n2n1n3n2n1n = (dQ3nQ2nQ1nQ3nstarQ2nstarQ1nstar-2.*reQ3nQ3nQ3nstarQ2nstarQ1nstar
-                  - 2.*reQ3nQ2nQ2nstarQ2nstarQ1nstar-2.*reQ3nQ1nQ2nstarQ1nstarQ1nstar
-                  - 2.*reQ3nQ2nQ3nstarQ1nstarQ1nstar-2.*reQ4nQ2nQ3nstarQ2nstarQ1nstar
-                  - 2.*reQ5nQ1nQ3nstarQ2nstarQ1nstar+4.*reQ6nQ3nstarQ2nstarQ1nstar
-                  + 2.*reQ5nQ1nQ4nstarQ2nstar+2.*reQ5nQ1nQ3nstarQ3nstar
-                  + 2.*reQ4nQ2nQ3nstarQ3nstar+6.*reQ4nQ1nQ3nstarQ2nstar
-                  + 2.*reQ5nQ3nstarQ1nstarQ1nstar+2.*reQ5nQ2nstarQ2nstarQ1nstar
-                  + 6.*reQ3nQ1nQ2nstarQ2nstar+2.*reQ4nQ2nstarQ1nstarQ1nstar
-                  - 4.*reQ6nQ5nstarQ1nstar-4.*reQ6nQ4nstarQ2nstar-6.*reQ5nQ4nstarQ1nstar
-                  - 4.*reQ6nQ3nstarQ3nstar+2.*(dMult-11.)*reQ5nQ3nstarQ2nstar
-                  + 2.*(dMult-13.)*reQ4nQ3nstarQ1nstar-8.*reQ4nQ2nstarQ2nstar
-                  + 2.*(5.*dMult-32.)*reQ3nQ2nstarQ1nstar+2.*reQ3nQ1nstarQ1nstarQ1nstar
-                  + 2.*(dMult-13.)*reQ2nQ1nstarQ1nstar
-                  - (dMult-10.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                  + (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                  + (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                  - (dMult-11.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                  - (dMult-10.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                  + 4.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-(dMult-12.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                  - (dMult-16.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+pow((pow(dReQ3n,2.)+pow(dImQ3n,2.)),2.)
-                  + (dMult*dMult-19.*dMult+68.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                  + (dMult*dMult-19.*dMult+72.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                  + pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)+pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.)
-                  + (dMult*dMult-20.*dMult+80.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                  - dMult*(dMult-12.)*(dMult-10.))
-                  / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));   
-  
-  // Peter Jochumzsen:
-  six3n3n2n2n1n1n = (reQ3nQ3nQ2nstarQ2nstarQ1nstarQ1nstar
-                  + (80.-16.*dMult)*pow(dReQ1n,2.)+(80.-16.*dMult)*pow(dImQ1n,2.)
-                  + (78.-16.*dMult)*pow(dReQ2n,2.)+(78.-16.*dMult)*pow(dImQ2n,2.)
-                  + (72.-16.*dMult)*pow(dReQ3n,2.)+(72.-16.*dMult)*pow(dImQ3n,2.)
-                  + 14.*pow(dReQ4n,2.)+14.*pow(dImQ4n,2.)
-                  + 8.*pow(dReQ5n,2.)+8.*pow(dImQ5n,2.)
-                  + 6.*pow(dReQ6n,2.)+6.*pow(dImQ6n,2.)
-                  + 1.*reQ6nQ2nstarQ2nstarQ2nstar - 1.*reQ6nQ2nstarQ2nstarQ1nstarQ1nstar
-                  - 76.*reQ3nQ2nstarQ1nstar + 4.*reQ3nQ1nstarQ1nstarQ1nstar
-                  - 8.*reQ3nQ2nstarQ1nstar + 8.*dQ2nQ1nQ2nstarQ1nstar
-                  + 4.*reQ5nQ2nstarQ2nstarQ1nstar - 2.*reQ6nQ3nstarQ3nstar
-                  + 4.*reQ6nQ3nstarQ2nstarQ1nstar - 4.*reQ5nQ4nstarQ1nstar
-                  + 16.*dMult*reQ3nQ2nstarQ1nstar - 2.*reQ4nQ2nstarQ2nstar
-                  - 4.*reQ3nQ3nQ3nstarQ2nstarQ1nstar -8.*reQ4nQ3nstarQ1nstar
-                  - 10.*reQ4nQ2nstarQ2nstar + 4.*reQ4nQ2nstarQ1nstarQ1nstar
-                  - 12.*reQ4nQ3nstarQ1nstar + 8.*dQ3nQ1nQ3nstarQ1nstar
-                  + 8.*reQ3nQ1nQ2nstarQ2nstar - 4.*reQ3nQ1nQ2nstarQ1nstarQ1nstar
-                  + 5.*reQ4nQ2nQ3nstarQ3nstar+2.*pow(pow(dReQ2n,2.)+pow(dImQ2n,2.),2.)
-                  + 4.*reQ5nQ1nQ3nstarQ3nstar+2.*pow(pow(dReQ3n,2.)+pow(dImQ3n,2.),2.)
-                  - 6.*reQ6nQ3nstarQ3nstar - 14.*reQ2nQ1nstarQ1nstar
-                  - 1.*reQ3nQ3nQ2nstarQ2nstarQ2nstar-4.*reQ3nQ2nQ2nstarQ2nstarQ1nstar
-                  - 1.*reQ4nQ1nQ1nQ3nstarQ3nstar-8.*reQ5nQ3nstarQ2nstar
-                  + 2.*pow(pow(dReQ1n,2.)+pow(dImQ1n,2.),2.) - 10.*reQ2nQ1nstarQ1nstar
-                  - 4.*reQ6nQ5nstarQ1nstar-5.*reQ6nQ4nstarQ2nstar
-                  + 1.*reQ6nQ4nstarQ1nstarQ1nstar-8.*reQ5nQ3nstarQ2nstar
-                  + 4.*reQ4nQ1nQ3nstarQ2nstar+8.*dQ3nQ2nQ3nstarQ2nstar
-                  - 120.*dMult + 16.*dMult*dMult)
-                  / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
-
-  // Average 6-particle correlations for all events:      
-  fIntFlowCorrelationsAllPro->Fill(57.5,six3n2n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
-  fIntFlowCorrelationsAllPro->Fill(62.5,six3n3n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
-  if(fCalculateAllCorrelationsVsM)
-  {
-   fIntFlowCorrelationsAllVsMPro[57]->Fill(dMultiplicityBin,six3n2n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
-   fIntFlowCorrelationsAllVsMPro[62]->Fill(dMultiplicityBin,six3n3n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
-  }          
- } // end of if(dMult>5.)
- 
- // |Qn|^2/M, |Q2n|^2/M, |Qn|^4/(M(2M-1)), Re[Q2nQn^*Qn^*]/M, ... vs multiplicity (#RPs, #POIs or external):
- if(fUseQvectorTerms)
- {
-  Double_t dM = dMultiplicityBin-0.5;
-  if(dM>1.) // TBI re-think this if statement 
-  {
-   fQvectorTermsVsMult[0]->Fill(dMultiplicityBin,(pow(dReQ1n,2.)+pow(dImQ1n,2.))/dM);
-   fQvectorTermsVsMult[1]->Fill(dMultiplicityBin,(pow(dReQ2n,2.)+pow(dImQ2n,2.))/dM);
-   fQvectorTermsVsMult[2]->Fill(dMultiplicityBin,(pow(pow(dReQ1n,2.)+pow(dImQ1n,2.),2.))/(dM*(2.*dM-1.)));
-   fQvectorTermsVsMult[3]->Fill(dMultiplicityBin,reQ2nQ1nstarQ1nstar/pow(dM,1.5)); // TBI a bit of heuristic inserted here, re-think the rescaling factor 
-  } // end of if(dM>1.) // TBI re-think this if statement 
- } // end of if(fUseQvectorTerms)
-
- // Bootstrap:
- if(fUseBootstrap||fUseBootstrapVsM)
- {
-  Double_t nSampleNo = 1.*fRandom->Integer(fnSubsamples) + 0.5;
-  if(fUseBootstrap)
-  {
-   fBootstrapCorrelations->Fill(0.5,nSampleNo,two1n1n,mWeight2p); 
-   fBootstrapCorrelations->Fill(1.5,nSampleNo,four1n1n1n1n,mWeight4p);
-   fBootstrapCorrelations->Fill(2.5,nSampleNo,six1n1n1n1n1n1n,mWeight6p); 
-   fBootstrapCorrelations->Fill(3.5,nSampleNo,eight1n1n1n1n1n1n1n1n,mWeight8p); 
-  } // end of if(fUseBootstrap)
-  if(fUseBootstrapVsM)
-  {
-   fBootstrapCorrelationsVsM[0]->Fill(dMultiplicityBin,nSampleNo,two1n1n,mWeight2p); 
-   fBootstrapCorrelationsVsM[1]->Fill(dMultiplicityBin,nSampleNo,four1n1n1n1n,mWeight4p); 
-   fBootstrapCorrelationsVsM[2]->Fill(dMultiplicityBin,nSampleNo,six1n1n1n1n1n1n,mWeight6p); 
-   fBootstrapCorrelationsVsM[3]->Fill(dMultiplicityBin,nSampleNo,eight1n1n1n1n1n1n1n1n,mWeight8p); 
-  } // end of if(fUseBootstrapVsM) 
- } // end of if(fUseBootstrap||fUseBootstrapVsM)
-
- return;
-
-} // end of AliFlowAnalysisWithQCumulants::CalculateIntFlowCorrelations()
-
-//=====================================================================================================
-
-void AliFlowAnalysisWithQCumulants::CalculateMixedHarmonics()
-{
- // Calculate in this method all multi-particle azimuthal correlations in mixed harmonics.
- // (Remark: For completeness sake, we also calculate here again correlations in the same harmonic.) 
-
- // a) Access Q-vectors and multiplicity of current event; 
- // b) Determine multiplicity weights and fill some histos;
- // c) Calculate 2-p correlations; 
- // d) Calculate 3-p correlations; 
- // e) Calculate 4-p correlations; 
- // f) Calculate 5-p correlations; 
- // g) Calculate 6-p correlations; 
- // h) Calculate 7-p correlations; 
- // i) Calculate 8-p correlations.
-
- // a) Access Q-vectors and multiplicity of current event:
- // Multiplicity of an event: 
- Double_t dMult = (*fSpk)(0,0);
- // Real parts of non-weighted Q-vectors evaluated in harmonics n, 2n, 3n, 4n, 5n and 6n: 
- Double_t dReQ1n = (*fReQ)(0,0);
- Double_t dReQ2n = (*fReQ)(1,0);
- Double_t dReQ3n = (*fReQ)(2,0);
- Double_t dReQ4n = (*fReQ)(3,0);
- Double_t dReQ5n = (*fReQ)(4,0); 
- Double_t dReQ6n = (*fReQ)(5,0);
- Double_t dReQ7n = (*fReQ)(6,0);
- Double_t dReQ8n = (*fReQ)(7,0);
- Double_t dReQ9n = (*fReQ)(8,0);
- Double_t dReQ10n = (*fReQ)(9,0);
- Double_t dReQ11n = (*fReQ)(10,0);
- Double_t dReQ12n = (*fReQ)(11,0);
- // Imaginary parts of non-weighted Q-vectors evaluated in harmonics n, 2n, 3n, 4n, 5n and 6n:
- Double_t dImQ1n = (*fImQ)(0,0);
- Double_t dImQ2n = (*fImQ)(1,0);
- Double_t dImQ3n = (*fImQ)(2,0);
- Double_t dImQ4n = (*fImQ)(3,0);
- Double_t dImQ5n = (*fImQ)(4,0); 
- Double_t dImQ6n = (*fImQ)(5,0);
- Double_t dImQ7n = (*fImQ)(6,0);
- Double_t dImQ8n = (*fImQ)(7,0);
- Double_t dImQ9n = (*fImQ)(8,0);
- Double_t dImQ10n = (*fImQ)(9,0);
- Double_t dImQ11n = (*fImQ)(10,0);
- Double_t dImQ12n = (*fImQ)(11,0);
- // All mixed correlators:
- Double_t allMixedCorrelators[139] = {0.};
-
- // Real parts of expressions involving various combinations of Q-vectors which appears
- // simultaneously in several equations for multiparticle correlations bellow: 
- // Re[Q_{2n}Q_{n}^*Q_{n}^*]
- Double_t reQ2nQ1nstarQ1nstar = pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n; 
- // Re[Q_{6n}Q_{3n}^*Q_{3n}^*]
- Double_t reQ6nQ3nstarQ3nstar = pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n;  
- // Re[Q_{4n}Q_{2n}^*Q_{2n}^*]
- Double_t reQ4nQ2nstarQ2nstar = pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n;
- // Re[Q_{4n}Q_{3n}^*Q_{n}^*]
- Double_t reQ4nQ3nstarQ1nstar = dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n);
- // Re[Q_{3n}Q_{2n}^*Q_{n}^*]
- Double_t reQ3nQ2nstarQ1nstar = dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n
-                              + dImQ3n*dImQ2n*dReQ1n; 
- // Re[Q_{5n}Q_{3n}^*Q_{2n}^*]
- Double_t reQ5nQ3nstarQ2nstar = dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n
-                              + dImQ5n*dImQ2n*dReQ3n;                             
- // Re[Q_{5n}Q_{4n}^*Q_{1n}^*]
- Double_t reQ5nQ4nstarQ1nstar = dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n
-                              + dImQ5n*dImQ4n*dReQ1n;                              
- // Re[Q_{6n}Q_{5n}^*Q_{1n}^*]                              
- Double_t reQ6nQ5nstarQ1nstar = dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n
-                              + dImQ6n*dImQ5n*dReQ1n;
- // Re[Q_{6n}Q_{4n}^*Q_{2n}^*]                       
- Double_t reQ6nQ4nstarQ2nstar = dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n
-                              + dImQ6n*dImQ4n*dReQ2n;
- // Re[Q_{3n}Q_{n}Q_{2n}^*Q_{2n}^*]
- Double_t reQ3nQ1nQ2nstarQ2nstar = (pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n);                                
- // Re[Q_{3n}Q_{n}^*Q_{n}^*Q_{n}^*]
- Double_t reQ3nQ1nstarQ1nstarQ1nstar = dReQ3n*pow(dReQ1n,3)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2)
-                                     + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2)-dImQ3n*pow(dImQ1n,3);
- // Re[Q_{6n}Q_{2n}^*Q_{2n}^*Q_{2n}^*]
- Double_t reQ6nQ2nstarQ2nstarQ2nstar = dReQ6n*pow(dReQ2n,3)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2)
-                                     + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2)-dImQ6n*pow(dImQ2n,3);
- // Re[Q_{4n}Q_{2n}^*Q_{n}^*Q_{n}^*]
- Double_t reQ4nQ2nstarQ1nstarQ1nstar = (dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-                                     + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n);  
- // Re[Q_{4n}Q_{2n}^*Q_{3n}^*Q_{3n}^*]
- Double_t reQ4nQ2nQ3nstarQ3nstar = (dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-                                 + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n;                    
- // Re[Q_{4n}Q_{n}Q_{3n}^*Q_{2n}^*]
- Double_t reQ4nQ1nQ3nstarQ2nstar = dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n;
-
- // Re[Q_{5n}Q_{n}Q_{4n}^*Q_{2n}^*]
- Double_t reQ5nQ1nQ4nstarQ2nstar = dImQ1n*dImQ2n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ1n*dReQ2n 
-                                 + dImQ2n*dImQ5n*dReQ1n*dReQ4n-dImQ1n*dImQ5n*dReQ2n*dReQ4n
-                                 - dImQ2n*dImQ4n*dReQ1n*dReQ5n+dImQ1n*dImQ4n*dReQ2n*dReQ5n 
-                                 + dImQ1n*dImQ2n*dReQ4n*dReQ5n+dReQ1n*dReQ2n*dReQ4n*dReQ5n;                                  
- // Re[Q_{5n}Q_{n}Q_{3n}^*Q_{3n}^*]                                  
- Double_t reQ5nQ1nQ3nstarQ3nstar = dImQ1n*pow(dImQ3n,2.)*dImQ5n+2.*dImQ3n*dImQ5n*dReQ1n*dReQ3n
-                                 - dImQ1n*dImQ5n*pow(dReQ3n,2.)-pow(dImQ3n,2.)*dReQ1n*dReQ5n 
-                                 + 2.*dImQ1n*dImQ3n*dReQ3n*dReQ5n+dReQ1n*pow(dReQ3n,2.)*dReQ5n;
- // Re[Q_{5n}Q_{3n}^*Q_{n}^*Q_{n}^*]                                  
- Double_t reQ5nQ3nstarQ1nstarQ1nstar = -pow(dImQ1n,2.)*dImQ3n*dImQ5n+dImQ3n*dImQ5n*pow(dReQ1n,2.)
-                                     + 2.*dImQ1n*dImQ5n*dReQ1n*dReQ3n-2.*dImQ1n*dImQ3n*dReQ1n*dReQ5n 
-                                     - pow(dImQ1n,2.)*dReQ3n*dReQ5n+pow(dReQ1n,2.)*dReQ3n*dReQ5n;                     
- // Re[Q_{5n}Q_{2n}^*Q_{2n}^*Q_{n}^*]                                  
- Double_t reQ5nQ2nstarQ2nstarQ1nstar = -pow(dImQ2n,2.)*dImQ1n*dImQ5n+dImQ1n*dImQ5n*pow(dReQ2n,2.)
-                                     + 2.*dImQ2n*dImQ5n*dReQ2n*dReQ1n-2.*dImQ2n*dImQ1n*dReQ2n*dReQ5n 
-                                     - pow(dImQ2n,2.)*dReQ1n*dReQ5n+pow(dReQ2n,2.)*dReQ1n*dReQ5n;                                     
- // Re[Q_{6n}Q_{4n}^*Q_{n}^*Q_{n}^*]                                  
- Double_t reQ6nQ4nstarQ1nstarQ1nstar = -pow(dImQ1n,2.)*dImQ4n*dImQ6n+dImQ4n*dImQ6n*pow(dReQ1n,2.) 
-                                     +  2.*dImQ1n*dImQ6n*dReQ1n*dReQ4n-2.*dImQ1n*dImQ4n*dReQ1n*dReQ6n 
-                                     -  pow(dImQ1n,2.)*dReQ4n*dReQ6n+pow(dReQ1n,2.)*dReQ4n*dReQ6n;
- /*// |Q_{2n}|^2 |Q_{n}|^2
- Double_t dQ2nQ1nQ2nstarQ1nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.));
- // |Q_{4n}|^2 |Q_{2n}|^2
- Double_t dQ4nQ2nQ4nstarQ2nstar = (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.));
- // |Q_{3n}|^2 |Q_{2n}|^2
- Double_t dQ3nQ2nQ3nstarQ2nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.));
- // |Q_{5n}|^2 |Q_{n}|^2
- Double_t dQ5nQ1nQ5nstarQ1nstar = (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.));
- // |Q_{3n}|^2 |Q_{n}|^2
- Double_t dQ3nQ1nQ3nstarQ1nstar = (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.));*/
- // Re[Q_{2n}Q_{n}Q_{n}^*Q_{n}^*Q_{n}^*]
- /*Double_t reQ2nQ1nQ1nstarQ1nstarQ1nstar = (dReQ2n*dReQ1n-dImQ2n*dImQ1n)*(pow(dReQ1n,3)-3.*dReQ1n*pow(dImQ1n,2))
-                                        + (dReQ2n*dImQ1n+dReQ1n*dImQ2n)*(3.*dImQ1n*pow(dReQ1n,2)-pow(dImQ1n,3));*/ 
- // Re[Q_{2n}Q_{2n}Q_{2n}^*Q_{n}^*Q_{n}^*]
- /*Double_t reQ2nQ2nQ2nstarQ1nstarQ1nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                                        * (dReQ2n*(pow(dReQ1n,2.)-pow(dImQ1n,2.)) + 2.*dImQ2n*dReQ1n*dImQ1n);*/
- /*// Re[Q_{4n}Q_{n}^*Q_{n}^*Q_{n}^*Q_{n}^*]
- Double_t reQ4nQ1nstarQ1nstarQ1nstarQ1nstar = pow(dReQ1n,4.)*dReQ4n-6.*pow(dReQ1n,2.)*dReQ4n*pow(dImQ1n,2.)
-                                            + pow(dImQ1n,4.)*dReQ4n+4.*pow(dReQ1n,3.)*dImQ1n*dImQ4n
-                                            - 4.*pow(dImQ1n,3.)*dReQ1n*dImQ4n;*/
- // Re[Q_{3n}Q_{n}Q_{2n}^*Q_{n}^*Q_{n}^*]
- /*Double_t reQ3nQ1nQ2nstarQ1nstarQ1nstar = (pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                                        * (dReQ1n*dReQ2n*dReQ3n-dReQ3n*dImQ1n*dImQ2n
-                                        + dReQ2n*dImQ1n*dImQ3n+dReQ1n*dImQ2n*dImQ3n);*/
- // Re[Q_{6n}Q_{n}Q_{3n}^*Q_{2n}^*Q_{n}^*]
- Double_t reQ6nQ3nstarQ2nstarQ1nstar = dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                                     - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                                     + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                                     + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n;
- // Re[Q_{3n}Q_{3n}Q_{3n}^*Q_{2n}^*Q_{n}^*]
- /*Double_t reQ3nQ3nQ3nstarQ2nstarQ1nstar = (pow(dImQ3n,2.)+pow(dReQ3n,2.))
-                                        * (dImQ2n*dImQ3n*dReQ1n+dImQ1n*dImQ3n*dReQ2n
-                                        - dImQ1n*dImQ2n*dReQ3n+dReQ1n*dReQ2n*dReQ3n);*/   
- /*// Re[Q_{3n}Q_{3n}Q_{2n}^*Q_{2n}^*Q_{2n}^*]
- Double_t reQ3nQ3nQ2nstarQ2nstarQ2nstar = pow(dReQ2n,3.)*pow(dReQ3n,2.) 
-                                        - 3.*dReQ2n*pow(dReQ3n,2.)*pow(dImQ2n,2.)
-                                        + 6.*pow(dReQ2n,2.)*dReQ3n*dImQ2n*dImQ3n 
-                                        - 2.*dReQ3n*pow(dImQ2n,3.)*dImQ3n-pow(dReQ2n,3.)*pow(dImQ3n,2.) 
-                                        + 3.*dReQ2n*pow(dImQ2n,2.)*pow(dImQ3n,2.);*/
- // Re[Q_{4n}Q_{2n}Q_{3n}^*Q_{2n}^*Q_{n}^*]
- /*Double_t reQ4nQ2nQ3nstarQ2nstarQ1nstar = (pow(dImQ2n,2.)+pow(dReQ2n,2.))
-                                        * (dImQ3n*dImQ4n*dReQ1n+dImQ1n*dImQ4n*dReQ3n 
-                                        - dImQ1n*dImQ3n*dReQ4n+dReQ1n*dReQ3n*dReQ4n);*/
- // Re[Q_{3n}Q_{2n}Q_{3n}^*Q_{n}^*Q_{n}^*]
- /*Double_t reQ3nQ2nQ3nstarQ1nstarQ1nstar = -(pow(dImQ3n,2.)+pow(dReQ3n,2.))
-                                        * (-2.*dImQ1n*dImQ2n*dReQ1n+pow(dImQ1n,2.)*dReQ2n-pow(dReQ1n,2.)*dReQ2n);*/                              
- // Re[Q_{3n}Q_{2n}Q_{2n}^*Q_{2n}^*Q_{n}^*]
- /*Double_t reQ3nQ2nQ2nstarQ2nstarQ1nstar = (pow(dImQ2n,2.)+pow(dReQ2n,2.))
-                                        * (dImQ2n*dImQ3n*dReQ1n+dImQ1n*dImQ3n*dReQ2n 
-                                        - dImQ1n*dImQ2n*dReQ3n+dReQ1n*dReQ2n*dReQ3n);*/
-/* // Re[Q_{5n}Q_{n}Q_{3n}^*Q_{2n}^*Q_{n}^*]
- Double_t reQ5nQ1nQ3nstarQ2nstarQ1nstar = (pow(dImQ1n,2.)+pow(dReQ1n,2.))
-                                        * (dImQ3n*dImQ5n*dReQ2n+dImQ2n*dImQ5n*dReQ3n 
-                                        - dImQ2n*dImQ3n*dReQ5n+dReQ2n*dReQ3n*dReQ5n);   
- */
- /*
- // Re[Q_{2n}Q_{2n}Q_{n}^*Q_{n}^*Q_{n}^*Q_{n}^*]
- Double_t reQ2nQ2nQ1nstarQ1nstarQ1nstarQ1nstar = (pow(dReQ1n,2.)*dReQ2n-2.*dReQ1n*dReQ2n*dImQ1n-dReQ2n*pow(dImQ1n,2.)
-                                               + dImQ2n*pow(dReQ1n,2.)+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dImQ2n)
-                                               * (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dReQ2n*dImQ1n-dReQ2n*pow(dImQ1n,2.)
-                                               - dImQ2n*pow(dReQ1n,2.)+2.*dReQ1n*dImQ1n*dImQ2n+pow(dImQ1n,2.)*dImQ2n); 
- // Re[Q_{3n}Q_{n}Q_{n}^*Q_{n}^*Q_{n}^*Q_{n}^*]
- Double_t reQ3nQ1nQ1nstarQ1nstarQ1nstarQ1nstar = (pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                                               * (pow(dReQ1n,3.)*dReQ3n-3.*dReQ1n*dReQ3n*pow(dImQ1n,2.)
-                                               + 3.*pow(dReQ1n,2.)*dImQ1n*dImQ3n-pow(dImQ1n,3.)*dImQ3n);
- */
- // |Q_{2n}|^2 |Q_{n}|^4
- //Double_t dQ2nQ1nQ1nQ2nstarQ1nstarQ1nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))*pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.); 
- /*
- // |Q_{3n}|^2 |Q_{2n}|^2 |Q_{n}|^2
- Double_t dQ3nQ2nQ1nQ3nstarQ2nstarQ1nstar = (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                                          * (pow(dReQ1n,2.)+pow(dImQ1n,2.));
- // Re[Q_{2n}Q_{n}Q_{n}Q_{n}^*Q_{n}^*Q_{n}^*Q_{n}^*]
- Double_t reQ2nQ1nQ1nQ1nstarQ1nstarQ1nstarQ1nstar = pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.)
-                                                  * (pow(dReQ1n,2.)*dReQ2n-dReQ2n*pow(dImQ1n,2.)
-                                                  + 2.*dReQ1n*dImQ1n*dImQ2n);                                                  
- */
- // Re[Q_{6n}Q_{2n}^*Q_{2n}^*Q_{n}^*Q_{n}^*]
- /*Double_t reQ6nQ2nstarQ2nstarQ1nstarQ1nstar = pow(dReQ1n*dReQ2n,2.)*dReQ6n-pow(dReQ2n*dImQ1n,2.)*dReQ6n
-                                            - 4.*dReQ1n*dReQ2n*dReQ6n*dImQ1n*dImQ2n 
-                                            - pow(dReQ1n*dImQ2n,2.)*dReQ6n+pow(dImQ1n*dImQ2n,2.)*dReQ6n
-                                            + 2.*dReQ1n*pow(dReQ2n,2.)*dImQ1n*dImQ6n
-                                            + 2.*pow(dReQ1n,2.)*dReQ2n*dImQ2n*dImQ6n 
-                                            - 2.*dReQ2n*pow(dImQ1n,2.)*dImQ2n*dImQ6n 
-                                            - 2.*dReQ1n*dImQ1n*pow(dImQ2n,2.)*dImQ6n;
- */											 
- // Re[Q_{4n}Q_{1n}Q_{1n}Q_{3n}^*Q_{3n}^*]
- /*
- Double_t reQ4nQ1nQ1nQ3nstarQ3nstar = pow(dReQ1n*dReQ3n,2.)*dReQ4n-pow(dReQ3n*dImQ1n,2.)*dReQ4n  
-                                    + 4.*dReQ1n*dReQ3n*dReQ4n*dImQ1n*dImQ3n 
-                                    - pow(dReQ1n*dImQ3n,2.)*dReQ4n+pow(dImQ1n*dImQ3n,2.)*dReQ4n  
-                                    - 2.*dReQ1n*pow(dReQ3n,2.)*dImQ1n*dImQ4n 
-                                    + 2.*pow(dReQ1n,2.)*dReQ3n*dImQ3n*dImQ4n 
-                                    - 2.*dReQ3n*pow(dImQ1n,2.)*dImQ3n*dImQ4n 
-                                    + 2.*dReQ1n*dImQ1n*pow(dImQ3n,2.)*dImQ4n;*/
- /* 
- // Re[Q_{3n}Q_{3n}Q_{2n}^*Q_{2n}^*Q_{1n}^*Q_{1n}^*]
- Double_t reQ3nQ3nQ2nstarQ2nstarQ1nstarQ1nstar = (dReQ1n*dReQ2n*dReQ3n-dReQ2n*dReQ3n*dImQ1n-dReQ1n*dReQ3n*dImQ2n 
-                                               - dReQ3n*dImQ1n*dImQ2n+dReQ1n*dReQ2n*dImQ3n+dReQ2n*dImQ1n*dImQ3n 
-                                               + dReQ1n*dImQ2n*dImQ3n-dImQ1n*dImQ2n*dImQ3n)*(dReQ1n*dReQ2n*dReQ3n 
-                                               + dReQ2n*dReQ3n*dImQ1n+dReQ1n*dReQ3n*dImQ2n-dReQ3n*dImQ1n*dImQ2n 
-                                               - dReQ1n*dReQ2n*dImQ3n+dReQ2n*dImQ1n*dImQ3n+dReQ1n*dImQ2n*dImQ3n 
-                                               + dImQ1n*dImQ2n*dImQ3n);
- */
-
- // b) Determine multiplicity weights and fill some histos:
- Double_t d2pMultiplicityWeight = 0.; // weight for <2>_{...} to get <<2>>_{...}
- Double_t d3pMultiplicityWeight = 0.; // weight for <3>_{...} to get <<3>>_{...}
- Double_t d4pMultiplicityWeight = 0.; // weight for <4>_{...} to get <<4>>_{...}
- Double_t d5pMultiplicityWeight = 0.; // weight for <5>_{...} to get <<5>>_{...}
- Double_t d6pMultiplicityWeight = 0.; // weight for <6>_{...} to get <<6>>_{...}
- Double_t d7pMultiplicityWeight = 0.; // weight for <7>_{...} to get <<7>>_{...}
- Double_t d8pMultiplicityWeight = 0.; // weight for <8>_{...} to get <<8>>_{...}
- if(fMultiplicityWeight->Contains("combinations")) // default multiplicity weight
- {
-  d2pMultiplicityWeight = dMult*(dMult-1.);
-  d3pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.);
-  d4pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.);
-  d5pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.);
-  d6pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.);
-  d7pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.)*(dMult-6.);
-  d8pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.)*(dMult-6.)*(dMult-7.);
- } else if(fMultiplicityWeight->Contains("unit"))
-   {
-    d2pMultiplicityWeight = 1.;
-    d3pMultiplicityWeight = 1.;
-    d4pMultiplicityWeight = 1.;
-    d5pMultiplicityWeight = 1.;
-    d6pMultiplicityWeight = 1.;
-    d7pMultiplicityWeight = 1.;
-    d8pMultiplicityWeight = 1.;
-   } else if(fMultiplicityWeight->Contains("multiplicity"))
-     {
-      d2pMultiplicityWeight = dMult;
-      d3pMultiplicityWeight = dMult;
-      d4pMultiplicityWeight = dMult;
-      d5pMultiplicityWeight = dMult;
-      d6pMultiplicityWeight = dMult;
-      d7pMultiplicityWeight = dMult;
-      d8pMultiplicityWeight = dMult; 
-     }       
- for(Int_t p=0;p<=1;p++) // power (0=linear,1=quadratic)
- {
-  fMixedHarmonicEventWeights[p]->Fill(0.5,pow(dMult,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(1.5,pow(d2pMultiplicityWeight,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(2.5,pow(d3pMultiplicityWeight,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(3.5,pow(d4pMultiplicityWeight,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(4.5,pow(d5pMultiplicityWeight,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(5.5,pow(d6pMultiplicityWeight,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(6.5,pow(d7pMultiplicityWeight,p+1));
-  fMixedHarmonicEventWeights[p]->Fill(7.5,pow(d8pMultiplicityWeight,p+1));
- } // end of for(Int_t p=0;p<=1;p++) // power (0=linear,1=quadratic)   
- fMixedHarmonicProductOfEventWeights->Fill(0.5,0.5,dMult*dMult);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,1.5,dMult*d2pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,2.5,dMult*d3pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,3.5,dMult*d4pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,4.5,dMult*d5pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,5.5,dMult*d6pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,6.5,dMult*d7pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(0.5,7.5,dMult*d8pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,1.5,d2pMultiplicityWeight*d2pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,2.5,d2pMultiplicityWeight*d3pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,3.5,d2pMultiplicityWeight*d4pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,4.5,d2pMultiplicityWeight*d5pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,5.5,d2pMultiplicityWeight*d6pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,6.5,d2pMultiplicityWeight*d7pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(1.5,7.5,d2pMultiplicityWeight*d8pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(2.5,2.5,d3pMultiplicityWeight*d3pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(2.5,3.5,d3pMultiplicityWeight*d4pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(2.5,4.5,d3pMultiplicityWeight*d5pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(2.5,5.5,d3pMultiplicityWeight*d6pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(2.5,6.5,d3pMultiplicityWeight*d7pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(2.5,7.5,d3pMultiplicityWeight*d8pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(3.5,3.5,d4pMultiplicityWeight*d4pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(3.5,4.5,d4pMultiplicityWeight*d5pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(3.5,5.5,d4pMultiplicityWeight*d6pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(3.5,6.5,d4pMultiplicityWeight*d7pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(3.5,7.5,d4pMultiplicityWeight*d8pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(4.5,4.5,d5pMultiplicityWeight*d5pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(4.5,5.5,d5pMultiplicityWeight*d6pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(4.5,6.5,d5pMultiplicityWeight*d7pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(4.5,7.5,d5pMultiplicityWeight*d8pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(5.5,5.5,d6pMultiplicityWeight*d6pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(5.5,6.5,d6pMultiplicityWeight*d7pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(5.5,7.5,d6pMultiplicityWeight*d8pMultiplicityWeight);
- fMixedHarmonicProductOfEventWeights->Fill(6.5,6.5,d7pMultiplicityWeight*d7pMultiplicityWeight); 
- fMixedHarmonicProductOfEventWeights->Fill(6.5,7.5,d7pMultiplicityWeight*d8pMultiplicityWeight); 
- fMixedHarmonicProductOfEventWeights->Fill(7.5,7.5,d8pMultiplicityWeight*d8pMultiplicityWeight); 
- 
- // c) Calculate 2-p correlations:
- Double_t two1n1n = 0.; // <2>_{1n|1n} = <cos(1n(phi1-phi2))>
- Double_t two2n2n = 0.; // <2>_{2n|2n} = <cos(2n(phi1-phi2))>
- Double_t two3n3n = 0.; // <2>_{3n|3n} = <cos(3n(phi1-phi2))>
- Double_t two4n4n = 0.; // <2>_{4n|4n} = <cos(4n(phi1-phi2))>
- Double_t two5n5n = 0.; // <2>_{5n|5n} = <cos(5n(phi1-phi2))>
- Double_t two6n6n = 0.; // <2>_{6n|6n} = <cos(6n(phi1-phi2))>
- if(dMult>1.)
- {
-  two1n1n = (pow(dReQ1n,2.)+pow(dImQ1n,2.)-dMult)/(dMult*(dMult-1.)); 
-  two2n2n = (pow(dReQ2n,2.)+pow(dImQ2n,2.)-dMult)/(dMult*(dMult-1.)); 
-  two3n3n = (pow(dReQ3n,2.)+pow(dImQ3n,2.)-dMult)/(dMult*(dMult-1.)); 
-  two4n4n = (pow(dReQ4n,2.)+pow(dImQ4n,2.)-dMult)/(dMult*(dMult-1.)); 
-  two5n5n = (pow(dReQ5n,2.)+pow(dImQ5n,2.)-dMult)/(dMult*(dMult-1.)); 
-  two6n6n = (pow(dReQ6n,2.)+pow(dImQ6n,2.)-dMult)/(dMult*(dMult-1.));   
-  f2pCorrelations->Fill(0.5,two1n1n,d2pMultiplicityWeight);
-  f2pCorrelations->Fill(1.5,two2n2n,d2pMultiplicityWeight);
-  f2pCorrelations->Fill(2.5,two3n3n,d2pMultiplicityWeight);
-  f2pCorrelations->Fill(3.5,two4n4n,d2pMultiplicityWeight);
-  f2pCorrelations->Fill(4.5,two5n5n,d2pMultiplicityWeight);
-  f2pCorrelations->Fill(5.5,two6n6n,d2pMultiplicityWeight);
-  allMixedCorrelators[0]=two1n1n;
-  allMixedCorrelators[1]=two2n2n;
-  allMixedCorrelators[2]=two3n3n;
-  allMixedCorrelators[3]=two4n4n;
-  allMixedCorrelators[4]=two5n5n;
-  allMixedCorrelators[5]=two6n6n;
- } // end of if(dMult>1.)
-
- // d) Calculate 3-p correlations:
- //  d1) Two distinct harmonics (3): 
- Double_t three2n1n1n = 0.; // <3>_{2n|1n,1n} = <cos(n(2*phi1-1*phi2-1*phi3))>
- Double_t three4n2n2n = 0.; // <3>_{4n|2n,2n} = <cos(n(4*phi1-2*phi2-2*phi3))>
- Double_t three6n3n3n = 0.; // <3>_{6n|3n,3n} = <cos(n(6*phi1-3*phi2-3*phi3))> 
- //  d2) Three distinct harmonics (6): 
- Double_t three3n2n1n = 0.; // <3>_{3n|2n,1n} = <cos(n(3*phi1-2*phi2-1*phi3))>
- Double_t three4n3n1n = 0.; // <3>_{4n|3n,1n} = <cos(n(4*phi1-3*phi2-1*phi3))> 
- Double_t three5n3n2n = 0.; // <3>_{5n|3n,2n} = <cos(n(5*phi1-3*phi2-2*phi3))>
- Double_t three5n4n1n = 0.; // <3>_{5n|4n,1n} = <cos(n(5*phi1-4*phi2-1*phi3))> 
- Double_t three6n4n2n = 0.; // <3>_{6n|4n,2n} = <cos(n(6*phi1-4*phi2-2*phi3))> 
- Double_t three6n5n1n = 0.; // <3>_{6n|5n,1n} = <cos(n(6*phi1-5*phi2-1*phi3))>
- if(dMult>2.)
- {
-  three2n1n1n = (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n
-              - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-(pow(dReQ2n,2.)+pow(dImQ2n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.)); 
-  three4n2n2n = (pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n
-              - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-(pow(dReQ4n,2.)+pow(dImQ4n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.)); 
-  three6n3n3n = (reQ6nQ3nstarQ3nstar
-	      - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-              - (pow(dReQ6n,2.)+pow(dImQ6n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.));  
-  three3n2n1n = (dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n
-              + dImQ3n*dImQ2n*dReQ1n-(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-              - (pow(dReQ2n,2.)+pow(dImQ2n,2.))-(pow(dReQ1n,2.)+pow(dImQ1n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.));
-  three4n3n1n = (dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n)
-              - (pow(dReQ4n,2.)+pow(dImQ4n,2.))-(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-              - (pow(dReQ1n,2.)+pow(dImQ1n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.));  
-  three5n3n2n = (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n
-              + dImQ5n*dImQ2n*dReQ3n-(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-              - (pow(dReQ3n,2.)+pow(dImQ3n,2.))
-              - (pow(dReQ2n,2.)+pow(dImQ2n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.)); 
-  three5n4n1n = (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n
-              + dImQ5n*dImQ4n*dReQ1n-(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-              - (pow(dReQ4n,2.)+pow(dImQ4n,2.))
-              - (pow(dReQ1n,2.)+pow(dImQ1n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.));
-  three6n4n2n = (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n
-              + dImQ6n*dImQ4n*dReQ2n-(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-              - (pow(dReQ4n,2.)+pow(dImQ4n,2.))-(pow(dReQ2n,2.)+pow(dImQ2n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.));
-  three6n5n1n = (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n
-              + dImQ6n*dImQ5n*dReQ1n-(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-              - (pow(dReQ5n,2.)+pow(dImQ5n,2.))
-              - (pow(dReQ1n,2.)+pow(dImQ1n,2.))+2.*dMult)
-              / (dMult*(dMult-1.)*(dMult-2.)); 
-  f3pCorrelations->Fill(0.5,three2n1n1n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(1.5,three4n2n2n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(2.5,three6n3n3n,d3pMultiplicityWeight);
-  //f3pCorrelations->Fill(3.5,0.,d3pMultiplicityWeight); // empty TBI
-  f3pCorrelations->Fill(4.5,three3n2n1n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(5.5,three4n3n1n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(6.5,three5n3n2n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(7.5,three5n4n1n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(8.5,three6n4n2n,d3pMultiplicityWeight);
-  f3pCorrelations->Fill(9.5,three6n5n1n,d3pMultiplicityWeight);
-  allMixedCorrelators[6]=three2n1n1n;
-  allMixedCorrelators[7]=three4n2n2n;
-  allMixedCorrelators[8]=three6n3n3n;
-  allMixedCorrelators[9]=three3n2n1n;
-  allMixedCorrelators[10]=three4n3n1n;
-  allMixedCorrelators[11]=three5n3n2n;
-  allMixedCorrelators[12]=three5n4n1n;
-  allMixedCorrelators[13]=three6n4n2n;
-  allMixedCorrelators[14]=three6n5n1n;
- } // end of if(dMult>2.)
-
- // e) Calculate 4-p correlations:
- //  e1) Single harmonic (6): 
- Double_t four1n1n1n1n = 0.; // <4>_{1n,1n|1n,1n} = <cos(1*n(phi1+phi2-phi3-phi4))>
- Double_t four2n2n2n2n = 0.; // <4>_{2n,2n|2n,2n} = <cos(2*n(phi1+phi2-phi3-phi4))>
- Double_t four3n3n3n3n = 0.; // <4>_{3n,3n|3n,3n} = <cos(3*n(phi1+phi2-phi3-phi4))>
- Double_t four4n4n4n4n = 0.; // <4>_{4n,4n|4n,4n} = <cos(4*n(phi1+phi2-phi3-phi4))>
- Double_t four5n5n5n5n = 0.; // <4>_{5n,5n|5n,5n} = <cos(5*n(phi1+phi2-phi3-phi4))>
- Double_t four6n6n6n6n = 0.; // <4>_{6n,6n|6n,6n} = <cos(6*n(phi1+phi2-phi3-phi4))>
- //  e2) "Standard candles" (15):
- Double_t four2n1n2n1n = 0.; // <4>_{2n,1n|2n,1n} = <cos(n(2*phi1+1*phi2-2*phi3-1*phi4))>
- Double_t four3n1n3n1n = 0.; // <4>_{3n,1n|3n,1n} = <cos(n(3*phi1+1*phi2-3*phi3-1*phi4))>
- Double_t four3n2n3n2n = 0.; // <4>_{3n,2n|3n,2n} = <cos(n(3*phi1+2*phi2-3*phi3-2*phi4))>
- Double_t four4n1n4n1n = 0.; // <4>_{4n,1n|4n,1n} = <cos(n(4*phi1+1*phi2-4*phi3-1*phi4))>
- Double_t four4n2n4n2n = 0.; // <4>_{4n,2n|4n,2n} = <cos(n(4*phi1+2*phi2-4*phi3-2*phi4))>
- Double_t four4n3n4n3n = 0.; // <4>_{4n,3n|4n,3n} = <cos(n(4*phi1+3*phi2-4*phi3-3*phi4))>
- Double_t four5n1n5n1n = 0.; // <4>_{5n,1n|5n,1n} = <cos(n(5*phi1+1*phi2-5*phi3-1*phi4))>
- Double_t four5n2n5n2n = 0.; // <4>_{5n,2n|5n,2n} = <cos(n(5*phi1+2*phi2-5*phi3-2*phi4))>
- Double_t four5n3n5n3n = 0.; // <4>_{5n,3n|5n,3n} = <cos(n(5*phi1+3*phi2-5*phi3-3*phi4))>
- Double_t four5n4n5n4n = 0.; // <4>_{5n,4n|5n,4n} = <cos(n(5*phi1+4*phi2-5*phi3-4*phi4))>
- Double_t four6n1n6n1n = 0.; // <4>_{6n,1n|6n,1n} = <cos(n(6*phi1+1*phi2-6*phi3-1*phi4))>
- Double_t four6n2n6n2n = 0.; // <4>_{6n,2n|6n,2n} = <cos(n(6*phi1+2*phi2-6*phi3-2*phi4))>
- Double_t four6n3n6n3n = 0.; // <4>_{6n,3n|6n,3n} = <cos(n(6*phi1+3*phi2-6*phi3-3*phi4))>
- Double_t four6n4n6n4n = 0.; // <4>_{6n,4n|6n,4n} = <cos(n(6*phi1+4*phi2-6*phi3-4*phi4))>
- Double_t four6n5n6n5n = 0.; // <4>_{6n,5n|6n,5n} = <cos(n(6*phi1+5*phi2-6*phi3-5*phi4))>
- //  e3) Two distinct harmonics (2): 
- Double_t four3n1n1n1n = 0.; // <4>_{3n|1n,1n,1n} = <cos(n(3*phi1-1*phi2-1*phi3-1*phi4))>
- Double_t four6n2n2n2n = 0.; // <4>_{6n|2n,2n,2n} = <cos(n(6*phi1-2*phi2-2*phi3-2*phi4))>
- //  e4) Three distinct harmonics (10): 
- Double_t four3n1n2n2n = 0.; // <4>_{3n,1n|2n,2n} = <cos(n(3*phi1+1*phi2-2*phi3-2*phi4))>
- Double_t four4n2n1n1n = 0.; // <4>_{4n|2n,1n,1n} = <cos(n(4*phi1-2*phi2-1*phi3-1*phi4))>
- Double_t four4n2n3n3n = 0.; // <4>_{4n,2n|3n,3n} = <cos(n(4*phi1+2*phi2-3*phi3-3*phi4))>
- Double_t four5n2n2n1n = 0.; // <4>_{5n|2n,2n,1n} = <cos(n(5*phi1-2*phi2-2*phi3-1*phi4))>
- Double_t four5n3n1n1n = 0.; // <4>_{5n|3n,1n,1n} = <cos(n(5*phi1-3*phi2-1*phi3-1*phi4))>
- Double_t four5n1n3n3n = 0.; // <4>_{5n,1n|3n,3n} = <cos(n(5*phi1+1*phi2-3*phi3-3*phi4))>
- Double_t four5n3n4n4n = 0.; // <4>_{5n,3n|4n,4n} = <cos(n(5*phi1+3*phi2-4*phi3-4*phi4))>
- Double_t four6n4n1n1n = 0.; // <4>_{6n|4n,1n,1n} = <cos(n(6*phi1-4*phi2-1*phi3-1*phi4))>
- Double_t four6n2n4n4n = 0.; // <4>_{6n,2n|4n,4n} = <cos(n(6*phi1+2*phi2-4*phi3-4*phi4))>
- Double_t four6n4n5n5n = 0.; // <4>_{6n,4n|5n,5n} = <cos(n(6*phi1+4*phi2-5*phi3-5*phi4))>
- //  e5) Four distinct harmonics (8): 
- Double_t four4n1n3n2n = 0.; // <4>_{4n,1n|3n,2n} = <cos(n(4*phi1+1*phi2-3*phi3-2*phi4))>
- Double_t four5n1n4n2n = 0.; // <4>_{5n,1n|4n,2n} = <cos(n(5*phi1+1*phi2-4*phi3-2*phi4))>
- Double_t four5n2n4n3n = 0.; // <4>_{5n,2n|4n,3n} = <cos(n(5*phi1+2*phi2-4*phi3-3*phi4))>
- Double_t four6n1n4n3n = 0.; // <4>_{6n,1n|4n,3n} = <cos(n(6*phi1+1*phi2-4*phi3-3*phi4))>
- Double_t four6n1n5n2n = 0.; // <4>_{6n,1n|5n,2n} = <cos(n(6*phi1+1*phi2-5*phi3-2*phi4))>
- Double_t four6n3n2n1n = 0.; // <4>_{6n|3n,2n,1n} = <cos(n(6*phi1-3*phi2-2*phi3-1*phi4))>
- Double_t four6n2n5n3n = 0.; // <4>_{6n,2n|5n,3n} = <cos(n(6*phi1+2*phi2-5*phi3-3*phi4))>
- Double_t four6n3n5n4n = 0.; // <4>_{6n,3n|5n,4n} = <cos(n(6*phi1+3*phi2-5*phi3-4*phi4))>
- if(dMult>3.)
- {
-  // Single harmonic (6): 
-  four1n1n1n1n = (2.*dMult*(dMult-3.)+pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.)-4.*(dMult-2.)*(pow(dReQ1n,2.)
-               + pow(dImQ1n,2.))-2.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               + (pow(dReQ2n,2.)+pow(dImQ2n,2.)))
-               / (dMult*(dMult-1)*(dMult-2.)*(dMult-3.));     
-  four2n2n2n2n = (2.*dMult*(dMult-3.)+pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)-4.*(dMult-2.)*(pow(dReQ2n,2.)
-               + pow(dImQ2n,2.))-2.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               + (pow(dReQ4n,2.)+pow(dImQ4n,2.)))
-               / (dMult*(dMult-1)*(dMult-2.)*(dMult-3.)); 
-  four3n3n3n3n = (2.*dMult*(dMult-3.)+pow((pow(dReQ3n,2.)+pow(dImQ3n,2.)),2.)-4.*(dMult-2.)*(pow(dReQ3n,2.)
-               + pow(dImQ3n,2.))-2.*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-               + (pow(dReQ6n,2.)+pow(dImQ6n,2.)))
-               / (dMult*(dMult-1)*(dMult-2.)*(dMult-3.));     
-  four4n4n4n4n = (2.*dMult*(dMult-3.)+pow((pow(dReQ4n,2.)+pow(dImQ4n,2.)),2.)-4.*(dMult-2.)*(pow(dReQ4n,2.)
-               + pow(dImQ4n,2.))-2.*(pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-               + (pow(dReQ8n,2.)+pow(dImQ8n,2.)))
-               / (dMult*(dMult-1)*(dMult-2.)*(dMult-3.));     
-  four5n5n5n5n = (2.*dMult*(dMult-3.)+pow((pow(dReQ5n,2.)+pow(dImQ5n,2.)),2.)-4.*(dMult-2.)*(pow(dReQ5n,2.)
-               + pow(dImQ5n,2.))-2.*(pow(dReQ5n,2.)*dReQ10n+2.*dReQ5n*dImQ5n*dImQ10n-pow(dImQ5n,2.)*dReQ10n)
-               + (pow(dReQ10n,2.)+pow(dImQ10n,2.)))
-               / (dMult*(dMult-1)*(dMult-2.)*(dMult-3.));    
-  four6n6n6n6n = (2.*dMult*(dMult-3.)+pow((pow(dReQ6n,2.)+pow(dImQ6n,2.)),2.)-4.*(dMult-2.)*(pow(dReQ6n,2.)
-               + pow(dImQ6n,2.))-2.*(pow(dReQ6n,2.)*dReQ12n+2.*dReQ6n*dImQ6n*dImQ12n-pow(dImQ6n,2.)*dReQ12n)
-               + (pow(dReQ12n,2.)+pow(dImQ12n,2.)))
-               / (dMult*(dMult-1)*(dMult-2.)*(dMult-3.));  
-  // "Standard candles" (15):
-  four2n1n2n1n = ((pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n
-               + dImQ3n*dImQ2n*dReQ1n)-2.*(pow(dReQ1n,2.)*dReQ2n
-               + 2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - ((dMult-5.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-               + (dMult-4.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-(pow(dReQ3n,2.)+pow(dImQ3n,2.)))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               + (dMult-6.)/((dMult-1.)*(dMult-2.)*(dMult-3.));
-  four3n1n3n1n = ((pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-               - 2.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + pow(dReQ4n,2.)+pow(dImQ4n,2.)-(dMult-4.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + pow(dReQ2n,2.)+pow(dImQ2n,2.)-(dMult-4.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four3n2n3n2n = ((pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               - 2.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)               
-               - (dMult-4.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));  
-  four4n1n4n1n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-               - 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ1n*dImQ4n+dImQ5n*dImQ1n*dReQ4n)
-               - 2.*(dReQ3n*dReQ4n*dReQ1n+dImQ3n*dImQ4n*dReQ1n+dReQ3n*dImQ4n*dImQ1n-dImQ3n*dImQ1n*dReQ4n)
-               + pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)
-               - (dMult-4.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four4n2n4n2n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               - 2.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n
-               + dImQ6n*dImQ4n*dReQ2n)-2.*(pow(dReQ2n,2.)*dReQ4n
-               + 2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - ((dMult-5.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + (dMult-4.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-(pow(dReQ6n,2.)+pow(dImQ6n,2.)))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               + (dMult-6.)/((dMult-1.)*(dMult-2.)*(dMult-3.));
-  four4n3n4n3n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-               - 2.*(dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ3n*dImQ4n+dImQ7n*dImQ3n*dReQ4n)
-               - 2.*(dReQ1n*dReQ4n*dReQ3n+dImQ1n*dImQ4n*dReQ3n+dReQ1n*dImQ4n*dImQ3n-dImQ1n*dImQ3n*dReQ4n)
-               + pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)
-               - (dMult-4.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four5n1n5n1n = (((pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.)))
-               - 2.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               + pow(dReQ6n,2.)+pow(dImQ6n,2.)-(dMult-4.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-               + pow(dReQ4n,2.)+pow(dImQ4n,2.)-(dMult-4.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))+dMult*(dMult-6.))  
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four5n2n5n2n = ((pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-               - 2.*(dReQ7n*dReQ5n*dReQ2n-dReQ7n*dImQ5n*dImQ2n+dImQ7n*dReQ2n*dImQ5n+dImQ7n*dImQ2n*dReQ5n)
-               - 2.*(dReQ3n*dReQ5n*dReQ2n+dImQ3n*dImQ5n*dReQ2n+dReQ3n*dImQ5n*dImQ2n-dImQ3n*dImQ2n*dReQ5n)
-               + pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)
-               - (dMult-4.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four5n3n5n3n = ((pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-               - 2.*(dReQ8n*dReQ5n*dReQ3n-dReQ8n*dImQ5n*dImQ3n+dImQ8n*dReQ3n*dImQ5n+dImQ8n*dImQ3n*dReQ5n)
-               - 2.*(dReQ2n*dReQ5n*dReQ3n+dImQ2n*dImQ5n*dReQ3n+dReQ2n*dImQ5n*dImQ3n-dImQ2n*dImQ3n*dReQ5n)
-               + pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)
-               - (dMult-4.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four5n4n5n4n = ((pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-               - 2.*(dReQ9n*dReQ5n*dReQ4n-dReQ9n*dImQ5n*dImQ4n+dImQ9n*dReQ4n*dImQ5n+dImQ9n*dImQ4n*dReQ5n)
-               - 2.*(dReQ1n*dReQ5n*dReQ4n+dImQ1n*dImQ5n*dReQ4n+dReQ1n*dImQ5n*dImQ4n-dImQ1n*dImQ4n*dReQ5n)
-               + pow(dReQ9n,2.)+pow(dImQ9n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)
-               - (dMult-4.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four6n1n6n1n = ((pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-               - 2.*(dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ1n*dImQ6n+dImQ7n*dImQ1n*dReQ6n)
-               - 2.*(dReQ5n*dReQ6n*dReQ1n+dImQ5n*dImQ6n*dReQ1n+dReQ5n*dImQ6n*dImQ1n-dImQ5n*dImQ1n*dReQ6n)
-               + pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)
-               - (dMult-4.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four6n2n6n2n = ((pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               - 2.*(dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-               - 2.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               + pow(dReQ8n,2.)+pow(dImQ8n,2.)-(dMult-4.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               + pow(dReQ4n,2.)+pow(dImQ4n,2.)-(dMult-4.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n3n6n3n = ((pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               - 2.*(dReQ9n*dReQ6n*dReQ3n-dReQ9n*dImQ6n*dImQ3n+dImQ9n*dReQ6n*dImQ3n
-               + dImQ9n*dImQ6n*dReQ3n)-2.*(pow(dReQ3n,2.)*dReQ6n
-               + 2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - ((dMult-5.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + (dMult-4.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-(pow(dReQ9n,2.)+pow(dImQ9n,2.)))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               + (dMult-6.)/((dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n4n6n4n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               - 2.*(dReQ10n*dReQ4n*dReQ6n-dReQ10n*dImQ4n*dImQ6n+dImQ10n*dReQ4n*dImQ6n+dImQ10n*dImQ4n*dReQ6n)
-               - 2.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               + pow(dReQ10n,2.)+pow(dImQ10n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)               
-               - (dMult-4.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));  
-  four6n5n6n5n = ((pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-               - 2.*(dReQ11n*dReQ6n*dReQ5n-dReQ11n*dImQ6n*dImQ5n+dImQ11n*dReQ5n*dImQ6n+dImQ11n*dImQ5n*dReQ6n)
-               - 2.*(dReQ1n*dReQ6n*dReQ5n+dImQ1n*dImQ6n*dReQ5n+dReQ1n*dImQ6n*dImQ5n-dImQ1n*dImQ5n*dReQ6n)
-               + pow(dReQ11n,2.)+pow(dImQ11n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)
-               - (dMult-4.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.))
-               + dMult*(dMult-6.))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  // Two distinct harmonics (2):
-  four3n1n1n1n = (dReQ3n*pow(dReQ1n,3)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2)
-               + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2)-dImQ3n*pow(dImQ1n,3)               
-               - 3.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               - 3.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               + 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+3.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + 6.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n2n2n2n = (dReQ6n*pow(dReQ2n,3)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2)
-               + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2)-dImQ6n*pow(dImQ2n,3)               
-               - 3.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - 3.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               + 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))+3.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + 6.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  // Three distinct harmonics (10): 
-  four3n1n2n2n = ((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-               + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n)
-               - (pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               - (dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - (2.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               - (pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               - 4.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - 6./((dMult-1.)*(dMult-2.)*(dMult-3.));
-  four4n2n1n1n = ((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-               + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n)
-               - 2.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - (pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - ((pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               - 3.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - 6./((dMult-1.)*(dMult-2.)*(dMult-3.));
-  four4n2n3n3n = ((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-               + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - (pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-               - 2.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + (pow(dReQ6n,2.)+pow(dImQ6n,2.))+2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + 2.*(2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + (pow(dReQ1n,2.)+pow(dImQ1n,2.))-3.*dMult))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));  
-  four5n2n2n1n = (-pow(dImQ2n,2.)*dImQ1n*dImQ5n+dImQ1n*dImQ5n*pow(dReQ2n,2.)
-               + 2.*dImQ2n*dImQ5n*dReQ2n*dReQ1n-2.*dImQ2n*dImQ1n*dReQ2n*dReQ5n 
-               - pow(dImQ2n,2.)*dReQ1n*dReQ5n+pow(dReQ2n,2.)*dReQ1n*dReQ5n
-               - (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - 2.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+pow(dReQ4n,2.)+pow(dImQ4n,2.)
-               + 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+4.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  four5n3n1n1n = (-pow(dImQ1n,2.)*dImQ3n*dImQ5n+dImQ3n*dImQ5n*pow(dReQ1n,2.)
-               + 2.*dImQ1n*dImQ5n*dReQ1n*dReQ3n-2.*dImQ1n*dImQ3n*dReQ1n*dReQ5n 
-               - pow(dImQ1n,2.)*dReQ3n*dReQ5n+pow(dReQ1n,2.)*dReQ3n*dReQ5n
-               - 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - 2.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               + 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+pow(dReQ2n,2.)+pow(dImQ2n,2.)
-               + 4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult) 
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));  
-  four5n1n3n3n = (dImQ1n*pow(dImQ3n,2.)*dImQ5n+2.*dImQ3n*dImQ5n*dReQ1n*dReQ3n
-               - dImQ1n*dImQ5n*pow(dReQ3n,2.)-pow(dImQ3n,2.)*dReQ1n*dReQ5n 
-               + 2.*dImQ1n*dImQ3n*dReQ3n*dReQ5n+dReQ1n*pow(dReQ3n,2.)*dReQ5n
-               - (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-               - 2.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + pow(dReQ6n,2.)+pow(dImQ6n,2.)+2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-               + 4.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)                                  
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four5n3n4n4n = ((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ5n*dReQ3n-dImQ5n*dImQ3n) 
-               + 2.*dReQ4n*dImQ4n*(dReQ5n*dImQ3n+dImQ5n*dReQ3n)
-               - (dReQ8n*dReQ3n*dReQ5n-dReQ8n*dImQ3n*dImQ5n+dImQ8n*dReQ3n*dImQ5n+dImQ8n*dImQ3n*dReQ5n)
-               - (pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-               - 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - 2.*(dReQ4n*dReQ3n*dReQ1n-dReQ4n*dImQ3n*dImQ1n+dImQ4n*dReQ3n*dImQ1n+dImQ4n*dImQ3n*dReQ1n)
-               + pow(dReQ8n,2.)+pow(dImQ8n,2.)+2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-               + 4.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-               + 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult) 
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n4n1n1n = (-pow(dImQ1n,2.)*dImQ4n*dImQ6n+dImQ4n*dImQ6n*pow(dReQ1n,2.) 
-               + 2.*dImQ1n*dImQ6n*dReQ1n*dReQ4n-2.*dImQ1n*dImQ4n*dReQ1n*dReQ6n 
-               - pow(dImQ1n,2.)*dReQ4n*dReQ6n+pow(dReQ1n,2.)*dReQ4n*dReQ6n
-               - 2.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n) 
-               - 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n) 
-               - (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n) 
-               + 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)
-               + pow(dReQ4n,2.)+pow(dImQ4n,2.))+pow(dReQ2n,2.)+pow(dImQ2n,2.)
-               + 4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n2n4n4n = ((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ6n*dReQ2n-dImQ6n*dImQ2n) 
-               + 2.*dReQ4n*dImQ4n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n)
-               - (pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-               - (dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-               - 2.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - (2.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               - (pow(dReQ8n,2.)+pow(dImQ8n,2.))-2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               - 4.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-4.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)))
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.))
-               - 6./((dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n4n5n5n = ((pow(dReQ5n,2.)-pow(dImQ5n,2.))*(dReQ6n*dReQ4n-dImQ6n*dImQ4n) 
-               + 2.*dReQ5n*dImQ5n*(dReQ6n*dImQ4n+dImQ6n*dReQ4n)
-               - (dReQ10n*dReQ4n*dReQ6n-dReQ10n*dImQ4n*dImQ6n+dImQ10n*dReQ4n*dImQ6n+dImQ10n*dImQ4n*dReQ6n)
-               - (pow(dReQ5n,2.)*dReQ10n+2.*dReQ5n*dImQ5n*dImQ10n-pow(dImQ5n,2.)*dReQ10n)
-               - 2.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               + pow(dReQ10n,2.)+pow(dImQ10n,2.)+2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               + 4.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))              
-               + 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)); 
-  // Four distinct harmonics (8): 
-  four4n1n3n2n = (dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-               + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-               - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-               + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n 
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - (dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - (pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               - (dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               - (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               + pow(dReQ5n,2.)+pow(dImQ5n,2.)+2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+3.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + 3.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult) 
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four5n1n4n2n = (dImQ1n*dImQ2n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ1n*dReQ2n 
-               + dImQ2n*dImQ5n*dReQ1n*dReQ4n-dImQ1n*dImQ5n*dReQ2n*dReQ4n
-               - dImQ2n*dImQ4n*dReQ1n*dReQ5n+dImQ1n*dImQ4n*dReQ2n*dReQ5n+dImQ1n*dImQ2n*dReQ4n*dReQ5n
-               + dReQ1n*dReQ2n*dReQ4n*dReQ5n
-               - (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-               + pow(dReQ6n,2.)+pow(dImQ6n,2.)
-               + 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + pow(dReQ3n,2.)+pow(dImQ3n,2.)+2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-               + 3.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four5n2n4n3n = (dImQ2n*dImQ3n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ2n*dReQ3n 
-               + dImQ3n*dImQ5n*dReQ2n*dReQ4n-dImQ2n*dImQ5n*dReQ3n*dReQ4n
-               - dImQ3n*dImQ4n*dReQ2n*dReQ5n+dImQ2n*dImQ4n*dReQ3n*dReQ5n 
-               + dImQ2n*dImQ3n*dReQ4n*dReQ5n+dReQ2n*dReQ3n*dReQ4n*dReQ5n
-               - (dReQ7n*dReQ5n*dReQ2n-dReQ7n*dImQ5n*dImQ2n+dImQ7n*dReQ5n*dImQ2n+dImQ7n*dImQ5n*dReQ2n)
-               - (dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ4n*dImQ3n+dImQ7n*dImQ4n*dReQ3n)
-               - (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-               - (dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + pow(dReQ7n,2.)+pow(dImQ7n,2.)+2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-               + 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + 3.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))+pow(dReQ1n,2.)+pow(dImQ1n,2.)-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n1n4n3n = (dImQ1n*dImQ3n*dImQ4n*dImQ6n+dImQ4n*dImQ6n*dReQ1n*dReQ3n 
-               + dImQ3n*dImQ6n*dReQ1n*dReQ4n-dImQ1n*dImQ6n*dReQ3n*dReQ4n
-               - dImQ3n*dImQ4n*dReQ1n*dReQ6n+dImQ1n*dImQ4n*dReQ3n*dReQ6n+dImQ1n*dImQ3n*dReQ4n*dReQ6n
-               + dReQ1n*dReQ3n*dReQ4n*dReQ6n
-               - (dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ6n*dImQ1n+dImQ7n*dImQ6n*dReQ1n)
-               - (dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ4n*dImQ3n+dImQ7n*dImQ4n*dReQ3n)
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - (pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-               - (dReQ4n*dReQ1n*dReQ3n-dReQ4n*dImQ1n*dImQ3n+dImQ4n*dReQ1n*dImQ3n+dImQ4n*dImQ1n*dReQ3n)
-               - (dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + pow(dReQ7n,2.)+pow(dImQ7n,2.)+2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               + 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+3.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + pow(dReQ2n,2.)+pow(dImQ2n,2.)+2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n1n5n2n = (dImQ1n*dImQ2n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ1n*dReQ2n 
-               + dImQ2n*dImQ6n*dReQ1n*dReQ5n-dImQ1n*dImQ6n*dReQ2n*dReQ5n
-               - dImQ2n*dImQ5n*dReQ1n*dReQ6n+dImQ1n*dImQ5n*dReQ2n*dReQ6n+dImQ1n*dImQ2n*dReQ5n*dReQ6n
-               + dReQ1n*dReQ2n*dReQ5n*dReQ6n
-               - (dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ6n*dImQ1n+dImQ7n*dImQ6n*dReQ1n)
-               - (dReQ7n*dReQ5n*dReQ2n-dReQ7n*dImQ5n*dImQ2n+dImQ7n*dReQ5n*dImQ2n+dImQ7n*dImQ5n*dReQ2n)
-               - (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-               - (pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n) 
-               + pow(dReQ7n,2.)+pow(dImQ7n,2.)+2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               + 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+pow(dReQ4n,2.)+pow(dImQ4n,2.)
-               + 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))+3.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n3n2n1n = (dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-               - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-               + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-               + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - (pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-               - (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-               - (dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))+pow(dReQ5n,2.)+pow(dImQ5n,2.)
-               + pow(dReQ4n,2.)+pow(dImQ4n,2.)+3.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))+2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n2n5n3n = (dImQ2n*dImQ3n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ2n*dReQ3n 
-               + dImQ3n*dImQ6n*dReQ2n*dReQ5n-dImQ2n*dImQ6n*dReQ3n*dReQ5n
-               - dImQ3n*dImQ5n*dReQ2n*dReQ6n+dImQ2n*dImQ5n*dReQ3n*dReQ6n+dImQ2n*dImQ3n*dReQ5n*dReQ6n
-               + dReQ2n*dReQ3n*dReQ5n*dReQ6n
-               - (dReQ8n*dReQ6n*dReQ2n-dReQ8n*dImQ6n*dImQ2n+dImQ8n*dReQ6n*dImQ2n+dImQ8n*dImQ6n*dReQ2n)
-               - (dReQ8n*dReQ5n*dReQ3n-dReQ8n*dImQ5n*dImQ3n+dImQ8n*dReQ5n*dImQ3n+dImQ8n*dImQ5n*dReQ3n)
-               - (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-               + pow(dReQ8n,2.)+pow(dImQ8n,2.)+2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               + 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+3.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-               + 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))+pow(dReQ1n,2.)+pow(dImQ1n,2.)-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  four6n3n5n4n = (dImQ3n*dImQ4n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ3n*dReQ4n 
-               + dImQ4n*dImQ6n*dReQ3n*dReQ5n-dImQ3n*dImQ6n*dReQ4n*dReQ5n
-               - dImQ4n*dImQ5n*dReQ3n*dReQ6n+dImQ3n*dImQ5n*dReQ4n*dReQ6n+dImQ3n*dImQ4n*dReQ5n*dReQ6n
-               + dReQ3n*dReQ4n*dReQ5n*dReQ6n
-               - (dReQ9n*dReQ6n*dReQ3n-dReQ9n*dImQ6n*dImQ3n+dImQ9n*dReQ6n*dImQ3n+dImQ9n*dImQ6n*dReQ3n)
-               - (dReQ9n*dReQ5n*dReQ4n-dReQ9n*dImQ5n*dImQ4n+dImQ9n*dReQ5n*dImQ4n+dImQ9n*dImQ5n*dReQ4n)
-               - (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-               - (dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-               - (dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-               - (dReQ4n*dReQ3n*dReQ1n-dReQ4n*dImQ3n*dImQ1n+dImQ4n*dReQ3n*dImQ1n+dImQ4n*dImQ3n*dReQ1n)
-               + pow(dReQ9n,2.)+pow(dImQ9n,2.)+2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-               + 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-               + 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+pow(dReQ2n,2.)+pow(dImQ2n,2.)
-               + pow(dReQ1n,2.)+pow(dImQ1n,2.)-6.*dMult)
-               / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.));
-  f4pCorrelations->Fill(0.5,four1n1n1n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(1.5,four2n2n2n2n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(2.5,four3n3n3n3n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(3.5,four4n4n4n4n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(4.5,four5n5n5n5n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(5.5,four6n6n6n6n,d4pMultiplicityWeight);
-  //f4pCorrelations->Fill(6.5,0.,d4pMultiplicityWeight); // empty
-  f4pCorrelations->Fill(7.5,four2n1n2n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(8.5,four3n1n3n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(9.5,four3n2n3n2n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(10.5,four4n1n4n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(11.5,four4n2n4n2n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(12.5,four4n3n4n3n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(13.5,four5n1n5n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(14.5,four5n2n5n2n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(15.5,four5n3n5n3n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(16.5,four5n4n5n4n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(17.5,four6n1n6n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(18.5,four6n2n6n2n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(19.5,four6n3n6n3n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(20.5,four6n4n6n4n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(21.5,four6n5n6n5n,d4pMultiplicityWeight);
-  //f4pCorrelations->Fill(22.5,0.,d4pMultiplicityWeight); // empty
-  f4pCorrelations->Fill(23.5,four3n1n1n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(24.5,four6n2n2n2n,d4pMultiplicityWeight);
-  //f4pCorrelations->Fill(25.5,0.,d4pMultiplicityWeight); // empty
-  f4pCorrelations->Fill(26.5,four3n1n2n2n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(27.5,four4n2n1n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(28.5,four4n2n3n3n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(29.5,four5n2n2n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(30.5,four5n3n1n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(31.5,four5n1n3n3n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(32.5,four5n3n4n4n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(33.5,four6n4n1n1n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(34.5,four6n2n4n4n,d4pMultiplicityWeight);
-  f4pCorrelations->Fill(35.5,four6n4n5n5n,d4pMultiplicityWeight);
-  //f4pCorrelations->Fill(36.5,0.,d4pMultiplicityWeight); // empty
-  f4pCorrelations->Fill(37.5,four4n1n3n2n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(38.5,four5n1n4n2n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(39.5,four5n2n4n3n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(40.5,four6n1n4n3n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(41.5,four6n1n5n2n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(42.5,four6n3n2n1n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(43.5,four6n2n5n3n,d4pMultiplicityWeight); 
-  f4pCorrelations->Fill(44.5,four6n3n5n4n,d4pMultiplicityWeight); 
-  allMixedCorrelators[15]=four1n1n1n1n;
-  allMixedCorrelators[16]=four2n2n2n2n;
-  allMixedCorrelators[17]=four3n3n3n3n;
-  allMixedCorrelators[18]=four4n4n4n4n;
-  allMixedCorrelators[19]=four5n5n5n5n;
-  allMixedCorrelators[20]=four6n6n6n6n;
-  allMixedCorrelators[21]=four2n1n2n1n;
-  allMixedCorrelators[22]=four3n1n3n1n;
-  allMixedCorrelators[23]=four3n2n3n2n;
-  allMixedCorrelators[24]=four4n1n4n1n;
-  allMixedCorrelators[25]=four4n2n4n2n;
-  allMixedCorrelators[26]=four4n3n4n3n;
-  allMixedCorrelators[27]=four5n1n5n1n;
-  allMixedCorrelators[28]=four5n2n5n2n;
-  allMixedCorrelators[29]=four5n3n5n3n;
-  allMixedCorrelators[30]=four5n4n5n4n;
-  allMixedCorrelators[31]=four6n1n6n1n;
-  allMixedCorrelators[32]=four6n2n6n2n;
-  allMixedCorrelators[33]=four6n3n6n3n;
-  allMixedCorrelators[34]=four6n4n6n4n;
-  allMixedCorrelators[35]=four6n5n6n5n;
-  allMixedCorrelators[36]=four3n1n1n1n;
-  allMixedCorrelators[37]=four6n2n2n2n;
-  allMixedCorrelators[38]=four3n1n2n2n;
-  allMixedCorrelators[39]=four4n2n1n1n;
-  allMixedCorrelators[40]=four4n2n3n3n;
-  allMixedCorrelators[41]=four5n2n2n1n;
-  allMixedCorrelators[42]=four5n3n1n1n;
-  allMixedCorrelators[43]=four5n1n3n3n;
-  allMixedCorrelators[44]=four5n3n4n4n;
-  allMixedCorrelators[45]=four6n4n1n1n;
-  allMixedCorrelators[46]=four6n2n4n4n;
-  allMixedCorrelators[47]=four6n4n5n5n;
-  allMixedCorrelators[48]=four4n1n3n2n;
-  allMixedCorrelators[49]=four5n1n4n2n;
-  allMixedCorrelators[50]=four5n2n4n3n;
-  allMixedCorrelators[51]=four6n1n4n3n;
-  allMixedCorrelators[52]=four6n1n5n2n;
-  allMixedCorrelators[53]=four6n3n2n1n;
-  allMixedCorrelators[54]=four6n2n5n3n;
-  allMixedCorrelators[55]=four6n3n5n4n;
- } // end of if(dMult>3.)
-
- // f) Calculate 5-p correlations:
- //  f1) "Standard candles" (30):
- Double_t five3n2n3n1n1n = 0.; // <5>_{3n,2n|3n,1n,1n} = <cos(n(3*phi1+2*phi2-3*phi3-1*phi4-1*phi5))>
- Double_t five4n1n2n2n1n = 0.; // <5>_{4n,1n|2n,2n,1n} = <cos(n(4*phi1+1*phi2-2*phi3-2*phi4-1*phi5))>
- Double_t five4n2n3n2n1n = 0.; // <5>_{4n,2n|3n,2n,1n} = <cos(n(4*phi1+2*phi2-3*phi3-2*phi4-1*phi5))>
- Double_t five4n3n3n2n2n = 0.; // <5>_{4n,3n|3n,2n,2n} = <cos(n(4*phi1+3*phi2-3*phi3-2*phi4-2*phi5))>
- Double_t five4n2n4n1n1n = 0.; // <5>_{4n,2n|4n,1n,1n} = <cos(n(4*phi1+2*phi2-4*phi3-1*phi4-1*phi5))>
- Double_t five4n3n4n2n1n = 0.; // <5>_{4n,3n|4n,2n,1n} = <cos(n(4*phi1+3*phi2-4*phi3-2*phi4-1*phi5))>
- Double_t five5n1n3n2n1n = 0.; // <5>_{5n,1n|3n,2n,1n} = <cos(n(5*phi1+1*phi2-3*phi3-2*phi4-1*phi5))>
- Double_t five5n2n5n1n1n = 0.; // <5>_{5n,2n|5n,1n,1n} = <cos(n(5*phi1+2*phi2-5*phi3-1*phi4-1*phi5))>
- Double_t five5n2n4n2n1n = 0.; // <5>_{5n,2n|4n,2n,1n} = <cos(n(5*phi1+2*phi2-4*phi3-2*phi4-1*phi5))>
- Double_t five5n3n4n3n1n = 0.; // <5>_{5n,3n|4n,3n,1n} = <cos(n(5*phi1+3*phi2-4*phi3-3*phi4-1*phi5))>
- Double_t five5n4n4n3n2n = 0.; // <5>_{5n,4n|4n,3n,2n} = <cos(n(5*phi1+4*phi2-4*phi3-3*phi4-2*phi5))>
- Double_t five5n3n5n2n1n = 0.; // <5>_{5n,3n|5n,2n,1n} = <cos(n(5*phi1+3*phi2-5*phi3-2*phi4-1*phi5))>
- Double_t five5n4n5n2n2n = 0.; // <5>_{5n,4n|5n,2n,2n} = <cos(n(5*phi1+4*phi2-5*phi3-2*phi4-2*phi5))>
- Double_t five5n4n5n3n1n = 0.; // <5>_{5n,4n|5n,3n,1n} = <cos(n(5*phi1+4*phi2-5*phi3-3*phi4-1*phi5))>
- Double_t five6n1n3n3n1n = 0.; // <5>_{6n,1n|3n,3n,1n} = <cos(n(6*phi1+1*phi2-3*phi3-3*phi4-1*phi5))>
- Double_t five6n2n3n3n2n = 0.; // <5>_{6n,2n|3n,3n,2n} = <cos(n(6*phi1+2*phi2-3*phi3-3*phi4-2*phi5))>
- Double_t five6n1n4n2n1n = 0.; // <5>_{6n,1n|4n,2n,1n} = <cos(n(6*phi1+1*phi2-4*phi3-2*phi4-1*phi5))>
- Double_t five6n3n4n3n2n = 0.; // <5>_{6n,3n|4n,3n,2n} = <cos(n(6*phi1+3*phi2-4*phi3-3*phi4-2*phi5))>
- Double_t five6n4n4n3n3n = 0.; // <5>_{6n,4n|4n,3n,3n} = <cos(n(6*phi1+4*phi2-4*phi3-3*phi4-3*phi5))>
- Double_t five6n2n5n2n1n = 0.; // <5>_{6n,2n|5n,2n,1n} = <cos(n(6*phi1+2*phi2-5*phi3-2*phi4-1*phi5))>
- Double_t five6n3n5n3n1n = 0.; // <5>_{6n,3n|5n,3n,1n} = <cos(n(6*phi1+3*phi2-5*phi3-3*phi4-1*phi5))>
- Double_t five6n4n5n4n1n = 0.; // <5>_{6n,4n|5n,4n,1n} = <cos(n(6*phi1+4*phi2-5*phi3-4*phi4-1*phi5))>
- Double_t five6n5n5n3n3n = 0.; // <5>_{6n,5n|5n,3n,3n} = <cos(n(6*phi1+5*phi2-5*phi3-3*phi4-3*phi5))>
- Double_t five6n2n6n1n1n = 0.; // <5>_{6n,2n|6n,1n,1n} = <cos(n(6*phi1+2*phi2-6*phi3-1*phi4-1*phi5))>
- Double_t five6n3n6n2n1n = 0.; // <5>_{6n,3n|6n,2n,1n} = <cos(n(6*phi1+3*phi2-6*phi3-2*phi4-1*phi5))>
- Double_t five6n4n6n2n2n = 0.; // <5>_{6n,4n|6n,2n,2n} = <cos(n(6*phi1+4*phi2-6*phi3-2*phi4-2*phi5))>
- Double_t five6n4n6n3n1n = 0.; // <5>_{6n,4n|6n,3n,1n} = <cos(n(6*phi1+4*phi2-6*phi3-3*phi4-1*phi5))>
- Double_t five6n5n5n4n2n = 0.; // <5>_{6n,5n|5n,4n,2n} = <cos(n(6*phi1+5*phi2-5*phi3-4*phi4-2*phi5))>
- Double_t five6n5n6n3n2n = 0.; // <5>_{6n,5n|6n,3n,2n} = <cos(n(6*phi1+5*phi2-6*phi3-3*phi4-2*phi5))> // TBI swap with previous
- Double_t five6n5n6n4n1n = 0.; // <5>_{6n,5n|6n,4n,1n} = <cos(n(6*phi1+5*phi2-6*phi3-4*phi4-1*phi5))>
- //  f2) Two distinct harmonics (9):
- Double_t five2n1n1n1n1n = 0.; // <5>_{2n,1n|1n,1n,1n} = <cos(n(2*phi1+1*phi2-1*phi3-1*phi4-1*phi5))>
- Double_t five2n2n2n1n1n = 0.; // <5>_{2n,2n|2n,1n,1n} = <cos(n(2*phi1+2*phi2-2*phi3-1*phi4-1*phi5))>
- Double_t five3n3n2n2n2n = 0.; // <5>_{3n,3n|2n,2n,2n} = <cos(n(3*phi1+3*phi2-2*phi3-2*phi4-2*phi5))>
- Double_t five4n1n1n1n1n = 0.; // <5>_{4n|1n,1n,1n,1n} = <cos(n(4*phi1-1*phi2-1*phi3-1*phi4-1*phi5))>
- Double_t five4n2n2n2n2n = 0.; // <5>_{4n,2n|2n,2n,2n} = <cos(n(4*phi1+2*phi2-2*phi3-2*phi4-2*phi5))>
- Double_t five4n4n4n2n2n = 0.; // <5>_{4n,4n|4n,2n,2n} = <cos(n(4*phi1+4*phi2-4*phi3-2*phi4-2*phi5))>
- Double_t five6n3n3n3n3n = 0.; // <5>_{6n,3n|3n,3n,3n} = <cos(n(6*phi1+3*phi2-3*phi3-3*phi4-3*phi5))>
- Double_t five6n6n4n4n4n = 0.; // <5>_{6n,6n|4n,4n,4n} = <cos(n(6*phi1+6*phi2-4*phi3-4*phi4-4*phi5))>
- Double_t five6n6n6n3n3n = 0.; // <5>_{6n,6n|6n,3n,3n} = <cos(n(6*phi1+6*phi2-6*phi3-3*phi4-3*phi5))>
- //  f3) Three distinct harmonics (30):
- Double_t five3n1n2n1n1n = 0.; // <5>_{3n,1n|2n,1n,1n} = <cos(n(3*phi1+1*phi2-2*phi3-1*phi4-1*phi5))>
- Double_t five3n2n2n2n1n = 0.; // <5>_{3n,2n|2n,2n,1n} = <cos(n(3*phi1+2*phi2-2*phi3-2*phi4-1*phi5))>
- Double_t five3n3n3n2n1n = 0.; // <5>_{3n,3n|3n,2n,1n} = <cos(n(3*phi1+3*phi2-3*phi3-2*phi4-1*phi5))>
- Double_t five4n1n3n1n1n = 0.; // <5>_{4n,1n|3n,1n,1n} = <cos(n(4*phi1+1*phi2-3*phi3-1*phi4-1*phi5))>
- Double_t five4n1n1n3n3n = 0.; // <5>_{4n,1n,1n|3n,3n} = <cos(n(4*phi1+1*phi2+1*phi3-3*phi4-3*phi5))>
- Double_t five4n3n3n3n1n = 0.; // <5>_{4n,3n|3n,3n,1n} = <cos(n(4*phi1+3*phi2-3*phi3-3*phi4-1*phi5))>
- Double_t five4n4n3n3n2n = 0.; // <5>_{4n,4n|3n,3n,2n} = <cos(n(4*phi1+4*phi2-3*phi3-3*phi4-2*phi5))>
- Double_t five4n4n4n3n1n = 0.; // <5>_{4n,4n|4n,3n,1n} = <cos(n(4*phi1+4*phi2-4*phi3-3*phi4-1*phi5))>
- Double_t five5n2n1n1n1n = 0.; // <5>_{5n|2n,1n,1n,1n} = <cos(n(5*phi1-2*phi2-1*phi3-1*phi4-1*phi5))>
- Double_t five5n1n2n2n2n = 0.; // <5>_{5n,1n|2n,2n,2n} = <cos(n(5*phi1+1*phi2-2*phi3-2*phi4-2*phi5))>
- Double_t five5n2n3n2n2n = 0.; // <5>_{5n,2n|3n,2n,2n} = <cos(n(5*phi1+2*phi2-3*phi3-2*phi4-2*phi5))>
- Double_t five5n3n3n3n2n = 0.; // <5>_{5n,3n|3n,3n,2n} = <cos(n(5*phi1+3*phi2-3*phi3-3*phi4-2*phi5))>
- Double_t five5n1n4n1n1n = 0.; // <5>_{5n,1n|4n,1n,1n} = <cos(n(5*phi1+1*phi2-4*phi3-1*phi4-1*phi5))>
- Double_t five5n4n3n3n3n = 0.; // <5>_{5n,4n|3n,3n,3n} = <cos(n(5*phi1+4*phi2-3*phi3-3*phi4-3*phi5))>
- Double_t five5n4n4n4n1n = 0.; // <5>_{5n,4n|4n,4n,1n} = <cos(n(5*phi1+4*phi2-4*phi3-4*phi4-1*phi5))>
- Double_t five5n5n4n3n3n = 0.; // <5>_{5n,5n|4n,3n,3n} = <cos(n(5*phi1+5*phi2-4*phi3-3*phi4-3*phi5))>
- Double_t five5n5n4n4n2n = 0.; // <5>_{5n,5n|4n,4n,2n} = <cos(n(5*phi1+5*phi2-4*phi3-4*phi4-2*phi5))>
- Double_t five5n5n5n3n2n = 0.; // <5>_{5n,5n|5n,3n,2n} = <cos(n(5*phi1+5*phi2-5*phi3-3*phi4-2*phi5))>
- Double_t five5n5n5n4n1n = 0.; // <5>_{5n,5n|5n,4n,1n} = <cos(n(5*phi1+5*phi2-5*phi3-4*phi4-1*phi5))>
- Double_t five6n2n2n1n1n = 0.; // <5>_{6n|2n,2n,1n,1n} = <cos(n(6*phi1-2*phi2-2*phi3-1*phi4-1*phi5))>
- Double_t five6n3n1n1n1n = 0.; // <5>_{6n|3n,1n,1n,1n} = <cos(n(6*phi1-3*phi2-1*phi3-1*phi4-1*phi5))>
- Double_t five6n1n1n4n4n = 0.; // <5>_{6n,1n,1n|4n,4n} = <cos(n(6*phi1+1*phi2+1*phi3-4*phi4-4*phi5))>
- Double_t five6n1n5n1n1n = 0.; // <5>_{6n,1n|5n,1n,1n} = <cos(n(6*phi1+1*phi2-5*phi3-1*phi4-1*phi5))>
- Double_t five6n2n4n2n2n = 0.; // <5>_{6n,2n|4n,2n,2n} = <cos(n(6*phi1+2*phi2-4*phi3-2*phi4-2*phi5))>
- Double_t five6n4n4n4n2n = 0.; // <5>_{6n,4n|4n,4n,2n} = <cos(n(6*phi1+4*phi2-4*phi3-4*phi4-2*phi5))>
- Double_t five6n2n2n5n5n = 0.; // <5>_{6n,2n,2n|5n,5n} = <cos(n(6*phi1+2*phi2+2*phi3-5*phi4-5*phi5))>
- Double_t five6n5n5n5n1n = 0.; // <5>_{6n,5n|5n,5n,1n} = <cos(n(6*phi1+5*phi2-5*phi3-5*phi4-1*phi5))>
- Double_t five6n6n5n5n2n = 0.; // <5>_{6n,6n|5n,5n,2n} = <cos(n(6*phi1+6*phi2-5*phi3-5*phi4-2*phi5))>
- Double_t five6n6n6n4n2n = 0.; // <5>_{6n,6n|6n,4n,2n} = <cos(n(6*phi1+6*phi2-6*phi3-4*phi4-2*phi5))>
- Double_t five6n6n6n5n1n = 0.; // <5>_{6n,6n|6n,5n,1n} = <cos(n(6*phi1+6*phi2-6*phi3-5*phi4-1*phi5))> // TBI swap with the one above
- // Four distinct harmonics (11):
- Double_t five5n2n3n3n1n = 0.; // <5>_{5n,2n|3n,3n,1n} = <cos(n(5*phi1+2*phi2-3*phi3-3*phi4-1*phi5))>
- Double_t five5n1n1n4n3n = 0.; // <5>_{5n,1n,1n|4n,3n} = <cos(n(5*phi1+1*phi2+1*phi3-4*phi4-3*phi5))>
- Double_t five5n3n4n2n2n = 0.; // <5>_{5n,3n|4n,2n,2n} = <cos(n(5*phi1+3*phi2-4*phi3-2*phi4-2*phi5))>
- Double_t five5n2n1n4n4n = 0.; // <5>_{5n,2n,1n|4n,4n} = <cos(n(5*phi1+2*phi2+1*phi3-4*phi4-4*phi5))>
- Double_t five6n1n3n2n2n = 0.; // <5>_{6n,1n|3n,2n,2n} = <cos(n(6*phi1+1*phi2-3*phi3-2*phi4-2*phi5))>
- Double_t five6n3n4n4n1n = 0.; // <5>_{6n,3n|4n,4n,1n} = <cos(n(6*phi1+3*phi2-4*phi3-4*phi4-1*phi5))>
- Double_t five6n1n1n5n3n = 0.; // <5>_{6n,1n,1n|5n,3n} = <cos(n(6*phi1+1*phi2+1*phi3-5*phi4-3*phi5))>
- Double_t five6n3n5n2n2n = 0.; // <5>_{6n,3n|5n,2n,2n} = <cos(n(6*phi1+3*phi2-5*phi3-2*phi4-2*phi5))>
- Double_t five6n5n4n4n3n = 0.; // <5>_{6n,5n|4n,4n,3n} = <cos(n(6*phi1+5*phi2-4*phi3-4*phi4-3*phi5))>
- Double_t five6n3n1n5n5n = 0.; // <5>_{6n,3n,1n|5n,5n} = <cos(n(6*phi1+3*phi2+1*phi3-5*phi4-5*phi5))>
- Double_t five6n6n5n4n3n = 0.; // <5>_{6n,6n|5n,4n,3n} = <cos(n(6*phi1+6*phi2-5*phi3-4*phi4-3*phi5))>
- // Five distinct harmonics (3):
- Double_t five6n2n4n3n1n = 0.; // <5>_{6n,2n|4n,3n,1n} = <cos(n(6*phi1+2*phi2-4*phi3-3*phi4-1*phi5))>
- Double_t five6n2n1n5n4n = 0.; // <5>_{6n,2n,1n|5n,4n} = <cos(n(6*phi1+2*phi2+1*phi3-5*phi4-4*phi5))>
- Double_t five6n4n5n3n2n = 0.; // <5>_{6n,4n|5n,3n,2n} = <cos(n(6*phi1+4*phi2-5*phi3-3*phi4-2*phi5))>
- if(dMult>4.)
- {
-  five3n2n3n1n1n = (-(pow(dImQ3n,2.)+pow(dReQ3n,2.))
-                 * (-2.*dImQ1n*dImQ2n*dReQ1n+pow(dImQ1n,2.)*dReQ2n-pow(dReQ1n,2.)*dReQ2n)
-                 - (-pow(dImQ1n,2.)*dImQ3n*dImQ5n+dImQ3n*dImQ5n*pow(dReQ1n,2.)
-                 + 2.*dImQ1n*dImQ5n*dReQ1n*dReQ3n-2.*dImQ1n*dImQ3n*dReQ1n*dReQ5n 
-                 - pow(dImQ1n,2.)*dReQ3n*dReQ5n+pow(dReQ1n,2.)*dReQ3n*dReQ5n)
-                 - 2.*(dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)
-                 - (dReQ3n*pow(dReQ1n,3.)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2.)
-                 + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2.)-dImQ3n*pow(dImQ1n,3.))
-                 - 2.*((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 + 3.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + 6.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 2.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 + 9.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 - (dMult-8.)*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-4.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+(dMult-12.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-9.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*dMult*(dMult-12.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n1n2n2n1n = ((pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 * (pow(dReQ2n,2.)*dReQ4n-pow(dImQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n)
-                 - 2.*(dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)    
-                 - 2.*((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2.)-pow(dImQ1n,2.)) 
-                 + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n))
-                 - (-pow(dImQ2n,2.)*dImQ1n*dImQ5n+dImQ1n*dImQ5n*pow(dReQ2n,2.)
-                 + 2.*dImQ2n*dImQ5n*dReQ2n*dReQ1n-2.*dImQ2n*dImQ1n*dReQ2n*dReQ5n 
-                 - pow(dImQ2n,2.)*dReQ1n*dReQ5n+pow(dReQ2n,2.)*dReQ1n*dReQ5n)
-                 - ((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 + 2.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + 2.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 2.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 + 3.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 4.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 + 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 + 6.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 - (dMult-6.)*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 4.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+(dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-2.*dMult*(dMult-12.))
-                  / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n2n3n2n1n = ((pow(dImQ2n,2.)+pow(dReQ2n,2.))*(dImQ3n*dImQ4n*dReQ1n+dImQ1n*dImQ4n*dReQ3n 
-                 - dImQ1n*dImQ3n*dReQ4n+dReQ1n*dReQ3n*dReQ4n)
-                 - (dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                 - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                 + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                 + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n)
-                 - (dImQ1n*dImQ2n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ5n*dReQ1n*dReQ4n-dImQ1n*dImQ5n*dReQ2n*dReQ4n
-                 - dImQ2n*dImQ4n*dReQ1n*dReQ5n+dImQ1n*dImQ4n*dReQ2n*dReQ5n 
-                 + dImQ1n*dImQ2n*dReQ4n*dReQ5n+dReQ1n*dReQ2n*dReQ4n*dReQ5n)
-                 - ((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-                 + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n)
-                 - (dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)
-                 - ((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2.)-pow(dImQ1n,2.)) 
-                 + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n))
-                 - ((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 3.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 + (dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-                 + pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n
-                 + dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n
-                 + 3.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 - (dMult-7.)*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 3.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 + 7.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 4.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+(dMult-10.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + 2.*(dMult-7.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))+(dMult-12.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*dMult*(dMult-12.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)); 
-
-  // *********************************************************************
-  Double_t reQ7nQ3nstarQ2nstarQ2nstar = (dReQ7n*dReQ3n+dImQ7n*dImQ3n)*(pow(dReQ2n,2)-pow(dImQ2n,2)) 
-                                      + 2.*dReQ2n*dImQ2n*(dImQ7n*dReQ3n-dReQ7n*dImQ3n); 
-  Double_t reQ5nQ2nQ4nstarQ3nstar = dImQ2n*dImQ3n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ2n*dReQ3n 
-                                  + dImQ3n*dImQ5n*dReQ2n*dReQ4n-dImQ2n*dImQ5n*dReQ3n*dReQ4n
-                                  - dImQ3n*dImQ4n*dReQ2n*dReQ5n+dImQ2n*dImQ4n*dReQ3n*dReQ5n 
-                                  + dImQ2n*dImQ3n*dReQ4n*dReQ5n+dReQ2n*dReQ3n*dReQ4n*dReQ5n;
-  Double_t reQ7nQ4nstarQ3nstar = dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ4n*dImQ3n
-                               + dImQ7n*dImQ4n*dReQ3n; 
-
-
-  Double_t reQ7nQ5nstarQ2nstar = dReQ7n*dReQ5n*dReQ2n-dReQ7n*dImQ5n*dImQ2n+dImQ7n*dReQ5n*dImQ2n
-                               + dImQ7n*dImQ5n*dReQ2n;
-
-  // <5>_{6n,4n|4n,3n,3n}:
-  Double_t reQ10nQ4nstarQ3nstarQ3nstar = (dReQ10n*dReQ4n+dImQ10n*dImQ4n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                                      + 2.*dReQ3n*dImQ3n*(dImQ10n*dReQ4n-dReQ10n*dImQ4n); 
-  Double_t reQ7nQ3nQ6nstarQ4nstar = dImQ3n*dImQ4n*dImQ6n*dImQ7n+dImQ6n*dImQ7n*dReQ3n*dReQ4n 
-                                  + dImQ4n*dImQ7n*dReQ3n*dReQ6n-dImQ3n*dImQ7n*dReQ4n*dReQ6n
-                                  - dImQ4n*dImQ6n*dReQ3n*dReQ7n+dImQ3n*dImQ6n*dReQ4n*dReQ7n 
-                                  + dImQ3n*dImQ4n*dReQ6n*dReQ7n+dReQ3n*dReQ4n*dReQ6n*dReQ7n;
-  Double_t reQ10nQ7nstarQ3nstar = dReQ10n*dReQ7n*dReQ3n-dReQ10n*dImQ7n*dImQ3n+dImQ10n*dReQ7n*dImQ3n
-                                + dImQ10n*dImQ7n*dReQ3n; 
-  Double_t reQ10nQ6nstarQ4nstar = dReQ10n*dReQ6n*dReQ4n-dReQ10n*dImQ6n*dImQ4n+dImQ10n*dReQ6n*dImQ4n
-                                + dImQ10n*dImQ6n*dReQ4n; 
-  Double_t reQ6nQ1nQ4nstarQ3nstar = dImQ1n*dImQ3n*dImQ4n*dImQ6n+dImQ4n*dImQ6n*dReQ1n*dReQ3n 
-                                  + dImQ3n*dImQ6n*dReQ1n*dReQ4n-dImQ1n*dImQ6n*dReQ3n*dReQ4n
-                                  - dImQ3n*dImQ4n*dReQ1n*dReQ6n+dImQ1n*dImQ4n*dReQ3n*dReQ6n 
-                                  + dImQ1n*dImQ3n*dReQ4n*dReQ6n+dReQ1n*dReQ3n*dReQ4n*dReQ6n;
-  Double_t reQ7nQ6nstarQ1nstar = dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ6n*dImQ1n
-                               + dImQ7n*dImQ6n*dReQ1n;
- // <5>_{6n,5n|5n,3n,3n}:
- /*Double_t reQ11nQ5nstarQ3nstarQ3nstar = (dReQ11n*dReQ5n+dImQ11n*dImQ5n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                                      + 2.*dReQ3n*dImQ3n*(dImQ11n*dReQ5n-dReQ11n*dImQ5n); */
- Double_t reQ6nQ2nQ5nstarQ3nstar = dImQ2n*dImQ3n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ2n*dReQ3n 
-                                 + dImQ3n*dImQ6n*dReQ2n*dReQ5n-dImQ2n*dImQ6n*dReQ3n*dReQ5n
-                                 - dImQ3n*dImQ5n*dReQ2n*dReQ6n+dImQ2n*dImQ5n*dReQ3n*dReQ6n 
-                                 + dImQ2n*dImQ3n*dReQ5n*dReQ6n+dReQ2n*dReQ3n*dReQ5n*dReQ6n;
- Double_t reQ8nQ3nQ6nstarQ5nstar = dImQ3n*dImQ5n*dImQ6n*dImQ8n+dImQ6n*dImQ8n*dReQ3n*dReQ5n 
-                                 + dImQ5n*dImQ8n*dReQ3n*dReQ6n-dImQ3n*dImQ8n*dReQ5n*dReQ6n
-                                 - dImQ5n*dImQ6n*dReQ3n*dReQ8n+dImQ3n*dImQ6n*dReQ5n*dReQ8n 
-                                 + dImQ3n*dImQ5n*dReQ6n*dReQ8n+dReQ3n*dReQ5n*dReQ6n*dReQ8n;
- Double_t reQ11nQ6nstarQ5nstar = dReQ11n*dReQ6n*dReQ5n-dReQ11n*dImQ6n*dImQ5n+dImQ11n*dReQ6n*dImQ5n
-                               + dImQ11n*dImQ6n*dReQ5n;
- Double_t reQ8nQ6nstarQ2nstar = dReQ8n*dReQ6n*dReQ2n-dReQ8n*dImQ6n*dImQ2n+dImQ8n*dReQ6n*dImQ2n
-                              + dImQ8n*dImQ6n*dReQ2n; 
- Double_t reQ11nQ8nstarQ3nstar = dReQ11n*dReQ8n*dReQ3n-dReQ11n*dImQ8n*dImQ3n+dImQ11n*dReQ8n*dImQ3n
-                               + dImQ11n*dImQ8n*dReQ3n;
- Double_t reQ8nQ5nstarQ3nstar = dReQ8n*dReQ5n*dReQ3n-dReQ8n*dImQ5n*dImQ3n+dImQ8n*dReQ5n*dImQ3n
-                              + dImQ8n*dImQ5n*dReQ3n; 
- // <5>_{5n,2n|5n,1n,1n}
- Double_t reQ7nQ5nstarQ1nstarQ1nstar = (dReQ7n*dReQ5n+dImQ7n*dImQ5n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-                                      + 2.*dReQ1n*dImQ1n*(dImQ7n*dReQ5n-dReQ7n*dImQ5n); 
- Double_t reQ6nQ1nQ5nstarQ2nstar = dImQ1n*dImQ2n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ1n*dReQ2n 
-                                 + dImQ2n*dImQ6n*dReQ1n*dReQ5n-dImQ1n*dImQ6n*dReQ2n*dReQ5n
-                                 - dImQ2n*dImQ5n*dReQ1n*dReQ6n+dImQ1n*dImQ5n*dReQ2n*dReQ6n 
-                                 + dImQ1n*dImQ2n*dReQ5n*dReQ6n+dReQ1n*dReQ2n*dReQ5n*dReQ6n;
- // <5>_{5n,4n|5n,2n,2n}
- Double_t reQ9nQ5nstarQ2nstarQ2nstar = (dReQ9n*dReQ5n+dImQ9n*dImQ5n)*(pow(dReQ2n,2)-pow(dImQ2n,2)) 
-                                     + 2.*dReQ2n*dImQ2n*(dImQ9n*dReQ5n-dReQ9n*dImQ5n);
- Double_t reQ7nQ2nQ5nstarQ4nstar = dImQ2n*dImQ4n*dImQ5n*dImQ7n+dImQ5n*dImQ7n*dReQ2n*dReQ4n 
-                                 + dImQ4n*dImQ7n*dReQ2n*dReQ5n-dImQ2n*dImQ7n*dReQ4n*dReQ5n
-                                 - dImQ4n*dImQ5n*dReQ2n*dReQ7n+dImQ2n*dImQ5n*dReQ4n*dReQ7n 
-                                 + dImQ2n*dImQ4n*dReQ5n*dReQ7n+dReQ2n*dReQ4n*dReQ5n*dReQ7n;
- Double_t reQ9nQ5nstarQ4nstar = dReQ9n*dReQ5n*dReQ4n-dReQ9n*dImQ5n*dImQ4n+dImQ9n*dReQ5n*dImQ4n
-                              + dImQ9n*dImQ5n*dReQ4n; 
- Double_t reQ9nQ7nstarQ2nstar = dReQ9n*dReQ7n*dReQ2n-dReQ9n*dImQ7n*dImQ2n+dImQ9n*dReQ7n*dImQ2n
-                              + dImQ9n*dImQ7n*dReQ2n; 
- // <5>_{6n,2n|6n,1n,1n}
- Double_t reQ8nQ6nstarQ1nstarQ1nstar = (dReQ8n*dReQ6n+dImQ8n*dImQ6n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-                                     + 2.*dReQ1n*dImQ1n*(dImQ8n*dReQ6n-dReQ8n*dImQ6n);
- Double_t reQ7nQ1nQ6nstarQ2nstar = dImQ1n*dImQ2n*dImQ6n*dImQ7n+dImQ6n*dImQ7n*dReQ1n*dReQ2n 
-                                 + dImQ2n*dImQ7n*dReQ1n*dReQ6n-dImQ1n*dImQ7n*dReQ2n*dReQ6n
-                                 - dImQ2n*dImQ6n*dReQ1n*dReQ7n+dImQ1n*dImQ6n*dReQ2n*dReQ7n 
-                                 + dImQ1n*dImQ2n*dReQ6n*dReQ7n+dReQ1n*dReQ2n*dReQ6n*dReQ7n;
- Double_t reQ8nQ7nstarQ1nstar = dReQ8n*dReQ7n*dReQ1n-dReQ8n*dImQ7n*dImQ1n+dImQ8n*dReQ7n*dImQ1n
-                              + dImQ8n*dImQ7n*dReQ1n;
- // <5>_{5n,2n|4n,2n,1n}
- Double_t reQ5nQ2nQ4nstarQ2nstarQ1nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                                        * (dReQ1n*dReQ4n*dReQ5n-dReQ5n*dImQ1n*dImQ4n 
-                                        + dReQ4n*dImQ1n*dImQ5n+dReQ1n*dImQ4n*dImQ5n);
- Double_t reQ7nQ4nstarQ2nstarQ1nstar = dReQ1n*dReQ2n*dReQ4n*dReQ7n-dReQ4n*dReQ7n*dImQ1n*dImQ2n 
-                                     - dReQ2n*dReQ7n*dImQ1n*dImQ4n-dReQ1n*dReQ7n*dImQ2n*dImQ4n 
-                                     + dReQ2n*dReQ4n*dImQ1n*dImQ7n+dReQ1n*dReQ4n*dImQ2n*dImQ7n 
-                                     + dReQ1n*dReQ2n*dImQ4n*dImQ7n-dImQ1n*dImQ2n*dImQ4n*dImQ7n;
- // <5>_{4n,3n|4n,2n,1n}:
- Double_t reQ4nQ3nQ4nstarQ2nstarQ1nstar = (dReQ1n*dReQ2n*dReQ3n-dReQ3n*dImQ1n*dImQ2n 
-	                                + dReQ2n*dImQ1n*dImQ3n+dReQ1n*dImQ2n*dImQ3n) 
-					* (pow(dReQ4n,2.)+pow(dImQ4n,2.));	  
- /*
- Double_t reQ4nQ1nQ3nstarQ2nstar = dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n;
- */
- // <5>_{5n,3n|4n,3n,1n}:
- Double_t reQ5nQ3nQ4nstarQ3nstarQ1nstar = (pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                                        * (dReQ1n*dReQ4n*dReQ5n-dReQ5n*dImQ1n*dImQ4n 
-                                        + dReQ4n*dImQ1n*dImQ5n+dReQ1n*dImQ4n*dImQ5n);
- Double_t reQ5nQ3nQ4nstarQ4nstar = dReQ3n*pow(dReQ4n,2.)*dReQ5n+2.*dReQ4n*dReQ5n*dImQ3n*dImQ4n 
-	                         - dReQ3n*dReQ5n*pow(dImQ4n,2.)-pow(dReQ4n,2.)*dImQ3n*dImQ5n
-				 + 2.*dReQ3n*dReQ4n*dImQ4n*dImQ5n+dImQ3n*pow(dImQ4n,2.)*dImQ5n;
- Double_t reQ7nQ1nQ5nstarQ3nstar = dImQ1n*dImQ3n*dImQ5n*dImQ7n+dImQ5n*dImQ7n*dReQ1n*dReQ3n 
-                                 + dImQ3n*dImQ7n*dReQ1n*dReQ5n-dImQ1n*dImQ7n*dReQ3n*dReQ5n
-                                 - dImQ3n*dImQ5n*dReQ1n*dReQ7n+dImQ1n*dImQ5n*dReQ3n*dReQ7n 
-                                 + dImQ1n*dImQ3n*dReQ5n*dReQ7n+dReQ1n*dReQ3n*dReQ5n*dReQ7n;		
- Double_t reQ8nQ4nstarQ3nstarQ1nstar = dReQ1n*dReQ3n*dReQ4n*dReQ8n-dReQ4n*dReQ8n*dImQ1n*dImQ3n 
-	                             - dReQ3n*dReQ8n*dImQ1n*dImQ4n-dReQ1n*dReQ8n*dImQ3n*dImQ4n 
-				     + dReQ3n*dReQ4n*dImQ1n*dImQ8n+dReQ1n*dReQ4n*dImQ3n*dImQ8n 
-				     + dReQ1n*dReQ3n*dImQ4n*dImQ8n-dImQ1n*dImQ3n*dImQ4n*dImQ8n;
- Double_t reQ8nQ4nstarQ4nstar = pow(dReQ4n,2.)*dReQ8n-dReQ8n*pow(dImQ4n,2.)+2.*dReQ4n*dImQ4n*dImQ8n;
- // <5>_{5n,4n|4n,3n,2n}:
- Double_t reQ5nQ4nQ4nstarQ3nstarQ2nstar = (pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                                        * (dReQ2n*dReQ3n*dReQ5n-dReQ5n*dImQ2n*dImQ3n 
-                                        + dReQ3n*dImQ2n*dImQ5n+dReQ2n*dImQ3n*dImQ5n);
- Double_t reQ6nQ3nQ5nstarQ4nstar = dImQ4n*dImQ3n*dImQ6n*dImQ5n+dImQ6n*dImQ5n*dReQ4n*dReQ3n 
-                                 + dImQ3n*dImQ5n*dReQ4n*dReQ6n-dImQ4n*dImQ5n*dReQ3n*dReQ6n
-                                 - dImQ3n*dImQ6n*dReQ4n*dReQ5n+dImQ4n*dImQ6n*dReQ3n*dReQ5n 
-                                 + dImQ4n*dImQ3n*dReQ6n*dReQ5n+dReQ4n*dReQ3n*dReQ6n*dReQ5n;
- Double_t reQ9nQ4nstarQ3nstarQ2nstar = dReQ2n*dReQ3n*dReQ4n*dReQ9n-dReQ4n*dReQ9n*dImQ2n*dImQ3n 
-	                             - dReQ3n*dReQ9n*dImQ2n*dImQ4n-dReQ2n*dReQ9n*dImQ3n*dImQ4n 
-				     + dReQ3n*dReQ4n*dImQ2n*dImQ9n+dReQ2n*dReQ4n*dImQ3n*dImQ9n 
-				     + dReQ2n*dReQ3n*dImQ4n*dImQ9n-dImQ2n*dImQ3n*dImQ4n*dImQ9n;	  
- Double_t reQ9nQ6nstarQ3nstar = dReQ9n*dReQ6n*dReQ3n-dReQ9n*dImQ6n*dImQ3n+dImQ9n*dReQ6n*dImQ3n
-                              + dImQ9n*dImQ6n*dReQ3n; 
- // <5>_{5n,3n|5n,2n,1n}:
- Double_t reQ5nQ3nQ5nstarQ2nstarQ1nstar = (dReQ1n*dReQ2n*dReQ3n-dReQ3n*dImQ1n*dImQ2n 
-	                                + dReQ2n*dImQ1n*dImQ3n+dReQ1n*dImQ2n*dImQ3n) 
-					* (pow(dReQ5n,2.)+pow(dImQ5n,2.));
- Double_t reQ8nQ5nstarQ2nstarQ1nstar = dReQ1n*dReQ2n*dReQ5n*dReQ8n-dReQ5n*dReQ8n*dImQ1n*dImQ2n 
-	                             - dReQ2n*dReQ8n*dImQ1n*dImQ5n-dReQ1n*dReQ8n*dImQ2n*dImQ5n 
-				     + dReQ2n*dReQ5n*dImQ1n*dImQ8n+dReQ1n*dReQ5n*dImQ2n*dImQ8n 
-				     + dReQ1n*dReQ2n*dImQ5n*dImQ8n-dImQ1n*dImQ2n*dImQ5n*dImQ8n;
- // <5>_{5n,4n|5n,3n,1n}:
- Double_t reQ5nQ4nQ5nstarQ3nstarQ1nstar = (dReQ1n*dReQ3n*dReQ4n-dReQ4n*dImQ1n*dImQ3n 
-	                                + dReQ3n*dImQ1n*dImQ4n+dReQ1n*dImQ3n*dImQ4n) 
-					* (pow(dReQ5n,2.)+pow(dImQ5n,2.));
- Double_t reQ8nQ1nQ5nstarQ4nstar = dImQ4n*dImQ1n*dImQ8n*dImQ5n+dImQ8n*dImQ5n*dReQ4n*dReQ1n 
-                                 + dImQ1n*dImQ5n*dReQ4n*dReQ8n-dImQ4n*dImQ5n*dReQ1n*dReQ8n
-                                 - dImQ1n*dImQ8n*dReQ4n*dReQ5n+dImQ4n*dImQ8n*dReQ1n*dReQ5n 
-                                 + dImQ4n*dImQ1n*dReQ8n*dReQ5n+dReQ4n*dReQ1n*dReQ8n*dReQ5n;			 
- Double_t reQ9nQ5nstarQ3nstarQ1nstar = dReQ1n*dReQ3n*dReQ5n*dReQ9n-dReQ5n*dReQ9n*dImQ1n*dImQ3n 
-	                             - dReQ3n*dReQ9n*dImQ1n*dImQ5n-dReQ1n*dReQ9n*dImQ3n*dImQ5n 
-				     + dReQ3n*dReQ5n*dImQ1n*dImQ9n+dReQ1n*dReQ5n*dImQ3n*dImQ9n 
-				     + dReQ1n*dReQ3n*dImQ5n*dImQ9n-dImQ1n*dImQ3n*dImQ5n*dImQ9n;
- Double_t reQ9nQ8nstarQ1nstar = dReQ9n*dReQ8n*dReQ1n-dReQ9n*dImQ8n*dImQ1n+dImQ9n*dReQ8n*dImQ1n
-                              + dImQ9n*dImQ8n*dReQ1n; 
- // <5>_{6n,1n|4n,2n,1n}:
- Double_t reQ6nQ1nQ4nstarQ2nstarQ1nstar = (dReQ2n*dReQ4n*dReQ6n-dReQ6n*dImQ2n*dImQ4n 
-	                                + dReQ4n*dImQ2n*dImQ6n+dReQ2n*dImQ4n*dImQ6n) 
-				        * (pow(dReQ1n,2.)+pow(dImQ1n,2.));
- // <5>_{6n,3n|4n,3n,2n}:
- Double_t reQ6nQ3nQ4nstarQ3nstarQ2nstar = (dReQ2n*dReQ4n*dReQ6n-dReQ6n*dImQ2n*dImQ4n 
-	                                + dReQ4n*dImQ2n*dImQ6n+dReQ2n*dImQ4n*dImQ6n) 
-			  	        * (pow(dReQ3n,2.)+pow(dImQ3n,2.));
- Double_t reQ7nQ2nQ6nstarQ3nstar = dImQ3n*dImQ2n*dImQ7n*dImQ6n+dImQ7n*dImQ6n*dReQ3n*dReQ2n 
-                                 + dImQ2n*dImQ6n*dReQ3n*dReQ7n-dImQ3n*dImQ6n*dReQ2n*dReQ7n
-                                 - dImQ2n*dImQ7n*dReQ3n*dReQ6n+dImQ3n*dImQ7n*dReQ2n*dReQ6n 
-                                 + dImQ3n*dImQ2n*dReQ7n*dReQ6n+dReQ3n*dReQ2n*dReQ7n*dReQ6n;			 
- // <5>_{6n,2n|5n,2n,1n}:
- Double_t reQ6nQ2nQ5nstarQ2nstarQ1nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                                        * (dReQ1n*dReQ5n*dReQ6n-dReQ6n*dImQ1n*dImQ5n 
-                                        + dReQ5n*dImQ1n*dImQ6n+dReQ1n*dImQ5n*dImQ6n);
- // <5>_{6n,3n|5n,3n,1n}:
- Double_t reQ6nQ3nQ5nstarQ3nstarQ1nstar = (pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                                        * (dReQ1n*dReQ5n*dReQ6n-dReQ6n*dImQ1n*dImQ5n 
-                                        + dReQ5n*dImQ1n*dImQ6n+dReQ1n*dImQ5n*dImQ6n);
- Double_t reQ8nQ1nQ6nstarQ3nstar = dImQ3n*dImQ1n*dImQ8n*dImQ6n+dImQ8n*dImQ6n*dReQ3n*dReQ1n 
-                                 + dImQ1n*dImQ6n*dReQ3n*dReQ8n-dImQ3n*dImQ6n*dReQ1n*dReQ8n
-                                 - dImQ1n*dImQ8n*dReQ3n*dReQ6n+dImQ3n*dImQ8n*dReQ1n*dReQ6n 
-                                 + dImQ3n*dImQ1n*dReQ8n*dReQ6n+dReQ3n*dReQ1n*dReQ8n*dReQ6n;			 
- // <5>_{6n,4n|5n,4n,1n}:
- Double_t reQ6nQ4nQ5nstarQ4nstarQ1nstar = (pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                                        * (dReQ1n*dReQ5n*dReQ6n-dReQ6n*dImQ1n*dImQ5n 
-                                        + dReQ5n*dImQ1n*dImQ6n+dReQ1n*dImQ5n*dImQ6n);
- Double_t reQ6nQ4nQ5nstarQ5nstar = dReQ4n*pow(dReQ5n,2.)*dReQ6n+2.*dReQ5n*dReQ6n*dImQ4n*dImQ5n 
-	                         - dReQ4n*dReQ6n*pow(dImQ5n,2.)-pow(dReQ5n,2.)*dImQ4n*dImQ6n
-				 + 2.*dReQ4n*dReQ5n*dImQ5n*dImQ6n+dImQ4n*pow(dImQ5n,2.)*dImQ6n;
- Double_t reQ9nQ1nQ6nstarQ4nstar = dImQ4n*dImQ1n*dImQ9n*dImQ6n+dImQ9n*dImQ6n*dReQ4n*dReQ1n 
-                                 + dImQ1n*dImQ6n*dReQ4n*dReQ9n-dImQ4n*dImQ6n*dReQ1n*dReQ9n
-                                 - dImQ1n*dImQ9n*dReQ4n*dReQ6n+dImQ4n*dImQ9n*dReQ1n*dReQ6n 
-                                 + dImQ4n*dImQ1n*dReQ9n*dReQ6n+dReQ4n*dReQ1n*dReQ9n*dReQ6n;
- Double_t reQ10nQ5nstarQ4nstarQ1nstar = dReQ1n*dReQ4n*dReQ5n*dReQ10n-dReQ5n*dReQ10n*dImQ1n*dImQ4n 
-	                              - dReQ4n*dReQ10n*dImQ1n*dImQ5n-dReQ1n*dReQ10n*dImQ4n*dImQ5n 
-				      + dReQ4n*dReQ5n*dImQ1n*dImQ10n+dReQ1n*dReQ5n*dImQ4n*dImQ10n 
-				      + dReQ1n*dReQ4n*dImQ5n*dImQ10n-dImQ1n*dImQ4n*dImQ5n*dImQ10n;
- Double_t reQ10nQ9nstarQ1nstar = dReQ10n*dReQ9n*dReQ1n-dReQ10n*dImQ9n*dImQ1n+dImQ10n*dReQ9n*dImQ1n
-                               + dImQ10n*dImQ9n*dReQ1n;
- Double_t reQ10nQ5nstarQ5nstar = pow(dReQ5n,2.)*dReQ10n-dReQ10n*pow(dImQ5n,2.)+2.*dReQ5n*dImQ5n*dImQ10n;
- // <5>_{6n,3n|6n,2n,1n}:
- Double_t reQ6nQ3nQ6nstarQ2nstarQ1nstar = (dReQ1n*dReQ2n*dReQ3n-dReQ3n*dImQ1n*dImQ2n 
-	                                + dReQ2n*dImQ1n*dImQ3n+dReQ1n*dImQ2n*dImQ3n) 
-				        * (pow(dReQ6n,2.)+pow(dImQ6n,2.));
- Double_t reQ9nQ6nstarQ2nstarQ1nstar = dReQ1n*dReQ2n*dReQ6n*dReQ9n-dReQ6n*dReQ9n*dImQ1n*dImQ2n 
-	                             - dReQ2n*dReQ9n*dImQ1n*dImQ6n-dReQ1n*dReQ9n*dImQ2n*dImQ6n 
-				     + dReQ2n*dReQ6n*dImQ1n*dImQ9n+dReQ1n*dReQ6n*dImQ2n*dImQ9n 
-				     + dReQ1n*dReQ2n*dImQ6n*dImQ9n-dImQ1n*dImQ2n*dImQ6n*dImQ9n;
- // <5>_{6n,4n|6n,3n,1n}:
- Double_t reQ6nQ4nQ6nstarQ3nstarQ1nstar = (dReQ1n*dReQ3n*dReQ4n-dReQ4n*dImQ1n*dImQ3n 
-	                                + dReQ3n*dImQ1n*dImQ4n+dReQ1n*dImQ3n*dImQ4n) 
-					* (pow(dReQ6n,2.)+pow(dImQ6n,2.));
- Double_t reQ10nQ6nstarQ3nstarQ1nstar = dReQ1n*dReQ3n*dReQ6n*dReQ10n-dReQ6n*dReQ10n*dImQ1n*dImQ3n 
-	                              - dReQ3n*dReQ10n*dImQ1n*dImQ6n-dReQ1n*dReQ10n*dImQ3n*dImQ6n 
-				      + dReQ3n*dReQ6n*dImQ1n*dImQ10n+dReQ1n*dReQ6n*dImQ3n*dImQ10n 
-				      + dReQ1n*dReQ3n*dImQ6n*dImQ10n-dImQ1n*dImQ3n*dImQ6n*dImQ10n;
- // <5>_{6n,5n|5n,4n,2n}:
- Double_t reQ6nQ5nQ5nstarQ4nstarQ2nstar = (dReQ2n*dReQ4n*dReQ6n-dReQ6n*dImQ2n*dImQ4n 
-	                                + dReQ4n*dImQ2n*dImQ6n+dReQ2n*dImQ4n*dImQ6n) 
-				        * (pow(dReQ5n,2.)+pow(dImQ5n,2.));
- Double_t reQ7nQ4nQ6nstarQ5nstar = dImQ5n*dImQ4n*dImQ7n*dImQ6n+dImQ7n*dImQ6n*dReQ5n*dReQ4n 
-                                 + dImQ4n*dImQ6n*dReQ5n*dReQ7n-dImQ5n*dImQ6n*dReQ4n*dReQ7n
-                                 - dImQ4n*dImQ7n*dReQ5n*dReQ6n+dImQ5n*dImQ7n*dReQ4n*dReQ6n 
-                                 + dImQ5n*dImQ4n*dReQ7n*dReQ6n+dReQ5n*dReQ4n*dReQ7n*dReQ6n;
- Double_t reQ9nQ2nQ6nstarQ5nstar = dImQ5n*dImQ2n*dImQ9n*dImQ6n+dImQ9n*dImQ6n*dReQ5n*dReQ2n 
-                                 + dImQ2n*dImQ6n*dReQ5n*dReQ9n-dImQ5n*dImQ6n*dReQ2n*dReQ9n
-                                 - dImQ2n*dImQ9n*dReQ5n*dReQ6n+dImQ5n*dImQ9n*dReQ2n*dReQ6n 
-                                 + dImQ5n*dImQ2n*dReQ9n*dReQ6n+dReQ5n*dReQ2n*dReQ9n*dReQ6n;
- Double_t reQ11nQ5nstarQ4nstarQ2nstar = dReQ2n*dReQ4n*dReQ5n*dReQ11n-dReQ5n*dReQ11n*dImQ2n*dImQ4n 
-	                              - dReQ4n*dReQ11n*dImQ2n*dImQ5n-dReQ2n*dReQ11n*dImQ4n*dImQ5n 
-				      + dReQ4n*dReQ5n*dImQ2n*dImQ11n+dReQ2n*dReQ5n*dImQ4n*dImQ11n 
-				      + dReQ2n*dReQ4n*dImQ5n*dImQ11n-dImQ2n*dImQ4n*dImQ5n*dImQ11n;
- Double_t reQ11nQ9nstarQ2nstar = dReQ11n*dReQ9n*dReQ2n-dReQ11n*dImQ9n*dImQ2n+dImQ11n*dReQ9n*dImQ2n
-                               + dImQ11n*dImQ9n*dReQ2n;
- Double_t reQ11nQ7nstarQ4nstar = dReQ11n*dReQ7n*dReQ4n-dReQ11n*dImQ7n*dImQ4n+dImQ11n*dReQ7n*dImQ4n
-                               + dImQ11n*dImQ7n*dReQ4n;
- // <5>_{6n,5n|6n,3n,2n}:
- Double_t reQ6nQ5nQ6nstarQ3nstarQ2nstar = (dReQ2n*dReQ3n*dReQ5n-dReQ5n*dImQ2n*dImQ3n 
-	                                + dReQ3n*dImQ2n*dImQ5n+dReQ2n*dImQ3n*dImQ5n) 
-				        * (pow(dReQ6n,2.)+pow(dImQ6n,2.));
- Double_t reQ11nQ6nstarQ3nstarQ2nstar = dReQ2n*dReQ3n*dReQ6n*dReQ11n-dReQ6n*dReQ11n*dImQ2n*dImQ3n 
-	                              - dReQ3n*dReQ11n*dImQ2n*dImQ6n-dReQ2n*dReQ11n*dImQ3n*dImQ6n 
-				      + dReQ3n*dReQ6n*dImQ2n*dImQ11n+dReQ2n*dReQ6n*dImQ3n*dImQ11n 
-				      + dReQ2n*dReQ3n*dImQ6n*dImQ11n-dImQ2n*dImQ3n*dImQ6n*dImQ11n;
- // <5>_{6n,5n|6n,4n,1n}:
- Double_t reQ6nQ5nQ6nstarQ4nstarQ1nstar = (dReQ1n*dReQ4n*dReQ5n-dReQ5n*dImQ1n*dImQ4n 
-	                                + dReQ4n*dImQ1n*dImQ5n+dReQ1n*dImQ4n*dImQ5n) 
-					* (pow(dReQ6n,2.)+pow(dImQ6n,2.));
- Double_t reQ10nQ1nQ6nstarQ5nstar = dImQ5n*dImQ1n*dImQ10n*dImQ6n+dImQ10n*dImQ6n*dReQ5n*dReQ1n 
-                                  + dImQ1n*dImQ6n*dReQ5n*dReQ10n-dImQ5n*dImQ6n*dReQ1n*dReQ10n
-                                  - dImQ1n*dImQ10n*dReQ5n*dReQ6n+dImQ5n*dImQ10n*dReQ1n*dReQ6n 
-                                  + dImQ5n*dImQ1n*dReQ10n*dReQ6n+dReQ5n*dReQ1n*dReQ10n*dReQ6n;
- Double_t reQ11nQ10nstarQ1nstar = dReQ11n*dReQ10n*dReQ1n-dReQ11n*dImQ10n*dImQ1n+dImQ11n*dReQ10n*dImQ1n
-                                + dImQ11n*dImQ10n*dReQ1n;
- Double_t reQ11nQ6nstarQ4nstarQ1nstar = dReQ1n*dReQ4n*dReQ6n*dReQ11n-dReQ6n*dReQ11n*dImQ1n*dImQ4n 
-	                              - dReQ4n*dReQ11n*dImQ1n*dImQ6n-dReQ1n*dReQ11n*dImQ4n*dImQ6n 
-				      + dReQ4n*dReQ6n*dImQ1n*dImQ11n+dReQ1n*dReQ6n*dImQ4n*dImQ11n 
-				      + dReQ1n*dReQ4n*dImQ6n*dImQ11n-dImQ1n*dImQ4n*dImQ6n*dImQ11n;
- // <5>_{4n,1n|3n,1n,1n}:
- Double_t reQ4nQ1nQ3nstarQ1nstarQ1nstar = (pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                                        * (dReQ1n*dReQ3n*dReQ4n-dReQ4n*dImQ1n*dImQ3n
-                                        + dReQ3n*dImQ1n*dImQ4n+dReQ1n*dImQ3n*dImQ4n);
- Double_t reQ4nQ1nQ4nstarQ1nstar = (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.));
- Double_t reQ3nQ1nQ3nstarQ1nstar = (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.));
- // <5>_{4n,3n|3n,3n,1n}:
- Double_t reQ4nQ3nQ3nstarQ3nstarQ1nstar = (pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                                        * (dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n)); 
- Double_t reQ7nQ3nstarQ3nstarQ1nstar = (dReQ7n*dReQ1n+dImQ7n*dImQ1n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                                     + 2.*dReQ3n*dImQ3n*(dImQ7n*dReQ1n-dReQ7n*dImQ1n); 
- // <5>_{4n,4n|4n,3n,1n}:
- Double_t reQ4nQ4nQ4nstarQ3nstarQ1nstar = (pow(dReQ4n,2.)+pow(dImQ4n,2.))
-	                                * reQ4nQ3nstarQ1nstar;
- Double_t reQ7nQ1nQ4nstarQ4nstar = dReQ1n*pow(dReQ4n,2.)*dReQ7n+2.*dReQ4n*dReQ7n*dImQ1n*dImQ4n 
-	                         - dReQ1n*dReQ7n*pow(dImQ4n,2.)-pow(dReQ4n,2.)*dImQ1n*dImQ7n
-				 + 2.*dReQ1n*dReQ4n*dImQ4n*dImQ7n+dImQ1n*pow(dImQ4n,2.)*dImQ7n;
- // <5>_{5n,2n|3n,2n,2n}:
- Double_t reQ5nQ2nQ3nstarQ2nstarQ2nstar = (pow(dReQ2n,2.)+pow(dImQ2n,2.))
-	                                * reQ5nQ3nstarQ2nstar;
- // <5>_{5n,3n|3n,3n,2n}:
- Double_t reQ5nQ3nQ3nstarQ3nstarQ2nstar = (pow(dImQ3n,2.)+pow(dReQ3n,2.))
-                                        * (dImQ3n*dImQ5n*dReQ2n+dImQ2n*dImQ5n*dReQ3n 
-                                        - dImQ2n*dImQ3n*dReQ5n+dReQ2n*dReQ3n*dReQ5n);
- Double_t reQ8nQ3nstarQ3nstarQ2nstar = (dReQ8n*dReQ2n+dImQ8n*dImQ2n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                                     + 2.*dReQ3n*dImQ3n*(dImQ8n*dReQ2n-dReQ8n*dImQ2n);
- /*
- Double_t reQ5nQ1nQ3nstarQ2nstar = dImQ2n*dImQ1n*dImQ5n*dImQ3n+dImQ5n*dImQ3n*dReQ2n*dReQ1n 
-                                 + dImQ1n*dImQ3n*dReQ2n*dReQ5n-dImQ2n*dImQ3n*dReQ1n*dReQ5n
-                                 - dImQ1n*dImQ5n*dReQ2n*dReQ3n+dImQ2n*dImQ5n*dReQ1n*dReQ3n 
-                                 + dImQ2n*dImQ1n*dReQ5n*dReQ3n+dReQ2n*dReQ1n*dReQ5n*dReQ3n;
- */
- // <5>_{5n,1n|4n,1n,1n}:
- Double_t reQ5nQ1nQ4nstarQ1nstarQ1nstar = (pow(dImQ1n,2.)+pow(dReQ1n,2.))
-                                        * (dImQ1n*dImQ5n*dReQ4n+dImQ4n*dImQ5n*dReQ1n 
-                                        - dImQ4n*dImQ1n*dReQ5n+dReQ4n*dReQ1n*dReQ5n);
- // <5>_{5n,4n|4n,4n,1n}:
- Double_t reQ5nQ4nQ4nstarQ4nstarQ1nstar = (pow(dImQ4n,2.)+pow(dReQ4n,2.))
-                                        * (dImQ4n*dImQ5n*dReQ1n+dImQ1n*dImQ5n*dReQ4n 
-                                        - dImQ1n*dImQ4n*dReQ5n+dReQ1n*dReQ4n*dReQ5n);
- Double_t reQ9nQ4nstarQ4nstarQ1nstar = (dReQ9n*dReQ1n+dImQ9n*dImQ1n)*(pow(dReQ4n,2)-pow(dImQ4n,2)) 
-                                     + 2.*dReQ4n*dImQ4n*(dImQ9n*dReQ1n-dReQ9n*dImQ1n);
- // <5>_{5n,5n|5n,3n,2n}:
- Double_t reQ5nQ5nQ5nstarQ3nstarQ2nstar = (pow(dImQ5n,2.)+pow(dReQ5n,2.))
-                                        * (dImQ3n*dImQ5n*dReQ2n+dImQ2n*dImQ5n*dReQ3n
-                                        - dImQ2n*dImQ3n*dReQ5n+dReQ2n*dReQ3n*dReQ5n);
- Double_t reQ7nQ3nQ5nstarQ5nstar = dReQ3n*pow(dReQ5n,2.)*dReQ7n+2.*dReQ5n*dReQ7n*dImQ3n*dImQ5n 
-	                         - dReQ3n*dReQ7n*pow(dImQ5n,2.)-pow(dReQ5n,2.)*dImQ3n*dImQ7n
-				 + 2.*dReQ3n*dReQ5n*dImQ5n*dImQ7n+dImQ3n*pow(dImQ5n,2.)*dImQ7n;
- Double_t reQ8nQ2nQ5nstarQ5nstar = dReQ2n*pow(dReQ5n,2.)*dReQ8n+2.*dReQ5n*dReQ8n*dImQ2n*dImQ5n 
-	                         - dReQ2n*dReQ8n*pow(dImQ5n,2.)-pow(dReQ5n,2.)*dImQ2n*dImQ8n
-				 + 2.*dReQ2n*dReQ5n*dImQ5n*dImQ8n+dImQ2n*pow(dImQ5n,2.)*dImQ8n;
- Double_t reQ10nQ5nstarQ3nstarQ2nstar = dReQ2n*dReQ3n*dReQ5n*dReQ10n-dReQ5n*dReQ10n*dImQ2n*dImQ3n 
-	                              - dReQ3n*dReQ10n*dImQ2n*dImQ5n-dReQ2n*dReQ10n*dImQ3n*dImQ5n 
-			              + dReQ3n*dReQ5n*dImQ2n*dImQ10n+dReQ2n*dReQ5n*dImQ3n*dImQ10n 
-				      + dReQ2n*dReQ3n*dImQ5n*dImQ10n-dImQ2n*dImQ3n*dImQ5n*dImQ10n;
- Double_t reQ10nQ8nstarQ2nstar = dReQ10n*dReQ8n*dReQ2n-dReQ10n*dImQ8n*dImQ2n+dImQ10n*dReQ8n*dImQ2n
-                               + dImQ10n*dImQ8n*dReQ2n;
- // <5>_{5n,5n|5n,4n,1n}:
- Double_t reQ5nQ5nQ5nstarQ4nstarQ1nstar = (pow(dImQ5n,2.)+pow(dReQ5n,2.))
-                                        * (dImQ4n*dImQ5n*dReQ1n+dImQ1n*dImQ5n*dReQ4n
-                                        - dImQ1n*dImQ4n*dReQ5n+dReQ1n*dReQ4n*dReQ5n);
- Double_t reQ9nQ1nQ5nstarQ5nstar = dReQ1n*pow(dReQ5n,2.)*dReQ9n+2.*dReQ5n*dReQ9n*dImQ1n*dImQ5n 
-	                         - dReQ1n*dReQ9n*pow(dImQ5n,2.)-pow(dReQ5n,2.)*dImQ1n*dImQ9n
-			         + 2.*dReQ1n*dReQ5n*dImQ5n*dImQ9n+dImQ1n*pow(dImQ5n,2.)*dImQ9n;
- // <5>_{6n,1n|5n,1n,1n}:
- Double_t reQ6nQ1nQ5nstarQ1nstarQ1nstar = (pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                                        * (dReQ1n*dReQ5n*dReQ6n-dReQ6n*dImQ1n*dImQ5n
-                                        + dReQ5n*dImQ1n*dImQ6n+dReQ1n*dImQ5n*dImQ6n);
- // <5>_{6n,5n|5n,5n,1n}:
- Double_t reQ6nQ5nQ5nstarQ5nstarQ1nstar = (pow(dImQ5n,2.)+pow(dReQ5n,2.))
-                                        * (dImQ5n*dImQ6n*dReQ1n+dImQ1n*dImQ6n*dReQ5n 
-                                        - dImQ1n*dImQ5n*dReQ6n+dReQ1n*dReQ5n*dReQ6n);
- Double_t reQ11nQ5nstarQ5nstarQ1nstar = (dReQ11n*dReQ1n+dImQ11n*dImQ1n)*(pow(dReQ5n,2)-pow(dImQ5n,2)) 
-                                      + 2.*dReQ5n*dImQ5n*(dImQ11n*dReQ1n-dReQ11n*dImQ1n);
- // <5>_{6n,6n|6n,5n,1n}:
- Double_t reQ6nQ6nQ6nstarQ5nstarQ1nstar = (pow(dReQ6n,2.)+pow(dImQ6n,2.))
-	                                * reQ6nQ5nstarQ1nstar;
- Double_t reQ7nQ5nQ6nstarQ6nstar = dReQ5n*pow(dReQ6n,2.)*dReQ7n+2.*dReQ6n*dReQ7n*dImQ5n*dImQ6n 
-	                         - dReQ5n*dReQ7n*pow(dImQ6n,2.)-pow(dReQ6n,2.)*dImQ5n*dImQ7n
-				 + 2.*dReQ5n*dReQ6n*dImQ6n*dImQ7n+dImQ5n*pow(dImQ6n,2.)*dImQ7n;
- Double_t reQ11nQ1nQ6nstarQ6nstar = dReQ1n*pow(dReQ6n,2.)*dReQ11n+2.*dReQ6n*dReQ11n*dImQ1n*dImQ6n 
- 	                          - dReQ1n*dReQ11n*pow(dImQ6n,2.)-pow(dReQ6n,2.)*dImQ1n*dImQ11n
- 				  + 2.*dReQ1n*dReQ6n*dImQ6n*dImQ11n+dImQ1n*pow(dImQ6n,2.)*dImQ11n;
- Double_t reQ12nQ6nstarQ6nstar = pow(dReQ6n,2.)*dReQ12n-dReQ12n*pow(dImQ6n,2.)+2.*dReQ6n*dImQ6n*dImQ12n;
- Double_t reQ12nQ11nstarQ1nstar = dReQ12n*dReQ11n*dReQ1n-dReQ12n*dImQ11n*dImQ1n+dImQ12n*dReQ11n*dImQ1n
-                                + dImQ12n*dImQ11n*dReQ1n;
- Double_t reQ12nQ6nstarQ5nstarQ1nstar = dReQ1n*dReQ5n*dReQ6n*dReQ12n-dReQ6n*dReQ12n*dImQ1n*dImQ5n 
-	                              - dReQ5n*dReQ12n*dImQ1n*dImQ6n-dReQ1n*dReQ12n*dImQ5n*dImQ6n 
-			              + dReQ5n*dReQ6n*dImQ1n*dImQ12n+dReQ1n*dReQ6n*dImQ5n*dImQ12n 
-			              + dReQ1n*dReQ5n*dImQ6n*dImQ12n-dImQ1n*dImQ5n*dImQ6n*dImQ12n;
- Double_t reQ12nQ7nstarQ5nstar = dReQ12n*dReQ7n*dReQ5n-dReQ12n*dImQ7n*dImQ5n+dImQ12n*dReQ7n*dImQ5n
-                               + dImQ12n*dImQ7n*dReQ5n;
- // <5>_{6n,2n|4n,3n,1n}:
- Double_t reQ6nQ2nQ4nstarQ3nstarQ1nstar = dReQ1n*dReQ2n*dReQ3n*dReQ4n*dReQ6n+dReQ3n*dReQ4n*dReQ6n*dImQ1n*dImQ2n 
-	                                - dReQ2n*dReQ4n*dReQ6n*dImQ1n*dImQ3n+dReQ1n*dReQ4n*dReQ6n*dImQ2n*dImQ3n 
-					- dReQ2n*dReQ3n*dReQ6n*dImQ1n*dImQ4n+dReQ1n*dReQ3n*dReQ6n*dImQ2n*dImQ4n
-					- dReQ1n*dReQ2n*dReQ6n*dImQ3n*dImQ4n-dReQ6n*dImQ1n*dImQ2n*dImQ3n*dImQ4n 
-					+ dReQ2n*dReQ3n*dReQ4n*dImQ1n*dImQ6n-dReQ1n*dReQ3n*dReQ4n*dImQ2n*dImQ6n 
-					+ dReQ1n*dReQ2n*dReQ4n*dImQ3n*dImQ6n+dReQ4n*dImQ1n*dImQ2n*dImQ3n*dImQ6n 
-					+ dReQ1n*dReQ2n*dReQ3n*dImQ4n*dImQ6n+dReQ3n*dImQ1n*dImQ2n*dImQ4n*dImQ6n 
-					- dReQ2n*dImQ1n*dImQ3n*dImQ4n*dImQ6n+dReQ1n*dImQ2n*dImQ3n*dImQ4n*dImQ6n;
- Double_t reQ6nQ2nQ4nstarQ4nstar = dReQ2n*pow(dReQ4n,2.)*dReQ6n+2.*dReQ4n*dReQ6n*dImQ2n*dImQ4n 
-	                         - dReQ2n*dReQ6n*pow(dImQ4n,2.)-pow(dReQ4n,2.)*dImQ2n*dImQ6n
-				 + 2.*dReQ2n*dReQ4n*dImQ4n*dImQ6n+dImQ2n*pow(dImQ4n,2.)*dImQ6n;
- // <5>_{6n,2n,1n|5n,4n}:
- Double_t reQ6nQ2nQ1nQ5nstarQ4nstar = dReQ1n*dReQ2n*dReQ4n*dReQ6n*dReQ5n - dReQ4n*dReQ6n*dReQ5n*dImQ1n*dImQ2n 
-	                            + dReQ2n*dReQ6n*dReQ5n*dImQ1n*dImQ4n + dReQ1n*dReQ6n*dReQ5n*dImQ2n*dImQ4n
-				    - dReQ2n*dReQ4n*dReQ5n*dImQ1n*dImQ6n - dReQ1n*dReQ4n*dReQ5n*dImQ2n*dImQ6n 
-				    + dReQ1n*dReQ2n*dReQ5n*dImQ4n*dImQ6n - dReQ5n*dImQ1n*dImQ2n*dImQ4n*dImQ6n 
-				    + dReQ2n*dReQ4n*dReQ6n*dImQ1n*dImQ5n + dReQ1n*dReQ4n*dReQ6n*dImQ2n*dImQ5n 
-				    - dReQ1n*dReQ2n*dReQ6n*dImQ4n*dImQ5n + dReQ6n*dImQ1n*dImQ2n*dImQ4n*dImQ5n 
-			            + dReQ1n*dReQ2n*dReQ4n*dImQ6n*dImQ5n - dReQ4n*dImQ1n*dImQ2n*dImQ6n*dImQ5n 
-				    + dReQ2n*dImQ1n*dImQ4n*dImQ6n*dImQ5n + dReQ1n*dImQ2n*dImQ4n*dImQ6n*dImQ5n;
-
- // <5>_{6n,4n|5n,3n,2n}:
- Double_t reQ6nQ4nQ5nstarQ3nstarQ2nstar = dReQ2n*dReQ3n*dReQ4n*dReQ5n*dReQ6n - dReQ4n*dReQ5n*dReQ6n*dImQ2n*dImQ3n 
-	                                + dReQ3n*dReQ5n*dReQ6n*dImQ2n*dImQ4n + dReQ2n*dReQ5n*dReQ6n*dImQ3n*dImQ4n
-					- dReQ3n*dReQ4n*dReQ6n*dImQ2n*dImQ5n - dReQ2n*dReQ4n*dReQ6n*dImQ3n*dImQ5n 
-				        + dReQ2n*dReQ3n*dReQ6n*dImQ4n*dImQ5n - dReQ6n*dImQ2n*dImQ3n*dImQ4n*dImQ5n 
-					+ dReQ3n*dReQ4n*dReQ5n*dImQ2n*dImQ6n + dReQ2n*dReQ4n*dReQ5n*dImQ3n*dImQ6n 
-					- dReQ2n*dReQ3n*dReQ5n*dImQ4n*dImQ6n + dReQ5n*dImQ2n*dImQ3n*dImQ4n*dImQ6n 
-					+ dReQ2n*dReQ3n*dReQ4n*dImQ5n*dImQ6n - dReQ4n*dImQ2n*dImQ3n*dImQ5n*dImQ6n 
-					+ dReQ3n*dImQ2n*dImQ4n*dImQ5n*dImQ6n + dReQ2n*dImQ3n*dImQ4n*dImQ5n*dImQ6n;
- Double_t reQ8nQ2nQ6nstarQ4nstar = dImQ4n*dImQ2n*dImQ8n*dImQ6n+dImQ8n*dImQ6n*dReQ4n*dReQ2n 
-                                 + dImQ2n*dImQ6n*dReQ4n*dReQ8n-dImQ4n*dImQ6n*dReQ2n*dReQ8n
-                                 - dImQ2n*dImQ8n*dReQ4n*dReQ6n+dImQ4n*dImQ8n*dReQ2n*dReQ6n 
-                                 + dImQ4n*dImQ2n*dReQ8n*dReQ6n+dReQ4n*dReQ2n*dReQ8n*dReQ6n;
-
- // <5>_{4n,4n|3n,3n,2n}:
- Double_t reQ4nQ4nQ3nstarQ3nstarQ2nstar = dReQ2n*pow(dReQ3n,2.)*pow(dReQ4n,2.)-2.*dReQ3n*pow(dReQ4n,2.)*dImQ2n*dImQ3n 
-	                                - dReQ2n*pow(dReQ4n,2.)*pow(dImQ3n,2.)+2.*pow(dReQ3n,2.)*dReQ4n*dImQ2n*dImQ4n 
-					+ 4.*dReQ2n*dReQ3n*dReQ4n*dImQ3n*dImQ4n - 2.*dReQ4n*dImQ2n*pow(dImQ3n,2.)*dImQ4n
-					- dReQ2n*pow(dReQ3n,2.)*pow(dImQ4n,2.) + 2.*dReQ3n*dImQ2n*dImQ3n*pow(dImQ4n,2.) 
-					+ dReQ2n*pow(dImQ3n,2.)*pow(dImQ4n,2.);
-
- // <5>_{5n|2n,1n,1n,1n}:
- Double_t reQ5nQ2nstarQ1nstarQ1nstarQ1nstar = pow(dReQ1n,3.)*dReQ2n*dReQ5n-3.*dReQ1n*dReQ2n*dReQ5n*pow(dImQ1n,2.) 
-	                                    - 3.*pow(dReQ1n,2.)*dReQ5n*dImQ1n*dImQ2n+dReQ5n*pow(dImQ1n,3.)*dImQ2n 
-					    + 3.*pow(dReQ1n,2.)*dReQ2n*dImQ1n*dImQ5n-dReQ2n*pow(dImQ1n,3.)*dImQ5n
-					    + pow(dReQ1n,3.)*dImQ2n*dImQ5n-3.*dReQ1n*pow(dImQ1n,2.)*dImQ2n*dImQ5n;
-
- // <5>_{5n,1n|2n,2n,2n}:
- Double_t reQ5nQ1nQ2nstarQ2nstarQ2nstar = dReQ1n*pow(dReQ2n,3.)*dReQ5n+3.*pow(dReQ2n,2.)*dReQ5n*dImQ1n*dImQ2n
-	                                - 3.*dReQ1n*dReQ2n*dReQ5n*pow(dImQ2n,2.)-dReQ5n*dImQ1n*pow(dImQ2n,3.) 
-					- pow(dReQ2n,3.)*dImQ1n*dImQ5n+3.*dReQ1n*pow(dReQ2n,2.)*dImQ2n*dImQ5n 
-					+ 3.*dReQ2n*dImQ1n*pow(dImQ2n,2.)*dImQ5n-dReQ1n*pow(dImQ2n,3.)*dImQ5n;
-
-
- // <5>_{5n,4n|3n,3n,3n}:
- Double_t reQ5nQ4nQ3nstarQ3nstarQ3nstar = dReQ4n*pow(dReQ3n,3.)*dReQ5n+3.*pow(dReQ3n,2.)*dReQ5n*dImQ4n*dImQ3n
-	                                - 3.*dReQ4n*dReQ3n*dReQ5n*pow(dImQ3n,2.)-dReQ5n*dImQ4n*pow(dImQ3n,3.) 
-					- pow(dReQ3n,3.)*dImQ4n*dImQ5n+3.*dReQ4n*pow(dReQ3n,2.)*dImQ3n*dImQ5n 
-					+ 3.*dReQ3n*dImQ4n*pow(dImQ3n,2.)*dImQ5n-dReQ4n*pow(dImQ3n,3.)*dImQ5n;
-
- Double_t reQ9nQ3nstarQ3nstarQ3nstar = dReQ9n*pow(dReQ3n,3)-3.*dReQ3n*dReQ9n*pow(dImQ3n,2)
-                                     + 3.*dImQ3n*dImQ9n*pow(dReQ3n,2)-dImQ9n*pow(dImQ3n,3); 
- // <5>_{5n,5n|4n,3n,3n}:
- Double_t reQ5nQ5nQ4nstarQ3nstarQ3nstar = dReQ4n*pow(dReQ3n,2.)*pow(dReQ5n,2.) - 2.*dReQ3n*pow(dReQ5n,2.)*dImQ4n*dImQ3n
- 	                                - dReQ4n*pow(dReQ5n,2.)*pow(dImQ3n,2.) + 2.*pow(dReQ3n,2.)*dReQ5n*dImQ4n*dImQ5n 
- 				        + 4.*dReQ4n*dReQ3n*dReQ5n*dImQ3n*dImQ5n - 2.*dReQ5n*dImQ4n*pow(dImQ3n,2.)*dImQ5n
- 				        - dReQ4n*pow(dReQ3n,2.)*pow(dImQ5n,2.) + 2.*dReQ3n*dImQ4n*dImQ3n*pow(dImQ5n,2.) 
- 				        + dReQ4n*pow(dImQ3n,2.)*pow(dImQ5n,2.);
-
- // <5>_{5n,5n|4n,4n,2n}:   
- Double_t reQ5nQ5nQ4nstarQ4nstarQ2nstar = dReQ2n*pow(dReQ4n,2.)*pow(dReQ5n,2.) - 2.*dReQ4n*pow(dReQ5n,2.)*dImQ2n*dImQ4n
- 	                                - dReQ2n*pow(dReQ5n,2.)*pow(dImQ4n,2.) + 2.*pow(dReQ4n,2.)*dReQ5n*dImQ2n*dImQ5n 
- 					+ 4.*dReQ2n*dReQ4n*dReQ5n*dImQ4n*dImQ5n - 2.*dReQ5n*dImQ2n*pow(dImQ4n,2.)*dImQ5n
- 					- dReQ2n*pow(dReQ4n,2.)*pow(dImQ5n,2.) + 2.*dReQ4n*dImQ2n*dImQ4n*pow(dImQ5n,2.) 
- 					+ dReQ2n*pow(dImQ4n,2.)*pow(dImQ5n,2.);
- Double_t reQ10nQ4nstarQ4nstarQ2nstar = (dReQ10n*dReQ2n+dImQ10n*dImQ2n)*(pow(dReQ4n,2)-pow(dImQ4n,2)) 
-                                      + 2.*dReQ4n*dImQ4n*(dImQ10n*dReQ2n-dReQ10n*dImQ2n);
- // <5>_{6n|3n,1n,1n,1n}:
- Double_t reQ6nQ3nstarQ1nstarQ1nstarQ1nstar = pow(dReQ1n,3.)*dReQ3n*dReQ6n-3.*dReQ1n*dReQ3n*dReQ6n*pow(dImQ1n,2.) 
-	                                    - 3.*pow(dReQ1n,2.)*dReQ6n*dImQ1n*dImQ3n+dReQ6n*pow(dImQ1n,3.)*dImQ3n 
-				            + 3.*pow(dReQ1n,2.)*dReQ3n*dImQ1n*dImQ6n-dReQ3n*pow(dImQ1n,3.)*dImQ6n
-					    + pow(dReQ1n,3.)*dImQ3n*dImQ6n-3.*dReQ1n*pow(dImQ1n,2.)*dImQ3n*dImQ6n;
- // <5>_{6n,1n,1n|4n,4n}:
- Double_t reQ6nQ1nQ1nQ4nstarQ4nstar = pow(dReQ1n,2.)*pow(dReQ4n,2.)*dReQ6n - pow(dReQ4n,2.)*dReQ6n*pow(dImQ1n,2.)
-	                            + 4.*dReQ1n*dReQ4n*dReQ6n*dImQ1n*dImQ4n - pow(dReQ1n,2.)*dReQ6n*pow(dImQ4n,2.)
-                                    + dReQ6n*pow(dImQ1n,2.)*pow(dImQ4n,2.) - 2.*dReQ1n*pow(dReQ4n,2.)*dImQ1n*dImQ6n 
-			            + 2.*pow(dReQ1n,2.)*dReQ4n*dImQ4n*dImQ6n - 2.*dReQ4n*pow(dImQ1n,2.)*dImQ4n*dImQ6n
-				    + 2.*dReQ1n*dImQ1n*pow(dImQ4n,2.)*dImQ6n;
-
-
- // <5>_{6n,2n,2n|5n,5n}:
- Double_t reQ6nQ2nQ2nQ5nstarQ5nstar = pow(dReQ2n,2.)*pow(dReQ5n,2.)*dReQ6n - pow(dReQ5n,2.)*dReQ6n*pow(dImQ2n,2.)
-	                            + 4.*dReQ2n*dReQ5n*dReQ6n*dImQ2n*dImQ5n - pow(dReQ2n,2.)*dReQ6n*pow(dImQ5n,2.)
-                                    + dReQ6n*pow(dImQ2n,2.)*pow(dImQ5n,2.) - 2.*dReQ2n*pow(dReQ5n,2.)*dImQ2n*dImQ6n 
-				    + 2.*pow(dReQ2n,2.)*dReQ5n*dImQ5n*dImQ6n - 2.*dReQ5n*pow(dImQ2n,2.)*dImQ5n*dImQ6n
-			            + 2.*dReQ2n*dImQ2n*pow(dImQ5n,2.)*dImQ6n;
- Double_t reQ10nQ6nstarQ2nstarQ2nstar = (dReQ10n*dReQ6n+dImQ10n*dImQ6n)*(pow(dReQ2n,2)-pow(dImQ2n,2)) 
-                                      + 2.*dReQ2n*dImQ2n*(dImQ10n*dReQ6n-dReQ10n*dImQ6n);
- // <5>_{6n,6n|5n,5n,2n}:
- Double_t reQ6nQ6nQ5nstarQ5nstarQ2nstar = dReQ2n*pow(dReQ5n,2.)*pow(dReQ6n,2.) - 2.*dReQ5n*pow(dReQ6n,2.)*dImQ2n*dImQ5n
- 	                                - dReQ2n*pow(dReQ6n,2.)*pow(dImQ5n,2.) + 2.*pow(dReQ5n,2.)*dReQ6n*dImQ2n*dImQ6n 
- 				        + 4.*dReQ2n*dReQ5n*dReQ6n*dImQ5n*dImQ6n - 2.*dReQ6n*dImQ2n*pow(dImQ5n,2.)*dImQ6n
- 				        - dReQ2n*pow(dReQ5n,2.)*pow(dImQ6n,2.) + 2.*dReQ5n*dImQ2n*dImQ5n*pow(dImQ6n,2.) 
- 				        + dReQ2n*pow(dImQ5n,2.)*pow(dImQ6n,2.);
- Double_t reQ10nQ2nQ6nstarQ6nstar = dImQ2n*pow(dImQ6n,2.)*dImQ10n+2.*dImQ6n*dImQ10n*dReQ2n*dReQ6n
-                                  - dImQ2n*dImQ10n*pow(dReQ6n,2.)-pow(dImQ6n,2.)*dReQ2n*dReQ10n 
-                                  + 2.*dImQ2n*dImQ6n*dReQ6n*dReQ10n+dReQ2n*pow(dReQ6n,2.)*dReQ10n;
- Double_t reQ12nQ5nstarQ5nstarQ2nstar = (dReQ12n*dReQ2n+dImQ12n*dImQ2n)*(pow(dReQ5n,2)-pow(dImQ5n,2)) 
-                                      + 2.*dReQ5n*dImQ5n*(dImQ12n*dReQ2n-dReQ12n*dImQ2n);
- Double_t reQ12nQ10nstarQ2nstar = dReQ12n*dReQ10n*dReQ2n-dReQ12n*dImQ10n*dImQ2n+dImQ12n*dReQ10n*dImQ2n
-                                + dImQ12n*dImQ10n*dReQ2n;
- // <5>_{5n,2n|3n,3n,1n}: 
- Double_t reQ5nQ2nQ3nstarQ3nstarQ1nstar = dReQ1n*dReQ2n*pow(dReQ3n,2.)*dReQ5n + pow(dReQ3n,2.)*dReQ5n*dImQ1n*dImQ2n 
-	                                - 2.*dReQ2n*dReQ3n*dReQ5n*dImQ1n*dImQ3n + 2.*dReQ1n*dReQ3n*dReQ5n*dImQ2n*dImQ3n 
-					- dReQ1n*dReQ2n*dReQ5n*pow(dImQ3n,2.) - dReQ5n*dImQ1n*dImQ2n*pow(dImQ3n,2.) 
-					+ dReQ2n*pow(dReQ3n,2.)*dImQ1n*dImQ5n - dReQ1n*pow(dReQ3n,2.)*dImQ2n*dImQ5n
-					+ 2.*dReQ1n*dReQ2n*dReQ3n*dImQ3n*dImQ5n + 2.*dReQ3n*dImQ1n*dImQ2n*dImQ3n*dImQ5n
-					- dReQ2n*dImQ1n*pow(dImQ3n,2.)*dImQ5n + dReQ1n*dImQ2n*pow(dImQ3n,2.)*dImQ5n;
- // <5>_{5n,1n,1n|4n,3n}:
- Double_t reQ5nQ1nQ1nQ4nstarQ3nstar = pow(dReQ1n,2.)*dReQ3n*dReQ4n*dReQ5n - dReQ3n*dReQ4n*dReQ5n*pow(dImQ1n,2.)
-	                            + 2.*dReQ1n*dReQ4n*dReQ5n*dImQ1n*dImQ3n + 2.*dReQ1n*dReQ3n*dReQ5n*dImQ1n*dImQ4n
-			            - pow(dReQ1n,2.)*dReQ5n*dImQ3n*dImQ4n + dReQ5n*pow(dImQ1n,2.)*dImQ3n*dImQ4n
-				    - 2.*dReQ1n*dReQ3n*dReQ4n*dImQ1n*dImQ5n + pow(dReQ1n,2.)*dReQ4n*dImQ3n*dImQ5n
-				    - dReQ4n*pow(dImQ1n,2.)*dImQ3n*dImQ5n + pow(dReQ1n,2.)*dReQ3n*dImQ4n*dImQ5n
-                                    - dReQ3n*pow(dImQ1n,2.)*dImQ4n*dImQ5n + 2.*dReQ1n*dImQ1n*dImQ3n*dImQ4n*dImQ5n;
- // <5>_{5n,3n|4n,2n,2n}:
- Double_t reQ5nQ3nQ4nstarQ2nstarQ2nstar = dReQ4n*dReQ3n*pow(dReQ2n,2.)*dReQ5n + pow(dReQ2n,2.)*dReQ5n*dImQ4n*dImQ3n 
-	                                - 2.*dReQ3n*dReQ2n*dReQ5n*dImQ4n*dImQ2n + 2.*dReQ4n*dReQ2n*dReQ5n*dImQ3n*dImQ2n 
-					- dReQ4n*dReQ3n*dReQ5n*pow(dImQ2n,2.) - dReQ5n*dImQ4n*dImQ3n*pow(dImQ2n,2.) 
-					+ dReQ3n*pow(dReQ2n,2.)*dImQ4n*dImQ5n - dReQ4n*pow(dReQ2n,2.)*dImQ3n*dImQ5n
-					+ 2.*dReQ4n*dReQ3n*dReQ2n*dImQ2n*dImQ5n + 2.*dReQ2n*dImQ4n*dImQ3n*dImQ2n*dImQ5n
-					- dReQ3n*dImQ4n*pow(dImQ2n,2.)*dImQ5n + dReQ4n*dImQ3n*pow(dImQ2n,2.)*dImQ5n;
- Double_t reQ8nQ4nstarQ2nstarQ2nstar = (dReQ8n*dReQ4n+dImQ8n*dImQ4n)*(pow(dReQ2n,2)-pow(dImQ2n,2)) 
-                                     + 2.*dReQ2n*dImQ2n*(dImQ8n*dReQ4n-dReQ8n*dImQ4n);
- // <5>_{5n,2n,1n|4n,4n}:
- Double_t reQ5nQ2nQ1nQ4nstarQ4nstar = dReQ1n*dReQ2n*pow(dReQ4n,2.)*dReQ5n - pow(dReQ4n,2.)*dReQ5n*dImQ1n*dImQ2n
-	                            + 2.*dReQ2n*dReQ4n*dReQ5n*dImQ1n*dImQ4n + 2.*dReQ1n*dReQ4n*dReQ5n*dImQ2n*dImQ4n
-				    - dReQ1n*dReQ2n*dReQ5n*pow(dImQ4n,2.) + dReQ5n*dImQ1n*dImQ2n*pow(dImQ4n,2.)
-				    - dReQ2n*pow(dReQ4n,2.)*dImQ1n*dImQ5n - dReQ1n*pow(dReQ4n,2.)*dImQ2n*dImQ5n
-				    + 2.*dReQ1n*dReQ2n*dReQ4n*dImQ4n*dImQ5n - 2.*dReQ4n*dImQ1n*dImQ2n*dImQ4n*dImQ5n
-				    + dReQ2n*dImQ1n*pow(dImQ4n,2.)*dImQ5n + dReQ1n*dImQ2n*pow(dImQ4n,2.)*dImQ5n;
- // <5>_{6n,1n|3n,2n,2n}:
- Double_t reQ6nQ1nQ3nstarQ2nstarQ2nstar = dReQ3n*dReQ1n*pow(dReQ2n,2.)*dReQ6n + pow(dReQ2n,2.)*dReQ6n*dImQ3n*dImQ1n 
-	                                - 2.*dReQ1n*dReQ2n*dReQ6n*dImQ3n*dImQ2n + 2.*dReQ3n*dReQ2n*dReQ6n*dImQ1n*dImQ2n 
-					- dReQ3n*dReQ1n*dReQ6n*pow(dImQ2n,2.) - dReQ6n*dImQ3n*dImQ1n*pow(dImQ2n,2.) 
-					+ dReQ1n*pow(dReQ2n,2.)*dImQ3n*dImQ6n - dReQ3n*pow(dReQ2n,2.)*dImQ1n*dImQ6n
-					+ 2.*dReQ3n*dReQ1n*dReQ2n*dImQ2n*dImQ6n + 2.*dReQ2n*dImQ3n*dImQ1n*dImQ2n*dImQ6n
-					- dReQ1n*dImQ3n*pow(dImQ2n,2.)*dImQ6n + dReQ3n*dImQ1n*pow(dImQ2n,2.)*dImQ6n;
-
- // <5>_{6n,3n|4n,4n,1n}:
- Double_t reQ6nQ3nQ4nstarQ4nstarQ1nstar = dReQ1n*dReQ3n*pow(dReQ4n,2.)*dReQ6n + pow(dReQ4n,2.)*dReQ6n*dImQ1n*dImQ3n 
-	                                - 2.*dReQ3n*dReQ4n*dReQ6n*dImQ1n*dImQ4n + 2.*dReQ1n*dReQ4n*dReQ6n*dImQ3n*dImQ4n 
-					- dReQ1n*dReQ3n*dReQ6n*pow(dImQ4n,2.) - dReQ6n*dImQ1n*dImQ3n*pow(dImQ4n,2.) 
-					+ dReQ3n*pow(dReQ4n,2.)*dImQ1n*dImQ6n - dReQ1n*pow(dReQ4n,2.)*dImQ3n*dImQ6n
-					+ 2.*dReQ1n*dReQ3n*dReQ4n*dImQ4n*dImQ6n + 2.*dReQ4n*dImQ1n*dImQ3n*dImQ4n*dImQ6n
-					- dReQ3n*dImQ1n*pow(dImQ4n,2.)*dImQ6n + dReQ1n*dImQ3n*pow(dImQ4n,2.)*dImQ6n;
-
- // five6n1n1n5n3n = 0.; // <5>_{6n,1n,1n|5n,3n} = <cos(n(6*phi1+1*phi2+1*phi3-5*phi4-3*phi5))>
- Double_t reQ6nQ1nQ1nQ5nstarQ3nstar = pow(dReQ1n,2.)*dReQ3n*dReQ5n*dReQ6n - dReQ3n*dReQ5n*dReQ6n*pow(dImQ1n,2.)
-	                            + 2.*dReQ1n*dReQ5n*dReQ6n*dImQ1n*dImQ3n + 2.*dReQ1n*dReQ3n*dReQ6n*dImQ1n*dImQ5n
-				    - pow(dReQ1n,2.)*dReQ6n*dImQ3n*dImQ5n + dReQ6n*pow(dImQ1n,2.)*dImQ3n*dImQ5n
-				    - 2.*dReQ1n*dReQ3n*dReQ5n*dImQ1n*dImQ6n + pow(dReQ1n,2.)*dReQ5n*dImQ3n*dImQ6n
-				    - dReQ5n*pow(dImQ1n,2.)*dImQ3n*dImQ6n + pow(dReQ1n,2.)*dReQ3n*dImQ5n*dImQ6n
-                                    - dReQ3n*pow(dImQ1n,2.)*dImQ5n*dImQ6n + 2.*dReQ1n*dImQ1n*dImQ3n*dImQ5n*dImQ6n;
-
- // <5>_{6n,3n|5n,2n,2n}:
- Double_t reQ6nQ3nQ5nstarQ2nstarQ2nstar = dReQ5n*dReQ3n*pow(dReQ2n,2.)*dReQ6n + pow(dReQ2n,2.)*dReQ6n*dImQ5n*dImQ3n 
-	                                - 2.*dReQ3n*dReQ2n*dReQ6n*dImQ5n*dImQ2n + 2.*dReQ5n*dReQ2n*dReQ6n*dImQ3n*dImQ2n 
-					- dReQ5n*dReQ3n*dReQ6n*pow(dImQ2n,2.) - dReQ6n*dImQ5n*dImQ3n*pow(dImQ2n,2.) 
-					+ dReQ3n*pow(dReQ2n,2.)*dImQ5n*dImQ6n - dReQ5n*pow(dReQ2n,2.)*dImQ3n*dImQ6n
-					+ 2.*dReQ5n*dReQ3n*dReQ2n*dImQ2n*dImQ6n + 2.*dReQ2n*dImQ5n*dImQ3n*dImQ2n*dImQ6n
-					- dReQ3n*dImQ5n*pow(dImQ2n,2.)*dImQ6n + dReQ5n*dImQ3n*pow(dImQ2n,2.)*dImQ6n;
-
- // <5>_{6n,5n|4n,4n,3n}:
- Double_t reQ6nQ5nQ4nstarQ4nstarQ3nstar = dReQ3n*dReQ5n*pow(dReQ4n,2.)*dReQ6n + pow(dReQ4n,2.)*dReQ6n*dImQ3n*dImQ5n 
-	                                - 2.*dReQ5n*dReQ4n*dReQ6n*dImQ3n*dImQ4n + 2.*dReQ3n*dReQ4n*dReQ6n*dImQ5n*dImQ4n 
-					- dReQ3n*dReQ5n*dReQ6n*pow(dImQ4n,2.) - dReQ6n*dImQ3n*dImQ5n*pow(dImQ4n,2.) 
-					+ dReQ5n*pow(dReQ4n,2.)*dImQ3n*dImQ6n - dReQ3n*pow(dReQ4n,2.)*dImQ5n*dImQ6n
-					+ 2.*dReQ3n*dReQ5n*dReQ4n*dImQ4n*dImQ6n + 2.*dReQ4n*dImQ3n*dImQ5n*dImQ4n*dImQ6n
-					- dReQ5n*dImQ3n*pow(dImQ4n,2.)*dImQ6n + dReQ3n*dImQ5n*pow(dImQ4n,2.)*dImQ6n;
- Double_t reQ11nQ4nstarQ4nstarQ3nstar = (dReQ11n*dReQ3n+dImQ11n*dImQ3n)*(pow(dReQ4n,2)-pow(dImQ4n,2)) 
-                                      + 2.*dReQ4n*dImQ4n*(dImQ11n*dReQ3n-dReQ11n*dImQ3n);
-
- // <5>_{6n,3n,1n|5n,5n}:
- Double_t reQ6nQ3nQ1nQ5nstarQ5nstar = dReQ1n*dReQ3n*pow(dReQ5n,2.)*dReQ6n - pow(dReQ5n,2.)*dReQ6n*dImQ1n*dImQ3n
-	                            + 2.*dReQ3n*dReQ5n*dReQ6n*dImQ1n*dImQ5n + 2.*dReQ1n*dReQ5n*dReQ6n*dImQ3n*dImQ5n
-				    - dReQ1n*dReQ3n*dReQ6n*pow(dImQ5n,2.) + dReQ6n*dImQ1n*dImQ3n*pow(dImQ5n,2.)
-				    - dReQ3n*pow(dReQ5n,2.)*dImQ1n*dImQ6n - dReQ1n*pow(dReQ5n,2.)*dImQ3n*dImQ6n
-				    + 2.*dReQ1n*dReQ3n*dReQ5n*dImQ5n*dImQ6n - 2.*dReQ5n*dImQ1n*dImQ3n*dImQ5n*dImQ6n
-				    + dReQ3n*dImQ1n*pow(dImQ5n,2.)*dImQ6n + dReQ1n*dImQ3n*pow(dImQ5n,2.)*dImQ6n;
-
- // <5>_{6n,6n|5n,4n,3n}:
- Double_t reQ6nQ6nQ5nstarQ4nstarQ3nstar = dReQ3n*dReQ4n*dReQ5n*pow(dReQ6n,2.) - dReQ5n*pow(dReQ6n,2.)*dImQ3n*dImQ4n
-	                                - dReQ4n*pow(dReQ6n,2.)*dImQ3n*dImQ5n - dReQ3n*pow(dReQ6n,2.)*dImQ4n*dImQ5n
-					+ 2.*dReQ4n*dReQ5n*dReQ6n*dImQ3n*dImQ6n + 2.*dReQ3n*dReQ5n*dReQ6n*dImQ4n*dImQ6n
-					+ 2.*dReQ3n*dReQ4n*dReQ6n*dImQ5n*dImQ6n - 2.*dReQ6n*dImQ3n*dImQ4n*dImQ5n*dImQ6n
-					- dReQ3n*dReQ4n*dReQ5n*pow(dImQ6n,2.) + dReQ5n*dImQ3n*dImQ4n*pow(dImQ6n,2.)
-					+ dReQ4n*dImQ3n*dImQ5n*pow(dImQ6n,2.) + dReQ3n*dImQ4n*dImQ5n*pow(dImQ6n,2.);
-
-
- Double_t reQ8nQ4nQ6nstarQ6nstar = dImQ4n*pow(dImQ6n,2.)*dImQ8n+2.*dImQ6n*dImQ8n*dReQ4n*dReQ6n
-                                 - dImQ4n*dImQ8n*pow(dReQ6n,2.)-pow(dImQ6n,2.)*dReQ4n*dReQ8n 
-                                 + 2.*dImQ4n*dImQ6n*dReQ6n*dReQ8n+dReQ4n*pow(dReQ6n,2.)*dReQ8n;
-
-
- Double_t reQ9nQ3nQ6nstarQ6nstar = dImQ3n*pow(dImQ6n,2.)*dImQ9n+2.*dImQ6n*dImQ9n*dReQ3n*dReQ6n
-                                 - dImQ3n*dImQ9n*pow(dReQ6n,2.)-pow(dImQ6n,2.)*dReQ3n*dReQ9n 
-                                 + 2.*dImQ3n*dImQ6n*dReQ6n*dReQ9n+dReQ3n*pow(dReQ6n,2.)*dReQ9n;
-
-
- Double_t reQ12nQ5nstarQ4nstarQ3nstar = dReQ3n*dReQ5n*dReQ4n*dReQ12n-dReQ4n*dReQ12n*dImQ3n*dImQ5n 
-	                              - dReQ5n*dReQ12n*dImQ3n*dImQ4n-dReQ3n*dReQ12n*dImQ5n*dImQ4n 
-				      + dReQ5n*dReQ4n*dImQ3n*dImQ12n+dReQ3n*dReQ4n*dImQ5n*dImQ12n 
-				      + dReQ3n*dReQ5n*dImQ4n*dImQ12n-dImQ3n*dImQ5n*dImQ4n*dImQ12n;
- Double_t reQ12nQ9nstarQ3nstar = dReQ12n*dReQ9n*dReQ3n-dReQ12n*dImQ9n*dImQ3n+dImQ12n*dReQ9n*dImQ3n
-                               + dImQ12n*dImQ9n*dReQ3n;
- Double_t reQ12nQ8nstarQ4nstar = dReQ12n*dReQ8n*dReQ4n-dReQ12n*dImQ8n*dImQ4n+dImQ12n*dReQ8n*dImQ4n
-                               + dImQ12n*dImQ8n*dReQ4n;
-
-   
-  five4n3n3n2n2n = ((pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 * (pow(dReQ2n,2.)*dReQ4n-pow(dImQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n)
-                 - ((dReQ7n*dReQ3n+dImQ7n*dImQ3n)*(pow(dReQ2n,2.)-pow(dImQ2n,2.)) 
-                 + 2.*dReQ2n*dImQ2n*(dImQ7n*dReQ3n-dReQ7n*dImQ3n))
-                 - ((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 - 2.*(dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)
-                 - 2.*(dImQ2n*dImQ3n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ2n*dReQ3n 
-                 + dImQ3n*dImQ5n*dReQ2n*dReQ4n-dImQ2n*dImQ5n*dReQ3n*dReQ4n
-                 - dImQ3n*dImQ4n*dReQ2n*dReQ5n+dImQ2n*dImQ4n*dReQ3n*dReQ5n 
-                 + dImQ2n*dImQ3n*dReQ4n*dReQ5n+dReQ2n*dReQ3n*dReQ4n*dReQ5n)
-                 + 2.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 + 1.*(dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ4n*dImQ3n+dImQ7n*dImQ4n*dReQ3n)
-                 + 3.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 + 2.*(dReQ7n*dReQ5n*dReQ2n-dReQ7n*dImQ5n*dImQ2n+dImQ7n*dReQ5n*dImQ2n+dImQ7n*dImQ5n*dReQ2n)
-                 + 2.*(dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ4n*dImQ3n+dImQ7n*dImQ4n*dReQ3n)
-                 + 6.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 6.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 - (dMult-6.)*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 4.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n2n4n1n1n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 * (pow(dReQ1n,2.)*dReQ2n-pow(dImQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n)
-                 - reQ6nQ4nstarQ1nstarQ1nstar
-                 - reQ4nQ2nstarQ1nstarQ1nstar
-                 - 2.*reQ4nQ1nQ3nstarQ2nstar
-                 - 2.*reQ5nQ1nQ4nstarQ2nstar
-                 + 2.*reQ3nQ2nstarQ1nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + 3.*reQ4nQ2nstarQ2nstar
-                 + 2.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ6nQ4nstarQ2nstar
-                 + 6.*reQ4nQ3nstarQ1nstar
-                 + 6.*reQ5nQ4nstarQ1nstar
-                 - (dMult-6.)*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-4.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five4n3n4n2n1n = (reQ4nQ3nQ4nstarQ2nstarQ1nstar
-                 - reQ5nQ2nQ4nstarQ3nstar
-                 - reQ6nQ1nQ4nstarQ3nstar
-                 - reQ4nQ1nQ3nstarQ2nstar
-                 - reQ7nQ4nstarQ2nstarQ1nstar
-                 - reQ4nQ2nstarQ1nstarQ1nstar
-                 - reQ4nQ2nQ3nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + 2.*reQ7nQ4nstarQ3nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ6nQ3nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ3nQ2nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + 2.*reQ4nQ2nstarQ2nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ4nQ2nstarQ2nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five5n1n3n2n1n = ((pow(dImQ1n,2.)+pow(dReQ1n,2.))*(dImQ3n*dImQ5n*dReQ2n+dImQ2n*dImQ5n*dReQ3n 
-                 - dImQ2n*dImQ3n*dReQ5n+dReQ2n*dReQ3n*dReQ5n)
-                 - (dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                 - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                 + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                 + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n)
-                 - (dImQ1n*dImQ2n*dImQ4n*dImQ5n+dImQ4n*dImQ5n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ5n*dReQ1n*dReQ4n-dImQ1n*dImQ5n*dReQ2n*dReQ4n
-                 - dImQ2n*dImQ4n*dReQ1n*dReQ5n+dImQ1n*dImQ4n*dReQ2n*dReQ5n 
-                 + dImQ1n*dImQ2n*dReQ4n*dReQ5n+dReQ1n*dReQ2n*dReQ4n*dReQ5n)
-                 - (dImQ1n*pow(dImQ3n,2.)*dImQ5n+2.*dImQ3n*dImQ5n*dReQ1n*dReQ3n
-                 - dImQ1n*dImQ5n*pow(dReQ3n,2.)-pow(dImQ3n,2.)*dReQ1n*dReQ5n 
-                 + 2.*dImQ1n*dImQ3n*dReQ3n*dReQ5n+dReQ1n*pow(dReQ3n,2.)*dReQ5n)
-                 - (dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)
-                 - (-pow(dImQ1n,2.)*dImQ3n*dImQ5n+dImQ3n*dImQ5n*pow(dReQ1n,2.)
-                 + 2.*dImQ1n*dImQ5n*dReQ1n*dReQ3n-2.*dImQ1n*dImQ3n*dReQ1n*dReQ5n 
-                 - pow(dImQ1n,2.)*dReQ3n*dReQ5n+pow(dReQ1n,2.)*dReQ3n*dReQ5n)
-                 - (-pow(dImQ2n,2.)*dImQ1n*dImQ5n+dImQ1n*dImQ5n*pow(dReQ2n,2.)
-                 + 2.*dImQ2n*dImQ5n*dReQ2n*dReQ1n-2.*dImQ2n*dImQ1n*dReQ2n*dReQ5n 
-                 - pow(dImQ2n,2.)*dReQ1n*dReQ5n+pow(dReQ2n,2.)*dReQ1n*dReQ5n)
-                 + 3.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-                 + dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n
-                 + pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n
-                 + 4.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 - (dMult-7.)*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + 4.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n
-                 + 6.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 3.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))+(dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))  
-                 - 4.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+(dMult-10.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-10.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))+2.*(dMult-7.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*dMult*(dMult-12.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)); 
-  // to be polished:
-  five5n2n5n1n1n = ((pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 * (pow(dReQ1n,2.)*dReQ2n-pow(dImQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n)
-                 - reQ7nQ5nstarQ1nstarQ1nstar
-                 - reQ5nQ3nstarQ1nstarQ1nstar
-                 - 2.*reQ5nQ1nQ4nstarQ2nstar
-                 - 2.*reQ6nQ1nQ5nstarQ2nstar
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ6nQ4nstarQ2nstar
-                 + 2.*reQ7nQ6nstarQ1nstar
-                 + 2.*reQ7nQ5nstarQ2nstar
-                 + 6.*reQ5nQ4nstarQ1nstar
-                 + 6.*reQ6nQ5nstarQ1nstar
-                 - (dMult-6.)*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))-4.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-4.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n2n4n2n1n = (reQ5nQ2nQ4nstarQ2nstarQ1nstar
-                 - reQ5nQ2nQ4nstarQ3nstar
-                 - reQ6nQ1nQ5nstarQ2nstar
-                 - reQ5nQ2nstarQ2nstarQ1nstar
-                 - reQ7nQ4nstarQ2nstarQ1nstar
-                 - reQ4nQ1nQ3nstarQ2nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ7nQ5nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ3nQ2nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + 2.*reQ4nQ2nstarQ2nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ4nQ2nstarQ2nstar
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished: 
-  five5n3n4n3n1n = (reQ5nQ3nQ4nstarQ3nstarQ1nstar
-                 - reQ5nQ3nQ4nstarQ4nstar
-                 - reQ7nQ1nQ5nstarQ3nstar
-                 - reQ5nQ3nstarQ1nstarQ1nstar
-                 - reQ8nQ4nstarQ3nstarQ1nstar
-                 - reQ4nQ1nQ3nstarQ2nstar
-                 - reQ5nQ2nQ4nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ8nQ5nstarQ3nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ8nQ4nstarQ4nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ8nQ7nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ7nQ4nstarQ3nstar
-                 + reQ4nQ2nstarQ2nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished: 
-  five5n4n4n3n2n = (reQ5nQ4nQ4nstarQ3nstarQ2nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 - reQ7nQ2nQ5nstarQ4nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - reQ9nQ4nstarQ3nstarQ2nstar
-                 - reQ4nQ1nQ3nstarQ2nstar
-                 - reQ5nQ2nQ4nstarQ3nstar
-                 + reQ4nQ2nstarQ2nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + 2.*reQ9nQ5nstarQ4nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ4nQ2nstarQ2nstar
-                 + reQ9nQ7nstarQ2nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + reQ4nQ2nstarQ2nstar
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ7nQ4nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished: 
-  five5n3n5n2n1n = (reQ5nQ3nQ5nstarQ2nstarQ1nstar
-                 - reQ6nQ2nQ5nstarQ3nstar
-                 - reQ7nQ1nQ5nstarQ3nstar
-                 - reQ5nQ1nQ3nstarQ3nstar
-                 - reQ8nQ5nstarQ2nstarQ1nstar
-                 - reQ5nQ2nstarQ2nstarQ1nstar
-                 - reQ5nQ2nQ4nstarQ3nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ8nQ5nstarQ3nstar
-                 + reQ6nQ3nstarQ3nstar
-                 + reQ8nQ6nstarQ2nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ8nQ7nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ3nQ2nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + 2.*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ7nQ5nstarQ2nstar
-                 + reQ4nQ2nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n4n5n2n2n = ((pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 * (pow(dReQ2n,2.)*dReQ4n-pow(dImQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n)
-                 - reQ9nQ5nstarQ2nstarQ2nstar
-                 - reQ5nQ2nstarQ2nstarQ1nstar
-                 - 2.*reQ5nQ2nQ4nstarQ3nstar
-                 - 2.*reQ7nQ2nQ5nstarQ4nstar
-                 + 2.*reQ3nQ2nstarQ1nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + 2.*reQ7nQ4nstarQ3nstar
-                 + 2.*reQ9nQ7nstarQ2nstar
-                 + 2.*reQ9nQ5nstarQ4nstar
-                 + 6.*reQ5nQ3nstarQ2nstar
-                 + 6.*reQ7nQ5nstarQ2nstar
-                 - (dMult-6.)*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))-4.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-4.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n4n5n3n1n = (reQ5nQ4nQ5nstarQ3nstarQ1nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 - reQ8nQ1nQ5nstarQ4nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - reQ9nQ5nstarQ3nstarQ1nstar
-                 - reQ5nQ3nstarQ1nstarQ1nstar
-                 - reQ5nQ3nQ4nstarQ4nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + 2.*reQ9nQ5nstarQ4nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + reQ8nQ4nstarQ4nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ9nQ8nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + 2.*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ8nQ5nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ5nQ3nstarQ2nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)); 
-  five6n1n3n3n1n = ((pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 * (pow(dReQ3n,2.)*dReQ6n-pow(dImQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n)
-                 - 2.*(dImQ1n*dImQ3n*dImQ4n*dImQ6n+dImQ4n*dImQ6n*dReQ1n*dReQ3n 
-                 + dImQ3n*dImQ6n*dReQ1n*dReQ4n-dImQ1n*dImQ6n*dReQ3n*dReQ4n
-                 - dImQ3n*dImQ4n*dReQ1n*dReQ6n+dImQ1n*dImQ4n*dReQ3n*dReQ6n 
-                 + dImQ1n*dImQ3n*dReQ4n*dReQ6n+dReQ1n*dReQ3n*dReQ4n*dReQ6n)   
-                 - 2.*(dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                 - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                 + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                 + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n)
-                 - (-pow(dImQ3n,2.)*dImQ1n*dImQ7n+dImQ1n*dImQ7n*pow(dReQ3n,2.)
-                 + 2.*dImQ3n*dImQ7n*dReQ3n*dReQ1n-2.*dImQ3n*dImQ1n*dReQ3n*dReQ7n 
-                 - pow(dImQ3n,2.)*dReQ1n*dReQ7n+pow(dReQ3n,2.)*dReQ1n*dReQ7n)
-                 - ((pow(dReQ3n,2.)-pow(dImQ3n,2.))*(dReQ5n*dReQ1n-dImQ5n*dImQ1n) 
-                 + 2.*dReQ3n*dImQ3n*(dReQ5n*dImQ1n+dImQ5n*dReQ1n))
-                 + 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + (dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ6n*dImQ1n+dImQ7n*dImQ6n*dReQ1n)
-                 + 2.*(dReQ7n*dReQ3n*dReQ4n-dReQ7n*dImQ3n*dImQ4n+dImQ7n*dReQ3n*dImQ4n+dImQ7n*dImQ3n*dReQ4n)
-                 + 2.*(dReQ6n*(dReQ4n*dReQ2n-dImQ4n*dImQ2n)+dImQ6n*(dReQ4n*dImQ2n+dImQ4n*dReQ2n))
-                 + 3.*(dReQ6n*(dReQ5n*dReQ1n-dImQ5n*dImQ1n)+dImQ6n*(dReQ5n*dImQ1n+dImQ5n*dReQ1n))
-                 + 4.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 2.*(dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ6n*dImQ1n+dImQ7n*dImQ6n*dReQ1n)
-                 + 6.*(dReQ4n*dReQ3n*dReQ1n-dReQ4n*dImQ3n*dImQ1n+dImQ4n*dReQ3n*dImQ1n+dImQ4n*dImQ3n*dReQ1n)
-                 + 2.*(dReQ5n*dReQ3n*dReQ2n-dReQ5n*dImQ3n*dImQ2n+dImQ5n*dReQ3n*dImQ2n+dImQ5n*dImQ3n*dReQ2n)
-                 - (dMult-6.)*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 - 4.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 4.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))+(dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n2n3n3n2n = ((pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 * (pow(dReQ3n,2.)*dReQ6n-pow(dImQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n)
-                 - 2.*(dImQ2n*dImQ3n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ2n*dReQ3n 
-                 + dImQ3n*dImQ6n*dReQ2n*dReQ5n-dImQ2n*dImQ6n*dReQ3n*dReQ5n
-                 - dImQ3n*dImQ5n*dReQ2n*dReQ6n+dImQ2n*dImQ5n*dReQ3n*dReQ6n 
-                 + dImQ2n*dImQ3n*dReQ5n*dReQ6n+dReQ2n*dReQ3n*dReQ5n*dReQ6n) 
-                 - 2.*(dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                 - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                 + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                 + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n)
-                 - (-pow(dImQ3n,2.)*dImQ2n*dImQ8n+dImQ2n*dImQ8n*pow(dReQ3n,2.)
-                 + 2.*dImQ3n*dImQ8n*dReQ3n*dReQ2n-2.*dImQ3n*dImQ2n*dReQ3n*dReQ8n 
-                 - pow(dImQ3n,2.)*dReQ2n*dReQ8n+pow(dReQ3n,2.)*dReQ2n*dReQ8n)
-                 - ((pow(dReQ3n,2.)-pow(dImQ3n,2.))*(dReQ4n*dReQ2n-dImQ4n*dImQ2n) 
-                 + 2.*dReQ3n*dImQ3n*(dReQ4n*dImQ2n+dImQ4n*dReQ2n))
-                 + 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + (dReQ8n*dReQ6n*dReQ2n-dReQ8n*dImQ6n*dImQ2n+dImQ8n*dReQ6n*dImQ2n+dImQ8n*dImQ6n*dReQ2n)
-                 + 2.*(dReQ8n*dReQ3n*dReQ5n-dReQ8n*dImQ3n*dImQ5n+dImQ8n*dReQ3n*dImQ5n+dImQ8n*dImQ3n*dReQ5n)
-                 + 2.*(dReQ6n*(dReQ5n*dReQ1n-dImQ5n*dImQ1n)+dImQ6n*(dReQ5n*dImQ1n+dImQ5n*dReQ1n))
-                 + 3.*(dReQ6n*(dReQ4n*dReQ2n-dImQ4n*dImQ2n)+dImQ6n*(dReQ4n*dImQ2n+dImQ4n*dReQ2n))
-                 + 4.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 2.*(dReQ8n*dReQ6n*dReQ2n-dReQ8n*dImQ6n*dImQ2n+dImQ8n*dReQ6n*dImQ2n+dImQ8n*dImQ6n*dReQ2n)
-                 + 6.*(dReQ5n*dReQ3n*dReQ2n-dReQ5n*dImQ3n*dImQ2n+dImQ5n*dReQ3n*dImQ2n+dImQ5n*dImQ3n*dReQ2n)
-                 + 2.*(dReQ4n*dReQ3n*dReQ1n-dReQ4n*dImQ3n*dImQ1n+dImQ4n*dReQ3n*dImQ1n+dImQ4n*dImQ3n*dReQ1n)
-                 - (dMult-6.)*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 - 4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 4.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+(dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n1n4n2n1n = (reQ6nQ1nQ4nstarQ2nstarQ1nstar
-                 - reQ6nQ1nQ4nstarQ3nstar
-                 - reQ6nQ1nQ5nstarQ2nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ7nQ4nstarQ2nstarQ1nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - reQ6nQ4nstarQ1nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ7nQ6nstarQ1nstar
-                 + reQ6nQ3nstarQ3nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 - (dMult-6.)*reQ6nQ4nstarQ2nstar
-                 + 3.*reQ3nQ2nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)); 
-  // to be polished: 
-  five6n3n4n3n2n = (reQ6nQ3nQ4nstarQ3nstarQ2nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 - reQ7nQ2nQ6nstarQ3nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ9nQ4nstarQ3nstarQ2nstar
-                 - reQ4nQ2nQ3nstarQ3nstar
-                 - reQ6nQ1nQ4nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + 3.*reQ6nQ3nstarQ3nstar
-                 + 2.*reQ9nQ6nstarQ3nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ9nQ7nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ6nQ4nstarQ2nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ7nQ4nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n4n4n3n3n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 * (pow(dReQ3n,2.)*dReQ6n-pow(dImQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n)
-                 - ((dReQ10n*dReQ4n+dImQ10n*dImQ4n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                 + 2.*dReQ3n*dImQ3n*(dImQ10n*dReQ4n-dReQ10n*dImQ4n))
-                 - ((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-                 + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n)
-                 - 2.*(dImQ1n*dImQ3n*dImQ4n*dImQ6n+dImQ4n*dImQ6n*dReQ1n*dReQ3n 
-                 + dImQ3n*dImQ6n*dReQ1n*dReQ4n-dImQ1n*dImQ6n*dReQ3n*dReQ4n
-                 - dImQ3n*dImQ4n*dReQ1n*dReQ6n+dImQ1n*dImQ4n*dReQ3n*dReQ6n 
-                 + dImQ1n*dImQ3n*dReQ4n*dReQ6n+dReQ1n*dReQ3n*dReQ4n*dReQ6n)
-                 - 2.*(dImQ3n*dImQ4n*dImQ6n*dImQ7n+dImQ6n*dImQ7n*dReQ3n*dReQ4n 
-                 + dImQ4n*dImQ7n*dReQ3n*dReQ6n-dImQ3n*dImQ7n*dReQ4n*dReQ6n
-                 - dImQ4n*dImQ6n*dReQ3n*dReQ7n+dImQ3n*dImQ6n*dReQ4n*dReQ7n 
-                 + dImQ3n*dImQ4n*dReQ6n*dReQ7n+dReQ3n*dReQ4n*dReQ6n*dReQ7n)
-                 + 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 1.*(dReQ10n*dReQ6n*dReQ4n-dReQ10n*dImQ6n*dImQ4n+dImQ10n*dReQ6n*dImQ4n+dImQ10n*dImQ6n*dReQ4n)
-                 + 3.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 + 2.*(dReQ7n*dReQ6n*dReQ1n-dReQ7n*dImQ6n*dImQ1n+dImQ7n*dReQ6n*dImQ1n+dImQ7n*dImQ6n*dReQ1n)
-                 + 2.*(dReQ10n*dReQ7n*dReQ3n-dReQ10n*dImQ7n*dImQ3n+dImQ10n*dReQ7n*dImQ3n+dImQ10n*dImQ7n*dReQ3n)
-                 + 2.*(dReQ10n*dReQ6n*dReQ4n-dReQ10n*dImQ6n*dImQ4n+dImQ10n*dReQ6n*dImQ4n+dImQ10n*dImQ6n*dReQ4n)
-                 + 6.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 6.*(dReQ7n*dReQ4n*dReQ3n-dReQ7n*dImQ4n*dImQ3n+dImQ7n*dReQ4n*dImQ3n+dImQ7n*dImQ4n*dReQ3n)
-                 - (dMult-6.)*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))-4.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n2n5n2n1n = (reQ6nQ2nQ5nstarQ2nstarQ1nstar
-                 - reQ6nQ2nQ5nstarQ3nstar
-                 - reQ7nQ1nQ6nstarQ2nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ8nQ5nstarQ2nstarQ1nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - reQ6nQ1nQ5nstarQ2nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + reQ8nQ6nstarQ2nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + 2.*reQ8nQ6nstarQ2nstar
-                 + reQ6nQ3nstarQ3nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + reQ8nQ7nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (dMult-6.)*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ3nQ2nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 + 2.*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ7nQ5nstarQ2nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ5nQ3nstarQ2nstar
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n3n5n3n1n = (reQ6nQ3nQ5nstarQ3nstarQ1nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 - reQ8nQ1nQ6nstarQ3nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ9nQ5nstarQ3nstarQ1nstar
-                 - reQ5nQ1nQ3nstarQ3nstar
-                 - reQ6nQ2nQ5nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + 3.*reQ6nQ3nstarQ3nstar
-                 + 2.*reQ9nQ6nstarQ3nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + reQ8nQ6nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ9nQ8nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + 2.*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ8nQ5nstarQ3nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n4n5n4n1n = (reQ6nQ4nQ5nstarQ4nstarQ1nstar
-                 - reQ6nQ4nQ5nstarQ5nstar
-                 - reQ9nQ1nQ6nstarQ4nstar
-                 - reQ6nQ4nstarQ1nstarQ1nstar
-                 - reQ10nQ5nstarQ4nstarQ1nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ10nQ6nstarQ4nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + 2.*reQ10nQ6nstarQ4nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ10nQ5nstarQ5nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ10nQ9nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + 2.*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ9nQ5nstarQ4nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ5nQ4nstarQ1nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n5n5n3n3n = ((pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 * (pow(dReQ3n,2.)*dReQ6n-pow(dImQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n)
-                 - ((dReQ11n*dReQ5n+dImQ11n*dImQ5n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                 + 2.*dReQ3n*dImQ3n*(dImQ11n*dReQ5n-dReQ11n*dImQ5n))
-                 - (dImQ1n*pow(dImQ3n,2.)*dImQ5n+2.*dImQ3n*dImQ5n*dReQ1n*dReQ3n
-                 - dImQ1n*dImQ5n*pow(dReQ3n,2.)-pow(dImQ3n,2.)*dReQ1n*dReQ5n 
-                 + 2.*dImQ1n*dImQ3n*dReQ3n*dReQ5n+dReQ1n*pow(dReQ3n,2.)*dReQ5n)
-                 - 2.*(dImQ2n*dImQ3n*dImQ5n*dImQ6n+dImQ5n*dImQ6n*dReQ2n*dReQ3n 
-                 + dImQ3n*dImQ6n*dReQ2n*dReQ5n-dImQ2n*dImQ6n*dReQ3n*dReQ5n
-                 - dImQ3n*dImQ5n*dReQ2n*dReQ6n+dImQ2n*dImQ5n*dReQ3n*dReQ6n 
-                 + dImQ2n*dImQ3n*dReQ5n*dReQ6n+dReQ2n*dReQ3n*dReQ5n*dReQ6n)
-                 - 2.*(dImQ3n*dImQ5n*dImQ6n*dImQ8n+dImQ6n*dImQ8n*dReQ3n*dReQ5n 
-                 + dImQ5n*dImQ8n*dReQ3n*dReQ6n-dImQ3n*dImQ8n*dReQ5n*dReQ6n
-                 - dImQ5n*dImQ6n*dReQ3n*dReQ8n+dImQ3n*dImQ6n*dReQ5n*dReQ8n 
-                 + dImQ3n*dImQ5n*dReQ6n*dReQ8n+dReQ3n*dReQ5n*dReQ6n*dReQ8n)
-                 + 2.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 1.*(dReQ11n*dReQ6n*dReQ5n-dReQ11n*dImQ6n*dImQ5n+dImQ11n*dReQ6n*dImQ5n+dImQ11n*dImQ6n*dReQ5n)
-                 + 3.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-                 + 2.*(dReQ8n*dReQ6n*dReQ2n-dReQ8n*dImQ6n*dImQ2n+dImQ8n*dReQ6n*dImQ2n+dImQ8n*dImQ6n*dReQ2n)
-                 + 2.*(dReQ11n*dReQ8n*dReQ3n-dReQ11n*dImQ8n*dImQ3n+dImQ11n*dReQ8n*dImQ3n+dImQ11n*dImQ8n*dReQ3n)
-                 + 2.*(dReQ11n*dReQ6n*dReQ5n-dReQ11n*dImQ6n*dImQ5n+dImQ11n*dReQ6n*dImQ5n+dImQ11n*dImQ6n*dReQ5n)
-                 + 6.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + 6.*(dReQ8n*dReQ5n*dReQ3n-dReQ8n*dImQ5n*dImQ3n+dImQ8n*dReQ5n*dImQ3n+dImQ8n*dImQ5n*dReQ3n)
-                 - (dMult-6.)*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.))-4.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-4.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n2n6n1n1n = ((pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 * (pow(dReQ1n,2.)*dReQ2n-pow(dImQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n)
-                 - reQ8nQ6nstarQ1nstarQ1nstar
-                 - reQ6nQ4nstarQ1nstarQ1nstar
-                 - 2.*reQ6nQ1nQ5nstarQ2nstar
-                 - 2.*reQ7nQ1nQ6nstarQ2nstar
-                 + 2.*reQ5nQ4nstarQ1nstar
-                 + reQ8nQ6nstarQ2nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + 2.*reQ7nQ5nstarQ2nstar
-                 + 2.*reQ8nQ7nstarQ1nstar
-                 + 2.*reQ8nQ6nstarQ2nstar
-                 + 6.*reQ6nQ5nstarQ1nstar
-                 + 6.*reQ7nQ6nstarQ1nstar
-                 - (dMult-6.)*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))-4.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-4.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n3n6n2n1n = (reQ6nQ3nQ6nstarQ2nstarQ1nstar
-                 - reQ7nQ2nQ6nstarQ3nstar
-                 - reQ8nQ1nQ6nstarQ3nstar
-                 - reQ6nQ1nQ4nstarQ3nstar
-                 - reQ9nQ6nstarQ2nstarQ1nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ6nQ2nQ5nstarQ3nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + 3.*reQ6nQ3nstarQ3nstar
-                 + 2.*reQ9nQ6nstarQ3nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ9nQ7nstarQ2nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ9nQ8nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (dMult-6.)*reQ3nQ2nstarQ1nstar
-                 + 3.*reQ7nQ6nstarQ1nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + 2.*reQ6nQ4nstarQ2nstar
-                 + 3.*reQ8nQ6nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ6nQ4nstarQ2nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n4n6n2n2n = (-(pow(dImQ6n,2.)+pow(dReQ6n,2.))
-                 * (-2.*dImQ2n*dImQ4n*dReQ2n+pow(dImQ2n,2.)*dReQ4n-pow(dReQ2n,2.)*dReQ4n)
-                 - (-pow(dImQ2n,2.)*dImQ6n*dImQ10n+dImQ6n*dImQ10n*pow(dReQ2n,2.)
-                 + 2.*dImQ2n*dImQ10n*dReQ2n*dReQ6n-2.*dImQ2n*dImQ6n*dReQ2n*dReQ10n 
-                 - pow(dImQ2n,2.)*dReQ6n*dReQ10n+pow(dReQ2n,2.)*dReQ6n*dReQ10n)
-                 - 2.*(dImQ2n*dImQ4n*dImQ6n*dImQ8n+dImQ6n*dImQ8n*dReQ2n*dReQ4n 
-                 + dImQ4n*dImQ8n*dReQ2n*dReQ6n-dImQ2n*dImQ8n*dReQ4n*dReQ6n
-                 - dImQ4n*dImQ6n*dReQ2n*dReQ8n+dImQ2n*dImQ6n*dReQ4n*dReQ8n 
-                 + dImQ2n*dImQ4n*dReQ6n*dReQ8n+dReQ2n*dReQ4n*dReQ6n*dReQ8n)
-                 - (dReQ6n*pow(dReQ2n,3.)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2.)
-                 + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2.)-dImQ6n*pow(dImQ2n,3.))
-                 - 2.*((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ6n*dReQ2n-dImQ6n*dImQ2n) 
-                 + 2.*dReQ4n*dImQ4n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + 2.*(dReQ10n*dReQ8n*dReQ2n-dReQ10n*dImQ8n*dImQ2n+dImQ10n*dReQ8n*dImQ2n+dImQ10n*dImQ8n*dReQ2n)
-                 + 3.*(dReQ10n*dReQ4n*dReQ6n-dReQ10n*dImQ4n*dImQ6n+dImQ10n*dReQ4n*dImQ6n+dImQ10n*dImQ4n*dReQ6n)
-                 + 6.*(dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + 2.*(pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-                 + 9.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 - (dMult-8.)*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))-4.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))+(dMult-12.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-9.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-2.*dMult*(dMult-12.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n4n6n3n1n = (reQ6nQ4nQ6nstarQ3nstarQ1nstar
-                 - reQ7nQ3nQ6nstarQ4nstar
-                 - reQ9nQ1nQ6nstarQ4nstar
-                 - reQ6nQ1nQ4nstarQ3nstar
-                 - reQ10nQ6nstarQ3nstarQ1nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ10nQ6nstarQ4nstar
-                 + 3.*reQ6nQ4nstarQ2nstar
-                 + 2.*reQ10nQ6nstarQ4nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ10nQ7nstarQ3nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ10nQ9nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ7nQ6nstarQ1nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + 2.*reQ6nQ3nstarQ3nstar
-                 + 3.*reQ9nQ6nstarQ3nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ6nQ3nstarQ3nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n5n5n4n2n = (reQ6nQ5nQ5nstarQ4nstarQ2nstar
-                 - reQ7nQ4nQ6nstarQ5nstar
-                 - reQ9nQ2nQ6nstarQ5nstar
-                 - reQ6nQ1nQ5nstarQ2nstar
-                 - reQ11nQ5nstarQ4nstarQ2nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ11nQ6nstarQ5nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ11nQ6nstarQ5nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ11nQ7nstarQ4nstar
-                 + reQ9nQ6nstarQ3nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ11nQ9nstarQ2nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ6nQ4nstarQ2nstar
-                 + 3.*reQ7nQ5nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + 2.*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ9nQ5nstarQ4nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n5n6n3n2n = (reQ6nQ5nQ6nstarQ3nstarQ2nstar
-                 - reQ8nQ3nQ6nstarQ5nstar
-                 - reQ9nQ2nQ6nstarQ5nstar
-                 - reQ6nQ2nQ5nstarQ3nstar
-                 - reQ11nQ6nstarQ3nstarQ2nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar
-                 - reQ6nQ3nQ5nstarQ4nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + reQ11nQ6nstarQ5nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ11nQ6nstarQ5nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ11nQ8nstarQ3nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + reQ11nQ9nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ8nQ6nstarQ2nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + 2.*reQ6nQ3nstarQ3nstar
-                 + 3.*reQ9nQ6nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ6nQ3nstarQ3nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n5n6n4n1n = (reQ6nQ5nQ6nstarQ4nstarQ1nstar
-                 - reQ7nQ4nQ6nstarQ5nstar
-                 - reQ10nQ1nQ6nstarQ5nstar
-                 - reQ6nQ1nQ5nstarQ2nstar
-                 - reQ11nQ6nstarQ4nstarQ1nstar
-                 - reQ6nQ4nstarQ1nstarQ1nstar
-                 - reQ6nQ4nQ5nstarQ5nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ11nQ6nstarQ5nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ11nQ6nstarQ5nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ11nQ7nstarQ4nstar
-                 + reQ10nQ5nstarQ5nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ11nQ10nstarQ1nstar
-                 + reQ2nQ1nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ7nQ6nstarQ1nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + 2.*reQ6nQ4nstarQ2nstar
-                 + 3.*reQ10nQ6nstarQ4nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ6nQ4nstarQ2nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  //  f2) Two distinct harmonics (9):
-  five2n1n1n1n1n = ((dReQ2n*dReQ1n-dImQ2n*dImQ1n)*(pow(dReQ1n,3)-3.*dReQ1n*pow(dImQ1n,2))
-                 + (dReQ2n*dImQ1n+dReQ1n*dImQ2n)*(3.*dImQ1n*pow(dReQ1n,2)-pow(dImQ1n,3))
-                 - (dReQ3n*pow(dReQ1n,3)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2)
-                 + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2)-dImQ3n*pow(dImQ1n,3))
-                 + 5.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 - 3.*(dMult-5.)*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 3.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))     
-                 + 3.*(dMult-4.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 3.*pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.)
-                 + 6.*(2.*dMult-5.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-6.*dMult*(dMult-4.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five2n2n2n1n1n = ((pow(dReQ2n,2.)+pow(dImQ2n,2.))*(dReQ2n*(pow(dReQ1n,2.)-pow(dImQ1n,2.))+2.*dImQ2n*dReQ1n*dImQ1n)
-                 - ((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-                 + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n))
-                 - 2.*((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 3.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 + 8.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 2.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 - 2.*(dMult-6.)*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-4.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)
-                 + 2.*(3.*dMult-10.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 4.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 4.*(dMult-5.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five3n3n2n2n2n = (pow(dReQ2n,3.)*pow(dReQ3n,2.)-3.*dReQ2n*pow(dReQ3n,2.)*pow(dImQ2n,2.)
-                 + 6.*pow(dReQ2n,2.)*dReQ3n*dImQ2n*dImQ3n-2.*dReQ3n*pow(dImQ2n,3.)*dImQ3n
-                 - pow(dReQ2n,3.)*pow(dImQ3n,2.)+3.*dReQ2n*pow(dImQ2n,2.)*pow(dImQ3n,2.)
-                 - (dReQ6n*pow(dReQ2n,3)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2)
-                 + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2)-dImQ6n*pow(dImQ2n,3))
-                 - 3.*((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-                 + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n)
-                 - 6.*((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 2.*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 + 3.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 + 6.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 6.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 + 12.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 6.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 2.*((pow(dReQ6n,2.)+pow(dImQ6n,2.))+3.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))+9.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 6.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-12.*dMult))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n1n1n1n1n = (pow(dReQ1n,4.)*dReQ4n-6.*pow(dReQ1n,2.)*dReQ4n*pow(dImQ1n,2.)
-                 + pow(dImQ1n,4.)*dReQ4n+4.*pow(dReQ1n,3.)*dImQ1n*dImQ4n-4.*pow(dImQ1n,3.)*dReQ1n*dImQ4n
-                 - 6.*((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-                 + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n))
-                 - 4.*(dReQ3n*pow(dReQ1n,3)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2)
-                 + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2)-dImQ3n*pow(dImQ1n,3))
-                 + 8.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 3.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 + 12.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n) 
-                 + 12.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-8.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 12.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-24.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))+24.*dMult)
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n2n2n2n2n = ((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(pow(dReQ2n,3)-3.*dReQ2n*pow(dImQ2n,2))
-                 + (dReQ4n*dImQ2n+dReQ2n*dImQ4n)*(3.*dImQ2n*pow(dReQ2n,2)-pow(dImQ2n,3))
-                 - (dReQ6n*pow(dReQ2n,3)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2)
-                 + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2)-dImQ6n*pow(dImQ2n,3))
-                 + 5.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 - 3.*(dMult-5.)*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 3.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))     
-                 + 3.*(dMult-4.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 3.*pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)
-                 + 6.*(2.*dMult-5.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-6.*dMult*(dMult-4.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n4n4n2n2n = ((pow(dReQ4n,2.)+pow(dImQ4n,2.))*(dReQ4n*(pow(dReQ2n,2.)-pow(dImQ2n,2.))+2.*dImQ4n*dReQ2n*dImQ2n)
-                 - ((dReQ8n*dReQ4n+dImQ8n*dImQ4n)*(pow(dReQ2n,2)-pow(dImQ2n,2)) 
-                 + 2.*dReQ2n*dImQ2n*(dImQ8n*dReQ4n-dReQ8n*dImQ4n))
-                 - 2.*((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ6n*dReQ2n-dImQ6n*dImQ2n) 
-                 + 2.*dReQ4n*dImQ4n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + 3.*(pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-                 + 8.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 + 2.*(dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 - 2.*(dMult-6.)*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))-4.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - pow((pow(dReQ4n,2.)+pow(dImQ4n,2.)),2.)
-                 + 2.*(3.*dMult-10.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 4.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 4.*(dMult-5.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n3n3n3n3n = ((dReQ6n*dReQ3n-dImQ6n*dImQ3n)*(pow(dReQ3n,3)-3.*dReQ3n*pow(dImQ3n,2))
-                 + (dReQ6n*dImQ3n+dReQ3n*dImQ6n)*(3.*dImQ3n*pow(dReQ3n,2)-pow(dImQ3n,3))
-                 - (dReQ9n*pow(dReQ3n,3)-3.*dReQ3n*dReQ9n*pow(dImQ3n,2)
-                 + 3.*dImQ3n*dImQ9n*pow(dReQ3n,2)-dImQ9n*pow(dImQ3n,3))
-                 + 5.*(dReQ9n*dReQ6n*dReQ3n-dReQ9n*dImQ6n*dImQ3n+dImQ9n*dReQ6n*dImQ3n+dImQ9n*dImQ6n*dReQ3n)
-                 - 3.*(dMult-5.)*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 3.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))     
-                 + 3.*(dMult-4.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 3.*pow((pow(dReQ3n,2.)+pow(dImQ3n,2.)),2.)
-                 + 6.*(2.*dMult-5.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-6.*dMult*(dMult-4.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n6n4n4n4n = (pow(dReQ4n,3.)*pow(dReQ6n,2.)-3.*dReQ4n*pow(dReQ6n,2.)*pow(dImQ4n,2.)
-                 + 6.*pow(dReQ4n,2.)*dReQ6n*dImQ4n*dImQ6n-2.*dReQ6n*pow(dImQ4n,3.)*dImQ6n
-                 - pow(dReQ4n,3.)*pow(dImQ6n,2.)+3.*dReQ4n*pow(dImQ4n,2.)*pow(dImQ6n,2.)
-                 - (dReQ12n*pow(dReQ4n,3)-3.*dReQ4n*dReQ12n*pow(dImQ4n,2)
-                 + 3.*dImQ4n*dImQ12n*pow(dReQ4n,2)-dImQ12n*pow(dImQ4n,3))
-                 - 3.*((dReQ8n*dReQ4n-dImQ8n*dImQ4n)*(dReQ6n*dReQ6n-dImQ6n*dImQ6n)
-                 + 2.*(dReQ8n*dImQ4n+dImQ8n*dReQ4n)*dReQ6n*dImQ6n)
-                 - 6.*((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ6n*dReQ2n-dImQ6n*dImQ2n) 
-                 + 2.*dReQ4n*dImQ4n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + 2.*(pow(dReQ6n,2.)*dReQ12n+2.*dReQ6n*dImQ6n*dImQ12n-pow(dImQ6n,2.)*dReQ12n)
-                 + 3.*(dReQ12n*dReQ8n*dReQ4n-dReQ12n*dImQ8n*dImQ4n+dImQ12n*dReQ8n*dImQ4n+dImQ12n*dImQ8n*dReQ4n)
-                 + 6.*(dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + 6.*(pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-                 + 12.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 + 6.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 2.*((pow(dReQ12n,2.)+pow(dImQ12n,2.))+3.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 + 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))+9.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 6.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-12.*dMult))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n6n6n3n3n = ((pow(dReQ6n,2.)+pow(dImQ6n,2.))*(dReQ6n*(pow(dReQ3n,2.)-pow(dImQ3n,2.))+2.*dImQ6n*dReQ3n*dImQ3n)
-                 - ((dReQ12n*dReQ6n+dImQ12n*dImQ6n)*(pow(dReQ3n,2)-pow(dImQ3n,2)) 
-                 + 2.*dReQ3n*dImQ3n*(dImQ12n*dReQ6n-dReQ12n*dImQ6n))
-                 - 2.*((pow(dReQ6n,2.)-pow(dImQ6n,2.))*(dReQ9n*dReQ3n-dImQ9n*dImQ3n) 
-                 + 2.*dReQ6n*dImQ6n*(dReQ9n*dImQ3n+dImQ9n*dReQ3n))
-                 + 3.*(pow(dReQ6n,2.)*dReQ12n+2.*dReQ6n*dImQ6n*dImQ12n-pow(dImQ6n,2.)*dReQ12n)
-                 + 8.*(dReQ9n*dReQ6n*dReQ3n-dReQ9n*dImQ6n*dImQ3n+dImQ9n*dReQ6n*dImQ3n+dImQ9n*dImQ6n*dReQ3n)
-                 + 2.*(dReQ12n*(dReQ9n*dReQ3n-dImQ9n*dImQ3n)+dImQ12n*(dReQ9n*dImQ3n+dImQ9n*dReQ3n))
-                 - 2.*(dMult-6.)*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 - 2.*(pow(dReQ12n,2.)+pow(dImQ12n,2.))-4.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - pow((pow(dReQ6n,2.)+pow(dImQ6n,2.)),2.)
-                 + 2.*(3.*dMult-10.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 4.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + 4.*(dMult-5.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  //  f3) Three distinct harmonics (30):
-  five3n1n2n1n1n = ((pow(dReQ1n,2.)+pow(dImQ1n,2.))*(dReQ1n*dReQ2n*dReQ3n-dReQ3n*dImQ1n*dImQ2n
-                 + dReQ2n*dImQ1n*dImQ3n+dReQ1n*dImQ2n*dImQ3n)
-                 - ((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2)-pow(dImQ1n,2)) 
-                 + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n)) 
-                 - (dReQ3n*pow(dReQ1n,3)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2)
-                 + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2)-dImQ3n*pow(dImQ1n,3))
-                 - ((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + 4.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 + pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n
-                 - (2.*dMult-13.)*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n
-                 + dImQ3n*dImQ2n*dReQ1n)
-                 + 7.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-5.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.)
-                 + 2.*(3.*dMult-11.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five3n2n2n2n1n = ((pow(dImQ2n,2.)+pow(dReQ2n,2.))*(dImQ2n*dImQ3n*dReQ1n+dImQ1n*dImQ3n*dReQ2n 
-                 - dImQ1n*dImQ2n*dReQ3n+dReQ1n*dReQ2n*dReQ3n)
-                 - (-pow(dImQ2n,2.)*dImQ1n*dImQ5n+dImQ1n*dImQ5n*pow(dReQ2n,2.)
-                 + 2.*dImQ2n*dImQ5n*dReQ2n*dReQ1n-2.*dImQ2n*dImQ1n*dReQ2n*dReQ5n 
-                 - pow(dImQ2n,2.)*dReQ1n*dReQ5n+pow(dReQ2n,2.)*dReQ1n*dReQ5n)
-                 - (dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)
-                 - ((pow(dReQ2n,2.)-pow(dImQ2n,2.))*(dReQ3n*dReQ1n-dImQ3n*dImQ1n) 
-                 + 2.*dReQ2n*dImQ2n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + (dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 + 4.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n)
-                 + 3.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 2.*(dMult-6.)*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 4.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+2.*(dMult-5.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)+2.*(3.*dMult-10.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)); 
-  five3n3n3n2n1n = ((pow(dImQ3n,2.)+pow(dReQ3n,2.))*(dImQ2n*dImQ3n*dReQ1n+dImQ1n*dImQ3n*dReQ2n
-                 - dImQ1n*dImQ2n*dReQ3n+dReQ1n*dReQ2n*dReQ3n)
-                 - (dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                 - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                 + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                 + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n)
-                 - (dImQ1n*pow(dImQ3n,2.)*dImQ5n+2.*dImQ3n*dImQ5n*dReQ1n*dReQ3n
-                 - dImQ1n*dImQ5n*pow(dReQ3n,2.)-pow(dImQ3n,2.)*dReQ1n*dReQ5n 
-                 + 2.*dImQ1n*dImQ3n*dReQ3n*dReQ5n+dReQ1n*pow(dReQ3n,2.)*dReQ5n)
-                 - ((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-                 + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n)
-                 + dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n
-                 + dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n
-                 + 3.*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n)
-                 + 4.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + 4.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n))
-                 - 2.*(dMult-6.)*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+2.*(3.*dMult-10.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - pow((pow(dReQ3n,2.)+pow(dImQ3n,2.)),2.)+2.*(dMult-5.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-5.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n1n3n1n1n = (reQ4nQ1nQ3nstarQ1nstarQ1nstar
-                 - reQ4nQ1nQ3nstarQ2nstar
-                 - reQ4nQ1nQ4nstarQ1nstar
-                 - reQ4nQ2nstarQ1nstarQ1nstar
-                 - reQ5nQ3nstarQ1nstarQ1nstar
-                 - reQ3nQ1nQ3nstarQ1nstar
-                 - dMult*reQ4nQ3nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + reQ5nQ4nstarQ1nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + 2.*reQ5nQ4nstarQ1nstar
-                 + reQ4nQ2nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ2nQ1nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*reQ3nQ2nstarQ1nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + reQ3nQ2nstarQ1nstar
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*dMult*dMult 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five4n1n1n3n3n = // calculated by Peter Jochumzsen
-                 (pow(dReQ1n*dReQ3n,2.)*dReQ4n-pow(dReQ3n*dImQ1n,2.)*dReQ4n  
-                 + 4.*dReQ1n*dReQ3n*dReQ4n*dImQ1n*dImQ3n 
-                 - pow(dReQ1n*dImQ3n,2.)*dReQ4n+pow(dImQ1n*dImQ3n,2.)*dReQ4n  
-                 - 2.*dReQ1n*pow(dReQ3n,2.)*dImQ1n*dImQ4n+2.*pow(dReQ1n,2.)*dReQ3n*dImQ3n*dImQ4n 
-                 - 2.*dReQ3n*pow(dImQ1n,2.)*dImQ3n*dImQ4n+2.*dReQ1n*dImQ1n*pow(dImQ3n,2.)*dImQ4n
-                 + 6.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n)
-                 - 1.*(-pow(dImQ1n,2.)*dImQ4n*dImQ6n+dImQ4n*dImQ6n*pow(dReQ1n,2.) 
-                 + 2.*dImQ1n*dImQ6n*dReQ1n*dReQ4n-2.*dImQ1n*dImQ4n*dReQ1n*dReQ6n 
-                 - pow(dImQ1n,2.)*dReQ4n*dReQ6n+pow(dReQ1n,2.)*dReQ4n*dReQ6n) 
-                 - 1.*((dReQ4n*dReQ2n-dImQ4n*dImQ2n)*(dReQ3n*dReQ3n-dImQ3n*dImQ3n)
-                 + 2.*(dReQ4n*dImQ2n+dImQ4n*dReQ2n)*dReQ3n*dImQ3n) 
-                 + 1.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 - 2.*(dImQ1n*pow(dImQ3n,2.)*dImQ5n+2.*dImQ3n*dImQ5n*dReQ1n*dReQ3n
-                 - dImQ1n*dImQ5n*pow(dReQ3n,2.)-pow(dImQ3n,2.)*dReQ1n*dReQ5n 
-                 + 2.*dImQ1n*dImQ3n*dReQ3n*dReQ5n+dReQ1n*pow(dReQ3n,2.)*dReQ5n) 
-                 + 2.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 + 4.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n)) 
-                 - 2.*(dReQ3n*pow(dReQ1n,3.)-3.*dReQ1n*dReQ3n*pow(dImQ1n,2.)
-                 + 3.*dImQ1n*dImQ3n*pow(dReQ1n,2.)-dImQ3n*pow(dImQ1n,3.))
-                 + 10.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n) 
-                 + 2.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-                 + 2.*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n) 
-                 - 4.*(dImQ1n*dImQ2n*dImQ3n*dImQ4n+dImQ3n*dImQ4n*dReQ1n*dReQ2n 
-                 + dImQ2n*dImQ4n*dReQ1n*dReQ3n-dImQ1n*dImQ4n*dReQ2n*dReQ3n
-                 - dImQ2n*dImQ3n*dReQ1n*dReQ4n+dImQ1n*dImQ3n*dReQ2n*dReQ4n 
-                 + dImQ1n*dImQ2n*dReQ3n*dReQ4n+dReQ1n*dReQ2n*dReQ3n*dReQ4n)
-                 + 4.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 + 4.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 - 16.*pow(dReQ1n,2.)-16.*pow(dImQ1n,2.)
-                 - 10.*pow(dReQ2n,2.)-10.*pow(dImQ2n,2.)-12.*pow(dReQ3n,2.)-12.*pow(dImQ3n,2.)
-                 - 6.*pow(dReQ4n,2.)-6.*pow(dImQ4n,2.)-4.*pow(dReQ5n,2.)-4.*pow(dImQ5n,2.)
-                 - 2.*pow(dReQ6n,2.)-2.*pow(dImQ6n,2.)+24.*dMult)
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five4n3n3n3n1n = (reQ4nQ3nQ3nstarQ3nstarQ1nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - reQ6nQ1nQ4nstarQ3nstar
-                 - dMult*reQ4nQ3nstarQ1nstar
-                 - reQ7nQ3nstarQ3nstarQ1nstar
-                 - reQ3nQ1nQ3nstarQ1nstar
-                 - reQ4nQ2nQ3nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + 2.*reQ7nQ4nstarQ3nstar
-                 + dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (dMult-6.)*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ4nQ3nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + 2.*dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + 3.*reQ6nQ3nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*dMult*dMult 
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-
-  // to be polished:
-  five4n4n3n3n2n = (reQ4nQ4nQ3nstarQ3nstarQ2nstar
-                 - reQ5nQ3nQ4nstarQ4nstar-reQ5nQ3nQ4nstarQ4nstar-reQ6nQ2nQ4nstarQ4nstar
-                 - reQ4nQ1nQ3nstarQ2nstar-reQ4nQ1nQ3nstarQ2nstar-reQ4nQ2nQ3nstarQ3nstar		     	 
-				 - reQ8nQ3nstarQ3nstarQ2nstar-reQ4nQ2nQ3nstarQ3nstar-reQ4nQ1nQ3nstarQ2nstar-reQ4nQ1nQ3nstarQ2nstar
-                 + 2.*(reQ4nQ3nstarQ1nstar+reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ8nQ4nstarQ4nstar)
-				 + reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ6nQ4nstarQ2nstar
-                 + reQ8nQ6nstarQ2nstar+reQ8nQ5nstarQ3nstar+reQ8nQ5nstarQ3nstar
-				 + reQ5nQ4nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar				 				 
-				 + reQ5nQ4nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar				 				 
-				 + reQ6nQ4nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-                 + 2.*(reQ6nQ3nstarQ3nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar)
-                 + 2.*(reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ2nstarQ2nstar)
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))				 
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-
-  /*
-  // correct recursive formula, not needed for the time being.
-  five4n4n3n3n2n = (reQ4nQ4nQ3nstarQ3nstarQ2nstar
-                 - dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)
-                 * (2.*four4n2n3n3n+4.*four4n1n3n2n+1.*four8n3n3n2n+1.*four6n2n4n4n+2.*four5n3n4n4n)
-                 - dMult*(dMult-1.)*(dMult-2.)
-                 * (4.*three4n3n1n+2.*three4n2n2n+2.*three5n3n2n+1.*three6n3n3n+1.*three8n4n4n
-				 + 4.*three3n2n1n+2.*three2n1n1n+1.*three8n6n2n+2.*three8n5n3n+2.*three6n4n2n+4.*three5n4n1n)
-                 - dMult*(dMult-1.)
-				 * (1.*two2n2n+2.*two3n3n+2.*two4n4n+2.*two5n5n+1.*two6n6n+4.*two1n1n+2.*two2n2n+1.*two8n8n)
-				 - dMult)
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)); 
-  */
-
-  // to be polished:
-  five4n4n4n3n1n = (reQ4nQ4nQ4nstarQ3nstarQ1nstar
-                 - reQ5nQ3nQ4nstarQ4nstar
-                 - reQ7nQ1nQ4nstarQ4nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ8nQ4nstarQ3nstarQ1nstar
-                 - dMult*reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ8nQ4nstarQ4nstar
-                 + 3.*dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*reQ8nQ4nstarQ4nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ8nQ7nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (dMult-6.)*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ7nQ4nstarQ3nstar
-                 + dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*dMult*dMult 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n2n1n1n1n = (reQ5nQ2nstarQ1nstarQ1nstarQ1nstar
-	             - reQ5nQ2nstarQ2nstarQ1nstar-reQ5nQ2nstarQ2nstarQ1nstar-reQ5nQ2nstarQ2nstarQ1nstar
-				 - reQ5nQ3nstarQ1nstarQ1nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ5nQ3nstarQ1nstarQ1nstar
-				 - reQ3nQ1nstarQ1nstarQ1nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ4nQ2nstarQ1nstarQ1nstar
-                 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar)
-				 + reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar
-				 + reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar
-                 + 2.*(reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-                 + 2.*(reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 6.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n1n2n2n2n = (reQ5nQ1nQ2nstarQ2nstarQ2nstar
-                 - reQ5nQ1nQ4nstarQ2nstar-reQ5nQ1nQ4nstarQ2nstar-reQ5nQ1nQ4nstarQ2nstar
-				 - reQ5nQ2nstarQ2nstarQ1nstar-reQ5nQ2nstarQ2nstarQ1nstar-reQ5nQ2nstarQ2nstarQ1nstar
-				 - reQ6nQ2nstarQ2nstarQ2nstar-reQ3nQ1nQ2nstarQ2nstar-reQ3nQ1nQ2nstarQ2nstar-reQ3nQ1nQ2nstarQ2nstar
-				 + 2.*(reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ6nQ5nstarQ1nstar)
-				 + reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar
-				 + reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar
-				 + reQ4nQ3nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ4nQ3nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ4nQ3nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-                 + 2.*(reQ4nQ2nstarQ2nstar+reQ4nQ2nstarQ2nstar+reQ4nQ2nstarQ2nstar)
-                 + 2.*(reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n2n3n2n2n = (reQ5nQ2nQ3nstarQ2nstarQ2nstar
-                 - reQ5nQ2nQ4nstarQ3nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - reQ5nQ2nstarQ2nstarQ1nstar
-                 - reQ7nQ3nstarQ2nstarQ2nstar
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - dMult*reQ5nQ3nstarQ2nstar
-                 + dMult*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + reQ7nQ5nstarQ2nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ7nQ5nstarQ2nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ7nQ4nstarQ3nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + dMult*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ4nQ2nstarQ2nstar
-                 + dMult*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*reQ3nQ2nstarQ1nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + reQ3nQ2nstarQ1nstar
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*dMult*dMult
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n3n3n3n2n = (reQ5nQ3nQ3nstarQ3nstarQ2nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - reQ6nQ2nQ5nstarQ3nstar
-                 - dMult*reQ5nQ3nstarQ2nstar
-                 - reQ8nQ3nstarQ3nstarQ2nstar 
-				 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - reQ5nQ1nQ3nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + 2.*reQ8nQ5nstarQ3nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + reQ8nQ6nstarQ2nstar
-                 + dMult*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (dMult-6.)*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ5nQ3nstarQ2nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + 2.*dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + 3.*reQ6nQ3nstarQ3nstar
-                 + reQ3nQ2nstarQ1nstar
-                 + dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*dMult*dMult 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n1n4n1n1n = (reQ5nQ1nQ4nstarQ1nstarQ1nstar
-                 - reQ5nQ1nQ4nstarQ2nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ5nQ3nstarQ1nstarQ1nstar
-                 - reQ6nQ4nstarQ1nstarQ1nstar 
-				 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - dMult*reQ5nQ4nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + reQ6nQ5nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + 2.*reQ6nQ5nstarQ1nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 - (dMult-6.)*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ2nQ1nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*reQ4nQ3nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + reQ4nQ3nstarQ1nstar
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*dMult*dMult
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n4n3n3n3n = (reQ5nQ4nQ3nstarQ3nstarQ3nstar
-                 - reQ6nQ3nQ5nstarQ4nstar-reQ6nQ3nQ5nstarQ4nstar-reQ6nQ3nQ5nstarQ4nstar
-				 - reQ5nQ1nQ3nstarQ3nstar-reQ5nQ1nQ3nstarQ3nstar-reQ5nQ1nQ3nstarQ3nstar
-		     	 - reQ9nQ3nstarQ3nstarQ3nstar-reQ4nQ2nQ3nstarQ3nstar-reQ4nQ2nQ3nstarQ3nstar-reQ4nQ2nQ3nstarQ3nstar
-				 + 2.*(reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ9nQ5nstarQ4nstar)
-				 + reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar
-				 + reQ9nQ6nstarQ3nstar+reQ9nQ6nstarQ3nstar+reQ9nQ6nstarQ3nstar
-				 + reQ6nQ4nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ6nQ4nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ6nQ4nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-                 + 2.*(reQ6nQ3nstarQ3nstar+reQ6nQ3nstarQ3nstar+reQ6nQ3nstarQ3nstar)
-                 + 2.*(reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n4n4n4n1n = (reQ5nQ4nQ4nstarQ4nstarQ1nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - reQ8nQ1nQ5nstarQ4nstar
-                 - dMult*reQ5nQ4nstarQ1nstar
-                 - reQ9nQ4nstarQ4nstarQ1nstar 
-				 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ5nQ3nQ4nstarQ4nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + 2.*reQ9nQ5nstarQ4nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + reQ9nQ5nstarQ4nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + reQ9nQ8nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (dMult-6.)*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ5nQ4nstarQ1nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + 2.*dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 3.*reQ8nQ4nstarQ4nstar
-                 + reQ4nQ3nstarQ1nstar
-                 + dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-                 - 2.*dMult*dMult 
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n5n4n3n3n = (reQ5nQ5nQ4nstarQ3nstarQ3nstar
-                 - reQ6nQ4nQ5nstarQ5nstar-reQ7nQ3nQ5nstarQ5nstar-reQ7nQ3nQ5nstarQ5nstar
-				 - reQ5nQ2nQ4nstarQ3nstar-reQ5nQ1nQ3nstarQ3nstar-reQ5nQ2nQ4nstarQ3nstar		     	 
-				 - reQ10nQ4nstarQ3nstarQ3nstar-reQ5nQ2nQ4nstarQ3nstar-reQ5nQ1nQ3nstarQ3nstar-reQ5nQ2nQ4nstarQ3nstar
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ10nQ5nstarQ5nstar)
-				 + reQ6nQ5nstarQ1nstar+reQ7nQ5nstarQ2nstar+reQ7nQ5nstarQ2nstar
-				 + reQ10nQ7nstarQ3nstar+reQ10nQ6nstarQ4nstar+reQ10nQ7nstarQ3nstar
-				 + reQ6nQ5nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ7nQ5nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ4nQ2nstarQ2nstar
-				 + reQ7nQ5nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ4nQ2nstarQ2nstar
-				 + 2.*(reQ7nQ4nstarQ3nstar+reQ7nQ4nstarQ3nstar+reQ6nQ3nstarQ3nstar)
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.))
-				 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n5n4n4n2n = (reQ5nQ5nQ4nstarQ4nstarQ2nstar
-                 - reQ6nQ4nQ5nstarQ5nstar-reQ6nQ4nQ5nstarQ5nstar-reQ8nQ2nQ5nstarQ5nstar
-				 - reQ5nQ1nQ4nstarQ2nstar-reQ5nQ1nQ4nstarQ2nstar-reQ5nQ3nQ4nstarQ4nstar		     	 
-				 - reQ10nQ4nstarQ4nstarQ2nstar-reQ5nQ3nQ4nstarQ4nstar-reQ5nQ1nQ4nstarQ2nstar-reQ5nQ1nQ4nstarQ2nstar
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar+reQ10nQ5nstarQ5nstar)
-				 + reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ8nQ5nstarQ3nstar
-				 + reQ10nQ8nstarQ2nstar+reQ10nQ6nstarQ4nstar+reQ10nQ6nstarQ4nstar
-				 + reQ6nQ5nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + reQ6nQ5nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + reQ8nQ5nstarQ3nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + 2.*(reQ8nQ4nstarQ4nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar)
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.))
-				 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n5n5n3n2n = (reQ5nQ5nQ5nstarQ3nstarQ2nstar
-                 - reQ7nQ3nQ5nstarQ5nstar
-                 - reQ8nQ2nQ5nstarQ5nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - reQ10nQ5nstarQ3nstarQ2nstar 
-				 - dMult*reQ5nQ3nstarQ2nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ10nQ5nstarQ5nstar
-                 + 3.*dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + 2.*reQ10nQ5nstarQ5nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + reQ10nQ7nstarQ3nstar
-                 + reQ8nQ5nstarQ3nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + reQ10nQ8nstarQ2nstar
-                 + dMult*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (dMult-6.)*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ7nQ5nstarQ2nstar
-                 + reQ5nQ3nstarQ2nstar
-                 + 2.*reQ5nQ3nstarQ2nstar
-                 + 3.*reQ8nQ5nstarQ3nstar
-                 + dMult*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + reQ5nQ3nstarQ2nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*dMult*dMult 
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 + (dMult-8.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n5n5n4n1n = (reQ5nQ5nQ5nstarQ4nstarQ1nstar
-                 - reQ6nQ4nQ5nstarQ5nstar
-                 - reQ9nQ1nQ5nstarQ5nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ10nQ5nstarQ4nstarQ1nstar 
-				 - dMult*reQ5nQ4nstarQ1nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ10nQ5nstarQ5nstar
-                 + 3.*dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + 2.*reQ10nQ5nstarQ5nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ10nQ6nstarQ4nstar
-                 + reQ9nQ5nstarQ4nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ10nQ9nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (dMult-6.)*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + 2.*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ9nQ5nstarQ4nstar
-                 + dMult*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + reQ5nQ4nstarQ1nstar
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*dMult*dMult 
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n2n2n1n1n = // calculated by Peter Jochumzsen 
-                 (pow(dReQ1n*dReQ2n,2.)*dReQ6n-pow(dReQ2n*dImQ1n,2.)*dReQ6n
-                 - 4.*dReQ1n*dReQ2n*dReQ6n*dImQ1n*dImQ2n 
-                 - pow(dReQ1n*dImQ2n,2.)*dReQ6n+pow(dImQ1n*dImQ2n,2.)*dReQ6n
-                 + 2.*dReQ1n*pow(dReQ2n,2.)*dImQ1n*dImQ6n+2.*pow(dReQ1n,2.)*dReQ2n*dImQ2n*dImQ6n 
-                 - 2.*dReQ2n*pow(dImQ1n,2.)*dImQ2n*dImQ6n-2.*dReQ1n*dImQ1n*pow(dImQ2n,2.)*dImQ6n
-                 + 2.*(pow(dReQ1n,2.)*dReQ2n+2.*dReQ1n*dImQ1n*dImQ2n-pow(dImQ1n,2.)*dReQ2n) 
-                 + 8.*(dReQ3n*dReQ2n*dReQ1n-dReQ3n*dImQ2n*dImQ1n+dImQ3n*dReQ2n*dImQ1n+dImQ3n*dImQ2n*dReQ1n)
-                 + 5.*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 - (-pow(dImQ1n,2.)*dImQ4n*dImQ6n+dImQ4n*dImQ6n*pow(dReQ1n,2.) 
-                 + 2.*dImQ1n*dImQ6n*dReQ1n*dReQ4n-2.*dImQ1n*dImQ4n*dReQ1n*dReQ6n 
-                 - pow(dImQ1n,2.)*dReQ4n*dReQ6n+pow(dReQ1n,2.)*dReQ4n*dReQ6n)
-                 + 2.*(pow(dReQ3n,2.)*dReQ6n+2.*dReQ3n*dImQ3n*dImQ6n-pow(dImQ3n,2.)*dReQ6n) 
-                 - (dReQ6n*pow(dReQ2n,3.)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2.)
-                 + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2.)-dImQ6n*pow(dImQ2n,3.))
-                 + 4.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n) 
-                 - 2.*((dReQ4n*dReQ2n+dImQ4n*dImQ2n)*(pow(dReQ1n,2.)-pow(dImQ1n,2.)) 
-                 + 2.*dReQ1n*dImQ1n*(dImQ4n*dReQ2n-dReQ4n*dImQ2n))
-                 + 2.*(dReQ5n*dReQ4n*dReQ1n-dReQ5n*dImQ4n*dImQ1n+dImQ5n*dReQ4n*dImQ1n+dImQ5n*dImQ4n*dReQ1n)
-                 - 2.*(-pow(dImQ2n,2.)*dImQ1n*dImQ5n+dImQ1n*dImQ5n*pow(dReQ2n,2.)
-                 + 2.*dImQ2n*dImQ5n*dReQ2n*dReQ1n-2.*dImQ2n*dImQ1n*dReQ2n*dReQ5n 
-                 - pow(dImQ2n,2.)*dReQ1n*dReQ5n+pow(dReQ2n,2.)*dReQ1n*dReQ5n) 
-                 + 4.*(dReQ4n*(dReQ3n*dReQ1n-dImQ3n*dImQ1n)+dImQ4n*(dReQ3n*dImQ1n+dImQ3n*dReQ1n)) 
-                 + 4.*(dReQ5n*dReQ2n*dReQ3n-dReQ5n*dImQ2n*dImQ3n+dImQ5n*dReQ2n*dImQ3n+dImQ5n*dImQ2n*dReQ3n)
-                 + 4.*(dReQ6n*dReQ5n*dReQ1n-dReQ6n*dImQ5n*dImQ1n+dImQ6n*dReQ5n*dImQ1n+dImQ6n*dImQ5n*dReQ1n)
-                 - 4.*(dReQ1n*dReQ2n*dReQ3n*dReQ6n-dReQ3n*dReQ6n*dImQ1n*dImQ2n
-                 - dReQ2n*dReQ6n*dImQ1n*dImQ3n-dReQ1n*dReQ6n*dImQ2n*dImQ3n
-                 + dReQ2n*dReQ3n*dImQ1n*dImQ6n+dReQ1n*dReQ3n*dImQ2n*dImQ6n 
-                 + dReQ1n*dReQ2n*dImQ3n*dImQ6n-dImQ1n*dImQ2n*dImQ3n*dImQ6n)
-                 - 12.*pow(dReQ1n,2.)-12.*pow(dImQ1n,2.)-14.*pow(dReQ2n,2.)-14.*pow(dImQ2n,2.)
-                 - 8.*pow(dReQ3n,2.)-8.*pow(dImQ3n,2.)-6.*pow(dReQ4n,2.)-6.*pow(dImQ4n,2.)
-                 - 4.*pow(dReQ5n,2.)-4.*pow(dImQ5n,2.)-6.*pow(dReQ6n,2.)-6.*pow(dImQ6n,2.)+24.*dMult)
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n3n1n1n1n = (reQ6nQ3nstarQ1nstarQ1nstarQ1nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar-reQ6nQ3nstarQ2nstarQ1nstar-reQ6nQ3nstarQ2nstarQ1nstar
-				 - reQ6nQ4nstarQ1nstarQ1nstar-reQ6nQ4nstarQ1nstarQ1nstar-reQ6nQ4nstarQ1nstarQ1nstar
-				 - reQ3nQ1nstarQ1nstarQ1nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ5nQ3nstarQ1nstarQ1nstar
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ6nQ3nstarQ3nstar)
-				 + reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar
-				 + reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar
-				 + reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar
-				 + reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar
-                 + 2.*(reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-                 + 2.*(reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-
-
-  // to be polished:
-  five6n1n1n4n4n = (reQ6nQ1nQ1nQ4nstarQ4nstar
-	             - reQ6nQ2nQ4nstarQ4nstar-reQ7nQ1nQ4nstarQ4nstar-reQ7nQ1nQ4nstarQ4nstar
-				 - reQ6nQ1nQ4nstarQ3nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar
-                 - reQ8nQ6nstarQ1nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar
-				 + 2.*(reQ6nQ4nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ8nQ4nstarQ4nstar)
-				 + reQ4nQ2nstarQ2nstar+reQ7nQ4nstarQ3nstar+reQ7nQ4nstarQ3nstar // ?? 1st term
-                 + reQ8nQ7nstarQ1nstar+reQ8nQ6nstarQ2nstar+reQ8nQ7nstarQ1nstar
-				 + reQ4nQ2nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ7nQ4nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ6nQ3nstarQ3nstar				 				 
-                 + reQ7nQ4nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ6nQ3nstarQ3nstar				 
-                 + 2.*(reQ7nQ6nstarQ1nstar+reQ7nQ6nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-                 + 2.*(reQ6nQ4nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.))
-				 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))				 
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  
-  // to be polished:
-  five6n1n5n1n1n = (reQ6nQ1nQ5nstarQ1nstarQ1nstar
-                 - reQ6nQ1nQ5nstarQ2nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ6nQ4nstarQ1nstarQ1nstar
-                 - reQ7nQ5nstarQ1nstarQ1nstar 
- 			     - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - dMult*reQ6nQ5nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + reQ7nQ6nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ7nQ6nstarQ1nstar
-                 + reQ6nQ4nstarQ2nstar
-                 + reQ7nQ5nstarQ2nstar
-                 + dMult*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 - (dMult-6.)*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ2nQ1nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*reQ5nQ4nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + reQ5nQ4nstarQ1nstar
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ1n,2.)+pow(dImQ1n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*dMult*dMult
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n2n4n2n2n = ((pow(dReQ2n,2.)+pow(dImQ2n,2.))*(dReQ2n*dReQ4n*dReQ6n-dReQ6n*dImQ2n*dImQ4n
-                 + dReQ4n*dImQ2n*dImQ6n+dReQ2n*dImQ4n*dImQ6n)
-                 - ((dReQ8n*dReQ4n+dImQ8n*dImQ4n)*(pow(dReQ2n,2)-pow(dImQ2n,2)) 
-                 + 2.*dReQ2n*dImQ2n*(dImQ8n*dReQ4n-dReQ8n*dImQ4n)) 
-                 - (dReQ6n*pow(dReQ2n,3)-3.*dReQ2n*dReQ6n*pow(dImQ2n,2)
-                 + 3.*dImQ2n*dImQ6n*pow(dReQ2n,2)-dImQ6n*pow(dImQ2n,3))
-                 - ((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ6n*dReQ2n-dImQ6n*dImQ2n) 
-                 + 2.*dReQ4n*dImQ4n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + 4.*(dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 + pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n
-                 - (2.*dMult-13.)*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n
-                 + dImQ6n*dImQ4n*dReQ2n)
-                 + 7.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 + 2.*(dMult-5.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)
-                 + 2.*(3.*dMult-11.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n4n4n4n2n = ((pow(dImQ4n,2.)+pow(dReQ4n,2.))*(dImQ4n*dImQ6n*dReQ2n+dImQ2n*dImQ6n*dReQ4n 
-                 - dImQ2n*dImQ4n*dReQ6n+dReQ2n*dReQ4n*dReQ6n)
-                 - (-pow(dImQ4n,2.)*dImQ2n*dImQ10n+dImQ2n*dImQ10n*pow(dReQ4n,2.)
-                 + 2.*dImQ4n*dImQ10n*dReQ4n*dReQ2n-2.*dImQ4n*dImQ2n*dReQ4n*dReQ10n 
-                 - pow(dImQ4n,2.)*dReQ2n*dReQ10n+pow(dReQ4n,2.)*dReQ2n*dReQ10n)
-                 - (dImQ2n*dImQ4n*dImQ6n*dImQ8n+dImQ6n*dImQ8n*dReQ2n*dReQ4n 
-                 + dImQ4n*dImQ8n*dReQ2n*dReQ6n-dImQ2n*dImQ8n*dReQ4n*dReQ6n
-                 - dImQ4n*dImQ6n*dReQ2n*dReQ8n+dImQ2n*dImQ6n*dReQ4n*dReQ8n 
-                 + dImQ2n*dImQ4n*dReQ6n*dReQ8n+dReQ2n*dReQ4n*dReQ6n*dReQ8n)
-                 - ((pow(dReQ4n,2.)-pow(dImQ4n,2.))*(dReQ6n*dReQ2n-dImQ6n*dImQ2n) 
-                 + 2.*dReQ4n*dImQ4n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + (dReQ10n*dReQ8n*dReQ2n-dReQ10n*dImQ8n*dImQ2n+dImQ10n*dReQ8n*dImQ2n+dImQ10n*dImQ8n*dReQ2n)
-                 + 4.*(dReQ10n*dReQ4n*dReQ6n-dReQ10n*dImQ4n*dImQ6n+dImQ10n*dReQ4n*dImQ6n+dImQ10n*dImQ4n*dReQ6n)
-                 + dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n)
-                 + 3.*(pow(dReQ4n,2.)*dReQ8n+2.*dReQ4n*dImQ4n*dImQ8n-pow(dImQ4n,2.)*dReQ8n)
-                 - 2.*(dMult-6.)*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 + 4.*(pow(dReQ2n,2.)*dReQ4n+2.*dReQ2n*dImQ2n*dImQ4n-pow(dImQ2n,2.)*dReQ4n)
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))+2.*(dMult-5.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - pow((pow(dReQ4n,2.)+pow(dImQ4n,2.)),2.)+2.*(3.*dMult-10.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n2n2n5n5n = (reQ6nQ2nQ2nQ5nstarQ5nstar
-                 - reQ6nQ4nQ5nstarQ5nstar-reQ8nQ2nQ5nstarQ5nstar-reQ8nQ2nQ5nstarQ5nstar
-				 - reQ6nQ2nQ5nstarQ3nstar-reQ5nQ2nstarQ2nstarQ1nstar-reQ6nQ2nQ5nstarQ3nstar
-				 - reQ10nQ6nstarQ2nstarQ2nstar-reQ6nQ2nQ5nstarQ3nstar-reQ5nQ2nstarQ2nstarQ1nstar-reQ6nQ2nQ5nstarQ3nstar
-				 + 2.*(reQ6nQ5nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ10nQ5nstarQ5nstar)
-				 + reQ5nQ4nstarQ1nstar+reQ8nQ5nstarQ3nstar+reQ8nQ5nstarQ3nstar
-                 + reQ10nQ8nstarQ2nstar+reQ10nQ6nstarQ4nstar+reQ10nQ8nstarQ2nstar
- 				 + reQ5nQ4nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ8nQ5nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ6nQ3nstarQ3nstar				 				 
-				 + reQ8nQ5nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ6nQ3nstarQ3nstar				 
-                 + 2.*(reQ8nQ6nstarQ2nstar+reQ8nQ6nstarQ2nstar+reQ4nQ2nstarQ2nstar)
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n5n5n5n1n = (reQ6nQ5nQ5nstarQ5nstarQ1nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - reQ10nQ1nQ6nstarQ5nstar
-                 - dMult*reQ6nQ5nstarQ1nstar
-                 - reQ11nQ5nstarQ5nstarQ1nstar 
- 			     - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ6nQ4nQ5nstarQ5nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ11nQ6nstarQ5nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + 2.*reQ11nQ6nstarQ5nstar
-                 + dMult*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + reQ11nQ6nstarQ5nstar
-                 + reQ10nQ6nstarQ4nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + reQ11nQ10nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (dMult-6.)*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ6nQ5nstarQ1nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + 2.*dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + 3.*reQ10nQ5nstarQ5nstar
-                 + reQ5nQ4nstarQ1nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.))
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)) 
-                 - 2.*dMult*dMult
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n6n5n5n2n = (reQ6nQ6nQ5nstarQ5nstarQ2nstar
-                 - reQ7nQ5nQ6nstarQ6nstar-reQ7nQ5nQ6nstarQ6nstar-reQ10nQ2nQ6nstarQ6nstar
-                 - reQ6nQ1nQ5nstarQ2nstar-reQ6nQ1nQ5nstarQ2nstar-reQ6nQ4nQ5nstarQ5nstar
-				 - reQ12nQ5nstarQ5nstarQ2nstar-reQ6nQ4nQ5nstarQ5nstar-reQ6nQ1nQ5nstarQ2nstar-reQ6nQ1nQ5nstarQ2nstar
-				 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ4nstarQ2nstar+reQ6nQ5nstarQ1nstar+reQ12nQ6nstarQ6nstar)
-				 + reQ7nQ6nstarQ1nstar+reQ7nQ6nstarQ1nstar+reQ10nQ6nstarQ4nstar
-                 + reQ12nQ10nstarQ2nstar+reQ12nQ7nstarQ5nstar+reQ12nQ7nstarQ5nstar
- 				 + reQ7nQ6nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ5nQ4nstarQ1nstar				 
- 				 + reQ7nQ6nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ5nQ4nstarQ1nstar
-				 + reQ10nQ6nstarQ4nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar				 
-                 + 2.*(reQ10nQ5nstarQ5nstar+reQ7nQ5nstarQ2nstar+reQ7nQ5nstarQ2nstar)
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ6nQ4nstarQ2nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ12n,2.)+pow(dImQ12n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  five6n6n6n4n2n = ((pow(dImQ6n,2.)+pow(dReQ6n,2.))*(dImQ4n*dImQ6n*dReQ2n+dImQ2n*dImQ6n*dReQ4n
-                 - dImQ2n*dImQ4n*dReQ6n+dReQ2n*dReQ4n*dReQ6n)
-                 - (dReQ2n*dReQ4n*dReQ6n*dReQ12n-dReQ6n*dReQ12n*dImQ2n*dImQ4n
-                 - dReQ4n*dReQ12n*dImQ2n*dImQ6n-dReQ2n*dReQ12n*dImQ4n*dImQ6n
-                 + dReQ4n*dReQ6n*dImQ2n*dImQ12n+dReQ2n*dReQ6n*dImQ4n*dImQ12n 
-                 + dReQ2n*dReQ4n*dImQ6n*dImQ12n-dImQ2n*dImQ4n*dImQ6n*dImQ12n)
-                 - (dImQ2n*pow(dImQ6n,2.)*dImQ10n+2.*dImQ6n*dImQ10n*dReQ2n*dReQ6n
-                 - dImQ2n*dImQ10n*pow(dReQ6n,2.)-pow(dImQ6n,2.)*dReQ2n*dReQ10n 
-                 + 2.*dImQ2n*dImQ6n*dReQ6n*dReQ10n+dReQ2n*pow(dReQ6n,2.)*dReQ10n)
-                 - ((dReQ8n*dReQ4n-dImQ8n*dImQ4n)*(dReQ6n*dReQ6n-dImQ6n*dImQ6n)
-                 + 2.*(dReQ8n*dImQ4n+dImQ8n*dReQ4n)*dReQ6n*dImQ6n)
-                 + dReQ12n*dReQ10n*dReQ2n-dReQ12n*dImQ10n*dImQ2n+dImQ12n*dReQ10n*dImQ2n+dImQ12n*dImQ10n*dReQ2n
-                 + dReQ12n*dReQ8n*dReQ4n-dReQ12n*dImQ8n*dImQ4n+dImQ12n*dReQ8n*dImQ4n+dImQ12n*dImQ8n*dReQ4n
-                 + 3.*(pow(dReQ6n,2.)*dReQ12n+2.*dReQ6n*dImQ6n*dImQ12n-pow(dImQ6n,2.)*dReQ12n)
-                 + 4.*(dReQ10n*dReQ4n*dReQ6n-dReQ10n*dImQ4n*dImQ6n+dImQ10n*dReQ4n*dImQ6n+dImQ10n*dImQ4n*dReQ6n)
-                 + 4.*(dReQ8n*(dReQ6n*dReQ2n-dImQ6n*dImQ2n)+dImQ8n*(dReQ6n*dImQ2n+dImQ6n*dReQ2n))
-                 - 2.*(dMult-6.)*(dReQ6n*dReQ4n*dReQ2n-dReQ6n*dImQ4n*dImQ2n+dImQ6n*dReQ4n*dImQ2n+dImQ6n*dImQ4n*dReQ2n)
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ4n,2.)+pow(dImQ4n,2.)) 
-                 - 2.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 - 2.*(pow(dReQ12n,2.)+pow(dImQ12n,2.))-2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.))+2.*(3.*dMult-10.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - pow((pow(dReQ6n,2.)+pow(dImQ6n,2.)),2.)+2.*(dMult-5.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 2.*(dMult-5.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))-4.*dMult*(dMult-6.))
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished (and  TBI swap with the one above):
-  five6n6n6n5n1n = (reQ6nQ6nQ6nstarQ5nstarQ1nstar
-                 - reQ7nQ5nQ6nstarQ6nstar
-                 - reQ11nQ1nQ6nstarQ6nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - reQ12nQ6nstarQ5nstarQ1nstar 
- 			     - dMult*reQ6nQ5nstarQ1nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ12nQ6nstarQ6nstar
-                 + 3.*dMult*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + 2.*reQ12nQ6nstarQ6nstar
-                 + reQ7nQ6nstarQ1nstar
-                 + reQ12nQ7nstarQ5nstar
-                 + reQ11nQ6nstarQ5nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + reQ12nQ11nstarQ1nstar
-                 + dMult*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (dMult-6.)*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ7nQ6nstarQ1nstar
-                 + reQ6nQ5nstarQ1nstar
-                 + 2.*reQ6nQ5nstarQ1nstar
-                 + 3.*reQ11nQ6nstarQ5nstar
-                 + dMult*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + reQ6nQ5nstarQ1nstar
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - (pow(dReQ6n,2.)+pow(dImQ6n,2.))*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ12n,2.)+pow(dImQ12n,2.))
-                 - 2.*dMult*dMult
-                 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.)) 
-                 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + (dMult-8.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 + (dMult-8.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-                 + (dMult-8.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 2.*(dMult-6.)*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-2.*dMult*(dMult-12.)) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // Four distinct harmonics (11):
-  // to be polished:
-  five5n2n3n3n1n = (reQ5nQ2nQ3nstarQ3nstarQ1nstar
-                 - reQ5nQ2nQ4nstarQ3nstar-reQ5nQ2nQ4nstarQ3nstar-reQ6nQ1nQ5nstarQ2nstar
-				 - reQ5nQ3nstarQ1nstarQ1nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ5nQ1nQ3nstarQ3nstar		     	 
-				 - reQ7nQ3nstarQ3nstarQ1nstar-reQ4nQ2nQ3nstarQ3nstar-reQ3nQ1nQ2nstarQ2nstar-reQ3nQ1nQ2nstarQ2nstar
-				 + 2.*(reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ7nQ5nstarQ2nstar)
-				 + reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ6nQ5nstarQ1nstar
-				 + reQ7nQ6nstarQ1nstar+reQ7nQ4nstarQ3nstar+reQ7nQ4nstarQ3nstar
-				 + reQ4nQ2nstarQ2nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ4nQ2nstarQ2nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ6nQ4nstarQ2nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + 2.*(reQ6nQ3nstarQ3nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-				 + 2.*(reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n1n1n4n3n = (reQ5nQ1nQ1nQ4nstarQ3nstar
-                 - reQ5nQ2nQ4nstarQ3nstar-reQ6nQ1nQ4nstarQ3nstar-reQ6nQ1nQ4nstarQ3nstar
-				 - reQ5nQ1nQ4nstarQ2nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ5nQ1nQ4nstarQ2nstar
-				 - reQ7nQ5nstarQ1nstarQ1nstar-reQ5nQ1nQ3nstarQ3nstar-reQ3nQ1nstarQ1nstarQ1nstar-reQ5nQ1nQ3nstarQ3nstar
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ7nQ4nstarQ3nstar)
-				 + reQ4nQ2nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar
-                 + reQ7nQ6nstarQ1nstar+reQ7nQ5nstarQ2nstar+reQ7nQ6nstarQ1nstar
- 				 + reQ3nQ2nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar
-				 + reQ6nQ3nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ5nQ3nstarQ2nstar				 				 				 
-				 + reQ6nQ3nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ5nQ3nstarQ2nstar				 				 
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-                 + 2.*(reQ5nQ3nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 - 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five5n3n4n2n2n = (reQ5nQ3nQ4nstarQ2nstarQ2nstar
-                 - reQ5nQ3nQ4nstarQ4nstar-reQ6nQ2nQ5nstarQ3nstar-reQ6nQ2nQ5nstarQ3nstar
-				 - reQ5nQ1nQ4nstarQ2nstar-reQ5nQ2nstarQ2nstarQ1nstar-reQ5nQ1nQ4nstarQ2nstar		     	 
-				 - reQ8nQ4nstarQ2nstarQ2nstar-reQ4nQ2nQ3nstarQ3nstar-reQ3nQ1nQ2nstarQ2nstar-reQ4nQ2nQ3nstarQ3nstar
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ8nQ5nstarQ3nstar)
-				 + reQ5nQ4nstarQ1nstar+reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar
-                 + reQ8nQ6nstarQ2nstar+reQ8nQ4nstarQ4nstar+reQ8nQ6nstarQ2nstar
-				 + reQ4nQ3nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar
-				 + reQ6nQ3nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + reQ6nQ3nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + 2.*(reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ4nQ2nstarQ2nstar)
-				 + 2.*(reQ4nQ3nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-
-  // to be polished!!!:
-  five5n2n1n4n4n = (reQ5nQ2nQ1nQ4nstarQ4nstar
-                 - reQ5nQ3nQ4nstarQ4nstar-reQ6nQ2nQ4nstarQ4nstar-reQ7nQ1nQ4nstarQ4nstar
-				 - reQ5nQ1nQ4nstarQ2nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ5nQ2nQ4nstarQ3nstar
-				 - reQ8nQ5nstarQ2nstarQ1nstar-reQ5nQ2nQ4nstarQ3nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ5nQ1nQ4nstarQ2nstar
-				 + 2.*(reQ5nQ4nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ2nstarQ2nstar+reQ8nQ4nstarQ4nstar)
-				 + reQ4nQ3nstarQ1nstar+reQ6nQ4nstarQ2nstar+reQ7nQ4nstarQ3nstar
-                 + reQ8nQ7nstarQ1nstar+reQ8nQ5nstarQ3nstar+reQ8nQ6nstarQ2nstar
- 				 + reQ4nQ3nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ6nQ4nstarQ2nstar+reQ2nQ1nstarQ1nstar+reQ5nQ3nstarQ2nstar				 				 				 
-				 + reQ7nQ4nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ5nQ3nstarQ2nstar				 				 
-                 + 2.*(reQ7nQ5nstarQ2nstar+reQ6nQ5nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-                 + 2.*(reQ5nQ4nstarQ1nstar+reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar)
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.))
-                 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-
-
-  // to be polished:
-  five6n1n3n2n2n = (reQ6nQ1nQ3nstarQ2nstarQ2nstar
-                 - reQ6nQ1nQ4nstarQ3nstar-reQ6nQ1nQ5nstarQ2nstar-reQ6nQ1nQ5nstarQ2nstar
-                 - reQ6nQ3nstarQ2nstarQ1nstar-reQ6nQ2nstarQ2nstarQ2nstar-reQ6nQ3nstarQ2nstarQ1nstar		     	 
-				 - reQ7nQ3nstarQ2nstarQ2nstar-reQ4nQ1nQ3nstarQ2nstar-reQ3nQ1nQ2nstarQ2nstar-reQ4nQ1nQ3nstarQ2nstar
-				 + 2.*(reQ6nQ3nstarQ3nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ7nQ6nstarQ1nstar)
-				 + reQ6nQ4nstarQ2nstar+reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar
-                 + reQ7nQ5nstarQ2nstar+reQ7nQ4nstarQ3nstar+reQ7nQ5nstarQ2nstar
-				 + reQ4nQ3nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar
-				 + reQ5nQ4nstarQ1nstar+reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar
-				 + reQ5nQ4nstarQ1nstar+reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar
-				 + 2.*(reQ5nQ3nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ4nQ2nstarQ2nstar)
-				 + 2.*(reQ3nQ2nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))				 
-				 - 6.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-
-
-  // to be polished:
-  five6n3n4n4n1n = (reQ6nQ3nQ4nstarQ4nstarQ1nstar
-                 - reQ8nQ1nQ6nstarQ3nstar-reQ6nQ3nQ5nstarQ4nstar-reQ6nQ3nQ5nstarQ4nstar
-				 - reQ6nQ4nstarQ1nstarQ1nstar-reQ6nQ2nQ4nstarQ4nstar-reQ6nQ4nstarQ1nstarQ1nstar		     	 
-				 - reQ9nQ4nstarQ4nstarQ1nstar-reQ4nQ1nQ3nstarQ2nstar-reQ5nQ3nQ4nstarQ4nstar-reQ4nQ1nQ3nstarQ2nstar
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ9nQ6nstarQ3nstar)
-				 + reQ8nQ6nstarQ2nstar+reQ6nQ5nstarQ1nstar+reQ6nQ5nstarQ1nstar
-                 + reQ9nQ5nstarQ4nstar+reQ9nQ8nstarQ1nstar+reQ9nQ5nstarQ4nstar
-				 + reQ8nQ5nstarQ3nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar				 
-				 + reQ5nQ3nstarQ2nstar+reQ4nQ2nstarQ2nstar+reQ2nQ1nstarQ1nstar				 
-				 + reQ5nQ3nstarQ2nstar+reQ4nQ2nstarQ2nstar+reQ2nQ1nstarQ1nstar
-                 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ8nQ4nstarQ4nstar)
-                 + 2.*(reQ3nQ2nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))				 
-				 - 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.))
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+  fIntFlowCorrelationsAllPro->Fill(60.5,five6n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+  fIntFlowCorrelationsAllPro->Fill(61.5,five4n1n1n3n3n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+  if(fCalculateAllCorrelationsVsM)
+  {
+   fIntFlowCorrelationsAllVsMPro[52]->Fill(dMultiplicityBin,five3n3n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+   fIntFlowCorrelationsAllVsMPro[53]->Fill(dMultiplicityBin,five4n2n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+   fIntFlowCorrelationsAllVsMPro[54]->Fill(dMultiplicityBin,five3n2n3n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+   fIntFlowCorrelationsAllVsMPro[55]->Fill(dMultiplicityBin,five3n2n2n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+   fIntFlowCorrelationsAllVsMPro[56]->Fill(dMultiplicityBin,five5n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+   fIntFlowCorrelationsAllVsMPro[60]->Fill(dMultiplicityBin,five6n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+   fIntFlowCorrelationsAllVsMPro[61]->Fill(dMultiplicityBin,five4n1n1n3n3n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+  }         
+ } // end of if(dMult>4)
 
-  // to be polished:
-  five6n1n1n5n3n = (reQ6nQ1nQ1nQ5nstarQ3nstar
-                 - reQ6nQ2nQ5nstarQ3nstar-reQ7nQ1nQ5nstarQ3nstar-reQ7nQ1nQ5nstarQ3nstar
-                 - reQ6nQ1nQ5nstarQ2nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ6nQ1nQ5nstarQ2nstar
-				 - reQ8nQ6nstarQ1nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar-reQ3nQ1nstarQ1nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar
-				 + 2.*(reQ6nQ5nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ8nQ5nstarQ3nstar)
-				 + reQ5nQ3nstarQ2nstar+reQ7nQ5nstarQ2nstar+reQ7nQ5nstarQ2nstar
-                 + reQ8nQ7nstarQ1nstar+reQ8nQ6nstarQ2nstar+reQ8nQ7nstarQ1nstar
- 				 + reQ3nQ2nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar
-				 + reQ7nQ4nstarQ3nstar+reQ4nQ3nstarQ1nstar+reQ6nQ4nstarQ2nstar				 				 				 
-				 + reQ7nQ4nstarQ3nstar+reQ4nQ3nstarQ1nstar+reQ6nQ4nstarQ2nstar				 				 				 
-                 + 2.*(reQ7nQ6nstarQ1nstar+reQ7nQ6nstarQ1nstar+reQ2nQ1nstarQ1nstar)
-                 + 2.*(reQ6nQ3nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.))
-				 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-                 - 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n3n5n2n2n = (reQ6nQ3nQ5nstarQ2nstarQ2nstar
-                 - reQ6nQ3nQ5nstarQ4nstar-reQ7nQ2nQ6nstarQ3nstar-reQ7nQ2nQ6nstarQ3nstar
-                 - reQ6nQ1nQ5nstarQ2nstar-reQ6nQ2nstarQ2nstarQ2nstar-reQ6nQ1nQ5nstarQ2nstar		     	 
-				 - reQ9nQ5nstarQ2nstarQ2nstar-reQ5nQ2nQ4nstarQ3nstar-reQ3nQ1nQ2nstarQ2nstar-reQ5nQ2nQ4nstarQ3nstar
-				 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ4nstarQ2nstar+reQ6nQ4nstarQ2nstar+reQ9nQ6nstarQ3nstar)
-				 + reQ6nQ4nstarQ2nstar+reQ7nQ6nstarQ1nstar+reQ7nQ6nstarQ1nstar
-                 + reQ9nQ7nstarQ2nstar+reQ9nQ5nstarQ4nstar+reQ9nQ7nstarQ2nstar
-				 + reQ4nQ3nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ2nQ1nstarQ1nstar				 
-				 + reQ7nQ4nstarQ3nstar+reQ4nQ2nstarQ2nstar+reQ5nQ4nstarQ1nstar				 
-				 + reQ7nQ4nstarQ3nstar+reQ4nQ2nstarQ2nstar+reQ5nQ4nstarQ1nstar
-                 + 2.*(reQ7nQ5nstarQ2nstar+reQ7nQ5nstarQ2nstar+reQ4nQ2nstarQ2nstar)
-                 + 2.*(reQ5nQ3nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.))
-				 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))				 
-				 - 6.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+ // 6-particle:
+ Double_t six3n2n1n3n2n1n = 0.; // <cos(n(3*phi1+2*phi2+1*phi3-3*phi4-2*phi5-1*phi6)>
+ Double_t six3n3n2n2n1n1n = 0.; // <cos(n(3*phi1+3*phi2-2*phi3-2*phi4-1*phi5-1*phi6)>   
+ if(dMult>5.)
+ { 
+  six3n2n1n3n2n1n = (dQ3nQ2nQ1nQ3nstarQ2nstarQ1nstar-2.*reQ3nQ3nQ3nstarQ2nstarQ1nstar
+                  - 2.*reQ3nQ2nQ2nstarQ2nstarQ1nstar-2.*reQ3nQ1nQ2nstarQ1nstarQ1nstar
+                  - 2.*reQ3nQ2nQ3nstarQ1nstarQ1nstar-2.*reQ4nQ2nQ3nstarQ2nstarQ1nstar
+                  - 2.*reQ5nQ1nQ3nstarQ2nstarQ1nstar+4.*reQ6nQ3nstarQ2nstarQ1nstar
+                  + 2.*reQ5nQ1nQ4nstarQ2nstar+2.*reQ5nQ1nQ3nstarQ3nstar
+                  + 2.*reQ4nQ2nQ3nstarQ3nstar+6.*reQ4nQ1nQ3nstarQ2nstar
+                  + 2.*reQ5nQ3nstarQ1nstarQ1nstar+2.*reQ5nQ2nstarQ2nstarQ1nstar
+                  + 6.*reQ3nQ1nQ2nstarQ2nstar+2.*reQ4nQ2nstarQ1nstarQ1nstar
+                  - 4.*reQ6nQ5nstarQ1nstar-4.*reQ6nQ4nstarQ2nstar-6.*reQ5nQ4nstarQ1nstar
+                  - 4.*reQ6nQ3nstarQ3nstar+2.*(dMult-11.)*reQ5nQ3nstarQ2nstar
+                  + 2.*(dMult-13.)*reQ4nQ3nstarQ1nstar-8.*reQ4nQ2nstarQ2nstar
+                  + 2.*(5.*dMult-32.)*reQ3nQ2nstarQ1nstar+2.*reQ3nQ1nstarQ1nstarQ1nstar
+                  + 2.*(dMult-13.)*reQ2nQ1nstarQ1nstar
+                  - (dMult-10.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
+                  + (pow(dReQ5n,2.)+pow(dImQ5n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
+                  + (pow(dReQ4n,2.)+pow(dImQ4n,2.))*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
+                  - (dMult-11.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
+                  - (dMult-10.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
+                  + 4.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))-(dMult-12.)*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
+                  - (dMult-16.)*(pow(dReQ4n,2.)+pow(dImQ4n,2.))+pow((pow(dReQ3n,2.)+pow(dImQ3n,2.)),2.)
+                  + (dMult*dMult-19.*dMult+68.)*(pow(dReQ3n,2.)+pow(dImQ3n,2.))
+                  + (dMult*dMult-19.*dMult+72.)*(pow(dReQ2n,2.)+pow(dImQ2n,2.))
+                  + pow((pow(dReQ2n,2.)+pow(dImQ2n,2.)),2.)+pow((pow(dReQ1n,2.)+pow(dImQ1n,2.)),2.)
+                  + (dMult*dMult-20.*dMult+80.)*(pow(dReQ1n,2.)+pow(dImQ1n,2.))
+                  - dMult*(dMult-12.)*(dMult-10.))
+                  / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));   
+  
+  // Peter Jochumzsen:
+  six3n3n2n2n1n1n = (reQ3nQ3nQ2nstarQ2nstarQ1nstarQ1nstar
+                  + (80.-16.*dMult)*pow(dReQ1n,2.)+(80.-16.*dMult)*pow(dImQ1n,2.)
+                  + (78.-16.*dMult)*pow(dReQ2n,2.)+(78.-16.*dMult)*pow(dImQ2n,2.)
+                  + (72.-16.*dMult)*pow(dReQ3n,2.)+(72.-16.*dMult)*pow(dImQ3n,2.)
+                  + 14.*pow(dReQ4n,2.)+14.*pow(dImQ4n,2.)
+                  + 8.*pow(dReQ5n,2.)+8.*pow(dImQ5n,2.)
+                  + 6.*pow(dReQ6n,2.)+6.*pow(dImQ6n,2.)
+                  + 1.*reQ6nQ2nstarQ2nstarQ2nstar - 1.*reQ6nQ2nstarQ2nstarQ1nstarQ1nstar
+                  - 76.*reQ3nQ2nstarQ1nstar + 4.*reQ3nQ1nstarQ1nstarQ1nstar
+                  - 8.*reQ3nQ2nstarQ1nstar + 8.*dQ2nQ1nQ2nstarQ1nstar
+                  + 4.*reQ5nQ2nstarQ2nstarQ1nstar - 2.*reQ6nQ3nstarQ3nstar
+                  + 4.*reQ6nQ3nstarQ2nstarQ1nstar - 4.*reQ5nQ4nstarQ1nstar
+                  + 16.*dMult*reQ3nQ2nstarQ1nstar - 2.*reQ4nQ2nstarQ2nstar
+                  - 4.*reQ3nQ3nQ3nstarQ2nstarQ1nstar -8.*reQ4nQ3nstarQ1nstar
+                  - 10.*reQ4nQ2nstarQ2nstar + 4.*reQ4nQ2nstarQ1nstarQ1nstar
+                  - 12.*reQ4nQ3nstarQ1nstar + 8.*dQ3nQ1nQ3nstarQ1nstar
+                  + 8.*reQ3nQ1nQ2nstarQ2nstar - 4.*reQ3nQ1nQ2nstarQ1nstarQ1nstar
+                  + 5.*reQ4nQ2nQ3nstarQ3nstar+2.*pow(pow(dReQ2n,2.)+pow(dImQ2n,2.),2.)
+                  + 4.*reQ5nQ1nQ3nstarQ3nstar+2.*pow(pow(dReQ3n,2.)+pow(dImQ3n,2.),2.)
+                  - 6.*reQ6nQ3nstarQ3nstar - 14.*reQ2nQ1nstarQ1nstar
+                  - 1.*reQ3nQ3nQ2nstarQ2nstarQ2nstar-4.*reQ3nQ2nQ2nstarQ2nstarQ1nstar
+                  - 1.*reQ4nQ1nQ1nQ3nstarQ3nstar-8.*reQ5nQ3nstarQ2nstar
+                  + 2.*pow(pow(dReQ1n,2.)+pow(dImQ1n,2.),2.) - 10.*reQ2nQ1nstarQ1nstar
+                  - 4.*reQ6nQ5nstarQ1nstar-5.*reQ6nQ4nstarQ2nstar
+                  + 1.*reQ6nQ4nstarQ1nstarQ1nstar-8.*reQ5nQ3nstarQ2nstar
+                  + 4.*reQ4nQ1nQ3nstarQ2nstar+8.*dQ3nQ2nQ3nstarQ2nstar
+                  - 120.*dMult + 16.*dMult*dMult)
+                  / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
 
-  // to be polished 
-  five6n5n4n4n3n = (reQ6nQ5nQ4nstarQ4nstarQ3nstar
-                 - reQ7nQ4nQ6nstarQ5nstar-reQ7nQ4nQ6nstarQ5nstar-reQ8nQ3nQ6nstarQ5nstar
-                 - reQ6nQ1nQ4nstarQ3nstar-reQ6nQ1nQ4nstarQ3nstar-reQ6nQ2nQ4nstarQ4nstar		     	 
-				 - reQ11nQ4nstarQ4nstarQ3nstar-reQ5nQ3nQ4nstarQ4nstar-reQ5nQ2nQ4nstarQ3nstar-reQ5nQ2nQ4nstarQ3nstar
-				 + 2.*(reQ6nQ4nstarQ2nstar+reQ6nQ3nstarQ3nstar+reQ6nQ4nstarQ2nstar+reQ11nQ6nstarQ5nstar)
-				 + reQ7nQ6nstarQ1nstar+reQ7nQ6nstarQ1nstar+reQ8nQ6nstarQ2nstar
-                 + reQ11nQ8nstarQ3nstar+reQ11nQ7nstarQ4nstar+reQ11nQ7nstarQ4nstar
-				 + reQ7nQ5nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ4nQ2nstarQ2nstar				 				 
-				 + reQ7nQ5nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ4nQ2nstarQ2nstar				 
-				 + reQ8nQ5nstarQ3nstar+reQ4nQ3nstarQ1nstar+reQ4nQ3nstarQ1nstar
-                 + 2.*(reQ8nQ4nstarQ4nstar+reQ7nQ4nstarQ3nstar+reQ7nQ4nstarQ3nstar)
-                 + 2.*(reQ5nQ4nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ11n,2.)+pow(dImQ11n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.))
-				 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))				 
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n3n1n5n5n = (reQ6nQ3nQ1nQ5nstarQ5nstar
-                 - reQ6nQ4nQ5nstarQ5nstar-reQ7nQ3nQ5nstarQ5nstar-reQ9nQ1nQ5nstarQ5nstar      
-				 - reQ6nQ1nQ5nstarQ2nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ6nQ3nQ5nstarQ4nstar
-				 - reQ10nQ6nstarQ3nstarQ1nstar-reQ6nQ3nQ5nstarQ4nstar-reQ5nQ3nstarQ1nstarQ1nstar-reQ6nQ1nQ5nstarQ2nstar
-				 + 2.*(reQ6nQ5nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ10nQ5nstarQ5nstar)
-				 + reQ5nQ4nstarQ1nstar+reQ7nQ5nstarQ2nstar+reQ9nQ5nstarQ4nstar
-                 + reQ10nQ9nstarQ1nstar+reQ10nQ6nstarQ4nstar+reQ10nQ7nstarQ3nstar
- 				 + reQ5nQ4nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ4nQ3nstarQ1nstar
-				 + reQ7nQ5nstarQ2nstar+reQ2nQ1nstarQ1nstar+reQ6nQ4nstarQ2nstar				 				 				 
-				 + reQ9nQ5nstarQ4nstar+reQ4nQ3nstarQ1nstar+reQ6nQ4nstarQ2nstar				 				 				 
-                 + 2.*(reQ9nQ6nstarQ3nstar+reQ7nQ6nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ9n,2.)+pow(dImQ9n,2.))
-				 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // to be polished:
-  five6n6n5n4n3n = (reQ6nQ6nQ5nstarQ4nstarQ3nstar
-                 - reQ7nQ5nQ6nstarQ6nstar-reQ8nQ4nQ6nstarQ6nstar-reQ9nQ3nQ6nstarQ6nstar
-				 - reQ6nQ2nQ5nstarQ3nstar-reQ6nQ1nQ4nstarQ3nstar-reQ6nQ3nQ5nstarQ4nstar		     	 
-				 - reQ12nQ5nstarQ4nstarQ3nstar-reQ6nQ3nQ5nstarQ4nstar-reQ6nQ1nQ4nstarQ3nstar-reQ6nQ2nQ5nstarQ3nstar
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ3nstarQ3nstar+reQ6nQ4nstarQ2nstar+reQ12nQ6nstarQ6nstar)
-				 + reQ7nQ6nstarQ1nstar+reQ8nQ6nstarQ2nstar+reQ9nQ6nstarQ3nstar
-                 + reQ12nQ9nstarQ3nstar+reQ12nQ7nstarQ5nstar+reQ12nQ8nstarQ4nstar
-				 + reQ7nQ6nstarQ1nstar+reQ3nQ2nstarQ1nstar+reQ4nQ3nstarQ1nstar				 				 
-				 + reQ8nQ6nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ5nQ3nstarQ2nstar				 
-				 + reQ9nQ6nstarQ3nstar+reQ4nQ3nstarQ1nstar+reQ5nQ3nstarQ2nstar
-                 + 2.*(reQ9nQ5nstarQ4nstar+reQ8nQ5nstarQ3nstar+reQ7nQ4nstarQ3nstar)
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ4nstarQ2nstar+reQ6nQ3nstarQ3nstar)
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-				 - 2.*(pow(dReQ12n,2.)+pow(dImQ12n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ9n,2.)+pow(dImQ9n,2.))
-				 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))				 
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.))
-				 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
-  // Five distinct harmonics (3):
-
-  // to be polished:
-  five6n2n4n3n1n = (reQ6nQ2nQ4nstarQ3nstarQ1nstar
-	             - reQ6nQ2nQ4nstarQ4nstar-reQ6nQ2nQ5nstarQ3nstar-reQ7nQ1nQ6nstarQ2nstar
-	             - reQ6nQ4nstarQ1nstarQ1nstar-reQ6nQ3nstarQ2nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar
-	             - reQ8nQ4nstarQ3nstarQ1nstar-reQ5nQ2nQ4nstarQ3nstar-reQ3nQ1nQ2nstarQ2nstar-reQ4nQ1nQ3nstarQ2nstar
-				 + 2.*(reQ6nQ4nstarQ2nstar+reQ6nQ5nstarQ1nstar+reQ6nQ3nstarQ3nstar+reQ8nQ6nstarQ2nstar)
-				 + 1.*(reQ6nQ4nstarQ2nstar+reQ6nQ5nstarQ1nstar+reQ7nQ6nstarQ1nstar)
-				 + 1.*(reQ8nQ7nstarQ1nstar+reQ8nQ4nstarQ4nstar+reQ8nQ5nstarQ3nstar)
-				 + 1.*(reQ4nQ2nstarQ2nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 + 1.*(reQ5nQ3nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ4nQ3nstarQ1nstar)
-				 + 1.*(reQ7nQ5nstarQ2nstar+reQ5nQ3nstarQ2nstar+reQ5nQ4nstarQ1nstar)
-				 + 2.*(reQ7nQ4nstarQ3nstar+reQ5nQ4nstarQ1nstar+reQ4nQ3nstarQ1nstar)
- 				 + 2.*(reQ4nQ2nstarQ2nstar+reQ3nQ2nstarQ1nstar+reQ2nQ1nstarQ1nstar) // 3 - 1
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ8n,2.)+pow(dImQ8n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 2.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)) 
-	     		 - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)) 
-                 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+  // Average 6-particle correlations for all events:      
+  fIntFlowCorrelationsAllPro->Fill(57.5,six3n2n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
+  fIntFlowCorrelationsAllPro->Fill(62.5,six3n3n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
+  if(fCalculateAllCorrelationsVsM)
+  {
+   fIntFlowCorrelationsAllVsMPro[57]->Fill(dMultiplicityBin,six3n2n1n3n2n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
+   fIntFlowCorrelationsAllVsMPro[62]->Fill(dMultiplicityBin,six3n3n2n2n1n1n,dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.));
+  }          
+ } // end of if(dMult>5.)
+ 
+ // |Qn|^2/M, |Q2n|^2/M, |Qn|^4/(M(2M-1)), Re[Q2nQn^*Qn^*]/M, ... vs multiplicity (#RPs, #POIs or external):
+ if(fUseQvectorTerms)
+ {
+  Double_t dM = dMultiplicityBin-0.5;
+  if(dM>1.) // TBI re-think this if statement 
+  {
+   fQvectorTermsVsMult[0]->Fill(dMultiplicityBin,(pow(dReQ1n,2.)+pow(dImQ1n,2.))/dM);
+   fQvectorTermsVsMult[1]->Fill(dMultiplicityBin,(pow(dReQ2n,2.)+pow(dImQ2n,2.))/dM);
+   fQvectorTermsVsMult[2]->Fill(dMultiplicityBin,(pow(pow(dReQ1n,2.)+pow(dImQ1n,2.),2.))/(dM*(2.*dM-1.)));
+   fQvectorTermsVsMult[3]->Fill(dMultiplicityBin,reQ2nQ1nstarQ1nstar/pow(dM,1.5)); // TBI a bit of heuristic inserted here, re-think the rescaling factor 
+  } // end of if(dM>1.) // TBI re-think this if statement 
+ } // end of if(fUseQvectorTerms)
 
+ // Bootstrap:
+ if(fUseBootstrap||fUseBootstrapVsM)
+ {
+  Double_t nSampleNo = 1.*fSubsampleIndexEBE + 0.5;
+  if(fUseBootstrap)
+  {
+   fBootstrapCorrelations->Fill(0.5,nSampleNo,two1n1n,mWeight2p); 
+   fBootstrapCorrelations->Fill(1.5,nSampleNo,four1n1n1n1n,mWeight4p);
+   fBootstrapCorrelations->Fill(2.5,nSampleNo,six1n1n1n1n1n1n,mWeight6p); 
+   fBootstrapCorrelations->Fill(3.5,nSampleNo,eight1n1n1n1n1n1n1n1n,mWeight8p); 
+  } // end of if(fUseBootstrap)
+  if(fUseBootstrapVsM)
+  {
+   fBootstrapCorrelationsVsM[0]->Fill(dMultiplicityBin,nSampleNo,two1n1n,mWeight2p); 
+   fBootstrapCorrelationsVsM[1]->Fill(dMultiplicityBin,nSampleNo,four1n1n1n1n,mWeight4p); 
+   fBootstrapCorrelationsVsM[2]->Fill(dMultiplicityBin,nSampleNo,six1n1n1n1n1n1n,mWeight6p); 
+   fBootstrapCorrelationsVsM[3]->Fill(dMultiplicityBin,nSampleNo,eight1n1n1n1n1n1n1n1n,mWeight8p); 
+  } // end of if(fUseBootstrapVsM) 
+ } // end of if(fUseBootstrap||fUseBootstrapVsM)
 
-  // to be polished:
-  five6n2n1n5n4n = (reQ6nQ2nQ1nQ5nstarQ4nstar
-                 - reQ6nQ3nQ5nstarQ4nstar-reQ7nQ2nQ5nstarQ4nstar-reQ8nQ1nQ5nstarQ4nstar
-				 - reQ6nQ1nQ5nstarQ2nstar-reQ5nQ2nstarQ2nstarQ1nstar-reQ6nQ2nQ5nstarQ3nstar		     	 
-				 - reQ9nQ6nstarQ2nstarQ1nstar-reQ6nQ2nQ4nstarQ4nstar-reQ4nQ2nstarQ1nstarQ1nstar-reQ6nQ1nQ4nstarQ3nstar
-                 + 2.*(reQ6nQ5nstarQ1nstar+reQ5nQ4nstarQ1nstar+reQ5nQ3nstarQ2nstar+reQ9nQ5nstarQ4nstar)
-				 + reQ5nQ3nstarQ2nstar+reQ7nQ5nstarQ2nstar+reQ8nQ5nstarQ3nstar
-                 + reQ9nQ8nstarQ1nstar+reQ9nQ6nstarQ3nstar+reQ9nQ7nstarQ2nstar
-				 + reQ4nQ3nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar				 
-				 + reQ7nQ4nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ6nQ3nstarQ3nstar				 
-				 + reQ8nQ4nstarQ4nstar+reQ4nQ2nstarQ2nstar+reQ6nQ4nstarQ2nstar
-                 + 2.*(reQ8nQ6nstarQ2nstar+reQ7nQ6nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-                 + 2.*(reQ6nQ4nstarQ2nstar+reQ4nQ2nstarQ2nstar+reQ4nQ3nstarQ1nstar)
-				 - 6.*(pow(dReQ5n,2.)+pow(dImQ5n,2.))
-				 - 2.*(pow(dReQ9n,2.)+pow(dImQ9n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-				 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.))
-				 - 2.*(pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.))				 
-				 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ6n,2.)+pow(dImQ6n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.))
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+ return;
 
+} // end of AliFlowAnalysisWithQCumulants::CalculateIntFlowCorrelations()
 
+//=====================================================================================================
 
-  // to be polished:
-  five6n4n5n3n2n = (reQ6nQ4nQ5nstarQ3nstarQ2nstar
-	             - reQ6nQ4nQ5nstarQ5nstar-reQ7nQ3nQ6nstarQ4nstar-reQ8nQ2nQ6nstarQ4nstar
-	             - reQ6nQ1nQ5nstarQ2nstar-reQ6nQ3nstarQ2nstarQ1nstar-reQ6nQ2nQ5nstarQ3nstar
-	             - reQ10nQ5nstarQ3nstarQ2nstar-reQ5nQ3nQ4nstarQ4nstar-reQ4nQ1nQ3nstarQ2nstar-reQ5nQ2nQ4nstarQ3nstar
-				 + 2.*(reQ6nQ5nstarQ1nstar+reQ6nQ4nstarQ2nstar+reQ6nQ3nstarQ3nstar+reQ10nQ6nstarQ4nstar)
-				 + 1.*(reQ6nQ5nstarQ1nstar+reQ7nQ6nstarQ1nstar+reQ8nQ6nstarQ2nstar)
-				 + 1.*(reQ10nQ8nstarQ2nstar+reQ10nQ5nstarQ5nstar+reQ10nQ7nstarQ3nstar)
-				 + 1.*(reQ5nQ4nstarQ1nstar+reQ2nQ1nstarQ1nstar+reQ3nQ2nstarQ1nstar)
-				 + 1.*(reQ7nQ4nstarQ3nstar+reQ3nQ2nstarQ1nstar+reQ5nQ3nstarQ2nstar)
-				 + 1.*(reQ8nQ4nstarQ4nstar+reQ4nQ3nstarQ1nstar+reQ5nQ4nstarQ1nstar)
-				 + 2.*(reQ8nQ5nstarQ3nstar+reQ7nQ5nstarQ2nstar+reQ5nQ3nstarQ2nstar)
- 				 + 2.*(reQ5nQ4nstarQ1nstar+reQ4nQ3nstarQ1nstar+reQ4nQ2nstarQ2nstar) // 3 - 1
-				 - 6.*(pow(dReQ6n,2.)+pow(dImQ6n,2.))
-                 - 2.*(pow(dReQ10n,2.)+pow(dImQ10n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)+pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 2.*(pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ7n,2.)+pow(dImQ7n,2.)+pow(dReQ8n,2.)+pow(dImQ8n,2.)) 
-	     		 - 2.*(pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)+pow(dReQ1n,2.)+pow(dImQ1n,2.)) 
-                 - 6.*(pow(dReQ4n,2.)+pow(dImQ4n,2.)+pow(dReQ5n,2.)+pow(dImQ5n,2.)+pow(dReQ2n,2.)+pow(dImQ2n,2.)+pow(dReQ3n,2.)+pow(dImQ3n,2.)) 
-                 + 24.*dMult) 
-                 / (dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.));
+void AliFlowAnalysisWithQCumulants::CalculateMixedHarmonics()
+{
+ // Calculate in this method all multi-particle azimuthal correlations in mixed harmonics.
+ // (Remark: For completeness sake, we also calculate here again correlations in the same harmonic.) 
+ // All correlators are evaluated with the generic recursion in MixedHarmonicsRecursion(),
+ // the harmonics of each correlator are listed in the table in c).
 
+ // a) Access multiplicity of current event; 
+ // b) Determine multiplicity weights and fill some histos;
+ // c) Calculate 2-p, 3-p, 4-p and 5-p correlations;
+ // d) Calculate products of mixed harmonics.
 
+ // a) Access multiplicity of current event:
+ // Multiplicity of an event: 
+ Double_t dMult = (*fSpk)(0,0);
+ // All mixed correlators:
+ Double_t allMixedCorrelators[139] = {0.};
+ // Numerators cached in the previous event are not valid anymore:
+ fMixedHarmonicsRecursionCache.clear();
 
-  f5pCorrelations->Fill(0.5,five3n2n3n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(1.5,five4n1n2n2n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(2.5,five4n2n3n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(3.5,five4n3n3n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(4.5,five4n2n4n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(5.5,five4n3n4n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(6.5,five5n1n3n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(7.5,five5n2n5n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(8.5,five5n2n4n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(9.5,five5n3n4n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(10.5,five5n4n4n3n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(11.5,five5n3n5n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(12.5,five5n4n5n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(13.5,five5n4n5n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(14.5,five6n1n3n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(15.5,five6n2n3n3n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(16.5,five6n1n4n2n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(17.5,five6n3n4n3n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(18.5,five6n4n4n3n3n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(19.5,five6n2n5n2n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(20.5,five6n3n5n3n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(21.5,five6n4n5n4n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(22.5,five6n5n5n3n3n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(23.5,five6n2n6n1n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(24.5,five6n3n6n2n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(25.5,five6n4n6n2n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(26.5,five6n4n6n3n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(27.5,five6n5n5n4n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(28.5,five6n5n6n3n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(29.5,five6n5n6n4n1n,d5pMultiplicityWeight);
-  //f5pCorrelations->Fill(30.5,-44.,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(31.5,five2n1n1n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(32.5,five2n2n2n1n1n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(33.5,five3n3n2n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(34.5,five4n1n1n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(35.5,five4n2n2n2n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(36.5,five4n4n4n2n2n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(37.5,five6n3n3n3n3n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(38.5,five6n6n4n4n4n,d5pMultiplicityWeight); 
-  f5pCorrelations->Fill(39.5,five6n6n6n3n3n,d5pMultiplicityWeight);
-  //f5pCorrelations->Fill(40.5,-44.,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(41.5,five3n1n2n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(42.5,five3n2n2n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(43.5,five3n3n3n2n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(44.5,five4n1n3n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(45.5,five4n1n1n3n3n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(46.5,five4n3n3n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(47.5,five4n4n3n3n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(48.5,five4n4n4n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(49.5,five5n2n1n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(50.5,five5n1n2n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(51.5,five5n2n3n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(52.5,five5n3n3n3n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(53.5,five5n1n4n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(54.5,five5n4n3n3n3n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(55.5,five5n4n4n4n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(56.5,five5n5n4n3n3n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(57.5,five5n5n4n4n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(58.5,five5n5n5n3n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(59.5,five5n5n5n4n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(60.5,five6n2n2n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(61.5,five6n3n1n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(62.5,five6n1n1n4n4n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(63.5,five6n1n5n1n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(64.5,five6n2n4n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(65.5,five6n4n4n4n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(66.5,five6n2n2n5n5n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(67.5,five6n5n5n5n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(68.5,five6n6n5n5n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(69.5,five6n6n6n4n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(70.5,five6n6n6n5n1n,d5pMultiplicityWeight);
-  //f5pCorrelations->Fill(71.5,-44.,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(72.5,five5n2n3n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(73.5,five5n1n1n4n3n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(74.5,five5n3n4n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(75.5,five5n2n1n4n4n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(76.5,five6n1n3n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(77.5,five6n3n4n4n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(78.5,five6n1n1n5n3n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(79.5,five6n3n5n2n2n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(80.5,five6n5n4n4n3n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(81.5,five6n3n1n5n5n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(82.5,five6n6n5n4n3n,d5pMultiplicityWeight);
-  //f5pCorrelations->Fill(83.5,-44.,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(84.5,five6n2n4n3n1n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(85.5,five6n2n1n5n4n,d5pMultiplicityWeight);
-  f5pCorrelations->Fill(86.5,five6n4n5n3n2n,d5pMultiplicityWeight);
-  allMixedCorrelators[56]=five3n2n3n1n1n;
-  allMixedCorrelators[57]=five4n1n2n2n1n;
-  allMixedCorrelators[58]=five4n2n3n2n1n;
-  allMixedCorrelators[59]=five4n3n3n2n2n;
-  allMixedCorrelators[60]=five4n2n4n1n1n;
-  allMixedCorrelators[61]=five4n3n4n2n1n;
-  allMixedCorrelators[62]=five5n1n3n2n1n;
-  allMixedCorrelators[63]=five5n2n5n1n1n;
-  allMixedCorrelators[64]=five5n2n4n2n1n;
-  allMixedCorrelators[65]=five5n3n4n3n1n;
-  allMixedCorrelators[66]=five5n4n4n3n2n;
-  allMixedCorrelators[67]=five5n3n5n2n1n;
-  allMixedCorrelators[68]=five5n4n5n2n2n;
-  allMixedCorrelators[69]=five5n4n5n3n1n;
-  allMixedCorrelators[70]=five6n1n3n3n1n;
-  allMixedCorrelators[71]=five6n2n3n3n2n;
-  allMixedCorrelators[72]=five6n1n4n2n1n;
-  allMixedCorrelators[73]=five6n3n4n3n2n;
-  allMixedCorrelators[74]=five6n4n4n3n3n;
-  allMixedCorrelators[75]=five6n2n5n2n1n;
-  allMixedCorrelators[76]=five6n3n5n3n1n;
-  allMixedCorrelators[77]=five6n4n5n4n1n;
-  allMixedCorrelators[78]=five6n5n5n3n3n;
-  allMixedCorrelators[79]=five6n2n6n1n1n;
-  allMixedCorrelators[80]=five6n3n6n2n1n;
-  allMixedCorrelators[81]=five6n4n6n2n2n;
-  allMixedCorrelators[82]=five6n4n6n3n1n;
-  allMixedCorrelators[83]=five6n5n5n4n2n;
-  allMixedCorrelators[84]=five6n5n6n3n2n;
-  allMixedCorrelators[85]=five6n5n6n4n1n;
-  allMixedCorrelators[86]=five2n1n1n1n1n;
-  allMixedCorrelators[87]=five2n2n2n1n1n;
-  allMixedCorrelators[88]=five3n3n2n2n2n;
-  allMixedCorrelators[89]=five4n1n1n1n1n;
-  allMixedCorrelators[90]=five4n2n2n2n2n;
-  allMixedCorrelators[91]=five4n4n4n2n2n;
-  allMixedCorrelators[92]=five6n3n3n3n3n;
-  allMixedCorrelators[93]=five6n6n4n4n4n;
-  allMixedCorrelators[94]=five6n6n6n3n3n;
-  allMixedCorrelators[95]=five3n1n2n1n1n;
-  allMixedCorrelators[96]=five3n2n2n2n1n;
-  allMixedCorrelators[97]=five3n3n3n2n1n;
-  allMixedCorrelators[98]=five4n1n3n1n1n;
-  allMixedCorrelators[99]=five4n1n1n3n3n;
-  allMixedCorrelators[100]=five4n3n3n3n1n;
-  allMixedCorrelators[101]=five4n4n3n3n2n;
-  allMixedCorrelators[102]=five4n4n4n3n1n;
-  allMixedCorrelators[103]=five5n2n1n1n1n;
-  allMixedCorrelators[104]=five5n1n2n2n2n;
-  allMixedCorrelators[105]=five5n2n3n2n2n;
-  allMixedCorrelators[106]=five5n3n3n3n2n;
-  allMixedCorrelators[107]=five5n1n4n1n1n;
-  allMixedCorrelators[108]=five5n4n3n3n3n;
-  allMixedCorrelators[109]=five5n4n4n4n1n;
-  allMixedCorrelators[110]=five5n5n4n3n3n;
-  allMixedCorrelators[111]=five5n5n4n4n2n;
-  allMixedCorrelators[112]=five5n5n5n3n2n;
-  allMixedCorrelators[113]=five5n5n5n4n1n;
-  allMixedCorrelators[114]=five6n2n2n1n1n;
-  allMixedCorrelators[115]=five6n3n1n1n1n;
-  allMixedCorrelators[116]=five6n1n1n4n4n;
-  allMixedCorrelators[117]=five6n1n5n1n1n;
-  allMixedCorrelators[118]=five6n2n4n2n2n;
-  allMixedCorrelators[119]=five6n4n4n4n2n;
-  allMixedCorrelators[120]=five6n2n2n5n5n;
-  allMixedCorrelators[121]=five6n5n5n5n1n;
-  allMixedCorrelators[122]=five6n6n5n5n2n;
-  allMixedCorrelators[123]=five6n6n6n4n2n;
-  allMixedCorrelators[124]=five6n6n6n5n1n;
-  allMixedCorrelators[125]=five5n2n3n3n1n;
-  allMixedCorrelators[126]=five5n1n1n4n3n;
-  allMixedCorrelators[127]=five5n3n4n2n2n;
-  allMixedCorrelators[128]=five5n2n1n4n4n;
-  allMixedCorrelators[129]=five6n1n3n2n2n;
-  allMixedCorrelators[130]=five6n3n4n4n1n;
-  allMixedCorrelators[131]=five6n1n1n5n3n;
-  allMixedCorrelators[132]=five6n3n5n2n2n;
-  allMixedCorrelators[133]=five6n5n4n4n3n;
-  allMixedCorrelators[134]=five6n3n1n5n5n;
-  allMixedCorrelators[135]=five6n6n5n4n3n;
-  allMixedCorrelators[136]=five6n2n4n3n1n;
-  allMixedCorrelators[137]=five6n2n1n5n4n;
-  allMixedCorrelators[138]=five6n4n5n3n2n;
- } // end of if(dMult>4.)
+ // b) Determine multiplicity weights and fill some histos:
+ Double_t d2pMultiplicityWeight = 0.; // weight for <2>_{...} to get <<2>>_{...}
+ Double_t d3pMultiplicityWeight = 0.; // weight for <3>_{...} to get <<3>>_{...}
+ Double_t d4pMultiplicityWeight = 0.; // weight for <4>_{...} to get <<4>>_{...}
+ Double_t d5pMultiplicityWeight = 0.; // weight for <5>_{...} to get <<5>>_{...}
+ Double_t d6pMultiplicityWeight = 0.; // weight for <6>_{...} to get <<6>>_{...}
+ Double_t d7pMultiplicityWeight = 0.; // weight for <7>_{...} to get <<7>>_{...}
+ Double_t d8pMultiplicityWeight = 0.; // weight for <8>_{...} to get <<8>>_{...}
+ if(fMultiplicityWeight->Contains("combinations")) // default multiplicity weight
+ {
+  d2pMultiplicityWeight = dMult*(dMult-1.);
+  d3pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.);
+  d4pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.);
+  d5pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.);
+  d6pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.);
+  d7pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.)*(dMult-6.);
+  d8pMultiplicityWeight = dMult*(dMult-1.)*(dMult-2.)*(dMult-3.)*(dMult-4.)*(dMult-5.)*(dMult-6.)*(dMult-7.);
+ } else if(fMultiplicityWeight->Contains("unit"))
+   {
+    d2pMultiplicityWeight = 1.;
+    d3pMultiplicityWeight = 1.;
+    d4pMultiplicityWeight = 1.;
+    d5pMultiplicityWeight = 1.;
+    d6pMultiplicityWeight = 1.;
+    d7pMultiplicityWeight = 1.;
+    d8pMultiplicityWeight = 1.;
+   } else if(fMultiplicityWeight->Contains("multiplicity"))
+     {
+      d2pMultiplicityWeight = dMult;
+      d3pMultiplicityWeight = dMult;
+      d4pMultiplicityWeight = dMult;
+      d5pMultiplicityWeight = dMult;
+      d6pMultiplicityWeight = dMult;
+      d7pMultiplicityWeight = dMult;
+      d8pMultiplicityWeight = dMult; 
+     }       
+ for(Int_t p=0;p<=1;p++) // power (0=linear,1=quadratic)
+ {
+  fMixedHarmonicEventWeights[p]->Fill(0.5,pow(dMult,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(1.5,pow(d2pMultiplicityWeight,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(2.5,pow(d3pMultiplicityWeight,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(3.5,pow(d4pMultiplicityWeight,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(4.5,pow(d5pMultiplicityWeight,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(5.5,pow(d6pMultiplicityWeight,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(6.5,pow(d7pMultiplicityWeight,p+1));
+  fMixedHarmonicEventWeights[p]->Fill(7.5,pow(d8pMultiplicityWeight,p+1));
+ } // end of for(Int_t p=0;p<=1;p++) // power (0=linear,1=quadratic)   
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,0.5,dMult*dMult);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,1.5,dMult*d2pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,2.5,dMult*d3pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,3.5,dMult*d4pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,4.5,dMult*d5pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,5.5,dMult*d6pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,6.5,dMult*d7pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(0.5,7.5,dMult*d8pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,1.5,d2pMultiplicityWeight*d2pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,2.5,d2pMultiplicityWeight*d3pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,3.5,d2pMultiplicityWeight*d4pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,4.5,d2pMultiplicityWeight*d5pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,5.5,d2pMultiplicityWeight*d6pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,6.5,d2pMultiplicityWeight*d7pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(1.5,7.5,d2pMultiplicityWeight*d8pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(2.5,2.5,d3pMultiplicityWeight*d3pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(2.5,3.5,d3pMultiplicityWeight*d4pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(2.5,4.5,d3pMultiplicityWeight*d5pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(2.5,5.5,d3pMultiplicityWeight*d6pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(2.5,6.5,d3pMultiplicityWeight*d7pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(2.5,7.5,d3pMultiplicityWeight*d8pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(3.5,3.5,d4pMultiplicityWeight*d4pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(3.5,4.5,d4pMultiplicityWeight*d5pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(3.5,5.5,d4pMultiplicityWeight*d6pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(3.5,6.5,d4pMultiplicityWeight*d7pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(3.5,7.5,d4pMultiplicityWeight*d8pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(4.5,4.5,d5pMultiplicityWeight*d5pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(4.5,5.5,d5pMultiplicityWeight*d6pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(4.5,6.5,d5pMultiplicityWeight*d7pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(4.5,7.5,d5pMultiplicityWeight*d8pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(5.5,5.5,d6pMultiplicityWeight*d6pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(5.5,6.5,d6pMultiplicityWeight*d7pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(5.5,7.5,d6pMultiplicityWeight*d8pMultiplicityWeight);
+ fMixedHarmonicProductOfEventWeights->Fill(6.5,6.5,d7pMultiplicityWeight*d7pMultiplicityWeight); 
+ fMixedHarmonicProductOfEventWeights->Fill(6.5,7.5,d7pMultiplicityWeight*d8pMultiplicityWeight); 
+ fMixedHarmonicProductOfEventWeights->Fill(7.5,7.5,d8pMultiplicityWeight*d8pMultiplicityWeight); 
  
- // Products of mixed harmonics:
+ // c) Calculate 2-p, 3-p, 4-p and 5-p correlations:
+ // Each row is {k, bin in f<k>pCorrelations counting from 0, h1, ..., hk} for <k> = <cos(n(h1*phi1+...+hk*phi_k))>.
+ // The rows are in the same order as allMixedCorrelators.
+ const Int_t nMixedCorrelators = 139;
+ static const Int_t mixedCorrelators[nMixedCorrelators][7] = {
+  // 2-p correlations:
+  {2, 0, 1,-1, 0, 0, 0}, // <2>_{1n|1n}
+  {2, 1, 2,-2, 0, 0, 0}, // <2>_{2n|2n}
+  {2, 2, 3,-3, 0, 0, 0}, // <2>_{3n|3n}
+  {2, 3, 4,-4, 0, 0, 0}, // <2>_{4n|4n}
+  {2, 4, 5,-5, 0, 0, 0}, // <2>_{5n|5n}
+  {2, 5, 6,-6, 0, 0, 0}, // <2>_{6n|6n}
+  // 3-p correlations:
+  {3, 0, 2,-1,-1, 0, 0}, // <3>_{2n|1n,1n}
+  {3, 1, 4,-2,-2, 0, 0}, // <3>_{4n|2n,2n}
+  {3, 2, 6,-3,-3, 0, 0}, // <3>_{6n|3n,3n}
+  {3, 4, 3,-2,-1, 0, 0}, // <3>_{3n|2n,1n}
+  {3, 5, 4,-3,-1, 0, 0}, // <3>_{4n|3n,1n}
+  {3, 6, 5,-3,-2, 0, 0}, // <3>_{5n|3n,2n}
+  {3, 7, 5,-4,-1, 0, 0}, // <3>_{5n|4n,1n}
+  {3, 8, 6,-4,-2, 0, 0}, // <3>_{6n|4n,2n}
+  {3, 9, 6,-5,-1, 0, 0}, // <3>_{6n|5n,1n}
+  // 4-p correlations:
+  {4, 0, 1, 1,-1,-1, 0}, // <4>_{1n,1n|1n,1n}
+  {4, 1, 2, 2,-2,-2, 0}, // <4>_{2n,2n|2n,2n}
+  {4, 2, 3, 3,-3,-3, 0}, // <4>_{3n,3n|3n,3n}
+  {4, 3, 4, 4,-4,-4, 0}, // <4>_{4n,4n|4n,4n}
+  {4, 4, 5, 5,-5,-5, 0}, // <4>_{5n,5n|5n,5n}
+  {4, 5, 6, 6,-6,-6, 0}, // <4>_{6n,6n|6n,6n}
+  {4, 7, 2, 1,-2,-1, 0}, // <4>_{2n,1n|2n,1n}
+  {4, 8, 3, 1,-3,-1, 0}, // <4>_{3n,1n|3n,1n}
+  {4, 9, 3, 2,-3,-2, 0}, // <4>_{3n,2n|3n,2n}
+  {4,10, 4, 1,-4,-1, 0}, // <4>_{4n,1n|4n,1n}
+  {4,11, 4, 2,-4,-2, 0}, // <4>_{4n,2n|4n,2n}
+  {4,12, 4, 3,-4,-3, 0}, // <4>_{4n,3n|4n,3n}
+  {4,13, 5, 1,-5,-1, 0}, // <4>_{5n,1n|5n,1n}
+  {4,14, 5, 2,-5,-2, 0}, // <4>_{5n,2n|5n,2n}
+  {4,15, 5, 3,-5,-3, 0}, // <4>_{5n,3n|5n,3n}
+  {4,16, 5, 4,-5,-4, 0}, // <4>_{5n,4n|5n,4n}
+  {4,17, 6, 1,-6,-1, 0}, // <4>_{6n,1n|6n,1n}
+  {4,18, 6, 2,-6,-2, 0}, // <4>_{6n,2n|6n,2n}
+  {4,19, 6, 3,-6,-3, 0}, // <4>_{6n,3n|6n,3n}
+  {4,20, 6, 4,-6,-4, 0}, // <4>_{6n,4n|6n,4n}
+  {4,21, 6, 5,-6,-5, 0}, // <4>_{6n,5n|6n,5n}
+  {4,23, 3,-1,-1,-1, 0}, // <4>_{3n|1n,1n,1n}
+  {4,24, 6,-2,-2,-2, 0}, // <4>_{6n|2n,2n,2n}
+  {4,26, 3, 1,-2,-2, 0}, // <4>_{3n,1n|2n,2n}
+  {4,27, 4,-2,-1,-1, 0}, // <4>_{4n|2n,1n,1n}
+  {4,28, 4, 2,-3,-3, 0}, // <4>_{4n,2n|3n,3n}
+  {4,29, 5,-2,-2,-1, 0}, // <4>_{5n|2n,2n,1n}
+  {4,30, 5,-3,-1,-1, 0}, // <4>_{5n|3n,1n,1n}
+  {4,31, 5, 1,-3,-3, 0}, // <4>_{5n,1n|3n,3n}
+  {4,32, 5, 3,-4,-4, 0}, // <4>_{5n,3n|4n,4n}
+  {4,33, 6,-4,-1,-1, 0}, // <4>_{6n|4n,1n,1n}
+  {4,34, 6, 2,-4,-4, 0}, // <4>_{6n,2n|4n,4n}
+  {4,35, 6, 4,-5,-5, 0}, // <4>_{6n,4n|5n,5n}
+  {4,37, 4, 1,-3,-2, 0}, // <4>_{4n,1n|3n,2n}
+  {4,38, 5, 1,-4,-2, 0}, // <4>_{5n,1n|4n,2n}
+  {4,39, 5, 2,-4,-3, 0}, // <4>_{5n,2n|4n,3n}
+  {4,40, 6, 1,-4,-3, 0}, // <4>_{6n,1n|4n,3n}
+  {4,41, 6, 1,-5,-2, 0}, // <4>_{6n,1n|5n,2n}
+  {4,42, 6,-3,-2,-1, 0}, // <4>_{6n|3n,2n,1n}
+  {4,43, 6, 2,-5,-3, 0}, // <4>_{6n,2n|5n,3n}
+  {4,44, 6, 3,-5,-4, 0}, // <4>_{6n,3n|5n,4n}
+  // 5-p correlations:
+  {5, 0, 3, 2,-3,-1,-1}, // <5>_{3n,2n|3n,1n,1n}
+  {5, 1, 4, 1,-2,-2,-1}, // <5>_{4n,1n|2n,2n,1n}
+  {5, 2, 4, 2,-3,-2,-1}, // <5>_{4n,2n|3n,2n,1n}
+  {5, 3, 4, 3,-3,-2,-2}, // <5>_{4n,3n|3n,2n,2n}
+  {5, 4, 4, 2,-4,-1,-1}, // <5>_{4n,2n|4n,1n,1n}
+  {5, 5, 4, 3,-4,-2,-1}, // <5>_{4n,3n|4n,2n,1n}
+  {5, 6, 5, 1,-3,-2,-1}, // <5>_{5n,1n|3n,2n,1n}
+  {5, 7, 5, 2,-5,-1,-1}, // <5>_{5n,2n|5n,1n,1n}
+  {5, 8, 5, 2,-4,-2,-1}, // <5>_{5n,2n|4n,2n,1n}
+  {5, 9, 5, 3,-4,-3,-1}, // <5>_{5n,3n|4n,3n,1n}
+  {5,10, 5, 4,-4,-3,-2}, // <5>_{5n,4n|4n,3n,2n}
+  {5,11, 5, 3,-5,-2,-1}, // <5>_{5n,3n|5n,2n,1n}
+  {5,12, 5, 4,-5,-2,-2}, // <5>_{5n,4n|5n,2n,2n}
+  {5,13, 5, 4,-5,-3,-1}, // <5>_{5n,4n|5n,3n,1n}
+  {5,14, 6, 1,-3,-3,-1}, // <5>_{6n,1n|3n,3n,1n}
+  {5,15, 6, 2,-3,-3,-2}, // <5>_{6n,2n|3n,3n,2n}
+  {5,16, 6, 1,-4,-2,-1}, // <5>_{6n,1n|4n,2n,1n}
+  {5,17, 6, 3,-4,-3,-2}, // <5>_{6n,3n|4n,3n,2n}
+  {5,18, 6, 4,-4,-3,-3}, // <5>_{6n,4n|4n,3n,3n}
+  {5,19, 6, 2,-5,-2,-1}, // <5>_{6n,2n|5n,2n,1n}
+  {5,20, 6, 3,-5,-3,-1}, // <5>_{6n,3n|5n,3n,1n}
+  {5,21, 6, 4,-5,-4,-1}, // <5>_{6n,4n|5n,4n,1n}
+  {5,22, 6, 5,-5,-3,-3}, // <5>_{6n,5n|5n,3n,3n}
+  {5,23, 6, 2,-6,-1,-1}, // <5>_{6n,2n|6n,1n,1n}
+  {5,24, 6, 3,-6,-2,-1}, // <5>_{6n,3n|6n,2n,1n}
+  {5,25, 6, 4,-6,-2,-2}, // <5>_{6n,4n|6n,2n,2n}
+  {5,26, 6, 4,-6,-3,-1}, // <5>_{6n,4n|6n,3n,1n}
+  {5,27, 6, 5,-5,-4,-2}, // <5>_{6n,5n|5n,4n,2n}
+  {5,28, 6, 5,-6,-3,-2}, // <5>_{6n,5n|6n,3n,2n}
+  {5,29, 6, 5,-6,-4,-1}, // <5>_{6n,5n|6n,4n,1n}
+  {5,31, 2, 1,-1,-1,-1}, // <5>_{2n,1n|1n,1n,1n}
+  {5,32, 2, 2,-2,-1,-1}, // <5>_{2n,2n|2n,1n,1n}
+  {5,33, 3, 3,-2,-2,-2}, // <5>_{3n,3n|2n,2n,2n}
+  {5,34, 4,-1,-1,-1,-1}, // <5>_{4n|1n,1n,1n,1n}
+  {5,35, 4, 2,-2,-2,-2}, // <5>_{4n,2n|2n,2n,2n}
+  {5,36, 4, 4,-4,-2,-2}, // <5>_{4n,4n|4n,2n,2n}
+  {5,37, 6, 3,-3,-3,-3}, // <5>_{6n,3n|3n,3n,3n}
+  {5,38, 6, 6,-4,-4,-4}, // <5>_{6n,6n|4n,4n,4n}
+  {5,39, 6, 6,-6,-3,-3}, // <5>_{6n,6n|6n,3n,3n}
+  {5,41, 3, 1,-2,-1,-1}, // <5>_{3n,1n|2n,1n,1n}
+  {5,42, 3, 2,-2,-2,-1}, // <5>_{3n,2n|2n,2n,1n}
+  {5,43, 3, 3,-3,-2,-1}, // <5>_{3n,3n|3n,2n,1n}
+  {5,44, 4, 1,-3,-1,-1}, // <5>_{4n,1n|3n,1n,1n}
+  {5,45, 4, 1, 1,-3,-3}, // <5>_{4n,1n,1n|3n,3n}
+  {5,46, 4, 3,-3,-3,-1}, // <5>_{4n,3n|3n,3n,1n}
+  {5,47, 4, 4,-3,-3,-2}, // <5>_{4n,4n|3n,3n,2n}
+  {5,48, 4, 4,-4,-3,-1}, // <5>_{4n,4n|4n,3n,1n}
+  {5,49, 5,-2,-1,-1,-1}, // <5>_{5n|2n,1n,1n,1n}
+  {5,50, 5, 1,-2,-2,-2}, // <5>_{5n,1n|2n,2n,2n}
+  {5,51, 5, 2,-3,-2,-2}, // <5>_{5n,2n|3n,2n,2n}
+  {5,52, 5, 3,-3,-3,-2}, // <5>_{5n,3n|3n,3n,2n}
+  {5,53, 5, 1,-4,-1,-1}, // <5>_{5n,1n|4n,1n,1n}
+  {5,54, 5, 4,-3,-3,-3}, // <5>_{5n,4n|3n,3n,3n}
+  {5,55, 5, 4,-4,-4,-1}, // <5>_{5n,4n|4n,4n,1n}
+  {5,56, 5, 5,-4,-3,-3}, // <5>_{5n,5n|4n,3n,3n}
+  {5,57, 5, 5,-4,-4,-2}, // <5>_{5n,5n|4n,4n,2n}
+  {5,58, 5, 5,-5,-3,-2}, // <5>_{5n,5n|5n,3n,2n}
+  {5,59, 5, 5,-5,-4,-1}, // <5>_{5n,5n|5n,4n,1n}
+  {5,60, 6,-2,-2,-1,-1}, // <5>_{6n|2n,2n,1n,1n}
+  {5,61, 6,-3,-1,-1,-1}, // <5>_{6n|3n,1n,1n,1n}
+  {5,62, 6, 1, 1,-4,-4}, // <5>_{6n,1n,1n|4n,4n}
+  {5,63, 6, 1,-5,-1,-1}, // <5>_{6n,1n|5n,1n,1n}
+  {5,64, 6, 2,-4,-2,-2}, // <5>_{6n,2n|4n,2n,2n}
+  {5,65, 6, 4,-4,-4,-2}, // <5>_{6n,4n|4n,4n,2n}
+  {5,66, 6, 2, 2,-5,-5}, // <5>_{6n,2n,2n|5n,5n}
+  {5,67, 6, 5,-5,-5,-1}, // <5>_{6n,5n|5n,5n,1n}
+  {5,68, 6, 6,-5,-5,-2}, // <5>_{6n,6n|5n,5n,2n}
+  {5,69, 6, 6,-6,-4,-2}, // <5>_{6n,6n|6n,4n,2n}
+  {5,70, 6, 6,-6,-5,-1}, // <5>_{6n,6n|6n,5n,1n}
+  {5,72, 5, 2,-3,-3,-1}, // <5>_{5n,2n|3n,3n,1n}
+  {5,73, 5, 1, 1,-4,-3}, // <5>_{5n,1n,1n|4n,3n}
+  {5,74, 5, 3,-4,-2,-2}, // <5>_{5n,3n|4n,2n,2n}
+  {5,75, 5, 2, 1,-4,-4}, // <5>_{5n,2n,1n|4n,4n}
+  {5,76, 6, 1,-3,-2,-2}, // <5>_{6n,1n|3n,2n,2n}
+  {5,77, 6, 3,-4,-4,-1}, // <5>_{6n,3n|4n,4n,1n}
+  {5,78, 6, 1, 1,-5,-3}, // <5>_{6n,1n,1n|5n,3n}
+  {5,79, 6, 3,-5,-2,-2}, // <5>_{6n,3n|5n,2n,2n}
+  {5,80, 6, 5,-4,-4,-3}, // <5>_{6n,5n|4n,4n,3n}
+  {5,81, 6, 3, 1,-5,-5}, // <5>_{6n,3n,1n|5n,5n}
+  {5,82, 6, 6,-5,-4,-3}, // <5>_{6n,6n|5n,4n,3n}
+  {5,84, 6, 2,-4,-3,-1}, // <5>_{6n,2n|4n,3n,1n}
+  {5,85, 6, 2, 1,-5,-4}, // <5>_{6n,2n,1n|5n,4n}
+  {5,86, 6, 4,-5,-3,-2}  // <5>_{6n,4n|5n,3n,2n}
+ };
+ TProfile *correlations[4] = {f2pCorrelations,f3pCorrelations,f4pCorrelations,f5pCorrelations};
+ Double_t dMultiplicityWeights[4] = {d2pMultiplicityWeight,d3pMultiplicityWeight,d4pMultiplicityWeight,d5pMultiplicityWeight};
+ Double_t dCombinations[4] = {0.}; // M*(M-1)*...*(M-k+1) for k = 2, 3, 4 and 5
+ Double_t dProduct = dMult;
+ for(Int_t k=2;k<=5;k++)
+ {
+  dProduct *= dMult-(k-1.);
+  dCombinations[k-2] = dProduct;
+ } // end of for(Int_t k=2;k<=5;k++)
+ for(Int_t c=0;c<nMixedCorrelators;c++)
+ {
+  Int_t k = mixedCorrelators[c][0];
+  if(!(dMult>k-1.)){continue;} // not enough particles for this correlator 
+  allMixedCorrelators[c] = MixedHarmonicsRecursion(k,&mixedCorrelators[c][2]).Re()/dCombinations[k-2];
+  correlations[k-2]->Fill(mixedCorrelators[c][1]+0.5,allMixedCorrelators[c],dMultiplicityWeights[k-2]);
+ } // end of for(Int_t c=0;c<nMixedCorrelators;c++)
+
+ // d) Calculate products of mixed harmonics:
  Double_t dwx=0.;
  Double_t dwy=0.;
  for(Int_t x=1;x<=139;x++)
@@ -9082,6 +5275,77 @@ void AliFlowAnalysisWithQCumulants::CalculateMixedHarmonics()
 
 //===================================================================================================================
 
+TComplex AliFlowAnalysisWithQCumulants::MixedHarmonicsQ(Int_t n)
+{
+ // Non-weighted Q-vector of current event evaluated in harmonic n (in units of fHarmonic), 
+ // with Q_{-n} = Q_{n}^* and Q_{0} = M.
+
+ if(n==0){return TComplex((*fSpk)(0,0),0.);}
+ if(TMath::Abs(n)>fReQ->GetNrows())
+ {
+  printf("\n WARNING (QC): Q-vector in harmonic %dn is not available in AFAWQC::MHQ() !!!!\n\n",n);
+  exit(0);
+ }
+ if(n>0){return TComplex((*fReQ)(n-1,0),(*fImQ)(n-1,0));}
+ return TComplex((*fReQ)(-n-1,0),-1.*(*fImQ)(-n-1,0));
+
+} // end of TComplex AliFlowAnalysisWithQCumulants::MixedHarmonicsQ(Int_t n)
+
+//===================================================================================================================
+
+TComplex AliFlowAnalysisWithQCumulants::MixedHarmonicsRecursion(Int_t nParticles, const Int_t *harmonics)
+{
+ // Numerator of the nParticles-particle correlator <cos(n(h1*phi1+...+hk*phi_k))> without particle weights.
+ // It is the sum over all partitions of the particles into groups G of prod_{G} (-1)^{|G|-1} (|G|-1)! Q_{sum_{i in G} h_i}.
+ // The group of the first particle is enumerated here and the remaining particles are partitioned recursively.
+ // The numerator depends only on the set of harmonics, so it is cached for each set: the subsets shared by
+ // different correlators are evaluated only once per event. The cache is cleared in CalculateMixedHarmonics().
+
+ if(nParticles<=0){return TComplex(1.,0.);}
+ if(nParticles>8)
+ {
+  printf("\n WARNING (QC): %d-p correlations are not supported in AFAWQC::MHR() !!!!\n\n",nParticles);
+  exit(0);
+ }
+
+ // The sorted set of harmonics is the key in the cache (6 bits per harmonic):
+ Int_t sorted[8] = {0};
+ for(Int_t i=0;i<nParticles;i++){sorted[i] = harmonics[i];}
+ std::sort(sorted,sorted+nParticles);
+ Long64_t key = nParticles;
+ for(Int_t i=0;i<nParticles;i++){key = (key<<6)|(sorted[i]+32);}
+ std::map<Long64_t,TComplex>::const_iterator cached = fMixedHarmonicsRecursionCache.find(key);
+ if(cached!=fMixedHarmonicsRecursionCache.end()){return cached->second;}
+
+ TComplex numerator(0.,0.);
+ Int_t rest[8] = {0};
+ for(Int_t subset=0;subset<(1<<(nParticles-1));subset++) // other particles in the group of the first one
+ {
+  Int_t groupSize = 1;
+  Int_t groupHarmonic = sorted[0];
+  Int_t nRest = 0;
+  for(Int_t i=1;i<nParticles;i++)
+  {
+   if(subset&(1<<(i-1)))
+   {
+    groupSize++;
+    groupHarmonic += sorted[i];
+   } else
+     {
+      rest[nRest++] = sorted[i];
+     }
+  } // end of for(Int_t i=1;i<nParticles;i++)
+  Double_t coefficient = TMath::Factorial(groupSize-1)*(groupSize%2==0 ? -1. : 1.); // (-1)^{|G|-1} (|G|-1)!
+  numerator += coefficient*MixedHarmonicsQ(groupHarmonic)*MixedHarmonicsRecursion(nRest,rest);
+ } // end of for(Int_t subset=0;subset<(1<<(nParticles-1));subset++)
+ fMixedHarmonicsRecursionCache[key] = numerator;
+
+ return numerator;
+
+} // end of TComplex AliFlowAnalysisWithQCumulants::MixedHarmonicsRecursion(Int_t nParticles, const Int_t *harmonics)
+
+//===================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::CalculateCumulantsMixedHarmonics()
 {
  // Calculate in this method all multi-particle cumulants for azimuthal correlations in mixed harmonics.
@@ -22073,6 +18337,75 @@ void AliFlowAnalysisWithQCumulants::EvaluateIntFlowCorrelationsWithNestedLoops(A
 
 } // end of AliFlowAnalysisWithQCumulants::EvaluateIntFlowCorrelationsWithNestedLoops(AliFlowEventSimple* anEvent)
 
+//=========================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::EvaluateIntFlowCorrelationsWithSampledNestedLoops(AliFlowEventSimple * const anEvent)
+{
+ // Evaluate 2-, 4- and 6-particle correlations for integrated flow (without using the particle weights) 
+ // from fNestedLoopsSampledTuples randomly drawn tuples of distinct RPs, instead of from all of them.
+
+ // Remark 1: Exact nested loops need M^4 (M^6) steps for 4-p (6-p) correlations, which is out of reach 
+ //           for M of a few hundred. A tuple of distinct RPs drawn uniformly is an unbiased estimate 
+ //           of the event-averaged correlation, so the results converge to the ones from Q-vectors 
+ //           with the number of events times fNestedLoopsSampledTuples.
+ // Remark 2: Each sample is filled with weight (number of tuples in the event)/fNestedLoopsSampledTuples, 
+ //           so that events are weighted as in fIntFlowCorrelationsAllPro. The bins of 
+ //           fIntFlowDirectCorrelations filled here are the same as in EvaluateIntFlowCorrelationsWithNestedLoops: 
+ //           1st-4th bin (2-p), 11th bin (4-p) and 24th bin (6-p); the remaining bins are left empty.
+ 
+ Int_t nPrim = anEvent->NumberOfTracks(); 
+ anEvent->BuildTrackArrays();
+ std::vector<Double_t> phi; // azimuthal angles of RPs
+ phi.reserve(nPrim);
+ for(Int_t i=0;i<nPrim;i++)
+ {
+  if(anEvent->TrackInRPSelection(i)){phi.push_back(anEvent->GetTrackPhi(i));}
+ }
+ Int_t nRP = phi.size();
+ if(nRP<2){return;}
+ Int_t n = fHarmonic; 
+ Double_t dMult = nRP;
+ Int_t nTuples = fNestedLoopsSampledTuples;
+ Double_t dWeight2p = dMult*(dMult-1.)/nTuples;
+ Double_t dWeight4p = dWeight2p*(dMult-2.)*(dMult-3.);
+ Double_t dWeight6p = dWeight4p*(dMult-4.)*(dMult-5.);
+ Int_t nOrder = (nRP>=6 ? 6 : (nRP>=4 ? 4 : 2)); // number of particles per tuple
+ Int_t index[6] = {0};
+ Double_t phi1=0., phi2=0., phi3=0., phi4=0., phi5=0., phi6=0.;
+ for(Int_t t=0;t<nTuples;t++)
+ {
+  // Draw nOrder distinct RPs (rejection is cheap, since nOrder << nRP):
+  for(Int_t o=0;o<nOrder;o++)
+  {
+   Bool_t bDistinct = kFALSE;
+   while(!bDistinct)
+   {
+    index[o] = gRandom->Integer(nRP);
+    bDistinct = kTRUE;
+    for(Int_t oo=0;oo<o;oo++){if(index[oo]==index[o]){bDistinct=kFALSE;break;}}
+   }
+  } // end of for(Int_t o=0;o<nOrder;o++)
+  // 2-p correlations:
+  phi1 = phi[index[0]]; 
+  phi2 = phi[index[1]]; 
+  fIntFlowDirectCorrelations->Fill(0.5,cos(n*(phi1-phi2)),dWeight2p);    // <cos(n*(phi1-phi2))>
+  fIntFlowDirectCorrelations->Fill(1.5,cos(2.*n*(phi1-phi2)),dWeight2p); // <cos(2n*(phi1-phi2))>
+  fIntFlowDirectCorrelations->Fill(2.5,cos(3.*n*(phi1-phi2)),dWeight2p); // <cos(3n*(phi1-phi2))>
+  fIntFlowDirectCorrelations->Fill(3.5,cos(4.*n*(phi1-phi2)),dWeight2p); // <cos(4n*(phi1-phi2))>
+  if(nOrder<4){continue;}
+  // 4-p correlations:
+  phi3 = phi[index[2]]; 
+  phi4 = phi[index[3]]; 
+  fIntFlowDirectCorrelations->Fill(10.5,cos(n*(phi1+phi2-phi3-phi4)),dWeight4p); // <cos(n*(phi1+phi2-phi3-phi4))>
+  if(nOrder<6){continue;}
+  // 6-p correlations:
+  phi5 = phi[index[4]]; 
+  phi6 = phi[index[5]]; 
+  fIntFlowDirectCorrelations->Fill(23.5,cos(n*(phi1+phi2+phi3-phi4-phi5-phi6)),dWeight6p); // <cos(n*(phi1+phi2+phi3-phi4-phi5-phi6))>
+ } // end of for(Int_t t=0;t<nTuples;t++)
+
+} // end of void AliFlowAnalysisWithQCumulants::EvaluateIntFlowCorrelationsWithSampledNestedLoops(AliFlowEventSimple * const anEvent)
+
 //================================================================================================================
 
 void AliFlowAnalysisWithQCumulants::EvaluateMixedHarmonicsWithNestedLoops(AliFlowEventSimple * const anEvent)
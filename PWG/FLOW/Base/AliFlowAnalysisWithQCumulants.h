@@ -14,7 +14,9 @@
 #ifndef ALIFLOWANALYSISWITHQCUMULANTS_H
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
+#include <map>
 #include "TMatrixD.h"
+#include "TComplex.h"
 #include "TH2D.h"
 #include "TRandom3.h"
 #include "AliFlowCommonConstants.h"
@@ -96,10 +98,13 @@ class AliFlowAnalysisWithQCumulants{
     virtual void CalculateIntFlowSumOfEventWeightsNUA();
     virtual void CalculateIntFlowSumOfProductOfEventWeightsNUA();
     virtual void CalculateMixedHarmonics();
+    virtual TComplex MixedHarmonicsQ(Int_t n);
+    virtual TComplex MixedHarmonicsRecursion(Int_t nParticles, const Int_t *harmonics);
     // 2c.) Cross-checking reference flow correlations with nested loops: 
     virtual void EvaluateIntFlowNestedLoops(AliFlowEventSimple* const anEvent);
     virtual void EvaluateIntFlowCorrelationsWithNestedLoops(AliFlowEventSimple* const anEvent); 
     virtual void EvaluateIntFlowCorrelationsWithNestedLoopsUsingParticleWeights(AliFlowEventSimple* const anEvent); 
+    virtual void EvaluateIntFlowCorrelationsWithSampledNestedLoops(AliFlowEventSimple* const anEvent); 
     virtual void EvaluateIntFlowCorrectionsForNUAWithNestedLoops(AliFlowEventSimple* const anEvent); 
     virtual void EvaluateIntFlowCorrectionsForNUAWithNestedLoopsUsingParticleWeights(AliFlowEventSimple* const anEvent);
     virtual void EvaluateMixedHarmonicsWithNestedLoops(AliFlowEventSimple* const anEvent); 
@@ -444,6 +449,8 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t GetEvaluateDiffFlowNestedLoops() const {return this->fEvaluateDiffFlowNestedLoops;};  
   void SetMaxAllowedMultiplicity(Int_t const maxAllowedMultiplicity) {this->fMaxAllowedMultiplicity = maxAllowedMultiplicity;};
   Int_t GetMaxAllowedMultiplicity() const {return this->fMaxAllowedMultiplicity;};
+  void SetNestedLoopsSampledTuples(Int_t const nslt) {this->fNestedLoopsSampledTuples = nslt;};
+  Int_t GetNestedLoopsSampledTuples() const {return this->fNestedLoopsSampledTuples;};
   void SetEvaluateNestedLoops(TProfile* const enl) {this->fEvaluateNestedLoops = enl;};
   TProfile* GetEvaluateNestedLoops() const {return this->fEvaluateNestedLoops;}; 
   void SetIntFlowDirectCorrelations(TProfile* const ifdc) {this->fIntFlowDirectCorrelations = ifdc;};
@@ -768,6 +775,7 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fEvaluateIntFlowNestedLoops; // evaluate nested loops relevant for integrated flow
   Bool_t fEvaluateDiffFlowNestedLoops; // evaluate nested loops relevant for differential flow
   Int_t fMaxAllowedMultiplicity; // nested loops will be evaluated only for events with multiplicity <= fMaxAllowedMultiplicity
+  Int_t fNestedLoopsSampledTuples; // if > 0, events above fMaxAllowedMultiplicity are cross-checked with this many randomly sampled tuples per event
   TProfile *fEvaluateNestedLoops; // profile with four bins: fEvaluateIntFlowNestedLoops, fEvaluateDiffFlowNestedLoops, fCrossCheckInPtBinNo and fCrossCheckInEtaBinNo 
   // integrated flow:
   TProfile *fIntFlowDirectCorrelations; // multiparticle correlations relevant for int. flow calculated with nested loops  
@@ -815,6 +823,8 @@ class AliFlowAnalysisWithQCumulants{
   TH1D *fMixedHarmonicEventWeights[2]; //! sum of linear and quadratic event weights for mixed harmonics => [0=linear 1,1=quadratic]    
   TH2D *fMixedHarmonicProductOfEventWeights; // sum of products of event weights for mixed harmonics
   TProfile2D *fMixedHarmonicProductOfCorrelations; // averages of products of mixed harmonics correlations
+  //  9f.) generic recursion:
+  std::map<Long64_t,TComplex> fMixedHarmonicsRecursionCache; //! numerators of already evaluated sets of harmonics in this event
   // 10.) Control histograms:
   //  10a.) list:
   TList *fControlHistogramsList; // list to hold all control histograms 
@@ -839,7 +849,7 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fUseBootstrap; // use bootstrap to estimate statistical spread
   Bool_t fUseBootstrapVsM; // use bootstrap to estimate statistical spread for results vs M
   Int_t fnSubsamples; // number of subsamples (SS), by default 10
-  TRandom3 *fRandom; // local random generator
+  Int_t fSubsampleIndexEBE; //! subsample of the current event, shared with the other methods via the flow event
   //  11c) profiles: 
   TProfile2D *fBootstrapCorrelations; // x-axis => <2>, <4>, <6>, <8>; y-axis => subsample # 
   TProfile2D *fBootstrapCorrelationsVsM[4]; // index => <2>, <4>, <6>, <8>; x-axis => multiplicity; y-axis => subsample # 
@@ -847,7 +857,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 7);
 
 };
 
@@ -43,6 +43,7 @@
 #include "AliFlowTrackSimpleCuts.h"
 #include "AliFlowEventSimple.h"
 #include "TRandom.h"
+#include "TRandom3.h"
 #include <random>
 
 using std::cout;
@@ -88,6 +89,19 @@ AliFlowEventSimple::AliFlowEventSimple():
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fTrackArraysValid(kFALSE),
+  fTrackPhi(),
+  fTrackPt(),
+  fTrackEta(),
+  fTrackWeight(),
+  fTrackCharge(),
+  fTrackFlowBits(),
+  fRPQMaxHarmonic(-1),
+  fRPQMaxPower(-1),
+  fRPQTrackWeights(kFALSE),
+  fRPQRe(),
+  fRPQIm(),
+  fSubsampleRandom(-1.),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -147,6 +161,19 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fTrackArraysValid(kFALSE),
+  fTrackPhi(),
+  fTrackPt(),
+  fTrackEta(),
+  fTrackWeight(),
+  fTrackCharge(),
+  fTrackFlowBits(),
+  fRPQMaxHarmonic(-1),
+  fRPQMaxPower(-1),
+  fRPQTrackWeights(kFALSE),
+  fRPQRe(),
+  fRPQIm(),
+  fSubsampleRandom(-1.),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -210,6 +237,19 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZPCM(anEvent.fZPCM),
   fZPAM(anEvent.fZPAM),
   fAbsOrbit(anEvent.fAbsOrbit),
+  fTrackArraysValid(kFALSE),
+  fTrackPhi(),
+  fTrackPt(),
+  fTrackEta(),
+  fTrackWeight(),
+  fTrackCharge(),
+  fTrackFlowBits(),
+  fRPQMaxHarmonic(-1),
+  fRPQMaxPower(-1),
+  fRPQTrackWeights(kFALSE),
+  fRPQRe(),
+  fRPQIm(),
+  fSubsampleRandom(anEvent.fSubsampleRandom),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -242,6 +282,7 @@ void AliFlowEventSimple::SetNumberOfPOIs( Int_t numberOfPOIs, Int_t poiType)
   }
 
   fNumberOfPOIs[poiType] = numberOfPOIs;
+  fTrackArraysValid = kFALSE;
 }
 
 //-----------------------------------------------------------------------
@@ -250,6 +291,7 @@ void AliFlowEventSimple::IncrementNumberOfPOIs(Int_t poiType)
 
   if (poiType>=fNumberOfPOItypes) SetNumberOfPOIs(0,poiType);
   fNumberOfPOIs[poiType]++;
+  fTrackArraysValid = kFALSE;
 }
 
 //-----------------------------------------------------------------------
@@ -299,6 +341,7 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
   fZPCM = anEvent.fZPCM;
   fZPAM = anEvent.fZPAM;
   fAbsOrbit = anEvent.fAbsOrbit;
+  fSubsampleRandom = anEvent.fSubsampleRandom;
   for(Int_t i(0); i < 3; i++) {
     fVtxPos[i] = anEvent.fVtxPos[i];
   }
@@ -307,6 +350,7 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
     fV0A[i] = anEvent.fV0A[i];
   }
   delete [] fShuffledIndexes;
+  fTrackArraysValid = kFALSE;
   return *this;
 }
 
@@ -444,6 +488,7 @@ void AliFlowEventSimple::ShuffleTracks()
   std::random_device rd;
   std::default_random_engine engine{rd()};
   std::shuffle(&fShuffledIndexes[0], &fShuffledIndexes[fNumberOfTracks],engine);
+  fTrackArraysValid=kFALSE;
   Printf("Tracks shuffled! tracks: %i",fNumberOfTracks);
 }
 
@@ -475,6 +520,7 @@ void AliFlowEventSimple::TrackAdded()
     delete [] fShuffledIndexes;
     fShuffledIndexes=NULL;
   }
+  fTrackArraysValid=kFALSE;
 }
 
 //-----------------------------------------------------------------------
@@ -488,6 +534,105 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::BuildTrackArrays()
+{
+  //copy phi, pt, eta, weight, charge and the RP/POI tags of all tracks
+  //into flat arrays, in the order given by GetTrack(i)
+  //nothing to do if the arrays are still up to date
+  if (fTrackArraysValid) return;
+  fTrackPhi.resize(fNumberOfTracks);
+  fTrackPt.resize(fNumberOfTracks);
+  fTrackEta.resize(fNumberOfTracks);
+  fTrackWeight.resize(fNumberOfTracks);
+  fTrackCharge.resize(fNumberOfTracks);
+  fTrackFlowBits.resize(fNumberOfTracks);
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* track = GetTrack(i);
+    if (!track)
+    {
+      fTrackPhi[i]=0.; fTrackPt[i]=0.; fTrackEta[i]=0.; fTrackWeight[i]=0.;
+      fTrackCharge[i]=0; fTrackFlowBits[i]=0;
+      continue;
+    }
+    fTrackPhi[i] = track->Phi();
+    fTrackPt[i] = track->Pt();
+    fTrackEta[i] = track->Eta();
+    fTrackWeight[i] = track->Weight();
+    fTrackCharge[i] = track->Charge();
+    //only the tags which fit in the mask are mirrored
+    UInt_t bits = 0;
+    Int_t nTypes = TMath::Min((Int_t)track->GetPOItype()->GetNbits(),32);
+    for (Int_t j=0; j<nTypes; j++)
+    {
+      if (track->CheckTag(j)) bits |= (1u<<j);
+    }
+    fTrackFlowBits[i] = bits;
+  }
+  fTrackArraysValid=kTRUE;
+  fRPQMaxHarmonic=-1; //the cached Q-vectors are out of date as well
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::BuildRPQVectors(Int_t maxHarmonic, Int_t maxPower, Bool_t useTrackWeights)
+{
+  //Q_{h,p} = sum over RPs of w^p*exp(i*h*phi), w = track weight if requested, 1 otherwise
+  //the harmonics and powers are built by recurrence from exp(i*phi) and w, so each track
+  //costs one sincos; the cache is kept as long as it covers the request
+  BuildTrackArrays();
+  if (fRPQMaxHarmonic>=maxHarmonic && fRPQMaxPower>=maxPower && fRPQTrackWeights==useTrackWeights) return;
+  if (fRPQMaxHarmonic>=0 && fRPQTrackWeights==useTrackWeights)
+  {
+    //extend to the largest request so far instead of alternating between methods
+    maxHarmonic = TMath::Max(maxHarmonic,fRPQMaxHarmonic);
+    maxPower = TMath::Max(maxPower,fRPQMaxPower);
+  }
+  const Int_t nPowers = maxPower+1;
+  fRPQRe.assign((maxHarmonic+1)*nPowers,0.);
+  fRPQIm.assign((maxHarmonic+1)*nPowers,0.);
+  std::vector<Double_t> wp(nPowers);
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    if (!TrackInRPSelection(i)) continue;
+    Double_t w = useTrackWeights ? fTrackWeight[i] : 1.;
+    wp[0] = 1.;
+    for (Int_t p=1; p<nPowers; p++) { wp[p] = wp[p-1]*w; }
+    Double_t c1 = TMath::Cos(fTrackPhi[i]);
+    Double_t s1 = TMath::Sin(fTrackPhi[i]);
+    Double_t c = 1., sn = 0.;
+    for (Int_t h=0; h<=maxHarmonic; h++)
+    {
+      Double_t* re = &fRPQRe[h*nPowers];
+      Double_t* im = &fRPQIm[h*nPowers];
+      for (Int_t p=0; p<nPowers; p++)
+      {
+        re[p] += wp[p]*c;
+        im[p] += wp[p]*sn;
+      }
+      Double_t cNext = c*c1-sn*s1;
+      sn = sn*c1+c*s1;
+      c = cNext;
+    }
+  }
+  fRPQMaxHarmonic = maxHarmonic;
+  fRPQMaxPower = maxPower;
+  fRPQTrackWeights = useTrackWeights;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowEventSimple::GetSubsampleIndex(Int_t nSubsamples)
+{
+  //subsample index in [0,nSubsamples) of this event
+  //one random number is drawn per event and shared by all flow methods, so methods with
+  //the same number of subsamples agree on the subsample of every event
+  static TRandom3 random(0); //if the seed is 0, it is determined uniquely in space and time via TUUID
+  if (nSubsamples<=1) return 0;
+  if (fSubsampleRandom<0.) fSubsampleRandom = random.Rndm();
+  Int_t index = (Int_t)(fSubsampleRandom*nSubsamples);
+  return (index<nSubsamples)?index:nSubsamples-1;
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         TList *weightsList,
@@ -896,6 +1041,19 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fTrackArraysValid(kFALSE),
+  fTrackPhi(),
+  fTrackPt(),
+  fTrackEta(),
+  fTrackWeight(),
+  fTrackCharge(),
+  fTrackFlowBits(),
+  fRPQMaxHarmonic(-1),
+  fRPQMaxPower(-1),
+  fRPQTrackWeights(kFALSE),
+  fRPQRe(),
+  fRPQIm(),
+  fSubsampleRandom(-1.),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -1176,6 +1334,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
     }
     track->SetForRPSelection(pass);
   }
+  fTrackArraysValid=kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -1198,6 +1357,7 @@ void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiTy
     }
     track->Tag(poiType,pass);
   }
+  fTrackArraysValid=kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -1230,6 +1390,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
       track->ResetPOItype();
     }
   }
+  fTrackArraysValid=kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -1247,6 +1408,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
   fTrackCollection->Compress(); //clean up empty slots
   fNumberOfTracks-=ncleaned; //update number of tracks
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  fTrackArraysValid=kFALSE;
   return ncleaned;
 }
 
@@ -1286,4 +1448,6 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  fTrackArraysValid=kFALSE;
+  fSubsampleRandom = -1.;
 }
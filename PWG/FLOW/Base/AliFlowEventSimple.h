@@ -16,6 +16,7 @@
 #ifndef ALIFLOWEVENTSIMPLE_H
 #define ALIFLOWEVENTSIMPLE_H
 
+#include <vector>
 #include "TObject.h"
 #include "TParameter.h"
 #include "TMath.h"
@@ -82,9 +83,9 @@ class AliFlowEventSimple: public TObject {
   Bool_t   IsSetMCReactionPlaneAngle() const        { return fMCReactionPlaneAngleIsSet; }
   void     SetAfterBurnerPrecision(Double_t p)      { fAfterBurnerPrecision=p; }
   Double_t GetAfterBurnerPrecision() const          { return fAfterBurnerPrecision; }
-  void     SetUserModified(Bool_t s=kTRUE)          { fUserModified=s; }
+  void     SetUserModified(Bool_t s=kTRUE)          { fUserModified=s; fTrackArraysValid=kFALSE; }
   Bool_t   IsUserModified() const                   { return fUserModified; }
-  void     SetShuffleTracks(Bool_t b)               {fShuffleTracks=b;}
+  void     SetShuffleTracks(Bool_t b)               {fShuffleTracks=b; fTrackArraysValid=kFALSE;}
   void     ShuffleTracks();
 
   void ResolutionPt(Double_t res);
@@ -117,6 +118,30 @@ class AliFlowEventSimple: public TObject {
   void TrackAdded();
   AliFlowTrackSimple* MakeNewTrack();
 
+  // flat copy of the track kinematics and selections, in the order of GetTrack(i),
+  // for the loops of the flow methods; call InvalidateTrackArrays() after
+  // changing tracks obtained with GetTrack()
+  void BuildTrackArrays();
+  void InvalidateTrackArrays()                      { fTrackArraysValid=kFALSE; }
+  Double_t GetTrackPhi(Int_t i) const               { return fTrackPhi[i]; }
+  Double_t GetTrackPt(Int_t i) const                { return fTrackPt[i]; }
+  Double_t GetTrackEta(Int_t i) const               { return fTrackEta[i]; }
+  Double_t GetTrackWeight(Int_t i) const            { return fTrackWeight[i]; }
+  Int_t    GetTrackCharge(Int_t i) const            { return fTrackCharge[i]; }
+  UInt_t   GetTrackFlowBits(Int_t i) const          { return fTrackFlowBits[i]; }
+  Bool_t   TrackInRPSelection(Int_t i) const        { return (fTrackFlowBits[i]&1u); }
+  Bool_t   TrackInPOISelection(Int_t i, Int_t poiType=1) const { return (fTrackFlowBits[i]>>poiType)&1u; }
+
+  // Q-vectors of the RPs, Q_{h,p} = sum w^p exp(i*h*phi) for h=0..maxHarmonic, p=0..maxPower,
+  // with w the track weight (or 1); built once per event and shared by the flow methods
+  void BuildRPQVectors(Int_t maxHarmonic, Int_t maxPower, Bool_t useTrackWeights=kFALSE);
+  Double_t GetRPQRe(Int_t h, Int_t p) const         { return fRPQRe[h*(fRPQMaxPower+1)+p]; }
+  Double_t GetRPQIm(Int_t h, Int_t p) const         { return fRPQIm[h*(fRPQMaxPower+1)+p]; }
+
+  // subsample of this event for the statistical error estimates, drawn once per event so
+  // that all flow methods put the event in the same subsample
+  Int_t GetSubsampleIndex(Int_t nSubsamples);
+
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void GetZDC2Qsub(AliFlowVector* Qarray);
@@ -204,12 +229,25 @@ class AliFlowEventSimple: public TObject {
   Double_t                fZPAM;                      // total energy from ZPC-A
   Double_t                fVtxPos[3];                 // Primary vertex position (x,y,z)
   UInt_t                  fAbsOrbit;                  // Absolute orbit number
+  Bool_t                  fTrackArraysValid;          //! the flat track arrays are up to date
+  std::vector<Double_t>   fTrackPhi;                  //! phi of the tracks, in GetTrack(i) order
+  std::vector<Double_t>   fTrackPt;                   //! pt of the tracks
+  std::vector<Double_t>   fTrackEta;                  //! eta of the tracks
+  std::vector<Double_t>   fTrackWeight;               //! weight of the tracks
+  std::vector<Int_t>      fTrackCharge;               //! charge of the tracks
+  std::vector<UInt_t>     fTrackFlowBits;             //! bit 0 RP, bit i POI type i, 0 for empty slots
+  Int_t                   fRPQMaxHarmonic;            //! highest harmonic of the cached RP Q-vectors, -1 if not built
+  Int_t                   fRPQMaxPower;               //! highest weight power of the cached RP Q-vectors
+  Bool_t                  fRPQTrackWeights;           //! the cached RP Q-vectors use the track weights
+  std::vector<Double_t>   fRPQRe;                     //! Re[Q_{h,p}] of the RPs, index h*(fRPQMaxPower+1)+p
+  std::vector<Double_t>   fRPQIm;                     //! Im[Q_{h,p}] of the RPs
+  Double_t                fSubsampleRandom;           //! uniform random number giving the subsample of the event, -1 if not drawn
 
  private:
   Int_t                   fNumberOfPOItypes;    // how many different flow particle types do we have? (RP,POI,POI_2,...)
   Int_t*                  fNumberOfPOIs;          //[fNumberOfPOItypes] number of tracks that have passed the POI selection
 
-  ClassDef(AliFlowEventSimple,7)
+  ClassDef(AliFlowEventSimple,10)
 };
 
 #endif
@@ -1275,8 +1275,6 @@ void AliAnalysisTaskMultiparticleFemtoscopy::EstimateBackground(AliVEvent *ave)
 
  if(aMC)
  {
-  TString pattern = ".11.13.211.321.2212."; // TBI this can be done programatically TBI only for these particles I need to estimate background
-
   return; // TBI re-validate the lines below, within if statement, by following the analogy with AOD case
 
   if(!PassesMixedEventCuts(aMC)){return;} // TBI this is empty at the moment for MC
@@ -1290,7 +1288,7 @@ void AliAnalysisTaskMultiparticleFemtoscopy::EstimateBackground(AliVEvent *ave)
     AliAODMCParticle *amcparticle = dynamic_cast<AliAODMCParticle*>(aMC->GetTrack(iTrack));
     if(!amcparticle){Fatal(sMethodName.Data(),"!amcparticle");}
     if(!PassesCommonTrackCuts(amcparticle)){continue;} // TBI re-think, see implemntation of this method
-    if(!(pattern.Contains(Form(".%d.",TMath::Abs(amcparticle->GetPdgCode()))))){continue;}
+    if(!SupportedPdg(amcparticle->GetPdgCode())){continue;}
     // Fill fMixedEvents0[0] with tracks which survived all checks:
     ca0[ca0Counter++] = amcparticle;
    } // for(Int_t iTrack=0;iTrack<nTracks;iTrack++)
@@ -1306,7 +1304,7 @@ void AliAnalysisTaskMultiparticleFemtoscopy::EstimateBackground(AliVEvent *ave)
     AliAODMCParticle *amcparticle = dynamic_cast<AliAODMCParticle*>(aMC->GetTrack(iTrack));
     if(!amcparticle){Fatal(sMethodName.Data(),"!amcparticle");}
     if(!PassesCommonTrackCuts(amcparticle)){continue;} // TBI re-think, see implemntation of this method
-    if(!(pattern.Contains(Form(".%d.",TMath::Abs(amcparticle->GetPdgCode()))))){continue;}
+    if(!SupportedPdg(amcparticle->GetPdgCode())){continue;}
     // Fill fMixedEvents0[0] with tracks which survived all checks:
     ca1[ca1Counter++] = amcparticle;
    } // for(Int_t iTrack=0;iTrack<nTracks;iTrack++)
@@ -1366,18 +1364,17 @@ void AliAnalysisTaskMultiparticleFemtoscopy::EstimateBackground(AliVEvent *ave)
     if(fEstimate2pBackground) Calculate2pBackground(fMixedEvents0[0],fMixedEvents0[1]); // TBI rename
     if(fEstimate3pBackground) Calculate3pBackground(fMixedEvents0[0],fMixedEvents0[1],fMixedEvents0[2]);
     //if(fEstimate4pBackground) Calculate4pBackground(fMixedEvents0[0],fMixedEvents0[1],fMixedEvents0[2],fMixedEvents0[3]);
-    // Shift mixed events:
-    // [1] -> [0]
-    fMixedEvents0[0]->Delete();
-    *fMixedEvents0[0] = *fMixedEvents0[1];
-    *fGlobalTracksAOD[1] = *fGlobalTracksAOD[2];
-    // [2] -> [1]
-    fMixedEvents0[1]->Delete();
-    *fMixedEvents0[1] = *fMixedEvents0[2];
-    *fGlobalTracksAOD[2] = *fGlobalTracksAOD[3];
-    // Clean [2]:
-    fMixedEvents0[2]->Delete();
-    fGlobalTracksAOD[3]->Delete();
+    // Shift mixed events by rotating the buffers, instead of copying all tracks: [1] -> [0], [2] -> [1], and the oldest one is cleaned and reused as [2]:
+    TClonesArray *oldestEvent = fMixedEvents0[0];
+    TExMap *oldestGlobalTracks = fGlobalTracksAOD[1];
+    oldestEvent->Delete();
+    oldestGlobalTracks->Delete();
+    fMixedEvents0[0] = fMixedEvents0[1];
+    fGlobalTracksAOD[1] = fGlobalTracksAOD[2];
+    fMixedEvents0[1] = fMixedEvents0[2];
+    fGlobalTracksAOD[2] = fGlobalTracksAOD[3];
+    fMixedEvents0[2] = oldestEvent;
+    fGlobalTracksAOD[3] = oldestGlobalTracks;
    } // if(0!=fMixedEvents0[0]->GetEntries() && 0!=fMixedEvents0[1]->GetEntries() && 0!=fMixedEvents0[2]->GetEntries())
    break; // case 0: // shifting
 
@@ -2378,6 +2375,26 @@ Bool_t AliAnalysisTaskMultiparticleFemtoscopy::Proton(AliAODTrack *gtrack, Int_t
 
 //=======================================================================================================================
 
+Bool_t AliAnalysisTaskMultiparticleFemtoscopy::SupportedPdg(Int_t pdg)
+{
+ // Is this (anti-)particle among the ones supported in the MC correlation functions and background? So far: e, mu, pi, K, p.
+
+ switch(TMath::Abs(pdg))
+ {
+  case 11:
+  case 13:
+  case 211:
+  case 321:
+  case 2212:
+   return kTRUE;
+  default:
+   return kFALSE;
+ } // switch(TMath::Abs(pdg))
+
+} // Bool_t AliAnalysisTaskMultiparticleFemtoscopy::SupportedPdg(Int_t pdg)
+
+//=======================================================================================================================
+
 void AliAnalysisTaskMultiparticleFemtoscopy::InitializeArrays()
 {
  // Initialize arrays for all objects not classified yet.
@@ -5412,17 +5429,13 @@ void AliAnalysisTaskMultiparticleFemtoscopy::CalculateCorrelationFunctions(AliMC
  // Calculate correlation functions for Monte Carlo.
 
  // a) Insanity checks;
- // b) Pattern from supported PDG codes;
- // c) Two nested loops to calculate C(k), just an example.
-
- // b) Pattern from supported PDG codes:
- TString pattern = ".11.13.211.321.2212."; // TBI this can be done programatically
+ // b) Two nested loops to calculate C(k), just an example. Supported PDG codes are given by SupportedPdg(...).
 
  // a) Insanity checks:
  TString sMethodName = "void AliAnalysisTaskMultiparticleFemtoscopy::CalculateCorrelationFunctions(AliMCEvent *aMC)";
  if(0 == aMC->GetNumberOfTracks()){return;} // TBI re-think
 
- // c) Two nested loops to calculate C(k), just an example:
+ // b) Two nested loops to calculate C(k), just an example:
  Int_t nTracks = aMC->GetNumberOfTracks();
  for(Int_t iTrack1=0;iTrack1<nTracks;iTrack1++)
  {
@@ -5441,7 +5454,7 @@ void AliAnalysisTaskMultiparticleFemtoscopy::CalculateCorrelationFunctions(AliMC
 
    // Okay, so we have two tracks, let's check PID, and fill the correlation functions:
    // Check if this PID is supported in current implementation:
-   if(!(pattern.Contains(Form(".%d.",TMath::Abs(amcparticle1->GetPdgCode()))) && pattern.Contains(Form(".%d.",TMath::Abs(amcparticle2->GetPdgCode()))))){continue;}
+   if(!(SupportedPdg(amcparticle1->GetPdgCode()) && SupportedPdg(amcparticle2->GetPdgCode()))){continue;}
 
    // Determine the indices of correlation function to be filled:
    Int_t index1 = -44;
@@ -6647,6 +6660,57 @@ Double_t AliAnalysisTaskMultiparticleFemtoscopy::Q4(AliAODTrack *agtrack1, AliAO
 
 //=======================================================================================================================
 
+void AliAnalysisTaskMultiparticleFemtoscopy::CompactMixedEvent(TClonesArray *ca, TExMap *em, std::vector<AliAODTrack*> &agtracks, std::vector<Int_t> &species)
+{
+ // Select the tracks of one buffered event which pass all track cuts, so that the nested loops in the
+ // background estimation do not repeat the cuts, the global track lookup and the PID for each combination.
+ // For each selected track 'agtrack' is stored (either 'atrack' or 'gtrack', depending on the flag
+ // fFillControlHistogramsWithGlobalTrackInfo), together with a bitset of the PID hypotheses it passes.
+ // The bits follow the species indices of f2pBackground and f3pBackground: [2] pi+, [3] K+, [4] p+, [7] pi-, [8] K-, [9] p-.
+
+ TString sMethodName = "void AliAnalysisTaskMultiparticleFemtoscopy::CompactMixedEvent(TClonesArray *ca, TExMap *em, std::vector<AliAODTrack*> &agtracks, std::vector<Int_t> &species)";
+ if(!ca){Fatal(sMethodName.Data(),"!ca");}
+ if(!em){Fatal(sMethodName.Data(),"!em");}
+
+ agtracks.clear();
+ species.clear();
+ Int_t nTracks = ca->GetEntries();
+ agtracks.reserve(nTracks);
+ species.reserve(nTracks);
+ for(Int_t iTrack=0;iTrack<nTracks;iTrack++)
+ {
+  AliAODTrack *atrack = dynamic_cast<AliAODTrack*>(ca->UncheckedAt(iTrack));
+  // TBI Temporary track insanity checks:
+  if(!atrack){Fatal(sMethodName.Data(),"!atrack");} // TBI keep this for some time, eventually just continue
+  if(atrack->GetID()>=0 && atrack->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack->GetID()>=0 && atrack->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
+  if(atrack->TestFilterBit(128) && atrack->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack->TestFiletrBit(128) && atrack->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
+  if(!PassesCommonTrackCuts(atrack)){continue;} // TBI re-think
+  // Corresponding AOD global track:
+  Int_t id = atrack->GetID();
+  AliAODTrack *gtrack = dynamic_cast<AliAODTrack*>(id>=0 ? ca->UncheckedAt(em->GetValue(id)) : ca->UncheckedAt(em->GetValue(-(id+1))));
+  if(!gtrack){Fatal(sMethodName.Data(),"!gtrack");} // TBI keep this for some time, eventually just continue
+  // Common track selection criteria for all "normal" global tracks:
+  if(!PassesGlobalTrackCuts(gtrack)){continue;}
+
+  AliAODTrack *agtrack = fFillControlHistogramsWithGlobalTrackInfo ? gtrack : atrack;
+  if(!agtrack){Fatal(sMethodName.Data(),"!agtrack");}
+
+  Int_t bits = 0;
+  if(Pion(gtrack,1,kTRUE)){bits |= (1<<2);}
+  if(Kaon(gtrack,1,kTRUE)){bits |= (1<<3);}
+  if(Proton(gtrack,1,kTRUE)){bits |= (1<<4);}
+  if(Pion(gtrack,-1,kTRUE)){bits |= (1<<7);}
+  if(Kaon(gtrack,-1,kTRUE)){bits |= (1<<8);}
+  if(Proton(gtrack,-1,kTRUE)){bits |= (1<<9);}
+
+  agtracks.push_back(agtrack);
+  species.push_back(bits);
+ } // for(Int_t iTrack=0;iTrack<nTracks;iTrack++)
+
+} // void AliAnalysisTaskMultiparticleFemtoscopy::CompactMixedEvent(TClonesArray *ca, TExMap *em, std::vector<AliAODTrack*> &agtracks, std::vector<Int_t> &species)
+
+//=======================================================================================================================
+
 void AliAnalysisTaskMultiparticleFemtoscopy::Calculate2pBackground(TClonesArray *ca1, TClonesArray *ca2)
 {
  // Calculate background.
@@ -6668,106 +6732,75 @@ void AliAnalysisTaskMultiparticleFemtoscopy::Calculate2pBackground(TClonesArray
  // ...
 
  // c) Two nested loops to calculate B(k):
- Int_t nTracks1 = ca1->GetEntries();
- Int_t nTracks2 = ca2->GetEntries();
+ // Tracks passing all cuts, and their PID, are determined only once per event, see CompactMixedEvent(...):
+ std::vector<AliAODTrack*> agtracks1, agtracks2;
+ std::vector<Int_t> speciesList1, speciesList2;
+ CompactMixedEvent(ca1,fGlobalTracksAOD[1],agtracks1,speciesList1);
+ CompactMixedEvent(ca2,fGlobalTracksAOD[2],agtracks2,speciesList2);
+ Int_t nTracks1 = agtracks1.size();
+ Int_t nTracks2 = agtracks2.size();
 
  // Start loop over tracks in the 1st event:
  for(Int_t iTrack1=0;iTrack1<nTracks1;iTrack1++)
  {
-  AliAODTrack *atrack1 = dynamic_cast<AliAODTrack*>(ca1->UncheckedAt(iTrack1)); // TBI cross-check UncheckedAt
-  // TBI Temporary track insanity checks:
-  if(!atrack1){Fatal(sMethodName.Data(),"!atrack1");} // TBI keep this for some time, eventually just continue
-  if(atrack1->GetID()>=0 && atrack1->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack1->GetID()>=0 && atrack1->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-  if(atrack1->TestFilterBit(128) && atrack1->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack1->TestFiletrBit(128) && atrack1->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-  if(!PassesCommonTrackCuts(atrack1)){continue;} // TBI re-think
-  // Corresponding AOD global track:
-  Int_t id1 = atrack1->GetID();
-  AliAODTrack *gtrack1 = dynamic_cast<AliAODTrack*>(id1>=0 ? ca1->UncheckedAt(fGlobalTracksAOD[1]->GetValue(id1)) : ca1->UncheckedAt(fGlobalTracksAOD[1]->GetValue(-(id1+1))));
-  if(!gtrack1){Fatal(sMethodName.Data(),"!gtrack1");} // TBI keep this for some time, eventually just continue
-  // Common track selection criteria for all "normal" global tracks:
-  if(!PassesGlobalTrackCuts(gtrack1)){continue;}
+  AliAODTrack *agtrack1 = agtracks1[iTrack1];
+  Int_t species1 = speciesList1[iTrack1];
 
   // Start loop over tracks in the 2nd event:
   for(Int_t iTrack2=0;iTrack2<nTracks2;iTrack2++)
   {
-   AliAODTrack *atrack2 = dynamic_cast<AliAODTrack*>(ca2->UncheckedAt(iTrack2));
-   // TBI Temporary track insanity checks:
-   if(!atrack2){Fatal(sMethodName.Data(),"!atrack2");} // TBI keep this for some time, eventually just continue
-   if(atrack2->GetID()>=0 && atrack2->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack2->GetID()>=0 && atrack2->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-   if(atrack2->TestFilterBit(128) && atrack2->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack2->TestFiletrBit(128) && atrack2->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-   if(!PassesCommonTrackCuts(atrack2)){continue;} // TBI re-think
-   // Corresponding AOD global track:
-   Int_t id2 = atrack2->GetID();
-   AliAODTrack *gtrack2 = dynamic_cast<AliAODTrack*>(id2>=0 ? ca2->UncheckedAt(fGlobalTracksAOD[2]->GetValue(id2)) : ca2->UncheckedAt(fGlobalTracksAOD[2]->GetValue(-(id2+1))));
-   if(!gtrack2){Fatal(sMethodName.Data(),"!gtrack2");} // TBI keep this for some time, eventually just continue
-   // Common track selection criteria for all "normal" global tracks:
-   if(!PassesGlobalTrackCuts(gtrack2)){continue;}
-
-   // Okay... So we have two tracks from two different events ready. let's decide whether kinemetics from 'atrack' or 'gtrack' is taken, let's check PID, and calculate the background:
-   AliAODTrack *agtrack1 = NULL; // either 'atrack' or 'gtrack', depending on the flag fFillControlHistogramsWithGlobalTrackInfo. By default, agtrack = 'atrack'
-   AliAODTrack *agtrack2 = NULL; // either 'atrack' or 'gtrack', depending on the flag fFillControlHistogramsWithGlobalTrackInfo. By default, agtrack = 'atrack'
-   if(fFillControlHistogramsWithGlobalTrackInfo)
-   {
-    agtrack1 = gtrack1;
-    agtrack2 = gtrack2;
-   }
-   else
-   {
-    agtrack1 = atrack1;
-    agtrack2 = atrack2;
-   } // if(fFillControlHistogramsWithGlobalTrackInfo)
-   if(!agtrack1){Fatal(sMethodName.Data(),"!agtrack1");}
-   if(!agtrack2){Fatal(sMethodName.Data(),"!agtrack2");}
+   AliAODTrack *agtrack2 = agtracks2[iTrack2];
+   Int_t species2 = speciesList2[iTrack2];
 
    // 1.) Same particle species:
 
    // a) pion-pion:
    //  a1) pi+pi+ [2][2]:
-   if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE))
+   if((species1 & (1<<2)) && (species2 & (1<<2)))
    {
     f2pBackground[2][2]->Fill(Q2(agtrack1,agtrack2));
    }
    //  a2) pi-pi- [7][7]:
-   if(Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,-1,kTRUE))
+   if((species1 & (1<<7)) && (species2 & (1<<7)))
    {
     f2pBackground[7][7]->Fill(Q2(agtrack1,agtrack2));
    }
    //  a3) pi+pi- || pi-pi+ [2][7]:
-   if((Pion(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE)) || (Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,1,kTRUE)))
+   if(((species1 & (1<<2)) && (species2 & (1<<7))) || ((species1 & (1<<7)) && (species2 & (1<<2))))
    {
     f2pBackground[2][7]->Fill(Q2(agtrack1,agtrack2));
    }
 
    // b) kaon-kaon:
    //  b1) K+K+ [3][3]:
-   if(Kaon(gtrack1,1,kTRUE) && Kaon(gtrack2,1,kTRUE))
+   if((species1 & (1<<3)) && (species2 & (1<<3)))
    {
     f2pBackground[3][3]->Fill(Q2(agtrack1,agtrack2));
    }
    //  b2) K-K- [8][8]:
-   if(Kaon(gtrack1,-1,kTRUE) && Kaon(gtrack2,-1,kTRUE))
+   if((species1 & (1<<8)) && (species2 & (1<<8)))
    {
     f2pBackground[8][8]->Fill(Q2(agtrack1,agtrack2));
    }
    //  b3) K+K- || K-K+ [3][8]:
-   if((Kaon(gtrack1,1,kTRUE) && Kaon(gtrack2,-1,kTRUE)) || (Kaon(gtrack1,-1,kTRUE) && Kaon(gtrack2,1,kTRUE)))
+   if(((species1 & (1<<3)) && (species2 & (1<<8))) || ((species1 & (1<<8)) && (species2 & (1<<3))))
    {
     f2pBackground[3][8]->Fill(Q2(agtrack1,agtrack2));
    }
 
    // c) proton-proton:
    //  c1) p+p+ [4][4]:
-   if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE))
+   if((species1 & (1<<4)) && (species2 & (1<<4)))
    {
     f2pBackground[4][4]->Fill(Q2(agtrack1,agtrack2));
    }
    //  c2) p-p- [9][9]:
-   if(Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE))
+   if((species1 & (1<<9)) && (species2 & (1<<9)))
    {
     f2pBackground[9][9]->Fill(Q2(agtrack1,agtrack2));
    }
    //  c3) p+p- || p-p+ [4][9]:
-   if((Proton(gtrack1,1,kTRUE) && Proton(gtrack2,-1,kTRUE)) || (Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,1,kTRUE)))
+   if(((species1 & (1<<4)) && (species2 & (1<<9))) || ((species1 & (1<<9)) && (species2 & (1<<4))))
    {
     f2pBackground[4][9]->Fill(Q2(agtrack1,agtrack2));
    }
@@ -6775,64 +6808,64 @@ void AliAnalysisTaskMultiparticleFemtoscopy::Calculate2pBackground(TClonesArray
    // 2.) Mixed particle species:
    // a) pion-kaon
    //  a1) pi+K+ [2][3]:
-   if(Pion(gtrack1,1,kTRUE) && Kaon(gtrack2,1,kTRUE))
+   if((species1 & (1<<2)) && (species2 & (1<<3)))
    {
     f2pBackground[2][3]->Fill(Q2(agtrack1,agtrack2));
    }
    //  a2) pi+K- [2][8]
-   if(Pion(gtrack1,1,kTRUE) && Kaon(gtrack2,-1,kTRUE))
+   if((species1 & (1<<2)) && (species2 & (1<<8)))
    {
     f2pBackground[2][8]->Fill(Q2(agtrack1,agtrack2));
    }
    //  a3) K+pi- [3][7]
-   if(Kaon(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE))
+   if((species1 & (1<<3)) && (species2 & (1<<7)))
    {
     f2pBackground[3][7]->Fill(Q2(agtrack1,agtrack2));
    }
    //  a4) pi-K- [7][8]
-   if(Pion(gtrack1,-1,kTRUE) && Kaon(gtrack2,-1,kTRUE))
+   if((species1 & (1<<7)) && (species2 & (1<<8)))
    {
     f2pBackground[7][8]->Fill(Q2(agtrack1,agtrack2));
    }
    // b) pion-proton
    //  b1) pi+p+ [2][4]:
-   if(Pion(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE))
+   if((species1 & (1<<2)) && (species2 & (1<<4)))
    {
     f2pBackground[2][4]->Fill(Q2(agtrack1,agtrack2));
    }
    //  b2) pi+p- [2][9]
-   if(Pion(gtrack1,1,kTRUE) && Proton(gtrack2,-1,kTRUE))
+   if((species1 & (1<<2)) && (species2 & (1<<9)))
    {
     f2pBackground[2][9]->Fill(Q2(agtrack1,agtrack2));
    }
    //  b3) p+pi- [4][7]
-   if(Proton(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE))
+   if((species1 & (1<<4)) && (species2 & (1<<7)))
    {
     f2pBackground[4][7]->Fill(Q2(agtrack1,agtrack2));
    }
    //  b4) pi-p- [7][9]
-   if(Pion(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE))
+   if((species1 & (1<<7)) && (species2 & (1<<9)))
    {
     f2pBackground[7][9]->Fill(Q2(agtrack1,agtrack2));
    }
    // c) kaon-proton
    //  c1) K+p+ [3][4]:
-   if(Kaon(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE))
+   if((species1 & (1<<3)) && (species2 & (1<<4)))
    {
     f2pBackground[3][4]->Fill(Q2(agtrack1,agtrack2));
    }
    //  c2) K+p- [3][9]
-   if(Kaon(gtrack1,1,kTRUE) && Proton(gtrack2,-1,kTRUE))
+   if((species1 & (1<<3)) && (species2 & (1<<9)))
    {
     f2pBackground[3][9]->Fill(Q2(agtrack1,agtrack2));
    }
    //  c3) p+K- [4][8]
-   if(Proton(gtrack1,1,kTRUE) && Kaon(gtrack2,-1,kTRUE))
+   if((species1 & (1<<4)) && (species2 & (1<<8)))
    {
     f2pBackground[4][8]->Fill(Q2(agtrack1,agtrack2));
    }
    //  c4) K-p- [8][9]
-   if(Kaon(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE))
+   if((species1 & (1<<8)) && (species2 & (1<<9)))
    {
     f2pBackground[8][9]->Fill(Q2(agtrack1,agtrack2));
    }
@@ -7932,77 +7965,33 @@ void AliAnalysisTaskMultiparticleFemtoscopy::Calculate3pBackground(TClonesArray
  // ...
 
  // c) Three nested loops to calculate B(k):
- Int_t nTracks1 = ca1->GetEntries();
- Int_t nTracks2 = ca2->GetEntries();
- Int_t nTracks3 = ca3->GetEntries();
+ // Tracks passing all cuts, and their PID, are determined only once per event, see CompactMixedEvent(...):
+ std::vector<AliAODTrack*> agtracks1, agtracks2, agtracks3;
+ std::vector<Int_t> speciesList1, speciesList2, speciesList3;
+ CompactMixedEvent(ca1,fGlobalTracksAOD[1],agtracks1,speciesList1);
+ CompactMixedEvent(ca2,fGlobalTracksAOD[2],agtracks2,speciesList2);
+ CompactMixedEvent(ca3,fGlobalTracksAOD[3],agtracks3,speciesList3);
+ Int_t nTracks1 = agtracks1.size();
+ Int_t nTracks2 = agtracks2.size();
+ Int_t nTracks3 = agtracks3.size();
 
  // Start loop over tracks in the 1st event:
  for(Int_t iTrack1=0;iTrack1<nTracks1;iTrack1++)
  {
-  AliAODTrack *atrack1 = dynamic_cast<AliAODTrack*>(ca1->UncheckedAt(iTrack1)); // TBI cross-check UncheckedAt
-  // TBI Temporary track insanity checks:
-  if(!atrack1){Fatal(sMethodName.Data(),"!atrack1");} // TBI keep this for some time, eventually just continue
-  if(atrack1->GetID()>=0 && atrack1->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack1->GetID()>=0 && atrack1->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-  if(atrack1->TestFilterBit(128) && atrack1->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack1->TestFiletrBit(128) && atrack1->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-  if(!PassesCommonTrackCuts(atrack1)){continue;} // TBI re-think
-  // Corresponding AOD global track:
-  Int_t id1 = atrack1->GetID();
-  AliAODTrack *gtrack1 = dynamic_cast<AliAODTrack*>(id1>=0 ? ca1->UncheckedAt(fGlobalTracksAOD[1]->GetValue(id1)) : ca1->UncheckedAt(fGlobalTracksAOD[1]->GetValue(-(id1+1))));
-  if(!gtrack1){Fatal(sMethodName.Data(),"!gtrack1");} // TBI keep this for some time, eventually just continue
-  // Common track selection criteria for all "normal" global tracks:
-  if(!PassesGlobalTrackCuts(gtrack1)){continue;}
+  AliAODTrack *agtrack1 = agtracks1[iTrack1];
+  Int_t species1 = speciesList1[iTrack1];
 
   // Start loop over tracks in the 2nd event:
   for(Int_t iTrack2=0;iTrack2<nTracks2;iTrack2++)
   {
-   AliAODTrack *atrack2 = dynamic_cast<AliAODTrack*>(ca2->UncheckedAt(iTrack2));
-   // TBI Temporary track insanity checks:
-   if(!atrack2){Fatal(sMethodName.Data(),"!atrack2");} // TBI keep this for some time, eventually just continue
-   if(atrack2->GetID()>=0 && atrack2->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack2->GetID()>=0 && atrack2->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-   if(atrack2->TestFilterBit(128) && atrack2->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack2->TestFiletrBit(128) && atrack2->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-   if(!PassesCommonTrackCuts(atrack2)){continue;} // TBI re-think
-   // Corresponding AOD global track:
-   Int_t id2 = atrack2->GetID();
-   AliAODTrack *gtrack2 = dynamic_cast<AliAODTrack*>(id2>=0 ? ca2->UncheckedAt(fGlobalTracksAOD[2]->GetValue(id2)) : ca2->UncheckedAt(fGlobalTracksAOD[2]->GetValue(-(id2+1))));
-   if(!gtrack2){Fatal(sMethodName.Data(),"!gtrack2");} // TBI keep this for some time, eventually just continue
-   // Common track selection criteria for all "normal" global tracks:
-   if(!PassesGlobalTrackCuts(gtrack2)){continue;}
+   AliAODTrack *agtrack2 = agtracks2[iTrack2];
+   Int_t species2 = speciesList2[iTrack2];
 
    // Start loop over tracks in the 3rd event:
    for(Int_t iTrack3=0;iTrack3<nTracks3;iTrack3++)
    {
-    AliAODTrack *atrack3 = dynamic_cast<AliAODTrack*>(ca3->UncheckedAt(iTrack3));
-    // TBI Temporary track insanity checks:
-    if(!atrack3){Fatal(sMethodName.Data(),"!atrack3");} // TBI keep this for some time, eventually just continue
-    if(atrack3->GetID()>=0 && atrack3->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack3->GetID()>=0 && atrack3->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-    if(atrack3->TestFilterBit(128) && atrack3->IsGlobalConstrained()){Fatal(sMethodName.Data(),"atrack3->TestFiletrBit(128) && atrack3->IsGlobalConstrained()");} // TBI keep this for some time, eventually just continue
-    if(!PassesCommonTrackCuts(atrack3)){continue;} // TBI re-think
-    // Corresponding AOD global track:
-    Int_t id3 = atrack3->GetID();
-    AliAODTrack *gtrack3 = dynamic_cast<AliAODTrack*>(id3>=0 ? ca3->UncheckedAt(fGlobalTracksAOD[3]->GetValue(id3)) : ca3->UncheckedAt(fGlobalTracksAOD[3]->GetValue(-(id3+1))));
-    if(!gtrack3){Fatal(sMethodName.Data(),"!gtrack3");} // TBI keep this for some time, eventually just continue
-    // Common track selection criteria for all "normal" global tracks:
-    if(!PassesGlobalTrackCuts(gtrack3)){continue;}
-
-    // Okay... So we have three tracks from three different events ready. let's decide whether kinemetics from 'atrack' or 'gtrack' is taken, let's check PID, and calculate the background:
-    AliAODTrack *agtrack1 = NULL; // either 'atrack' or 'gtrack', depending on the flag fFillControlHistogramsWithGlobalTrackInfo. By default, agtrack = 'atrack'
-    AliAODTrack *agtrack2 = NULL; // either 'atrack' or 'gtrack', depending on the flag fFillControlHistogramsWithGlobalTrackInfo. By default, agtrack = 'atrack'
-    AliAODTrack *agtrack3 = NULL; // either 'atrack' or 'gtrack', depending on the flag fFillControlHistogramsWithGlobalTrackInfo. By default, agtrack = 'atrack'
-    if(fFillControlHistogramsWithGlobalTrackInfo)
-    {
-     agtrack1 = gtrack1;
-     agtrack2 = gtrack2;
-     agtrack3 = gtrack3;
-    }
-    else
-    {
-     agtrack1 = atrack1;
-     agtrack2 = atrack2;
-     agtrack3 = atrack3;
-    } // if(fFillControlHistogramsWithGlobalTrackInfo)
-    if(!agtrack1){Fatal(sMethodName.Data(),"!agtrack1");}
-    if(!agtrack2){Fatal(sMethodName.Data(),"!agtrack2");}
-    if(!agtrack3){Fatal(sMethodName.Data(),"!agtrack3");}
+    AliAODTrack *agtrack3 = agtracks3[iTrack3];
+    Int_t species3 = speciesList3[iTrack3];
 
     // Cases of interest (needs to be synchronized with the calculations of correlations functions):
     // a) Same species and same charge;
@@ -8012,168 +8001,168 @@ void AliAnalysisTaskMultiparticleFemtoscopy::Calculate3pBackground(TClonesArray
 
     // a) Same species:
     // pi+pi+pi+
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE) && Pion(gtrack3,1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<2)) && (species3 & (1<<2)))
     {
      f3pBackground[2][2][2]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi-pi-pi-
-    if(Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Pion(gtrack3,-1,kTRUE))
+    if((species1 & (1<<7)) && (species2 & (1<<7)) && (species3 & (1<<7)))
     {
      f3pBackground[7][7][7]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // K+K+K+
-    if(Kaon(gtrack1,1,kTRUE) && Kaon(gtrack2,1,kTRUE) && Kaon(gtrack3,1,kTRUE))
+    if((species1 & (1<<3)) && (species2 & (1<<3)) && (species3 & (1<<3)))
     {
      f3pBackground[3][3][3]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // K-K-K-
-    if(Kaon(gtrack1,-1,kTRUE) && Kaon(gtrack2,-1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<8)) && (species2 & (1<<8)) && (species3 & (1<<8)))
     {
      f3pBackground[8][8][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p+p+p+
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE) && Proton(gtrack3,1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<4)) && (species3 & (1<<4)))
     {
      f3pBackground[4][4][4]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p-p-p-
-    if(Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE) && Proton(gtrack3,-1,kTRUE))
+    if((species1 & (1<<9)) && (species2 & (1<<9)) && (species3 & (1<<9)))
     {
      f3pBackground[9][9][9]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
 
     // b) Same species but different charge combinations (modulo permutations):
     // pi+pi+pi-
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE) && Pion(gtrack3,-1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<2)) && (species3 & (1<<7)))
     {
      f3pBackground[2][2][7]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi-pi-
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Pion(gtrack3,-1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<7)) && (species3 & (1<<7)))
     {
      f3pBackground[2][7][7]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // K+K+K-
-    if(Kaon(gtrack1,1,kTRUE) && Kaon(gtrack2,1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<3)) && (species2 & (1<<3)) && (species3 & (1<<8)))
     {
      f3pBackground[3][3][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // K+K-K-
-    if(Kaon(gtrack1,1,kTRUE) && Kaon(gtrack2,-1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<3)) && (species2 & (1<<8)) && (species3 & (1<<8)))
     {
      f3pBackground[3][8][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p+p+p-
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE) && Proton(gtrack3,-1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<4)) && (species3 & (1<<9)))
     {
      f3pBackground[4][4][9]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p+p-p-
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,-1,kTRUE) && Proton(gtrack3,-1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<9)) && (species3 & (1<<9)))
     {
      f3pBackground[4][9][9]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
 
     // c) Two pions + something else (modulo permutations):
     // pi+pi+K+
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE) && Kaon(gtrack3,1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<2)) && (species3 & (1<<3)))
     {
      f3pBackground[2][2][3]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi+K-
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<2)) && (species3 & (1<<8)))
     {
      f3pBackground[2][2][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi-pi-K+
-    if(Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Kaon(gtrack3,1,kTRUE))
+    if((species1 & (1<<7)) && (species2 & (1<<7)) && (species3 & (1<<3)))
     {
      f3pBackground[7][7][3]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi-pi-K-
-    if(Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<7)) && (species2 & (1<<7)) && (species3 & (1<<8)))
     {
      f3pBackground[7][7][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi-K+
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Kaon(gtrack3,1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<7)) && (species3 & (1<<3)))
     {
      f3pBackground[2][7][3]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi-K-
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<7)) && (species3 & (1<<8)))
     {
      f3pBackground[2][7][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi+p+
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE) && Proton(gtrack3,1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<2)) && (species3 & (1<<4)))
     {
      f3pBackground[2][2][4]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi+p-
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,1,kTRUE) && Proton(gtrack3,-1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<2)) && (species3 & (1<<9)))
     {
      f3pBackground[2][2][9]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi-pi-p+
-    if(Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Proton(gtrack3,1,kTRUE))
+    if((species1 & (1<<7)) && (species2 & (1<<7)) && (species3 & (1<<4)))
     {
      f3pBackground[7][7][4]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi-pi-p-
-    if(Pion(gtrack1,-1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Proton(gtrack3,-1,kTRUE))
+    if((species1 & (1<<7)) && (species2 & (1<<7)) && (species3 & (1<<9)))
     {
      f3pBackground[7][7][9]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi-p+
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Proton(gtrack3,1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<7)) && (species3 & (1<<4)))
     {
      f3pBackground[2][7][4]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // pi+pi-p-
-    if(Pion(gtrack1,1,kTRUE) && Pion(gtrack2,-1,kTRUE) && Proton(gtrack3,-1,kTRUE))
+    if((species1 & (1<<2)) && (species2 & (1<<7)) && (species3 & (1<<9)))
     {
      f3pBackground[2][7][9]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
 
     // d) Two nucleons + something else (modulo permutations):
     // p+p+pi+
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE) && Pion(gtrack3,1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<4)) && (species3 & (1<<2)))
     {
      f3pBackground[4][4][2]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p+p+pi-
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE) && Pion(gtrack3,-1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<4)) && (species3 & (1<<7)))
     {
      f3pBackground[4][4][7]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p+p+K+
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE) && Kaon(gtrack3,1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<4)) && (species3 & (1<<3)))
     {
      f3pBackground[4][4][3]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p+p+K-
-    if(Proton(gtrack1,1,kTRUE) && Proton(gtrack2,1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<4)) && (species2 & (1<<4)) && (species3 & (1<<8)))
     {
      f3pBackground[4][4][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p-p-pi+
-    if(Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE) && Pion(gtrack3,1,kTRUE))
+    if((species1 & (1<<9)) && (species2 & (1<<9)) && (species3 & (1<<2)))
     {
      f3pBackground[9][9][2]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p-p-pi-
-    if(Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE) && Pion(gtrack3,-1,kTRUE))
+    if((species1 & (1<<9)) && (species2 & (1<<9)) && (species3 & (1<<7)))
     {
      f3pBackground[9][9][7]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p-p-K+
-    if(Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE) && Kaon(gtrack3,1,kTRUE))
+    if((species1 & (1<<9)) && (species2 & (1<<9)) && (species3 & (1<<3)))
     {
      f3pBackground[9][9][3]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
     // p-p-K-
-    if(Proton(gtrack1,-1,kTRUE) && Proton(gtrack2,-1,kTRUE) && Kaon(gtrack3,-1,kTRUE))
+    if((species1 & (1<<9)) && (species2 & (1<<9)) && (species3 & (1<<8)))
     {
      f3pBackground[9][9][8]->Fill(Q3(agtrack1,agtrack2,agtrack3));
     }
@@ -8482,8 +8471,6 @@ void AliAnalysisTaskMultiparticleFemtoscopy::Calculate2pBackground(TClonesArray
  // d) Shift [1] -> [0];
  // e) Clean [1].
 
- TString pattern = ".11.13.211.321.2212."; // TBI this can be done programatically TBI only for these particles I need to estimate background TBI move this somewhere else
-
  // a) Insanity checks:
  if(!bMC) return; // TBI this is not really needed...
  TString sMethodName = "void AliAnalysisTaskMultiparticleFemtoscopy::Calculate2pBackground(TClonesArray *ca1, TClonesArray *ca2, Bool_t bMC)";
@@ -8514,7 +8501,7 @@ void AliAnalysisTaskMultiparticleFemtoscopy::Calculate2pBackground(TClonesArray
    if(!PassesCommonTrackCuts(amcparticle2)){continue;} // TBI re-think
 
    // Okay... So we have two tracks from two different events ready. Let's check PID, and calculate the background:
-   if(!(pattern.Contains(Form(".%d.",TMath::Abs(amcparticle1->GetPdgCode()))) && pattern.Contains(Form(".%d.",TMath::Abs(amcparticle2->GetPdgCode()))))){continue;}
+   if(!(SupportedPdg(amcparticle1->GetPdgCode()) && SupportedPdg(amcparticle2->GetPdgCode()))){continue;}
 
    // Determine the indices of correlation function to be filled:
    Int_t index1 = -44;
@@ -31,6 +31,8 @@
 #include "THnSparse.h"
 #include "TSystem.h"
 
+#include <vector>
+
 //================================================================================================================
 
 class AliAnalysisTaskMultiparticleFemtoscopy : public AliAnalysisTaskSE{
@@ -101,6 +103,7 @@ class AliAnalysisTaskMultiparticleFemtoscopy : public AliAnalysisTaskSE{
   Bool_t Pion(AliAODTrack *atrack, Int_t charge = 1, Bool_t bPrimary = kTRUE);
   Bool_t Kaon(AliAODTrack *atrack, Int_t charge = 1, Bool_t bPrimary = kTRUE);
   Bool_t Proton(AliAODTrack *atrack, Int_t charge = 1, Bool_t bPrimary = kTRUE);
+  static Bool_t SupportedPdg(Int_t pdg); // PDG codes supported in MC correlation functions and background (e, mu, pi, K, p)
   Bool_t PassesCommonEventCuts(AliVEvent *ave);
   Bool_t PassesMixedEventCuts(AliVEvent *ave);
   Bool_t PassesGlobalTrackCuts(AliAODTrack *gtrack); // common cuts for global tracks TBI make it uniform with MC
@@ -128,6 +131,7 @@ class AliAnalysisTaskMultiparticleFemtoscopy : public AliAnalysisTaskSE{
    virtual void Calculate4pCorrelationFunctions(AliAODEvent *aAOD);
   virtual void CalculateCorrelationFunctions(AliMCEvent *aMC);
   virtual void CalculateCorrelationFunctionsTEST(AliAODEvent *aAOD);
+  virtual void CompactMixedEvent(TClonesArray *ca, TExMap *em, std::vector<AliAODTrack*> &agtracks, std::vector<Int_t> &species); // tracks of one buffered event passing all cuts, with their PID bitset
   virtual void Calculate2pBackground(TClonesArray *ca1, TClonesArray *ca2); // TBI soon will become obsolete
   virtual void Calculate2pBackground(TClonesArray *ca1, TClonesArray *ca2, TExMap *em1, TExMap *em2);
   virtual void Calculate2pBackgroundTEST(TClonesArray *ca1, TClonesArray *ca2, TExMap *em1, TExMap *em2);
@@ -41,6 +41,7 @@
 #include <TMatrix.h>
 #include "TMCProcess.h"
 #include "TParticle.h"
+#include "TH1I.h"
 #include "TH2F.h"
 #include "AliStack.h"
 #include "TBrowser.h"
@@ -177,6 +178,7 @@ AliFlowTrackCuts::AliFlowTrackCuts():
   fTrackEta(0.),
   fTrackWeight(1.),
   fTrackLabel(INT_MIN),
+  fRejectedBy(kAccepted),
   fMCevent(NULL),
   fMCparticle(NULL),
   fEvent(NULL),
@@ -329,6 +331,7 @@ AliFlowTrackCuts::AliFlowTrackCuts(const char* name):
   fTrackEta(0.),
   fTrackWeight(1.),
   fTrackLabel(INT_MIN),
+  fRejectedBy(kAccepted),
   fMCevent(NULL),
   fMCparticle(NULL),
   fEvent(NULL),
@@ -484,6 +487,7 @@ AliFlowTrackCuts::AliFlowTrackCuts(const AliFlowTrackCuts& that):
   fTrackEta(0.),
   fTrackWeight(1.),
   fTrackLabel(INT_MIN),
+  fRejectedBy(kAccepted),
   fMCevent(NULL),
   fMCparticle(NULL),
   fEvent(NULL),
@@ -664,6 +668,7 @@ AliFlowTrackCuts& AliFlowTrackCuts::operator=(const AliFlowTrackCuts& that)
   fTrackPhi=0.;
   fTrackWeight=1.;
   fTrackLabel=INT_MIN;
+  fRejectedBy=kAccepted;
   fMCevent=NULL;
   fMCparticle=NULL;
   fEvent=NULL;
@@ -1192,17 +1197,21 @@ Bool_t AliFlowTrackCuts::PassesCuts(AliVParticle* vparticle)
     if (charge!=fCharge) pass=kFALSE;
   }
   //if(fCutPID) {if (fTrack->PID() != fPID) pass=kFALSE;}
+  if (RejectedAt(pass,kRejKinematics)) return kFALSE;
 
   //when additionally MC info is required
   if (fCutMC && !PassesMCcuts()) pass=kFALSE;
+  if (RejectedAt(pass,kRejMC)) return kFALSE;
 
   //the case of ESD or AOD
   if (esdTrack) { if (!PassesESDcuts(esdTrack)) { pass=kFALSE; } }
   if (aodTrack) { if (!PassesAODcuts(aodTrack,pass)) { pass=kFALSE; } }
   if (aodNanoTrack) { if (!PassesNanoAODcuts(aodNanoTrack,pass)) { pass=kFALSE; } }
+  RejectedAt(pass,kRejTrackQuality);
  
   if (fQA)
   {
+    QArejection()->Fill(fRejectedBy);
     if (fMCparticle)
     {
       TParticle* tparticle=fMCparticle->Particle();
@@ -1544,9 +1553,13 @@ Bool_t AliFlowTrackCuts::PassesNanoAODcuts(const AliNanoAODTrack* track, Bool_t
 Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFid)
 {
   //check cuts for AOD
+  //cheap cuts first, the DCA, sector boundary and PID cuts are skipped for rejected tracks unless QA is filled
   Bool_t pass = passedFid;
 //  AliAODPid *pidObj = track->GetDetPid();
   
+  if (fUseAODFilterBit && !track->TestFilterBit(fAODFilterBit)) pass=kFALSE;
+  if (RejectedAt(pass,kRejFilterBit)) return kFALSE;
+
   // cut on # TPC clusters
   Int_t ntpccls = track->GetTPCNcls();
   if (fCutNClustersTPC) {
@@ -1625,8 +1638,8 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
   
   if (GetRequireTPCRefit() && !(track->GetStatus() & AliESDtrack::kTPCrefit) ) pass=kFALSE;
   if (GetRequireITSRefit() && !(track->GetStatus() & AliESDtrack::kITSrefit) ) pass=kFALSE;
+  if (RejectedAt(pass,kRejTrackQuality)) return kFALSE;
   
-  if (fUseAODFilterBit && !track->TestFilterBit(fAODFilterBit)) pass=kFALSE;
   Double_t DCAxy = track->DCA();
   Double_t DCAz = track->ZAtDCA();
   if(fCutDCAToVertexXYAOD || fCutDCAToVertexZAOD || fCutDCAToVertexXYPtDepAOD) {
@@ -1658,6 +1671,7 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
       if (TMath::Abs(DCAz)>fMaxDCAzAOD) pass=kFALSE;
     }
   }
+  if (RejectedAt(pass,kRejDCA)) return kFALSE;
   Double_t dedx = track->GetTPCsignal();
   if(fCutMinimalTPCdedx) {
     if (dedx < fMinimalTPCdedx) pass=kFALSE;
@@ -1690,11 +1704,13 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
     if(phimod < fPhiCutHigh->Eval(track->Pt()) && phimod > fPhiCutLow->Eval(track->Pt()))
       pass=kFALSE; // reject track
   }
+  if (RejectedAt(pass,kRejTrackQuality)) return kFALSE;
 
   if (fCutPID && (fParticleID!=AliPID::kUnknown)) //if kUnknown don't cut on PID
   {
     if (!PassesAODpidCut(track)) pass=kFALSE;
   }
+  RejectedAt(pass,kRejPID);
 
   if (fQA) {
     // changed 04062014 used to be filled before possible PID cut
@@ -1783,12 +1799,14 @@ Bool_t AliFlowTrackCuts::PassesESDcuts(AliESDtrack* track)
   {
     if (nitscls < fNClustersITSMin || nitscls > fNClustersITSMax) pass=kFALSE;
   }
+  if (RejectedAt(pass,kRejTrackQuality)) return kFALSE;
 
   //some stuff is still handled by AliESDtrackCuts class - delegate
   if (fAliESDtrackCuts)
   {
     if (!fAliESDtrackCuts->IsSelected(track)) pass=kFALSE;
   }
+  if (RejectedAt(pass,kRejTrackQuality)) return kFALSE;
  
   //PID part with pid QA
   Double_t beta = GetBeta(track);
@@ -1810,6 +1828,7 @@ Bool_t AliFlowTrackCuts::PassesESDcuts(AliESDtrack* track)
     track->GetTPCpid(pidTPC);
     if (pidTPC[AliPID::kElectron]<fParticleProbability) pass=kFALSE;
   }
+  RejectedAt(pass,kRejPID);
   if(fCutITSclusterShared) {  
     Int_t counterForSharedCluster=MaxSharedITSClusterCuts(track);
     if(counterForSharedCluster >= fMaxITSclusterShared) pass=kFALSE;
@@ -2826,6 +2845,10 @@ void AliFlowTrackCuts::DefineHistograms()
   after->SetName("after");
   fQA->Add(before);
   fQA->Add(after);
+  TH1I* rejection = new TH1I("RejectedBy",";first rejecting cut;tracks",kNRejections,0.,kNRejections);
+  const char* rejectionLabels[kNRejections] = {"accepted","kinematics","MC","filter bit","track quality","DCA","PID"};
+  for (Int_t i=0; i<kNRejections; i++) rejection->GetXaxis()->SetBinLabel(i+1,rejectionLabels[i]);
+  fQA->Add(rejection);
   before->Add(new TH2F("TOFbeta",";p [GeV/c];#beta",kNbinsP,binsP,1000,0.4,1.1)); //0
   after->Add(new TH2F("TOFbeta",";p [GeV/c];#beta",kNbinsP,binsP,1000,0.4,1.1)); //0
   before->Add(new TH2F("TPCdedx",";p [GeV/c];dEdx",kNbinsP,binsP,500,0,500)); //1
@@ -3166,6 +3189,7 @@ void AliFlowTrackCuts::ClearTrack(Option_t*)
   fTrack=NULL;
   fMCparticle=NULL;
   fTrackLabel=-997;
+  fRejectedBy=kAccepted;
   fTrackWeight=1.0;
   fTrackEta=0.0;
   fTrackPhi=0.0;
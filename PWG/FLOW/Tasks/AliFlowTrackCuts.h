@@ -105,6 +105,15 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
                    kTPCTOFNsigmaPurity, // purity>0.8 cut on combined tpc tof nsigma
 				   kTPCTPCTOFNsigma ////cut on sigma tpc below certain pt, on combined tpc tof sigma above (AOD)
                    };
+  enum trackRejection { kAccepted,        // passed all cuts
+                        kRejKinematics,   // label, pt, eta, phi, charge
+                        kRejMC,           // MC cuts
+                        kRejFilterBit,    // AOD filter bit
+                        kRejTrackQuality, // clusters, chi2, refits, sector boundaries, AliESDtrackCuts
+                        kRejDCA,          // distance of closest approach (AOD)
+                        kRejPID,          // particle identification
+                        kNRejections
+                      };
 
   //setters (interface to AliESDtrackCuts)
   Int_t MaxSharedITSClusterCuts(AliESDtrack* track);
@@ -222,6 +231,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   TList* GetQA() const {return fQA;}
   TH1* QAbefore(Int_t i) {return static_cast<TH1*>(static_cast<TList*>(fQA->At(0))->At(i));}
   TH1* QAafter(Int_t i) {return static_cast<TH1*>(static_cast<TList*>(fQA->At(1))->At(i));}  
+  TH1* QArejection() {return static_cast<TH1*>(fQA->At(2));} //first cut rejecting the track, see trackRejection
 
   //MC stuff
   void SetIgnoreSignInMCPID( Bool_t b=kTRUE ) {fIgnoreSignInMCPID=b;}
@@ -360,6 +370,8 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   //AliFlowTrack* MakeFlowTrackVZERO() const;
   //AliFlowTrack* MakeFlowTrackVParticle() const;
   Bool_t FillFlowTrackVParticle(AliFlowTrack* t) const;
+  //remember the first cut stage rejecting the track; without QA the remaining cuts need not be evaluated
+  Bool_t RejectedAt(Bool_t pass, trackRejection stage) {if (!pass && fRejectedBy==kAccepted) fRejectedBy=stage; return (!pass && !fQA);}
   Bool_t FillFlowTrackGeneric(AliFlowTrack* t) const;
   AliFlowTrack* FillFlowTrackKink(TObjArray* trackCollection, Int_t trackIndex) const;
   AliFlowTrack* FillFlowTrackVZERO(TObjArray* trackCollection, Int_t trackIndex) const;
@@ -478,6 +490,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Double_t fTrackEta;                //!track eta
   Double_t fTrackWeight;             //!track weight
   Int_t fTrackLabel;                 //!track label, or its absolute value if FakesAreOK
+  Int_t fRejectedBy;                 //!first cut stage which rejected the current track (trackRejection)
   AliMCEvent* fMCevent;              //!mc event
   AliMCParticle* fMCparticle;        //!mc particle
   AliVEvent* fEvent;                 //!placeholder for current event
@@ -533,7 +546,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Double_t  fMaxITSChi2;                // fMaxITSChi2
   Int_t         fRun;                   // run number
   
-  ClassDef(AliFlowTrackCuts,21)
+  ClassDef(AliFlowTrackCuts,22)
 };
 
 #endif
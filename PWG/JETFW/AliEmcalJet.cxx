@@ -64,7 +64,9 @@ AliEmcalJet::AliEmcalJet() :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentBlockOffset(-1),
+  fConstituentBlockLength(0)
 {
   fClosestJets[0] = 0;
   fClosestJets[1] = 0;
@@ -116,7 +118,9 @@ AliEmcalJet::AliEmcalJet(Double_t px, Double_t py, Double_t pz) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentBlockOffset(-1),
+  fConstituentBlockLength(0)
 {
   if (fPt != 0) {
     fPhi = TVector2::Phi_0_2pi(TMath::ATan2(py, px));
@@ -173,7 +177,9 @@ AliEmcalJet::AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentBlockOffset(-1),
+  fConstituentBlockLength(0)
 {
   fPhi = TVector2::Phi_0_2pi(fPhi);
 
@@ -224,7 +230,9 @@ AliEmcalJet::AliEmcalJet(const AliEmcalJet& jet) :
   fJetShapeProperties(0),
   fJetAcceptanceType(jet.fJetAcceptanceType),
   fParticleConstituents(jet.fParticleConstituents),
-  fClusterConstituents(jet.fClusterConstituents)
+  fClusterConstituents(jet.fClusterConstituents),
+  fConstituentBlockOffset(jet.fConstituentBlockOffset),
+  fConstituentBlockLength(jet.fConstituentBlockLength)
 
 {
   // Copy constructor.
@@ -296,6 +304,8 @@ AliEmcalJet& AliEmcalJet::operator=(const AliEmcalJet& jet)
     fJetAcceptanceType  = jet.fJetAcceptanceType;
     fParticleConstituents = jet.fParticleConstituents;
     fClusterConstituents = jet.fClusterConstituents;
+    fConstituentBlockOffset = jet.fConstituentBlockOffset;
+    fConstituentBlockLength = jet.fConstituentBlockLength;
   }
 
   return *this;
@@ -677,6 +687,8 @@ void AliEmcalJet::Clear(Option_t */*option*/)
   fHasGhost = kFALSE;
   fClusterConstituents.clear();
   fParticleConstituents.clear();
+  fConstituentBlockOffset = -1;
+  fConstituentBlockLength = 0;
 }
 
 /**
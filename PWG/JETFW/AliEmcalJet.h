@@ -241,6 +241,25 @@ class AliEmcalJet : public AliVParticle
    */
   bool HasParticleConstituent(const AliVParticle *const part) const;
 
+  /**
+   * @brief Get the position of the first constituent of the jet in the constituent block of the jet branch
+   * @return Offset in the PWG::JETFW::AliEmcalJetConstituentBlock (-1 if the block is not filled)
+   */
+  Int_t GetConstituentBlockOffset() const { return fConstituentBlockOffset; }
+
+  /**
+   * @brief Get the number of constituents of the jet in the constituent block of the jet branch
+   * @return Number of entries of this jet in the PWG::JETFW::AliEmcalJetConstituentBlock
+   */
+  Int_t GetConstituentBlockLength() const { return fConstituentBlockLength; }
+
+  /**
+   * @brief Allocate memory for the constituent objects
+   * @param[in] nparticles Number of particle constituents
+   * @param[in] nclusters Number of cluster constituents
+   */
+  void ReserveConstituents(UInt_t nparticles, UInt_t nclusters) { fParticleConstituents.reserve(nparticles); fClusterConstituents.reserve(nclusters); }
+
   // Fragmentation function
   Double_t          GetZ(const Double_t trkPx, const Double_t trkPy, const Double_t trkPz)  const;
   Double_t          GetZ(const AliVParticle* trk )                                          const;
@@ -253,6 +272,7 @@ class AliEmcalJet : public AliVParticle
 
   // Setters
   void              SetLabel(Int_t l)                  { fLabel   = l;                     }
+  void              SetConstituentBlockRange(Int_t offset, Int_t length) { fConstituentBlockOffset = offset; fConstituentBlockLength = length; }
   void              SetArea(Double_t a)                { fArea    = a;                     }
   void              SetAreaEta(Double_t a)             { fAreaEta = a;                     }
   void              SetAreaPhi(Double_t a)             { fAreaPhi = TVector2::Phi_0_2pi(a); }
@@ -435,6 +455,8 @@ class AliEmcalJet : public AliVParticle
 
   std::vector<PWG::JETFW::AliEmcalParticleJetConstituent>      fParticleConstituents;  ///< List of particle constituents
   std::vector<PWG::JETFW::AliEmcalClusterJetConstituent>       fClusterConstituents;   ///< List of cluster constituents
+  Int_t             fConstituentBlockOffset; ///< Position of the first constituent of the jet in the constituent block of the jet branch (-1 if not filled)
+  Int_t             fConstituentBlockLength; ///< Number of constituents of the jet in the constituent block of the jet branch
 
  private:
   /**
@@ -447,7 +469,7 @@ class AliEmcalJet : public AliVParticle
   };
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJet,19);
+  ClassDef(AliEmcalJet,20);
   /// \endcond
 };
 
@@ -0,0 +1,100 @@
+/************************************************************************************
+ * Copyright (C) 2018, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <TMath.h>
+
+#include "AliEmcalJetConstituentBlock.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::JETFW::AliEmcalJetConstituentBlock)
+/// \endcond
+
+namespace PWG {
+namespace JETFW {
+
+AliEmcalJetConstituentBlock::AliEmcalJetConstituentBlock() :
+    TNamed(),
+    fPx(),
+    fPy(),
+    fPz(),
+    fE(),
+    fCharge(),
+    fContainer(),
+    fGlobalIndex()
+{
+
+}
+
+AliEmcalJetConstituentBlock::AliEmcalJetConstituentBlock(const char *name) :
+    TNamed(name, name),
+    fPx(),
+    fPy(),
+    fPz(),
+    fE(),
+    fCharge(),
+    fContainer(),
+    fGlobalIndex()
+{
+
+}
+
+void AliEmcalJetConstituentBlock::Clear(Option_t * /*option*/) {
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fE.clear();
+  fCharge.clear();
+  fContainer.clear();
+  fGlobalIndex.clear();
+}
+
+void AliEmcalJetConstituentBlock::Reserve(UInt_t n) {
+  fPx.reserve(n);
+  fPy.reserve(n);
+  fPz.reserve(n);
+  fE.reserve(n);
+  fCharge.reserve(n);
+  fContainer.reserve(n);
+  fGlobalIndex.reserve(n);
+}
+
+Int_t AliEmcalJetConstituentBlock::AddConstituent(Double_t px, Double_t py, Double_t pz, Double_t e, Int_t charge, Int_t container, UInt_t globalIndex) {
+  fPx.push_back(px);
+  fPy.push_back(py);
+  fPz.push_back(pz);
+  fE.push_back(e);
+  fCharge.push_back(charge);
+  fContainer.push_back(container);
+  fGlobalIndex.push_back(globalIndex);
+  return fPx.size() - 1;
+}
+
+Double_t AliEmcalJetConstituentBlock::Pt(Int_t i) const {
+  return TMath::Sqrt(fPx[i] * fPx[i] + fPy[i] * fPy[i]);
+}
+
+}
+}
@@ -0,0 +1,154 @@
+/************************************************************************************
+ * Copyright (C) 2018, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALJETCONSTITUENTBLOCK_H
+#define ALIEMCALJETCONSTITUENTBLOCK_H
+
+#include <vector>
+#include <TNamed.h>
+
+/**
+ * @namespace PWG
+ * @brief Basic namespace for general framework objects
+ */
+namespace PWG {
+
+/**
+ * @namespace JETFW
+ * @brief Namespace for objects belonging to the ALICE jet framework
+ * @ingroup JETFW
+ */
+namespace JETFW {
+
+/**
+ * @class AliEmcalJetConstituentBlock
+ * @brief Compact storage of the constituents of all jets of a jet branch in one event
+ * @ingroup JETFW
+ *
+ * The constituents of all jets of the event are stored one after the other in flat
+ * arrays (px, py, pz, E, charge, container id, global index), one array per quantity.
+ * Each jet refers to its constituents via an offset and a length in the block
+ * (see AliEmcalJet::GetConstituentBlockOffset() and AliEmcalJet::GetConstituentBlockLength()),
+ * so that substructure analyses can loop over the constituents of a jet without going
+ * through the containers and the TClonesArrays of the input objects:
+ *
+ * ~~~{.cxx}
+ * for (Int_t i = jet->GetConstituentBlockOffset(); i < jet->GetConstituentBlockOffset() + jet->GetConstituentBlockLength(); i++) {
+ *   Double_t pt = block->Pt(i);
+ *   ...
+ * }
+ * ~~~
+ *
+ * The container id is the index of the particle container in the jet finder for particle
+ * constituents and -1 - index of the cluster container for cluster constituents.
+ * Clearing the block keeps the allocated memory, so that it is not reallocated event by event.
+ */
+class AliEmcalJetConstituentBlock : public TNamed {
+public:
+  /**
+   * @brief Constructor
+   */
+  AliEmcalJetConstituentBlock();
+
+  /**
+   * @brief Constructor
+   * @param[in] name Name of the block, usually the name of the jet branch with suffix "_constituents"
+   */
+  AliEmcalJetConstituentBlock(const char *name);
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalJetConstituentBlock() {}
+
+  /**
+   * @brief Remove all constituents, keeping the allocated memory
+   * @param[in] option Not used
+   */
+  virtual void Clear(Option_t *option = "");
+
+  /**
+   * @brief Allocate memory for a number of constituents
+   * @param[in] n Expected number of constituents in the event
+   */
+  void Reserve(UInt_t n);
+
+  /**
+   * @brief Append a constituent to the block
+   * @param[in] px x-component of the momentum
+   * @param[in] py y-component of the momentum
+   * @param[in] pz z-component of the momentum
+   * @param[in] e Energy
+   * @param[in] charge Charge (0 for clusters)
+   * @param[in] container Container id (see class description)
+   * @param[in] globalIndex Index of the constituent in the global index map
+   * @return Index of the constituent in the block
+   */
+  Int_t AddConstituent(Double_t px, Double_t py, Double_t pz, Double_t e, Int_t charge, Int_t container, UInt_t globalIndex);
+
+  /**
+   * @brief Get the number of constituents of all jets in the block
+   * @return Number of constituents
+   */
+  Int_t GetNConstituents() const { return fPx.size(); }
+
+  Double_t Px(Int_t i)             const { return fPx[i]; }
+  Double_t Py(Int_t i)             const { return fPy[i]; }
+  Double_t Pz(Int_t i)             const { return fPz[i]; }
+  Double_t E(Int_t i)              const { return fE[i]; }
+  Double_t Pt(Int_t i)             const;
+  Int_t    Charge(Int_t i)         const { return fCharge[i]; }
+  Int_t    GetContainer(Int_t i)   const { return fContainer[i]; }
+  Bool_t   IsCluster(Int_t i)      const { return fContainer[i] < 0; }
+  UInt_t   GetGlobalIndex(Int_t i) const { return fGlobalIndex[i]; }
+
+  /**
+   * @brief Direct access to the arrays, e.g. for vectorised loops over the constituents of a jet
+   */
+  const Float_t *GetPxArray()      const { return fPx.data(); }
+  const Float_t *GetPyArray()      const { return fPy.data(); }
+  const Float_t *GetPzArray()      const { return fPz.data(); }
+  const Float_t *GetEArray()       const { return fE.data(); }
+
+protected:
+  std::vector<Float_t>  fPx;            ///< x-component of the momentum of the constituents
+  std::vector<Float_t>  fPy;            ///< y-component of the momentum of the constituents
+  std::vector<Float_t>  fPz;            ///< z-component of the momentum of the constituents
+  std::vector<Float_t>  fE;             ///< energy of the constituents
+  std::vector<Char_t>   fCharge;        ///< charge of the constituents
+  std::vector<Short_t>  fContainer;     ///< container id of the constituents (see class description)
+  std::vector<UInt_t>   fGlobalIndex;   ///< index of the constituents in the global index map
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetConstituentBlock, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif /* ALIEMCALJETCONSTITUENTBLOCK_H */
@@ -53,7 +53,9 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fBulkBins(0),
+  fBulkSize(0)
 {
   // Constructor
 }
@@ -69,7 +71,9 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fBulkBins(0),
+  fBulkSize(0)
 {
   // Constructor
 
@@ -106,7 +110,9 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fBulkBins(0),
+  fBulkSize(0)
 {
   //
   // AliTHnT copy constructor
@@ -135,6 +141,7 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  delete[] fBulkBins;
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -254,15 +261,24 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
     if (entry == 0) 
       continue;
 
+    if (entry->fNBins != fNBins || entry->fNSteps != fNSteps)
+    {
+      AliError(Form("Cannot merge %s: %lld bins and %d steps instead of %lld and %d", entry->GetName(), entry->fNBins, entry->fNSteps, fNBins, fNSteps));
+      continue;
+    }
+
     for (Int_t i=0; i<fNSteps; i++)
     {
+      // plain pointers, so that the compiler does not reload the arrays at each bin and can vectorize the sums
       if (entry->fValues[i])
       {
 	if (!fValues[i])
 	  fValues[i] = new TemplateArray(fNBins);
       
+	TemplateType* target = fValues[i]->GetArray();
+	const TemplateType* source = entry->fValues[i]->GetArray();
 	for (Long64_t l = 0; l<fNBins; l++)
-	  fValues[i]->GetArray()[l] += entry->fValues[i]->GetArray()[l];
+	  target[l] += source[l];
       }
 
       if (entry->fSumw2[i])
@@ -270,8 +286,10 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
 	if (!fSumw2[i])
 	  fSumw2[i] = new TemplateArray(fNBins);
       
+	TemplateType* target = fSumw2[i]->GetArray();
+	const TemplateType* source = entry->fSumw2[i]->GetArray();
 	for (Long64_t l = 0; l<fNBins; l++)
-	  fSumw2[i]->GetArray()[l] += entry->fSumw2[i]->GetArray()[l];
+	  target[l] += source[l];
       }
     }
     
@@ -281,6 +299,30 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
   return count+1;
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache()
+{
+  // fills the axis cache used by Fill and FillN
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+  }
+  
+  fLastVars = new Double_t[fNVars];
+  fLastBins = new Int_t[fNVars];
+  
+  // initial values to prevent checking for 0 in Fill
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    fLastVars[i] = axisCache[i]->GetXmin();
+    fLastBins[i] = axisCache[i]->FindBin(fLastVars[i]);
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
 {
@@ -288,25 +330,7 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 
   // fill axis cache
   if (!axisCache)
-  {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
-    
-    fLastVars = new Double_t[fNVars];
-    fLastBins = new Int_t[fNVars];
-    
-    // initial values to prevent checking for 0 below
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      fLastBins[i] = axisCache[i]->FindBin(var[i]);
-      fLastVars[i] = var[i];
-    }
-  }
+    InitAxisCache();
   
   // calculate global bin index
   Long64_t bin = 0;
@@ -360,6 +384,179 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+namespace {
+  template <typename T>
+  void AliTHnBulkAxisBins(TAxis* axis, Int_t nBins, Int_t nEntries, const T* column, Long64_t* bins)
+  {
+    // multiplies the global bin indices <bins> with the number of bins of <axis> and adds the bin of <column> on this axis
+    // entries in under/overflow bins are flagged with -1
+    //
+    // for uniformly binned axes the bin is computed inline with the same expression as TAxis::FindBin, 
+    // otherwise FindBin is only called when the value changes from one entry to the next
+    
+    if (axis->GetXbins()->GetSize() == 0)
+    {
+      const Double_t xMin = axis->GetXmin();
+      const Double_t xMax = axis->GetXmax();
+      const Double_t range = xMax - xMin;
+      
+      for (Int_t i=0; i<nEntries; i++)
+      {
+	const Double_t x = column[i];
+	Int_t bin = 0;
+	if (x < xMin)
+	  bin = 0;
+	else if (!(x < xMax))
+	  bin = nBins + 1;
+	else
+	  bin = 1 + Int_t(nBins * (x - xMin) / range);
+	
+	// under/overflow not supported
+	if (bins[i] < 0 || bin < 1 || bin > nBins)
+	  bins[i] = -1;
+	else
+	  bins[i] = bins[i] * nBins + bin - 1;
+      }
+    }
+    else
+    {
+      Double_t lastX = 0;
+      Int_t lastBin = -1;
+      for (Int_t i=0; i<nEntries; i++)
+      {
+	const Double_t x = column[i];
+	if (lastBin < 0 || x != lastX)
+	{
+	  lastBin = axis->FindBin(x);
+	  lastX = x;
+	}
+	
+	if (bins[i] < 0 || lastBin < 1 || lastBin > nBins)
+	  bins[i] = -1;
+	else
+	  bins[i] = bins[i] * nBins + lastBin - 1;
+      }
+    }
+  }
+}
+
+//____________________________________________________________________
+void AliTHnBase::FillContainerN(AliCFContainer* cont, Int_t nEntries, const Double_t* const* columns, Int_t istep, const Double_t* weights)
+{
+  // fills <nEntries> entries given in columnar form into <cont>
+  // uses AliTHnBase::FillN if <cont> is an AliTHn, otherwise the entries are filled one by one
+
+  AliTHnBase* thn = dynamic_cast<AliTHnBase*> (cont);
+  if (thn)
+  {
+    thn->FillN(nEntries, columns, istep, weights);
+    return;
+  }
+  
+  const Int_t nVars = cont->GetNVar();
+  Double_t* var = new Double_t[nVars];
+  for (Int_t i=0; i<nEntries; i++)
+  {
+    for (Int_t j=0; j<nVars; j++)
+      var[j] = columns[j][i];
+    cont->Fill(var, istep, (weights) ? weights[i] : 1.);
+  }
+  delete[] var;
+}
+
+//____________________________________________________________________
+template <class TemplateArray, typename TemplateType>
+Long64_t* AliTHnT<TemplateArray, TemplateType>::GetBulkBins(Int_t nEntries)
+{
+  // returns a buffer for the global bin indices of <nEntries> entries initialized to 0 (the buffer is reused between calls)
+  
+  if (nEntries > fBulkSize)
+  {
+    delete[] fBulkBins;
+    fBulkSize = TMath::Max(nEntries, 2 * fBulkSize);
+    fBulkBins = new Long64_t[fBulkSize];
+  }
+  
+  memset(fBulkBins, 0, nEntries * sizeof(Long64_t));
+  
+  return fBulkBins;
+}
+
+//____________________________________________________________________
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillBulkBins(Int_t nEntries, const Long64_t* bins, Int_t istep, const Double_t* weights)
+{
+  // adds the weights of the entries to the global bins <bins> (-1 = not filled)
+  // the entries are processed in order, the result is identical to calling Fill for each entry
+  
+  for (Int_t i=0; i<nEntries; i++)
+  {
+    if (bins[i] < 0)
+      continue;
+    
+    const Double_t weight = (weights) ? weights[i] : 1.;
+    
+    if (!fValues[istep])
+    {
+      fValues[istep] = new TemplateArray(fNBins);
+      AliInfo(Form("Created values container for step %d", istep));
+    }
+
+    if (weight != 1 && !fSumw2[istep])
+    {
+      // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+      fSumw2[istep] = new TemplateArray(*fValues[istep]);
+      AliInfo(Form("Created sumw2 container for step %d", istep));
+    }
+
+    fValues[istep]->GetArray()[bins[i]] += weight;
+    if (fSumw2[istep])
+      fSumw2[istep]->GetArray()[bins[i]] += weight * weight;
+  }
+}
+
+//____________________________________________________________________
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t nEntries, const Double_t* const* columns, Int_t istep, const Double_t* weights)
+{
+  // fills <nEntries> entries at once
+  // columns[i][j] is the value of variable i of entry j, weights can be 0 (all weights 1)
+  //
+  // the bin indices are computed axis by axis for all entries before the values are added, 
+  // this is considerably faster than calling Fill for each entry
+
+  if (nEntries <= 0)
+    return;
+  
+  if (!axisCache)
+    InitAxisCache();
+  
+  Long64_t* bins = GetBulkBins(nEntries);
+  for (Int_t i=0; i<fNVars; i++)
+    AliTHnBulkAxisBins(axisCache[i], fNbinsCache[i], nEntries, columns[i], bins);
+  
+  FillBulkBins(nEntries, bins, istep, weights);
+}
+
+//____________________________________________________________________
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t nEntries, const Float_t* const* columns, Int_t istep, const Double_t* weights)
+{
+  // same as above for variables stored in single precision
+  
+  if (nEntries <= 0)
+    return;
+  
+  if (!axisCache)
+    InitAxisCache();
+  
+  Long64_t* bins = GetBulkBins(nEntries);
+  for (Int_t i=0; i<fNVars; i++)
+    AliTHnBulkAxisBins(axisCache[i], fNbinsCache[i], nEntries, columns[i], bins);
+  
+  FillBulkBins(nEntries, bins, istep, weights);
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
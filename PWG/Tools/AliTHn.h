@@ -26,6 +26,8 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void FillN(Int_t nEntries, const Double_t* const* columns, Int_t istep, const Double_t* weights = 0) = 0;
+  virtual void FillN(Int_t nEntries, const Float_t* const* columns, Int_t istep, const Double_t* weights = 0) = 0;
   virtual void FillParent() = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
@@ -35,6 +37,8 @@ public:
   virtual void DeleteContainers() = 0;
   virtual void ReduceAxis() = 0;  
   
+  static void FillContainerN(AliCFContainer* cont, Int_t nEntries, const Double_t* const* columns, Int_t istep, const Double_t* weights = 0);
+  
   ClassDef(AliTHnBase, 1) // AliTHn base class
 };
 
@@ -48,6 +52,8 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillN(Int_t nEntries, const Double_t* const* columns, Int_t istep, const Double_t* weights = 0);
+  virtual void FillN(Int_t nEntries, const Float_t* const* columns, Int_t istep, const Double_t* weights = 0);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -65,6 +71,9 @@ class AliTHnT : public AliTHnBase
   
 protected:
   void Init();
+  void InitAxisCache();
+  Long64_t* GetBulkBins(Int_t nEntries);
+  void FillBulkBins(Int_t nEntries, const Long64_t* bins, Int_t istep, const Double_t* weights);
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
   
   Long64_t fNBins;   // number of total bins
@@ -77,6 +86,8 @@ protected:
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Long64_t* fBulkBins; //! global bin indices of the entries passed to FillN
+  Int_t fBulkSize; //! allocated size of fBulkBins
   
   ClassDef(AliTHnT, 5) // THn like container
 };
@@ -27,6 +27,7 @@ namespace Tools {
 AliYAMLConfiguration::AliYAMLConfiguration(const std::string prefixString, const std::string delimiterCharacter):
   TObject(),
   fConfigurations(),
+  fResolvedProperties(),
   fConfigurationsStrings(),
   fInitialized(false),
   fPrefixString(prefixString),
@@ -103,6 +104,7 @@ int AliYAMLConfiguration::AddConfiguration(const YAML::Node node, std::string co
   // Add the configuration
   AliDebugStream(2) << "Adding configuration \"" << configurationName << "\".\n";
   fConfigurations.push_back(std::make_pair(configurationName, node));
+  fResolvedProperties.clear();
 
   // Return the location of the new configuration
   return fConfigurations.size() - 1;
@@ -121,6 +123,7 @@ bool AliYAMLConfiguration::RemoveConfiguration(const unsigned int i)
   if (i < fConfigurations.size())
   {
     fConfigurations.erase(fConfigurations.begin() + i);
+    fResolvedProperties.clear();
     returnValue = true;
   }
 
@@ -349,6 +352,7 @@ bool AliYAMLConfiguration::Initialize()
     fConfigurationsStrings.push_back(std::make_pair(configPair.first, tempSS.str()));
   }
 
+  fResolvedProperties.clear();
   fInitialized = true;
 
   return fInitialized;
@@ -381,6 +385,7 @@ bool AliYAMLConfiguration::Reinitialize()
       YAML::Node node = YAML::Load(configStrPair.second);
       fConfigurations.push_back(std::make_pair(configStrPair.first, node));
     }
+    fResolvedProperties.clear();
 
     returnValue = true;
   }
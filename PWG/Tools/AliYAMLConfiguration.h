@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#include <unordered_map>
+#include <utility>
 
 #include <TObject.h>
 #include <TString.h>
@@ -74,6 +76,12 @@
  * fYAMLConfig.Reinitialize();
  * ~~~
  *
+ * After initialization, the node holding a property is looked up only the first time the property
+ * is requested. Further requests of the same name read the value directly from that node, so components
+ * which ask for the same properties (or the same subjob reading them again) do not walk the
+ * configurations each time. Adding, removing or writing through this class resets these lookups, while
+ * nodes modified directly through GetConfiguration(...) are not tracked.
+ *
  * To access or write a value, use the GetProperty(...) or WriteProperty(...) functions. To use
  * them, you must define an object of the desired type that you would like to read or write, and
  * then describe the path to the property. The path consists of the names of YAML nodes, separated
@@ -311,12 +319,13 @@ class AliYAMLConfiguration : public TObject {
   template<typename T>
   bool GetPropertyFromNode(const YAML::Node & node, std::string propertyName, T & property) const;
   template<typename T>
-  bool GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property) const;
+  bool GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property, YAML::Node * resolvedNode = nullptr) const;
 
   template<typename T>
   void WriteValue(YAML::Node & node, std::string propertyName, T & proeprty);
 
   std::vector<std::pair<std::string, YAML::Node> > fConfigurations;         //!<! Contains all YAML configurations. The first element has the highest precedence.
+  mutable std::unordered_map<std::string, std::pair<bool, YAML::Node> > fResolvedProperties; //!<! Properties resolved since the initialization, keyed by full name. False if not found.
   #endif
   std::vector<std::pair<std::string, std::string> > fConfigurationsStrings; ///<  Contains all YAML configurations as strings so that they can be streamed.
 
@@ -325,7 +334,7 @@ class AliYAMLConfiguration : public TObject {
   std::string fDelimiter;                     ///< Delimiter character to separate each level of the request.
 
   /// \cond CLASSIMP
-  ClassDef(AliYAMLConfiguration, 1); // YAML Configuration
+  ClassDef(AliYAMLConfiguration, 2); // YAML Configuration
   /// \endcond
 };
 
@@ -489,22 +498,50 @@ bool AliYAMLConfiguration::GetProperty(std::string propertyName, T & property, c
   }
 
   bool setProperty = false;
-  // Search in reverse so it is possible to override configuration values.
-  for (auto configPair : reverse(fConfigurations))
+  // Once the configurations are initialized, the node holding a property is only searched for once.
+  // Shared parameters are only considered for simple types, so they are part of the key.
+  bool resolved = false;
+  std::string cacheKey;
+  if (fInitialized == true)
   {
-    if (setProperty == true) {
-      AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Property \"" << propertyName << "\" found!\n";
-      break;
+    const bool simpleType = std::is_arithmetic<T>::value || std::is_same<T, std::string>::value || std::is_same<T, bool>::value;
+    cacheKey = (simpleType ? "simple" : "complex") + fDelimiter + propertyName;
+    auto cachedProperty = fResolvedProperties.find(cacheKey);
+    if (cachedProperty != fResolvedProperties.end())
+    {
+      resolved = true;
+      if (cachedProperty->second.first == true) {
+        property = cachedProperty->second.second.template as<T>();
+        setProperty = true;
+        AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Property \"" << propertyName << "\" found in the resolved properties!\n";
+      }
     }
+  }
 
-    // IsNull checks is a node is empty. A node is empty if it is created.
-    // IsDefined checks if the node that was requested was not actually created.
-    if (configPair.second.IsNull() != true)
+  if (resolved == false)
+  {
+    YAML::Node resolvedNode;
+    // Search in reverse so it is possible to override configuration values.
+    for (auto configPair : reverse(fConfigurations))
     {
-      AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Looking for parameter \"" << propertyName << "\" in \"" << configPair.first << "\" configuration\n";
-      // NOTE: This may not exist, but that is entirely fine.
-      YAML::Node sharedParameters = configPair.second["sharedParameters"];
-      setProperty = GetProperty(configPair.second, sharedParameters, configPair.first, propertyName, property);
+      if (setProperty == true) {
+        AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Property \"" << propertyName << "\" found!\n";
+        break;
+      }
+
+      // IsNull checks is a node is empty. A node is empty if it is created.
+      // IsDefined checks if the node that was requested was not actually created.
+      if (configPair.second.IsNull() != true)
+      {
+        AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Looking for parameter \"" << propertyName << "\" in \"" << configPair.first << "\" configuration\n";
+        // NOTE: This may not exist, but that is entirely fine.
+        YAML::Node sharedParameters = configPair.second["sharedParameters"];
+        setProperty = GetProperty(configPair.second, sharedParameters, configPair.first, propertyName, property, &resolvedNode);
+      }
+    }
+
+    if (fInitialized == true) {
+      fResolvedProperties.insert(std::make_pair(cacheKey, std::make_pair(setProperty, resolvedNode)));
     }
   }
 
@@ -539,11 +576,12 @@ bool AliYAMLConfiguration::GetProperty(std::string propertyName, T & property, c
  * @param[in] configurationName Name of the configuration type.
  * @param[in] propertyName Name of the property to retrieve
  * @param[out] property Contains the retrieved property
+ * @param[out] resolvedNode If not null, set to the node from which the property was retrieved
  *
  * @return True if the property was set successfully
  */
 template<typename T>
-bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property) const
+bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedParametersNode, const std::string & configurationName, std::string propertyName, T & property, YAML::Node * resolvedNode) const
 {
   // Used as a buffer for printing complicated messages
   std::stringstream tempMessage;
@@ -565,7 +603,7 @@ bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedPar
       // Retrieve node and then recurse
       YAML::Node tempNode = node[nodeName];
       AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Attempting to retrieving property \"" << tempPropertyName << "\" by going a node deeper with node \"" << nodeName << "\".\n";
-      returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property);
+      returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property, resolvedNode);
     }
 
     // Check for the specialization if the nodeName is undefined.
@@ -579,7 +617,7 @@ bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedPar
         std::string specializationNodeName = nodeName.substr(0, delimiterPosition);
         YAML::Node tempNode = node[specializationNodeName];
         AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Attempting to retrieving property \"" << tempPropertyName << "\" by going a node deeper through dropping the specializtion and using node \"" << specializationNodeName << "\".\n";
-        returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property);
+        returnValue = GetProperty(tempNode, sharedParametersNode, configurationName, tempPropertyName, property, resolvedNode);
       }
       else {
         returnValue = false;
@@ -630,6 +668,10 @@ bool AliYAMLConfiguration::GetProperty(YAML::Node & node, YAML::Node & sharedPar
         AliYAMLConfiguration::PrintRetrievedPropertyValue(tempMessage, property);
         AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Succeeded in retrieveing " << tempMessage.str() << "\n";
         returnValue = true;
+        // reset() rebinds the handle without touching the configuration
+        if (resolvedNode) {
+          resolvedNode->reset(isShared ? sharedParametersNode[sharedValueName] : node[propertyName]);
+        }
       }
       else {
         returnValue = false;
@@ -666,6 +708,8 @@ bool AliYAMLConfiguration::WriteProperty(std::string propertyName, T & property,
 
   std::pair<std::string, YAML::Node> & configPair = fConfigurations.at(configurationIndex);
 
+  // The written value may override a property which was already resolved elsewhere
+  fResolvedProperties.clear();
   WriteValue(configPair.second, propertyName, property);
   AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Final Node:\n" << configPair.second << "\n";
 
@@ -354,7 +354,7 @@ THnSparse* THistManager::CreateTHnSparse(const char *name, const char *title, in
   return hsparse;
 }
 
-void THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, double xmin, double xmax, Option_t *opt) {
+TProfile* THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, double xmin, double xmax, Option_t *opt) {
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent) parent = CreateHistoGroup(dirname);
@@ -362,9 +362,10 @@ void THistManager::CreateTProfile(const char* name, const char* title, int nbins
 		Fatal("THistManager::CreateTProfile", "Object %s already exists in group %s", hname.Data(), dirname.Data());
   TProfile *hist = new TProfile(hname, title, nbinsX, xmin, xmax, opt);
   parent->Add(hist);
+  return hist;
 }
 
-void THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, const double* xbins, Option_t *opt) {
+TProfile* THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, const double* xbins, Option_t *opt) {
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent) parent = CreateHistoGroup(dirname);
@@ -372,9 +373,10 @@ void THistManager::CreateTProfile(const char* name, const char* title, int nbins
 		Fatal("THistManager::CreateTHnSparse", "Object %s already exists in group %s", hname.Data(), dirname.Data());
   TProfile *hist = new TProfile(hname, title, nbinsX, xbins, opt);
   parent->Add(hist);
+  return hist;
 }
 
-void THistManager::CreateTProfile(const char* name, const char* title, const TArrayD& xbins, Option_t *opt){
+TProfile* THistManager::CreateTProfile(const char* name, const char* title, const TArrayD& xbins, Option_t *opt){
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent) parent = CreateHistoGroup(dirname);
@@ -382,16 +384,17 @@ void THistManager::CreateTProfile(const char* name, const char* title, const TAr
 		Fatal("THistManager::CreateTHnSparse", "Object %s already exists in group %s", hname.Data(), dirname.Data());
   TProfile *hist = new TProfile(hname.Data(), title, xbins.GetSize()-1, xbins.GetArray(), opt);
   parent->Add(hist);
+  return hist;
 }
 
-void THistManager::CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt){
+TProfile* THistManager::CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt){
   TArrayD myxbins;
   try{
     xbins.CreateBinEdges(myxbins);
   } catch (std::exception &e){
     Fatal("THistManager::CreateProfile", "Exception raised: %s", e.what());
   }
-  CreateTProfile(name, title, myxbins, opt);
+  return CreateTProfile(name, title, myxbins, opt);
 }
 
 void THistManager::SetObject(TObject * const o, const char *group) {
@@ -408,18 +411,59 @@ void THistManager::SetObject(TObject * const o, const char *group) {
 	fHistos->Add(o);
 }
 
-void THistManager::FillTH1(const char *name, double x, double weight, Option_t *opt) {
+template<typename HistType>
+HistType *THistManager::FindHistogram(const char *method, const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
-		Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
-		return;
+		Fatal(method, "Parent group %s does not exist", dirname.Data());
+		return nullptr;
 	}
-	TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
+	HistType *hist = dynamic_cast<HistType *>(parent->FindObject(hname));
 	if(!hist){
-		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
+		Fatal(method, "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return nullptr;
 	}
+	return hist;
+}
+
+void THistManager::FillTH1(const char *name, double x, double weight, Option_t *opt) {
+	FillTH1(FindHistogram<TH1>("THistManager::FillTH1", name), x, weight, opt);
+}
+
+void THistManager::FillTH1(const char *name, const char *label, double weight, Option_t *opt) {
+	FillTH1(FindHistogram<TH1>("THistManager::FillTH1", name), label, weight, opt);
+}
+
+void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
+	FillTH2(FindHistogram<TH2>("THistManager::FillTH2", name), x, y, weight, opt);
+}
+
+void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
+	FillTH2(FindHistogram<TH2>("THistManager::FillTH2", name), point, weight, opt);
+}
+
+void THistManager::FillTH2(const char *name, const char *labelX, const char *labelY, double weight, Option_t *opt) {
+	FillTH2(FindHistogram<TH2>("THistManager::FillTH2", name), labelX, labelY, weight, opt);
+}
+
+void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
+	FillTH3(FindHistogram<TH3>("THistManager::FillTH3", name), x, y, z, weight, opt);
+}
+
+void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
+	FillTH3(FindHistogram<TH3>("THistManager::FillTH3", name), point, weight, opt);
+}
+
+void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
+	FillTHnSparse(FindHistogram<THnSparseD>("THistManager::FillTHnSparse", name), x, weight, opt);
+}
+
+void THistManager::FillProfile(const char* name, double x, double y, double weight){
+	FillProfile(FindHistogram<TProfile>("THistManager::FillTProfile", name), x, y, weight);
+}
+
+void THistManager::FillTH1(TH1 *hist, double x, double weight, Option_t *opt) {
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
 	  // use bin width as weight
@@ -431,18 +475,7 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 	hist->Fill(x, weight);
 }
 
-void THistManager::FillTH1(const char *name, const char *label, double weight, Option_t *opt) {
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent){
-    Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
-    return;
-  }
-  TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
-  if(!hist){
-    Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-    return;
-  }
+void THistManager::FillTH1(TH1 *hist, const char *label, double weight, Option_t *opt) {
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
 	  // use bin width as weight
@@ -455,18 +488,7 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
   hist->Fill(label, weight);
 }
 
-void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+void THistManager::FillTH2(TH2 *hist, double x, double y, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -480,18 +502,7 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 	hist->Fill(x, y, myweight);
 }
 
-void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+void THistManager::FillTH2(TH2 *hist, double *point, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -505,18 +516,7 @@ void THistManager::FillTH2(const char *name, double *point, double weight, Optio
 	hist->Fill(point[0], point[1], weight);
 }
 
-void THistManager::FillTH2(const char *name, const char *labelX, const char *labelY, double weight, Option_t *opt) {
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent){
-    Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-    return;
-  }
-  TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-  if(!hist){
-    Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-    return;
-  }
+void THistManager::FillTH2(TH2 *hist, const char *labelX, const char *labelY, double weight, Option_t *opt) {
   TString optstring(opt);
   Double_t myweight = optstring.Contains("w") ? 1. : weight;
   if(optstring.Contains("wx")){
@@ -530,18 +530,7 @@ void THistManager::FillTH2(const char *name, const char *labelX, const char *lab
   hist->Fill(labelX, labelY, weight);
 }
 
-void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+void THistManager::FillTH3(TH3 *hist, double x, double y, double z, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -559,18 +548,7 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 	hist->Fill(x, y, z, weight);
 }
 
-void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+void THistManager::FillTH3(TH3 *hist, const double* point, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -588,18 +566,7 @@ void THistManager::FillTH3(const char* name, const double* point, double weight,
 	hist->Fill(point[0], point[1], point[2], weight);
 }
 
-void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTHnSparse", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	THnSparseD *hist = dynamic_cast<THnSparseD *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+void THistManager::FillTHnSparse(THnSparse *hist, const double *x, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
@@ -614,14 +581,7 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 	hist->Fill(x, weight);
 }
 
-void THistManager::FillProfile(const char* name, double x, double y, double weight){
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent)
-		Fatal("THistManager::FillTProfile", "Parent group %s does not exist", dirname.Data());
-  TProfile *hist = dynamic_cast<TProfile *>(parent->FindObject(hname));
-  if(!hist)
-		Fatal("THistManager::FillTProfile", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+void THistManager::FillProfile(TProfile *hist, double x, double y, double weight){
   hist->Fill(x, y, weight);
 }
 
@@ -1030,6 +990,53 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    TH1 *test1 = testmgr.CreateTH1("Group1/Test1", "Test fill 1D histogram", 1, 0., 1.);
+    TH2 *test2 = testmgr.CreateTH2("Group1/Test2", "Test fill 2D histogram", 1, 0., 1., 1, 0., 1.);
+    TH3 *test3 = testmgr.CreateTH3("Group1/Test3", "Test fill 3D histogram", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    THnSparse *testN = testmgr.CreateTHnSparse("Group1/TestN", "Test Fill THnSparse", 4, nbins, min, max);
+    TProfile *testProfile = testmgr.CreateTProfile("Group1/Subgroup1/TestProfile", "Test fill Profile histogram", 1, 0., 1.);
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(test1, 0.5);
+      testmgr.FillTH2(test2, 0.5, 0.5);
+      testmgr.FillTH3(test3, 0.5, 0.5, 0.5);
+      testmgr.FillProfile(testProfile, 0.5, 1.);
+      testmgr.FillTHnSparse(testN, point);
+    }
+
+    // Evalutate test
+    // tell user why test has failed
+    bool success(true);
+
+    if(testmgr.FindObject("Group1/Test1") != test1 || TMath::Abs(test1->GetBinContent(1) - 100) > DBL_EPSILON){
+      std::cout << "Test1: Handle not matching or mismatch in values, expected 100, found " <<  test1->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    if(testmgr.FindObject("Group1/Test2") != test2 || TMath::Abs(test2->GetBinContent(1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Test2: Handle not matching or mismatch in values, expected 100, found " <<  test2->GetBinContent(1, 1) << std::endl;
+      success = false;
+    }
+    if(testmgr.FindObject("Group1/Test3") != test3 || TMath::Abs(test3->GetBinContent(1, 1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Test3: Handle not matching or mismatch in values, expected 100, found " <<  test3->GetBinContent(1, 1, 1) << std::endl;
+      success = false;
+    }
+    int index[4] = {1,1,1,1};
+    if(testmgr.FindObject("Group1/TestN") != testN || TMath::Abs(testN->GetBinContent(index) - 100) > DBL_EPSILON){
+      std::cout << "TestN: Handle not matching or mismatch in values, expected 100, found " <<  testN->GetBinContent(index) << std::endl;
+      success = false;
+    }
+    if(testmgr.FindObject("Group1/Subgroup1/TestProfile") != testProfile || TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "TestProfile: Handle not matching or mismatch in values, expected 1, found " <<  testProfile->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1057,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1083,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
 }
@@ -481,7 +481,7 @@ public:
 	 * @param[in] xmax max. value in x-direction
 	 * @param[in] opt Further options
 	 */
-  void CreateTProfile(const char *name, const char *title, int nbinsX, double xmin, double xmax, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, int nbinsX, double xmin, double xmax, Option_t *opt = "");
 
   /**
    * @brief Create a new TProfile within the container.
@@ -494,7 +494,7 @@ public:
    * @param[in] xbins binning in x-direction
    * @param[in] opt Further options
    */
-  void CreateTProfile(const char *name, const char *title, int nbinsX, const double *xbins, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, int nbinsX, const double *xbins, Option_t *opt = "");
 
   /**
    * @brief Create a new TProfile within the container.
@@ -506,7 +506,7 @@ public:
    * @param[in] xbins binning in x-direction
    * @param[in] opt Further options
    */
-  void CreateTProfile(const char *name, const char *title, const TArrayD &xbins, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, const TArrayD &xbins, Option_t *opt = "");
 
   /**
    * @brief Create a new TProfile within the container.
@@ -518,7 +518,7 @@ public:
    * @param[in] xbins User binning
    * @param[in] opt Further options
    */
-  void CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt = "");
 
   /**
    * @brief Set a new group into the container into the parent group
@@ -634,6 +634,101 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Fill a 1D histogram using the handle returned by CreateTH1.
+   *
+   * Same as the name-based fill, but without the lookup of the
+   * group and the histogram. Preferred in loops over tracks or
+   * clusters, where the name-based lookup shows up in the profile:
+   *
+   * ~~~{.cxx}
+   * TH1 *hPt = mgr.CreateTH1("tracks/hPt", "pt-distribution", TLinearBinning(100, 0., 100.));
+   * ...
+   * mgr.FillTH1(hPt, pt);
+   * ~~~
+   * @param[in] hist Histogram handle
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(TH1 *hist, double x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 1D histogram using its handle, with a bin label.
+   * @param[in] hist Histogram handle
+   * @param[in] label Label of the bin to fill
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(TH1 *hist, const char *label, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram using the handle returned by CreateTH2.
+   * @param[in] hist Histogram handle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2 *hist, double x, double y, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram using its handle, with bin labels.
+   * @param[in] hist Histogram handle
+   * @param[in] labelX x-coordinate
+   * @param[in] labelY y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2 *hist, const char *labelX, const char *labelY, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram using its handle.
+   * @param[in] hist Histogram handle
+   * @param[in] point coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2 *hist, double *point, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram using the handle returned by CreateTH3.
+   * @param[in] hist Histogram handle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(TH3 *hist, double x, double y, double z, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram using its handle.
+   * @param[in] hist Histogram handle
+   * @param[in] point 3D-coordinate (x,y,z) of the point to be filled
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(TH3 *hist, const double *point, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a nD histogram using the handle returned by CreateTHnSparse.
+   * @param[in] hist Histogram handle
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTHnSparse(THnSparse *hist, const double *x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a profile histogram using the handle returned by CreateTProfile.
+   * @param[in] hist Profile handle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(TProfile *hist, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -719,6 +814,17 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Find a histogram of a given type for the name-based fill methods.
+	 *
+	 * Fatal in case the group or the histogram does not exist.
+	 * @param[in] method Name of the calling method, for the error message
+	 * @param[in] name Name of the histogram, including the parent group(s)
+	 * @return the histogram
+	 */
+	template<typename HistType>
+	HistType *FindHistogram(const char *method, const char *name) const;
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
 
@@ -762,6 +868,7 @@ namespace TestTHistManager {
  * - Build histrogram in groups
  * - Simple fill
  * - Fill histograms in groups
+ * - Fill histograms via their handle
  */
 class THistManagerTestSuite {
 public:
@@ -845,6 +952,20 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether filling via the handles returned by the Create methods
+   * is equivalent to filling via the name
+   * Relies on: TestFillSimpleHistograms
+   *
+   * Creating histograms of all types in a group, filling each 100 times via the handle
+   *
+   * Test passed:
+   * - All handles point to the histograms found by name
+   * - All histograms have in its 1 bin the bin content 100 (1 for the profile)
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
 };
 
 /**
@@ -882,5 +1003,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via their handle. See
+ * @ref THistManagerTestSuite for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
 }
 #endif
@@ -0,0 +1,61 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <TCollection.h>
+#include <TH1.h>
+#include <TH2.h>
+#include <TH3.h>
+#include <THnSparse.h>
+#include <TProfile.h>
+
+#include "THistRegistry.h"
+
+THistRegistry::THistRegistry(const TCollection *list):
+  fList(list),
+  fByName(),
+  fByAddress()
+{
+}
+
+void THistRegistry::SetList(const TCollection *list){
+  fList = list;
+  Clear();
+}
+
+void THistRegistry::Clear(){
+  fByAddress.clear();
+  fByName.clear();
+}
+
+const THistRegistry::Entry *THistRegistry::Resolve(const char *name){
+  if(!name) return nullptr;
+  std::unordered_map<std::string, Entry>::iterator found = fByName.find(name);
+  if(found == fByName.end()){
+    if(!fList) return nullptr;
+    TObject *obj = fList->FindObject(name);
+    if(!obj) return nullptr;       // not cached, might be added later
+    Entry entry;
+    entry.fName = name;
+    entry.fObject = obj;
+    entry.fTH1 = dynamic_cast<TH1 *>(obj);
+    entry.fTH2 = dynamic_cast<TH2 *>(obj);
+    entry.fTH3 = dynamic_cast<TH3 *>(obj);
+    entry.fTHnSparse = dynamic_cast<THnSparse *>(obj);
+    entry.fTProfile = dynamic_cast<TProfile *>(obj);
+    found = fByName.insert(std::make_pair(entry.fName, entry)).first;
+  }
+  // elements of an unordered_map keep their address on rehashing
+  fByAddress[name] = &(found->second);
+  return &(found->second);
+}
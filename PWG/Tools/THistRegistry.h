@@ -0,0 +1,169 @@
+#ifndef THISTREGISTRY_H
+#define THISTREGISTRY_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <string>
+#include <unordered_map>
+#include <Rtypes.h>
+
+class TCollection;
+class TObject;
+class TH1;
+class TH2;
+class TH3;
+class THnSparse;
+class TProfile;
+
+/**
+ * @class THistRegistry
+ * @brief Name to histogram cache on top of an output list
+ * @ingroup Histmanager
+ *
+ * Many tasks fill their histograms through helpers of the kind
+ *
+ * ~~~{.cxx}
+ * void FillHistogramTH1(TList *list, const char *name, double x, double w) const {
+ *   TH1 *hist = dynamic_cast<TH1*>(list->FindObject(name));
+ *   ...
+ * }
+ * ~~~
+ *
+ * paying for the lookup in the list and the dynamic cast on every fill.
+ * The registry resolves a name in the list the first time it is asked
+ * for and keeps the typed pointers, so the following fills only compare
+ * the name with the cached one. Names are usually string literals, which
+ * keep their address: the first level of the cache is keyed by the address
+ * of the name (the string is still compared, so reused buffers as from Form
+ * are safe), the second level by the name itself.
+ *
+ * Migrating such a helper:
+ *
+ * ~~~{.cxx}
+ * void FillHistogramTH1(TList *list, const char *name, double x, double w) const {
+ *   TH1 *hist = list == fHistRegistry.GetList() ? fHistRegistry.FindTH1(name) : dynamic_cast<TH1*>(list->FindObject(name));
+ *   ...
+ * }
+ * ~~~
+ *
+ * with fHistRegistry a mutable transient member bound to the output list
+ * (SetList) once the histograms are created. Objects which are not found
+ * are not cached, so histograms added later are found as well. The cache
+ * has to be reset (Clear or SetList) if objects are removed from the list.
+ */
+class THistRegistry {
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] list List the names are resolved in
+   */
+  THistRegistry(const TCollection *list = nullptr);
+
+  /**
+   * @brief Destructor, the list and its objects are not owned
+   */
+  ~THistRegistry() {}
+
+  /**
+   * @brief Bind the registry to a list, resetting the cache
+   * @param[in] list List the names are resolved in
+   */
+  void SetList(const TCollection *list);
+
+  /**
+   * @brief Get the list the registry is bound to
+   * @return the list
+   */
+  const TCollection *GetList() const { return fList; }
+
+  /**
+   * @brief Reset the cache
+   */
+  void Clear();
+
+  /**
+   * @brief Find an object of the list
+   * @param[in] name Name of the object
+   * @return the object (nullptr if not found)
+   */
+  TObject *Find(const char *name) { const Entry *entry = GetEntry(name); return entry ? entry->fObject : nullptr; }
+
+  /**
+   * @brief Find a 1D histogram (or any TH1) of the list
+   * @param[in] name Name of the histogram
+   * @return the histogram (nullptr if not found or of a different type)
+   */
+  TH1 *FindTH1(const char *name) { const Entry *entry = GetEntry(name); return entry ? entry->fTH1 : nullptr; }
+
+  /**
+   * @brief Find a 2D histogram of the list
+   * @param[in] name Name of the histogram
+   * @return the histogram (nullptr if not found or of a different type)
+   */
+  TH2 *FindTH2(const char *name) { const Entry *entry = GetEntry(name); return entry ? entry->fTH2 : nullptr; }
+
+  /**
+   * @brief Find a 3D histogram of the list
+   * @param[in] name Name of the histogram
+   * @return the histogram (nullptr if not found or of a different type)
+   */
+  TH3 *FindTH3(const char *name) { const Entry *entry = GetEntry(name); return entry ? entry->fTH3 : nullptr; }
+
+  /**
+   * @brief Find a THnSparse of the list
+   * @param[in] name Name of the histogram
+   * @return the histogram (nullptr if not found or of a different type)
+   */
+  THnSparse *FindTHnSparse(const char *name) { const Entry *entry = GetEntry(name); return entry ? entry->fTHnSparse : nullptr; }
+
+  /**
+   * @brief Find a profile histogram of the list
+   * @param[in] name Name of the histogram
+   * @return the histogram (nullptr if not found or of a different type)
+   */
+  TProfile *FindTProfile(const char *name) { const Entry *entry = GetEntry(name); return entry ? entry->fTProfile : nullptr; }
+
+private:
+
+  /**
+   * @struct Entry
+   * @brief Object found in the list, with its typed pointers
+   */
+  struct Entry {
+    std::string fName;          ///< Name of the object
+    TObject    *fObject;        ///< Object in the list
+    TH1        *fTH1;           ///< Object as TH1, nullptr if it is not a TH1
+    TH2        *fTH2;           ///< Object as TH2, nullptr if it is not a TH2
+    TH3        *fTH3;           ///< Object as TH3, nullptr if it is not a TH3
+    THnSparse  *fTHnSparse;     ///< Object as THnSparse, nullptr if it is not a THnSparse
+    TProfile   *fTProfile;      ///< Object as TProfile, nullptr if it is not a TProfile
+  };
+
+  THistRegistry(const THistRegistry &);
+  THistRegistry &operator=(const THistRegistry &);
+
+  /**
+   * @brief Get the cache entry of a name, resolving it in the list if needed
+   * @param[in] name Name of the object
+   * @return the entry (nullptr if the object is not in the list)
+   */
+  const Entry *GetEntry(const char *name) {
+    std::unordered_map<const char *, const Entry *>::const_iterator found = fByAddress.find(name);
+    if(found != fByAddress.end() && found->second->fName == name) return found->second;
+    return Resolve(name);
+  }
+
+  /**
+   * @brief Slow path of GetEntry: lookup by name, then in the list
+   * @param[in] name Name of the object
+   * @return the entry (nullptr if the object is not in the list)
+   */
+  const Entry *Resolve(const char *name);
+
+  const TCollection                                  *fList;        ///< List the names are resolved in, not owned
+  std::unordered_map<std::string, Entry>              fByName;      ///< Entries by name
+  std::unordered_map<const char *, const Entry *>     fByAddress;   ///< Entries by address of the name last used
+};
+
+#endif
@@ -49,7 +49,10 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fMinvHistoNames(),
+fMeanPtHistoNames(),
+fMeanPtSquareHistoNames()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -484,9 +487,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TIter nextBin(fBinsToFill);
   nextBin.Reset();
   AliAnalysisMuMuBinning::Range* r;
+  Int_t ibin(-1);
 
   // Loop over all bin ranges
   while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
+    ++ibin;
 
     // --- In this loop we first check if the pairs pass some tests and we fill histo accordingly. ---
 
@@ -501,12 +506,10 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     if ( ok )
     {
       // Get Minv histo name associated to the bin
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
+      Int_t iname            = GetMinvHistoNameIndex(ibin,kFALSE,PairCharge,IsMixedHisto);
+      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtHistoNames[iname].Data());
+      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtSquareHistoNames[iname].Data());
+      FillMinvHisto(&fMinvHistoNames[iname],hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() )
@@ -519,23 +522,19 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4Momentum.Pt(),pair4Momentum.Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
+        iname           = GetMinvHistoNameIndex(ibin,kTRUE,PairCharge,IsMixedHisto);
+        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtHistoNames[iname].Data());
+        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtSquareHistoNames[iname].Data());
+        if( okAccEff ) FillMinvHisto(&fMinvHistoNames[iname],hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
       }
     }
 
     if ( okMC ) {
 
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
+      Int_t iname            = GetMinvHistoNameIndex(ibin,kFALSE,PairCharge,IsMixedHisto);
+      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtHistoNames[iname].Data());
+      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtSquareHistoNames[iname].Data());
+      FillMinvHisto(&fMinvHistoNames[iname],hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() ){
@@ -548,12 +547,10 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4MomentumMC->Pt(),pair4MomentumMC->Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
+        iname           = GetMinvHistoNameIndex(ibin,kTRUE,PairCharge,IsMixedHisto);
+        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtHistoNames[iname].Data());
+        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,fMeanPtSquareHistoNames[iname].Data());
+        if( okAccEff ) FillMinvHisto(&fMinvHistoNames[iname],hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
 
       }
     }
@@ -720,6 +717,42 @@ TString AliAnalysisMuMuMinv::GetMinvHistoName(const AliAnalysisMuMuBinning::Rang
                          accEffCorrected ? "_AccEffCorr" : "",fMinvBinSeparator.Data(),r.AsString().Data(),suffix.Data());
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuMinv::GetMinvHistoNameIndex(Int_t ibin, Bool_t accEffCorrected, Double_t PairCharge, Bool_t mix)
+{
+  /// Index in fMinvHistoNames (and in the MeanPt profile names) of the histo name
+  /// GetMinvHistoName gives for the ibin-th range of fBinsToFill.
+  /// The names are built once for all ranges, instead of for each pair and range.
+
+  const Int_t nVariants = 2*3*2; // accEff corrected or not, charge 0, +2 and -2, mix or not
+
+  if ( fMinvHistoNames.size() != static_cast<size_t>(nVariants*fBinsToFill->GetEntriesFast()) )
+  {
+    fMinvHistoNames.clear();
+    fMeanPtHistoNames.clear();
+    fMeanPtSquareHistoNames.clear();
+
+    const Double_t charges[3] = {0.,2.,-2.};
+    for ( Int_t i = 0; i < fBinsToFill->GetEntriesFast(); ++i )
+    {
+      const AliAnalysisMuMuBinning::Range* r = static_cast<const AliAnalysisMuMuBinning::Range*>(fBinsToFill->UncheckedAt(i));
+      for ( Int_t iVariant = 0; iVariant < nVariants; ++iVariant )
+      {
+        TString minvName = GetMinvHistoName(*r,iVariant/6,charges[(iVariant/2)%3],iVariant%2);
+        fMinvHistoNames.push_back(minvName);
+        fMeanPtHistoNames.push_back(Form("MeanPtVs%s",minvName.Data()));
+        fMeanPtSquareHistoNames.push_back(Form("MeanPtSquareVs%s",minvName.Data()));
+      }
+    }
+  }
+
+  Int_t icharge(0);
+  if ( PairCharge == 2 ) icharge = 1;
+  else if ( PairCharge == -2 ) icharge = 2;
+
+  return ibin*nVariants + (accEffCorrected ? 6 : 0) + icharge*2 + (mix ? 1 : 0);
+}
+
 
 //_____________________________________________________________________________
 Double_t AliAnalysisMuMuMinv::GetAccxEff(Double_t pt,Double_t rapidity)
@@ -1110,6 +1143,7 @@ void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
+  fMinvHistoNames.clear();
 }
 
 //________________________________________________________________________
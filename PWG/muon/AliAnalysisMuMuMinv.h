@@ -14,6 +14,7 @@
 #include "TString.h"
 #include "TLorentzVector.h"
 #include "TH2.h"
+#include <vector>
 
 class TH2F;
 class AliVParticle;
@@ -43,7 +44,7 @@ public:
 
   void SetMuonWeight() { fWeightMuon=kTRUE; }
 
-  void SetLegacyBinNaming() { fMinvBinSeparator = ""; }
+  void SetLegacyBinNaming() { fMinvBinSeparator = ""; fMinvHistoNames.clear(); }
 
   void SetBinsToFill(const char* particle, const char* bins);
 
@@ -83,6 +84,8 @@ private:
 
   TString GetMinvHistoName(const AliAnalysisMuMuBinning::Range& r, Bool_t accEffCorrected, Double_t PairCharge=0, Bool_t mix =kFALSE) const;
 
+  Int_t GetMinvHistoNameIndex(Int_t ibin, Bool_t accEffCorrected, Double_t PairCharge, Bool_t mix);
+
   Double_t GetAccxEff(Double_t pt,Double_t rapidity);
 
   Double_t WeightMuonDistribution(Double_t pt);
@@ -111,8 +114,11 @@ private:
   Double_t fMinvMax;
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
+  std::vector<TString> fMinvHistoNames; //! Minv histo names per bin, acc x eff correction, pair charge and mixing
+  std::vector<TString> fMeanPtHistoNames; //! corresponding MeanPtVs profile names
+  std::vector<TString> fMeanPtSquareHistoNames; //! corresponding MeanPtSquareVs profile names
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
@@ -45,6 +45,7 @@
 #include <algorithm>
 #include <cassert>
 #include <set>
+#include <vector>
 ///
 /// \ class AliAnalysisTaskMuMu
 ///
@@ -389,6 +390,37 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   // The main part, loop over subanalysis and fill histo
   if ( !IsHistogrammingDisabled() && !fDisableHistoLoop ){
 
+    // The track and pair cut decisions only depend on the tracks of this event:
+    // evaluate them once here instead of once per sub-analysis (and, for the single
+    // track part of the pair cuts, once per pair)
+    std::vector<AliAnalysisMuMuCutCombination*> trackCuts;
+    std::vector<AliAnalysisMuMuCutCombination*> pairCuts;
+    AliAnalysisMuMuCutCombination* cut;
+    while ( ( cut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) ) trackCuts.push_back(cut);
+    while ( ( cut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) ) pairCuts.push_back(cut);
+    const Int_t nTrackCuts = trackCuts.size();
+    const Int_t nPairCuts = pairCuts.size();
+
+    std::vector<AliVParticle*> tracks(nTracks,0x0); // muon tracks only
+    std::vector<Bool_t> trackPass(nTracks*nTrackCuts,kFALSE);
+    std::vector<Bool_t> pairTrackPass(nTracks*nPairCuts,kFALSE);
+    std::vector<Bool_t> pairPass(nTracks*nTracks*nPairCuts,kFALSE);
+
+    for (Int_t i = 0; i < nTracks; ++i){
+      AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
+      if (!AliAnalysisMuonUtility::IsMuonTrack(tracki) ) continue;
+      tracks[i] = tracki;
+      for (Int_t icut = 0; icut < nTrackCuts; ++icut) trackPass[i*nTrackCuts+icut] = trackCuts[icut]->Pass(*tracki);
+      for (Int_t icut = 0; icut < nPairCuts; ++icut) pairTrackPass[i*nPairCuts+icut] = (pairCuts[icut]->IsTrackCutter()) ? pairCuts[icut]->Pass(*tracki) : kTRUE;
+    }
+    for (Int_t i = 0; i < nTracks; ++i){
+      if (!tracks[i]) continue;
+      for (Int_t j = i+1; j < nTracks; ++j){
+        if (!tracks[j]) continue;
+        for (Int_t icut = 0; icut < nPairCuts; ++icut) pairPass[(i*nTracks+j)*nPairCuts+icut] = pairCuts[icut]->Pass(*tracks[i],*tracks[j]);
+      }
+    }
+
     while ( ( analysis = static_cast<AliAnalysisMuMuBase*>(nextAnalysis()) ) )
     {
 
@@ -408,19 +440,16 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
       for (Int_t i = 0; i < nTracks; ++i){
 
         // Get track
-        AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
-       if (!AliAnalysisMuonUtility::IsMuonTrack(tracki) ) continue;
-
-        nextTrackCut.Reset();
-        AliAnalysisMuMuCutCombination* trackCut;
+        AliVParticle* tracki = tracks[i];
+        if (!tracki) continue;
 
         // Loop on all track selections and fill histos for track that pass it
-        while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) )
+        for (Int_t icut = 0; icut < nTrackCuts; ++icut)
         {
-          if ( trackCut->Pass(*tracki) )
+          if ( trackPass[i*nTrackCuts+icut] )
           {
             AliCodeTimerAuto(Form("%s (FillHistosForTrack)",analysis->ClassName()),2);
-            analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCut->GetName(),*tracki);
+            analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCuts[icut]->GetName(),*tracki);
           }
         }
 
@@ -428,26 +457,21 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
 
         for (Int_t j = i+1; j < nTracks; ++j){
           // Get track
-          AliVParticle    * trackj = 0x0;
-          trackj = AliAnalysisMuonUtility::GetTrack(j,Event());
-
-          if (!AliAnalysisMuonUtility::IsMuonTrack(trackj) ) continue;
-
-          nextPairCut.Reset();
-          AliAnalysisMuMuCutCombination* pairCut;
+          AliVParticle* trackj = tracks[j];
+          if (!trackj) continue;
 
           // Fill pair histo
-          while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) )
+          for (Int_t icut = 0; icut < nPairCuts; ++icut)
           {
             // Weither or not the pairs pass the tests
-            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
-            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
-            Bool_t testij = pairCut->Pass(*tracki,*trackj);
+            Bool_t testi  = pairTrackPass[i*nPairCuts+icut];
+            Bool_t testj  = pairTrackPass[j*nPairCuts+icut];
+            Bool_t testij = pairPass[(i*nTracks+j)*nPairCuts+icut];
 
             if ( ( testi && testj ) && testij )
             {
               AliCodeTimerAuto(Form("%s (FillHistosForPair)",analysis->ClassName()),3);
-              analysis->FillHistosForPair(eventSelection,triggerClassName,centrality,pairCut->GetName(),*tracki,*trackj,kFALSE);
+              analysis->FillHistosForPair(eventSelection,triggerClassName,centrality,pairCuts[icut]->GetName(),*tracki,*trackj,kFALSE);
             }
           }
         }
@@ -457,17 +481,17 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
         if(!fMix) continue;
 
         TList* currentPool  =0x0;
-        nextPairCut.Reset();
-        nextTrackCut.Reset();
-
-        AliAnalysisMuMuCutCombination* pairCut;
 
         // Loop over pair cut
-        while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) )
+        // NOTE: the track cut index is not reset for each pair cut, as the track cut iterator before
+        Int_t itrackCut = 0;
+        for (Int_t ipairCut = 0; ipairCut < nPairCuts; ++ipairCut)
         {
+          AliAnalysisMuMuCutCombination* pairCut = pairCuts[ipairCut];
           // Loop over single track cut from mixing configuration
-          while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) )
+          for ( ; itrackCut < nTrackCuts; ++itrackCut)
           {
+            AliAnalysisMuMuCutCombination* trackCut = trackCuts[itrackCut];
             currentPool = FindPool(cent,Form("%s/%s/%s",eventSelection,triggerClassName,trackCut->GetName()));
             if(!currentPool) continue;
 
@@ -478,7 +502,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
               trackj = static_cast<AliVParticle*>(currentPool->At(iTrack2));
 
               // Weither or not the pairs pass the tests
-              Bool_t testi  = trackCut->Pass(*tracki);
+              Bool_t testi  = trackPass[i*nTrackCuts+itrackCut];
               Bool_t testj  = trackCut->Pass(*trackj);
               Bool_t testij = pairCut->Pass(*tracki,*trackj);
 
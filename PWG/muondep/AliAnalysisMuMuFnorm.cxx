@@ -55,7 +55,10 @@ fIsOwner(kTRUE),
 fOCDBPath(ocdbpath),
 fResult(0x0),
 fIsCompactGraphs(compactGraphs),
-fReferenceTriggerType(refTriggerType)
+fReferenceTriggerType(refTriggerType),
+fHasKeyWords(kFALSE),
+fRunKeyWords(),
+fTriggerKeyWords()
 {
   // ctor
 }
@@ -1924,8 +1927,8 @@ set<int> AliAnalysisMuMuFnorm::RunNumbers() const
 
   set<int> runset;
 
-  TString sruns = fCounterCollection.GetKeyWords("run");
-  TObjArray* runs = sruns.Tokenize(",");
+  CacheKeyWords();
+  TObjArray* runs = fRunKeyWords.Tokenize(",");
 
   TIter next(runs);
   TObjString* s;
@@ -2005,18 +2008,30 @@ void AliAnalysisMuMuFnorm::ShowFnorm(const TObjArray& a) const
   }
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuFnorm::CacheKeyWords() const
+{
+  /// Get the run and trigger keywords of the counter collection once :
+  /// they are needed for each run (and trigger) and the counters are
+  /// not changed while we compute the normalization
+
+  if ( fHasKeyWords ) return;
+
+  fRunKeyWords = fCounterCollection.GetKeyWords("run");
+  fTriggerKeyWords = fCounterCollection.GetKeyWords("trigger");
+  fHasKeyWords = kTRUE;
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisMuMuFnorm::TriggerClassnameTest(const char* triggerClassName, Int_t runNumber) const
 {
   /// Check if we have counts for that trigger,run combination
 
-  TString runs = fCounterCollection.GetKeyWords("run");
-
-  if ( !runs.Contains(Form("%d",runNumber)) ) return kFALSE;
+  CacheKeyWords();
 
-  TString triggers = fCounterCollection.GetKeyWords("trigger");
+  if ( !fRunKeyWords.Contains(Form("%d",runNumber)) ) return kFALSE;
 
-  if (!triggers.Contains(triggerClassName)) return kFALSE;
+  if (!fTriggerKeyWords.Contains(triggerClassName)) return kFALSE;
 
   Double_t n = fCounterCollection.GetSum(Form("trigger:%s/run:%d",triggerClassName,runNumber));
 
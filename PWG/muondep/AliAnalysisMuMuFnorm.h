@@ -169,6 +169,8 @@ private:
 
   std::set<int> RunNumbers() const;
 
+  void CacheKeyWords() const;
+
   TString MBTriggerClassName(Int_t runNumber) const;
   TString MSLTriggerClassName(Int_t runNumber) const;
   TString MULTriggerClassName(Int_t runNumber) const;
@@ -184,6 +186,9 @@ private:
   mutable AliAnalysisMuMuResult* fResult; // combined result of the various computations
   Bool_t fIsCompactGraphs; // whether the graph produced should be compact
   ETriggerType fReferenceTriggerType; // reference trigger to get the weighting factors
+  mutable Bool_t fHasKeyWords; // whether fRunKeyWords and fTriggerKeyWords are filled
+  mutable TString fRunKeyWords; // run keywords of the counter collection, cached on first use
+  mutable TString fTriggerKeyWords; // trigger keywords of the counter collection, cached on first use
 
   ClassDef(AliAnalysisMuMuFnorm,0) // class to compute MB to MUON trigger normalization factor
 };
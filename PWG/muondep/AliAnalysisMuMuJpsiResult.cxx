@@ -105,7 +105,8 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(""),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactor(TMath::Limits<Double_t>::Max())
 {
 }
 
@@ -128,7 +129,8 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(particle),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactor(TMath::Limits<Double_t>::Max())
 {
   SetHisto(h);
 
@@ -207,7 +209,8 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(particle),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactor(TMath::Limits<Double_t>::Max())
 {
   SetHisto(h);
 }
@@ -229,7 +232,8 @@ fFitRejectRangeLow(rhs.fFitRejectRangeLow),
 fFitRejectRangeHigh(rhs.fFitRejectRangeHigh),
 fRejectFitPoints(rhs.fRejectFitPoints),
 fParticle(rhs.fParticle),
-fMinvRS(rhs.fMinvRS)
+fMinvRS(rhs.fMinvRS),
+fSPsiPFactor(TMath::Limits<Double_t>::Max())
 {
   /// copy ctor
   /// Note that the mother is lost
@@ -719,7 +723,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewVWG(Double_t *x, D
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[15],
@@ -743,7 +747,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewVWG2(Double_t *x,
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[16],
@@ -767,7 +771,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol1Pol2(Double_t
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[16],
@@ -791,7 +795,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol2Pol3(Double_t
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[18],
@@ -815,7 +819,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol2Exp(Double_t *
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[15],
@@ -840,7 +844,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol4Exp(Double_t *
   /// 2 NA60 (new) + pol4 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[17],
@@ -864,7 +868,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Lin(Double_t *x, Doubl
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[9],
@@ -884,7 +888,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol1Pol2(Double_t *x,
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[12],
@@ -904,7 +908,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Pol3(Double_t *x,
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[14],
@@ -924,7 +928,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Pol3V2(Double_t *x
   /// 2 extended crystal balls + Pol2/pol3
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[13],
@@ -944,7 +948,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Exp(Double_t *x, D
   /// 2 extended crystal balls + pol2 x exp
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
@@ -982,7 +986,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol4Exp(Double_t *x, D
   /// 2 extended crystal balls + pol4 x exp
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[13],
@@ -1020,7 +1024,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWG(Double_t *x, Doubl
   /// 2 extended crystal balls + VWG
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
@@ -1040,7 +1044,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWG2(Double_t *x, Doub
   /// 2 extended crystal balls + VWG2
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[12],
@@ -1060,7 +1064,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWGINDEPTAILS(Double_t
   /// 2 extended crystal balls + pol2 x exp
   /// The tail parameters are independent but the sPsiP and mPsiP are fixed to the one of the JPsi
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
@@ -1148,7 +1152,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSCB2Lin(Double_t* x, Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2Lin(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1261,7 +1265,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSCB2POL2POL3POL4Cheb(Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1285,7 +1289,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[12] = {
     par[0],
@@ -1310,7 +1314,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2(Double_t
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1334,7 +1338,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[12] = {
     par[0],
@@ -1359,7 +1363,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2EXP(Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1384,7 +1388,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1409,7 +1413,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1498,7 +1502,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSNA60NEWPOL2POL3POL4Cheb(Do
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1526,7 +1530,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[16] = {
     par[0],//a
@@ -1554,7 +1558,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2(Doubl
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[16] = {
     par[0],
@@ -1584,7 +1588,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2EXP(Do
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1612,7 +1616,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1654,7 +1658,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtHFunction(Double_t *x, Doub
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1678,7 +1682,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1702,7 +1706,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2INDEPTAILS(Double_t* x, Double_t* par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP with independent tails
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -12532,7 +12536,10 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
 
   if (callEnv.IsValid())
   {
+    // the fit functions need the sigmaPsiP factor at each evaluation, get it once for the whole fit
+    r->fSPsiPFactor = r->GetValue(kKeySPsiP);
     callEnv.Execute(r);// here fit Method ("fit<SOMETHING>") is called and the fit is proceed.
+    r->fSPsiPFactor = TMath::Limits<Double_t>::Max();
   }
   else
   {
@@ -12566,6 +12573,16 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
   return (r!=0x0);
 }
 
+//_____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::GetSPsiPFactor() const
+{
+  /// Factor between the psi' and the J/psi widths, as frozen by AddFit for the
+  /// duration of the fit, or from the result values otherwise
+
+  if ( fSPsiPFactor != TMath::Limits<Double_t>::Max() ) return fSPsiPFactor;
+  return GetValue(kKeySPsiP);
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuJpsiResult::DecodeFitType(const char* fitType)
 {
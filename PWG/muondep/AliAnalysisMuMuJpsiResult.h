@@ -378,6 +378,8 @@ private:
 
   Bool_t CheckFitStatus(TFitResultPtr &fitResult);
 private:
+  Double_t GetSPsiPFactor() const;
+
   Int_t fNofRuns; // number of runs used to get this result
   Int_t fNofTriggers; // number of trigger analyzed
   TH1* fHisto; // invariant mass spectrum
@@ -395,8 +397,9 @@ private:
 
   TString fParticle;
   TString fMinvRS; // minv spectra range and sigmaPsiP factor for the mpt fits
+  Double_t fSPsiPFactor; //! sigmaPsiP factor frozen for the duration of a fit (Max if not set)
 
-  ClassDef(AliAnalysisMuMuJpsiResult,8) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
+  ClassDef(AliAnalysisMuMuJpsiResult,9) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
 };
 
 #endif
@@ -0,0 +1,345 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Event pools for event mixing which store the tracks as fixed-size records (eta, phi, pT, charge, IDs)
+// in one contiguous buffer per pool. Compared to AliEventPool, which owns one TObjArray of AliBasicParticles
+// per event, no objects are allocated per track when the pool is updated and the storage is reused once the
+// pool is full.
+//
+// The rules which decide when the oldest event is removed and when a pool is ready are the same as in AliEventPool.
+// GetEvent returns the tracks of an event as AliBasicParticles in a TClonesArray which is owned and reused by the pool,
+// so the result is only valid until the next call of GetEvent or UpdatePool. Code which can work on the records
+// directly can use GetEventRecords.
+
+#include "AliPackedEventPoolManager.h"
+
+#include "AliBasicParticle.h"
+#include "AliVParticle.h"
+#include "AliLog.h"
+
+#include "TClonesArray.h"
+#include "TObjArray.h"
+
+ClassImp(AliPackedEventPool)
+ClassImp(AliPackedEventPoolManager)
+
+//____________________________________________________________________
+AliPackedEventPool::AliPackedEventPool() :
+  TObject(),
+  fMixDepth(-1),
+  fTargetTrackDepth(0),
+  fTargetFraction(1),
+  fTargetEvents(0),
+  fPtMin(-9999.),
+  fPtMax(9999.),
+  fRecords(),
+  fNTracksInEvent(),
+  fEventOffset(),
+  fFirstRecord(0),
+  fNTracks(0),
+  fEventCache(0),
+  fEventCacheIndex(-1),
+  fNEventsAdded(0)
+{
+  // Default constructor
+}
+
+//____________________________________________________________________
+AliPackedEventPool::AliPackedEventPool(Int_t mixDepth, Int_t targetTrackDepth, Double_t targetFraction, Int_t targetEvents, Double_t ptMin, Double_t ptMax) :
+  TObject(),
+  fMixDepth(mixDepth),
+  fTargetTrackDepth(targetTrackDepth),
+  fTargetFraction(targetFraction),
+  fTargetEvents(targetEvents),
+  fPtMin(ptMin),
+  fPtMax(ptMax),
+  fRecords(),
+  fNTracksInEvent(),
+  fEventOffset(),
+  fFirstRecord(0),
+  fNTracks(0),
+  fEventCache(0),
+  fEventCacheIndex(-1),
+  fNEventsAdded(0)
+{
+  // Constructor
+
+  // the pool typically holds a bit more than the target depth
+  fRecords.reserve(targetTrackDepth + targetTrackDepth / 4);
+}
+
+//____________________________________________________________________
+AliPackedEventPool::~AliPackedEventPool()
+{
+  // Destructor
+
+  delete fEventCache;
+}
+
+//____________________________________________________________________
+Bool_t AliPackedEventPool::IsReady(Int_t tracks, Int_t events) const
+{
+  // same definition as in AliEventPool
+
+  return (tracks >= fTargetFraction * fTargetTrackDepth) || ((fTargetEvents > 0) && (events >= fTargetEvents));
+}
+
+//____________________________________________________________________
+const AliPackedEventPool::Record* AliPackedEventPool::GetEventRecords(Int_t i, Int_t& nTracks) const
+{
+  // returns the tracks of event i (0 = oldest event), nTracks is set to the number of tracks
+
+  if (i < 0 || i >= GetCurrentNEvents())
+  {
+    nTracks = 0;
+    return 0;
+  }
+
+  nTracks = fNTracksInEvent[i];
+  if (nTracks == 0)
+    return 0;
+
+  return &fRecords[fEventOffset[i]];
+}
+
+//____________________________________________________________________
+TObjArray* AliPackedEventPool::GetEvent(Int_t i)
+{
+  // returns the tracks of event i (0 = oldest event) as AliBasicParticles
+  // the array is owned by the pool and reused, i.e. it is only valid until the next call to GetEvent or UpdatePool
+
+  if (i < 0 || i >= GetCurrentNEvents())
+  {
+    AliError(Form("Event %d requested but only %d events in the pool", i, GetCurrentNEvents()));
+    return 0;
+  }
+
+  if (!fEventCache)
+    fEventCache = new TClonesArray("AliBasicParticle", fTargetTrackDepth / 10 + 1);
+
+  // the same event is typically requested several times in a row for different steps
+  Int_t absoluteIndex = fNEventsAdded - GetCurrentNEvents() + i;
+  if (absoluteIndex == fEventCacheIndex)
+    return fEventCache;
+
+  fEventCache->Clear("C");
+
+  Int_t nTracks = 0;
+  const Record* records = GetEventRecords(i, nTracks);
+  for (Int_t j=0; j<nTracks; j++)
+  {
+    const Record& record = records[j];
+    AliBasicParticle* particle = new ((*fEventCache)[j]) AliBasicParticle(record.fEta, record.fPhi, record.fPt, record.fCharge);
+    particle->SetUniqueID(record.fUniqueID);
+    particle->SetEventIndex(record.fEventIndex);
+  }
+
+  fEventCacheIndex = absoluteIndex;
+  return fEventCache;
+}
+
+//____________________________________________________________________
+void AliPackedEventPool::RemoveFirstEvent()
+{
+  // removes the oldest event; the storage is compacted once more than half of the buffer is unused
+
+  if (GetCurrentNEvents() == 0)
+    return;
+
+  fNTracks -= fNTracksInEvent.front();
+  fFirstRecord += fNTracksInEvent.front();
+  fNTracksInEvent.pop_front();
+  fEventOffset.pop_front();
+  fEventCacheIndex = -1;
+
+  if (fFirstRecord > (Int_t) fRecords.size() / 2)
+  {
+    fRecords.erase(fRecords.begin(), fRecords.begin() + fFirstRecord);
+    for (UInt_t i=0; i<fEventOffset.size(); i++)
+      fEventOffset[i] -= fFirstRecord;
+    fFirstRecord = 0;
+  }
+}
+
+//____________________________________________________________________
+Int_t AliPackedEventPool::UpdatePool(TObjArray* tracks, Bool_t useRapidity)
+{
+  // adds the tracks of the current event to the pool and removes the oldest event if needed (same rules as AliEventPool)
+  // in contrast to AliEventPool the tracks are copied, the pool does not take ownership of <tracks>
+  // only tracks in the pT range of the pool are stored, if useRapidity is set the rapidity is stored instead of eta
+  //
+  // returns the number of events in the pool
+
+  // count first, the decision to remove the first event depends on the number of tracks which will be added
+  const Bool_t ptSelection = (fPtMax - fPtMin > 0);
+  const Int_t nInput = tracks->GetEntriesFast();
+  Int_t mult = 0;
+  for (Int_t i=0; i<nInput; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) tracks->UncheckedAt(i);
+    if (ptSelection && (particle->Pt() < fPtMin || particle->Pt() >= fPtMax))
+      continue;
+    mult++;
+  }
+
+  Bool_t removeFirstEvent = kFALSE;
+  if (fNTracks > fTargetTrackDepth && GetCurrentNEvents() > 0)
+  {
+    Int_t diff = fNTracks - fNTracksInEvent.front() + mult;
+    if (diff > fTargetTrackDepth)
+      removeFirstEvent = kTRUE;
+  }
+  if (fMixDepth > 0 && GetCurrentNEvents() >= fMixDepth)
+    removeFirstEvent = kTRUE;
+
+  if (removeFirstEvent)
+    RemoveFirstEvent();
+
+  fEventOffset.push_back(fRecords.size());
+  fNTracksInEvent.push_back(mult);
+
+  for (Int_t i=0; i<nInput; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) tracks->UncheckedAt(i);
+    if (ptSelection && (particle->Pt() < fPtMin || particle->Pt() >= fPtMax))
+      continue;
+
+    Record record;
+    record.fEta = (useRapidity) ? particle->Y() : particle->Eta();
+    record.fPhi = particle->Phi();
+    record.fPt = particle->Pt();
+    record.fCharge = particle->Charge();
+    record.fUniqueID = particle->GetUniqueID();
+    record.fEventIndex = 0;
+
+    AliBasicParticle* particleBasic = dynamic_cast<AliBasicParticle*> (particle);
+    if (particleBasic)
+      record.fEventIndex = particleBasic->GetEventIndex();
+
+    fRecords.push_back(record);
+  }
+
+  fNTracks += mult;
+  fNEventsAdded++;
+
+  return GetCurrentNEvents();
+}
+
+//____________________________________________________________________
+void AliPackedEventPool::Clear(Option_t* /*option*/)
+{
+  // removes all events, the allocated storage is kept
+
+  fRecords.clear();
+  fNTracksInEvent.clear();
+  fEventOffset.clear();
+  fFirstRecord = 0;
+  fNTracks = 0;
+  fEventCacheIndex = -1;
+}
+
+//____________________________________________________________________
+AliPackedEventPoolManager::AliPackedEventPoolManager() :
+  TObject(),
+  fMixDepth(-1),
+  fTargetTrackDepth(0),
+  fTargetFraction(1),
+  fTargetEvents(0),
+  fMultBins(),
+  fZvtxBins(),
+  fPsiBins(),
+  fPtBins(),
+  fPools()
+{
+  // Default constructor
+}
+
+//____________________________________________________________________
+AliPackedEventPoolManager::AliPackedEventPoolManager(Int_t mixDepth, Int_t targetTrackDepth, Int_t nMultBins, const Double_t* multBins, Int_t nZvtxBins, const Double_t* zvtxBins, Int_t nPsiBins, const Double_t* psiBins, Int_t nPtBins, const Double_t* ptBins) :
+  TObject(),
+  fMixDepth(mixDepth),
+  fTargetTrackDepth(targetTrackDepth),
+  fTargetFraction(1),
+  fTargetEvents(0),
+  fMultBins(multBins, multBins + nMultBins + 1),
+  fZvtxBins(zvtxBins, zvtxBins + nZvtxBins + 1),
+  fPsiBins(psiBins, psiBins + nPsiBins + 1),
+  fPtBins(ptBins, ptBins + nPtBins + 1),
+  fPools(nMultBins * nZvtxBins * nPsiBins * nPtBins, (AliPackedEventPool*) 0)
+{
+  // Constructor with the same arguments as AliEventPoolManager
+}
+
+//____________________________________________________________________
+AliPackedEventPoolManager::~AliPackedEventPoolManager()
+{
+  // Destructor
+
+  for (UInt_t i=0; i<fPools.size(); i++)
+    delete fPools[i];
+}
+
+//____________________________________________________________________
+void AliPackedEventPoolManager::SetTargetValues(Int_t trackDepth, Double_t fraction, Int_t events)
+{
+  // sets the conditions when a pool is ready (see AliEventPool), only affects pools created afterwards
+
+  fTargetTrackDepth = trackDepth;
+  fTargetFraction = fraction;
+  fTargetEvents = events;
+}
+
+//____________________________________________________________________
+Int_t AliPackedEventPoolManager::FindBin(const std::vector<Double_t>& bins, Double_t value) const
+{
+  // returns the bin of value (low edge included), -1 if outside
+
+  for (UInt_t i=0; i+1<bins.size(); i++)
+    if (value >= bins[i] && value < bins[i+1])
+      return i;
+
+  return -1;
+}
+
+//____________________________________________________________________
+AliPackedEventPool* AliPackedEventPoolManager::GetEventPool(Double_t centVal, Double_t zVtxVal, Double_t psiVal, Int_t iPt)
+{
+  // returns the pool for the given centrality, zVtx, psi and pT bin, 0 if outside the binning
+
+  Int_t iMult = FindBin(fMultBins, centVal);
+  Int_t iZvtx = FindBin(fZvtxBins, zVtxVal);
+  Int_t iPsi = FindBin(fPsiBins, psiVal);
+
+  if (iMult < 0 || iZvtx < 0 || iPsi < 0 || iPt < 0 || iPt >= GetNumberOfPtBins())
+    return 0;
+
+  Int_t index = ((iMult * GetNumberOfZVtxBins() + iZvtx) * GetNumberOfPsiBins() + iPsi) * GetNumberOfPtBins() + iPt;
+
+  if (!fPools[index])
+    fPools[index] = new AliPackedEventPool(fMixDepth, fTargetTrackDepth, fTargetFraction, fTargetEvents, fPtBins[iPt], fPtBins[iPt+1]);
+
+  return fPools[index];
+}
+
+//____________________________________________________________________
+void AliPackedEventPoolManager::ClearPools()
+{
+  // removes the events from all pools
+
+  for (UInt_t i=0; i<fPools.size(); i++)
+    if (fPools[i])
+      fPools[i]->Clear();
+}
@@ -0,0 +1,113 @@
+#ifndef AliPackedEventPoolManager_H
+#define AliPackedEventPoolManager_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+// Event pools for event mixing which store the tracks as fixed-size records in one contiguous buffer per pool
+// The interface follows AliEventPool / AliEventPoolManager (GetEventPool, UpdatePool, IsReady, GetEvent, ...)
+
+#include "TObject.h"
+#include <vector>
+#include <deque>
+
+class TObjArray;
+class TClonesArray;
+
+class AliPackedEventPool : public TObject
+{
+ public:
+  // one track in the pool
+  struct Record
+  {
+    Float_t fEta;          // eta (or rapidity)
+    Float_t fPhi;          // phi
+    Float_t fPt;           // pT
+    Short_t fCharge;       // charge
+    UInt_t fUniqueID;      // unique ID of the original track
+    Long64_t fEventIndex;  // event index of the original track (if it was an AliBasicParticle)
+  };
+
+  AliPackedEventPool();
+  AliPackedEventPool(Int_t mixDepth, Int_t targetTrackDepth, Double_t targetFraction, Int_t targetEvents, Double_t ptMin, Double_t ptMax);
+  virtual ~AliPackedEventPool();
+
+  Bool_t IsReady() const { return IsReady(NTracksInPool(), GetCurrentNEvents()); }
+  Int_t GetCurrentNEvents() const { return fNTracksInEvent.size(); }
+  Int_t NTracksInPool() const { return fNTracks; }
+  Bool_t GetLockFlag() const { return kFALSE; }
+  Double_t GetPtMin() const { return fPtMin; }
+  Double_t GetPtMax() const { return fPtMax; }
+
+  const Record* GetEventRecords(Int_t i, Int_t& nTracks) const;
+  TObjArray* GetEvent(Int_t i);
+  Int_t UpdatePool(TObjArray* tracks, Bool_t useRapidity = kFALSE);
+  void Clear(Option_t* option = "");
+
+ protected:
+  Bool_t IsReady(Int_t tracks, Int_t events) const;
+  void RemoveFirstEvent();
+
+  Int_t fMixDepth;            // maximum number of events (<= 0: no limit)
+  Int_t fTargetTrackDepth;    // number of tracks which should be in the pool
+  Double_t fTargetFraction;   // pool is ready once this fraction of fTargetTrackDepth is reached
+  Int_t fTargetEvents;        // pool is ready once this number of events is reached
+  Double_t fPtMin;            // only tracks with fPtMin <= pT < fPtMax are stored (if fPtMax > fPtMin)
+  Double_t fPtMax;            // see fPtMin
+
+  std::vector<Record> fRecords;        //! tracks of all events in the pool, oldest event first starting at fFirstRecord
+  std::deque<Int_t> fNTracksInEvent;   //! number of tracks per event, oldest event first
+  std::deque<Int_t> fEventOffset;      //! index of the first track of each event in fRecords
+  Int_t fFirstRecord;                  //! first valid entry in fRecords
+  Int_t fNTracks;                      //! number of tracks in the pool
+
+  TClonesArray* fEventCache;           //! AliBasicParticles of the event last returned by GetEvent (reused)
+  Int_t fEventCacheIndex;              //! absolute index of the event in fEventCache (-1: none)
+  Long64_t fNEventsAdded;              //! number of events added since the pool was created (absolute index of the next event)
+
+ private:
+  AliPackedEventPool(const AliPackedEventPool&);
+  AliPackedEventPool& operator=(const AliPackedEventPool&);
+
+  ClassDef(AliPackedEventPool, 1) // event pool with packed track storage
+};
+
+class AliPackedEventPoolManager : public TObject
+{
+ public:
+  AliPackedEventPoolManager();
+  AliPackedEventPoolManager(Int_t mixDepth, Int_t targetTrackDepth, Int_t nMultBins, const Double_t* multBins, Int_t nZvtxBins, const Double_t* zvtxBins, Int_t nPsiBins, const Double_t* psiBins, Int_t nPtBins, const Double_t* ptBins);
+  virtual ~AliPackedEventPoolManager();
+
+  void SetTargetValues(Int_t trackDepth, Double_t fraction, Int_t events);
+  AliPackedEventPool* GetEventPool(Double_t centVal, Double_t zVtxVal, Double_t psiVal = 0., Int_t iPt = 0);
+
+  Int_t GetNumberOfMultBins() const { return fMultBins.size() - 1; }
+  Int_t GetNumberOfZVtxBins() const { return fZvtxBins.size() - 1; }
+  Int_t GetNumberOfPsiBins() const { return fPsiBins.size() - 1; }
+  Int_t GetNumberOfPtBins() const { return fPtBins.size() - 1; }
+
+  void ClearPools();
+
+ protected:
+  Int_t FindBin(const std::vector<Double_t>& bins, Double_t value) const;
+
+  Int_t fMixDepth;                 // maximum number of events per pool
+  Int_t fTargetTrackDepth;         // number of tracks which should be in each pool
+  Double_t fTargetFraction;        // see AliPackedEventPool
+  Int_t fTargetEvents;             // see AliPackedEventPool
+  std::vector<Double_t> fMultBins; // bin edges in centrality
+  std::vector<Double_t> fZvtxBins; // bin edges in zVtx
+  std::vector<Double_t> fPsiBins;  // bin edges in psi
+  std::vector<Double_t> fPtBins;   // bin edges in pT
+
+  std::vector<AliPackedEventPool*> fPools; //! pools, created on first use
+
+ private:
+  AliPackedEventPoolManager(const AliPackedEventPoolManager&);
+  AliPackedEventPoolManager& operator=(const AliPackedEventPoolManager&);
+
+  ClassDef(AliPackedEventPoolManager, 1) // manager of event pools with packed track storage
+};
+
+#endif
@@ -32,6 +32,7 @@
 #include "TList.h"
 
 #include "AliCFContainer.h"
+#include "AliTHn.h"
 #include "AliVParticle.h"
 
 #include "TH1F.h"
@@ -58,7 +59,9 @@ AliTwoPlusOneContainer::AliTwoPlusOneContainer(const char* name, const char* uEH
   fUseBackgroundSameOneSide(0),
   fUseSmallerPtAssoc(0),
   fEfficiencyCorrection(0),
-  fMergeCount(0)
+  fMergeCount(0),
+  fPairBlockStep(),
+  fPairBlockEntries()
 {
   // Constructor
   //
@@ -115,7 +118,9 @@ AliTwoPlusOneContainer::AliTwoPlusOneContainer(const AliTwoPlusOneContainer &c)
   fUseBackgroundSameOneSide(0),
   fUseSmallerPtAssoc(0),
   fEfficiencyCorrection(0),
-  fMergeCount(0)
+  fMergeCount(0),
+  fPairBlockStep(),
+  fPairBlockEntries()
 {
   //
   // AliTwoPlusOneContainer copy constructor
@@ -228,7 +233,6 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
   //several booleans in this container change the behaviour of the container:
   //fUseLeadingPt: decides if a particle is only accepted as trigger particle if it has the highest pT within an circle with the radius of alpha
   //fUseAllT1: in case multiple trigger 2 are accepted, the near side yield is filled for each found away side yield
-  AliCFContainer* track_hist = fTwoPlusOne->GetTrackHist(AliUEHist::kToward);
   AliCFContainer* event_hist = fTwoPlusOne->GetEventHist();
   AliUEHist::CFStep stepUEHist = static_cast<AliUEHist::CFStep>(step);
 
@@ -475,7 +479,7 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
 	if(applyEfficiency)
 	  efficiency = part_efficiency*part3_efficiency;
 
-	track_hist->Fill(vars, stepUEHist, weight*efficiency);
+	AddToPairBlock(0, stepUEHist, vars, weight*efficiency);
       }else if(!is1plus1){
 	if(!fUseAllT1){
 	  //do not add the trigger 2 particle with the highest pT
@@ -485,7 +489,7 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
 	  if(applyEfficiency)
 	    efficiency = part_efficiency*found_particle_efficiency[ind_max_found_pt]*part3_efficiency;
 	  
-	  track_hist->Fill(vars, stepUEHist, weight*efficiency);
+	  AddToPairBlock(0, stepUEHist, vars, weight*efficiency);
 	}else
 	  for(int l=0; l<ind_found; l++){
 	    //do not add the trigger 2 particle
@@ -496,7 +500,7 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
 	    if(applyEfficiency)
 	      efficiency = part_efficiency*found_particle_efficiency[l]*part3_efficiency;
 
-	    track_hist->Fill(vars, stepUEHist, weight*efficiency);//fill NS for all AS triggers
+	    AddToPairBlock(0, stepUEHist, vars, weight*efficiency);//fill NS for all AS triggers
 	  }
       }
     }
@@ -548,11 +552,15 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
 	if(applyEfficiency)
 	  efficiency = part_efficiency*found_particle_efficiency[l]*part3_efficiency;
 
-	track_hist->Fill(vars, stepUEHist+1, weight*efficiency);//step +1 is the AS to the NS plot of step
+	AddToPairBlock(1, stepUEHist+1, vars, weight*efficiency);//step +1 is the AS to the NS plot of step
       }
     }
   }//end loop to search for the first trigger particle
 
+  //fill the remaining entries of the near and away side pair blocks
+  FlushPairBlock(0);
+  FlushPairBlock(1);
+
   //put fAlpha back on the old value in case this is for background same
   if(isBackgroundSame && !fUseBackgroundSameOneSide)
      fAlpha*= 2;
@@ -560,6 +568,49 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
   return found_triggers;
 }
 
+//____________________________________________________________________
+void AliTwoPlusOneContainer::AddToPairBlock(Int_t side, Int_t step, const Double_t* vars, Double_t weight)
+{
+  // adds a pair entry to the block of the near (side = 0) or away side (side = 1)
+  // the block is filled into the track histogram with AliTHnBase::FillN when it is full or at the end of FillCorrelations
+
+  if (fPairBlockEntries[side] > 0 && fPairBlockStep[side] != step)
+    FlushPairBlock(side);
+
+  if (fPairBlockWeights[side].size() == 0)
+  {
+    for (Int_t k=0; k<kNPairVars; k++)
+      fPairBlockColumns[side][k].resize(kPairBlockSize);
+    fPairBlockWeights[side].resize(kPairBlockSize);
+  }
+
+  const Int_t n = fPairBlockEntries[side];
+  for (Int_t k=0; k<kNPairVars; k++)
+    fPairBlockColumns[side][k][n] = vars[k];
+  fPairBlockWeights[side][n] = weight;
+  fPairBlockStep[side] = step;
+  fPairBlockEntries[side]++;
+
+  if (fPairBlockEntries[side] == kPairBlockSize)
+    FlushPairBlock(side);
+}
+
+//____________________________________________________________________
+void AliTwoPlusOneContainer::FlushPairBlock(Int_t side)
+{
+  // fills the collected pair entries of <side> into the track histogram
+
+  if (fPairBlockEntries[side] == 0)
+    return;
+
+  const Double_t* columns[kNPairVars];
+  for (Int_t k=0; k<kNPairVars; k++)
+    columns[k] = &fPairBlockColumns[side][k][0];
+
+  AliTHnBase::FillContainerN(fTwoPlusOne->GetTrackHist(AliUEHist::kToward), fPairBlockEntries[side], columns, fPairBlockStep[side], &fPairBlockWeights[side][0]);
+  fPairBlockEntries[side] = 0;
+}
+
 //____________________________________________________________________
 AliTwoPlusOneContainer &AliTwoPlusOneContainer::operator=(const AliTwoPlusOneContainer &c)
 {
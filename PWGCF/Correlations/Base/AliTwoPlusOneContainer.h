@@ -9,6 +9,7 @@
 #include "TNamed.h"
 #include "AliUEHist.h"
 #include "THn.h"
+#include <vector>
 // #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
 
 class AliVParticle;
@@ -59,6 +60,10 @@ class AliTwoPlusOneContainer : public TNamed
 protected:
   void DeleteContainers();
   Double_t getEfficiency(Double_t pt, Double_t eta, Double_t centrality, Double_t zVtx);
+  void AddToPairBlock(Int_t side, Int_t step, const Double_t* vars, Double_t weight);
+  void FlushPairBlock(Int_t side);
+
+  enum { kNPairVars = 7, kPairBlockSize = 4096 };
   
   AliUEHist* fTwoPlusOne;	     //a 7 dim histogram which actually contains all the data
 
@@ -80,6 +85,11 @@ protected:
   Bool_t fUseSmallerPtAssoc;         //use only associated particles with less pT than the trigger particles
   THnF* fEfficiencyCorrection;   // if non-0 this efficiency correction is applied on the fly to the filling for trigger particles. The factor is multiplicative, i.e. should contain 1/efficiency
   Int_t fMergeCount;	             // counts how many objects have been merged together
+
+  std::vector<Double_t> fPairBlockColumns[2][kNPairVars]; //! variables of the pair entries not yet filled (near and away side)
+  std::vector<Double_t> fPairBlockWeights[2];             //! weights of the pair entries not yet filled
+  Int_t fPairBlockStep[2];                                //! step of the pair entries not yet filled
+  Int_t fPairBlockEntries[2];                             //! number of pair entries not yet filled
   
   ClassDef(AliTwoPlusOneContainer, 10)  // underlying event histogram container
 };
@@ -31,6 +31,9 @@
 #include "TH1D.h"
 #include "TH2D.h"
 #include "TH3D.h"
+#include "TMap.h"
+#include "TObjArray.h"
+#include "TObjString.h"
 #include "AliLog.h"
 #include "TCanvas.h"
 #include "TF1.h"
@@ -66,6 +69,8 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
   fCache(0),
   fGetMultCacheOn(kFALSE),
   fGetMultCache(0),
+  fProjectionCacheOn(kFALSE),
+  fProjectionCache(0),
   fHistogramType(reqHist)
 {
   // Constructor
@@ -433,6 +438,8 @@ AliUEHist::AliUEHist(const AliUEHist &c) :
   fCache(0),
   fGetMultCacheOn(kFALSE),
   fGetMultCache(0),
+  fProjectionCacheOn(kFALSE),
+  fProjectionCache(0),
   fHistogramType()
 {
   //
@@ -488,6 +495,8 @@ AliUEHist::~AliUEHist()
     delete fCache;
     fCache = 0;
   }
+
+  ClearProjectionCache();
 }
 
 //____________________________________________________________________
@@ -593,6 +602,8 @@ Long64_t AliUEHist::Merge(TCollection* list)
   if (fFakePt)
     fFakePt->Merge(lists[fkRegions+2]);
 
+  ClearProjectionCache();
+
   for (UInt_t i=0; i<kMaxLists; i++)
     delete lists[i];
     
@@ -1016,6 +1027,97 @@ void AliUEHist::GetHistsZVtxMult(AliUEHist::CFStep step, AliUEHist::Region regio
   ResetBinLimits(fEventHist->GetGrid(step));
 }
 
+//____________________________________________________________________
+TObjArray* AliUEHist::GetHistsZVtxMultSlices(AliUEHist::CFStep step, AliUEHist::Region region, Float_t ptLeadMin, Float_t ptLeadMax)
+{
+  // Calls GetHistsZVtxMult(...) and projects the track histogram on deltaphi, deltaeta for all vertex and multiplicity bins 
+  // (including under- and overflow) in a single loop over its bins, instead of one Projection call per slice
+  //
+  // returns an array with: [0] the 4d track histogram, [1] the 2d event histogram (see GetHistsZVtxMult), followed by the 
+  // deltaphi, deltaeta histograms of the slices. Use GetZVtxMultSlice to access them.
+  //
+  // If SetProjectionCache() is set, the array is owned by this object and returned again by subsequent calls with the same 
+  // parameters and projection limits (until ClearProjectionCache() is called), otherwise it has to be deleted by the caller
+
+  TString key;
+  if (fProjectionCacheOn)
+  {
+    key.Form("%d_%d_%f_%f_%f_%f_%f_%f_%f_%f", step, region, ptLeadMin, ptLeadMax, fEtaMin, fEtaMax, fPtMin, fPtMax, fPt2Min, fPt2Max);
+    if (!fProjectionCache)
+    {
+      fProjectionCache = new TMap;
+      fProjectionCache->SetOwnerKeyValue(kTRUE, kTRUE);
+    }
+    TObjArray* cached = dynamic_cast<TObjArray*> (fProjectionCache->GetValue(key));
+    if (cached)
+      return cached;
+  }
+  
+  THnBase* trackHist = 0;
+  TH2* eventHist = 0;
+  GetHistsZVtxMult(step, region, ptLeadMin, ptLeadMax, &trackHist, &eventHist);
+  
+  Bool_t oldStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  
+  TAxis* phiAxis = trackHist->GetAxis(0);
+  TAxis* etaAxis = trackHist->GetAxis(1);
+  const Int_t nVertexBins = trackHist->GetAxis(2)->GetNbins() + 2;
+  const Int_t nMultBins = trackHist->GetAxis(3)->GetNbins() + 2;
+  
+  TObjArray* slices = new TObjArray(2 + nVertexBins * nMultBins);
+  slices->SetOwner(kTRUE);
+  slices->Add(trackHist);
+  slices->Add(eventHist);
+  
+  for (Int_t multBin = 0; multBin < nMultBins; multBin++)
+    for (Int_t vertexBin = 0; vertexBin < nVertexBins; vertexBin++)
+    {
+      TH2D* slice = new TH2D(Form("%s_proj_%d_%d", trackHist->GetName(), vertexBin, multBin), trackHist->GetTitle(), 
+                             phiAxis->GetNbins(), phiAxis->GetXmin(), phiAxis->GetXmax(), etaAxis->GetNbins(), etaAxis->GetXmin(), etaAxis->GetXmax());
+      if (phiAxis->GetXbins()->GetSize() > 0)
+        slice->GetXaxis()->Set(phiAxis->GetNbins(), phiAxis->GetXbins()->GetArray());
+      if (etaAxis->GetXbins()->GetSize() > 0)
+        slice->GetYaxis()->Set(etaAxis->GetNbins(), etaAxis->GetXbins()->GetArray());
+      slice->GetXaxis()->SetTitle(phiAxis->GetTitle());
+      slice->GetYaxis()->SetTitle(etaAxis->GetTitle());
+      slice->Sumw2();
+      slices->Add(slice);
+    }
+  
+  // one pass over the track histogram, filling each bin into the slice of its vertex and multiplicity bin
+  // (same content and error as trackHist->Projection(1, 0, "E") with the range set to this vertex and multiplicity bin)
+  Int_t bins[4];
+  for (Long64_t binIdx = 0; binIdx < trackHist->GetNbins(); binIdx++)
+  {
+    Double_t value = trackHist->GetBinContent(binIdx, bins);
+    Double_t error2 = trackHist->GetBinError2(binIdx);
+    if (value == 0 && error2 == 0)
+      continue;
+    
+    TH2* slice = GetZVtxMultSlice(slices, bins[2], bins[3]);
+    Int_t bin = slice->GetBin(bins[0], bins[1]);
+    slice->AddBinContent(bin, value);
+    (*slice->GetSumw2())[bin] += error2;
+  }
+  
+  TH1::AddDirectory(oldStatus);
+  
+  if (fProjectionCacheOn)
+    fProjectionCache->Add(new TObjString(key), slices);
+  
+  return slices;
+}
+
+//____________________________________________________________________
+TH2* AliUEHist::GetZVtxMultSlice(TObjArray* slices, Int_t vertexBin, Int_t multBin)
+{
+  // returns the deltaphi, deltaeta histogram of the given vertex and multiplicity bin from an array returned by GetHistsZVtxMultSlices
+  
+  const Int_t nVertexBins = ((THnBase*) slices->UncheckedAt(0))->GetAxis(2)->GetNbins() + 2;
+  return (TH2*) slices->UncheckedAt(2 + multBin * nVertexBins + vertexBin);
+}
+
 //____________________________________________________________________
 TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEHist::Region region, Float_t ptLeadMin, Float_t ptLeadMax, Int_t multBinBegin, Int_t multBinEnd, Bool_t normalizePerTrigger, Int_t stepForMixed, Int_t* trigger)
 {
@@ -1023,6 +1125,7 @@ TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEH
   // 1_N [ (same/mixed)_1 + (same/mixed)_2 + (same/mixed)_3 + ... ]
   // where N is the total number of events/trigger particles and the subscript is the vertex/multiplicity bin
   // where mixed is normalized such that the information about the number of pairs in same is kept
+  // The projections of all bins are made in one go by GetHistsZVtxMultSlices (and kept if SetProjectionCache() is set)
   //
   // returns a 2D histogram: deltaphi, deltaeta
   //
@@ -1037,18 +1140,15 @@ TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEH
   
   TH2* totalTracks = 0;
   
-  THnBase* trackSameAll = 0;
-  THnBase* trackMixedAll = 0;
-  THnBase* trackMixedAllStep6 = 0;
-  TH2* eventSameAll = 0;
-  TH2* eventMixedAll = 0;
-  TH2* eventMixedAllStep6 = 0;
+  TObjArray* slicesSame = 0;
+  TObjArray* slicesMixed = 0;
+  TObjArray* slicesMixedStep6 = 0;
   
   Long64_t totalEvents = 0;
   Int_t nCorrelationFunctions = 0;
   
-  GetHistsZVtxMult(step, region, ptLeadMin, ptLeadMax, &trackSameAll, &eventSameAll);
-  mixed->GetHistsZVtxMult((stepForMixed == -1) ? step : (CFStep) stepForMixed, region, ptLeadMin, ptLeadMax, &trackMixedAll, &eventMixedAll);
+  slicesSame = GetHistsZVtxMultSlices(step, region, ptLeadMin, ptLeadMax);
+  slicesMixed = mixed->GetHistsZVtxMultSlices((stepForMixed == -1) ? step : (CFStep) stepForMixed, region, ptLeadMin, ptLeadMax);
   
   // If we ask for histograms from step8 (TTR cut applied) there is a hole at 0,0; so this cannot be used for the
   // mixed-event normalization. If step6 is available, the normalization factor is read out from that one.
@@ -1057,9 +1157,13 @@ TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEH
   if (stepForMixed == -1 && step == kCFStepBiasStudy && mixed->fEventHist->GetGrid(kCFStepReconstructed)->GetEntries() > 0 && !fSkipScaleMixedEvent)
   {
     Printf("Using mixed-event normalization factors from step %d", kCFStepReconstructed);
-    mixed->GetHistsZVtxMult(kCFStepReconstructed, region, ptLeadMin, ptLeadMax, &trackMixedAllStep6, &eventMixedAllStep6);
+    slicesMixedStep6 = mixed->GetHistsZVtxMultSlices(kCFStepReconstructed, region, ptLeadMin, ptLeadMax);
   }
   
+  THnBase* trackSameAll = (THnBase*) slicesSame->At(0);
+  TH2* eventSameAll = (TH2*) slicesSame->At(1);
+  TH2* eventMixedAll = (TH2*) slicesMixed->At(1);
+  
 //   Printf("%f %f %f %f", trackSameAll->GetEntries(), eventSameAll->GetEntries(), trackMixedAll->GetEntries(), eventMixedAll->GetEntries());
   
 //   TH1* normParameters = new TH1F("normParameters", "", 100, 0, 2);
@@ -1076,32 +1180,22 @@ TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEH
   
   for (Int_t multBin = TMath::Max(1, multBinBegin); multBin <= TMath::Min(multAxis->GetNbins(), multBinEnd); multBin++)
   {
-    trackSameAll->GetAxis(3)->SetRange(multBin, multBin);
-    trackMixedAll->GetAxis(3)->SetRange(multBin, multBin);
-    if (trackMixedAllStep6)
-      trackMixedAllStep6->GetAxis(3)->SetRange(multBin, multBin);
-
     Double_t mixedNorm = 1;
     Double_t mixedNormError = 0;
 
     if (!fSkipScaleMixedEvent)
     {
       // get mixed normalization correction factor: is independent of vertex bin if scaled with number of triggers
-      TH2* tracksMixed = 0;
-      if (trackMixedAllStep6)
-      {
-	trackMixedAllStep6->GetAxis(2)->SetRange(0, -1);
-	tracksMixed = trackMixedAllStep6->Projection(1, 0, "E");
-      }
-      else
-      {
-	trackMixedAll->GetAxis(2)->SetRange(0, -1);
-	tracksMixed = trackMixedAll->Projection(1, 0, "E");
-      }
+      // sum over all vertex bins (including under- and overflow)
+      TObjArray* slicesNorm = (slicesMixedStep6) ? slicesMixedStep6 : slicesMixed;
+      Int_t nVertexBinsNorm = ((THnBase*) slicesNorm->At(0))->GetAxis(2)->GetNbins();
+      TH2* tracksMixed = (TH2*) GetZVtxMultSlice(slicesNorm, 0, multBin)->Clone();
+      for (Int_t vertexBin = 1; vertexBin <= nVertexBinsNorm + 1; vertexBin++)
+	tracksMixed->Add(GetZVtxMultSlice(slicesNorm, vertexBin, multBin));
   //     Printf("%f", tracksMixed->Integral());
       Float_t binWidthEta = tracksMixed->GetYaxis()->GetBinWidth(1);
     
-      if (stepForMixed == -1 && step == kCFStepBiasStudy && !trackMixedAllStep6)
+      if (stepForMixed == -1 && step == kCFStepBiasStudy && !slicesMixedStep6)
       {
 	// get mixed event normalization by assuming full acceptance at deta at 0 (integrate over dphi), excluding (0, 0)
 	Float_t phiExclude = 0.41;
@@ -1198,11 +1292,8 @@ TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEH
     
     for (Int_t vertexBin = vertexBinBegin; vertexBin <= vertexBinEnd; vertexBin++)
     {
-      trackSameAll->GetAxis(2)->SetRange(vertexBin, vertexBin);
-      trackMixedAll->GetAxis(2)->SetRange(vertexBin, vertexBin);
-
-      TH2* tracksSame = trackSameAll->Projection(1, 0, "E");
-      TH2* tracksMixed = trackMixedAll->Projection(1, 0, "E");
+      TH2* tracksSame = (TH2*) GetZVtxMultSlice(slicesSame, vertexBin, multBin)->Clone();
+      TH2* tracksMixed = (TH2*) GetZVtxMultSlice(slicesMixed, vertexBin, multBin)->Clone();
       
       // asssume flat in dphi, gain in statistics
       //     TH1* histMixedproj = mixedTwoD->ProjectionY();
@@ -1309,12 +1400,13 @@ TH2* AliUEHist::GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEH
     totalTracks->Scale(1.0 / normalization);
   }
   
-  delete trackSameAll;
-  delete trackMixedAll;
-  delete trackMixedAllStep6;
-  delete eventSameAll;
-  delete eventMixedAll;
-  delete eventMixedAllStep6;
+  if (!fProjectionCacheOn)
+    delete slicesSame;
+  if (!mixed->fProjectionCacheOn)
+  {
+    delete slicesMixed;
+    delete slicesMixedStep6;
+  }
   
 //   new TCanvas; normParameters->Draw();
   
@@ -3062,6 +3154,8 @@ void AliUEHist::Scale(Double_t factor)
   
   fEventHist->Scale(factor);
   fTrackHistEfficiency->Scale(factor);
+
+  ClearProjectionCache();
 }
 
 void AliUEHist::Reset()
@@ -3078,6 +3172,20 @@ void AliUEHist::Reset()
     
   for (Int_t step=0; step<fTrackHistEfficiency->GetNStep(); step++)
     fTrackHistEfficiency->GetGrid(step)->GetGrid()->Reset();
+
+  ClearProjectionCache();
+}
+
+void AliUEHist::ClearProjectionCache()
+{
+  // deletes the histograms kept by GetHistsZVtxMultSlices, has to be called if the content or the projection limits are changed
+  // (done automatically in Merge, Scale and Reset)
+  
+  if (fProjectionCache)
+  {
+    delete fProjectionCache;
+    fProjectionCache = 0;
+  }
 }
 
 THnBase* AliUEHist::ChangeToThn(THnBase* sparse)
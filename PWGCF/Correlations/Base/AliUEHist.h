@@ -23,6 +23,8 @@ class TCollection;
 class AliCFGridSparse;
 class THnSparse;
 class THnBase;
+class TObjArray;
+class TMap;
 
 class AliUEHist : public TObject
 {
@@ -57,6 +59,8 @@ class AliUEHist : public TObject
   
   void GetHistsZVtx(AliUEHist::CFStep step, AliUEHist::Region region, Float_t ptLeadMin, Float_t ptLeadMax, Int_t multBinBegin, Int_t multBinEnd, TH3** trackHist, TH1** eventHist);
   void GetHistsZVtxMult(AliUEHist::CFStep step, AliUEHist::Region region, Float_t ptLeadMin, Float_t ptLeadMax, THnBase** trackHist, TH2** eventHist);
+  TObjArray* GetHistsZVtxMultSlices(AliUEHist::CFStep step, AliUEHist::Region region, Float_t ptLeadMin, Float_t ptLeadMax);
+  static TH2* GetZVtxMultSlice(TObjArray* slices, Int_t vertexBin, Int_t multBin);
   
   TH2* GetSumOfRatios2(AliUEHist* mixed, AliUEHist::CFStep step, AliUEHist::Region region, Float_t ptLeadMin, Float_t ptLeadMax, Int_t multBinBegin, Int_t multBinEnd, Bool_t normalizePerTrigger = kTRUE, Int_t stepForMixed = -1, Int_t *trigger = NULL);
   
@@ -129,6 +133,8 @@ class AliUEHist : public TObject
   void ResetBinLimits(THnBase* grid);
   
   void SetGetMultCache(Bool_t flag = kTRUE) { fGetMultCacheOn = flag; }
+  void SetProjectionCache(Bool_t flag = kTRUE) { fProjectionCacheOn = flag; }
+  void ClearProjectionCache();
   
   AliUEHist(const AliUEHist &c);
   AliUEHist& operator=(const AliUEHist& corr);
@@ -176,9 +182,12 @@ protected:
   Bool_t fGetMultCacheOn;             //! cache for GetHistsZVtxMult function active
   THnBase* fGetMultCache;             //! cache for GetHistsZVtxMult function
   
+  Bool_t fProjectionCacheOn;          //! cache for GetHistsZVtxMultSlices function active
+  TMap* fProjectionCache;             //! cache for GetHistsZVtxMultSlices function
+  
   TString fHistogramType;             // what is stored in this histogram
   
-  ClassDef(AliUEHist, 16) // underlying event histogram container
+  ClassDef(AliUEHist, 17) // underlying event histogram container
 };
 
 #endif
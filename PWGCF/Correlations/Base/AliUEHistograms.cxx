@@ -25,6 +25,7 @@
 #include "AliUEHistograms.h"
 
 #include "AliCFContainer.h"
+#include "AliTHn.h"
 #include "AliBasicParticle.h"
 #include "AliVParticle.h"
 #include "AliAODTrack.h"
@@ -80,6 +81,13 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
+  fUseTrackSnapshot(kFALSE),
+  fTriggerSnapshot(),
+  fAssociatedSnapshot(),
+  fPairDEta(),
+  fPairDPhi(),
+  fPairWeights(),
+  fAssociatedEfficiency(),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -254,6 +262,13 @@ AliUEHistograms::AliUEHistograms(const AliUEHistograms &c) :
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
+  fUseTrackSnapshot(kFALSE),
+  fTriggerSnapshot(),
+  fAssociatedSnapshot(),
+  fPairDEta(),
+  fPairDPhi(),
+  fPairWeights(),
+  fAssociatedEfficiency(),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -699,6 +714,26 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
+    // structure-of-arrays copy of the trigger and associated particles, used for the pair loop instead of the TObjArrays
+    // the flags of the resonance daughters are set above, therefore this has to come afterwards
+    if (fUseTrackSnapshot)
+    {
+      FillTrackSnapshot(fTriggerSnapshot, particles, (applyEfficiency) ? fEfficiencyCorrectionTriggers : 0, centrality, zVtx, kResonanceDaughterFlag);
+      FillTrackSnapshot(fAssociatedSnapshot, input, (applyEfficiency) ? fEfficiencyCorrectionAssociated : 0, centrality, zVtx, kResonanceDaughterFlag);
+      fPairDEta.resize(jMax);
+      fPairDPhi.resize(jMax);
+      for (Int_t k=0; k<6; k++)
+        fPairColumns[k].resize(jMax);
+      fPairWeights.resize(jMax);
+    }
+    else if (applyEfficiency && fEfficiencyCorrectionAssociated)
+    {
+      // the efficiency correction of the associated particles does not depend on the trigger particle, look it up once per event
+      fAssociatedEfficiency.resize(jMax);
+      for (Int_t j=0; j<jMax; j++)
+        fAssociatedEfficiency[j] = GetEfficiencyCorrection(fEfficiencyCorrectionAssociated, eta[j], ((AliVParticle*) input->UncheckedAt(j))->Pt(), centrality, zVtx);
+    }
+    
     for (Int_t i=0; i<particles->GetEntriesFast(); i++)
     {
       AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
@@ -726,7 +761,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  continue;
 	}
 	
-      for (Int_t j=0; j<jMax; j++)
+      // efficiency correction of the trigger particle, used for all its pairs and for the trigger counting below
+      Double_t triggerEfficiency = 1;
+      if (applyEfficiency && fEfficiencyCorrectionTriggers)
+        triggerEfficiency = GetEfficiencyCorrection(fEfficiencyCorrectionTriggers, triggerEta, triggerParticle->Pt(), centrality, zVtx);
+	
+      if (fUseTrackSnapshot)
+      {
+        FillPairsFromSnapshot(i, (mixed != 0), centrality, zVtx, step, weight, fillpT, twoTrackEfficiencyCut, bSign, twoTrackEfficiencyCutValue, triggerWeighting);
+      }
+      else for (Int_t j=0; j<jMax; j++)
       {
         if (!mixed && i == j)
           continue;
@@ -789,163 +833,13 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	    continue;
 	  }
 
-	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	  
-	  if (mass < fCutConversionsV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	    
-	    fControlConvResoncances->Fill(0.0, mass);
-
-	    if (mass < fCutConversionsV*fCutConversionsV) 
-	      continue;
-	  }
-	}
-	
-	// K0s
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	  
-	  const Float_t kK0smass = 0.4976;
-	  
-	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
-
-	    if (mass > (kK0smass-fCutResonancesV)*(kK0smass-fCutResonancesV) && mass < (kK0smass+fCutResonancesV)*(kK0smass+fCutResonancesV))
-	      continue;
-	  }
-	}
-
-	// Lambda
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-	  
-	  const Float_t kLambdaMass = 1.115;
-
-	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
-	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-
-	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
-	    
-	    if (mass1 > (kLambdaMass-fCutResonancesV)*(kLambdaMass-fCutResonancesV) && mass1 < (kLambdaMass+fCutResonancesV)*(kLambdaMass+fCutResonancesV))
-	      continue;
-	  }
-	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
-	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-
-	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
-
-	    if (mass2 > (kLambdaMass-fCutResonancesV)*(kLambdaMass-fCutResonancesV) && mass2 < (kLambdaMass+fCutResonancesV)*(kLambdaMass+fCutResonancesV))
-	      continue;
-	  }
-	}
-
-        // Phi
-        if (fCutOnPhi)
-        {
-          if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-          {
-            Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-  
-            const Float_t kPhimass = 1.019;
-
-            if (TMath::Abs(mass - kPhimass*kPhimass) < fCutResonancesV * 5)
-            {
-              mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-
-              fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
-
-              if (mass > (kPhimass-fCutResonancesV)*(kPhimass-fCutResonancesV) && mass < (kPhimass+fCutResonancesV)*(kPhimass+fCutResonancesV))
-                continue;
-            }
-          }
-        }	
-
-        // Rho
-        if (fCutOnRho)
-        {
-          if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-          {
-            Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-  
-            const Float_t kRhomass = 0.770;
-
-            if (TMath::Abs(mass - kRhomass*kRhomass) < fCutResonancesV * 5)
-            {
-              mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-
-              fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
-
-              if (mass > (kRhomass-fCutResonancesV)*(kRhomass-fCutResonancesV) && mass < (kRhomass+fCutResonancesV)*(kRhomass+fCutResonancesV))
-                continue;
-            }
-          }
-        }
+	if ((fCutConversionsV > 0 || fCutResonancesV > 0) && particle->Charge() * triggerParticle->Charge() < 0)
+	  if (RejectResonancePair(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi()))
+	    continue;
 
 	if (twoTrackEfficiencyCut)
-	{
-	  // the variables & cuthave been developed by the HBT group 
-	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
-
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
-	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
-	      
-	  Float_t deta = triggerEta - eta[j];
-	      
-	  // optimization
-	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
-	  {
-	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
-	    
-	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
-
-	    Float_t dphistarminabs = 1e5;
-	    Float_t dphistarmin = 1e5;
-	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
-	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
-	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
-
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs)
-		{
-		  dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
-	      
-	      fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	      
-	      if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
-	      {
-// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
-		continue;
-	      }
-
-    	      fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	    }
-	  }
-	}
+	  if (RejectTwoTrackPair(triggerEta - eta[j], triggerParticle->Phi(), triggerParticle->Pt(), triggerParticle->Charge(), particle->Phi(), particle->Pt(), particle->Charge(), bSign, twoTrackEfficiencyCutValue))
+	    continue;
         
         Double_t vars[6];
         vars[0] = triggerEta - eta[j];
@@ -965,29 +859,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	Double_t useWeight = weight;
 	if (applyEfficiency)
 	{
+	  // associated particle, then trigger particle (same order of the multiplications as before the lookups were hoisted)
 	  if (fEfficiencyCorrectionAssociated)
-	  {
-	    Int_t effVars[4];
-	    // associated particle
-	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
-	    effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
-	    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    
-	    // 	  Printf("%d %d %d %d %f", effVars[0], effVars[1], effVars[2], effVars[3], fEfficiencyCorrectionAssociated->GetBinContent(effVars));
-	  
-	    useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
-	  }
+	    useWeight *= fAssociatedEfficiency[j];
 	  if (fEfficiencyCorrectionTriggers)
-	  {
-	    Int_t effVars[4];
-
-	    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[2]); //pt
-	    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	  }
+	    useWeight *= triggerEfficiency;
 	}
 
 	if (fWeightPerEvent)
@@ -1013,16 +889,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 
 	Double_t useWeight = 1;
 	if (fEfficiencyCorrectionTriggers && applyEfficiency)
-	{
-	  Int_t effVars[4];
-	  
-	  // trigger particle
-	  effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	  effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
-	  effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
-	  effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
-	  useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	}
+	  useWeight *= triggerEfficiency;
 
 	if (TMath::Abs(triggerEta) < 0.8 && triggerParticle->Pt() > 0)
 	  fInvYield2->Fill(centrality, triggerParticle->Pt(), useWeight / triggerParticle->Pt());
@@ -1060,6 +927,347 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
   FillEvent(centrality, step);
 }
+
+//____________________________________________________________________
+void AliUEHistograms::FillTrackSnapshot(TrackSnapshot& snapshot, TObjArray* tracks, THnF* efficiency, Double_t centrality, Float_t zVtx, UInt_t flagBit)
+{
+  // copies pt, eta, phi, charge and the efficiency correction of all particles in <tracks> into contiguous arrays
+  // the storage of <snapshot> is reused between calls
+  //
+  // the values are stored with the same precision as they enter the pair loop in FillCorrelations, i.e. the output does not change
+  
+  Int_t n = tracks->GetEntriesFast();
+  snapshot.Resize(n);
+  
+  for (Int_t i=0; i<n; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) tracks->UncheckedAt(i);
+    
+    snapshot.fParticle[i] = particle;
+    snapshot.fPt[i] = particle->Pt();
+    snapshot.fEta[i] = particle->Eta();
+    snapshot.fPhi[i] = particle->Phi();
+    snapshot.fCharge[i] = particle->Charge();
+    snapshot.fFlagged[i] = (fRejectResonanceDaughters > 0 && particle->TestBit(flagBit));
+    snapshot.fEventIndex[i] = -1;
+    
+    if (fCheckEventNumberInCorrelation)
+    {
+      AliBasicParticle* particleBasic = dynamic_cast<AliBasicParticle*>(particle);
+      if (!particleBasic)
+	AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+      snapshot.fEventIndex[i] = particleBasic->GetEventIndex();
+    }
+    
+    snapshot.fEfficiency[i] = 1;
+    if (efficiency)
+      snapshot.fEfficiency[i] = GetEfficiencyCorrection(efficiency, snapshot.fEta[i], snapshot.fPt[i], centrality, zVtx);
+  }
+}
+
+//____________________________________________________________________
+Double_t AliUEHistograms::GetEfficiencyCorrection(THnF* efficiency, Float_t eta, Double_t pt, Double_t centrality, Float_t zVtx)
+{
+  // multiplicative efficiency correction of a particle from the map <efficiency> (axes: eta, pT, centrality, zVtx)
+  
+  Int_t effVars[4];
+  effVars[0] = efficiency->GetAxis(0)->FindBin(eta);
+  effVars[1] = efficiency->GetAxis(1)->FindBin(pt); //pt
+  effVars[2] = efficiency->GetAxis(2)->FindBin(centrality); //centrality
+  effVars[3] = efficiency->GetAxis(3)->FindBin(zVtx); //zVtx
+  return efficiency->GetBinContent(effVars);
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillPairsFromSnapshot(Int_t i, Bool_t mixed, Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Float_t weight, Bool_t fillpT, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue, TH1* triggerWeighting)
+{
+  // fills all pairs of trigger particle <i> with the associated particles from the snapshots filled by FillTrackSnapshot
+  // this is the same pair selection as in the loop in FillCorrelations without the virtual calls per pair
+  
+  const TrackSnapshot& trig = fTriggerSnapshot;
+  const TrackSnapshot& assoc = fAssociatedSnapshot;
+  const Int_t jMax = assoc.fPt.size();
+  if (jMax == 0)
+    return;
+  
+  const Float_t triggerEta = trig.fEta[i];
+  const Double_t triggerPt = trig.fPt[i];
+  const Double_t triggerPhi = trig.fPhi[i];
+  const Short_t triggerCharge = trig.fCharge[i];
+  
+  // delta eta and delta phi for all associated particles in one go (no dependencies between iterations, can be vectorized)
+  Float_t* deta = &fPairDEta[0];
+  Double_t* dphi = &fPairDPhi[0];
+  const Float_t* assocEta = &assoc.fEta[0];
+  const Double_t* assocPhi = &assoc.fPhi[0];
+  const Double_t kOneHalfPi = 1.5 * TMath::Pi();
+  const Double_t kMinusHalfPi = -0.5 * TMath::Pi();
+  const Double_t kTwoPi = TMath::TwoPi();
+  for (Int_t j=0; j<jMax; j++)
+  {
+    deta[j] = triggerEta - assocEta[j];
+    Double_t tmp = triggerPhi - assocPhi[j];
+    tmp = (tmp > kOneHalfPi) ? tmp - kTwoPi : tmp;
+    tmp = (tmp < kMinusHalfPi) ? tmp + kTwoPi : tmp;
+    dphi[j] = tmp;
+  }
+  
+  Double_t triggerFactor = trig.fEfficiency[i];
+  Double_t weightPerEvent = 1;
+  if (fWeightPerEvent)
+    weightPerEvent = triggerWeighting->GetBinContent(triggerWeighting->GetXaxis()->FindBin(triggerPt));
+  
+  // the accepted pairs are collected in columns and filled in one go with AliTHnBase::FillN
+  Double_t* vars[6];
+  for (Int_t k=0; k<6; k++)
+    vars[k] = &fPairColumns[k][0];
+  Double_t* weights = &fPairWeights[0];
+  Int_t nPairs = 0;
+  
+  for (Int_t j=0; j<jMax; j++)
+  {
+    if (!mixed && i == j)
+      continue;
+    
+    // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
+    if (fCheckEventNumberInCorrelation)
+    {
+      if (trig.fEventIndex[i] == assoc.fEventIndex[j])
+	continue;
+    }
+    else if (mixed && trig.fParticle[i]->IsEqual(assoc.fParticle[j]))
+      continue;
+    
+    const Double_t pt = assoc.fPt[j];
+    const Short_t charge = assoc.fCharge[j];
+    
+    if (fPtOrder)
+      if (pt >= triggerPt)
+	continue;
+    
+    if (fAssociatedSelectCharge != 0)
+      if (charge * fAssociatedSelectCharge < 0)
+	continue;
+    
+    if (fSelectCharge > 0)
+    {
+      // skip like sign
+      if (fSelectCharge == 1 && charge * triggerCharge > 0)
+	continue;
+	
+      // skip unlike sign
+      if (fSelectCharge == 2 && charge * triggerCharge < 0)
+	continue;
+    }
+    
+    if (fOnlyOneAssocEtaSide != 0)
+      if (fOnlyOneAssocEtaSide * assocEta[j] < 0)
+	continue;
+    
+    if (fEtaOrdering)
+    {
+      if (triggerEta < 0 && assocEta[j] < triggerEta)
+	continue;
+      if (triggerEta > 0 && assocEta[j] > triggerEta)
+	continue;
+    }
+    
+    if (assoc.fFlagged[j])
+      continue;
+    
+    if ((fCutConversionsV > 0 || fCutResonancesV > 0) && charge * triggerCharge < 0)
+      if (RejectResonancePair(triggerPt, triggerEta, triggerPhi, pt, assocEta[j], assocPhi[j]))
+	continue;
+    
+    if (twoTrackEfficiencyCut)
+      if (RejectTwoTrackPair(deta[j], triggerPhi, triggerPt, triggerCharge, assocPhi[j], pt, charge, bSign, twoTrackEfficiencyCutValue))
+	continue;
+    
+    vars[0][nPairs] = deta[j];
+    vars[1][nPairs] = pt;
+    vars[2][nPairs] = triggerPt;
+    vars[3][nPairs] = centrality;
+    vars[4][nPairs] = dphi[j];
+    vars[5][nPairs] = zVtx;
+    
+    if (fillpT)
+      weight = pt;
+    
+    // same order of operations as in FillCorrelations, a factor 1 does not change the result
+    Double_t useWeight = weight;
+    useWeight *= assoc.fEfficiency[j];
+    useWeight *= triggerFactor;
+    
+    if (fWeightPerEvent)
+      useWeight /= weightPerEvent;
+    
+    weights[nPairs++] = useWeight;
+  }
+  
+  // fill all in toward region and do not use the other regions
+  AliTHnBase::FillContainerN(fNumberDensityPhi->GetTrackHist(AliUEHist::kToward), nPairs, vars, step, weights);
+}
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::RejectResonancePair(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2)
+{
+  // returns kTRUE if the unlike-sign pair is compatible with a conversion or a resonance decay (see SetPairCuts)
+  
+  // conversions
+  if (fCutConversionsV > 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.510e-3, 0.510e-3);
+    
+    if (mass < fCutConversionsV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.510e-3, 0.510e-3);
+      
+      fControlConvResoncances->Fill(0.0, mass);
+
+      if (mass < fCutConversionsV*fCutConversionsV) 
+        return kTRUE;
+    }
+  }
+  
+  // K0s
+  if (fCutResonancesV > 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+    
+    const Float_t kK0smass = 0.4976;
+    
+    if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+      
+      fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
+
+      if (mass > (kK0smass-fCutResonancesV)*(kK0smass-fCutResonancesV) && mass < (kK0smass+fCutResonancesV)*(kK0smass+fCutResonancesV))
+        return kTRUE;
+    }
+  }
+
+  // Lambda
+  if (fCutResonancesV > 0)
+  {
+    Float_t mass1 = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.9383);
+    Float_t mass2 = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.9383, 0.1396);
+    
+    const Float_t kLambdaMass = 1.115;
+
+    if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
+    {
+      mass1 = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.9383);
+
+      fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
+      
+      if (mass1 > (kLambdaMass-fCutResonancesV)*(kLambdaMass-fCutResonancesV) && mass1 < (kLambdaMass+fCutResonancesV)*(kLambdaMass+fCutResonancesV))
+        return kTRUE;
+    }
+    if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
+    {
+      mass2 = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.9383, 0.1396);
+
+      fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
+
+      if (mass2 > (kLambdaMass-fCutResonancesV)*(kLambdaMass-fCutResonancesV) && mass2 < (kLambdaMass+fCutResonancesV)*(kLambdaMass+fCutResonancesV))
+        return kTRUE;
+    }
+  }
+
+  // Phi
+  if (fCutOnPhi)
+  {
+    if (fCutResonancesV > 0)
+    {
+      Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.4937, 0.4937);
+
+      const Float_t kPhimass = 1.019;
+
+      if (TMath::Abs(mass - kPhimass*kPhimass) < fCutResonancesV * 5)
+      {
+        mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.4937, 0.4937);
+
+        fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
+
+        if (mass > (kPhimass-fCutResonancesV)*(kPhimass-fCutResonancesV) && mass < (kPhimass+fCutResonancesV)*(kPhimass+fCutResonancesV))
+          return kTRUE;
+      }
+    }
+  }       
+
+  // Rho
+  if (fCutOnRho)
+  {
+    if (fCutResonancesV > 0)
+    {
+      Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+
+      const Float_t kRhomass = 0.770;
+
+      if (TMath::Abs(mass - kRhomass*kRhomass) < fCutResonancesV * 5)
+      {
+        mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+
+        fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
+
+        if (mass > (kRhomass-fCutResonancesV)*(kRhomass-fCutResonancesV) && mass < (kRhomass+fCutResonancesV)*(kRhomass+fCutResonancesV))
+          return kTRUE;
+      }
+    }
+  }
+  
+  return kFALSE;
+}
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::RejectTwoTrackPair(Float_t deta, Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign, Float_t twoTrackEfficiencyCutValue)
+{
+  // returns kTRUE if the pair is removed by the two-track efficiency cut
+  //
+  // the variables & cut have been developed by the HBT group 
+  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
+
+  // optimization
+  if (!(TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3))
+    return kFALSE;
+  
+  // check first boundaries to see if is worth to loop and find the minimum
+  Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
+  Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
+  
+  const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
+
+  if (!(TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0))
+    return kFALSE;
+  
+  Float_t dphistarminabs = 1e5;
+  Float_t dphistarmin = 1e5;
+  for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+  {
+    Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
+
+    Float_t dphistarabs = TMath::Abs(dphistar);
+    
+    if (dphistarabs < dphistarminabs)
+    {
+      dphistarmin = dphistar;
+      dphistarminabs = dphistarabs;
+    }
+  }
+  
+  fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+  
+  if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
+  {
+//     Printf("Removed track pair with %f %f %f %f %f %f %f %f %f", deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+    return kTRUE;
+  }
+
+  fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+  
+  return kFALSE;
+}
   
 //____________________________________________________________________
 void AliUEHistograms::FillTrackingEfficiency(TObjArray* mc, TObjArray* recoPrim, TObjArray* recoAll, TObjArray* recoPrimPID, TObjArray* recoAllPID, TObjArray* fake, Int_t particleType, Double_t centrality, Double_t zVtx)
@@ -1345,6 +1553,7 @@ void AliUEHistograms::Copy(TObject& c) const
   target.fPtOrder = fPtOrder;
   target.fTwoTrackCutMinRadius = fTwoTrackCutMinRadius;
   target.fCheckEventNumberInCorrelation = fCheckEventNumberInCorrelation;
+  target.fUseTrackSnapshot = fUseTrackSnapshot;
 }
 
 //____________________________________________________________________
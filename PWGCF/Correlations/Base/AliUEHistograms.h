@@ -12,10 +12,12 @@
 #include "AliUEHist.h"
 #include "TMath.h"
 #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
+#include <vector>
 
 class AliVParticle;
 
 class TList;
+class TH1;
 class TSeqCollection;
 class TObjArray;
 class TH1F;
@@ -100,6 +102,7 @@ class AliUEHistograms : public TNamed
   void SetTwoTrackCutMinRadius(Float_t min) { fTwoTrackCutMinRadius = min; }
 
   void SetCheckEventNumberInCorrelation(Bool_t val) { fCheckEventNumberInCorrelation = val; }
+  void SetUseTrackSnapshot(Bool_t flag) { fUseTrackSnapshot = flag; }
   void ExtendTrackingEfficiency(Bool_t verbose = kFALSE);
   void Reset();
 
@@ -111,6 +114,26 @@ class AliUEHistograms : public TNamed
   void Scale(Double_t factor);
   
 protected:
+  // structure-of-arrays copy of a list of particles, filled once per call of FillCorrelations (see SetUseTrackSnapshot)
+  struct TrackSnapshot
+  {
+    void Resize(Int_t n) { fParticle.resize(n); fPt.resize(n); fEta.resize(n); fPhi.resize(n); fCharge.resize(n); fFlagged.resize(n); fEventIndex.resize(n); fEfficiency.resize(n); }
+    
+    std::vector<AliVParticle*> fParticle; // original particle (only needed for IsEqual in mixed events)
+    std::vector<Double_t> fPt;           // pT
+    std::vector<Float_t> fEta;           // eta (same precision as the eta cache in FillCorrelations)
+    std::vector<Double_t> fPhi;          // phi
+    std::vector<Short_t> fCharge;        // charge
+    std::vector<Bool_t> fFlagged;        // flagged as resonance daughter
+    std::vector<Long64_t> fEventIndex;   // event index (only if fCheckEventNumberInCorrelation)
+    std::vector<Double_t> fEfficiency;   // multiplicative efficiency correction (1 if not applied)
+  };
+  
+  void FillTrackSnapshot(TrackSnapshot& snapshot, TObjArray* tracks, THnF* efficiency, Double_t centrality, Float_t zVtx, UInt_t flagBit);
+  Double_t GetEfficiencyCorrection(THnF* efficiency, Float_t eta, Double_t pt, Double_t centrality, Float_t zVtx);
+  void FillPairsFromSnapshot(Int_t i, Bool_t mixed, Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Float_t weight, Bool_t fillpT, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue, TH1* triggerWeighting);
+  Bool_t RejectResonancePair(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2);
+  Bool_t RejectTwoTrackPair(Float_t deta, Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign, Float_t twoTrackEfficiencyCutValue);
   void FillRegion(AliUEHist::Region region, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* list, Int_t multiplicity);
   Int_t CountParticles(TList* list, Float_t ptMin);
   void DeleteContainers();
@@ -166,12 +189,21 @@ protected:
   Float_t fTwoTrackCutMinRadius; // min radius for TTR cut
 
   Bool_t fCheckEventNumberInCorrelation; // do not correlate two particles from the same event (only works for AliBasicParticles)
+  Bool_t fUseTrackSnapshot;      // run the pair loop in FillCorrelations on structure-of-arrays copies of the particle lists (same output, no virtual calls per pair)
+
+  TrackSnapshot fTriggerSnapshot;     //! snapshot of the trigger particles
+  TrackSnapshot fAssociatedSnapshot;  //! snapshot of the associated particles
+  std::vector<Float_t> fPairDEta;     //! delta eta of the current trigger particle with all associated particles
+  std::vector<Double_t> fPairDPhi;    //! delta phi of the current trigger particle with all associated particles
+  std::vector<Double_t> fPairColumns[6]; //! variables of the accepted pairs of the current trigger particle (one vector per axis of the track container)
+  std::vector<Double_t> fPairWeights; //! weights of the accepted pairs of the current trigger particle
+  std::vector<Double_t> fAssociatedEfficiency; //! efficiency correction of the associated particles of the current event (FillCorrelations without snapshot)
 
   Long64_t fRunNumber;           // run number that has been processed
   
   Int_t fMergeCount;		// counts how many objects have been merged together
   
-  ClassDef(AliUEHistograms, 31)  // underlying event histogram container
+  ClassDef(AliUEHistograms, 33)  // underlying event histogram container
 };
 
 Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
@@ -11,5 +11,7 @@
 #pragma link C++ class AliCFTreeMapping+;
 #pragma link C++ class AliAnalysisTaskCFTree+;
 #pragma link C++ class AliTwoPlusOneContainer+;
+#pragma link C++ class AliPackedEventPool+;
+#pragma link C++ class AliPackedEventPoolManager+;
 
 #endif
@@ -1005,7 +1005,7 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
   int    k1,k2;
   int    iPhi, iEta, iEtaPhi, iPt, charge;
   float  q, phi, pt, eta, corr, corrPt, px, py, pz, dedx;
-  int    ij;
+  int    ij, ij_1, iPtPt_1;
   int    id_1, q_1, iEtaPhi_1, iPt_1;
   float  pt_1, px_1, py_1, pz_1, corr_1, dedx_1;
   int    id_2, q_2, iEtaPhi_2, iPt_2;
@@ -1412,7 +1412,8 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 	      iPt_1     = _iPt_1[i1];          ////cout << "      iPt_1:" << iPt_1 << endl;
 	      corr_1    = _correction_1[i1];   ////cout << "     corr_1:" << corr_1 << endl;
 	      pt_1      = _pt_1[i1];           ////cout << "       pt_1:" << pt_1 << endl;
-	      dedx_1    = _dedx_1[i1];         ////cout << "     dedx_1:" << dedx_1 << endl;
+	      ij_1      = iEtaPhi_1*_nBins_etaPhi_1;
+	      iPtPt_1   = iPt_1*_nBins_pt_2;
 	      //1 and 2
 	      for (int i2=i1+1; i2<k1; i2++)
 		{        
@@ -1425,11 +1426,10 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 		      iPt_2     = _iPt_1[i2];        ////cout << "      iPt_1:" << iPt_1 << endl;
 		      corr_2    = _correction_1[i2]; ////cout << "     corr_1:" << corr_1 << endl;
 		      pt_2      = _pt_1[i2];         ////cout << "       pt_1:" << pt_1 << endl;
-		      dedx_2    = _dedx_1[i2];       ////cout << "     dedx_2:" << dedx_2 << endl;
 		      corr      = corr_1*corr_2;
 		      if (q_2>q_1 || (q_1>0 && q_2>0 && pt_2<=pt_1) || (q_1<0 && q_2<0 && pt_2>=pt_1))
 			{
-			  ij = iEtaPhi_1*_nBins_etaPhi_1 + iEtaPhi_2;   ////cout << " ij:" << ij<< endl;
+			  ij = ij_1 + iEtaPhi_2;   ////cout << " ij:" << ij<< endl;
 			}
 		      else // swap particles
 			{
@@ -1445,7 +1445,7 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 		      __s2ptpt_12_vsEtaPhi[ij] += corr*ptpt;
 		      __s2PtN_12_vsEtaPhi[ij]  += corr*pt_1;
 		      __s2NPt_12_vsEtaPhi[ij]  += corr*pt_2;
-		      __n2_12_vsPtPt[iPt_1*_nBins_pt_2 + iPt_2] += corr;
+		      __n2_12_vsPtPt[iPtPt_1 + iPt_2] += corr;
 		      
 		      __n2Nw_12                  += 1;
 		      __s2ptptNw_12              += ptpt;
@@ -1467,7 +1467,8 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 	      iPt_1     = _iPt_1[i1];          ////cout << "      iPt_1:" << iPt_1 << endl;
 	      corr_1    = _correction_1[i1];   ////cout << "     corr_1:" << corr_1 << endl;
 	      pt_1      = _pt_1[i1];           ////cout << "       pt_1:" << pt_1 << endl;
-	      dedx_1    = _dedx_1[i1];         ////cout << "     dedx_1:" << dedx_1 << endl;
+	      ij_1      = iEtaPhi_1*_nBins_etaPhi_1;
+	      iPtPt_1   = iPt_1*_nBins_pt_2;
 	      //1 and 2
 	      for (int i2=i1+1; i2<k1; i2++)
 		{        
@@ -1480,11 +1481,10 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 		      iPt_2     = _iPt_1[i2];        ////cout << "      iPt_2:" << iPt_2 << endl;
 		      corr_2    = _correction_1[i2]; ////cout << "     corr_2:" << corr_2 << endl;
 		      pt_2      = _pt_1[i2];         ////cout << "       pt_2:" << pt_2 << endl;
-		      dedx_2    = _dedx_1[i2];       ////cout << "     dedx_2:" << dedx_2 << endl;
 		      corr      = corr_1*corr_2;
 		      if ( q_2<q_1 || (q_1>0 && q_2>0 && pt_2>=pt_1) || (q_1<0 && q_2<0 && pt_2<=pt_1))
 			{
-			  ij = iEtaPhi_1*_nBins_etaPhi_1 + iEtaPhi_2;   ////cout << " ij:" << ij<< endl;
+			  ij = ij_1 + iEtaPhi_2;   ////cout << " ij:" << ij<< endl;
 			}
 		      else // swap particles
 			{
@@ -1500,7 +1500,7 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 		      __s2ptpt_12_vsEtaPhi[ij] += corr*ptpt;
 		      __s2PtN_12_vsEtaPhi[ij]  += corr*pt_1;
 		      __s2NPt_12_vsEtaPhi[ij]  += corr*pt_2;
-		      __n2_12_vsPtPt[iPt_1*_nBins_pt_2 + iPt_2] += corr;
+		      __n2_12_vsPtPt[iPtPt_1 + iPt_2] += corr;
 		      
 		      __n2Nw_12                  += 1;
 		      __s2ptptNw_12              += ptpt;
@@ -1538,6 +1538,8 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 	      py_1      = _py_1[i1];          ////cout << "      py_1:" << py_1 << endl;
 	      pz_1      = _pz_1[i1];          ////cout << "      pz_1:" << pz_1 << endl;
 	      dedx_1    = _dedx_1[i1];        ////cout << "     dedx_1:" << dedx_1 << endl;
+	      ij_1      = iEtaPhi_1*_nBins_etaPhi_1;
+	      iPtPt_1   = iPt_1*_nBins_pt_2;
 	      
 	      //1 and 2
 	      for (int i2=0; i2<k2; i2++)
@@ -1575,7 +1577,7 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 			}
 		      
 		      corr      = corr_1*corr_2;
-		      ij        = iEtaPhi_1*_nBins_etaPhi_1 + iEtaPhi_2;   ////cout << " ij:" << ij<< endl;
+		      ij        = ij_1 + iEtaPhi_2;   ////cout << " ij:" << ij<< endl;
 		      __n2_12                  += corr;
 		      __n2_12_vsEtaPhi[ij]     += corr;
 		      ptpt                     = pt_1*pt_2;
@@ -1585,7 +1587,7 @@ void  AliAnalysisTaskDptDptCorrelations::UserExec(Option_t */*option*/)
 		      __s2ptpt_12_vsEtaPhi[ij] += corr*ptpt;
 		      __s2PtN_12_vsEtaPhi[ij]  += corr*pt_1;
 		      __s2NPt_12_vsEtaPhi[ij]  += corr*pt_2;
-		      __n2_12_vsPtPt[iPt_1*_nBins_pt_2 + iPt_2] += corr;         
+		      __n2_12_vsPtPt[iPtPt_1 + iPt_2] += corr;         
 		      __n2Nw_12                  += 1;
 		      __s2ptptNw_12              += ptpt;
 		      __s2PtNNw_12               += pt_1;
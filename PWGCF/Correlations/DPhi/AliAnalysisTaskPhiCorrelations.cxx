@@ -55,6 +55,7 @@
 #include "AliGenHepMCEventHeader.h"
 
 #include "AliEventPoolManager.h"
+#include "AliPackedEventPoolManager.h"
 #include "AliBasicParticle.h"
 #include "AliVHeader.h"
 
@@ -132,6 +133,7 @@ fInputHandler(0x0),
 fMcEvent(0x0),
 fMcHandler(0x0),
 fPoolMgr(0x0),
+fPackedPoolMgr(0x0),
 // histogram settings
 fListOfHistos(0x0), 
 // event QA
@@ -199,7 +201,8 @@ fCustomParticlesA(""),
 fCustomParticlesB(""),
 fEventPoolOutputList(),
 fUsePtBinnedEventPool(0),
-fCheckEventNumberInMixedEvent(kFALSE)
+fCheckEventNumberInMixedEvent(kFALSE),
+fUsePackedEventPool(kFALSE)
 {
   // Default constructor
   // Define input and output slots here
@@ -476,6 +479,17 @@ void  AliAnalysisTaskPhiCorrelations::CreateOutputObjects()
       ptbins = (Double_t*) fHistos->GetUEHist(2)->GetTrackHist(AliUEHist::kToward)->GetAxis(1, 0)->GetXbins()->GetArray();
     }
 
+  // Packed event pools: same binning and target values as the default pool manager, but without one object per stored track
+  if (fUsePackedEventPool)
+  {
+    if (fPoolMgr || fEventPoolOutputList.size())
+      AliFatal("Packed event pools cannot be combined with an external pool manager or with saving pools to the output");
+
+    fPackedPoolMgr = new AliPackedEventPoolManager(poolsize, fMixingTracks, nCentralityBins, centralityBins, nZvtxBins, zvtxbin, nPsiBins, psibins, nPtBins, ptbins);
+    fPackedPoolMgr->SetTargetValues(fMixingTracks, 0.1, 5);
+    return;
+  }
+
   // Create default event pool in case no external pool is given
   if(!fPoolMgr)
   {
@@ -802,6 +816,22 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
   // mixed event
   if (fFillMixed)
   {
+    if (fPackedPoolMgr)
+    {
+      for(Int_t iPool=0; iPool<fPackedPoolMgr->GetNumberOfPtBins(); iPool++)
+      {
+        AliPackedEventPool* pool = fPackedPoolMgr->GetEventPool(centrality, zVtx, 0., iPool);
+        if (fFillOnlyStep0) {
+          ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, pool->NTracksInPool());
+          ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, pool->GetCurrentNEvents());
+        }
+        if (pool->IsReady())
+          for (Int_t jMix=0; jMix<pool->GetCurrentNEvents(); jMix++) 
+            fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepAll, tracksMC, pool->GetEvent(jMix), 1.0 / pool->GetCurrentNEvents(), (jMix == 0));
+        pool->UpdatePool(tracksCorrelateMC, fFillCorrelationsRapidity);
+      }
+    }
+    else
     for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
     {
       AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx, 0., iPool);
@@ -918,6 +948,18 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
       // mixed event
       if (fFillMixed)
       {
+        if (fPackedPoolMgr)
+        {
+          for(Int_t iPool=0; iPool<fPackedPoolMgr->GetNumberOfPtBins(); iPool++)
+          {
+            AliPackedEventPool* pool = fPackedPoolMgr->GetEventPool(centrality, zVtx + 200, 0., iPool);
+            if (pool->IsReady())
+              for (Int_t jMix=0; jMix<pool->GetCurrentNEvents(); jMix++) 
+                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTrackedOnlyPrim, tracksRecoMatchedPrim, pool->GetEvent(jMix), 1.0 / pool->GetCurrentNEvents(), (jMix == 0));
+            pool->UpdatePool(tracksCorrelateRecoMatchedPrim, fFillCorrelationsRapidity);
+          }
+        }
+        else
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
           AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx + 200, 0., iPool);
@@ -952,6 +994,18 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
       // mixed event
       if (fFillMixed)
       {
+        if (fPackedPoolMgr)
+        {
+          for(Int_t iPool=0; iPool<fPackedPoolMgr->GetNumberOfPtBins(); iPool++)
+          {
+            AliPackedEventPool* pool = fPackedPoolMgr->GetEventPool(centrality, zVtx + 300, 0., iPool);
+            if (pool->IsReady())
+              for (Int_t jMix=0; jMix<pool->GetCurrentNEvents(); jMix++) 
+                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTracked, tracksRecoMatchedAll, pool->GetEvent(jMix), 1.0 / pool->GetCurrentNEvents(), (jMix == 0));
+            pool->UpdatePool(tracksCorrelateRecoMatchedAll, fFillCorrelationsRapidity);
+          }
+        }
+        else
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
           AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx + 300, 0., iPool);
@@ -1000,6 +1054,39 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
       // mixed event
       if (fFillMixed)
       {
+        if (fPackedPoolMgr)
+        {
+          for(Int_t iPool=0; iPool<fPackedPoolMgr->GetNumberOfPtBins(); iPool++)
+          {
+            AliPackedEventPool* pool2 = fPackedPoolMgr->GetEventPool(centrality, zVtx + 100, 0., iPool);
+            ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, pool2->NTracksInPool());
+            ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, pool2->GetCurrentNEvents());
+            if (pool2->IsReady())
+            {
+              for (Int_t jMix=0; jMix<pool2->GetCurrentNEvents(); jMix++)
+              {
+                // STEP 6
+                if (!fSkipStep6)
+                  fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracks, pool2->GetEvent(jMix), 1.0 / pool2->GetCurrentNEvents(), (jMix == 0));
+              
+                // two track cut, STEP 8
+                if (fTwoTrackEfficiencyCut > 0)
+                  fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepBiasStudy, tracks, pool2->GetEvent(jMix), 1.0 / pool2->GetCurrentNEvents(), (jMix == 0), kTRUE, bSign, fTwoTrackEfficiencyCut);
+              
+                // apply correction efficiency, STEP 10
+                if (fEfficiencyCorrectionTriggers || fEfficiencyCorrectionAssociated)
+                {
+                  // with or without two track efficiency depending on if fTwoTrackEfficiencyCut is set
+                  Bool_t twoTrackCut = (fTwoTrackEfficiencyCut > 0);
+                
+                  fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepCorrected, tracks, pool2->GetEvent(jMix), 1.0 / pool2->GetCurrentNEvents(), (jMix == 0), twoTrackCut, bSign, fTwoTrackEfficiencyCut, kTRUE);
+                }
+              }
+            }
+            pool2->UpdatePool(tracksCorrelate, fFillCorrelationsRapidity);
+          }
+        }
+        else
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
           AliEventPool* pool2 = fPoolMgr->GetEventPool(centrality, zVtx + 100, 0., iPool);
@@ -1381,6 +1468,42 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseDataMode()
     //    FillCorrelations(). Also nMix should be passed in, so a weight
     //    of 1./nMix can be applied.
 
+    if (fPackedPoolMgr)
+    {
+      for(Int_t iPool=0; iPool<fPackedPoolMgr->GetNumberOfPtBins(); iPool++)
+      {
+        AliPackedEventPool* pool = fPackedPoolMgr->GetEventPool(centrality, zVtx, 0., iPool);
+      
+        if (!pool)
+          AliFatal(Form("No pool found for centrality = %f, zVtx = %f", centrality, zVtx));
+      
+        if (pool->IsReady()) 
+        {
+          Int_t nMix = pool->GetCurrentNEvents();
+        
+          ((TH1F*) fListOfHistos->FindObject("eventStat"))->Fill(2);
+          ((TH1F*) fListOfHistos->FindObject("eventStat"))->Fill(3, nMix);
+          ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, pool->NTracksInPool());
+          ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, nMix);
+      
+          // Fill mixed-event histos here  
+          for (Int_t jMix=0; jMix<nMix; jMix++) 
+          {
+            TObjArray* bgTracks = pool->GetEvent(jMix);
+        
+            if (!fSkipStep6)
+              fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracksClone, bgTracks, 1.0 / nMix, (jMix == 0), kFALSE, 0, 0.02, kTRUE);
+
+            if (fTwoTrackEfficiencyCut > 0)
+              fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepBiasStudy, tracksClone, bgTracks, 1.0 / nMix, (jMix == 0), kTRUE, bSign, fTwoTrackEfficiencyCut, kTRUE);
+          }
+        }
+      
+        // the tracks are copied into the packed storage of the pool
+        pool->UpdatePool((tracksCorrelate) ? tracksCorrelate : tracksClone, fFillCorrelationsRapidity);
+      }
+    }
+    else
     for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
     {
       AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx, 0., iPool);
@@ -2174,5 +2297,8 @@ void AliAnalysisTaskPhiCorrelations::AddEventPoolsToOutput(Double_t minCent, Dou
 void AliAnalysisTaskPhiCorrelations::FinishTaskOutput()
 {
   // Clear unnecessary pools before saving
-  fPoolMgr->ClearPools();
+  if (fPackedPoolMgr)
+    fPackedPoolMgr->ClearPools();
+  else
+    fPoolMgr->ClearPools();
 }
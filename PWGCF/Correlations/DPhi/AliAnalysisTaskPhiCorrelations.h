@@ -42,6 +42,7 @@ class AliUEHistograms;
 class TH1;
 class TObjArray;
 class AliEventPoolManager;
+class AliPackedEventPoolManager;
 class AliESDEvent;
 class AliHelperPID;
 class AliAnalysisUtils;
@@ -179,6 +180,7 @@ public:
   AliEventPoolManager* GetEventPoolManager() {return fPoolMgr;}
   void SetUsePtBinnedEventPool(Bool_t val) {fUsePtBinnedEventPool = val;}
   void SetCheckEventNumberInMixedEvent(Bool_t val) {fCheckEventNumberInMixedEvent = val;}
+  void SetUsePackedEventPool(Bool_t val) {fUsePackedEventPool = val;}
 
   // Set which pools will be saved
   void AddEventPoolsToOutput(Double_t minCent, Double_t maxCent,  Double_t minZvtx, Double_t maxZvtx, Double_t minPt, Double_t maxPt);
@@ -247,6 +249,7 @@ private:
   AliMCEvent*              fMcEvent;         //! MC event
   AliInputEventHandler*    fMcHandler;       //! MCEventHandler
   AliEventPoolManager*     fPoolMgr;         // event pool manager
+  AliPackedEventPoolManager* fPackedPoolMgr; //! event pool manager with packed track storage (if fUsePackedEventPool)
 
   // Histogram settings
   TList*              fListOfHistos;    //  Output list of containers
@@ -328,8 +331,9 @@ private:
   vector<vector<Double_t> >   fEventPoolOutputList; // vector representing a list of pools (given by value range) that will be saved
   Bool_t                      fUsePtBinnedEventPool; // uses event pool in pt bins
   Bool_t                      fCheckEventNumberInMixedEvent; // check event number before correlation in mixed event
+  Bool_t                      fUsePackedEventPool; // store the mixed events in AliPackedEventPoolManager (one contiguous buffer per pool) instead of AliEventPoolManager
 
-  ClassDef(AliAnalysisTaskPhiCorrelations, 62); // Analysis task for delta phi correlations
+  ClassDef(AliAnalysisTaskPhiCorrelations, 63); // Analysis task for delta phi correlations
 };
 
 #endif
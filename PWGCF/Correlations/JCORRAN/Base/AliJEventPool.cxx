@@ -106,18 +106,19 @@ void AliJEventPool::Mix( TClonesArray *triggList,
 
     for(int backCounter=0; backCounter <= flastAccepted[cBin]; backCounter++){
         fpoolList = fLists [cBin] [backCounter];
-        noAssoc = fpoolList->GetEntries();
+        noAssoc = fpoolList->GetEntriesFast(); // filled without holes in AcceptList
 
         if(noAssoc<=0) continue;
 
         //mixit=======
         fnoMix[cBin]++;
         
+        // cheapest checks first
         if( 
+                fevent[cBin][backCounter] != iev &&
+                fZVertexBin[cBin][backCounter]==zBin      &&
                 fcard->SimilarCentrality(fcentrality[cBin][backCounter], cent, cBin) &&
-                fcard->SimilarMultiplicity(fmult[cBin][backCounter], thisMult) &&
-                fcard->GetBin(kZVertType, fZVertex[cBin][backCounter])==zBin      &&
-                fevent[cBin][backCounter] != iev )
+                fcard->SimilarMultiplicity(fmult[cBin][backCounter], thisMult) )
         {
             fnoMixCut[cBin]++;
             //=================================================
@@ -126,9 +127,10 @@ void AliJEventPool::Mix( TClonesArray *triggList,
             for(int ii=0;ii<noTrigg;ii++){
                 AliJBaseTrack *ftk1 = (AliJBaseTrack*)triggList->At(ii);        
                 //fhistos->fhTriggPtBin[kMixed][cBin][iptt]->Fill(ptt); //who needs that?
+                const double ptt = leadingParticle ? ftk1->Pt() : 0;
                 for(int jj=0;jj<noAssoc ;jj++){
-                    AliJBaseTrack *ftk2 = (AliJBaseTrack*)fpoolList->At(jj);
-                    if(leadingParticle && ftk1->Pt() < ftk2->Pt()) continue; // In leading particle correlations, accept only those associated particles whose pT is lower than that of the trigger
+                    AliJBaseTrack *ftk2 = (AliJBaseTrack*)fpoolList->UncheckedAt(jj);
+                    if(leadingParticle && ptt < ftk2->Pt()) continue; // In leading particle correlations, accept only those associated particles whose pT is lower than that of the trigger
                     fcorrelations->FillHisto(cFTyp,kMixed, cBin, zBin, ftk1, ftk2);
                 } //inner loop mixing
             }//outer loop mixing
@@ -150,6 +152,7 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
     if( fwhereToStore[cBin] >= fcard->GetEventPoolDepth(cBin) ) fwhereToStore[cBin] = 0;
     fevent     [cBin][fwhereToStore[cBin]] = iev;
     fZVertex   [cBin][fwhereToStore[cBin]] = Z;
+    fZVertexBin[cBin][fwhereToStore[cBin]] = fcard->GetBin(kZVertType, Z);
     fcentrality[cBin][fwhereToStore[cBin]] = cent;
     fmult      [cBin][fwhereToStore[cBin]] = inMult;
 
@@ -53,6 +53,7 @@ class AliJEventPool {
 
         int   fevent[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fZVertex[kMaxNoCentrBin][MAXNOEVENT];  // comment me
+        int   fZVertexBin[kMaxNoCentrBin][MAXNOEVENT];  // z-vertex bin of fZVertex, found when the event is stored
         float fcentrality[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fmult[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         long  flastAccepted[kMaxNoCentrBin];  // comment me
@@ -4,6 +4,7 @@
 #include <TMath.h>
 #include <TComplex.h>
 #include <TClonesArray.h>
+#include <vector>
 #include "AliJBaseTrack.h"
 #include "AliJFFlucAnalysis.h"
 //#include "AliJCorrelations.h"
@@ -666,13 +667,9 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		}
 
 		// calculate Qn for each pt bin
+		CalculateQn_pt(Eta_config, ptbin_borders, SCNH, QnA_pt, QnB_pt);
 		for(int ih=2; ih<SCNH; ih++){
 			for(int ipt=0; ipt<N_ptbins; ipt++){
-				Double_t pt_bin_min = ptbin_borders[ipt];
-				Double_t pt_bin_max = ptbin_borders[ipt+1];
-				QnA_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-				QnB_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-
 				QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ;
 			}
 		}
@@ -837,6 +834,72 @@ TComplex AliJFFlucAnalysis::Get_Qn_pt(Double_t eta1, Double_t eta2, int harmonic
 
 	return Qn;
 }
+//________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQn_pt(const double (*etaConfig)[2], const double *ptBorders, int nh, TComplex (*QnA)[N_ptbins], TComplex (*QnB)[N_ptbins])
+{
+	// Get_Qn_pt for the harmonics 2..nh-1, all pt bins and both eta ranges
+	// in a single track loop. The sums and the normalization are the same.
+	TComplex (*Qn[2])[N_ptbins] = {QnA, QnB};
+	Double_t Sub_Ntrk[2][N_ptbins];
+	for(int isub=0; isub<2; isub++){
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			Sub_Ntrk[isub][ipt] = 0;
+			for(int ih=2; ih<nh; ih++)
+				Qn[isub][ih][ipt] = TComplex(0,0);
+		}
+	}
+
+	std::vector<Double_t> cosnphi(nh), sinnphi(nh);
+	Long64_t ntracks = fInputList->GetEntriesFast();
+	for( Long64_t it = 0; it < ntracks; it++){
+		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+		Double_t eta = itrack->Eta();
+		bool inSub[2];
+		for(int isub=0; isub<2; isub++)
+			inSub[isub] = !(eta < etaConfig[isub][0] || eta > etaConfig[isub][1]);
+		if(!inSub[0] && !inSub[1])
+			continue;
+		Double_t pt = itrack->Pt();
+		if(pt < ptBorders[0] || pt > ptBorders[N_ptbins])
+			continue;
+		Double_t phi = itrack->Phi();
+		Double_t phi_module_corr = 1.0;
+		if(flags & FLUC_PHI_CORRECTION && pPhiWeights){
+			Double_t w = pPhiWeights->GetBinContent(
+				pPhiWeights->FindBin(phi,eta,fVertex[2]));
+			if(w > 1e-6)
+				phi_module_corr = w;
+		}
+		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
+
+		Double_t tf = 1.0/(phi_module_corr*effCorr);
+		for(int ih=2; ih<nh; ih++){
+			cosnphi[ih] = tf*TMath::Cos(ih*phi);
+			sinnphi[ih] = tf*TMath::Sin(ih*phi);
+		}
+		// the bin edges are inclusive on both sides, as in Get_Qn_pt
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			if(pt < ptBorders[ipt] || pt > ptBorders[ipt+1])
+				continue;
+			for(int isub=0; isub<2; isub++){
+				if(!inSub[isub])
+					continue;
+				for(int ih=2; ih<nh; ih++)
+					Qn[isub][ih][ipt] += TComplex(cosnphi[ih],sinnphi[ih]);
+				Sub_Ntrk[isub][ipt] += tf;
+			}
+		}
+	}
+
+	for(int isub=0; isub<2; isub++){
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			for(int ih=2; ih<nh; ih++)
+				Qn[isub][ih][ipt] /= Sub_Ntrk[isub][ipt];
+			if(nh > 2)
+				NSubTracks_pt[(int)(etaConfig[isub][0] > 0.0)][ipt] = Sub_Ntrk[isub][ipt];
+		}
+	}
+}
 ///________________________________________________________________________
 /* new Function for QC method
    Please see Generic Framwork from Ante
@@ -883,18 +946,20 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		}
 		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
 
+		Double_t trackWeight = 1.0/(phi_module_corr*effCorr);
+		bool inEtaGap = TMath::Abs(eta) > etamin;//fQC_eta_gap_half
 		for(int ih=0; ih<kNH; ih++){
+			Double_t cosnphi = TMath::Cos(ih*phi), sinnphi = TMath::Sin(ih*phi);
 			Double_t tf = 1.0;
-			TComplex q[nKL];
 			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
-				QvectorQC[ih][ik] += q[ik];
+				TComplex q(tf*cosnphi,tf*sinnphi);
+				QvectorQC[ih][ik] += q;
 
 				//this is for normalized SC ( denominator needs an eta gap )
-				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
-					QvectorQCeta10[isub][ih][ik] += q[ik];
+				if(inEtaGap)
+					QvectorQCeta10[isub][ih][ik] += q;
 
-				tf *= 1.0/(phi_module_corr*effCorr);
+				tf *= trackWeight;
 			}
 		}
 	} // track loop done.
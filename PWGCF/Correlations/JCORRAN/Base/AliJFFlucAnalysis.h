@@ -56,7 +56,9 @@ public:
 	
 	//TComplex CalculateQnSP( double eta1, double eta2, int harmonics);
 
+	enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 	TComplex Get_Qn_pt(double eta1, double eta2, int harmonics, int ipt, double pt_min, double pt_max);
+	void CalculateQn_pt(const double (*etaConfig)[2], const double *ptBorders, int nh, TComplex (*QnA)[N_ptbins], TComplex (*QnB)[N_ptbins]);
 	double Get_QC_Vn( double QnA_real, double QnA_img, double QnB_real, double QnB_img);
 	void Fill_QA_plot(double eta1, double eta2 );
 
@@ -164,7 +166,6 @@ private:
 	AliJTH2D fh_TrkQA_FB32_vs_FB32TOF;//!
 
 	// additional variables for ptbins(Standard Candles only)
-	enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 	double NSubTracks_pt[2][N_ptbins];
 	AliJBin fBin_Nptbins;//!
 	AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
@@ -269,6 +269,21 @@ void* AliJArrayBase::GetItem(){
     return item;
 }
 //_____________________________________________________
+int AliJArrayBase::DimFactor(int d){
+    return fAlg->DimFactor(d);
+}
+//_____________________________________________________
+void* AliJArrayBase::GetItemAt(int iG){
+    // item at the linear index, the lazy creation needs the matching Index()
+    void * item = fAlg->GetItemAt(iG);
+    if( !item ){
+        fAlg->SetPosition( &iG );
+        BuildItem() ;
+        item = fAlg->GetItemAt(iG);
+    }
+    return item;
+}
+//_____________________________________________________
 void* AliJArrayBase::GetSingleItem(){
     if(fMode == kSingle )return GetItem();
     JERROR("This is not single array");
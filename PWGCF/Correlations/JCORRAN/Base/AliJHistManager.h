@@ -158,6 +158,9 @@ class AliJArrayBase : public AliJNamed{
 
         void * GetItem();
         void * GetSingleItem();
+        // linear index iG = sum Index(d)*DimFactor(d), item at a linear index
+        int  DimFactor( int d );
+        void * GetItemAt( int iG );
 
         ///void LockBin(bool is=true){}//TODO
         //bool IsBinLocked(){ return fIsBinLocked; }
@@ -212,6 +215,8 @@ class AliJArrayAlgorithm {
         virtual void InitIterator()=0;
         virtual bool Next(void *& item) = 0;
         virtual void ** GetRawItem()=0;
+        virtual int DimFactor(int d)=0;
+        virtual void * GetItemAt(int iG)=0;
         virtual void * GetPosition()=0;
         virtual bool IsCurrentPosition(void * pos)=0;
         virtual void SetPosition(void * pos )=0;
@@ -234,6 +239,8 @@ class AliJArrayAlgorithmSimple : public AliJArrayAlgorithm {
         virtual void SetItem(void * item);
         virtual void InitIterator(){ fPos = 0; }
         virtual void ** GetRawItem(){ return &fArray[GlobalIndex()]; }
+        virtual int DimFactor(int d){ return fDimFactor[d]; }
+        virtual void * GetItemAt(int iG){ return fArray[iG]; }
         virtual bool Next(void *& item){
             item = fPos<GetEntries()?(void*)fArray[fPos]:NULL;
             if( fPos<GetEntries() ) ReverseIndex(fPos);
@@ -316,6 +323,9 @@ class AliJTH1Derived : public AliJTH1 {
         virtual ~AliJTH1Derived();
 
         AliJTH1DerivedPlayer<T> & operator[](int i){ fPlayer.Init();fPlayer[i];return fPlayer; }
+        // histogram at a linear index taken once from the player:
+        //   int iG = h[i][j].LinearIndex(); ... h.At(iG)->Fill(x);
+        T * At(int iG){ return static_cast<T*>(GetItemAt(iG)); }
         T * operator->(){ return static_cast<T*>(GetSingleItem()); }
         operator T*(){ return static_cast<T*>(GetSingleItem()); }
         // Virtual from AliJArrayBase
@@ -353,20 +363,23 @@ class AliJTH1Derived : public AliJTH1 {
 template< typename T>
 class AliJTH1DerivedPlayer {
     public:
-        AliJTH1DerivedPlayer( AliJTH1Derived<T> * cmd ):fLevel(0),fCMD(cmd){};
+        AliJTH1DerivedPlayer( AliJTH1Derived<T> * cmd ):fLevel(0),fOffset(0),fCMD(cmd){};
         AliJTH1DerivedPlayer<T>& operator[](int i){
             if( fLevel > fCMD->Dimension() ) { JERROR("Exceed Dimension"); }
             if( OutOf( i, 0,  fCMD->SizeOf(fLevel)-1) ){ JERROR(Form("wrong Index %d of %dth in ",i, fLevel)+fCMD->GetName()); }
+            fOffset += i*fCMD->DimFactor(fLevel);
             fCMD->SetIndex(i, fLevel++);
             return *this;
         }
-        void Init(){ fLevel=0;fCMD->ClearIndex(); }
-        T* operator->(){ return static_cast<T*>(fCMD->GetItem()); } 
-        operator T*(){ return static_cast<T*>(fCMD->GetItem()); } 
-        operator TObject*(){ return static_cast<TObject*>(fCMD->GetItem()); } 
-        operator TH1*(){ return static_cast<TH1*>(fCMD->GetItem()); } 
+        void Init(){ fLevel=0;fOffset=0;fCMD->ClearIndex(); }
+        int LinearIndex() const { return fOffset; }
+        T* operator->(){ return static_cast<T*>(fCMD->GetItemAt(fOffset)); } 
+        operator T*(){ return static_cast<T*>(fCMD->GetItemAt(fOffset)); } 
+        operator TObject*(){ return static_cast<TObject*>(fCMD->GetItemAt(fOffset)); } 
+        operator TH1*(){ return static_cast<TH1*>(fCMD->GetItemAt(fOffset)); } 
     private:
         int fLevel;
+        int fOffset; // linear index of the indices given so far
         AliJTH1Derived<T> * fCMD;
 };
 
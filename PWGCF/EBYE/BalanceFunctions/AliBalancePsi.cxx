@@ -33,6 +33,7 @@
 #include <TString.h>
 #include <TSpline.h>
 #include <TRandom3.h>
+#include <vector>
 
 #include "AliVParticle.h"
 #include "AliMCParticle.h"
@@ -48,6 +49,34 @@ using std::cerr;
 
 ClassImp(AliBalancePsi)
 
+namespace {
+  //____________________________________________________________________//
+  // pairs of one charge combination collected for one trigger particle,
+  // passed to AliTHn::FillN in the order they were found
+  class AliBalancePsiPairBuffer {
+  public:
+    void Reserve(Int_t n) {
+      for(Int_t i = 0; i < kTrackVariablesPair; i++) fColumns[i].reserve(n);
+      fWeights.reserve(n);
+    }
+    void Add(const Double_t *vars, Double_t weight) {
+      for(Int_t i = 0; i < kTrackVariablesPair; i++) fColumns[i].push_back(vars[i]);
+      fWeights.push_back(weight);
+    }
+    void Flush(AliTHn *hist) {
+      if(fWeights.empty()) return;
+      const Double_t *columns[kTrackVariablesPair];
+      for(Int_t i = 0; i < kTrackVariablesPair; i++) columns[i] = fColumns[i].data();
+      hist->FillN(fWeights.size(),columns,0,fWeights.data());
+      for(Int_t i = 0; i < kTrackVariablesPair; i++) fColumns[i].clear();
+      fWeights.clear();
+    }
+  private:
+    std::vector<Double_t> fColumns[kTrackVariablesPair];
+    std::vector<Double_t> fWeights;
+  };
+}
+
 //____________________________________________________________________//
 AliBalancePsi::AliBalancePsi() :
   TObject(), 
@@ -490,6 +519,13 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   Double_t gWidthForPhi = 0.004266;
   Double_t nSigmaRejection = 3.0;
 
+  // pairs of each charge combination, filled once per trigger particle
+  AliBalancePsiPairBuffer pairsPN, pairsNP, pairsPP, pairsNN;
+  pairsPN.Reserve(jMax);
+  pairsNP.Reserve(jMax);
+  pairsPP.Reserve(jMax);
+  pairsNN.Reserve(jMax);
+
   // 1st particle loop
   for (Int_t i = 0; i < iMax; i++) {
     //AliVParticle* firstParticle = (AliVParticle*) particles->At(i);
@@ -750,15 +786,21 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 
       }
 
-      if( charge1 > 0 && charge2 < 0)  fHistPN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]); //==========================correction
-      else if( charge1 < 0 && charge2 > 0)  fHistNP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
-      else if( charge1 > 0 && charge2 > 0)  fHistPP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
-      else if( charge1 < 0 && charge2 < 0)  fHistNN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
+      if( charge1 > 0 && charge2 < 0)  pairsPN.Add(trackVariablesPair,firstCorrection*secondCorrection[j]); //==========================correction
+      else if( charge1 < 0 && charge2 > 0)  pairsNP.Add(trackVariablesPair,firstCorrection*secondCorrection[j]);//==========================correction 
+      else if( charge1 > 0 && charge2 > 0)  pairsPP.Add(trackVariablesPair,firstCorrection*secondCorrection[j]);//==========================correction 
+      else if( charge1 < 0 && charge2 < 0)  pairsNN.Add(trackVariablesPair,firstCorrection*secondCorrection[j]);//==========================correction 
       else {
 	//AliWarning(Form("Wrong charge combination: charge1 = %d and charge2 = %d",charge,charge2));
 	continue;
       }
     }//end of 2nd particle loop
+
+    // bins found axis by axis for all pairs of this trigger
+    pairsPN.Flush(fHistPN);
+    pairsNP.Flush(fHistNP);
+    pairsPP.Flush(fHistPP);
+    pairsNN.Flush(fHistNN);
   }//end of 1st particle loop
 }  
 
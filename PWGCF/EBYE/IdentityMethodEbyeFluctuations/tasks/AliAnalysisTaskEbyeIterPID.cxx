@@ -4270,6 +4270,23 @@ void AliAnalysisTaskEbyeIterPID::SetCutBitsAndSomeTrackVariables(AliESDtrack *tr
 }
 //________________________________________________________________________
 Bool_t AliAnalysisTaskEbyeIterPID::GetSystematicClassIndex(UInt_t cut,Int_t syst)
+{
+  //
+  // true if all the cut bits required by the systematic class are set in cut.
+  // The masks of the classes filled per track are built only once
+  //
+  const Int_t nCachedClasses = 20;
+  static UInt_t cachedMask[nCachedClasses];
+  static Bool_t cachedMaskReady = kFALSE;
+  if (!cachedMaskReady){
+    for (Int_t i=0;i<nCachedClasses;i++) cachedMask[i] = GetSystematicClassMask(i);
+    cachedMaskReady = kTRUE;
+  }
+  const UInt_t mask = (syst>=0 && syst<nCachedClasses) ? cachedMask[syst] : GetSystematicClassMask(syst);
+  return (cut & mask) == mask;
+}
+//________________________________________________________________________
+UInt_t AliAnalysisTaskEbyeIterPID::GetSystematicClassMask(Int_t syst)
 {
   /*
   syst:
@@ -4442,12 +4459,11 @@ Bool_t AliAnalysisTaskEbyeIterPID::GetSystematicClassIndex(UInt_t cut,Int_t syst
 
   }
   //
-  //  Apply conditions
-  for (Int_t i=0;i<fnCutBins;i++){
-    if( ((cut >> fCutArr[i]) & 1) == 0 ) return kFALSE;
-  }
+  //  Bits required by the conditions
+  UInt_t mask = 0;
+  for (Int_t i=0;i<fnCutBins;i++) mask |= (1u << fCutArr[i]);
 
-  return kTRUE;
+  return mask;
 
 }
 //________________________________________________________________________
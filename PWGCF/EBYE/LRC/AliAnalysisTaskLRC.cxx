@@ -2097,6 +2097,23 @@ void AliAnalysisTaskLRC::FillLRCProcessors( int numberOfAcceptedTracksForLRC, Do
             break;
         }
         
+        //track data are the same for all processors: check and rotate them once per sector
+        Int_t lNumberOfTracks = numberOfAcceptedTracksForLRC;
+        for ( Int_t trackId = 0; trackId < numberOfAcceptedTracksForLRC; trackId++ )
+        {
+            if ( fEtInsteadOfPt && (fArrayTracksPt[trackId]  == 0 ) ) //in Et-mode we didn't get Et! exit
+            {
+                AliDebug(AliLog::kError, "pT=0 Mistake???" );
+                lNumberOfTracks = trackId;
+                break;
+            }
+            
+            //rotate track phi
+            Double_t lPhi = fArrayTracksPhi[trackId] + lPhiRotatedExtra;
+            FixAngleInTwoPi( lPhi );
+            fArrayTracksPhiRotated[trackId] = lPhi;
+        }
+        
         //pass signal to LRC-based analysis to start event
         for( Int_t lrcProcessorId = 0; lrcProcessorId < lLrcNum; lrcProcessorId++ )
         {
@@ -2109,35 +2126,19 @@ void AliAnalysisTaskLRC::FillLRCProcessors( int numberOfAcceptedTracksForLRC, Do
             lrcBase->StartEvent();
             //pass the centrality
             lrcBase->SetEventCentrality( eventCentrality );
-            //        }
             
             //pass track data to LRC-based analysis
-            for ( Int_t trackId = 0; trackId < numberOfAcceptedTracksForLRC; trackId++ )
+            for ( Int_t trackId = 0; trackId < lNumberOfTracks; trackId++ )
             {
-                if ( fEtInsteadOfPt && (fArrayTracksPt[trackId]  == 0 ) ) //in Et-mode we didn't get Et! exit
-                {
-                    AliDebug(AliLog::kError, "pT=0 Mistake???" );
-                    break;
-                }               //if ( fEtInsteadOfPt && lMostProbablePIDPure == -1 ) //don't have pure PID
-                //	continue;
-                
-                //rotate track phi
-                Double_t lPhi = fArrayTracksPhi[trackId] + lPhiRotatedExtra;
-                FixAngleInTwoPi( lPhi );
+                fHistPhiLRCrotationsCheck->Fill( fArrayTracksPhiRotated[trackId] );
                 
-                fHistPhiLRCrotationsCheck->Fill( lPhi );
-                
-                //            for(Int_t i = 0; i < lLrcNum; i++ )
-                //            {
                 lrcBase->AddTrackPtEta(
                             fArrayTracksPt[trackId]
                             , fArrayTracksEta[trackId]
-                            , lPhi
+                            , fArrayTracksPhiRotated[trackId]
                             , fArrayTracksCharge[trackId]
                             , fArrayTracksPID[trackId]
                             );
-                //            }
-                
             }
             
             //take event only if at least 1 track in this event fulfill the requirements! //21.11.11
@@ -360,6 +360,7 @@ protected:
     Double_t fArrayTracksPhi[kMaxParticlesNumber];
     Short_t fArrayTracksCharge[kMaxParticlesNumber];
     Int_t fArrayTracksPID[kMaxParticlesNumber];
+    Double_t fArrayTracksPhiRotated[kMaxParticlesNumber]; //! track phi after the current sector rotation
 
 
     //test MC particles
@@ -402,7 +403,7 @@ protected:
     //    TTree *fEventTree;              //! event tree to write into output file
     //    Bool_t fSetIncludeEventTreeInOutput;    // flag to use event tree or not
 
-    ClassDef(AliAnalysisTaskLRC, 11 );
+    ClassDef(AliAnalysisTaskLRC, 12 );
 };
 
 #endif
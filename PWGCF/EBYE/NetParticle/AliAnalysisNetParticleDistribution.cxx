@@ -53,7 +53,8 @@ AliAnalysisNetParticleDistribution::AliAnalysisNetParticleDistribution() :
   fMCNp(NULL),
   fMCNpPt(NULL),
   fRedFactp(NULL),
-  fHnTrackUnCorr(NULL) {
+  fHnTrackUnCorr(NULL),
+  fHistSetCache() {
   // Constructor   
   
   AliLog::SetClassDebugLevel("AliAnalysisNetParticleDistribution",10);
@@ -820,31 +821,47 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCentPt(const Char_t *name, c
 void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int_t idx, Bool_t isMC)  {
   // -- Fill histogram sets for particle and anti-particle
   //    dependence : centrality 
+  //    object pointers are looked up by name only once and then taken from the cache
   
-  // -- Get List
-  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));
+  // -- Get List and cache
+  std::vector<TObject*> &cache = GetHistSetCache(name);
+  if (!cache[0]) cache[0] = fOutList->FindObject(Form("f%s",name));
+  TList *list = static_cast<TList*>(cache[0]);
   
   // -- Get Centrality Bin
   Float_t centralityBin = fHelper->GetCentralityBin();
+  Int_t   subSampleIdx  = fHelper->GetSubSampleIdx();
 
   // -- Select MC or Data
   Int_t **np = (isMC) ? fMCNp : fNp;
 
   // -----------------------------------------------------------------------------------------------
 
+  // -- Resolve fixed histograms
+  if (!cache[2]) {
+    cache[2] = list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()));
+    cache[3] = list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()));
+    cache[4] = list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()));
+    cache[5] = list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()));
+    cache[6] = list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(0).Data()));
+    cache[7] = list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(1).Data()));
+    cache[8] = list->FindObject(Form("h%sNet%sX",  name, fHelper->GetParticleName(1).Data()));
+    cache[9] = list->FindObject(Form("h%sNet%sOverSumX", name, fHelper->GetParticleName(1).Data()));
+  }
+
   Int_t sumNp   = np[idx][1]+np[idx][0];  // p + pbar
   Int_t deltaNp = np[idx][1]-np[idx][0];  // p - pbar
 
   // -- Fill Particle / Anti-Particle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, np[idx][0]);
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, np[idx][1]);
+  (static_cast<TH2D*>(cache[2]))->Fill(centralityBin, np[idx][0]);
+  (static_cast<TH2D*>(cache[3]))->Fill(centralityBin, np[idx][1]);
 
   // -- Fill NetParticle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNp);
+  (static_cast<TH2D*>(cache[4]))->Fill(centralityBin, deltaNp);
 
   // -- Fill NetParticle vs SumParticle
   Double_t deltaNpOverSumNp = (sumNp == 0.) ? 0. : deltaNp/Double_t(sumNp);
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpOverSumNp);
+  (static_cast<TH2D*>(cache[5]))->Fill(centralityBin, deltaNpOverSumNp);
 
   // -----------------------------------------------------------------------------------------------
 
@@ -854,15 +871,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Double_t deltaNpX = np[idx][1]-(np[idx][0]*CENT[Int_t(centralityBin)]);
 
   // -- Fill Particle / Anti-Particle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, np[idx][0]*CENT[Int_t(centralityBin)]);
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, np[idx][1]);
+  (static_cast<TH2D*>(cache[6]))->Fill(centralityBin, np[idx][0]*CENT[Int_t(centralityBin)]);
+  (static_cast<TH2D*>(cache[7]))->Fill(centralityBin, np[idx][1]);
 
   // -- Fill NetParticle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sX",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpX);
+  (static_cast<TH2D*>(cache[8]))->Fill(centralityBin, deltaNpX);
 
   // -- Fill NetParticle vs SumParticle
   Double_t deltaNpXOverSumNpX = (sumNpX == 0.) ? 0. : deltaNpX/sumNpX;
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sOverSumX", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpXOverSumNpX);
+  (static_cast<TH2D*>(cache[9]))->Fill(centralityBin, deltaNpXOverSumNpX);
 
   // -----------------------------------------------------------------------------------------------
 
@@ -870,8 +887,12 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Double_t delta = 1.;
   for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
     delta *= deltaNp;
-    (static_cast<TProfile*>(list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder))))->Fill(centralityBin, delta);
-    (static_cast<TProfile*>(list->FindObject(Form("p%sNet%s%dM_%02d", name, fHelper->GetParticleName(1).Data(), idxOrder, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, delta);
+    Int_t slot    = GetHistSetSlot(kSlotM, idxOrder-1);
+    Int_t slotSub = GetHistSetSlot(kSlotMSub, idxOrder-1, subSampleIdx);
+    if (!cache[slot])    cache[slot]    = list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder));
+    if (!cache[slotSub]) cache[slotSub] = list->FindObject(Form("p%sNet%s%dM_%02d", name, fHelper->GetParticleName(1).Data(), idxOrder, subSampleIdx));
+    (static_cast<TProfile*>(cache[slot]))->Fill(centralityBin, delta);
+    (static_cast<TProfile*>(cache[slotSub]))->Fill(centralityBin, delta);
   }
 
   // -- Generate reduced factorials - explictly removing the factorials
@@ -888,18 +909,29 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   }
 
   // -- Fill TProfiles for <f_ik> 
-  TList *fikList    = static_cast<TList*>(list->FindObject(Form("f%sFik",name)));
-  TList *fikListSub = static_cast<TList*>(list->FindObject(Form("f%sFik_%02d",name, fHelper->GetSubSampleIdx())));
-  TH2D  *hCntik     = static_cast<TH2D*>(fikList->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin))));
-  TH2D  *hCntikSub  = static_cast<TH2D*>(fikListSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin), fHelper->GetSubSampleIdx())));
+  Int_t slotListSub = GetHistSetSlot(kSlotFikListSub, 0, subSampleIdx);
+  Int_t slotCnt     = GetHistSetSlot(kSlotCnt, Int_t(centralityBin));
+  Int_t slotCntSub  = GetHistSetSlot(kSlotCntSub, Int_t(centralityBin), subSampleIdx);
+  if (!cache[1])           cache[1]           = list->FindObject(Form("f%sFik",name));
+  if (!cache[slotListSub]) cache[slotListSub] = list->FindObject(Form("f%sFik_%02d",name, subSampleIdx));
+  TList *fikList    = static_cast<TList*>(cache[1]);
+  TList *fikListSub = static_cast<TList*>(cache[slotListSub]);
+  if (!cache[slotCnt])     cache[slotCnt]     = fikList->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin)));
+  if (!cache[slotCntSub])  cache[slotCntSub]  = fikListSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin), subSampleIdx));
+  TH2D  *hCntik     = static_cast<TH2D*>(cache[slotCnt]);
+  TH2D  *hCntikSub  = static_cast<TH2D*>(cache[slotCntSub]);
 
   for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> p    -> n1
     for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> pbar -> n2
       // -- use the reduced factorials only 
       Double_t fik = fRedFactp[ii][1] * fRedFactp[kk][0];   // n1 *n2 -> p * pbar
-      (static_cast<TProfile*>(fikList->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk))))->Fill(centralityBin, fik);
-      (static_cast<TProfile*>(fikListSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
-							  name, fHelper->GetParticleName(1).Data(), ii, kk, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, fik);
+      Int_t slot    = GetHistSetSlot(kSlotFik, ii*(fOrder+1)+kk);
+      Int_t slotSub = GetHistSetSlot(kSlotFikSub, ii*(fOrder+1)+kk, subSampleIdx);
+      if (!cache[slot])    cache[slot]    = fikList->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk));
+      if (!cache[slotSub]) cache[slotSub] = fikListSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
+									    name, fHelper->GetParticleName(1).Data(), ii, kk, subSampleIdx));
+      (static_cast<TProfile*>(cache[slot]))->Fill(centralityBin, fik);
+      (static_cast<TProfile*>(cache[slotSub]))->Fill(centralityBin, fik);
 
       if (fik != 0.) {
 	hCntik->Fill(ii, kk);
@@ -915,18 +947,43 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
 void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, Int_t idx, Bool_t isMC)  {
   // -- Add histogram sets for particle and anti-particle
   //    dependence : centrality and pt
+  //    object pointers are looked up by name only once and then taken from the cache
 
-  // -- Get List
-  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));  
+  // -- Get List and cache
+  std::vector<TObject*> &cache = GetHistSetCache(name);
+  if (!cache[0]) cache[0] = fOutList->FindObject(Form("f%s",name));
+  TList *list = static_cast<TList*>(cache[0]);
 
   // -- Get Centrality Bin
   Float_t centralityBin = fHelper->GetCentralityBin();
+  Int_t   subSampleIdx  = fHelper->GetSubSampleIdx();
 
   // -- Select MC or Data
   Int_t ***npPt = (isMC) ? fMCNpPt : fNpPt;
 
   // -----------------------------------------------------------------------------------------------
 
+  // -- Resolve fixed histograms and lists
+  if (!cache[2]) {
+    cache[2] = list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()));
+    cache[3] = list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()));
+    cache[4] = list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()));
+    cache[5] = list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()));
+    cache[1] = list->FindObject(Form("f%sPtFik",name));
+  }
+
+  Int_t slotListSub = GetHistSetSlot(kSlotFikListSub, 0, subSampleIdx);
+  Int_t slotCnt     = GetHistSetSlot(kSlotCnt, Int_t(centralityBin));
+  Int_t slotCntSub  = GetHistSetSlot(kSlotCntSub, Int_t(centralityBin), subSampleIdx);
+  if (!cache[slotListSub]) cache[slotListSub] = list->FindObject(Form("f%sPtFik_%02d",name, subSampleIdx));
+  TList *fikListPt    = static_cast<TList*>(cache[1]);
+  TList *fikListPtSub = static_cast<TList*>(cache[slotListSub]);
+  if (!cache[slotCnt])     cache[slotCnt]     = fikListPt->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin)));
+  if (!cache[slotCntSub])  cache[slotCntSub]  = fikListPtSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), 
+										   Int_t(centralityBin), subSampleIdx));
+  TH3D  *hCntikPt     = static_cast<TH3D*>(cache[slotCnt]);
+  TH3D  *hCntikPtSub  = static_cast<TH3D*>(cache[slotCntSub]);
+
   // -- Loop over the pt bins
   for (Int_t idxPt  = 0; idxPt < AliAnalysisNetParticleHelper::fgkfHistNBinsPt; ++idxPt) {
     
@@ -934,15 +991,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     Int_t sumNp   = npPt[idx][1][idxPt]+npPt[idx][0][idxPt]; // p + pbar
 
     // -- Fill Particle / Anti-Particle Distributions
-    (static_cast<TH3D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, idxPt, npPt[idx][0][idxPt]);
-    (static_cast<TH3D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, npPt[idx][1][idxPt]);
+    (static_cast<TH3D*>(cache[2]))->Fill(centralityBin, idxPt, npPt[idx][0][idxPt]);
+    (static_cast<TH3D*>(cache[3]))->Fill(centralityBin, idxPt, npPt[idx][1][idxPt]);
     
     // -- Fill NetParticle Distributions
-    (static_cast<TH3D*>(list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, deltaNp);
+    (static_cast<TH3D*>(cache[4]))->Fill(centralityBin, idxPt, deltaNp);
     
     // -- Fill NetParticle vs SumParticle
     Double_t deltaNpOverSumNp = (sumNp == 0.) ? 0. : deltaNp/Double_t(sumNp);
-    (static_cast<TH3D*>(list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, deltaNpOverSumNp);
+    (static_cast<TH3D*>(cache[5]))->Fill(centralityBin, idxPt, deltaNpOverSumNp);
 
     // -----------------------------------------------------------------------------------------------
 
@@ -950,9 +1007,13 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     Double_t delta = 1.;
     for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
       delta *= deltaNp;
-      (static_cast<TProfile2D*>(list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder))))->Fill(centralityBin, idxPt, delta);
-      (static_cast<TProfile2D*>(list->FindObject(Form("p%sNet%s%dM_%02d", 
-						      name, fHelper->GetParticleName(1).Data(), idxOrder, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, idxPt, delta);
+      Int_t slot    = GetHistSetSlot(kSlotM, idxOrder-1);
+      Int_t slotSub = GetHistSetSlot(kSlotMSub, idxOrder-1, subSampleIdx);
+      if (!cache[slot])    cache[slot]    = list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder));
+      if (!cache[slotSub]) cache[slotSub] = list->FindObject(Form("p%sNet%s%dM_%02d", 
+								      name, fHelper->GetParticleName(1).Data(), idxOrder, subSampleIdx));
+      (static_cast<TProfile2D*>(cache[slot]))->Fill(centralityBin, idxPt, delta);
+      (static_cast<TProfile2D*>(cache[slotSub]))->Fill(centralityBin, idxPt, delta);
     }
     
     // -- Generate reduced factorials - explictly removing the factorials
@@ -969,17 +1030,16 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     }
 
     // -- Fill TProfiles for <f_ik> 
-    TList *fikListPt    = static_cast<TList*>(list->FindObject(Form("f%sPtFik",name)));
-    TList *fikListPtSub = static_cast<TList*>(list->FindObject(Form("f%sPtFik_%02d",name, fHelper->GetSubSampleIdx())));
-    TH3D  *hCntikPt     = static_cast<TH3D*>(fikListPt->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin))));
-    TH3D  *hCntikPtSub  = static_cast<TH3D*>(fikListPtSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), 
-									   Int_t(centralityBin), fHelper->GetSubSampleIdx())));
     for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> p    -> n1
       for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> pbar -> n2
 	Double_t fik = fRedFactp[ii][1] * fRedFactp[kk][0];   // n1 *n2 -> p * pbar
-	(static_cast<TProfile2D*>(fikListPt->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk))))->Fill(centralityBin, idxPt, fik);
-	(static_cast<TProfile2D*>(fikListPtSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
-								name, fHelper->GetParticleName(1).Data(), ii, kk, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, idxPt, fik);
+	Int_t slot    = GetHistSetSlot(kSlotFik, ii*(fOrder+1)+kk);
+	Int_t slotSub = GetHistSetSlot(kSlotFikSub, ii*(fOrder+1)+kk, subSampleIdx);
+	if (!cache[slot])    cache[slot]    = fikListPt->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk));
+	if (!cache[slotSub]) cache[slotSub] = fikListPtSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
+									      name, fHelper->GetParticleName(1).Data(), ii, kk, subSampleIdx));
+	(static_cast<TProfile2D*>(cache[slot]))->Fill(centralityBin, idxPt, fik);
+	(static_cast<TProfile2D*>(cache[slotSub]))->Fill(centralityBin, idxPt, fik);
 	
 	if (fik != 0.) {
 	  hCntikPt->Fill(ii, kk, idxPt);
@@ -993,3 +1053,38 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   return;
 }
 
+//________________________________________________________________________
+std::vector<TObject*>& AliAnalysisNetParticleDistribution::GetHistSetCache(const Char_t *name) {
+  // -- Get cache of object pointers of a histogram set
+  //    slots are filled on first use, the layout is given by GetHistSetSlot
+
+  std::vector<TObject*> &cache = fHistSetCache[name];
+  if (cache.empty())
+    cache.resize(GetHistSetSlot(kSlotN, 0), NULL);
+
+  return cache;
+}
+
+//________________________________________________________________________
+Int_t AliAnalysisNetParticleDistribution::GetHistSetSlot(Int_t type, Int_t idx, Int_t sub) const {
+  // -- Get slot of an object in the histogram set cache
+  //    kSlotFixed : 0 list, 1 fik list, 2-9 distributions
+  //    kSlotN     : total number of slots
+
+  Int_t nSub = fHelper->GetNSubSamples();
+  Int_t nFik = (fOrder+1)*(fOrder+1);
+  Int_t nCnt = AliAnalysisNetParticleHelper::fgkfHistNBinsCent;
+
+  Int_t size[kSlotN] = {10, fOrder, fOrder*nSub, nSub, nFik, nFik*nSub, nCnt, nCnt*nSub};
+  Bool_t isSub[kSlotN] = {kFALSE, kFALSE, kTRUE, kTRUE, kFALSE, kTRUE, kFALSE, kTRUE};
+
+  Int_t offset = 0;
+  for (Int_t ii = 0; ii < type; ++ii)
+    offset += size[ii];
+
+  if (type == kSlotN)
+    return offset;
+
+  return (isSub[type]) ? offset + idx*nSub + sub : offset + idx;
+}
+
@@ -13,8 +13,12 @@
  *          Michael Weber <m.weber@cern.ch>
  */
 
+#include <map>
+#include <vector>
+
 #include "THnSparse.h"
 #include "TList.h"
+#include "TString.h"
 
 #include "AliAnalysisNetParticleBase.h"
 
@@ -89,6 +93,15 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   void FillHistSetCent(const Char_t *name, Int_t idx, Bool_t isMC);
   void FillHistSetCentPt(const Char_t *name, Int_t idx, Bool_t isMC);
 
+  /** Slot types of the histogram set cache */
+  enum histSetSlotType {kSlotFixed, kSlotM, kSlotMSub, kSlotFikListSub, kSlotFik, kSlotFikSub, kSlotCnt, kSlotCntSub, kSlotN};
+
+  /** Get cache of object pointers of a histogram set, created on first use */
+  std::vector<TObject*>& GetHistSetCache(const Char_t *name);
+
+  /** Get slot in histogram set cache, sub is only used for subsample types */
+  Int_t GetHistSetSlot(Int_t type, Int_t idx, Int_t sub = 0) const;
+
   /*
    * ---------------------------------------------------------------------------------
    *                             Members - private
@@ -112,8 +125,10 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   // =======================================================================
   THnSparseD           *fHnTrackUnCorr;         //  THnSparseD : uncorrected probe particles
   // -----------------------------------------------------------------------
+  std::map<TString, std::vector<TObject*> > fHistSetCache; //! Object pointers of histogram sets, per set name
+  // -----------------------------------------------------------------------
 
-  ClassDef(AliAnalysisNetParticleDistribution, 1);
+  ClassDef(AliAnalysisNetParticleDistribution, 2);
 };
 
 #endif
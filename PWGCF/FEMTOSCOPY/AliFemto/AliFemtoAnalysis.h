@@ -11,6 +11,7 @@
 #include <TObjString.h>
 
 class AliFemtoEvent;
+class AliFemtoParticleCollectionCache;
 
 class AliFemtoAnalysis{
 
@@ -28,6 +29,14 @@ public:
 
   virtual void Finish() = 0; ///< Called after analysis is finished
 
+  /// Whether ProcessEvent may run concurrently with other analyses on the
+  /// same event (see AliFemtoManager::SetParallelAnalyses)
+  virtual bool IsThreadSafe() const { return false; }
+
+  /// Particle cut decisions shared between the analyses of the manager
+  /// (see AliFemtoManager::SetShareParticleCollections), ignored by default
+  virtual void SetParticleCollectionCache(AliFemtoParticleCollectionCache *) { }
+
 };
 
 #endif
@@ -150,9 +150,9 @@ void AliFemtoCoulomb::CreateLookupTable(const double& radius)
     cout << "Input correction file opened" << endl;
   }
 
-  static char tempstring[2001];
-  static float radii[2000];
-  static int tNRadii = 0;
+  char tempstring[2001];
+  float radii[2000] = {};
+  int tNRadii = 0;
   tNRadii = 0;
   if (!mystream.getline(tempstring,2000)) {
     cout << "Could not read radii from file" << endl;
@@ -165,9 +165,9 @@ void AliFemtoCoulomb::CreateLookupTable(const double& radius)
   }
   cout << " Read " << tNRadii << " radii from file" << endl;
 
-  static double tLowRadius = -1.0;
-  static double tHighRadius = -1.0;
-  static int tLowIndex = 0;
+  double tLowRadius = -1.0;
+  double tHighRadius = -1.0;
+  int tLowIndex = 0;
   tLowRadius = -1.0;
   tHighRadius = -1.0;
   tLowIndex = 0;
@@ -186,17 +186,17 @@ void AliFemtoCoulomb::CreateLookupTable(const double& radius)
     assert(0);
   }
 
-  static double corr[100];           // array of corrections ... must be > tNRadii
+  double corr[100] = {};         // array of corrections ... must be > tNRadii
   fNLines = 0;
-  static double tempEta = 0;
+  double tempEta = 0;
   tempEta = 0;
   while (mystream >> tempEta) {
     for (int i=1; i<=tNRadii; i++) {
       mystream >> corr[i];
     }
-    static double tLowCoulomb = 0;
-    static double tHighCoulomb = 0;
-    static double nCorr = 0;
+    double tLowCoulomb = 0;
+    double tHighCoulomb = 0;
+    double nCorr = 0;
     tLowCoulomb = corr[tLowIndex];
     tHighCoulomb = corr[tLowIndex+1];
     nCorr = ( (radius-tLowRadius)*tHighCoulomb+(tHighRadius-radius)*tLowCoulomb )/(tHighRadius-tLowRadius);
@@ -217,7 +217,7 @@ double AliFemtoCoulomb::CoulombCorrect(const double& eta)
     cerr << "AliFemtoCoulomb::CoulombCorrect(eta) --> Trying to correct for negative radius!" << endl;
     assert(0);
   }
-  static int middle=0;
+  int middle=0;
   middle=int( (fNLines-1)/2 );
   if (eta*fEta[middle]<0.0) {
     cout << "AliFemtoCoulomb::CoulombCorrect(eta) --> eta: " << eta << " has wrong sign for data file! " << endl;
@@ -225,7 +225,7 @@ double AliFemtoCoulomb::CoulombCorrect(const double& eta)
     assert(0);
   }
 
-  static double tCorr = 0;
+  double tCorr = 0;
   tCorr = -1.0;
 
   if ( (eta>fEta[0]) && (fEta[0]>0.0) ) {
@@ -237,9 +237,9 @@ double AliFemtoCoulomb::CoulombCorrect(const double& eta)
     return (tCorr);
   }
   // This is a binary search for the bracketing pair of data points
-  static int high = 0;
-  static int low = 0;
-  static int width = 0;
+  int high = 0;
+  int low = 0;
+  int width = 0;
   high = fNLines-1;
   low = 0;
   width = high-low;
@@ -260,10 +260,10 @@ double AliFemtoCoulomb::CoulombCorrect(const double& eta)
   }
   // Make sure we found the right one
   if ( (fEta[low] >= eta) && (eta >= fEta[low+1]) ) {
-    static double tLowEta = 0;
-    static double tHighEta = 0;
-    static double tLowCoulomb = 0;
-    static double tHighCoulomb = 0;
+    double tLowEta = 0;
+    double tHighEta = 0;
+    double tLowCoulomb = 0;
+    double tHighCoulomb = 0;
     tLowEta = fEta[low];
     tHighEta = fEta[low+1];
     tLowCoulomb = fCoulomb[low];
@@ -326,17 +326,17 @@ double AliFemtoCoulomb::Eta(const AliFemtoPair* pair)
 {
   /// calculate eta
 
-  static double px1,py1,pz1,px2,py2,pz2;
-  static double px1new,py1new,pz1new;
-  static double px2new,py2new,pz2new;
-  static double vx1cms,vy1cms,vz1cms;
-  static double vx2cms,vy2cms,vz2cms;
-  static double tVcmsX,tVcmsY,tVcmsZ;
-  static double dv = 0.0;
-  static double e1,e2,e1new,e2new;
-  static double psi,theta;
-  static double beta,gamma;
-  static double tVcmsXnew;
+  double px1,py1,pz1,px2,py2,pz2;
+  double px1new,py1new,pz1new;
+  double px2new,py2new,pz2new;
+  double vx1cms,vy1cms,vz1cms;
+  double vx2cms,vy2cms,vz2cms;
+  double tVcmsX,tVcmsY,tVcmsZ;
+  double dv = 0.0;
+  double e1,e2,e1new,e2new;
+  double psi,theta;
+  double beta,gamma;
+  double tVcmsXnew;
 
   px1 = pair->Track1()->FourMomentum().px();
   py1 = pair->Track1()->FourMomentum().py();
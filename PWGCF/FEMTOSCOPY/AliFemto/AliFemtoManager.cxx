@@ -8,10 +8,15 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoManager.h"
+#include "AliFemtoParticleCollectionCache.h"
 //#include "AliFemtoParticleCollection.h"
 //#include "AliFemtoTrackCut.h"
 //#include "AliFemtoV0Cut.h"
 #include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -25,7 +30,9 @@
 AliFemtoManager::AliFemtoManager():
   fAnalysisCollection(nullptr),
   fEventReader(nullptr),
-  fEventWriterCollection(nullptr)
+  fEventWriterCollection(nullptr),
+  fNParallelAnalyses(0),
+  fParticleCollectionCache(nullptr)
 {
   // default constructor
   fAnalysisCollection = new AliFemtoAnalysisCollection;
@@ -35,7 +42,9 @@ AliFemtoManager::AliFemtoManager():
 AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
   fAnalysisCollection(new AliFemtoAnalysisCollection),
   fEventReader(aManager.fEventReader),
-  fEventWriterCollection(new AliFemtoEventWriterCollection)
+  fEventWriterCollection(new AliFemtoEventWriterCollection),
+  fNParallelAnalyses(aManager.fNParallelAnalyses),
+  fParticleCollectionCache(aManager.fParticleCollectionCache ? new AliFemtoParticleCollectionCache : nullptr)
 {
   // copy constructor
   for (auto *analysis : *aManager.fAnalysisCollection) {
@@ -61,6 +70,7 @@ AliFemtoManager::~AliFemtoManager()
     delete writer;
   }
   delete fEventWriterCollection;
+  delete fParticleCollectionCache;
 }
 //____________________________
 AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
@@ -71,7 +81,8 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
   }
 
   fEventReader = aManager.fEventReader;
-
+  fNParallelAnalyses = aManager.fNParallelAnalyses;
+  SetShareParticleCollections(aManager.fParticleCollectionCache != nullptr);
 
   for (auto *analysis : *fAnalysisCollection) {
     delete analysis;
@@ -166,6 +177,17 @@ AliFemtoString AliFemtoManager::Report()
   return report;
 }
 //____________________________
+void AliFemtoManager::SetShareParticleCollections(bool share)
+{
+  // create or drop the cache handed to the analyses in ProcessEvent
+  if (!share) {
+    delete fParticleCollectionCache;
+    fParticleCollectionCache = nullptr;
+  } else if (!fParticleCollectionCache) {
+    fParticleCollectionCache = new AliFemtoParticleCollectionCache;
+  }
+}
+//____________________________
 AliFemtoAnalysis* AliFemtoManager::Analysis( int n )
 {  // return pointer to n-th analysis
   if ( n < 0 || n > (int) fAnalysisCollection->size() ) {
@@ -209,9 +231,42 @@ int AliFemtoManager::ProcessEvent()
     writer->WriteHbtEvent(currentHbtEvent);
   }
 
-  // loop over all the Analysis
+  // loop over all the Analysis - the thread-safe ones are kept for the
+  // parallel pass when it is enabled, and do not share the cut decisions
+  if (fParticleCollectionCache) {
+    fParticleCollectionCache->Clear();
+  }
+  std::vector<AliFemtoAnalysis*> parallelAnalyses;
   for (auto *analysis : *fAnalysisCollection) {
-    analysis->ProcessEvent(currentHbtEvent);
+    if (fNParallelAnalyses > 1 && analysis->IsThreadSafe()) {
+      analysis->SetParticleCollectionCache(nullptr);
+      parallelAnalyses.push_back(analysis);
+    } else {
+      analysis->SetParticleCollectionCache(fParticleCollectionCache);
+      analysis->ProcessEvent(currentHbtEvent);
+    }
+  }
+
+  if (parallelAnalyses.size() > 1) {
+    // the workers take the next analysis not yet started, the calling
+    // thread is one of them
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+      for (size_t i = next++; i < parallelAnalyses.size(); i = next++) {
+        parallelAnalyses[i]->ProcessEvent(currentHbtEvent);
+      }
+    };
+    const size_t nThreads = std::min(parallelAnalyses.size(), static_cast<size_t>(fNParallelAnalyses));
+    std::vector<std::thread> threads;
+    for (size_t it = 1; it < nThreads; it++) {
+      threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  } else if (!parallelAnalyses.empty()) {
+    parallelAnalyses.front()->ProcessEvent(currentHbtEvent);
   }
 
   if (currentHbtEvent) {
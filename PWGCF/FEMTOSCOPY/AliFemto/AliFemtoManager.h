@@ -19,6 +19,8 @@
 #include "AliFemtoEventReader.h"
 #include "AliFemtoEventWriter.h"
 
+class AliFemtoParticleCollectionCache;
+
 
 /// \class AliFemtoManager
 /// \brief Main class for managing femtoscopic analyses
@@ -37,6 +39,16 @@
 /// EventWriters added to them, and is responsible for deleting them
 /// upon its own destruction.
 ///
+/// With `SetParallelAnalyses(n)` the analyses flagged as thread-safe
+/// (AliFemtoAnalysis::IsThreadSafe) are run concurrently on n threads,
+/// after the other analyses have processed the event one after the other.
+/// The event is shared and only read by the analyses.
+///
+/// With `SetShareParticleCollections(true)` the analyses run one after the
+/// other reuse the particle cut decisions of an earlier analysis whose cut
+/// has the same AliFemtoParticleCut::Fingerprint, instead of running the
+/// cut on every track again.
+///
 /// AliFemtoManager objects are not copyable, as the AliFemtoAnalysis
 /// objects they contain have no means of copying/cloning.
 /// Denying copyability by making the copy constructor and assignment
@@ -49,6 +61,8 @@ private:
   AliFemtoAnalysisCollection* fAnalysisCollection;       ///< Collection of analyzes
   AliFemtoEventReader*        fEventReader;              ///< Event reader
   AliFemtoEventWriterCollection* fEventWriterCollection; ///< Event writer collection
+  int fNParallelAnalyses;                                ///< Number of threads running the thread-safe analyses (<2: sequential)
+  AliFemtoParticleCollectionCache* fParticleCollectionCache; //!<! Particle cut decisions shared in the current event, nullptr if not sharing
 
   AliFemtoManager(const AliFemtoManager& aManager);
   AliFemtoManager& operator=(const AliFemtoManager& aManager);
@@ -70,6 +84,12 @@ public:
   AliFemtoEventReader* EventReader();
   void SetEventReader(AliFemtoEventReader* r);
 
+  /// Run the thread-safe analyses on up to `nThreads` threads
+  void SetParallelAnalyses(int nThreads);
+
+  /// Share the particle cut decisions between analyses with equal cuts
+  void SetShareParticleCollections(bool share);
+
   /// Calls `Init()` on all owned EventWriters
   ///
   /// Returns 0 for success, 1 for failure.
@@ -98,5 +118,6 @@ inline void AliFemtoManager::SetEventWriter(AliFemtoEventWriter* writer){fEventW
 
 inline AliFemtoEventReader* AliFemtoManager::EventReader(){return fEventReader;}
 inline void AliFemtoManager::SetEventReader(AliFemtoEventReader* reader){fEventReader = reader;}
+inline void AliFemtoManager::SetParallelAnalyses(int nThreads){fNParallelAnalyses = nThreads;}
 
 #endif
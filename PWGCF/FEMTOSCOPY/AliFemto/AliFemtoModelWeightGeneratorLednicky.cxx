@@ -99,6 +99,20 @@ typedef struct { REAL re; REAL im; } COMPLEX;
 #define cgamma F77_NAME(cgamma,CGAMMA)
 extern "C" {COMPLEX type_of_call cgamma_(COMPLEX*);}
 
+namespace {
+  // Arguments of the last llini call. The FSI common blocks are global,
+  // so this is shared by all the generator instances; fsiin and the K+K-
+  // model setting reset it.
+  int gLlIniLL = -1;
+  int gLlIniNS = -1;
+  int gLlIniItest = -1;
+
+  void ResetLlIni()
+  {
+    gLlIniLL = gLlIniNS = gLlIniItest = -1;
+  }
+}
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassImp(AliFemtoModelWeightGeneratorLednicky);
@@ -469,6 +483,7 @@ void AliFemtoModelWeightGeneratorLednicky::FsiInit()
    cout <<"mI3c dans FsiInit() = " << fI3c << endl;
 
   fsiin(fItest,fIch,fIqs,fIsi,fI3c);
+  ResetLlIni();
 }
 
 void AliFemtoModelWeightGeneratorLednicky::FsiSetKpKmModelType()
@@ -476,6 +491,7 @@ void AliFemtoModelWeightGeneratorLednicky::FsiSetKpKmModelType()
   // initialize K+K- model type
   cout<<"******************* AliFemtoModelWeightGeneratorLednicky check FsiInit initialize K+K- model type with FsiSetKpKmModelType(), type= "<<fKpKmModel<<" PhiOffON= "<<fPhi_OffOn<<" *************"<< endl;
    setkpkmmodel(fKpKmModel,fPhi_OffOn);
+   ResetLlIni();
    cout<<"-----------------END FsiSetKpKmModelType-------"<<endl;
 }
 
@@ -506,7 +522,17 @@ void AliFemtoModelWeightGeneratorLednicky::FsiSetLL()
   //cout <<"fLL dans FsiSetLL() = "<< fLL << endl;
    //cout <<"tNS dans FsiSetLL() = "<< tNS << endl;
   // cout <<"fItest dans FsiSetLL() = "<< fItest << endl;
-  llini(fLL,tNS,fItest);
+
+  // llini only copies the parameters of the pair type into the common
+  // blocks, which the weight calculation does not modify: skip it while
+  // the pair type does not change. The p-pbar case (LL=30) rescales its
+  // parameters in place at each call and is always initialized.
+  if (fLL == 30 || fLL != gLlIniLL || tNS != gLlIniNS || fItest != gLlIniItest) {
+    llini(fLL,tNS,fItest);
+    gLlIniLL = fLL;
+    gLlIniNS = tNS;
+    gLlIniItest = fItest;
+  }
  // cout<<" end of FsiSetLL"<<endl;
 }
 
@@ -10,11 +10,6 @@
 #include <TMath.h>
 #include "AliFemtoPair.h"
 
-double AliFemtoPair::fgMaxDuInner = .8;
-double AliFemtoPair::fgMaxDzInner = 3.;
-double AliFemtoPair::fgMaxDuOuter = 1.4;
-double AliFemtoPair::fgMaxDzOuter = 3.2;
-
 
 AliFemtoPair::AliFemtoPair():
   fTrack1(nullptr),
@@ -48,10 +43,15 @@ AliFemtoPair::AliFemtoPair():
   fClosestRowAtDCAV0PosV0Pos(0.0),
   fMergingParNotCalculatedV0NegV0Neg(0),
   fFracOfMergedRowV0NegV0Neg(0.0),
-  fClosestRowAtDCAV0NegV0Neg(0.0)
+  fClosestRowAtDCAV0NegV0Neg(0.0),
+  fQInvCalc(NAN),
+  fKTCalc(NAN),
+  fMaxDuInner(3.),
+  fMaxDzInner(4.),
+  fMaxDuOuter(4.),
+  fMaxDzOuter(6.)
 {
   // Default constructor
-  SetDefaultHalfFieldMergingPar();
   std::fill_n(fAverageSeparations, 4, NAN);
   std::fill_n(fFemtoWeightCache, 3, std::make_pair(0, NAN));
 }
@@ -88,37 +88,42 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fClosestRowAtDCAV0PosV0Pos(0.0),
   fMergingParNotCalculatedV0NegV0Neg(0),
   fFracOfMergedRowV0NegV0Neg(0.0),
-  fClosestRowAtDCAV0NegV0Neg(0.0)
+  fClosestRowAtDCAV0NegV0Neg(0.0),
+  fQInvCalc(NAN),
+  fKTCalc(NAN),
+  fMaxDuInner(3.),
+  fMaxDzInner(4.),
+  fMaxDuOuter(4.),
+  fMaxDzOuter(6.)
 {
   // Construct a pair from two particles
-  SetDefaultHalfFieldMergingPar();
   std::fill_n(fAverageSeparations, 4, NAN);
   std::fill_n(fFemtoWeightCache, 3, std::make_pair(0, NAN));
 }
 
 void AliFemtoPair::SetDefaultHalfFieldMergingPar()
 {
-  fgMaxDuInner = 3;
-  fgMaxDzInner = 4.;
-  fgMaxDuOuter = 4.;
-  fgMaxDzOuter = 6.;
+  fMaxDuInner = 3;
+  fMaxDzInner = 4.;
+  fMaxDuOuter = 4.;
+  fMaxDzOuter = 6.;
 }
 void AliFemtoPair::SetDefaultFullFieldMergingPar()
 {
   // Set default TPC merging parameters for STAR TPC
-  fgMaxDuInner = 0.8;
-  fgMaxDzInner = 3.;
-  fgMaxDuOuter = 1.4;
-  fgMaxDzOuter = 3.2;
+  fMaxDuInner = 0.8;
+  fMaxDzInner = 3.;
+  fMaxDuOuter = 1.4;
+  fMaxDzOuter = 3.2;
 }
 void AliFemtoPair::SetMergingPar(double aMaxDuInner, double aMaxDzInner,
 			      double aMaxDuOuter, double aMaxDzOuter)
 {
   // Set TPC merging parameters for STAR TPC
-  fgMaxDuInner = aMaxDuInner;
-  fgMaxDzInner = aMaxDzInner;
-  fgMaxDuOuter = aMaxDuOuter;
-  fgMaxDzOuter = aMaxDzOuter;
+  fMaxDuInner = aMaxDuInner;
+  fMaxDzInner = aMaxDzInner;
+  fMaxDuOuter = aMaxDuOuter;
+  fMaxDzOuter = aMaxDzOuter;
 }
 
 AliFemtoPair::~AliFemtoPair()
@@ -159,7 +164,13 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fClosestRowAtDCAV0PosV0Pos(aPair.fClosestRowAtDCAV0PosV0Pos),
   fMergingParNotCalculatedV0NegV0Neg(aPair.fMergingParNotCalculatedV0NegV0Neg),
   fFracOfMergedRowV0NegV0Neg(aPair.fFracOfMergedRowV0NegV0Neg),
-  fClosestRowAtDCAV0NegV0Neg(aPair.fClosestRowAtDCAV0NegV0Neg)
+  fClosestRowAtDCAV0NegV0Neg(aPair.fClosestRowAtDCAV0NegV0Neg),
+  fQInvCalc(NAN),
+  fKTCalc(NAN),
+  fMaxDuInner(aPair.fMaxDuInner),
+  fMaxDzInner(aPair.fMaxDzInner),
+  fMaxDuOuter(aPair.fMaxDuOuter),
+  fMaxDzOuter(aPair.fMaxDzOuter)
 {
   // Copy constructor
   /* no-op */
@@ -216,6 +227,13 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fClosestRowAtDCAV0NegV0Neg = aPair.fClosestRowAtDCAV0NegV0Neg;
 
   std::fill_n(fAverageSeparations, 4, NAN);
+  fQInvCalc = NAN;
+  fKTCalc = NAN;
+
+  fMaxDuInner = aPair.fMaxDuInner;
+  fMaxDzInner = aPair.fMaxDzInner;
+  fMaxDuOuter = aPair.fMaxDuOuter;
+  fMaxDzOuter = aPair.fMaxDzOuter;
 
   return *this;
 }
@@ -236,10 +254,13 @@ double AliFemtoPair::MInv() const
 double AliFemtoPair::KT() const
 {
   // transverse momentum
-  double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
-  tmp *= .5;
+  if (std::isnan(fKTCalc)) {
+    double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
+    tmp *= .5;
+    fKTCalc = tmp;
+  }
 
-  return tmp;
+  return fKTCalc;
 }
 //_________________
 double AliFemtoPair::Rap() const
@@ -1184,16 +1205,16 @@ AliFemtoPair::NominalTpcAverageSeparationV0PosV0Pos() const
 //       tDz = fabs(fTrack1->fZ[ti]-fTrack2->fZ[ti]);
 //       tN++;
 //       if(ti<13){
-// 	fFracOfMergedRow += (tDu<fgMaxDuInner && tDz<fgMaxDzInner);
-// 	tDist = ::sqrt(tDu*tDu/fgMaxDuInner/fgMaxDuInner+
-// 		     tDz*tDz/fgMaxDzInner/fgMaxDzInner);
-// 	//fFracOfMergedRow += (tDu<fgMaxDuInner && tDz<fgMaxDzInner);
+// 	fFracOfMergedRow += (tDu<fMaxDuInner && tDz<fMaxDzInner);
+// 	tDist = ::sqrt(tDu*tDu/fMaxDuInner/fMaxDuInner+
+// 		     tDz*tDz/fMaxDzInner/fMaxDzInner);
+// 	//fFracOfMergedRow += (tDu<fMaxDuInner && tDz<fMaxDzInner);
 //       }
 //       else{
-// 	fFracOfMergedRow += (tDu<fgMaxDuOuter && tDz<fgMaxDzOuter);
-// 	tDist = ::sqrt(tDu*tDu/fgMaxDuOuter/fgMaxDuOuter+
-// 		     tDz*tDz/fgMaxDzOuter/fgMaxDzOuter);
-// 	//fFracOfMergedRow += (tDu<fgMaxDuOuter && tDz<fgMaxDzOuter);
+// 	fFracOfMergedRow += (tDu<fMaxDuOuter && tDz<fMaxDzOuter);
+// 	tDist = ::sqrt(tDu*tDu/fMaxDuOuter/fMaxDuOuter+
+// 		     tDz*tDz/fMaxDzOuter/fMaxDzOuter);
+// 	//fFracOfMergedRow += (tDu<fMaxDuOuter && tDz<fMaxDzOuter);
 //       }
 //       if(tDist<tDistMax){
 // 	fClosestRowAtDCA = ti+1;
@@ -1443,14 +1464,14 @@ AliFemtoPair::NominalTpcAverageSeparationV0PosV0Pos() const
 // 	tDz = fabs(tmpZ1[ti]-tmpZ2[ti]);
 // 	tN++;
 //       if(ti<13){
-// 	*tmpFracOfMergedRow += (tDu<fgMaxDuInner && tDz<fgMaxDzInner);
-// 	tDist = ::sqrt(tDu*tDu/fgMaxDuInner/fgMaxDuInner+
-// 		     tDz*tDz/fgMaxDzInner/fgMaxDzInner);
+// 	*tmpFracOfMergedRow += (tDu<fMaxDuInner && tDz<fMaxDzInner);
+// 	tDist = ::sqrt(tDu*tDu/fMaxDuInner/fMaxDuInner+
+// 		     tDz*tDz/fMaxDzInner/fMaxDzInner);
 //       }
 //       else{
-// 	*tmpFracOfMergedRow += (tDu<fgMaxDuOuter && tDz<fgMaxDzOuter);
-// 	tDist = ::sqrt(tDu*tDu/fgMaxDuOuter/fgMaxDuOuter+
-// 		     tDz*tDz/fgMaxDzOuter/fgMaxDzOuter);
+// 	*tmpFracOfMergedRow += (tDu<fMaxDuOuter && tDz<fMaxDzOuter);
+// 	tDist = ::sqrt(tDu*tDu/fMaxDuOuter/fMaxDuOuter+
+// 		     tDz*tDz/fMaxDzOuter/fMaxDzOuter);
 // 	}
 //       if(tDist<tDistMax){
 // 	fClosestRowAtDCA = ti+1;
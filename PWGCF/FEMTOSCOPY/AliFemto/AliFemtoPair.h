@@ -266,14 +266,19 @@ private:
   /// Used to store the average separations of tracks
   mutable double fAverageSeparations[4];
 
+  /// Cached QInv and KT of the pair (NAN when not yet calculated), as
+  /// they are asked for by the pair cut and by most correlation functions
+  mutable double fQInvCalc;
+  mutable double fKTCalc;
+
   /// Cache for re-using MC-generated weights
   /// First item in pair is pointer to weight, second is the weight
   mutable std::pair<std::intptr_t, double> fFemtoWeightCache[3];
 
-  static double fgMaxDuInner; // Minimum cluster separation in x in inner TPC padrow
-  static double fgMaxDzInner; // Minimum cluster separation in z in inner TPC padrow
-  static double fgMaxDuOuter; // Minimum cluster separation in x in outer TPC padrow
-  static double fgMaxDzOuter; // Minimum cluster separation in z in outer TPC padrow
+  double fMaxDuInner; // Minimum cluster separation in x in inner TPC padrow
+  double fMaxDzInner; // Minimum cluster separation in z in inner TPC padrow
+  double fMaxDuOuter; // Minimum cluster separation in x in outer TPC padrow
+  double fMaxDzOuter; // Minimum cluster separation in z in outer TPC padrow
 
   void FillCacheAvgSepTrackV0() const;
   void FillCacheAvgSepV0V0() const;
@@ -303,6 +308,8 @@ inline void AliFemtoPair::ResetParCalculated(){
   fMergingParNotCalculatedV0NegV0Neg=1;
 
   std::fill_n(fAverageSeparations, 4, NAN);
+  fQInvCalc = NAN;
+  fKTCalc = NAN;
   ClearWeightCache();
 }
 
@@ -335,8 +342,11 @@ inline double AliFemtoPair::KStar() const{
   return fKStarCalc;
 }
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return -tDiff.m();
+  if (std::isnan(fQInvCalc)) {
+    AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
+    fQInvCalc = -tDiff.m();
+  }
+  return fQInvCalc;
 }
 
 // Fabrice private <<<
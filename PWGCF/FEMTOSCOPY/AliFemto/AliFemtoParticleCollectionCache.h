@@ -0,0 +1,72 @@
+///
+/// \file AliFemtoParticleCollectionCache.h
+///
+
+#ifndef ALIFEMTOPARTICLECOLLECTIONCACHE_H
+#define ALIFEMTOPARTICLECOLLECTIONCACHE_H
+
+#include "AliFemtoParticleCut.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class AliFemtoEvent;
+
+/// \class AliFemtoParticleCollectionCache
+/// \brief Particle cut decisions shared between analyses of the same event
+///
+/// Owned by the AliFemtoManager when SetShareParticleCollections is enabled.
+/// For every particle cut fingerprint (AliFemtoParticleCut::Fingerprint) it
+/// keeps which entries of the event's track, V0, Xi or kink collection passed
+/// the cut. The first analysis using a cut records them while it fills its
+/// particle collection, the following analyses with an equal cut fill theirs
+/// from the recorded decisions without calling Pass again. Each analysis
+/// still builds its own particles and fills its own cut monitors, as the
+/// particles are owned by its pico events.
+///
+class AliFemtoParticleCollectionCache {
+public:
+  AliFemtoParticleCollectionCache():
+    fEvent(nullptr),
+    fFingerprints(),
+    fDecisions()
+  { /* no-op */ }
+
+  /// Drop the decisions of the previous event
+  void Clear();
+
+  /// Decisions of the cut in this event - empty if not recorded yet, and
+  /// nullptr if the cut is never shared (empty fingerprint)
+  std::vector<bool>* Decisions(AliFemtoParticleCut *cut, const AliFemtoEvent *event);
+
+private:
+  const AliFemtoEvent *fEvent;                                      ///< Event the decisions belong to
+  std::map<const AliFemtoParticleCut*, std::string> fFingerprints;  ///< Fingerprint of each cut, computed on first use
+  std::map<std::string, std::vector<bool> > fDecisions;             ///< Pass decision of each entry, by fingerprint
+};
+
+inline void AliFemtoParticleCollectionCache::Clear()
+{
+  fEvent = nullptr;
+  fDecisions.clear();
+}
+
+inline std::vector<bool>* AliFemtoParticleCollectionCache::Decisions(AliFemtoParticleCut *cut, const AliFemtoEvent *event)
+{
+  if (event != fEvent) {
+    Clear();
+    fEvent = event;
+  }
+
+  auto found = fFingerprints.find(cut);
+  if (found == fFingerprints.end()) {
+    found = fFingerprints.insert(std::make_pair(cut, cut->Fingerprint())).first;
+  }
+  if (found->second.empty()) {
+    return nullptr;
+  }
+  return &fDecisions[found->second];
+}
+
+#endif
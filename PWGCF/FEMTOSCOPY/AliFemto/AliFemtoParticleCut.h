@@ -11,6 +11,7 @@
 #include "AliFemtoCutMonitorHandler.h"
 #include <TObjString.h>
 #include <TList.h>
+#include <typeinfo>
 
 class AliFemtoAnalysis;
 
@@ -33,6 +34,15 @@ public:
   virtual AliFemtoString Report() = 0;    ///< User-written method to return string describing cuts
   virtual TList *ListSettings();          ///< User-written list of settings which is stored in the result file
 
+  /// Identifies the configuration of the cut: cuts with equal fingerprints
+  /// select the same particles of an event, so their decisions can be shared
+  /// between analyses (see AliFemtoManager::SetShareParticleCollections).
+  ///
+  /// Built from the class name, the mass and ListSettings(). Cuts whose
+  /// ListSettings() does not cover all of their settings should override
+  /// this, or return an empty string to never be shared.
+  virtual AliFemtoString Fingerprint();
+
   double Mass() const { return fMass; };  ///< Mass of the particle being selected
   virtual void SetMass(const double &mass) { fMass = mass; };
 
@@ -92,4 +102,22 @@ inline TList *AliFemtoParticleCut::ListSettings()
   return tListSetttings;
 }
 
+inline AliFemtoString AliFemtoParticleCut::Fingerprint()
+{
+  AliFemtoString fingerprint = typeid(*this).name();
+  fingerprint += TString::Format(";mass=%f", fMass).Data();
+
+  TList *settings = ListSettings();
+  if (settings) {
+    TIter next(settings);
+    while (TObject *setting = next()) {
+      fingerprint += ";";
+      fingerprint += setting->GetName();
+    }
+    settings->SetOwner();
+    delete settings;
+  }
+  return fingerprint;
+}
+
 #endif
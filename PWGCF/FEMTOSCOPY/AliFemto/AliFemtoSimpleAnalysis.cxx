@@ -9,10 +9,12 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoParticleCollectionCache.h"
 
 #include <string>
 #include <iostream>
 #include <iterator>
+#include <vector>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -45,13 +47,30 @@ AliFemtoCorrFctn*    copyTheCorrFctn(AliFemtoCorrFctn*);
 /// other type, it is recommended to add TrackCollectionIterType to the
 /// template list, and add the appropriate type to the function calls in
 /// FillParticleCollection.
+///
+/// If decisions are given and already hold one entry per track (recorded by
+/// an analysis with an equal cut), they are used instead of calling Pass,
+/// otherwise the decisions of this cut are recorded into them.
 template <class TrackCollectionType, class TrackCutType>
 void DoFillParticleCollection(TrackCutType *cut,
                               TrackCollectionType *track_collection,
-                              AliFemtoParticleCollection *output)
+                              AliFemtoParticleCollection *output,
+                              std::vector<bool> *decisions=nullptr)
 {
+  const bool reuse_decisions = decisions
+                            && !decisions->empty()
+                            && decisions->size() == track_collection->size();
+  if (decisions && !reuse_decisions) {
+    decisions->clear();
+    decisions->reserve(track_collection->size());
+  }
+
+  size_t index = 0;
   for (const auto &track : *track_collection) {
-    const Bool_t track_passes = cut->Pass(track);
+    const Bool_t track_passes = reuse_decisions ? (*decisions)[index++] : cut->Pass(track);
+    if (decisions && !reuse_decisions) {
+      decisions->push_back(track_passes);
+    }
     cut->FillCutMonitor(track, track_passes);
     if (track_passes) {
       output->push_back(new AliFemtoParticle(track, cut->Mass()));
@@ -66,14 +85,23 @@ void DoFillParticleCollection(TrackCutType *cut,
 //
 // The actual loop implementation has been moved to the collection-generic
 // DoFillParticleCollection() function
+//
+// With a cache, the cut decisions are shared with the other analyses whose
+// cut has the same fingerprint (not with the shared daughter cut, which
+// selects among all candidates).
 void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
                                const AliFemtoEvent *hbtEvent,
                                AliFemtoParticleCollection *partCollection,
-                               bool performSharedDaughterCut=kFALSE)
+                               bool performSharedDaughterCut,
+                               AliFemtoParticleCollectionCache *cache)
 {
   /// Fill particle collection with all particles in the event which pass
   /// the provided cut
 
+  std::vector<bool> *decisions = (cache && !performSharedDaughterCut)
+                               ? cache->Decisions(partCut, hbtEvent)
+                               : nullptr;
+
   // determine which track collection to use based on the particle type.
   switch (partCut->Type()) {
 
@@ -83,7 +111,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
       DoFillParticleCollection(
 			       (AliFemtoTrackCut*)partCut,
 			       hbtEvent->TrackCollection(),
-			       partCollection
+			       partCollection,
+			       decisions
 			       );
     }
     break;
@@ -106,7 +135,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
       DoFillParticleCollection(
         v0_cut,
         hbtEvent->V0Collection(),
-        partCollection
+        partCollection,
+        decisions
       );
 
     }
@@ -133,7 +163,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
       DoFillParticleCollection(
         (AliFemtoXiTrackCut*)partCut,
         hbtEvent->XiCollection(),
-        partCollection
+        partCollection,
+        decisions
       );
     }
     break;
@@ -145,7 +176,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
     DoFillParticleCollection(
       (AliFemtoKinkCut*)partCut,
       hbtEvent->KinkCollection(),
-      partCollection
+      partCollection,
+      decisions
     );
 
     break;
@@ -158,6 +190,14 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
   partCut->FillCutMonitor(hbtEvent, partCollection);
 }
 
+void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
+                               const AliFemtoEvent *hbtEvent,
+                               AliFemtoParticleCollection *partCollection,
+                               bool performSharedDaughterCut=kFALSE)
+{
+  FillHbtParticleCollection(partCut, hbtEvent, partCollection, performSharedDaughterCut, nullptr);
+}
+
 // Leave this here to appease any legacy code that expected a non-const AliFemtoEvent
 void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
                                AliFemtoEvent *hbtEvent,
@@ -183,7 +223,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fThreadSafe(kFALSE),
+  fParticleCollectionCache(nullptr)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +247,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fThreadSafe(a.fThreadSafe),
+  fParticleCollectionCache(nullptr)
 {
   /// Copy constructor
 
@@ -402,6 +446,7 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fThreadSafe = aAna.fThreadSafe;
 
   return *this;
 }
@@ -492,14 +537,16 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   FillHbtParticleCollection(fFirstParticleCut,
                             hbtEvent,
                             fPicoEvent->FirstParticleCollection(),
-                            fPerformSharedDaughterCut);
+                            fPerformSharedDaughterCut,
+                            fParticleCollectionCache);
 
   // fill second particle cut if not analyzing identical particles
   if ( !AnalyzeIdenticalParticles() ) {
       FillHbtParticleCollection(fSecondParticleCut,
                                 hbtEvent,
                                 fPicoEvent->SecondParticleCollection(),
-                                fPerformSharedDaughterCut);
+                                fPerformSharedDaughterCut,
+                                fParticleCollectionCache);
   }
 
   const UInt_t coll_1_size = collection1->size(),
@@ -18,6 +18,7 @@
 
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
+class AliFemtoParticleCollectionCache;
 
 ///
 /// \class AliFemtoSimpleAnalysis
@@ -99,6 +100,16 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Declare that this analysis can be run concurrently with the other
+  /// thread-safe analyses of the manager. Only set this when none of the
+  /// cuts and correlation functions share state with another analysis
+  /// (e.g. a common object or the gDirectory).
+  void SetThreadSafe(Bool_t aThreadSafe);
+  virtual bool IsThreadSafe() const;
+
+  /// Particle cut decisions shared with the other analyses, set by the manager
+  virtual void SetParticleCollectionCache(AliFemtoParticleCollectionCache *cache);
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -177,6 +188,8 @@ protected:
   Bool_t fVerbose;
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
+  Bool_t fThreadSafe;                                ///< May be run concurrently with other analyses
+  AliFemtoParticleCollectionCache* fParticleCollectionCache; //!<! Not owned, nullptr unless the manager shares the particle cut decisions
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -242,6 +255,11 @@ inline bool AliFemtoSimpleAnalysis::EnablePairMonitors()
   return fEnablePairMonitors;
 }
 
+inline bool AliFemtoSimpleAnalysis::IsThreadSafe() const
+{
+  return fThreadSafe;
+}
+
 // Sets
 inline void AliFemtoSimpleAnalysis::SetPairCut(AliFemtoPairCut* x)
 {
@@ -305,4 +323,14 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetThreadSafe(Bool_t aThreadSafe)
+{
+  fThreadSafe = aThreadSafe;
+}
+
+inline void AliFemtoSimpleAnalysis::SetParticleCollectionCache(AliFemtoParticleCollectionCache *cache)
+{
+  fParticleCollectionCache = cache;
+}
+
 #endif
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <math.h>
+#include <vector>
 #include "TChain.h"
 #include "TFile.h"
 #include "TKey.h"
@@ -3027,6 +3028,11 @@ void AliFourPion::UserExec(Option_t *)
 
 
     ////////////////////////////////////////////////////
+    // qinv and qosl of the pairs (1,3), (1,4) and (2,4) do not depend on the inner particles:
+    // compute them once per outer particle and reuse them in the triplet/quadruplet loops
+    std::vector<Float_t> pairQ13(4*kMultLimitPbPb), pairQ14(4*kMultLimitPbPb), pairQ24(4*kMultLimitPbPb);
+    std::vector<Int_t> pairStamp13(kMultLimitPbPb,-1), pairStamp14(kMultLimitPbPb,-1), pairStamp24(kMultLimitPbPb,-1);
+    Int_t stamp1=-1, stamp2=-1;
     ////////////////////////////////////////////////////
     for(Int_t en2=0; en2<=1; en2++){// 2nd event number (en2=0 is the same event as current event)
       for(Int_t en3=en2; en3<=2; en3++){// 3rd event number
@@ -3041,6 +3047,7 @@ void AliFourPion::UserExec(Option_t *)
 	 
 	  /////////////////////////////////////////////////////////////
 	  for (Int_t i=0; i<myTracks; i++) {// 1st particle
+	    stamp1++;
 	    pVect1[0]=(fEvt)->fTracks[i].fEaccepted;
 	    pVect1[1]=(fEvt)->fTracks[i].fP[0];
 	    pVect1[2]=(fEvt)->fTracks[i].fP[1];
@@ -3061,6 +3068,7 @@ void AliFourPion::UserExec(Option_t *)
 	      pVect2[2]=(fEvt+en2)->fTracks[j].fP[1];
 	      pVect2[3]=(fEvt+en2)->fTracks[j].fP[2];
 	      ch2 = Int_t(((fEvt+en2)->fTracks[j].fCharge + 1)/2.);
+	      stamp2++;
 	      qinv12 = GetQinv(pVect1, pVect2);
 	      kT12 = sqrt(pow(pVect1[1]+pVect2[1],2) + pow(pVect1[2]+pVect2[2],2))/2.;
 	      GetQosl(pVect1, pVect2, qout12, qside12, qlong12);
@@ -3276,10 +3284,15 @@ void AliFourPion::UserExec(Option_t *)
 		pVect3[2]=(fEvt+en3)->fTracks[k].fP[1];
 		pVect3[3]=(fEvt+en3)->fTracks[k].fP[2];
 		ch3 = Int_t(((fEvt+en3)->fTracks[k].fCharge + 1)/2.);
-		qinv13 = GetQinv(pVect1, pVect3);
+		if(pairStamp13[k]!=stamp1){
+		  pairStamp13[k]=stamp1;
+		  pairQ13[4*k] = GetQinv(pVect1, pVect3);
+		  GetQosl(pVect1, pVect3, pairQ13[4*k+1], pairQ13[4*k+2], pairQ13[4*k+3]);
+		}
+		qinv13 = pairQ13[4*k];
 		qinv23 = GetQinv(pVect2, pVect3);
 		q3 = sqrt(pow(qinv12,2) + pow(qinv13,2) + pow(qinv23,2));
-		GetQosl(pVect1, pVect3, qout13, qside13, qlong13);
+		qout13 = pairQ13[4*k+1]; qside13 = pairQ13[4*k+2]; qlong13 = pairQ13[4*k+3];
 		GetQosl(pVect2, pVect3, qout23, qside23, qlong23);
 		Int_t chGroup3[3]={ch1,ch2,ch3};
 		Float_t QinvMCGroup3[3]={0};
@@ -3687,12 +3700,22 @@ void AliFourPion::UserExec(Option_t *)
 		  pVect4[2]=(fEvt+en4)->fTracks[l].fP[1];
 		  pVect4[3]=(fEvt+en4)->fTracks[l].fP[2];
 		  ch4 = Int_t(((fEvt+en4)->fTracks[l].fCharge + 1)/2.);
-		  qinv14 = GetQinv(pVect1, pVect4);
-		  qinv24 = GetQinv(pVect2, pVect4);
+		  if(pairStamp14[l]!=stamp1){
+		    pairStamp14[l]=stamp1;
+		    pairQ14[4*l] = GetQinv(pVect1, pVect4);
+		    GetQosl(pVect1, pVect4, pairQ14[4*l+1], pairQ14[4*l+2], pairQ14[4*l+3]);
+		  }
+		  if(pairStamp24[l]!=stamp2){
+		    pairStamp24[l]=stamp2;
+		    pairQ24[4*l] = GetQinv(pVect2, pVect4);
+		    GetQosl(pVect2, pVect4, pairQ24[4*l+1], pairQ24[4*l+2], pairQ24[4*l+3]);
+		  }
+		  qinv14 = pairQ14[4*l];
+		  qinv24 = pairQ24[4*l];
 		  qinv34 = GetQinv(pVect3, pVect4);
 		  q4 = sqrt(pow(q3,2) + pow(qinv14,2) + pow(qinv24,2) + pow(qinv34,2));
-		  GetQosl(pVect1, pVect4, qout14, qside14, qlong14);
-		  GetQosl(pVect2, pVect4, qout24, qside24, qlong24);
+		  qout14 = pairQ14[4*l+1]; qside14 = pairQ14[4*l+2]; qlong14 = pairQ14[4*l+3];
+		  qout24 = pairQ24[4*l+1]; qside24 = pairQ24[4*l+2]; qlong24 = pairQ24[4*l+3];
 		  GetQosl(pVect3, pVect4, qout34, qside34, qlong34);
 		  Int_t chGroup4[4]={ch1,ch2,ch3,ch4};
 		  Float_t QinvMCGroup4[6]={0};
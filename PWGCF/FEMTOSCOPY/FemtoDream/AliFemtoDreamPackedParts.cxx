@@ -0,0 +1,179 @@
+/*
+ * AliFemtoDreamPackedParts.cxx
+ *
+ *  Packed (structure of arrays) copy of the particles of one species in one
+ *  event, holding only what is needed to pair them.
+ */
+#include <cmath>
+#include "AliFemtoDreamPackedParts.h"
+#include "TMath.h"
+
+ClassImp(AliFemtoDreamPackedParts)
+AliFemtoDreamPackedParts::AliFemtoDreamPackedParts()
+    : fMass(0.f),
+      fPx(),
+      fPy(),
+      fPz(),
+      fE(),
+      fPt(),
+      fEta(),
+      fPhi(),
+      fMCPDG(),
+      fMCPx(),
+      fMCPy(),
+      fMCPz(),
+      fFirstDaug(),
+      fDaugEta(),
+      fFirstRad(),
+      fPhiAtRad() {
+}
+
+AliFemtoDreamPackedParts::~AliFemtoDreamPackedParts() {
+}
+
+void AliFemtoDreamPackedParts::Fill(
+    const std::vector<AliFemtoDreamBasePart> &Particles, float mass) {
+  //The vectors are cleared but keep their capacity, so refilling the
+  //same object event by event does not allocate once it has grown
+  fMass = mass;
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fE.clear();
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fMCPDG.clear();
+  fMCPx.clear();
+  fMCPy.clear();
+  fMCPz.clear();
+  fFirstDaug.clear();
+  fDaugEta.clear();
+  fFirstRad.clear();
+  fPhiAtRad.clear();
+  fFirstRad.push_back(0);
+  for (auto itPart = Particles.begin(); itPart != Particles.end(); ++itPart) {
+    const TVector3 mom = itPart->GetMomentum();
+    fPx.push_back(mom.X());
+    fPy.push_back(mom.Y());
+    fPz.push_back(mom.Z());
+    fE.push_back(std::sqrt(mom.Mag2() + (double) mass * mass));
+    fPt.push_back(itPart->GetPt());
+    const std::vector<float> eta = itPart->GetEta();
+    const std::vector<float> phi = itPart->GetPhi();
+    fEta.push_back(eta.size() > 0 ? eta[0] : 0.f);
+    fPhi.push_back(phi.size() > 0 ? phi[0] : 0.f);
+    const TVector3 mcMom = itPart->GetMCMomentum();
+    fMCPDG.push_back(itPart->GetMCPDGCode());
+    fMCPx.push_back(mcMom.X());
+    fMCPy.push_back(mcMom.Y());
+    fMCPz.push_back(mcMom.Z());
+    fFirstDaug.push_back(fDaugEta.size());
+    //if nDaug == 1 => Single Track, else decay
+    const std::vector<std::vector<float>> phiAtRad = itPart->GetPhiAtRaidius();
+    const unsigned int nDaug = phiAtRad.size();
+    for (unsigned int iDaug = 0; iDaug < nDaug; ++iDaug) {
+      const unsigned int iEta = (nDaug == 1) ? 0 : iDaug + 1;
+      fDaugEta.push_back(iEta < eta.size() ? eta[iEta] : 0.f);
+      fPhiAtRad.insert(fPhiAtRad.end(), phiAtRad[iDaug].begin(),
+                       phiAtRad[iDaug].end());
+      fFirstRad.push_back(fPhiAtRad.size());
+    }
+  }
+  fFirstDaug.push_back(fDaugEta.size());
+}
+
+void AliFemtoDreamPackedParts::PairObservables(double px1, double py1,
+                                               double pz1, double e1,
+                                               double m1, double px2,
+                                               double py2, double pz2,
+                                               double e2, double m2,
+                                               float &kStar, float &kT,
+                                               float &mT) {
+  //k* is the momentum of either particle in the pair rest frame. With
+  //P = p1 + p2, q = p1 - p2 and q*P = m1^2 - m2^2 it is
+  //k*^2 = ((m1^2 - m2^2)^2 / P^2 - q^2) / 4,
+  //which needs no boost and stays precise for small q
+  const double sumX = px1 + px2;
+  const double sumY = py1 + py2;
+  const double sumZ = pz1 + pz2;
+  const double sumE = e1 + e2;
+  const double diffX = px1 - px2;
+  const double diffY = py1 - py2;
+  const double diffZ = pz1 - pz2;
+  const double diffE = e1 - e2;
+  const double s = sumE * sumE - (sumX * sumX + sumY * sumY + sumZ * sumZ);
+  const double q2 = diffE * diffE
+      - (diffX * diffX + diffY * diffY + diffZ * diffZ);
+  const double deltaM2 = m1 * m1 - m2 * m2;
+  const double kStar2 = (s > 0.) ? 0.25 * (deltaM2 * deltaM2 / s - q2) : 0.;
+  kStar = (kStar2 > 0.) ? std::sqrt(kStar2) : 0.;
+  const double pairKT = 0.5 * std::sqrt(sumX * sumX + sumY * sumY);
+  const double averageMass = 0.5 * (m1 + m2);
+  kT = pairKT;
+  mT = std::sqrt(pairKT * pairKT + averageMass * averageMass);
+}
+
+float AliFemtoDreamPackedParts::MCRelativePairMomentum(
+    int i1, const AliFemtoDreamPackedParts &parts2, int i2) const {
+  const double m1 = fMass;
+  const double m2 = parts2.fMass;
+  const double px1 = fMCPx[i1];
+  const double py1 = fMCPy[i1];
+  const double pz1 = fMCPz[i1];
+  const double px2 = parts2.fMCPx[i2];
+  const double py2 = parts2.fMCPy[i2];
+  const double pz2 = parts2.fMCPz[i2];
+  float kStar = 0;
+  float kT = 0;
+  float mT = 0;
+  PairObservables(px1, py1, pz1,
+                  std::sqrt(px1 * px1 + py1 * py1 + pz1 * pz1 + m1 * m1), m1,
+                  px2, py2, pz2,
+                  std::sqrt(px2 * px2 + py2 * py2 + pz2 * pz2 + m2 * m2), m2,
+                  kStar, kT, mT);
+  return kStar;
+}
+
+void AliFemtoDreamPackedParts::ClosePairMask(
+    int i1, const AliFemtoDreamPackedParts &parts2, int first, float maxDist,
+    std::vector<char> &pass) const {
+  //Sets pass[i2] for all i2 >= first of parts2: false if any daughter
+  //combination comes closer than sqrt(maxDist) in (dphi*, deta) at any of the
+  //common radii. Daughter pairs already separated in eta skip the radii.
+  static const float pi = TMath::Pi();
+  static const float twoPi = 2. * TMath::Pi();
+  const int nPart2 = parts2.GetSize();
+  pass.resize(nPart2);
+  const int firstDaug1 = fFirstDaug[i1];
+  const int lastDaug1 = fFirstDaug[i1 + 1];
+  for (int i2 = first; i2 < nPart2; ++i2) {
+    bool close = false;
+    const int firstDaug2 = parts2.fFirstDaug[i2];
+    const int lastDaug2 = parts2.fFirstDaug[i2 + 1];
+    for (int iDaug1 = firstDaug1; iDaug1 < lastDaug1 && !close; ++iDaug1) {
+      const float *phi1 = fPhiAtRad.data() + fFirstRad[iDaug1];
+      const int nRad1 = fFirstRad[iDaug1 + 1] - fFirstRad[iDaug1];
+      for (int iDaug2 = firstDaug2; iDaug2 < lastDaug2 && !close; ++iDaug2) {
+        const float deta = fDaugEta[iDaug1] - parts2.fDaugEta[iDaug2];
+        const float deta2 = deta * deta;
+        if (deta2 >= maxDist) {
+          continue;
+        }
+        const float *phi2 = parts2.fPhiAtRad.data() + parts2.fFirstRad[iDaug2];
+        const int nRad2 = parts2.fFirstRad[iDaug2 + 1]
+            - parts2.fFirstRad[iDaug2];
+        const int nRad = (nRad1 > nRad2) ? nRad2 : nRad1;
+        bool closeAtRad = false;
+        for (int iRad = 0; iRad < nRad; ++iRad) {
+          float dphi = phi1[iRad] - phi2[iRad];
+          dphi = (dphi > pi) ? dphi - twoPi : ((dphi < -pi) ? dphi + twoPi : dphi);
+          dphi = (dphi > pi) ? dphi - twoPi : ((dphi < -pi) ? dphi + twoPi : dphi);
+          closeAtRad |= (dphi * dphi + deta2 < maxDist);
+        }
+        close = closeAtRad;
+      }
+    }
+    pass[i2] = !close;
+  }
+}
@@ -0,0 +1,100 @@
+/*
+ * AliFemtoDreamPackedParts.h
+ *
+ *  Packed (structure of arrays) copy of the particles of one species in one
+ *  event, holding only what is needed to pair them. Refilling or assigning
+ *  an existing object reuses its storage, which is what the mixing buffers
+ *  rely on.
+ */
+
+#ifndef ALIFEMTODREAMPACKEDPARTS_H_
+#define ALIFEMTODREAMPACKEDPARTS_H_
+#include <vector>
+#include "Rtypes.h"
+
+#include "AliFemtoDreamBasePart.h"
+
+class AliFemtoDreamPackedParts {
+ public:
+  AliFemtoDreamPackedParts();
+  virtual ~AliFemtoDreamPackedParts();
+  void Fill(const std::vector<AliFemtoDreamBasePart> &Particles, float mass);
+  unsigned int GetSize() const {
+    return fPx.size();
+  }
+  ;
+  float GetPt(int i) const {
+    return fPt[i];
+  }
+  ;
+  float GetEta(int i) const {
+    return fEta[i];
+  }
+  ;
+  float GetPhi(int i) const {
+    return fPhi[i];
+  }
+  ;
+  int GetMCPDGCode(int i) const {
+    return fMCPDG[i];
+  }
+  ;
+  // k* from the MC momenta of the pair
+  float MCRelativePairMomentum(int i1, const AliFemtoDreamPackedParts &parts2,
+                               int i2) const;
+  int GetNDaughters(int i) const {
+    return fFirstDaug[i + 1] - fFirstDaug[i];
+  }
+  ;
+  float GetDaughterEta(int i, int iDaug) const {
+    return fDaugEta[fFirstDaug[i] + iDaug];
+  }
+  ;
+  int GetNRadii(int i, int iDaug) const {
+    return fFirstRad[fFirstDaug[i] + iDaug + 1] - fFirstRad[fFirstDaug[i] + iDaug];
+  }
+  ;
+  const float *GetPhiAtRadius(int i, int iDaug) const {
+    return fPhiAtRad.data() + fFirstRad[fFirstDaug[i] + iDaug];
+  }
+  ;
+  // k*, kT and mT of the pair (i1 of this, i2 of parts2) in one go
+  void PairObservables(int i1, const AliFemtoDreamPackedParts &parts2, int i2,
+                       float &kStar, float &kT, float &mT) const {
+    PairObservables(fPx[i1], fPy[i1], fPz[i1], fE[i1], fMass,
+                    parts2.fPx[i2], parts2.fPy[i2], parts2.fPz[i2],
+                    parts2.fE[i2], parts2.fMass, kStar, kT, mT);
+  }
+  ;
+  static void PairObservables(double px1, double py1, double pz1, double e1,
+                              double m1, double px2, double py2, double pz2,
+                              double e2, double m2, float &kStar, float &kT,
+                              float &mT);
+  void ClosePairMask(int i1, const AliFemtoDreamPackedParts &parts2,
+                     int first, float maxDist, std::vector<char> &pass) const;
+ private:
+  float fMass;
+  // one entry per particle
+  std::vector<float> fPx;
+  std::vector<float> fPy;
+  std::vector<float> fPz;
+  std::vector<float> fE;
+  std::vector<float> fPt;
+  std::vector<float> fEta;
+  std::vector<float> fPhi;
+  std::vector<int> fMCPDG;
+  std::vector<float> fMCPx;
+  std::vector<float> fMCPy;
+  std::vector<float> fMCPz;
+  std::vector<int> fFirstDaug;   // size+1 entries, daughters of i are [fFirstDaug[i],fFirstDaug[i+1])
+  // one entry per daughter (the particle itself for single tracks)
+  std::vector<float> fDaugEta;
+  std::vector<int> fFirstRad;    // phi* of daughter d are [fFirstRad[d],fFirstRad[d+1])
+  // phi* at the TPC radii of all daughters
+  std::vector<float> fPhiAtRad;
+
+ClassDef(AliFemtoDreamPackedParts, 2)
+  ;
+};
+
+#endif /* ALIFEMTODREAMPACKEDPARTS_H_ */
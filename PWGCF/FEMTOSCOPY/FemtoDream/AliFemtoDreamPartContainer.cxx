@@ -7,18 +7,20 @@
 
 #include <iostream>
 #include "AliFemtoDreamPartContainer.h"
-#include "TLorentzVector.h"
-#include "TVector3.h"
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
-      fMixingDepth(0) {
+      fMixingDepth(0),
+      fFirstEvent(0),
+      fNEvents(0) {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
-    : fPartBuffer(),
-      fMixingDepth(MixingDepth) {
+    : fPartBuffer(MixingDepth),
+      fMixingDepth(MixingDepth),
+      fFirstEvent(0),
+      fNEvents(0) {
 
 }
 
@@ -36,6 +38,8 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
 //  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fFirstEvent = obj.fFirstEvent;
+  this->fNEvents = obj.fNEvents;
   return (*this);
 }
 
@@ -43,32 +47,35 @@ AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 }
 
 void AliFemtoDreamPartContainer::SetEvent(
-    std::vector<AliFemtoDreamBasePart> &Particles) {
-  if (!(fPartBuffer.size() < fMixingDepth)) {
-//    std::cout << "Popping Front" << std::endl;
-    fPartBuffer.pop_front();
+    std::vector<AliFemtoDreamBasePart> &Particles, float mass) {
+  if (fMixingDepth == 0) {
+    return;
+  }
+  unsigned int slot;
+  if (!(fNEvents < fMixingDepth)) {
+    //Overwrite the oldest event, which becomes the newest one
+    slot = fFirstEvent;
+    fFirstEvent = (fFirstEvent + 1) % fMixingDepth;
+  } else {
+    slot = (fFirstEvent + fNEvents) % fMixingDepth;
+    ++fNEvents;
   }
-  fPartBuffer.push_back(Particles);
-//  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
-//      << Particles.size() << '\n';
+  fPartBuffer[slot].Fill(Particles, mass);
   return;
 }
 
 void AliFemtoDreamPartContainer::PrintLastEvent() {
-  for (std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
-      fPartBuffer.begin(); itEvt != fPartBuffer.end(); ++itEvt) {
-    std::cout << "Printing Last Event with size: " << itEvt->size() << '\n';
-    for (std::vector<AliFemtoDreamBasePart>::iterator itPart = itEvt->begin();
-        itPart != itEvt->end(); ++itPart) {
-      TVector3 P(itPart->GetMomentum());
-      std::cout << "Px: " << P.X() << '\t' << "Py: " << P.Y() << '\t' << "Pz: "
-                << P.Z() << std::endl;
+  for (unsigned int iEvt = 0; iEvt < fNEvents; ++iEvt) {
+    const AliFemtoDreamPackedParts &Evt = GetEvent(iEvt);
+    std::cout << "Printing Last Event with size: " << Evt.GetSize() << '\n';
+    for (unsigned int iPart = 0; iPart < Evt.GetSize(); ++iPart) {
+      std::cout << "Pt: " << Evt.GetPt(iPart) << '\t' << "Eta: "
+                << Evt.GetEta(iPart) << '\t' << "Phi: " << Evt.GetPhi(iPart)
+                << std::endl;
     }
   }
 }
-std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
-    int Depth) {
-  std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt = fPartBuffer
-      .begin() + Depth;
-  return *itEvt;
+const AliFemtoDreamPackedParts &AliFemtoDreamPartContainer::GetEvent(
+    int Depth) const {
+  return fPartBuffer[(fFirstEvent + Depth) % fMixingDepth];
 }
@@ -7,15 +7,16 @@
 
 #ifndef ALIFEMTODREAMPARTCONTAINER_H_
 #define ALIFEMTODREAMPARTCONTAINER_H_
-#include <deque>
 #include <vector>
 #include "Rtypes.h"
 
-#include "AliFemtoDreamBasePart.h"
+#include "AliFemtoDreamPackedParts.h"
 
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
+//The events are kept in a ring of packed slots: once the buffer is full the
+//oldest slot is overwritten in place, so its storage gets recycled.
 class AliFemtoDreamPartContainer {
  public:
   AliFemtoDreamPartContainer();
@@ -23,19 +24,18 @@ class AliFemtoDreamPartContainer {
   AliFemtoDreamPartContainer& operator=(const AliFemtoDreamPartContainer& obj);
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
-  void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
-    return fPartBuffer;
-  }
-  ;
-  std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles, float mass);
+  //Depth 0 is the oldest event in the buffer
+  const AliFemtoDreamPackedParts &GetEvent(int Depth) const;
   unsigned int GetMixingDepth() const {
-    return fPartBuffer.size();
+    return fNEvents;
   }
   ;
  private:
-  std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  std::vector<AliFemtoDreamPackedParts> fPartBuffer;
+  unsigned int fMixingDepth;
+  unsigned int fFirstEvent;
+  unsigned int fNEvents;ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
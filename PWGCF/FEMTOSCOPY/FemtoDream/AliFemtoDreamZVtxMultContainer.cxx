@@ -7,21 +7,22 @@
 //#include "AliLog.h"
 #include <iostream>
 #include "AliFemtoDreamZVtxMultContainer.h"
-#include "TLorentzVector.h"
 #include "TDatabasePDG.h"
-#include "TVector2.h"
 
 ClassImp(AliFemtoDreamPartContainer)
 static const float piHi = TMath::Pi();
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
     : fPartContainer(0),
       fPDGParticleSpecies(0),
+      fMassParticleSpecies(0),
       fWhichPairs(),
       fRejPairs(),
       fDeltaEtaMax(0.f),
       fDeltaPhiMax(0.f),
       fDeltaPhiEtaMax(0.f),
-      fDoDeltaEtaDeltaPhiCut(false) {
+      fDoDeltaEtaDeltaPhiCut(false),
+      fPackedEvent(),
+      fPairPass() {
 
 }
 
@@ -30,13 +31,28 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
     : fPartContainer(conf->GetNParticles(),
                      AliFemtoDreamPartContainer(conf->GetMixingDepth())),
       fPDGParticleSpecies(conf->GetPDGCodes()),
+      fMassParticleSpecies(),
       fWhichPairs(conf->GetWhichPairs()),
       fRejPairs(conf->GetClosePairRej()),
       fDeltaEtaMax(conf->GetDeltaEtaMax()),
       fDeltaPhiMax(conf->GetDeltaPhiMax()),
       fDeltaPhiEtaMax(
           fDeltaPhiMax * fDeltaPhiMax + fDeltaEtaMax * fDeltaEtaMax),
-      fDoDeltaEtaDeltaPhiCut(conf->GetDoDeltaEtaDeltaPhiCut()) {
+      fDoDeltaEtaDeltaPhiCut(conf->GetDoDeltaEtaDeltaPhiCut()),
+      fPackedEvent(conf->GetNParticles()),
+      fPairPass() {
+  //The masses are looked up once here instead of for every pair
+  for (auto itPDG = fPDGParticleSpecies.begin();
+      itPDG != fPDGParticleSpecies.end(); ++itPDG) {
+    TParticlePDG *pdgPart =
+        (*itPDG != 0) ? TDatabasePDG::Instance()->GetParticle(*itPDG) : 0;
+    if (!pdgPart) {
+      AliError("Invalid PDG Code");
+      fMassParticleSpecies.push_back(0.f);
+    } else {
+      fMassParticleSpecies.push_back(pdgPart->Mass());
+    }
+  }
 }
 
 AliFemtoDreamZVtxMultContainer::~AliFemtoDreamZVtxMultContainer() {
@@ -57,65 +73,72 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
       .begin();
   std::vector<AliFemtoDreamPartContainer>::iterator itContainer = fPartContainer
       .begin();
+  std::vector<float>::iterator itMass = fMassParticleSpecies.begin();
   while (itContainer != fPartContainer.end()) {
     if (itInput->size() > 0) {
-      itContainer->SetEvent(*itInput);
+      itContainer->SetEvent(*itInput, *itMass);
     }
     ++itInput;
     ++itContainer;
+    ++itMass;
   }
   //  }
 }
+void AliFemtoDreamZVtxMultContainer::PackEvent(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles) {
+  //Copies momentum, eta, phi and phi* of the current event into the packed
+  //per species buffers which are used in the pair loops
+  auto itPacked = fPackedEvent.begin();
+  auto itMass = fMassParticleSpecies.begin();
+  for (auto itSpec = Particles.begin();
+      itSpec != Particles.end() && itPacked != fPackedEvent.end();
+      ++itSpec, ++itPacked, ++itMass) {
+    itPacked->Fill(*itSpec, *itMass);
+  }
+}
+
 void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamCorrHists *ResultsHist, int iMult, float cent) {
   float RelativeK = 0;
+  float pairkT = 0;
+  float pairmT = 0;
   int HistCounter = 0;
+  PackEvent(Particles);
   //First loop over all the different Species
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
-  for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
-      ++itSpec1) {
-    auto itPDGPar2 = fPDGParticleSpecies.begin();
-    itPDGPar2 += itSpec1 - Particles.begin();
-    for (auto itSpec2 = itSpec1; itSpec2 != Particles.end(); ++itSpec2) {
-      ResultsHist->FillPartnersSE(HistCounter, itSpec1->size(),
-                                  itSpec2->size());
+  for (unsigned int iSpec1 = 0; iSpec1 < Particles.size(); ++iSpec1) {
+    std::vector<AliFemtoDreamBasePart> &Spec1 = Particles[iSpec1];
+    const AliFemtoDreamPackedParts &Packed1 = fPackedEvent[iSpec1];
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < Particles.size(); ++iSpec2) {
+      std::vector<AliFemtoDreamBasePart> &Spec2 = Particles[iSpec2];
+      const AliFemtoDreamPackedParts &Packed2 = fPackedEvent[iSpec2];
+      ResultsHist->FillPartnersSE(HistCounter, Spec1.size(), Spec2.size());
       //Now loop over the actual Particles and correlate them
       unsigned int DoThisPair = fWhichPairs.at(HistCounter);
       bool fillHists = DoThisPair > 0 ? true : false;
-      bool CPR = fRejPairs.at(HistCounter);
-      for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-          ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
-        std::vector<AliFemtoDreamBasePart>::iterator itPart2;
-        if (itSpec1 == itSpec2) {
-          itPart2 = itPart1 + 1;
-        } else {
-          itPart2 = itSpec2->begin();
+      bool CPR = fDoDeltaEtaDeltaPhiCut && fRejPairs.at(HistCounter);
+      for (int iPart1 = 0; iPart1 < (int) Packed1.GetSize(); ++iPart1) {
+        const int firstPart2 = (iSpec1 == iSpec2) ? iPart1 + 1 : 0;
+        // Delta eta - Delta phi* cut for all partners at once
+        if (CPR) {
+          Packed1.ClosePairMask(iPart1, Packed2, firstPart2, fDeltaPhiEtaMax,
+                                fPairPass);
         }
-        while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
-          // Delta eta - Delta phi* cut
-          if (fDoDeltaEtaDeltaPhiCut && CPR) {
-            if (!RejectClosePairs(part1, part2)) {
-              ++itPart2;
-              continue;
-            }
+        for (int iPart2 = firstPart2; iPart2 < (int) Packed2.GetSize();
+            ++iPart2) {
+          if (CPR && !fPairPass[iPart2]) {
+            continue;
           }
-          RelativeK = RelativePairMomentum(itPart1->GetMomentum(), *itPDGPar1,
-                                           itPart2->GetMomentum(), *itPDGPar2);
+          Packed1.PairObservables(iPart1, Packed2, iPart2, RelativeK, pairkT,
+                                  pairmT);
           if (fillHists && ResultsHist->GetEtaPhiPlots()) {
-            DeltaEtaDeltaPhi(HistCounter, part1, part2, true, ResultsHist,
-                             RelativeK);
+            DeltaEtaDeltaPhi(HistCounter, Packed1, iPart1, Packed2, iPart2,
+                             true, ResultsHist, RelativeK);
           }
           if (fillHists && ResultsHist->GetDodPhidEtaPlots()) {
-            float deta = itPart1->GetEta().at(0) - itPart2->GetEta().at(0);
-            float dphi = itPart1->GetPhi().at(0) - itPart2->GetPhi().at(0);
-            float mT =
-                ResultsHist->GetDodPhidEtamTPlots() ?
-                    RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                                   itPart2->GetMomentum(), *itPDGPar2) :
-                    0;
+            float deta = Packed1.GetEta(iPart1) - Packed2.GetEta(iPart2);
+            float dphi = Packed1.GetPhi(iPart1) - Packed2.GetPhi(iPart2);
+            float mT = ResultsHist->GetDodPhidEtamTPlots() ? pairmT : 0;
             if (dphi < 0) {
               ResultsHist->FilldPhidEtaSE(HistCounter, dphi + 2 * TMath::Pi(),
                                           deta, mT);
@@ -133,30 +156,21 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
             ResultsHist->FillSameEventCentDist(HistCounter, cent, RelativeK);
           }
           if (fillHists && ResultsHist->GetDokTBinning()) {
-            ResultsHist->FillSameEventkTDist(
-                HistCounter,
-                RelativePairkT(itPart1->GetMomentum(), *itPDGPar1,
-                               itPart2->GetMomentum(), *itPDGPar2),
-                RelativeK, cent);
+            ResultsHist->FillSameEventkTDist(HistCounter, pairkT, RelativeK,
+                                             cent);
           }
           if (fillHists && ResultsHist->GetDomTBinning()) {
-            ResultsHist->FillSameEventmTDist(
-                HistCounter,
-                RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                               itPart2->GetMomentum(), *itPDGPar2),
-                RelativeK);
+            ResultsHist->FillSameEventmTDist(HistCounter, pairmT, RelativeK);
           }
           if (fillHists && ResultsHist->GetDoPtQA()) {
-            ResultsHist->FillPtQADist(HistCounter, RelativeK, itPart1->GetPt(),
-                                      itPart2->GetPt());
+            ResultsHist->FillPtQADist(HistCounter, RelativeK,
+                                      Packed1.GetPt(iPart1),
+                                      Packed2.GetPt(iPart2));
           }
-          ++itPart2;
         }
       }
       ++HistCounter;
-      itPDGPar2++;
     }
-    itPDGPar1++;
   }
 }
 
@@ -164,56 +178,53 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamCorrHists *ResultsHist, int iMult, float cent) {
   float RelativeK = 0;
+  float pairkT = 0;
+  float pairmT = 0;
   int HistCounter = 0;
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
+  PackEvent(Particles);
   //First loop over all the different Species
-  for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
-      ++itSpec1) {
+  for (unsigned int iSpec1 = 0; iSpec1 < Particles.size(); ++iSpec1) {
+    std::vector<AliFemtoDreamBasePart> &Spec1 = Particles[iSpec1];
+    const AliFemtoDreamPackedParts &Packed1 = fPackedEvent[iSpec1];
     //We dont want to correlate the particles twice. Mixed Event Dist. of
     //Particle1 + Particle2 == Particle2 + Particle 1
-    int SkipPart = itSpec1 - Particles.begin();
-    auto itPDGPar2 = fPDGParticleSpecies.begin() + SkipPart;
-    for (auto itSpec2 = fPartContainer.begin() + SkipPart;
-        itSpec2 != fPartContainer.end(); ++itSpec2) {
-      if (itSpec1->size() > 0) {
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < fPartContainer.size();
+        ++iSpec2) {
+      AliFemtoDreamPartContainer &Spec2 = fPartContainer[iSpec2];
+      const int pdg1 = fPDGParticleSpecies[iSpec1];
+      const int pdg2 = fPDGParticleSpecies[iSpec2];
+      if (Spec1.size() > 0) {
         ResultsHist->FillEffectiveMixingDepth(HistCounter,
-                                              (int) itSpec2->GetMixingDepth());
+                                              (int) Spec2.GetMixingDepth());
       }
       unsigned int DoThisPair = fWhichPairs.at(HistCounter);
       bool fillHists = DoThisPair > 0 ? true : false;
-      bool CPR = fRejPairs.at(HistCounter);
-      for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
-            iDepth);
-        ResultsHist->FillPartnersME(HistCounter, itSpec1->size(),
-                                    ParticlesOfEvent.size());
-        for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-            ++itPart1) {
-          AliFemtoDreamBasePart part1 = *itPart1;
-          for (auto itPart2 = ParticlesOfEvent.begin();
-              itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-            AliFemtoDreamBasePart part2 = *itPart2;
-            // Delta eta - Delta phi* cut
-            if (fDoDeltaEtaDeltaPhiCut && CPR) {
-              if (!RejectClosePairs(part1, part2)) {
-                continue;
-              }
+      bool CPR = fDoDeltaEtaDeltaPhiCut && fRejPairs.at(HistCounter);
+      for (int iDepth = 0; iDepth < (int) Spec2.GetMixingDepth(); ++iDepth) {
+        const AliFemtoDreamPackedParts &Packed2 = Spec2.GetEvent(iDepth);
+        ResultsHist->FillPartnersME(HistCounter, Spec1.size(),
+                                    Packed2.GetSize());
+        for (int iPart1 = 0; iPart1 < (int) Packed1.GetSize(); ++iPart1) {
+          // Delta eta - Delta phi* cut for all partners at once
+          if (CPR) {
+            Packed1.ClosePairMask(iPart1, Packed2, 0, fDeltaPhiEtaMax,
+                                  fPairPass);
+          }
+          for (int iPart2 = 0; iPart2 < (int) Packed2.GetSize();
+              ++iPart2) {
+            if (CPR && !fPairPass[iPart2]) {
+              continue;
             }
-            RelativeK = RelativePairMomentum(itPart1->GetMomentum(), *itPDGPar1,
-                                             itPart2->GetMomentum(),
-                                             *itPDGPar2);
+            Packed1.PairObservables(iPart1, Packed2, iPart2, RelativeK,
+                                    pairkT, pairmT);
             if (fillHists && ResultsHist->GetEtaPhiPlots()) {
-              DeltaEtaDeltaPhi(HistCounter, part1, part2, false, ResultsHist,
-                               RelativeK);
+              DeltaEtaDeltaPhi(HistCounter, Packed1, iPart1, Packed2, iPart2,
+                               false, ResultsHist, RelativeK);
             }
             if (fillHists && ResultsHist->GetDodPhidEtaPlots()) {
-              float deta = itPart1->GetEta().at(0) - itPart2->GetEta().at(0);
-              float dphi = itPart1->GetPhi().at(0) - itPart2->GetPhi().at(0);
-              float mT =
-                  ResultsHist->GetDodPhidEtamTPlots() ?
-                      RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                                     itPart2->GetMomentum(), *itPDGPar2) :
-                      0;
+              float deta = Packed1.GetEta(iPart1) - Packed2.GetEta(iPart2);
+              float dphi = Packed1.GetPhi(iPart1) - Packed2.GetPhi(iPart2);
+              float mT = ResultsHist->GetDodPhidEtamTPlots() ? pairmT : 0;
               if (dphi < 0) {
                 ResultsHist->FilldPhidEtaME(HistCounter, dphi + 2 * TMath::Pi(),
                                             deta, mT);
@@ -231,18 +242,11 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
               ResultsHist->FillMixedEventCentDist(HistCounter, cent, RelativeK);
             }
             if (fillHists && ResultsHist->GetDokTBinning()) {
-              ResultsHist->FillMixedEventkTDist(
-                  HistCounter,
-                  RelativePairkT(itPart1->GetMomentum(), *itPDGPar1,
-                                 itPart2->GetMomentum(), *itPDGPar2),
-                  RelativeK, cent);
+              ResultsHist->FillMixedEventkTDist(HistCounter, pairkT, RelativeK,
+                                                cent);
             }
             if (fillHists && ResultsHist->GetDomTBinning()) {
-              ResultsHist->FillMixedEventmTDist(
-                  HistCounter,
-                  RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                                 itPart2->GetMomentum(), *itPDGPar2),
-                  RelativeK);
+              ResultsHist->FillMixedEventmTDist(HistCounter, pairmT, RelativeK);
             }
             if (fillHists && ResultsHist->GetObtainMomentumResolution()) {
               //It is sufficient to do this in Mixed events, which allows
@@ -250,12 +254,10 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
               //of the pairs does not change event by event.
               //Now we only want to use the momentum of particles we are after, hence
               //we check the PDG Code!
-              if ((*itPDGPar1 == TMath::Abs(itPart1->GetMCPDGCode()))
-                  && ((*itPDGPar2 == TMath::Abs(itPart2->GetMCPDGCode())))) {
-                float RelKTrue = RelativePairMomentum(itPart1->GetMCMomentum(),
-                                                      *itPDGPar1,
-                                                      itPart2->GetMCMomentum(),
-                                                      *itPDGPar2);
+              if ((pdg1 == TMath::Abs(Packed1.GetMCPDGCode(iPart1)))
+                  && ((pdg2 == TMath::Abs(Packed2.GetMCPDGCode(iPart2))))) {
+                float RelKTrue = Packed1.MCRelativePairMomentum(iPart1, Packed2,
+                                                                iPart2);
                 ResultsHist->FillMomentumResolution(HistCounter, RelKTrue,
                                                     RelativeK);
               }
@@ -264,91 +266,14 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
         }
       }
       ++HistCounter;
-      ++itPDGPar2;
     }
-    ++itPDGPar1;
-  }
-}
-float AliFemtoDreamZVtxMultContainer::RelativePairMomentum(
-    TVector3 Part1Momentum, int PDGPart1, TVector3 Part2Momentum,
-    int PDGPart2) {
-  if (PDGPart1 == 0 || PDGPart2 == 0) {
-    AliError("Invalid PDG Code");
   }
-  float results = 0.;
-  TLorentzVector SPtrack, TPProng, trackSum, SPtrackCMS, TPProngCMS;
-  //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
-  //only looking at the mother mass
-  SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
-  TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  trackSum = SPtrack + TPProng;
-
-  float beta = trackSum.Beta();
-  float betax = beta * cos(trackSum.Phi()) * sin(trackSum.Theta());
-  float betay = beta * sin(trackSum.Phi()) * sin(trackSum.Theta());
-  float betaz = beta * cos(trackSum.Theta());
-
-  SPtrackCMS = SPtrack;
-  TPProngCMS = TPProng;
-
-  SPtrackCMS.Boost(-betax, -betay, -betaz);
-  TPProngCMS.Boost(-betax, -betay, -betaz);
-
-  TLorentzVector trackRelK;
-
-  trackRelK = SPtrackCMS - TPProngCMS;
-  results = 0.5 * trackRelK.P();
-  return results;
-}
-float AliFemtoDreamZVtxMultContainer::RelativePairkT(TVector3 Part1Momentum,
-                                                     int PDGPart1,
-                                                     TVector3 Part2Momentum,
-                                                     int PDGPart2) {
-  if (PDGPart1 == 0 || PDGPart2 == 0) {
-    AliError("Invalid PDG Code");
-  }
-  float results = 0.;
-  TLorentzVector SPtrack, TPProng, trackSum;
-  //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
-  //only looking at the mother mass
-  SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
-  TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  trackSum = SPtrack + TPProng;
-
-  results = 0.5 * trackSum.Pt();
-  return results;
-}
-float AliFemtoDreamZVtxMultContainer::RelativePairmT(TVector3 Part1Momentum,
-                                                     int PDGPart1,
-                                                     TVector3 Part2Momentum,
-                                                     int PDGPart2) {
-  if (PDGPart1 == 0 || PDGPart2 == 0) {
-    AliError("Invalid PDG Code");
-  }
-  float results = 0.;
-  TLorentzVector SPtrack, TPProng, trackSum;
-  //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
-  //only looking at the mother mass
-  SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
-  TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  trackSum = SPtrack + TPProng;
-  float pairKT = 0.5 * trackSum.Pt();
-  float averageMass = 0.5
-      * (TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass()
-          + TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  results = TMath::Sqrt(pow(pairKT, 2.) + pow(averageMass, 2.));
-  return results;
 }
 
 void AliFemtoDreamZVtxMultContainer::DeltaEtaDeltaPhi(
-    int Hist, AliFemtoDreamBasePart &part1, AliFemtoDreamBasePart &part2,
-    bool SEorME, AliFemtoDreamCorrHists *ResultsHist, float relk) {
+    int Hist, const AliFemtoDreamPackedParts &parts1, int iPart1,
+    const AliFemtoDreamPackedParts &parts2, int iPart2, bool SEorME,
+    AliFemtoDreamCorrHists *ResultsHist, float relk) {
   //used to check for track splitting/merging
   //this function only produces meaningful results for track with x Daughter
   //looking at this quantity makes only sense anyways for Track - Track not
@@ -359,33 +284,22 @@ void AliFemtoDreamZVtxMultContainer::DeltaEtaDeltaPhi(
   if (nDaug1 > 9) {
     AliWarning("you are doing something wrong \n");
   }
-  unsigned int nDaug2 = (unsigned int) DoThisPair % 10;
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
+  if (nDaug1 > (unsigned int) parts1.GetNDaughters(iPart1)) {
+    nDaug1 = parts1.GetNDaughters(iPart1);
+  }
   for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
-    float etaPar1;
-    if (nDaug1 == 1) {
-      etaPar1 = eta1.at(0);
-    } else {
-      etaPar1 = eta1.at(iDaug1 + 1);
-    }
-    for (unsigned int iDaug2 = 0; iDaug2 < part2.GetPhiAtRaidius().size();
-        ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
-      float etaPar2;
-      if (nDaug2 == 1) {
-        etaPar2 = eta2.at(0);
-      } else {
-        etaPar2 = eta2.at(iDaug2 + 1);
-      }
+    const float *PhiAtRad1 = parts1.GetPhiAtRadius(iPart1, iDaug1);
+    float etaPar1 = parts1.GetDaughterEta(iPart1, iDaug1);
+    for (int iDaug2 = 0; iDaug2 < parts2.GetNDaughters(iPart2); ++iDaug2) {
+      const float *phiAtRad2 = parts2.GetPhiAtRadius(iPart2, iDaug2);
+      float etaPar2 = parts2.GetDaughterEta(iPart2, iDaug2);
       float deta = etaPar1 - etaPar2;
-      const int size =
-          (PhiAtRad1.size() > phiAtRad2.size()) ?
-              phiAtRad2.size() : PhiAtRad1.size();
+      const int nRad1 = parts1.GetNRadii(iPart1, iDaug1);
+      const int nRad2 = parts2.GetNRadii(iPart2, iDaug2);
+      const int size = (nRad1 > nRad2) ? nRad2 : nRad1;
       float dphiAvg = 0;
       for (int iRad = 0; iRad < size; ++iRad) {
-        float dphi = PhiAtRad1.at(iRad) - phiAtRad2.at(iRad);
+        float dphi = PhiAtRad1[iRad] - phiAtRad2[iRad];
         dphiAvg += dphi;
         if (dphi > piHi) {
           dphi += -piHi * 2;
@@ -433,53 +347,3 @@ float AliFemtoDreamZVtxMultContainer::ComputeDeltaPhi(
   }
   return dphi;
 }
-
-bool AliFemtoDreamZVtxMultContainer::RejectClosePairs(
-    AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2) {
-  bool outBool = true;
-  //Method calculates the average separation between two tracks
-  //at different radii within the TPC and rejects pairs which a
-  //too low separation
-  unsigned int nDaug1 = part1.GetPhiAtRaidius().size();
-  unsigned int nDaug2 = part2.GetPhiAtRaidius().size();
-  // if nDaug == 1 => Single Track, else decay
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
-  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1 && outBool; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
-    float etaPar1;
-    if (nDaug1 == 1) {
-      etaPar1 = eta1.at(0);
-    } else {
-      etaPar1 = eta1.at(iDaug1 + 1);
-    }
-    for (unsigned int iDaug2 = 0;
-        iDaug2 < part2.GetPhiAtRaidius().size() && outBool; ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
-      float etaPar2;
-      if (nDaug2 == 1) {
-        etaPar2 = eta2.at(0);
-      } else {
-        etaPar2 = eta2.at(iDaug2 + 1);
-      }
-      float deta = etaPar1 - etaPar2;
-      const int size =
-          (PhiAtRad1.size() > phiAtRad2.size()) ?
-              phiAtRad2.size() : PhiAtRad1.size();
-      for (int iRad = 0; iRad < size; ++iRad) {
-        float dphi = PhiAtRad1.at(iRad) - phiAtRad2.at(iRad);
-        if (dphi > piHi) {
-          dphi += -piHi * 2;
-        } else if (dphi < -piHi) {
-          dphi += piHi * 2;
-        }
-        dphi = TVector2::Phi_mpi_pi(dphi);
-        if (dphi * dphi + deta * deta < fDeltaPhiEtaMax) {
-          outBool = false;
-          break;
-        }
-      }
-    }
-  }
-  return outBool;
-}
@@ -12,6 +12,7 @@
 
 #include "AliFemtoDreamCollConfig.h"
 #include "AliFemtoDreamCorrHists.h"
+#include "AliFemtoDreamPackedParts.h"
 #include "AliFemtoDreamPartContainer.h"
 //Class containing the array buffer of the different particle species for one
 //Multiplicity bin
@@ -26,8 +27,9 @@ class AliFemtoDreamZVtxMultContainer {
   void PairParticlesME(
       std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
       AliFemtoDreamCorrHists *ResultsHist, int iMult, float cent);
-  void DeltaEtaDeltaPhi(int Hist, AliFemtoDreamBasePart &part1,
-                        AliFemtoDreamBasePart &part2, bool SEorME,
+  void DeltaEtaDeltaPhi(int Hist, const AliFemtoDreamPackedParts &parts1,
+                        int iPart1, const AliFemtoDreamPackedParts &parts2,
+                        int iPart2, bool SEorME,
                         AliFemtoDreamCorrHists *ResultsHist, float relk);
   float ComputeDeltaEta(AliFemtoDreamBasePart &part1,
                         AliFemtoDreamBasePart &part2);
@@ -39,24 +41,20 @@ class AliFemtoDreamZVtxMultContainer {
   }
   ;
  private:
-  float RelativePairMomentum(TVector3 Part1Momentum, int PDGPart1,
-                             TVector3 Part2Momentum, int PDGPart2);
-  float RelativePairkT(TVector3 Part1Momentum, int PDGPart1,
-                       TVector3 Part2Momentum, int PDGPart2);
-  float RelativePairmT(TVector3 Part1Momentum, int PDGPart1,
-                       TVector3 Part2Momentum, int PDGPart2);
-  bool RejectClosePairs(AliFemtoDreamBasePart& part1,
-                        AliFemtoDreamBasePart& part2);
+  void PackEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
+  std::vector<float> fMassParticleSpecies;
   std::vector<unsigned int> fWhichPairs;
   std::vector<bool> fRejPairs;
   float fDeltaEtaMax;
   float fDeltaPhiMax;
   float fDeltaPhiEtaMax;
   bool fDoDeltaEtaDeltaPhiCut;
+  std::vector<AliFemtoDreamPackedParts> fPackedEvent;  //! current event, one entry per species
+  std::vector<char> fPairPass;                         //! close pair rejection result per partner
 
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+ClassDef(AliFemtoDreamZVtxMultContainer, 6)
   ;
 };
 
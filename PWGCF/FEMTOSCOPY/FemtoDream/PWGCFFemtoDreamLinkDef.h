@@ -25,6 +25,7 @@
 #pragma link C++ class AliFemtoDreamCollConfig+;
 #pragma link C++ class AliFemtoDreamCorrHists+;
 #pragma link C++ class AliFemtoDreamPartContainer+;
+#pragma link C++ class AliFemtoDreamPackedParts+;
 #pragma link C++ class AliFemtoDreamZVtxMultContainer+;
 #pragma link C++ class AliFemtoDreamPartCollection+;
 #pragma link C++ class AliFemtoDreamAnalysis+;
@@ -617,8 +617,20 @@ void AliAnalysisTaskTwoPwrtRP::UserCreateOutputObjects()
         }
 
 
+        // pair values are only needed if some two-particle correlation takes track 1 as first
+        // and track 2 as second particle
+        Bool_t usedAsFirst=kFALSE;
+        for(Int_t ic=0; ic<fNTwoPwrtRP; ic++) if(f1&(ULong_t(1)<<((UShort_t)(minTwoFlag+ ic)))) {usedAsFirst=kTRUE; break;}
+        if(!usedAsFirst) continue;
+
         for(it2=0; it2<nTracks; it2++){
           if(it==it2) continue;
+          Bool_t pairUsed=kFALSE;
+          for(Int_t ic=0; ic<fNTwoPwrtRP; ic++){
+            if((f1&(ULong_t(1)<<((UShort_t)(minTwoFlag+ ic))))
+                &&(trackMapFlag[it2]&(ULong_t(1)<<((UShort_t)(diffTwoFlag+ ic))))) {pairUsed=kTRUE; break;}
+          }
+          if(!pairUsed) continue;
           pt2    =trackMapPtEtaCharge[it2][0];
           eta2   =trackMapPtEtaCharge[it2][1];
           charge2=trackMapPtEtaCharge[it2][2];
@@ -28,6 +28,7 @@
 #include "AliGFWWeights.h"
 #include "AliGFWCuts.h"
 #include "AliGFWFlowContainer.h"
+#include "AliGFWFCRecorder.h"
 #include "TObjArray.h"
 #include "TNamed.h"
 #include "AliGFW.h"
@@ -55,7 +56,18 @@ AliAnalysisTaskGFWFlow::AliAnalysisTaskGFWFlow():
   fRunNo(-1),
   fCurrSystFlag(0),
   fAddQA(kFALSE),
-  fQAList(0)
+  fQAList(0),
+  fFCHandles(),
+  fFCFillHandles(),
+  fFCFillValues(),
+  fFCFillWeights(),
+  fTrackEta(),
+  fTrackPtBin(),
+  fTrackPhi(),
+  fTrackWeight(),
+  fTrackMask(),
+  fFCRecordFile(""),
+  fFCRecorder(0)
 {
 };
 AliAnalysisTaskGFWFlow::AliAnalysisTaskGFWFlow(const char *name, Bool_t ProduceWeights, Bool_t IsMC, Bool_t AddQA):
@@ -77,7 +89,18 @@ AliAnalysisTaskGFWFlow::AliAnalysisTaskGFWFlow(const char *name, Bool_t ProduceW
   fRunNo(-1),
   fCurrSystFlag(0),
   fAddQA(kFALSE),
-  fQAList(0)
+  fQAList(0),
+  fFCHandles(),
+  fFCFillHandles(),
+  fFCFillValues(),
+  fFCFillWeights(),
+  fTrackEta(),
+  fTrackPtBin(),
+  fTrackPhi(),
+  fTrackWeight(),
+  fTrackMask(),
+  fFCRecordFile(""),
+  fFCRecorder(0)
 {
   if(!fProduceWeights) DefineInput(1,TList::Class());
   DefineOutput(1,(fProduceWeights?TList::Class():AliGFWFlowContainer::Class()));
@@ -85,6 +108,7 @@ AliAnalysisTaskGFWFlow::AliAnalysisTaskGFWFlow(const char *name, Bool_t ProduceW
     DefineOutput(2,TList::Class());
 };
 AliAnalysisTaskGFWFlow::~AliAnalysisTaskGFWFlow() {
+  delete fFCRecorder;
 };
 void AliAnalysisTaskGFWFlow::UserCreateOutputObjects(){
   OpenFile(1);
@@ -263,6 +287,7 @@ void AliAnalysisTaskGFWFlow::UserCreateOutputObjects(){
     fFC = new AliGFWFlowContainer();
     fFC->SetName(Form("FC%s",fSelections[fCurrSystFlag]->GetSystPF()));
     fFC->Initialize(OAforPt,8,multibins,fCurrSystFlag?1:10); //Statistics only required for nominal profiles, so do not create randomized profiles for systematics
+    if(!fFCRecordFile.IsNull()) fFCRecorder = new AliGFWFCRecorder(fFCRecordFile.Data(),fFC);
     fGFW = new AliGFW();
     //Full regions
     fGFW->AddRegion("poiMid",10,10,-0.8,0.8,1+fPtAxis->GetNbins(),1);
@@ -374,7 +399,14 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
     fGFW->Clear();
     AliAODTrack *lTrack;
     if(!fSelections[fCurrSystFlag]->AcceptVertex(fAOD,1)) return;
-    for(Int_t lTr=0;lTr<fAOD->GetNumberOfTracks();lTr++) {
+    //Accepted tracks are collected and filled into the GFW in one go
+    Int_t nAODTracks = fAOD->GetNumberOfTracks();
+    fTrackEta.clear();
+    fTrackPtBin.clear();
+    fTrackPhi.clear();
+    fTrackWeight.clear();
+    fTrackMask.clear();
+    for(Int_t lTr=0;lTr<nAODTracks;lTr++) {
       lTrack = (AliAODTrack*)fAOD->GetTrack(lTr);
       //if(!AcceptAODTrack(lTrack,tca)) continue;
       Double_t POStrk[] = {0.,0.,0.};
@@ -390,124 +422,137 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
       //Double_t nuaITS = fExtraWeights->GetWeight(lTrack->Phi(),lTrack->Eta(),vz,lTrack->Pt(),cent,0);
       Double_t nue = fPtAxis->GetNbins()>1?1:fWeights->GetWeight(lTrack->Phi(),lTrack->Eta(),vz,cent,lTrack->Pt(),1);
       if(fSelections[fCurrSystFlag]->AcceptTrack(lTrack, lDCA)) {
-      	fGFW->Fill(lTrack->Eta(),fPtAxis->FindBin(lTrack->Pt())-1,lTrack->Phi(),nua*nue,1);
+      	fTrackEta.push_back(lTrack->Eta());
+      	fTrackPtBin.push_back(fPtAxis->FindBin(lTrack->Pt())-1);
+      	fTrackPhi.push_back(lTrack->Phi());
+      	fTrackWeight.push_back(nua*nue);
+      	fTrackMask.push_back(1);
       };
       /*if(fSelections[9]->AcceptTrack(lTrack, lDCA)) //No ITS for now
 	fGFW->Fill(lTrack->Eta(),fPtAxis->FindBin(lTrack->Pt())-1,lTrack->Phi(),nuaITS*nue,2);*/
     };
+    if(fTrackEta.size()) fGFW->FillEvent(fTrackEta.size(),&fTrackEta[0],&fTrackPtBin[0],&fTrackPhi[0],&fTrackWeight[0],&fTrackMask[0]);
     TRandom rndm(0);
     Double_t rndmn=rndm.Rndm();
     //Calculate & fill profiles:
     //V_2{n}, full acceptance
-    Bool_t filled = FillFCs("MidV22","refMid {2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV22","poiMid refMid {2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidV24","refMid {2 2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV24","poiMid refMid {2 2 -2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidV26","refMid {2 2 2 -2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV26","poiMid refMid {2 2 2 -2 -2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidV28","refMid {2 2 2 2 -2 -2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV28","poiMid refMid {2 2 2 2 -2 -2 -2 -2}", cent, kTRUE,rndmn);
+    fFCFillHandles.clear();
+    fFCFillValues.clear();
+    fFCFillWeights.clear();
+    Bool_t filled = FillFCs("MidV22","refMid {2 -2}", kFALSE);
+    filled = FillFCs("MidV22","poiMid refMid {2 -2}", kTRUE);
+    filled = FillFCs("MidV24","refMid {2 2 -2 -2}", kFALSE);
+    filled = FillFCs("MidV24","poiMid refMid {2 2 -2 -2}", kTRUE);
+    filled = FillFCs("MidV26","refMid {2 2 2 -2 -2 -2}", kFALSE);
+    filled = FillFCs("MidV26","poiMid refMid {2 2 2 -2 -2 -2}", kTRUE);
+    filled = FillFCs("MidV28","refMid {2 2 2 2 -2 -2 -2 -2}", kFALSE);
+    filled = FillFCs("MidV28","poiMid refMid {2 2 2 2 -2 -2 -2 -2}", kTRUE);
     //V_3{n}, full acceptance:
-    filled = FillFCs("MidV32","refMid {3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV32","poiMid refMid {3 -3}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidV34","refMid {3 3 -3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV34","poiMid refMid {3 3 -3 -3}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidV36","refMid {3 3 3 -3 -3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV36","poiMid refMid {3 3 3 -3 -3 -3}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidV32","refMid {3 -3}", kFALSE);
+    filled = FillFCs("MidV32","poiMid refMid {3 -3}", kTRUE);
+    filled = FillFCs("MidV34","refMid {3 3 -3 -3}", kFALSE);
+    filled = FillFCs("MidV34","poiMid refMid {3 3 -3 -3}", kTRUE);
+    filled = FillFCs("MidV36","refMid {3 3 3 -3 -3 -3}", kFALSE);
+    filled = FillFCs("MidV36","poiMid refMid {3 3 3 -3 -3 -3}", kTRUE);
     //V_4{n}, full acceptance:
-    filled = FillFCs("MidV42","refMid {4 -4}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV42","poiMid refMid {4 -4}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidV44","refMid {4 4 -4 -4}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidV44","poiMid refMid {4 4 -4 -4}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidV42","refMid {4 -4}", kFALSE);
+    filled = FillFCs("MidV42","poiMid refMid {4 -4}", kTRUE);
+    filled = FillFCs("MidV44","refMid {4 4 -4 -4}", kFALSE);
+    filled = FillFCs("MidV44","poiMid refMid {4 4 -4 -4}", kTRUE);
     //V_2{n}, 2 subevents:
-    filled = FillFCs("Mid2SENV22","refSENeg {2} refSEPos {-2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV24","refSENeg {2 2} refSEPos {-2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV26","refSENeg {2 2 2} refSEPos {-2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV28","refSENeg {2 2 2 2} refSEPos {-2 -2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV22","poiSENeg refSENeg {2} refSEPos {-2}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SENV24","poiSENeg refSENeg {2 2} refSEPos {-2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SENV26","poiSENeg refSENeg {2 2 2} refSEPos {-2 -2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SENV28","poiSENeg refSENeg {2 2 2 2} refSEPos {-2 -2 -2 -2}", cent, kTRUE,rndmn);
+    filled = FillFCs("Mid2SENV22","refSENeg {2} refSEPos {-2}", kFALSE);
+    filled = FillFCs("Mid2SENV24","refSENeg {2 2} refSEPos {-2 -2}", kFALSE);
+    filled = FillFCs("Mid2SENV26","refSENeg {2 2 2} refSEPos {-2 -2 -2}", kFALSE);
+    filled = FillFCs("Mid2SENV28","refSENeg {2 2 2 2} refSEPos {-2 -2 -2 -2}", kFALSE);
+    filled = FillFCs("Mid2SENV22","poiSENeg refSENeg {2} refSEPos {-2}", kTRUE);
+    filled = FillFCs("Mid2SENV24","poiSENeg refSENeg {2 2} refSEPos {-2 -2}", kTRUE);
+    filled = FillFCs("Mid2SENV26","poiSENeg refSENeg {2 2 2} refSEPos {-2 -2 -2}", kTRUE);
+    filled = FillFCs("Mid2SENV28","poiSENeg refSENeg {2 2 2 2} refSEPos {-2 -2 -2 -2}", kTRUE);
 
-    filled = FillFCs("Mid2SEPV22","refSEPos {2} refSENeg {-2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV24","refSEPos {2 2} refSENeg {-2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV26","refSEPos {2 2 2} refSENeg {-2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV28","refSEPos {2 2 2 2} refSENeg {-2 -2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV22","poiSEPos refSEPos {2} refSENeg {-2}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SEPV24","poiSEPos refSEPos {2 2} refSENeg {-2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SEPV26","poiSEPos refSEPos {2 2 2} refSENeg {-2 -2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SEPV28","poiSEPos refSEPos {2 2 2 2} refSENeg {-2 -2 -2 -2}", cent, kTRUE,rndmn);
+    filled = FillFCs("Mid2SEPV22","refSEPos {2} refSENeg {-2}", kFALSE);
+    filled = FillFCs("Mid2SEPV24","refSEPos {2 2} refSENeg {-2 -2}", kFALSE);
+    filled = FillFCs("Mid2SEPV26","refSEPos {2 2 2} refSENeg {-2 -2 -2}", kFALSE);
+    filled = FillFCs("Mid2SEPV28","refSEPos {2 2 2 2} refSENeg {-2 -2 -2 -2}", kFALSE);
+    filled = FillFCs("Mid2SEPV22","poiSEPos refSEPos {2} refSENeg {-2}", kTRUE);
+    filled = FillFCs("Mid2SEPV24","poiSEPos refSEPos {2 2} refSENeg {-2 -2}", kTRUE);
+    filled = FillFCs("Mid2SEPV26","poiSEPos refSEPos {2 2 2} refSENeg {-2 -2 -2}", kTRUE);
+    filled = FillFCs("Mid2SEPV28","poiSEPos refSEPos {2 2 2 2} refSENeg {-2 -2 -2 -2}", kTRUE);
 
     //V_3{n}, 2 subevents:
-    filled = FillFCs("Mid2SENV32","refSENeg {3} refSEPos {-3}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV34","refSENeg {3 3} refSEPos {-3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV36","refSENeg {3 3 3} refSEPos {-3 -3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV32","poiSENeg refSENeg {3} refSEPos {-3}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SENV34","poiSENeg refSENeg {3 3} refSEPos {-3 -3}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SENV36","poiSENeg refSENeg {3 3 3} refSEPos {-3 -3 -3}", cent, kTRUE,rndmn);
+    filled = FillFCs("Mid2SENV32","refSENeg {3} refSEPos {-3}", kFALSE);
+    filled = FillFCs("Mid2SENV34","refSENeg {3 3} refSEPos {-3 -3}", kFALSE);
+    filled = FillFCs("Mid2SENV36","refSENeg {3 3 3} refSEPos {-3 -3 -3}", kFALSE);
+    filled = FillFCs("Mid2SENV32","poiSENeg refSENeg {3} refSEPos {-3}", kTRUE);
+    filled = FillFCs("Mid2SENV34","poiSENeg refSENeg {3 3} refSEPos {-3 -3}", kTRUE);
+    filled = FillFCs("Mid2SENV36","poiSENeg refSENeg {3 3 3} refSEPos {-3 -3 -3}", kTRUE);
 
-    filled = FillFCs("Mid2SEPV32","refSEPos {3} refSENeg {-3}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV34","refSEPos {3 3} refSENeg {-3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV36","refSEPos {3 3 3} refSENeg {-3 -3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV32","poiSEPos refSEPos {3} refSENeg {-3}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SEPV34","poiSEPos refSEPos {3 3} refSENeg {-3 -3}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SEPV36","poiSEPos refSEPos {3 3 3} refSENeg {-3 -3 -3}", cent, kTRUE,rndmn);
+    filled = FillFCs("Mid2SEPV32","refSEPos {3} refSENeg {-3}", kFALSE);
+    filled = FillFCs("Mid2SEPV34","refSEPos {3 3} refSENeg {-3 -3}", kFALSE);
+    filled = FillFCs("Mid2SEPV36","refSEPos {3 3 3} refSENeg {-3 -3 -3}", kFALSE);
+    filled = FillFCs("Mid2SEPV32","poiSEPos refSEPos {3} refSENeg {-3}", kTRUE);
+    filled = FillFCs("Mid2SEPV34","poiSEPos refSEPos {3 3} refSENeg {-3 -3}", kTRUE);
+    filled = FillFCs("Mid2SEPV36","poiSEPos refSEPos {3 3 3} refSENeg {-3 -3 -3}", kTRUE);
 
     //V_4{n}, 2 subevents:
-    filled = FillFCs("Mid2SENV42","refSENeg {4} refSEPos {-4}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV44","refSENeg {4 4} refSEPos {-4 -4}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SENV42","poiSENeg refSENeg {4} refSEPos {-4}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SENV44","poiSENeg refSENeg {4 4} refSEPos {-4 -4}", cent, kTRUE,rndmn);
+    filled = FillFCs("Mid2SENV42","refSENeg {4} refSEPos {-4}", kFALSE);
+    filled = FillFCs("Mid2SENV44","refSENeg {4 4} refSEPos {-4 -4}", kFALSE);
+    filled = FillFCs("Mid2SENV42","poiSENeg refSENeg {4} refSEPos {-4}", kTRUE);
+    filled = FillFCs("Mid2SENV44","poiSENeg refSENeg {4 4} refSEPos {-4 -4}", kTRUE);
 
-    filled = FillFCs("Mid2SEPV42","refSEPos {4} refSENeg {-4}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV44","refSEPos {4 4} refSENeg {-4 -4}", cent, kFALSE,rndmn);
-    filled = FillFCs("Mid2SEPV42","poiSEPos refSEPos {4} refSENeg {-4}", cent, kTRUE,rndmn);
-    filled = FillFCs("Mid2SEPV44","poiSEPos refSEPos {4 4} refSENeg {-4 -4}", cent, kTRUE,rndmn);
+    filled = FillFCs("Mid2SEPV42","refSEPos {4} refSENeg {-4}", kFALSE);
+    filled = FillFCs("Mid2SEPV44","refSEPos {4 4} refSENeg {-4 -4}", kFALSE);
+    filled = FillFCs("Mid2SEPV42","poiSEPos refSEPos {4} refSENeg {-4}", kTRUE);
+    filled = FillFCs("Mid2SEPV44","poiSEPos refSEPos {4 4} refSENeg {-4 -4}", kTRUE);
 
     //V_2{n}, eta gap 1:
-    filled = FillFCs("MidGapNV22","refGapNeg {2} refGapPos {-2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV24","refGapNeg {2 2} refGapPos {-2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV26","refGapNeg {2 2 2} refGapPos {-2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV28","refGapNeg {2 2 2 2} refGapPos {-2 -2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV22","poiGapNeg refGapNeg {2} refGapPos {-2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapNV24","poiGapNeg refGapNeg {2 2} refGapPos {-2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapNV26","poiGapNeg refGapNeg {2 2 2} refGapPos {-2 -2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapNV28","poiGapNeg refGapNeg {2 2 2 2} refGapPos {-2 -2 -2 -2}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidGapNV22","refGapNeg {2} refGapPos {-2}", kFALSE);
+    filled = FillFCs("MidGapNV24","refGapNeg {2 2} refGapPos {-2 -2}", kFALSE);
+    filled = FillFCs("MidGapNV26","refGapNeg {2 2 2} refGapPos {-2 -2 -2}", kFALSE);
+    filled = FillFCs("MidGapNV28","refGapNeg {2 2 2 2} refGapPos {-2 -2 -2 -2}", kFALSE);
+    filled = FillFCs("MidGapNV22","poiGapNeg refGapNeg {2} refGapPos {-2}", kTRUE);
+    filled = FillFCs("MidGapNV24","poiGapNeg refGapNeg {2 2} refGapPos {-2 -2}", kTRUE);
+    filled = FillFCs("MidGapNV26","poiGapNeg refGapNeg {2 2 2} refGapPos {-2 -2 -2}", kTRUE);
+    filled = FillFCs("MidGapNV28","poiGapNeg refGapNeg {2 2 2 2} refGapPos {-2 -2 -2 -2}", kTRUE);
 
-    filled = FillFCs("MidGapPV22","refGapPos {2} refGapNeg {-2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV24","refGapPos {2 2} refGapNeg {-2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV26","refGapPos {2 2 2} refGapNeg {-2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV28","refGapPos {2 2 2 2} refGapNeg {-2 -2 -2 -2}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV22","poiGapPos refGapPos {2} refGapNeg {-2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapPV24","poiGapPos refGapPos {2 2} refGapNeg {-2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapPV26","poiGapPos refGapPos {2 2 2} refGapNeg {-2 -2 -2}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapPV28","poiGapPos refGapPos {2 2 2 2} refGapNeg {-2 -2 -2 -2}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidGapPV22","refGapPos {2} refGapNeg {-2}", kFALSE);
+    filled = FillFCs("MidGapPV24","refGapPos {2 2} refGapNeg {-2 -2}", kFALSE);
+    filled = FillFCs("MidGapPV26","refGapPos {2 2 2} refGapNeg {-2 -2 -2}", kFALSE);
+    filled = FillFCs("MidGapPV28","refGapPos {2 2 2 2} refGapNeg {-2 -2 -2 -2}", kFALSE);
+    filled = FillFCs("MidGapPV22","poiGapPos refGapPos {2} refGapNeg {-2}", kTRUE);
+    filled = FillFCs("MidGapPV24","poiGapPos refGapPos {2 2} refGapNeg {-2 -2}", kTRUE);
+    filled = FillFCs("MidGapPV26","poiGapPos refGapPos {2 2 2} refGapNeg {-2 -2 -2}", kTRUE);
+    filled = FillFCs("MidGapPV28","poiGapPos refGapPos {2 2 2 2} refGapNeg {-2 -2 -2 -2}", kTRUE);
 
 
     //V_3{n}, eta gap 1:
-    filled = FillFCs("MidGapNV32","refGapNeg {3} refGapPos {-3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV34","refGapNeg {3 3} refGapPos {-3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV36","refGapNeg {3 3 3} refGapPos {-3 -3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV32","poiGapNeg refGapNeg {3} refGapPos {-3}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapNV34","poiGapNeg refGapNeg {3 3} refGapPos {-3 -3}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapNV36","poiGapNeg refGapNeg {3 3 3} refGapPos {-3 -3 -3}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidGapNV32","refGapNeg {3} refGapPos {-3}", kFALSE);
+    filled = FillFCs("MidGapNV34","refGapNeg {3 3} refGapPos {-3 -3}", kFALSE);
+    filled = FillFCs("MidGapNV36","refGapNeg {3 3 3} refGapPos {-3 -3 -3}", kFALSE);
+    filled = FillFCs("MidGapNV32","poiGapNeg refGapNeg {3} refGapPos {-3}", kTRUE);
+    filled = FillFCs("MidGapNV34","poiGapNeg refGapNeg {3 3} refGapPos {-3 -3}", kTRUE);
+    filled = FillFCs("MidGapNV36","poiGapNeg refGapNeg {3 3 3} refGapPos {-3 -3 -3}", kTRUE);
 
-    filled = FillFCs("MidGapPV32","refGapPos {3} refGapNeg {-3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV34","refGapPos {3 3} refGapNeg {-3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV36","refGapPos {3 3 3} refGapNeg {-3 -3 -3}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV32","poiGapPos refGapPos {3} refGapNeg {-3}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapPV34","poiGapPos refGapPos {3 3} refGapNeg {-3 -3}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapPV36","poiGapPos refGapPos {3 3 3} refGapNeg {-3 -3 -3}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidGapPV32","refGapPos {3} refGapNeg {-3}", kFALSE);
+    filled = FillFCs("MidGapPV34","refGapPos {3 3} refGapNeg {-3 -3}", kFALSE);
+    filled = FillFCs("MidGapPV36","refGapPos {3 3 3} refGapNeg {-3 -3 -3}", kFALSE);
+    filled = FillFCs("MidGapPV32","poiGapPos refGapPos {3} refGapNeg {-3}", kTRUE);
+    filled = FillFCs("MidGapPV34","poiGapPos refGapPos {3 3} refGapNeg {-3 -3}", kTRUE);
+    filled = FillFCs("MidGapPV36","poiGapPos refGapPos {3 3 3} refGapNeg {-3 -3 -3}", kTRUE);
     //V_4{n}, eta gap 1:
-    filled = FillFCs("MidGapNV42","refGapNeg {4} refGapPos {-4}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV44","refGapNeg {4 4} refGapPos {-4 -4}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapNV42","poiGapNeg refGapNeg {4} refGapPos {-4}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapNV44","poiGapNeg refGapNeg {4 4} refGapPos {-4 -4}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidGapNV42","refGapNeg {4} refGapPos {-4}", kFALSE);
+    filled = FillFCs("MidGapNV44","refGapNeg {4 4} refGapPos {-4 -4}", kFALSE);
+    filled = FillFCs("MidGapNV42","poiGapNeg refGapNeg {4} refGapPos {-4}", kTRUE);
+    filled = FillFCs("MidGapNV44","poiGapNeg refGapNeg {4 4} refGapPos {-4 -4}", kTRUE);
 
-    filled = FillFCs("MidGapPV42","refGapPos {4} refGapNeg {-4}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV44","refGapPos {4 4} refGapNeg {-4 -4}", cent, kFALSE,rndmn);
-    filled = FillFCs("MidGapPV42","poiGapPos refGapPos {4} refGapNeg {-4}", cent, kTRUE,rndmn);
-    filled = FillFCs("MidGapPV44","poiGapPos refGapPos {4 4} refGapNeg {-4 -4}", cent, kTRUE,rndmn);
+    filled = FillFCs("MidGapPV42","refGapPos {4} refGapNeg {-4}", kFALSE);
+    filled = FillFCs("MidGapPV44","refGapPos {4 4} refGapNeg {-4 -4}", kFALSE);
+    filled = FillFCs("MidGapPV42","poiGapPos refGapPos {4} refGapNeg {-4}", kTRUE);
+    filled = FillFCs("MidGapPV44","poiGapPos refGapPos {4 4} refGapNeg {-4 -4}", kTRUE);
+    //Main and subsample profiles are updated together for all correlators of the event
+    if(fFCFillHandles.size()) {
+      if(fFCRecorder) fFCRecorder->Record(fFCFillHandles.size(),&fFCFillHandles[0],&fFCFillValues[0],&fFCFillWeights[0],cent,rndmn);
+      fFC->FillProfiles(fFCFillHandles.size(),&fFCFillHandles[0],&fFCFillValues[0],&fFCFillWeights[0],cent,rndmn);
+    };
 
     PostData(1,fFC);
     if(fAddQA) PostData(2,fQAList);
@@ -515,6 +560,11 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
 };
 void AliAnalysisTaskGFWFlow::Terminate(Option_t*) {
 };
+void AliAnalysisTaskGFWFlow::FinishTaskOutput() {
+  //Close the recording on the worker, before the outputs are merged
+  delete fFCRecorder;
+  fFCRecorder=0;
+};
 Bool_t AliAnalysisTaskGFWFlow::AcceptEvent() {
   if(!fEventCuts.AcceptEvent(fInputEvent)) return 0;
   UInt_t fSelMask = ((AliInputEventHandler*)(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler()))->IsEventSelected();
@@ -603,6 +653,7 @@ Bool_t AliAnalysisTaskGFWFlow::LoadWeights(Int_t runno) { //Cannot be used when
     };
     fWeights->CreateNUA();
     fWeights->CreateNUE();
+    fWeights->BuildWeightTables();
     return kTRUE;
   } else {
     AliFatal("Weight list (for some reason) not set!\n");
@@ -632,9 +683,11 @@ Bool_t AliAnalysisTaskGFWFlow::LoadWeights(Int_t runno) { //Cannot be used when
   if(!fWeights) return kFALSE;
   fWeights->CreateNUA();
   fWeights->CreateNUE();
+  fWeights->BuildWeightTables();
   if(fExtraWeights) {
     fExtraWeights->CreateNUA();
     fExtraWeights->CreateNUE();
+    fExtraWeights->BuildWeightTables();
   };
 
   return kTRUE;
@@ -656,13 +709,27 @@ Bool_t AliAnalysisTaskGFWFlow::InitRun() {
   };
   return kTRUE;
 };
-Bool_t AliAnalysisTaskGFWFlow::FillFCs(TString head, TString hn, Double_t cent, Bool_t diff, Double_t rndmn) {
+const std::vector<Int_t> &AliAnalysisTaskGFWFlow::GetFCHandles(const TString &head) {
+  //Profile labels are only looked up the first time a correlator is filled
+  std::map<TString, std::vector<Int_t> >::const_iterator it = fFCHandles.find(head);
+  if(it!=fFCHandles.end()) return it->second;
+  std::vector<Int_t> &lHandles = fFCHandles[head];
+  lHandles.push_back(fFC->RegisterProfile(head.Data()));
+  for(Int_t i=1;i<=fPtAxis->GetNbins();i++)
+    lHandles.push_back(fFC->RegisterProfile(Form("%s_pt_%i",head.Data(),i)));
+  return lHandles;
+};
+Bool_t AliAnalysisTaskGFWFlow::FillFCs(TString head, TString hn, Bool_t diff) {
+  //Correlators are collected here and filled to fFC at the end of the event
   Double_t dnx, val;
   dnx = fGFW->Calculate(hn,kTRUE).Re();
   if(dnx==0) return kFALSE;
+  const std::vector<Int_t> &lHandles = GetFCHandles(head);
   if(!diff) {
     val = fGFW->Calculate(hn).Re();
-    fFC->FillProfile(head.Data(),cent,val/dnx,dnx,rndmn);
+    fFCFillHandles.push_back(lHandles[0]);
+    fFCFillValues.push_back(val/dnx);
+    fFCFillWeights.push_back(dnx);
     return kTRUE;
   };
   for(Int_t i=1;i<=fPtAxis->GetNbins();i++) {
@@ -671,7 +738,9 @@ Bool_t AliAnalysisTaskGFWFlow::FillFCs(TString head, TString hn, Double_t cent,
     dnx = fGFW->Calculate(tss,kTRUE).Re();
     if(dnx==0) continue;
     val = fGFW->Calculate(tss).Re();
-    fFC->FillProfile(Form("%s_pt_%i",head.Data(),i),cent,val/dnx,dnx,rndmn);
+    fFCFillHandles.push_back(lHandles[i]);
+    fFCFillValues.push_back(val/dnx);
+    fFCFillWeights.push_back(dnx);
   };
   return kTRUE;
 };
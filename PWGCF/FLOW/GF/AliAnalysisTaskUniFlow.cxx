@@ -2237,21 +2237,24 @@ void AliAnalysisTaskUniFlow::FilterPhi() const
       AliAODTrack* kaon2 = dynamic_cast<AliAODTrack*>(fVector[kKaon]->at(iKaon2));
       if(!kaon2) { continue; }
 
-      AliPicoTrack* mother = MakeMother(kaon1,kaon2);
+      // candidate built on the stack; only stored (unlike-sign) ones are copied to the heap
+      AliPicoTrack candidate;
+      MakeMother(kaon1,kaon2,candidate);
+      AliPicoTrack* mother = &candidate;
       fhPhiCounter->Fill("Input",1);
 
       // filling QA BEFORE selection
       if(fFillQA) { FillQAPhi(kBefore,mother); }
 
-      if(fCutPhiInvMassMin > 0. && mother->M() < fCutPhiInvMassMin) { delete mother; continue; }
-      if(fCutPhiInvMassMax > 0. && mother->M() > fCutPhiInvMassMax) { delete mother; continue; }
+      if(fCutPhiInvMassMin > 0. && mother->M() < fCutPhiInvMassMin) { continue; }
+      if(fCutPhiInvMassMax > 0. && mother->M() > fCutPhiInvMassMax) { continue; }
       fhPhiCounter->Fill("InvMass",1);
 
-      if(fFlowPOIsPtMin > 0. && mother->Pt() < fFlowPOIsPtMin) { delete mother; continue; }
-      if(fFlowPOIsPtMax > 0. && mother->Pt() > fFlowPOIsPtMax) { delete mother; continue; }
+      if(fFlowPOIsPtMin > 0. && mother->Pt() < fFlowPOIsPtMin) { continue; }
+      if(fFlowPOIsPtMax > 0. && mother->Pt() > fFlowPOIsPtMax) { continue; }
       fhPhiCounter->Fill("Pt",1);
 
-      if(fFlowEtaMax > 0. && TMath::Abs(mother->Eta()) > fFlowEtaMax) { delete mother; continue; }
+      if(fFlowEtaMax > 0. && TMath::Abs(mother->Eta()) > fFlowEtaMax) { continue; }
       fhPhiCounter->Fill("Eta",1);
 
       // mother (phi) candidate passing all criteria (except for charge)
@@ -2268,8 +2271,9 @@ void AliAnalysisTaskUniFlow::FilterPhi() const
         // opposite-sign combination (signal+background)
         fhPhiCounter->Fill("Unlike-sign",1);
         FillSparseCand(fhsCandPhi, mother);
-        fVector[kPhi]->push_back(mother);
-        if(!FillFlowWeight(mother, kPhi)) { AliFatal("Flow weight filling failed!"); return; }
+        AliPicoTrack* stored = new AliPicoTrack(candidate);
+        fVector[kPhi]->push_back(stored);
+        if(!FillFlowWeight(stored, kPhi)) { AliFatal("Flow weight filling failed!"); return; }
       }
 
       // filling QA AFTER selection
@@ -2287,13 +2291,13 @@ void AliAnalysisTaskUniFlow::FilterPhi() const
   return;
 }
 // ============================================================================
-AliPicoTrack* AliAnalysisTaskUniFlow::MakeMother(const AliAODTrack* part1, const AliAODTrack* part2) const
+Bool_t AliAnalysisTaskUniFlow::MakeMother(const AliAODTrack* part1, const AliAODTrack* part2, AliPicoTrack& mother) const
 {
-  // Reconstructing mother particle from two prongs and fill its properties.
-  // return ptr to created mother particle
+  // Reconstructing mother particle from two prongs and fill its properties into mother.
+  // return kFALSE if any of the prongs is missing
   // *************************************************************
 
-  if(!part1 || !part2) { return nullptr; }
+  if(!part1 || !part2) { return kFALSE; }
 
   // combining momenta
   TVector3 mom1 = TVector3( part1->Px(), part1->Py(), part1->Pz() );
@@ -2313,7 +2317,8 @@ AliPicoTrack* AliAnalysisTaskUniFlow::MakeMother(const AliAODTrack* part1, const
   // maving phi form [-pi,pi] -> [0,2pi] for consistency with other species
   Double_t dPhi = mom.Phi() + TMath::Pi();
 
-  return new AliPicoTrack(mom.Pt(),mom.Eta(),dPhi,iCharge,0,0,0,0,0,0,dMass);
+  mother = AliPicoTrack(mom.Pt(),mom.Eta(),dPhi,iCharge,0,0,0,0,0,0,dMass);
+  return kTRUE;
 }
 // ============================================================================
 void AliAnalysisTaskUniFlow::FillQAPhi(const QAindex iQAindex, const AliPicoTrack* part) const
@@ -3102,24 +3107,30 @@ Int_t AliAnalysisTaskUniFlow::FillPOIsVectors(const Double_t dEtaGap, const Part
     // check if POI overlaps with RFPs (not for reconstructed)
     Bool_t bIsWithinRefs = (!bHasMass && IsWithinRefs(static_cast<const AliAODTrack*>(part)));
 
+    // weight powers are the same for every harmonic (and for P and S vectors)
+    Double_t dWeightPow[fFlowNumWeightPowersMax];
+    for(Int_t iPower(0); iPower < fFlowNumWeightPowersMax; iPower++) { dWeightPow[iPower] = TMath::Power(dWeight,iPower); }
+
     if(!bHasGap) // no eta gap
     {
       for(Int_t iHarm(0); iHarm < fFlowNumHarmonicsMax; iHarm++)
+      {
+        Double_t dCosHarm = TMath::Cos(iHarm * dPhi);
+        Double_t dSinHarm = TMath::Sin(iHarm * dPhi);
         for(Int_t iPower(0); iPower < fFlowNumWeightPowersMax; iPower++)
         {
-          Double_t dCos = TMath::Power(dWeight,iPower) * TMath::Cos(iHarm * dPhi);
-          Double_t dSin = TMath::Power(dWeight,iPower) * TMath::Sin(iHarm * dPhi);
+          Double_t dCos = dWeightPow[iPower] * dCosHarm;
+          Double_t dSin = dWeightPow[iPower] * dSinHarm;
           fFlowVecPpos[iHarm][iPower] += TComplex(dCos,dSin,kFALSE);
 
           // check if track (passing criteria) is overlapping with RFPs pT region; if so, fill S (q) vector
           // in case of charged, pions, kaons or protons (one witout mass)
           if(bIsWithinRefs)
           {
-            Double_t dCos = TMath::Power(dWeight,iPower) * TMath::Cos(iHarm * dPhi);
-            Double_t dSin = TMath::Power(dWeight,iPower) * TMath::Sin(iHarm * dPhi);
             fFlowVecSpos[iHarm][iPower] += TComplex(dCos,dSin,kFALSE);
           }
         }
+      }
 
     }
     else // with eta gap
@@ -3127,38 +3138,42 @@ Int_t AliAnalysisTaskUniFlow::FillPOIsVectors(const Double_t dEtaGap, const Part
       if(dEta > dEtaLimit) // particle in positive eta acceptance
       {
         for(Int_t iHarm(0); iHarm < fFlowNumHarmonicsMax; iHarm++)
+        {
+          Double_t dCosHarm = TMath::Cos(iHarm * dPhi);
+          Double_t dSinHarm = TMath::Sin(iHarm * dPhi);
           for(Int_t iPower(0); iPower < fFlowNumWeightPowersMax; iPower++)
           {
-            Double_t dCos = TMath::Power(dWeight,iPower) * TMath::Cos(iHarm * dPhi);
-            Double_t dSin = TMath::Power(dWeight,iPower) * TMath::Sin(iHarm * dPhi);
+            Double_t dCos = dWeightPow[iPower] * dCosHarm;
+            Double_t dSin = dWeightPow[iPower] * dSinHarm;
             fFlowVecPpos[iHarm][iPower] += TComplex(dCos,dSin,kFALSE);
 
             // possible overlap for <<4'>> with single gap (within the same subevent)
             if(bIsWithinRefs)
             {
-              Double_t dCos = TMath::Power(dWeight,iPower) * TMath::Cos(iHarm * dPhi);
-              Double_t dSin = TMath::Power(dWeight,iPower) * TMath::Sin(iHarm * dPhi);
               fFlowVecSpos[iHarm][iPower] += TComplex(dCos,dSin,kFALSE);
             }
           }
+        }
        }
        if(dEta < -dEtaLimit) // particle in negative eta acceptance
        {
          for(Int_t iHarm(0); iHarm < fFlowNumHarmonicsMax; iHarm++)
+         {
+           Double_t dCosHarm = TMath::Cos(iHarm * dPhi);
+           Double_t dSinHarm = TMath::Sin(iHarm * dPhi);
            for(Int_t iPower(0); iPower < fFlowNumWeightPowersMax; iPower++)
            {
-             Double_t dCos = TMath::Power(dWeight,iPower) * TMath::Cos(iHarm * dPhi);
-             Double_t dSin = TMath::Power(dWeight,iPower) * TMath::Sin(iHarm * dPhi);
+             Double_t dCos = dWeightPow[iPower] * dCosHarm;
+             Double_t dSin = dWeightPow[iPower] * dSinHarm;
              fFlowVecPneg[iHarm][iPower] += TComplex(dCos,dSin,kFALSE);
 
              // possible overlap for <<4'>> with single gap (within the same subevent)
              if(bIsWithinRefs)
              {
-               Double_t dCos = TMath::Power(dWeight,iPower) * TMath::Cos(iHarm * dPhi);
-               Double_t dSin = TMath::Power(dWeight,iPower) * TMath::Sin(iHarm * dPhi);
                fFlowVecSneg[iHarm][iPower] += TComplex(dCos,dSin,kFALSE);
              }
            }
+         }
        }
      } // endif {dEtaGap}
    } // endfor {tracks}
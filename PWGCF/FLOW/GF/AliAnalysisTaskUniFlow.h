@@ -221,7 +221,7 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       Bool_t                  IsV0Selected(const AliAODv0* v0) const; // general (common) V0 selection
       Bool_t                  IsV0aK0s(const AliAODv0* v0) const; // V0 selection: K0s specific
       Int_t                   IsV0aLambda(const AliAODv0* v0) const; // V0 selection: (A)Lambda specific
-      AliPicoTrack*           MakeMother(const AliAODTrack* part1, const AliAODTrack* part2) const; // Combine two prongs into a mother particle stored in AliPicoTrack object
+      Bool_t                  MakeMother(const AliAODTrack* part1, const AliAODTrack* part2, AliPicoTrack& mother) const; // Combine two prongs into a mother particle stored in given AliPicoTrack object
       void                    FillSparseCand(THnSparse* sparse, const AliVTrack* track) const; // Fill sparse histogram for inv. mass distribution of candidates (V0s,Phi)
       void                    FillQAEvents(QAindex iQAindex) const; // filling QA plots related to event selection
       void                    FillQARefs(QAindex iQAindex, const AliAODTrack* track) const; // filling QA plots for RFPs selection
@@ -64,6 +64,25 @@ void AliGFW::Fill(Double_t eta, Int_t ptin, Double_t phi, Double_t weight, Int_t
       fCumulants.at(i).FillArray(eta,ptin,phi,weight);
   };
 };
+void AliGFW::FillEvent(Int_t nTracks, const Double_t *eta, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Int_t *mask) {
+  //Same as calling Fill() for each track, but cos(phi) and sin(phi) are calculated once per track
+  //and the Q-vectors of one region are filled for all tracks before moving to the next region
+  if(!fInitialized) CreateRegions();
+  if(!fInitialized) return;
+  fCosPhi.resize(nTracks);
+  fSinPhi.resize(nTracks);
+  for(Int_t j=0;j<nTracks;++j) {
+    fCosPhi[j] = TMath::Cos(phi[j]);
+    fSinPhi[j] = TMath::Sin(phi[j]);
+  };
+  for(Int_t i=0;i<(Int_t)fRegions.size();++i) {
+    const Region &lRegion = fRegions[i];
+    AliGFWCumulant &lCumulant = fCumulants[i];
+    for(Int_t j=0;j<nTracks;++j)
+      if(lRegion.EtaMin<eta[j] && lRegion.EtaMax>eta[j] && (lRegion.BitMask&mask[j]))
+        lCumulant.FillArray(ptin[j],fCosPhi[j],fSinPhi[j],weight[j]);
+  };
+};
 TComplex AliGFW::TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, AliGFWCumulant *r1, AliGFWCumulant *r2, AliGFWCumulant *r3) {
   TComplex part1 = r1->Vec(n1,p1,ptbin);
   TComplex part2 = r2->Vec(n2,p2,ptbin);
@@ -17,20 +17,29 @@ AliGFWCumulant::~AliGFWCumulant()
   //DestroyComplexVectorArray();
 };
 void AliGFWCumulant::FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t weight) {
+  FillArray(ptin,TMath::Cos(phi),TMath::Sin(phi),weight);
+};
+void AliGFWCumulant::FillArray(Int_t ptin, Double_t cosPhi, Double_t sinPhi, Double_t weight) {
   if(!fInitialized)
     CreateComplexVectorArray();
   if(fPt==1) ptin=0; //If one bin, then just fill it straight; otherwise, if ptin is out-of-range, do not fill
   else if(ptin<0 || ptin>=fPt) return;
 
+  //cos(n*phi) and sin(n*phi) from the angle addition formulas, and weight^p as a running product:
+  if(fN<1) { Inc(); return; };
+  TComplex *lQ = fQvector[ptin][0]; //all harmonics and powers of a pt bin are contiguous
+  Double_t lCos = 1.;
+  Double_t lSin = 0.;
   for(Int_t lN = 0; lN<fN; lN++) {
-    Double_t lSin = TMath::Sin(lN*phi); //No need to recalculate for each power
-    Double_t lCos = TMath::Cos(lN*phi); //No need to recalculate for each power
+    Double_t lPrefactor = 1.;
     for(Int_t lPow=0; lPow<fPow; lPow++) {
-      Double_t lPrefactor = TMath::Power(weight, lPow); //Dont calculate it twice; multiplication is cheaper that power
-      Double_t qsin = lPrefactor * lSin;
-      Double_t qcos = lPrefactor * lCos;
-      fQvector[ptin][lN][lPow]+=TComplex(qcos,qsin);
+      *lQ += TComplex(lPrefactor * lCos, lPrefactor * lSin);
+      ++lQ;
+      lPrefactor *= weight;
     };
+    Double_t lCosNext = lCos*cosPhi - lSin*sinPhi;
+    lSin = lSin*cosPhi + lCos*sinPhi;
+    lCos = lCosNext;
   };
   Inc();
 };
@@ -46,11 +55,7 @@ void AliGFWCumulant::ResetQs() {
 };
 void AliGFWCumulant::DestroyComplexVectorArray() {
   if(!fInitialized) return;
-  for(Int_t l_n = 0; l_n<fN; l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      delete [] fQvector[i][l_n];
-    };
-  };
+  if(fN>0) delete [] fQvector[0][0];
   for(Int_t i=0;i<fPt;i++) {
     delete [] fQvector[i];
   };
@@ -64,13 +69,15 @@ void AliGFWCumulant::CreateComplexVectorArray(Int_t N, Int_t Pow, Int_t Pt) {
   fN=N;
   fPow=Pow;
   fPt=Pt;
+  //One block for all Q-vectors, ordered by pt bin, harmonic and power, so that filling runs through memory
+  TComplex *lBlock = (fN>0)?new TComplex[fPt*fN*fPow]:0;
   fQvector = new TComplex**[fPt];
   for(Int_t i=0;i<fPt;i++) {
     fQvector[i] = new TComplex*[fN];
   };
   for(Int_t l_n=0;l_n<fN;l_n++) {
     for(Int_t i=0;i<fPt;i++) {
-      fQvector[i][l_n] = new TComplex[fPow];
+      fQvector[i][l_n] = lBlock + (i*fN+l_n)*fPow;
     };
   };
   ResetQs();
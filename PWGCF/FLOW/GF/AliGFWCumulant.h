@@ -10,6 +10,7 @@ class AliGFWCumulant {
   ~AliGFWCumulant();
   void ResetQs();
   void FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t weight=1);
+  void FillArray(Int_t ptin, Double_t cosPhi, Double_t sinPhi, Double_t weight); //cos(phi), sin(phi) precalculated by the caller
   enum UsedFlags_t {kBlank = 0, kFull=1, kPt=2};
   void SetType(UInt_t infl) { DestroyComplexVectorArray(); fUsed = infl; };
   void Inc() { fNEntries++; };
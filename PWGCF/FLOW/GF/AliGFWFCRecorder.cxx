@@ -0,0 +1,69 @@
+#include "AliGFWFCRecorder.h"
+#include "AliGFWFlowContainer.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TDirectory.h"
+
+AliGFWFCRecorder::AliGFWFCRecorder(const char *fileName, const AliGFWFlowContainer *fc):
+  fFile(0),
+  fTree(0),
+  fBrHandles(0),
+  fBrCorr(0),
+  fBrWeights(0),
+  fNCorr(0),
+  fMulti(0),
+  fRn(0),
+  fHandles(1,0),
+  fCorr(1,0),
+  fWeights(1,0)
+{
+  TDirectory *owd = gDirectory;
+  fFile = TFile::Open(fileName,"RECREATE");
+  if(!fFile || fFile->IsZombie()) {
+    printf("Could not open %s, FillProfiles input will not be recorded\n",fileName);
+    delete fFile;
+    fFile=0;
+    if(owd) owd->cd();
+    return;
+  };
+  if(fc) fc->Write(GetTemplateName());
+  fTree = new TTree(GetTreeName(),"AliGFWFlowContainer::FillProfiles input");
+  fTree->Branch("nCorr",&fNCorr,"nCorr/I");
+  fTree->Branch("multi",&fMulti,"multi/D");
+  fTree->Branch("rn",&fRn,"rn/D");
+  fBrHandles = fTree->Branch("handles",&fHandles[0],"handles[nCorr]/I");
+  fBrCorr = fTree->Branch("corr",&fCorr[0],"corr[nCorr]/D");
+  fBrWeights = fTree->Branch("w",&fWeights[0],"w[nCorr]/D");
+  if(owd) owd->cd();
+};
+AliGFWFCRecorder::~AliGFWFCRecorder() {
+  if(!fFile) return;
+  TDirectory *owd = (gDirectory!=fFile)?gDirectory:0;
+  fFile->cd();
+  fTree->Write();
+  printf("Recorded FillProfiles input of %lld events to %s\n",fTree->GetEntries(),fFile->GetName());
+  fFile->Close(); //also deletes the tree
+  delete fFile;
+  if(owd) owd->cd();
+};
+void AliGFWFCRecorder::Record(Int_t nCorr, const Int_t *handles, const Double_t *corr, const Double_t *w, Double_t multi, Double_t rn) {
+  if(!fTree || nCorr<0) return;
+  fNCorr = nCorr;
+  fMulti = multi;
+  fRn = rn;
+  if(nCorr>(Int_t)fHandles.size()) {
+    fHandles.resize(nCorr);
+    fCorr.resize(nCorr);
+    fWeights.resize(nCorr);
+    fBrHandles->SetAddress(&fHandles[0]);
+    fBrCorr->SetAddress(&fCorr[0]);
+    fBrWeights->SetAddress(&fWeights[0]);
+  };
+  for(Int_t i=0;i<nCorr;i++) {
+    fHandles[i] = handles[i];
+    fCorr[i] = corr[i];
+    fWeights[i] = w[i];
+  };
+  fTree->Fill();
+};
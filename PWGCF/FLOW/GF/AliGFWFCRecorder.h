@@ -0,0 +1,37 @@
+#ifndef ALIGFWFCRECORDER__H
+#define ALIGFWFCRECORDER__H
+//Records the per-event input of AliGFWFlowContainer::FillProfiles to a file, so that the
+//fill can be replayed and timed standalone with gfw-fc-replay, without running the analysis
+#include "Rtypes.h"
+#include <vector>
+
+class TFile;
+class TTree;
+class TBranch;
+class AliGFWFlowContainer;
+
+class AliGFWFCRecorder {
+ public:
+  AliGFWFCRecorder(const char *fileName, const AliGFWFlowContainer *fc); //fc is stored as template for the replay, so it should not be filled yet
+  ~AliGFWFCRecorder(); //writes the tree and closes the file
+  Bool_t IsOpen() const { return fTree!=0; };
+  void Record(Int_t nCorr, const Int_t *handles, const Double_t *corr, const Double_t *w, Double_t multi, Double_t rn);
+  static const char *GetTreeName() { return "FCInputs"; };
+  static const char *GetTemplateName() { return "FCTemplate"; };
+ private:
+  AliGFWFCRecorder(const AliGFWFCRecorder&);
+  AliGFWFCRecorder& operator=(const AliGFWFCRecorder&);
+  TFile *fFile;
+  TTree *fTree;
+  TBranch *fBrHandles;
+  TBranch *fBrCorr;
+  TBranch *fBrWeights;
+  Int_t fNCorr;
+  Double_t fMulti;
+  Double_t fRn;
+  std::vector<Int_t> fHandles; //leaf buffers, the branch addresses are updated when they grow
+  std::vector<Double_t> fCorr;
+  std::vector<Double_t> fWeights;
+};
+
+#endif
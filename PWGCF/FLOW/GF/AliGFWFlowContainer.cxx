@@ -68,19 +68,43 @@ void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Dou
 };
 
 Int_t AliGFWFlowContainer::FillProfile(const char *hname, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+  if(!fProf) return -1;
+  Int_t yin = RegisterProfile(hname);
+  if(yin<0) return -1;
+  return FillProfile(yin,multi,corr,w,rn);
+};
+Int_t AliGFWFlowContainer::RegisterProfile(const char *hname) {
+  //The handle is the bin of the correlator on the y axis of the profiles
   if(!fProf) return -1;
   Int_t yin = fProf->GetYaxis()->FindBin(hname);
   if(!yin) {
     printf("Could not find bin %s\n",hname);
     return -1;
   };
-  fProf->Fill(multi,yin,corr,w);
+  return yin;
+};
+Int_t AliGFWFlowContainer::FillProfile(Int_t handle, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+  if(!fProf || handle<1) return -1;
+  fProf->Fill(multi,handle,corr,w);
   if(fNRandom) {
     Double_t rnind = rn*fNRandom;
-    ((TProfile2D*)fProfRand->At((Int_t)rnind))->Fill(multi,yin,corr,w);
+    ((TProfile2D*)fProfRand->At((Int_t)rnind))->Fill(multi,handle,corr,w);
   };
   return 0;
 };
+Int_t AliGFWFlowContainer::FillProfiles(Int_t nCorr, const Int_t *handles, const Double_t *corr, const Double_t *w, Double_t multi, Double_t rn) {
+  //The subsample only depends on the event, so it is picked once for all correlators
+  if(!fProf) return -1;
+  TProfile2D *lRand = fNRandom?((TProfile2D*)fProfRand->At((Int_t)(rn*fNRandom))):0;
+  Int_t nFilled=0;
+  for(Int_t i=0;i<nCorr;i++) {
+    if(handles[i]<1) continue;
+    fProf->Fill(multi,handles[i],corr[i],w[i]);
+    if(lRand) lRand->Fill(multi,handles[i],corr[i],w[i]);
+    nFilled++;
+  };
+  return nFilled;
+};
 Long64_t AliGFWFlowContainer::Merge(TCollection *collist) {
   Long64_t nmerged=0;
   AliGFWFlowContainer *l_FC = 0;
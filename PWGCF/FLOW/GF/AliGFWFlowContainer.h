@@ -26,6 +26,10 @@ class AliGFWFlowContainer:public TNamed {
   Int_t GetNMultiBins() { return fProf->GetNbinsX(); };
   Double_t GetMultiAtBin(Int_t bin) { return fProf->GetXaxis()->GetBinCenter(bin); };
   Int_t FillProfile(const char *hname, Double_t multi, Double_t y, Double_t w, Double_t rn);
+  //Handles avoid the label lookup for every fill: get them once, after Initialize()
+  Int_t RegisterProfile(const char *hname); //returns -1 if there is no such correlator
+  Int_t FillProfile(Int_t handle, Double_t multi, Double_t y, Double_t w, Double_t rn);
+  Int_t FillProfiles(Int_t nCorr, const Int_t *handles, const Double_t *y, const Double_t *w, Double_t multi, Double_t rn); //all correlators of an event at once
   TProfile2D *GetProfile() { return fProf; };
   void ReadAndMerge(const char *infile);
   void PickAndMerge(TFile *tfi);
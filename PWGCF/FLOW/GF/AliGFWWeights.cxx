@@ -9,8 +9,10 @@ AliGFWWeights::AliGFWWeights():
   fEffInt(0),
   fAccInt(0),
   fNbinsPt(0),
-  fbinsPt(0)
+  fbinsPt(0),
+  fTablesBuilt(kFALSE)
 {
+  for(Int_t i=0;i<3;i++) fTableHist[i]=0;
 };
 AliGFWWeights::~AliGFWWeights()
 {
@@ -38,6 +40,7 @@ void AliGFWWeights::Init(Bool_t AddData, Bool_t AddMC)
   fW_data->SetOwner(kTRUE);
   fW_mcrec->SetOwner(kTRUE);
   fW_mcgen->SetOwner(kTRUE);
+  fTablesBuilt = kFALSE;
   fDataFilled = kFALSE;
   fMCFilled = kFALSE;
   if(!fbinsPt) { //If pT bins not initialized, set to default (-1 to 1e6) to accept everything
@@ -73,22 +76,49 @@ void AliGFWWeights::Fill(Double_t phi, Double_t eta, Double_t vz, Double_t pt, D
     th3 = (TH3D*)tar->At(tar->GetEntries()-1);
   };
   th3->Fill(htype?pt:phi,eta,vz);
+  fTablesBuilt=kFALSE;
 };
-Double_t AliGFWWeights::GetWeight(Double_t phi, Double_t eta, Double_t vz, Double_t pt, Double_t cent, Int_t htype) {
-  TObjArray *tar=0;
-  const char *pf="";
-  if(htype==0) { tar = fW_data; pf = "data"; };
-  if(htype==1) { tar = fW_mcrec; pf = "mcrec"; };
-  if(htype==2) { tar = fW_mcgen; pf = "mcgen"; };
-  if(!tar) return 1;
-  TH3D *th3 = (TH3D*)tar->FindObject(GetBinName(0,0,pf));
-  if(!th3) return 1;//-1;
-  Int_t xind = th3->GetXaxis()->FindBin(htype?pt:phi);
-  Int_t etaind = th3->GetYaxis()->FindBin(eta);
-  Int_t vzind = th3->GetZaxis()->FindBin(vz);
-  Double_t weight = th3->GetBinContent(xind, etaind, vzind);
-  if(weight!=0) return 1./weight;
-  return 1;
+void AliGFWWeights::BuildWeightTables() {
+  //Resolves the histogram of each htype once and stores 1/content of all its bins,
+  //so that GetWeight() does not need to look up the histogram and the bins for each track
+  for(Int_t htype=0;htype<3;htype++) {
+    TObjArray *tar=0;
+    const char *pf="";
+    if(htype==0) { tar = fW_data; pf = "data"; };
+    if(htype==1) { tar = fW_mcrec; pf = "mcrec"; };
+    if(htype==2) { tar = fW_mcgen; pf = "mcgen"; };
+    fTableHist[htype] = tar?(TH3D*)tar->FindObject(GetBinName(0,0,pf)):0;
+    fTable[htype].clear();
+    TH3D *th3 = fTableHist[htype];
+    if(!th3) continue;
+    TAxis *ax[3] = {th3->GetXaxis(), th3->GetYaxis(), th3->GetZaxis()};
+    for(Int_t i=0;i<3;i++) {
+      fTableNBins[htype][i] = ax[i]->GetNbins()+2;
+      fTableMin[htype][i] = ax[i]->GetXmin();
+      fTableMax[htype][i] = ax[i]->GetXmax();
+      fTableUniform[htype][i] = (ax[i]->GetXbins()->GetSize()==0);
+    };
+    fTable[htype].resize(fTableNBins[htype][0]*fTableNBins[htype][1]*fTableNBins[htype][2]);
+    for(Int_t ix=0;ix<fTableNBins[htype][0];ix++)
+      for(Int_t iy=0;iy<fTableNBins[htype][1];iy++)
+        for(Int_t iz=0;iz<fTableNBins[htype][2];iz++) {
+          Double_t weight = th3->GetBinContent(ix,iy,iz);
+          fTable[htype][(ix*fTableNBins[htype][1]+iy)*fTableNBins[htype][2]+iz] = (weight!=0)?1./weight:1;
+        };
+  };
+  fTablesBuilt=kTRUE;
+};
+void AliGFWWeights::GetWeights(Int_t nTracks, const Double_t *phi, const Double_t *eta, Double_t vz, const Double_t *pt, Double_t cent, Int_t htype, Double_t *weights) {
+  if(!fTablesBuilt) BuildWeightTables();
+  if(htype<0 || htype>2 || !fTableHist[htype]) {
+    for(Int_t i=0;i<nTracks;i++) weights[i]=1;
+    return;
+  };
+  const Double_t *x = htype?pt:phi;
+  const Int_t vzOffset = TableBin(htype,2,vz);
+  const std::vector<Double_t> &table = fTable[htype];
+  for(Int_t i=0;i<nTracks;i++)
+    weights[i] = table[(TableBin(htype,0,x[i])*fTableNBins[htype][1]+TableBin(htype,1,eta[i]))*fTableNBins[htype][2]+vzOffset];
 };
 Double_t AliGFWWeights::FindMax(TH3D *inh, Int_t &ix, Int_t &iy, Int_t &iz) {
   Double_t maxv=inh->GetBinContent(1,1,1);
@@ -116,6 +146,7 @@ void AliGFWWeights::MCToEfficiency() {
     hr->Divide(hg);
   };
   fW_mcgen->Clear();
+  fTablesBuilt=kFALSE;
 };
 void AliGFWWeights::RebinNUA(Int_t nX, Int_t nY, Int_t nZ) {
   if(fW_data->GetEntries()<1) return;
@@ -124,6 +155,7 @@ void AliGFWWeights::RebinNUA(Int_t nX, Int_t nY, Int_t nZ) {
     ((TH3D*)fW_data->At(i))->RebinY(nY);
     ((TH3D*)fW_data->At(i))->RebinZ(nZ);
   };
+  fTablesBuilt=kFALSE;
 };
 void AliGFWWeights::CreateNUA(Bool_t IntegrateOverCentAndPt) {
   if(!IntegrateOverCentAndPt) {
@@ -204,6 +236,7 @@ void AliGFWWeights::ReadAndMerge(const char *filelinks) {
     fW_mcgen->SetName("Weights_MCGen");
     fW_mcgen->SetOwner(kTRUE);
   };
+  fTablesBuilt = kFALSE;
   fDataFilled = kFALSE;
   fMCFilled = kFALSE;
   TFile *tf=0;
@@ -270,5 +303,6 @@ Long64_t AliGFWWeights::Merge(TCollection *collist) {
     AddArray(fW_mcgen,l_w->GetGenArray());
     nmerged++;
   };
+  fTablesBuilt=kFALSE;
   return nmerged;
 };
@@ -7,6 +7,7 @@
 #include "TH1D.h"
 #include "TFile.h"
 #include "TCollection.h"
+#include <vector>
 
 class AliGFWWeights: public TNamed
 {
@@ -15,7 +16,14 @@ class AliGFWWeights: public TNamed
   ~AliGFWWeights();
   void Init(Bool_t AddData=kTRUE, Bool_t AddM=kTRUE);
   void Fill(Double_t phi, Double_t eta, Double_t vz, Double_t pt, Double_t cent, Int_t htype); //htype: 0 for data, 1 for mc rec, 2 for mc gen
-  Double_t GetWeight(Double_t phi, Double_t eta, Double_t vz, Double_t pt, Double_t cent, Int_t htype); //htype: 0 for data, 1 for mc rec, 2 for mc gen
+  Double_t GetWeight(Double_t phi, Double_t eta, Double_t vz, Double_t pt, Double_t cent, Int_t htype) { //htype: 0 for data, 1 for mc rec, 2 for mc gen
+    if(htype<0 || htype>2) return 1;
+    if(!fTablesBuilt) BuildWeightTables();
+    if(!fTableHist[htype]) return 1;
+    return fTable[htype][(TableBin(htype,0,htype?pt:phi)*fTableNBins[htype][1]+TableBin(htype,1,eta))*fTableNBins[htype][2]+TableBin(htype,2,vz)];
+  };
+  void GetWeights(Int_t nTracks, const Double_t *phi, const Double_t *eta, Double_t vz, const Double_t *pt, Double_t cent, Int_t htype, Double_t *weights); //fills weights[0..nTracks-1]
+  void BuildWeightTables(); //to be called once the weights are final, e.g. at run change
   Bool_t IsDataFilled() { return fDataFilled; };
   Bool_t IsMCFilled() { return fMCFilled; };
   Double_t FindMax(TH3D *inh, Int_t &ix, Int_t &iy, Int_t &iz);
@@ -42,6 +50,23 @@ class AliGFWWeights: public TNamed
   TH3D *fAccInt; //!
   Int_t fNbinsPt; //! do not store
   Double_t *fbinsPt; //! do not store
+  //Lookup tables of 1/content for the histogram of each htype, including under- and overflow bins:
+  Bool_t fTablesBuilt; //! tables are up to date
+  TH3D *fTableHist[3]; //! histogram used for each htype, 0 if none (weight 1)
+  Int_t fTableNBins[3][3]; //! number of bins incl. under- and overflow, per axis
+  Double_t fTableMin[3][3]; //! lower edge per axis
+  Double_t fTableMax[3][3]; //! upper edge per axis
+  Bool_t fTableUniform[3][3]; //! whether the axis has uniform binning
+  std::vector<Double_t> fTable[3]; //! flattened (x, eta, vz) table
+  Int_t TableBin(Int_t htype, Int_t axis, Double_t x) const { //same bin as TAxis::FindBin
+    if(!fTableUniform[htype][axis]) {
+      TAxis *ax = (axis==0)?fTableHist[htype]->GetXaxis():((axis==1)?fTableHist[htype]->GetYaxis():fTableHist[htype]->GetZaxis());
+      return ax->FindFixBin(x);
+    };
+    if(x<fTableMin[htype][axis]) return 0;
+    if(!(x<fTableMax[htype][axis])) return fTableNBins[htype][axis]-1;
+    return 1+(Int_t)((fTableNBins[htype][axis]-2)*(x-fTableMin[htype][axis])/(fTableMax[htype][axis]-fTableMin[htype][axis]));
+  };
   void AddArray(TObjArray *targ, TObjArray *sour);
   const char *GetBinName(Double_t ptv, Double_t v0mv,const char *pf="") {
     Int_t ptind = 0;//GetPtBin(ptv);
@@ -49,7 +74,7 @@ class AliGFWWeights: public TNamed
     return Form("Bin%s%i_%i",pf,ptind,v0mind);
   };
   
-  ClassDef(AliGFWWeights,1);
+  ClassDef(AliGFWWeights,2);
 };
 
 
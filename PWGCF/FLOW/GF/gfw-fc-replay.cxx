@@ -0,0 +1,103 @@
+// Replays the AliGFWFlowContainer::FillProfiles input recorded with AliGFWFCRecorder
+// (see AliAnalysisTaskGFWFlow::SetRecordFCInputs) in a tight loop and reports the time per event.
+// The recorded events are read into memory first, so only the fill itself is timed.
+// The entries and the sum of weights of the first repetition are printed as well; they
+// have to stay the same between versions of the container.
+//
+// Usage: gfw-fc-replay <file> [repetitions=10]
+#include "AliGFWFlowContainer.h"
+#include "AliGFWFCRecorder.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TH1.h"
+#include "TProfile2D.h"
+#include "Riostream.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+  if (argc<2) {
+    std::cout << "Usage: " << argv[0] << " <file> [repetitions=10]" << std::endl;
+    return 1;
+  }
+  const Int_t nRep = argc>2 ? std::max(1,atoi(argv[2])) : 10;
+  TH1::AddDirectory(kFALSE);
+
+  std::unique_ptr<TFile> file(TFile::Open(argv[1]));
+  if (!file || file->IsZombie()) {
+    std::cout << "Could not open " << argv[1] << std::endl;
+    return 1;
+  }
+  AliGFWFlowContainer *fcTemplate = dynamic_cast<AliGFWFlowContainer*>(file->Get(AliGFWFCRecorder::GetTemplateName()));
+  TTree *tree = dynamic_cast<TTree*>(file->Get(AliGFWFCRecorder::GetTreeName()));
+  if (!fcTemplate || !tree) {
+    std::cout << argv[1] << " does not contain recorded FillProfiles input" << std::endl;
+    return 1;
+  }
+
+  // read all events into flat arrays, event i uses [offset[i],offset[i+1])
+  const Long64_t nEvents = tree->GetEntries();
+  Int_t nCorr = 0;
+  Double_t multi = 0, rn = 0;
+  Int_t maxCorr = 1;
+  tree->SetBranchAddress("nCorr",&nCorr);
+  for (Long64_t i=0; i<nEvents; i++) {
+    tree->GetEntry(i);
+    maxCorr = std::max(maxCorr,nCorr);
+  }
+  std::vector<Int_t> handlesBuf(maxCorr);
+  std::vector<Double_t> corrBuf(maxCorr), wBuf(maxCorr);
+  tree->SetBranchAddress("multi",&multi);
+  tree->SetBranchAddress("rn",&rn);
+  tree->SetBranchAddress("handles",&handlesBuf[0]);
+  tree->SetBranchAddress("corr",&corrBuf[0]);
+  tree->SetBranchAddress("w",&wBuf[0]);
+
+  std::vector<Long64_t> offset(1,0);
+  std::vector<Double_t> multis, rns, corrs, ws;
+  std::vector<Int_t> handles;
+  offset.reserve(nEvents+1);
+  multis.reserve(nEvents);
+  rns.reserve(nEvents);
+  for (Long64_t i=0; i<nEvents; i++) {
+    tree->GetEntry(i);
+    multis.push_back(multi);
+    rns.push_back(rn);
+    handles.insert(handles.end(),handlesBuf.begin(),handlesBuf.begin()+nCorr);
+    corrs.insert(corrs.end(),corrBuf.begin(),corrBuf.begin()+nCorr);
+    ws.insert(ws.end(),wBuf.begin(),wBuf.begin()+nCorr);
+    offset.push_back(offset.back()+nCorr);
+  }
+  std::cout << "Read " << nEvents << " events with " << offset.back() << " correlators from " << argv[1] << std::endl;
+  if (!nEvents) return 0;
+
+  std::vector<Double_t> nsPerEvent;
+  for (Int_t rep=0; rep<nRep; rep++) {
+    std::unique_ptr<AliGFWFlowContainer> fc(static_cast<AliGFWFlowContainer*>(fcTemplate->Clone()));
+    const auto start = std::chrono::steady_clock::now();
+    for (Long64_t i=0; i<nEvents; i++) {
+      Long64_t o = offset[i];
+      fc->FillProfiles(offset[i+1]-o,handles.data()+o,corrs.data()+o,ws.data()+o,multis[i],rns[i]);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    nsPerEvent.push_back(std::chrono::duration<Double_t,std::nano>(stop-start).count()/nEvents);
+    if (!rep)
+      std::cout << "Checksum: entries " << fc->GetProfile()->GetEntries()
+                << ", sum of weights " << fc->GetProfile()->GetSumOfWeights() << std::endl;
+  }
+
+  std::vector<Double_t> sorted(nsPerEvent);
+  std::sort(sorted.begin(),sorted.end());
+  Double_t mean = 0;
+  for (size_t i=0; i<sorted.size(); i++) mean += sorted[i];
+  mean /= sorted.size();
+  std::cout << "--------------------------------------------------------------------------------" << std::endl;
+  std::cout << "Benchmark                          ns/event(min)  ns/event(median)  ns/event(mean)  repetitions" << std::endl;
+  std::cout << "AliGFWFlowContainer::FillProfiles  "
+            << sorted.front() << "  " << sorted[sorted.size()/2] << "  " << mean << "  " << nRep << std::endl;
+  return 0;
+}
@@ -63,6 +63,15 @@ Bool_t cutonTPCsignalN=  kFALSE;
 Int_t num= 0;
 Int_t ev=0;
 
+namespace {
+  // empty a per-event column and reserve it for the track multiplicity, so the
+  // push_backs in the track loop do not reallocate
+  template <typename T> void ResetColumn(std::vector<T>& column, Int_t n){
+    column.clear();
+    if(n>0) column.reserve(n);
+  }
+}
+
 
 AliAnalysisTaskMLTreeMaker::AliAnalysisTaskMLTreeMaker():
   AliAnalysisTaskSE(),
@@ -188,6 +197,7 @@ AliAnalysisTaskMLTreeMaker::AliAnalysisTaskMLTreeMaker():
   fmeanTOF(0), 
   fIsTMVAInit(kFALSE),      
   fuseCorr(kFALSE),      
+  fTMVAMethod(0),
   fTree(0),
   fQAHist(0)
 {
@@ -318,6 +328,7 @@ AliAnalysisTaskMLTreeMaker::AliAnalysisTaskMLTreeMaker(const char *name,TString
   fmeanTOF(0), 
   fIsTMVAInit(kFALSE),           
   fuseCorr(kFALSE),      
+  fTMVAMethod(0),
   fTree(0),
   fQAHist(0)
 {
@@ -576,58 +587,59 @@ Int_t AliAnalysisTaskMLTreeMaker::GetAcceptedTracks(AliVEvent *event, Double_t g
   Int_t acceptedTracks = 0;
   Bool_t isAOD         = kFALSE;
   Int_t mpdg=0;
-  eta.clear();
-  phi.clear();
-  pt.clear(); 
+  const Int_t nTracks = event->GetNumberOfTracks();
+  ResetColumn(eta, nTracks);
+  ResetColumn(phi, nTracks);
+  ResetColumn(pt, nTracks);
 //  NClustersITS.clear();
-  NCrossedRowsTPC.clear();
-  NClustersTPC.clear();
-  HasSPDfirstHit.clear(); 
-  RatioCrossedRowsFindableClusters.clear(); 
-  NTPCSignal.clear(); 
-  EsigTPC.clear();
-  EsigTOF.clear();
-  EsigITS.clear();
-  PsigTPC.clear();
-  PsigTOF.clear();
-  PsigITS.clear();
-  KsigTPC.clear();
-  KsigTOF.clear();
-  KsigITS.clear();
-  MCpt.clear();
-  MCeta.clear();
-  MCphi.clear(); 
-  dcar.clear();
-  dcaz.clear();
-  nITS.clear();
-  nITSshared.clear();
-  chi2ITS.clear();
+  ResetColumn(NCrossedRowsTPC, nTracks);
+  ResetColumn(NClustersTPC, nTracks);
+  ResetColumn(HasSPDfirstHit, nTracks);
+  ResetColumn(RatioCrossedRowsFindableClusters, nTracks);
+  ResetColumn(NTPCSignal, nTracks);
+  ResetColumn(EsigTPC, nTracks);
+  ResetColumn(EsigTOF, nTracks);
+  ResetColumn(EsigITS, nTracks);
+  ResetColumn(PsigTPC, nTracks);
+  ResetColumn(PsigTOF, nTracks);
+  ResetColumn(PsigITS, nTracks);
+  ResetColumn(KsigTPC, nTracks);
+  ResetColumn(KsigTOF, nTracks);
+  ResetColumn(KsigITS, nTracks);
+  ResetColumn(MCpt, nTracks);
+  ResetColumn(MCeta, nTracks);
+  ResetColumn(MCphi, nTracks);
+  ResetColumn(dcar, nTracks);
+  ResetColumn(dcaz, nTracks);
+  ResetColumn(nITS, nTracks);
+  ResetColumn(nITSshared, nTracks);
+  ResetColumn(chi2ITS, nTracks);
 //  chi2TPC.clear();
 //  chi2Global.clear();
-  chi2GlobalvsTPC.clear();
-  chi2GlobalPerNDF.clear();
-  pdg.clear();
-  pdgmother.clear();
-  hasmother.clear();
-  motherlabel.clear();
-  label.clear();  
-  charge.clear();
-  MCvertx.clear();
-  MCverty.clear();
-  MCvertz.clear();
-  glabel.clear();
-  gLabelFirstMother.clear();
-  gLabelMinFirstMother.clear();
-  gLabelMaxFirstMother.clear();
-  iGenIndex.clear();
-  iPdgFirstMother.clear();
-  ITS1S.clear();
-  ITS2S.clear();
-  ITS3S.clear();
-  ITS4S.clear();
-  ITS5S.clear();
-  ITS6S.clear(); 
-  MVAout.clear(); 
+  ResetColumn(chi2GlobalvsTPC, nTracks);
+  ResetColumn(chi2GlobalPerNDF, nTracks);
+  ResetColumn(pdg, nTracks);
+  ResetColumn(pdgmother, nTracks);
+  ResetColumn(hasmother, nTracks);
+  ResetColumn(motherlabel, nTracks);
+  ResetColumn(label, nTracks);
+  ResetColumn(charge, nTracks);
+  ResetColumn(MCvertx, nTracks);
+  ResetColumn(MCverty, nTracks);
+  ResetColumn(MCvertz, nTracks);
+  ResetColumn(glabel, nTracks);
+  ResetColumn(gLabelFirstMother, nTracks);
+  ResetColumn(gLabelMinFirstMother, nTracks);
+  ResetColumn(gLabelMaxFirstMother, nTracks);
+  ResetColumn(iGenIndex, nTracks);
+  ResetColumn(iPdgFirstMother, nTracks);
+  ResetColumn(ITS1S, nTracks);
+  ResetColumn(ITS2S, nTracks);
+  ResetColumn(ITS3S, nTracks);
+  ResetColumn(ITS4S, nTracks);
+  ResetColumn(ITS5S, nTracks);
+  ResetColumn(ITS6S, nTracks);
+  ResetColumn(MVAout, nTracks);
    
   
   
@@ -641,8 +653,10 @@ Int_t AliAnalysisTaskMLTreeMaker::GetAcceptedTracks(AliVEvent *event, Double_t g
   // need this to use PID in dielectron framework
   varManager->SetPIDResponse(fPIDResponse);
 
+  // all cuts of the filter have to pass, the mask does not change within the event
+  const UInt_t selectedMask = (1 << filter->GetCuts()->GetEntries()) - 1;
 
-  for (Int_t iTracks = 0; iTracks < event->GetNumberOfTracks(); iTracks++) {
+  for (Int_t iTracks = 0; iTracks < nTracks; iTracks++) {
     
     
       fQAHist->Fill("All tracks",1); 
@@ -684,7 +698,6 @@ Int_t AliAnalysisTaskMLTreeMaker::GetAcceptedTracks(AliVEvent *event, Double_t g
 
       fQAHist->Fill("Tracks aft MC Gen, bef tr cuts",1); 
       
-    UInt_t selectedMask = (1 << filter->GetCuts()->GetEntries()) - 1;
     if (selectedMask != (filter->IsSelected((AliVParticle*) track))) {
       fQAHist->Fill("Tracks not selected filter",1);
           continue;
@@ -915,36 +928,40 @@ Int_t AliAnalysisTaskMLTreeMaker::GetAcceptedTracks(AliVEvent *event, Double_t g
       }
       
       
-      if(useTMVA){
-        
-           nITSTMVA = (Float_t)nITS.back();
-	   ITS1SharedTMVA = (Float_t)ITS1S.back();
-	   ITS2SharedTMVA = (Float_t)ITS2S.back();
-	   ITS3SharedTMVA = (Float_t)ITS3S.back();
-	   ITS4SharedTMVA = (Float_t)ITS4S.back();
-	   ITS5SharedTMVA = (Float_t)ITS5S.back();
-	   ITS6SharedTMVA = (Float_t)ITS6S.back();
-	   nITSshared_fracTMVA = (Float_t)nITSshared.back();
-	   NCrossedRowsTPCTMVA= (Float_t)NCrossedRowsTPC.back();
-	   NClustersTPCTMVA = (Float_t) NClustersTPC.back();
-	   NTPCSignalTMVA = (Float_t) NTPCSignal.back();
-	   logDCAxyTMVA = (Float_t) TMath::Log(TMath::Abs(dcar.back()));
-	   logDCAzTMVA = (Float_t) TMath::Log(TMath::Abs(dcaz.back()));   
-	   chi2GlobalPerNDFTMVA = (Float_t)chi2GlobalPerNDF.back();
-	   chi2ITSTMVA = (Float_t) chi2ITS.back();
-	   etaTMVA= (Float_t) eta.back();
-	   phiTMVA = (Float_t) phi.back();
-	   ptTMVA = (Float_t) pt.back();   
-	   centTMVA = (Float_t)cent;
-      
-           MVAout.push_back(TMVAReader->EvaluateMVA("BDTG method"));
-           
-//           cout<<iTracks<<":  "<<nITSTMVA<<" "<<ITS1SharedTMVA<<" "<<ITS2SharedTMVA<<" "<<ITS3SharedTMVA<<" "<<ITS4SharedTMVA<<" "<<ITS5SharedTMVA<<" "<<ITS6SharedTMVA<<" "<<nITSTMVA<<" "<<nITSshared_fracTMVA<<" "<<NCrossedRowsTPCTMVA<<" "<<NClustersTPCTMVA<<" "<<NTPCSignalTMVA<<" "<<logDCAxyTMVA<<" "<<logDCAzTMVA<<" "<<chi2GlobalPerNDFTMVA<<" "<<chi2ITSTMVA<<" "<<etaTMVA<<" "<<phiTMVA<<" "<<ptTMVA<<" "<<centTMVA<<" "<<MVAout.back()<<endl;
-      }
-
       acceptedTracks++;
   }
-    
+
+  // evaluate the BDT in one pass over the filled columns, in the same track order
+  if(useTMVA){
+    centTMVA = (Float_t)cent;
+    // the global chi2 is only filled for AOD tracks
+    const Bool_t hasChi2Global = ((Int_t)chi2GlobalPerNDF.size() == acceptedTracks);
+
+    for(Int_t iTrack = 0; iTrack < acceptedTracks; iTrack++){
+      nITSTMVA = (Float_t)nITS[iTrack];
+      ITS1SharedTMVA = (Float_t)ITS1S[iTrack];
+      ITS2SharedTMVA = (Float_t)ITS2S[iTrack];
+      ITS3SharedTMVA = (Float_t)ITS3S[iTrack];
+      ITS4SharedTMVA = (Float_t)ITS4S[iTrack];
+      ITS5SharedTMVA = (Float_t)ITS5S[iTrack];
+      ITS6SharedTMVA = (Float_t)ITS6S[iTrack];
+      nITSshared_fracTMVA = (Float_t)nITSshared[iTrack];
+      NCrossedRowsTPCTMVA = (Float_t)NCrossedRowsTPC[iTrack];
+      NClustersTPCTMVA = (Float_t)NClustersTPC[iTrack];
+      NTPCSignalTMVA = (Float_t)NTPCSignal[iTrack];
+      logDCAxyTMVA = (Float_t)TMath::Log(TMath::Abs(dcar[iTrack]));
+      logDCAzTMVA = (Float_t)TMath::Log(TMath::Abs(dcaz[iTrack]));
+      chi2GlobalPerNDFTMVA = hasChi2Global ? (Float_t)chi2GlobalPerNDF[iTrack] : 0.;
+      chi2ITSTMVA = (Float_t)chi2ITS[iTrack];
+      etaTMVA = (Float_t)eta[iTrack];
+      phiTMVA = (Float_t)phi[iTrack];
+      ptTMVA = (Float_t)pt[iTrack];
+
+      if(fTMVAMethod) MVAout.push_back(TMVAReader->EvaluateMVA(fTMVAMethod));
+      else            MVAout.push_back(TMVAReader->EvaluateMVA("BDTG method"));
+    }
+  }
+
   num++;
   return acceptedTracks;  
 }
@@ -1051,7 +1068,8 @@ void AliAnalysisTaskMLTreeMaker::SetupTMVAReader(TString weightFile){
   gSystem->Exec(Form("alien_cp alien:///alice/cern.ch/user/s/selehner/TMVAweights/%s .",weightFile.Data()));
   std::cout<<"Setting weights file: "<<weightFile.Data()<<std::endl;
 
-  TMVAReader->BookMVA( "BDTG method", weightFile.Data() );
+  fTMVAMethod = dynamic_cast<TMVA::MethodBase*>(TMVAReader->BookMVA( "BDTG method", weightFile.Data() ));
+  if(!fTMVAMethod) AliWarning("BDTG method not booked as MethodBase, evaluate it by name");
 
 }
 
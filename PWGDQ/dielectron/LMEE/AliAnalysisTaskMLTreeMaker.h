@@ -16,6 +16,7 @@ class TH3D;
 #include "AliDielectronEventCuts.h"
 #include "TMVA/Tools.h"
 #include "TMVA/Reader.h"
+#include "TMVA/MethodBase.h"
 #ifndef ALIANALYSISTASKSE_H
 #endif
 
@@ -317,6 +318,7 @@ class AliAnalysisTaskMLTreeMaker : public AliAnalysisTaskSE {
   
   Bool_t fuseCorr;
   Bool_t fIsTMVAInit;
+  TMVA::MethodBase* fTMVAMethod;   //! booked BDT, evaluated directly instead of by name for every track
   //TBits*            fUsedVars;                // used variables by AliDielectronVarManager
   
 //  Double_t probs[AliPID::kSPECIESC];
@@ -329,7 +331,7 @@ class AliAnalysisTaskMLTreeMaker : public AliAnalysisTaskSE {
 //  TH3D* fHistEtaPhiPt;//QA histogram for eta/phi/pt distribution
 
 
-  ClassDef(AliAnalysisTaskMLTreeMaker, 1); 
+  ClassDef(AliAnalysisTaskMLTreeMaker, 2); 
 
 };
 
@@ -70,6 +70,9 @@ The names are available via the function PairClassName(Int_t i)
 #include "AliDielectronPairLegCuts.h"
 #include "AliDielectronV0Cuts.h"
 #include "AliDielectronPID.h"
+#include "AliDielectronVarCuts.h"
+#include "AliDielectronEventCuts.h"
+#include "AliDielectronCutGroup.h"
 #include "AliDielectronHistos.h"
 
 #include "AliDielectron.h"
@@ -339,6 +342,25 @@ void AliDielectron::Init()
     fQAmonitor->Init();
   }
 
+  // build the fill map from the variables used by all the components which read
+  // values filled by the AliDielectronVarManager (e.g. the event data used by the mixing handler)
+  AddUsedVars(fEventFilter.GetCuts());
+  AddUsedVars(fTrackFilter.GetCuts());
+  AddUsedVars(fPairPreFilter1.GetCuts());
+  AddUsedVars(fPairPreFilter2.GetCuts());
+  AddUsedVars(fPairPreFilterLegs1.GetCuts());
+  AddUsedVars(fPairPreFilterLegs2.GetCuts());
+  AddUsedVars(fPairFilter.GetCuts());
+  AddUsedVars(fEventPlanePreFilter.GetCuts());
+  AddUsedVars(fEventPlanePOIPreFilter.GetCuts());
+  if (fMixing) {
+    for (Int_t ivar=0; ivar<fMixing->GetNumberOfVariables(); ++ivar)
+      fUsedVars->SetBitNumber(fMixing->GetVariable(ivar),kTRUE);
+  }
+  if (fCfManagerPair) AddUsedVars(fCfManagerPair->GetUsedVars());
+  if (fHistoArray)    AddUsedVars(fHistoArray->GetUsedVars());
+  if (fDebugTree)     AddUsedVars(fDebugTree->GetUsedVars());
+
   if(fHistos) {
     (*fUsedVars)|= (*fHistos->GetUsedVars());
 
@@ -350,6 +372,43 @@ void AliDielectron::Init()
   }
 }
 
+//________________________________________________________________
+void AliDielectron::AddUsedVars(const TList *cuts)
+{
+  //
+  // Add the variables used by the cuts in the list to the fill map,
+  // cut groups and pair leg cuts are looked into recursively
+  //
+  if (!cuts) return;
+  TIter next(cuts);
+  TObject *cut=0x0;
+  while ( (cut=next()) ) {
+    if (cut->IsA()==AliDielectronVarCuts::Class())        AddUsedVars(static_cast<AliDielectronVarCuts*>(cut)->GetUsedVars());
+    else if (cut->IsA()==AliDielectronPID::Class())       AddUsedVars(static_cast<AliDielectronPID*>(cut)->GetUsedVars());
+    else if (cut->IsA()==AliDielectronEventCuts::Class()) AddUsedVars(static_cast<AliDielectronEventCuts*>(cut)->GetUsedVars());
+    else if (cut->IsA()==AliDielectronPairLegCuts::Class()) {
+      AliDielectronPairLegCuts *legCuts=static_cast<AliDielectronPairLegCuts*>(cut);
+      AddUsedVars(legCuts->GetLeg1Filter().GetCuts());
+      AddUsedVars(legCuts->GetLeg2Filter().GetCuts());
+    }
+    else if (cut->IsA()==AliDielectronCutGroup::Class()) {
+      AliDielectronCutGroup *group=static_cast<AliDielectronCutGroup*>(cut);
+      TList groupCuts;
+      for (Int_t icut=0; icut<group->GetNCuts(); ++icut) groupCuts.Add(const_cast<AliAnalysisCuts*>(group->GetCut(icut)));
+      AddUsedVars(&groupCuts);
+    }
+  }
+}
+
+//________________________________________________________________
+void AliDielectron::AddUsedVars(const TBits *vars)
+{
+  //
+  // Add variables to the fill map
+  //
+  if (vars) (*fUsedVars)|=(*vars);
+}
+
 //________________________________________________________________
 
 void AliDielectron::Process(TObjArray *arr)
@@ -1421,6 +1480,10 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  //the mother labels can only be found with an MC event (GetLabelMotherWithPdg returns -1 otherwise)
+  AliDielectronMC *mc=AliDielectronMC::Instance();
+  const Bool_t hasMCEvent=(mc->GetMCEvent()!=0x0);
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
@@ -1430,14 +1493,13 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
                            &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
       candidate->SetType(pairIndex);
 
-      Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
+      Int_t label=hasMCEvent ? mc->GetLabelMotherWithPdg(candidate,fPdgMother) : -1;
       candidate->SetLabel(label);
       if (label>-1) candidate->SetPdgCode(fPdgMother);
       else candidate->SetPdgCode(0);
 
-      // check for gamma kf particle
-      label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
-      if (label>-1 && fUseGammaTracks) {
+      // check for gamma kf particle, the label is only used for the gamma tracks
+      if (fUseGammaTracks && hasMCEvent && mc->GetLabelMotherWithPdg(candidate,22)>-1) {
         candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1)), fPdgLeg1,
                                   static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2)), fPdgLeg2);
       // should we set the pdgmothercode and the label
@@ -284,6 +284,8 @@ private:
 
   void InitPairCandidateArrays();
   void ClearArrays();
+  void AddUsedVars(const TList *cuts);
+  void AddUsedVars(const TBits *vars);
 
   TObjArray* PairArray(Int_t i);
   TObject* InitEffMap(TString filename, TString generatedname, TString foundname);
@@ -58,6 +58,7 @@ public:
   void SetRequire2013vertexandevent(Bool_t req13 = kTRUE) {fRequire13sel = req13; }
   void SetMinCorrCutFunction(TF1 *fun, UInt_t varx, UInt_t vary=0);
   void SetMaxCorrCutFunction(TF1 *fun, UInt_t varx, UInt_t vary=0);
+  TBits* GetUsedVars() const { return fUsedVars; }
 
   //
   //Analysis cuts interface
@@ -64,7 +64,12 @@ AliDielectronHF::AliDielectronHF() :
   fHasMC(kFALSE),
   fStepGenerated(kFALSE),
   fEventArray(kFALSE),
-  fRefObj(1)
+  fRefObj(1),
+  fCellLowEdges(),
+  fCellUpEdges(),
+  fCellOffsets(),
+  fSelectedCells(),
+  fSelectedCellsTmp()
 {
   //
   // Default Constructor
@@ -91,7 +96,12 @@ AliDielectronHF::AliDielectronHF(const char* name, const char* title) :
   fHasMC(kFALSE),
   fStepGenerated(kFALSE),
   fEventArray(kFALSE),
-  fRefObj(1)
+  fRefObj(1),
+  fCellLowEdges(),
+  fCellUpEdges(),
+  fCellOffsets(),
+  fSelectedCells(),
+  fSelectedCellsTmp()
 {
   //
   // Named Constructor
@@ -484,61 +494,55 @@ void AliDielectronHF::Fill(Int_t index, Double_t * const valuesPair, Double_t *
   TObjArray *histArr = static_cast<TObjArray*>(fArrPairType.At(index));
   if(!histArr) return;
 
-  Int_t size  = GetNumberOfBins();
-  // loop over all histograms
-  for(Int_t ihist=0; ihist<size; ihist++) {
-
-    Int_t sizeAdd   = 1;
-    Bool_t selected = kTRUE;
-
-    // loop over all cut variables
-    Int_t nvars = fAxes.GetEntriesFast();
-    for(Int_t ivar=0; ivar<nvars; ivar++) {
-
-      // get bin limits
-      TVectorD *bins = static_cast<TVectorD*>(fAxes.At(ivar));
-      Int_t nbins    = bins->GetNrows()-1;
+  // bin cell limits, the same for all pairs
+  Int_t nvars = fAxes.GetEntriesFast();
+  if((Int_t)fCellOffsets.size()!=nvars+1) InitCellEdges();
 
-      // bin limits for current ivar bin
-      Int_t ibin   = (ihist/sizeAdd)%nbins;
-      Double_t lowEdge = (*bins)[ibin];
-      Double_t upEdge  = (*bins)[ibin+1];
-      switch(fBinType[ivar]) {
-      case kStdBin:     upEdge=(*bins)[ibin+1];     break;
-      case kBinToMax:   upEdge=(*bins)[nbins];      break;
-      case kBinFromMin: lowEdge=(*bins)[0];         break;
-      case kSymBin:     upEdge=(*bins)[nbins-ibin];
-	if(ibin>=((Double_t)(nbins+1))/2) upEdge=(*bins)[nbins]; // to avoid low>up
-	break;
-      }
+  // the selection of a bin cell is the product of the selections of its bins in each cut variable:
+  // build the indices of the selected cells variable by variable instead of testing all cells
+  fSelectedCells.assign(1,0);
+  Int_t sizeAdd = 1;
+  for(Int_t ivar=0; ivar<nvars; ivar++) {
+    Int_t nbins = fCellOffsets[ivar+1]-fCellOffsets[ivar];
+    const Double_t *lowEdges = &fCellLowEdges[fCellOffsets[ivar]];
+    const Double_t *upEdges  = &fCellUpEdges[fCellOffsets[ivar]];
+    const Bool_t leg = fVarCutType->TestBitNumber(ivar);
+    const Double_t valueLeg1 = valuesLeg1[fVarCuts[ivar]];
+    const Double_t valueLeg2 = valuesLeg2[fVarCuts[ivar]];
+    const Double_t valuePair = valuesPair[fVarCuts[ivar]];
+
+    fSelectedCellsTmp.clear();
+    for(Int_t ibin=0; ibin<nbins; ibin++) {
+      Double_t lowEdge = lowEdges[ibin];
+      Double_t upEdge  = upEdges[ibin];
 
       // leg variable
-      if(fVarCutType->TestBitNumber(ivar)) {
-	if( (valuesLeg1[fVarCuts[ivar]] < lowEdge || valuesLeg1[fVarCuts[ivar]] >= upEdge) ||
-	    (valuesLeg2[fVarCuts[ivar]] < lowEdge || valuesLeg2[fVarCuts[ivar]] >= upEdge) ) {
-	  selected=kFALSE;
-	  break;
-	}
+      if(leg) {
+	if( (valueLeg1 < lowEdge || valueLeg1 >= upEdge) ||
+	    (valueLeg2 < lowEdge || valueLeg2 >= upEdge) ) continue;
       }
       else { // pair and event variables
-	if( (valuesPair[fVarCuts[ivar]] < lowEdge || valuesPair[fVarCuts[ivar]] >= upEdge) ) {
-	  selected=kFALSE;
-	  break;
-	}
+	if( (valuePair < lowEdge || valuePair >= upEdge) ) continue;
       }
 
-      sizeAdd*=nbins;
-    } //end of var cut loop
+      for(UInt_t icell=0; icell<fSelectedCells.size(); icell++)
+	fSelectedCellsTmp.push_back(fSelectedCells[icell]+ibin*sizeAdd);
+    }
+    fSelectedCells.swap(fSelectedCellsTmp);
+    if(fSelectedCells.empty()) return;
+
+    sizeAdd*=nbins;
+  } //end of var cut loop
 
-    // do not fill the histogram
-    if(!selected) continue;
+  // loop over the selected histograms
+  for(UInt_t icell=0; icell<fSelectedCells.size(); icell++) {
+    Int_t ihist = fSelectedCells[icell];
 
     // fill the object with Pair and event values
-    TObjArray *tmp = (TObjArray*) histArr->At(ihist);
-    TString title = tmp->GetName();
-    AliDebug(10,title.Data());
+    TObjArray *tmp = (TObjArray*) histArr->UncheckedAt(ihist);
+    AliDebug(10,tmp->GetName());
     for(Int_t i=0; i<tmp->GetEntriesFast(); i++) {
-      AliDielectronHistos::FillValues(tmp->At(i), valuesPair);
+      AliDielectronHistos::FillValues(tmp->UncheckedAt(i), valuesPair);
     }
     //    AliDebug(10,Form("Fill var %d %s value %f in %s \n",fVar,AliDielectronVarManager::GetValueName(fVar),valuesPair[fVar],tmp->GetName()));
   } //end of hist loop
@@ -601,16 +605,9 @@ void AliDielectronHF::Init()
 
       // get the lower limit for current ivar bin
       Int_t ibin   = (ihist/sizeAdd)%nbins;
-      Double_t lowEdge = (*bins)[ibin];
-      Double_t upEdge  = (*bins)[ibin+1];
-      switch(fBinType[ivar]) {
-      case kStdBin:     upEdge=(*bins)[ibin+1];     break;
-      case kBinToMax:   upEdge=(*bins)[nbins];      break;
-      case kBinFromMin: lowEdge=(*bins)[0];         break;
-      case kSymBin:     upEdge=(*bins)[nbins-ibin];
-	if(ibin>=((Double_t)(nbins+1))/2) upEdge=(*bins)[nbins]; // to avoid low>up
-	break;
-      }
+      Double_t lowEdge = 0.;
+      Double_t upEdge  = 0.;
+      GetCellEdges(ivar, ibin, lowEdge, upEdge);
 
       TObjArray *tmp= (TObjArray*) histArr->At(ihist);
       TString title = tmp->GetName();
@@ -673,6 +670,50 @@ void AliDielectronHF::Init()
   }
 }
 
+//______________________________________________
+void AliDielectronHF::GetCellEdges(Int_t ivar, Int_t ibin, Double_t &lowEdge, Double_t &upEdge) const
+{
+  //
+  // lower and upper limit of bin ibin of cut variable ivar, according to its binning type
+  //
+  TVectorD *bins = static_cast<TVectorD*>(fAxes.At(ivar));
+  Int_t nbins    = bins->GetNrows()-1;
+
+  lowEdge = (*bins)[ibin];
+  upEdge  = (*bins)[ibin+1];
+  switch(fBinType[ivar]) {
+  case kStdBin:     upEdge=(*bins)[ibin+1];     break;
+  case kBinToMax:   upEdge=(*bins)[nbins];      break;
+  case kBinFromMin: lowEdge=(*bins)[0];         break;
+  case kSymBin:     upEdge=(*bins)[nbins-ibin];
+    if(ibin>=((Double_t)(nbins+1))/2) upEdge=(*bins)[nbins]; // to avoid low>up
+    break;
+  }
+}
+
+//______________________________________________
+void AliDielectronHF::InitCellEdges()
+{
+  //
+  // fill the table of bin limits of all cut variables used in Fill
+  //
+  Int_t nvars = fAxes.GetEntriesFast();
+  fCellLowEdges.clear();
+  fCellUpEdges.clear();
+  fCellOffsets.assign(1,0);
+  for(Int_t ivar=0; ivar<nvars; ivar++) {
+    Int_t nbins = (static_cast<TVectorD*>(fAxes.At(ivar)))->GetNrows()-1;
+    for(Int_t ibin=0; ibin<nbins; ibin++) {
+      Double_t lowEdge = 0.;
+      Double_t upEdge  = 0.;
+      GetCellEdges(ivar, ibin, lowEdge, upEdge);
+      fCellLowEdges.push_back(lowEdge);
+      fCellUpEdges.push_back(upEdge);
+    }
+    fCellOffsets.push_back(fCellLowEdges.size());
+  }
+}
+
 //______________________________________________
 Int_t AliDielectronHF::GetNumberOfBins() const
 {
@@ -13,6 +13,8 @@
 //#                                                           #
 //#############################################################
 
+#include <vector>
+
 #include <TNamed.h>
 #include <TObjArray.h>
 #include <TBits.h>
@@ -99,6 +101,7 @@ public:
   Int_t GetNumberOfBins() const;
   const TObjArray * GetHistArray() const { return &fArrPairType; }
   Bool_t GetStepForMCGenerated()   const { return fStepGenerated; }
+  TBits* GetUsedVars()            const { return fUsedVars; }
   Bool_t IsEventArray()           const { return fEventArray; }
   
   
@@ -121,11 +124,20 @@ private:
   Bool_t    fEventArray;            // switch OFF pair types and ON event array
   TObjArray fRefObj;               // reference object
 
+  std::vector<Double_t> fCellLowEdges;  //! lower limits of the bins of all cut variables
+  std::vector<Double_t> fCellUpEdges;   //! upper limits of the bins of all cut variables
+  std::vector<Int_t> fCellOffsets;      //! first bin of each cut variable in the limit tables
+  std::vector<Int_t> fSelectedCells;    //! bin cells selected for the current pair
+  std::vector<Int_t> fSelectedCellsTmp; //! buffer to build fSelectedCells
+
+  void GetCellEdges(Int_t ivar, Int_t ibin, Double_t &lowEdge, Double_t &upEdge) const;
+  void InitCellEdges();
+
   AliDielectronHF(const AliDielectronHF &c);
   AliDielectronHF &operator=(const AliDielectronHF &c);
 
   
-  ClassDef(AliDielectronHF,6)         // Dielectron HF
+  ClassDef(AliDielectronHF,7)         // Dielectron HF
 };
 
 
@@ -292,6 +292,10 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
   TIter ev1P(&arrTrDummy[0]);
   TIter ev1N(&arrTrDummy[1]);
   
+  //vertex of the first event, the same for all events of the pool
+  const Double_t vFirst[3]={values[AliDielectronVarManager::kXvPrim],
+                            values[AliDielectronVarManager::kYvPrim],
+                            values[AliDielectronVarManager::kZvPrim]};
 
   for (Int_t i1=0; i1<pool.GetEntriesFast(); ++i1){
     const AliDielectronEvent *ev2=static_cast<AliDielectronEvent*>(pool.At(i1));
@@ -313,15 +317,11 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
 
     //
     //move tracks to the same vertex (vertex of the first event), if requested
+    //MoveToSameVertex is only implemented for ESD tracks, AOD pool events are skipped
     //
-    if (fMoveToSameVertex){
-      const Double_t *varsFirst=values;
+    if (fMoveToSameVertex && !ev2->IsAOD()){
       const Double_t *varsMix=ev2->GetEventData();
 
-      const Double_t vFirst[3]={varsFirst[AliDielectronVarManager::kXvPrim],
-                                varsFirst[AliDielectronVarManager::kYvPrim],
-                                varsFirst[AliDielectronVarManager::kZvPrim]};
-
       const Double_t vMix[3]  ={varsMix[AliDielectronVarManager::kXvPrim],
                                 varsMix[AliDielectronVarManager::kYvPrim],
                                 varsMix[AliDielectronVarManager::kZvPrim]};
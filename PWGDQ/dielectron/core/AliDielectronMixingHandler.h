@@ -56,6 +56,8 @@ public:
   void SetSkipFirstEvent(Bool_t skip) { fSkipFirstEvt=skip; }
 
   Int_t GetNumberOfBins() const;
+  Int_t GetNumberOfVariables() const { return fAxes.GetEntriesFast(); }
+  UShort_t GetVariable(Int_t i) const { return fEventCuts[i]; }
   Int_t FindBin(const Double_t values[], TString *dim=0x0);
   void Fill(const AliVEvent *ev, AliDielectron *diele);
 
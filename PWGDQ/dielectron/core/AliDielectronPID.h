@@ -70,6 +70,7 @@ public:
   void SetDefaults(Int_t def);
 
   Int_t GetNCuts() { return fNcuts;}
+  TBits* GetUsedVars() const { return fUsedVars; }
   //
   //Analysis cuts interface
   //const
@@ -29,6 +29,7 @@ Detailed description
 
 #include "TMVA/Tools.h"
 #include "TMVA/Reader.h"
+#include "TMVA/MethodBase.h"
 
 #include "AliLog.h"
 #include "AliDielectronVarManager.h"
@@ -46,7 +47,8 @@ AliAnalysisCuts(),
   fIsSpectator(new TBits(nInputFeatureMax)),
   nInputFeatureActive(0),
   mvaCutValue(0.),
-  isInitialized(kFALSE)
+  isInitialized(kFALSE),
+  TMVAMethod(0)
 {
   //
   // Default Constructor
@@ -73,7 +75,8 @@ AliDielectronTMVACuts::AliDielectronTMVACuts(const char* name, const char* title
 	     fIsSpectator(new TBits(nInputFeatureMax)),
 	     nInputFeatureActive(0),
 	     mvaCutValue(0.),
-	     isInitialized(kFALSE)
+	     isInitialized(kFALSE),
+	     TMVAMethod(0)
 {
   //
   // Named Constructor
@@ -131,7 +134,8 @@ void AliDielectronTMVACuts::InitTMVAReader()
   // initialize reader (copy weight file and add weight file name)
   AliInfo(Form("Initialize TMVA reader %s with weight file %s from path %s",TMVAReaderName.Data(),TMVAWeightFileName.Data(),TMVAWeightPathName.Data()));
   gSystem->Exec(Form("alien_cp %s/%s .",TMVAWeightPathName.Data(),TMVAWeightFileName.Data()));
-  TMVAReader->BookMVA(TMVAReaderName.Data(),TMVAWeightFileName.Data());
+  TMVAMethod = dynamic_cast<TMVA::MethodBase*>(TMVAReader->BookMVA(TMVAReaderName.Data(),TMVAWeightFileName.Data()));
+  if(!TMVAMethod) AliWarning(Form("TMVA method %s not booked as MethodBase, evaluate it by name",TMVAReaderName.Data()));
   
   // set to initialized
   isInitialized = kTRUE;
@@ -269,21 +273,16 @@ void AliDielectronTMVACuts::SetTMVAWeights(TString TMVAName, TString weightName)
 }
 
 //______________________________________________
-Bool_t AliDielectronTMVACuts::IsSelected(TObject* track)
+Bool_t AliDielectronTMVACuts::CheckTMVAReader()
 {
   //
-  // Apply configured cuts
+  // Initialize the TMVA reader at the first decision and check that it is usable
   //
 
   // first check if TMVA reader is initialized (needed for running on GRID)
   if(!isInitialized)
     InitTMVAReader();
 
-  AliVTrack *vtrack=dynamic_cast<AliVTrack*>(track);
-  if (!vtrack) return kFALSE;
-  
-  Bool_t accept=kTRUE;
-
   if(!TMVAReader){
     AliFatal("TMVA reader not available");
     return kFALSE;
@@ -294,26 +293,90 @@ Bool_t AliDielectronTMVACuts::IsSelected(TObject* track)
     return kFALSE;
   }
 
-  // // Just testing....
-  // TMVAReader->BookMVA(TMVAReaderName.Data(),"TMVA_e_0_05_05_05_electron0555first.weights.xml");
+  return kTRUE;
+}
 
+//______________________________________________
+Float_t AliDielectronTMVACuts::EvaluateTrack(TObject* track, Double_t* values)
+{
+  //
+  // MVA output value of one track, the reader needs to be checked before
+  //
 
-  // set input features
-  Double_t values[AliDielectronVarManager::kNMaxValues];
+  // set input features, only the used variables are filled
   AliDielectronVarManager::SetFillMap(fUsedVars);
   AliDielectronVarManager::Fill(track, values);
-  
+
   for(Int_t i = 0; i < nInputFeatureActive; i++){
     inputFeature[i] = (Float_t) values[inputFeatureNumber[i]];
   }
 
-  // evaluate MVA output value
-  Float_t mvaOutput = (Float_t)TMVAReader->EvaluateMVA(TMVAReaderName.Data());
+  // evaluate MVA output value, via the booked method if available
+  if(TMVAMethod) return (Float_t)TMVAReader->EvaluateMVA(TMVAMethod);
+  return (Float_t)TMVAReader->EvaluateMVA(TMVAReaderName.Data());
+}
 
-  // check if above cut value
-  if(mvaOutput < mvaCutValue){
-    accept = kFALSE;
+//______________________________________________
+Float_t AliDielectronTMVACuts::GetMVAOutput(TObject* track)
+{
+  //
+  // MVA output value of one track (-999. if it cannot be evaluated)
+  //
+
+  if(!CheckTMVAReader()) return -999.;
+  if(!dynamic_cast<AliVTrack*>(track)) return -999.;
+
+  Double_t values[AliDielectronVarManager::kNMaxValues];
+  return EvaluateTrack(track, values);
+}
+
+//______________________________________________
+Int_t AliDielectronTMVACuts::EvaluateMVA(const TObjArray* tracks, std::vector<Float_t> &mvaOutputs, std::vector<Bool_t> &selected)
+{
+  //
+  // Evaluate the MVA for all candidate tracks of an event at once
+  // - mvaOutputs: MVA output value for each entry of tracks (-999. if not a track)
+  // - selected: decision of IsSelected for each entry of tracks
+  // The reader checks and the value buffer are shared by all tracks of the batch.
+  // Returns the number of selected tracks.
+  //
+
+  const Int_t nTracks = tracks ? tracks->GetEntriesFast() : 0;
+  mvaOutputs.assign(nTracks, -999.);
+  selected.assign(nTracks, kFALSE);
+  if(!nTracks || !CheckTMVAReader()) return 0;
+
+  Int_t nSelected = 0;
+  Double_t values[AliDielectronVarManager::kNMaxValues];
+  for(Int_t itrack = 0; itrack < nTracks; itrack++){
+    TObject *track = tracks->UncheckedAt(itrack);
+    if(!dynamic_cast<AliVTrack*>(track)) continue;
+    mvaOutputs[itrack] = EvaluateTrack(track, values);
+    // check if above cut value
+    if(!(mvaOutputs[itrack] < mvaCutValue)){
+      selected[itrack] = kTRUE;
+      nSelected++;
+    }
   }
 
-  return accept;
+  return nSelected;
+}
+
+//______________________________________________
+Bool_t AliDielectronTMVACuts::IsSelected(TObject* track)
+{
+  //
+  // Apply configured cuts
+  //
+
+  if(!CheckTMVAReader()) return kFALSE;
+
+  AliVTrack *vtrack=dynamic_cast<AliVTrack*>(track);
+  if (!vtrack) return kFALSE;
+
+  Double_t values[AliDielectronVarManager::kNMaxValues];
+  Float_t mvaOutput = EvaluateTrack(track, values);
+
+  // check if above cut value
+  return !(mvaOutput < mvaCutValue);
 }
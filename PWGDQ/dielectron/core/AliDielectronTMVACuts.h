@@ -15,6 +15,8 @@
 //#                                                           #
 //#############################################################
 
+#include <vector>
+
 #include "TMVA/Reader.h"
 
 #include <AliAnalysisCuts.h>
@@ -39,6 +41,12 @@ public:
   //
   virtual Bool_t IsSelected(TObject* track);
   virtual Bool_t IsSelected(TList*   /* list */ ) {return kFALSE;}
+
+  //
+  // MVA output for single tracks and for all candidate tracks of an event
+  //
+  Float_t GetMVAOutput(TObject* track);
+  Int_t   EvaluateMVA(const TObjArray* tracks, std::vector<Float_t> &mvaOutputs, std::vector<Bool_t> &selected);
   
 
  private:
@@ -47,6 +55,8 @@ public:
   AliDielectronTMVACuts &operator=(const AliDielectronTMVACuts &c);
 
   void InitTMVAReader();                                         // TMVA reader initialization (for GRID running)
+  Bool_t CheckTMVAReader();                                      // lazy initialization and sanity checks of the TMVA reader
+  Float_t EvaluateTrack(TObject* track, Double_t* values);       // MVA output for one track, using the value buffer provided
 
   static const Int_t nInputFeatureMax = 20;                      // maximum number of input features
   
@@ -65,9 +75,10 @@ public:
   Float_t mvaCutValue;                                           // cut value to be used for TMVA output value
 
   Bool_t isInitialized;                                          // flag to mark the first decision and start the TMVA reader initialization (for GRID running)
+  TMVA::MethodBase* TMVAMethod;                                  //! booked method, evaluated directly instead of looking it up by name for each track
   
   
-  ClassDef(AliDielectronTMVACuts,1)                              // Dielectron TMVACuts
+  ClassDef(AliDielectronTMVACuts,2)                              // Dielectron TMVACuts
 };
 
 
@@ -56,7 +56,11 @@ AliDielectronTrackRotator::AliDielectronTrackRotator() :
   fVTrackN(0x0),
   fPdgLeg1(-11),
   fPdgLeg2(11),
-  fSameTracks(kTRUE)
+  fSameTracks(kTRUE),
+  fKFTrackP(),
+  fKFTrackN(),
+  fKFIndexP(-1),
+  fKFIndexN(-1)
 {
   //
   // Default Constructor
@@ -84,7 +88,11 @@ AliDielectronTrackRotator::AliDielectronTrackRotator(const char* name, const cha
   fVTrackN(0x0),
   fPdgLeg1(-11),
   fPdgLeg2(11),
-  fSameTracks(kTRUE)
+  fSameTracks(kTRUE),
+  fKFTrackP(),
+  fKFTrackN(),
+  fKFIndexP(-1),
+  fKFIndexN(-1)
 {
   //
   // Named Constructor
@@ -110,6 +118,7 @@ void AliDielectronTrackRotator::Reset()
   fCurrentIteration=0;
   fCurrentTackP=0;
   fCurrentTackN=0;
+  ResetKFCache();
 }
 
 //______________________________________________
@@ -175,8 +184,18 @@ Bool_t AliDielectronTrackRotator::RotateTracks()
   fVTrackP=0x0;
   fVTrackN=0x0;
   if (!trackP||!trackN) return kFALSE;
-  fTrackP+=AliKFParticle(*trackP,fPdgLeg1);
-  fTrackN+=AliKFParticle(*trackN,fPdgLeg2);
+  // the same tracks are used for fIterations rotations (the negative one for all positive tracks),
+  // build their KF particles only when the track changes
+  if (fKFIndexP!=fCurrentTackP){
+    fKFTrackP=AliKFParticle(*trackP,fPdgLeg1);
+    fKFIndexP=fCurrentTackP;
+  }
+  if (fKFIndexN!=fCurrentTackN){
+    fKFTrackN=AliKFParticle(*trackN,fPdgLeg2);
+    fKFIndexN=fCurrentTackN;
+  }
+  fTrackP+=fKFTrackP;
+  fTrackN+=fKFTrackN;
 
   fVTrackP=trackP;
   fVTrackN=trackN;
@@ -36,7 +36,7 @@ public:
 
   virtual ~AliDielectronTrackRotator();
 
-  void SetTrackArrays(const TObjArray * const arrP, const TObjArray * const arrN) {fkArrTracksP=arrP;fkArrTracksN=arrN;}
+  void SetTrackArrays(const TObjArray * const arrP, const TObjArray * const arrN) {fkArrTracksP=arrP;fkArrTracksN=arrN;ResetKFCache();}
   void Reset();
   Bool_t NextCombination();
 
@@ -55,7 +55,7 @@ public:
   Bool_t GetKeepLocalY() const          { return fKeepLocalY;  }
 
   void SetEvent(AliVEvent * const ev)   { fEvent = ev;           }
-  void SetPdgLegs(Int_t pdfLeg1, Int_t pdfLeg2) { fPdgLeg1=pdfLeg1; fPdgLeg2=pdfLeg2; }
+  void SetPdgLegs(Int_t pdfLeg1, Int_t pdfLeg2) { fPdgLeg1=pdfLeg1; fPdgLeg2=pdfLeg2; ResetKFCache(); }
 
   const AliKFParticle& GetKFTrackP() const {return fTrackP;}
   const AliKFParticle& GetKFTrackN() const {return fTrackN;}
@@ -92,13 +92,19 @@ private:
   Int_t fPdgLeg2;                   //! pdg code leg2
   Bool_t fSameTracks;               //! tracks in both arrays at current position are the same
 
+  AliKFParticle fKFTrackP;          //! unrotated KF particle of the positive track at fKFIndexP
+  AliKFParticle fKFTrackN;          //! unrotated KF particle of the negative track at fKFIndexN
+  Int_t fKFIndexP;                  //! index of the positive track in fKFTrackP (-1: none)
+  Int_t fKFIndexN;                  //! index of the negative track in fKFTrackN (-1: none)
+
   Bool_t RotateTracks();
+  void ResetKFCache() { fKFIndexP=-1; fKFIndexN=-1; }
   
   AliDielectronTrackRotator(const AliDielectronTrackRotator &c);
   AliDielectronTrackRotator &operator=(const AliDielectronTrackRotator &c);
 
   
-  ClassDef(AliDielectronTrackRotator,2)         // Dielectron TrackRotator
+  ClassDef(AliDielectronTrackRotator,3)         // Dielectron TrackRotator
 };
 
 
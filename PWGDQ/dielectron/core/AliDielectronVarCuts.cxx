@@ -44,7 +44,9 @@ AliDielectronVarCuts::AliDielectronVarCuts() :
   fActiveCutsMask(0),
   fSelectedCutsMask(0),
   fCutOnMCtruth(kFALSE),
-  fCutType(kAll)
+  fCutType(kAll),
+  fUpperCutVars(),
+  fUpperCutValues()
 {
   //
   // Default costructor
@@ -68,7 +70,9 @@ AliDielectronVarCuts::AliDielectronVarCuts(const char* name, const char* title)
   fActiveCutsMask(0),
   fSelectedCutsMask(0),
   fCutOnMCtruth(kFALSE),
-  fCutType(kAll)
+  fCutType(kAll),
+  fUpperCutVars(),
+  fUpperCutValues()
 {
   //
   // Named contructor
@@ -159,17 +163,17 @@ Bool_t AliDielectronVarCuts::IsSelected(TObject* track)
         }
         else if ( fUpperCut[iCut]) {
           /// use a THnBase inherited cut object //
-          Double_t *vals = new Double_t[fUpperCut[iCut]->GetNdimensions()];//={-1};
-          // get array of values for the corresponding dimensions using axis names
-          for(Int_t idim=0; idim<fUpperCut[iCut]->GetNdimensions(); idim++) {
-            vals[idim] = values[AliDielectronVarManager::GetValueType(fUpperCut[iCut]->GetAxis(idim)->GetName())];
-            // printf(" \t %s %.3f ",fUpperCut[iCut]->GetAxis(idim)->GetName(),vals[idim]);
+          // get array of values for the corresponding dimensions using the variables of the axes
+          const std::vector<UInt_t> &vars = GetUpperCutVars(iCut);
+          fUpperCutValues.resize(vars.size());
+          for(UInt_t idim=0; idim<vars.size(); idim++) {
+            fUpperCutValues[idim] = values[vars[idim]];
+            // printf(" \t %s %.3f ",fUpperCut[iCut]->GetAxis(idim)->GetName(),fUpperCutValues[idim]);
           }
           // find bin for values (w/o creating it in case it is not filled)
-          Long_t bin = fUpperCut[iCut]->GetBin(vals,kFALSE);
+          Long_t bin = fUpperCut[iCut]->GetBin(&fUpperCutValues[0],kFALSE);
           Double_t cutMax = (bin>0 ? fUpperCut[iCut]->GetBinContent(bin) : -999. );
           if ( ((values[cut]<fCutMin[iCut]) || (values[cut]>cutMax))^fCutExclude[iCut] ) CLRBIT(fSelectedCutsMask,iCut);
-          delete [] vals;
         }
       }
     }
@@ -183,6 +187,22 @@ Bool_t AliDielectronVarCuts::IsSelected(TObject* track)
   return isSelected;
 }
 
+//________________________________________________________________________
+const std::vector<UInt_t>& AliDielectronVarCuts::GetUpperCutVars(Int_t iCut)
+{
+  //
+  // variables of the axes of the THnBase upper cut iCut,
+  // resolved by axis name only the first time (also after reading the cuts from file)
+  //
+  if ((Int_t)fUpperCutVars.size()<=iCut) fUpperCutVars.resize(iCut+1);
+  std::vector<UInt_t> &vars = fUpperCutVars[iCut];
+  if (vars.empty()) {
+    for(Int_t idim=0; idim<fUpperCut[iCut]->GetNdimensions(); idim++)
+      vars.push_back(AliDielectronVarManager::GetValueType(fUpperCut[iCut]->GetAxis(idim)->GetName()));
+  }
+  return vars;
+}
+
 //________________________________________________________________________
 void AliDielectronVarCuts::AddCut(AliDielectronVarManager::ValueTypes type, Double_t min, Double_t max, Bool_t excludeRange)
 {
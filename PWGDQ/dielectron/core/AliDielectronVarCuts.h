@@ -21,6 +21,8 @@
 //#                                                           #
 //#############################################################
 
+#include <vector>
+
 #include <Rtypes.h>
 #include <TBits.h>
 
@@ -78,6 +80,7 @@ public:
   const char*  GetCutName(Int_t iCut) const;
   Bool_t       IsCutOnVariableX(Int_t iCut, Int_t varNumber) const;
   Int_t        GetCutLimits(Int_t iCut, Double_t &cutMin, Double_t &cutMax) const;
+  TBits*       GetUsedVars() const { return fUsedVars; }
 
 
  private:
@@ -100,10 +103,15 @@ public:
   THnBase  *fUpperCut[AliDielectronVarManager::kNMaxValues];        // use object as upper cut
   EVarCutsOperation fVarOperation[AliDielectronVarManager::kNMaxValues]; // operation between two vars, attention in principle kNMaxValues could be exceeded by the cut logic use with care
 
+  std::vector<std::vector<UInt_t> > fUpperCutVars;  //! variables of the axes of the upper cut objects, per cut
+  std::vector<Double_t> fUpperCutValues;             //! values of the axes of the upper cut object for the current track
+
+  const std::vector<UInt_t>& GetUpperCutVars(Int_t iCut);
+
   AliDielectronVarCuts(const AliDielectronVarCuts &c);
   AliDielectronVarCuts &operator=(const AliDielectronVarCuts &c);
 
-  ClassDef(AliDielectronVarCuts,6)         //Cut class providing cuts to all infomation available for the AliVParticle interface
+  ClassDef(AliDielectronVarCuts,7)         //Cut class providing cuts to all infomation available for the AliVParticle interface
 };
 
 
@@ -31,6 +31,7 @@ using namespace std;
 #include <TAxis.h>
 #include <TArrayD.h>
 #include <TClass.h>
+#include <TMath.h>
 
 #include "AliReducedVarManager.h"
 
@@ -49,7 +50,11 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlanValid(kFALSE),
+  fFillPlanLists(),
+  fFillPlan(),
+  fFillPlanVars()
 {
   //
   // Constructor
@@ -71,7 +76,11 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlanValid(kFALSE),
+  fFillPlanLists(),
+  fFillPlan(),
+  fFillPlanVars()
 {
   //
   // Constructor
@@ -127,6 +136,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
          << " because it already exists." << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   THashList* hList=new THashList;
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
@@ -154,6 +164,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -273,6 +284,8 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       hList->Add(h);
       break;
   }
+  // the variables filled in histograms are also computed by the variable manager
+  AliReducedVarManager::SetUseVars(fUsedVars);
 }
 
 //_________________________________________________________________
@@ -296,6 +309,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -417,6 +431,8 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       hList->Add(h);
       break;
   }
+  // the variables filled in histograms are also computed by the variable manager
+  AliReducedVarManager::SetUseVars(fUsedVars);
 }
 
 
@@ -441,6 +457,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -470,6 +487,8 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   if (useSparse)  hList->Add((THnSparseF*)h);
   else            hList->Add((THnF*)h);
   fBinsAllocated+=bins;
+  // the variables filled in histograms are also computed by the variable manager
+  AliReducedVarManager::SetUseVars(fUsedVars);
 }
 
 
@@ -494,6 +513,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -537,6 +557,8 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   if (useSparse)  hList->Add((THnSparseF*)h);
   else            hList->Add((THnF*)h);
   fBinsAllocated+=bins;
+  // the variables filled in histograms are also computed by the variable manager
+  AliReducedVarManager::SetUseVars(fUsedVars);
 }
 
 
@@ -620,150 +642,189 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+void AliHistogramManager::CompileFillPlan() {
   //
-  //  fill a class of histograms
+  //  Decode the histogram UniqueIDs once and build, for each histogram class, a flat list of
+  //  {histogram, type, variables, weight} used by FillHistClass().
+  //  The class handle is the position of the class in the main list.
+  //  Histograms which use a variable not flagged in fUsedVars are left out of the plan, since they are never filled.
   //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
-  }
-  if(!hList) {
-    return;
-  }
+  fFillPlanLists.clear();
+  fFillPlan.clear();
+  fFillPlanVars.clear();
+  
+  TIter nextClass(&fMainList);
+  THashList* hList=0x0;
+  while((hList=(THashList*)nextClass())) {
+    fFillPlanLists.push_back(hList);
+    fFillPlan.push_back(std::vector<FillPlanEntry>());
+    std::vector<FillPlanEntry>& plan = fFillPlan.back();
     
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
+      Int_t thnDim = (isTHn ? (uid%100)-10 : 0);        // the excess over 10 from the last 2 digits give the dimension of the THn
+      
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1;
+      Int_t varW = AliReducedVarManager::kNothing;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) continue;
+      
+      FillPlanEntry entry;
+      entry.fHist = h;
+      entry.fFirstVar = fFillPlanVars.size();
+      entry.fVarW = varW;
+      Int_t vars[kMaxFillDimensions];
+      Int_t nVars = 0;
+      if(!isTHn) {
+        TH1* h1 = (TH1*)h;
+        switch(h1->GetDimension()) {
           case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
+            entry.fType = (isProfile ? kFillProfile : kFillTH1);
+            nVars = (isProfile ? 2 : 1);
           break;
           case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
+            entry.fType = (isProfile ? kFillProfile2D : kFillTH2);
+            nVars = (isProfile ? 3 : 2);
           break;
           case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
+            entry.fType = (isProfile ? kFillProfile3D : kFillTH3);
+            nVars = (isProfile ? 4 : 3);
           break;
           default:
-          break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
+          continue;
         }
+        vars[0] = h1->GetXaxis()->GetUniqueID();
+        if(nVars>1) vars[1] = h1->GetYaxis()->GetUniqueID();
+        if(nVars>2) vars[2] = h1->GetZaxis()->GetUniqueID();
+        if(nVars>3) vars[3] = varT;
       }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
+      else {
+        Bool_t isSparse = ((TString)h->ClassName()).Contains("Sparse");
+        entry.fType = (isSparse ? kFillTHnSparse : kFillTHn);
+        nVars = TMath::Min(thnDim, Int_t(kMaxFillDimensions));
+        for(Int_t idim=0;idim<nVars;++idim) 
+          vars[idim] = ((THnBase*)h)->GetAxis(idim)->GetUniqueID();
+      }
+      
+      Bool_t allVarsGood = kTRUE;
+      for(Int_t iv=0;iv<nVars;++iv) 
+        if(vars[iv]<0 || vars[iv]>=AliReducedVarManager::kNVars || !fUsedVars[vars[iv]]) allVarsGood = kFALSE;
+      if(!allVarsGood) continue;
+      
+      entry.fNVars = nVars;
+      for(Int_t iv=0;iv<nVars;++iv) fFillPlanVars.push_back(vars[iv]);
+      plan.push_back(entry);
+    }
+  }
+  fFillPlanValid = kTRUE;
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassHandle(const Char_t* className) {
+  //
+  //  get the handle of a histogram class to be used with FillHistClass(Int_t, ...)
+  //  returns -1 if the class does not exist
+  //  The handle stays valid when histograms or classes are added later.
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  if(!fFillPlanValid) CompileFillPlan();
+  for(UInt_t i=0;i<fFillPlanLists.size();++i)
+    if(fFillPlanLists[i]==hList) return i;
+  return -1;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  FillHistClass(GetHistClassHandle(className), values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t handle, Float_t* values) {
+  //
+  //  fill a class of histograms, using the handle from GetHistClassHandle()
+  //
+  FillHistClass(handle, 1, &values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t handle, Int_t nEntries, Float_t** values) {
+  //
+  //  fill a class of histograms with nEntries value arrays
+  //  Each histogram is filled with all the entries before moving to the next one.
+  //
+  if(handle<0) return;
+  if(!fFillPlanValid) CompileFillPlan();
+  if(handle>=Int_t(fFillPlan.size())) return;
+  
+  const std::vector<FillPlanEntry>& plan = fFillPlan[handle];
+  Double_t fillValues[kMaxFillDimensions]={0.0};
+  for(UInt_t ih=0;ih<plan.size();++ih) {
+    const FillPlanEntry& entry = plan[ih];
+    const Int_t* vars = &fFillPlanVars[entry.fFirstVar];
+    const Bool_t weighted = (entry.fVarW>AliReducedVarManager::kNothing);
+    const Int_t varW = entry.fVarW;
+    
+    switch(entry.fType) {
+      case kFillTH1:
+        for(Int_t i=0;i<nEntries;++i) {
+          if(weighted) ((TH1F*)entry.fHist)->Fill(values[i][vars[0]],values[i][varW]);
+          else         ((TH1F*)entry.fHist)->Fill(values[i][vars[0]]);
         }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
+      break;
+      case kFillTH2:
+        for(Int_t i=0;i<nEntries;++i) {
+          if(weighted) ((TH2F*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][varW]);
+          else         ((TH2F*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]]);
         }
-      }
+      break;
+      case kFillTH3:
+        for(Int_t i=0;i<nEntries;++i) {
+          if(weighted) ((TH3F*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][vars[2]],values[i][varW]);
+          else         ((TH3F*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][vars[2]]);
+        }
+      break;
+      case kFillProfile:
+        for(Int_t i=0;i<nEntries;++i) {
+          if(weighted) ((TProfile*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][varW]);
+          else         ((TProfile*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]]);
+        }
+      break;
+      case kFillProfile2D:
+        for(Int_t i=0;i<nEntries;++i) {
+          if(weighted) ((TProfile2D*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][vars[2]],values[i][varW]);
+          else         ((TProfile2D*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][vars[2]]);
+        }
+      break;
+      case kFillProfile3D:
+        for(Int_t i=0;i<nEntries;++i) {
+          if(weighted) ((TProfile3D*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][vars[2]],values[i][vars[3]],values[i][varW]);
+          else         ((TProfile3D*)entry.fHist)->Fill(values[i][vars[0]],values[i][vars[1]],values[i][vars[2]],values[i][vars[3]]);
+        }
+      break;
+      case kFillTHn:
+      case kFillTHnSparse:
+        for(Int_t i=0;i<nEntries;++i) {
+          for(Int_t idim=0;idim<entry.fNVars;++idim) fillValues[idim] = values[i][vars[idim]];
+          if(weighted) ((THnBase*)entry.fHist)->Fill(fillValues,values[i][varW]);
+          else         ((THnBase*)entry.fHist)->Fill(fillValues);
+        }
+      break;
+      default:
+      break;
     }
   }
 }
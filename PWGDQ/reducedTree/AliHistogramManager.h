@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +71,10 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  Int_t GetHistClassHandle(const Char_t* className);             // handle for the fast fill methods below, -1 if not found
+  void FillHistClass(Int_t handle, Float_t* values);
+  void FillHistClass(Int_t handle, Int_t nEntries, Float_t** values);   // fill nEntries value arrays
+  void CompileFillPlan();                                        // done automatically at the first fill after booking
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,6 +112,25 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plan: decoded histogram types and variables, per histogram class
+  enum EFillType {
+    kFillTH1=0, kFillTH2, kFillTH3, kFillProfile, kFillProfile2D, kFillProfile3D, kFillTHn, kFillTHnSparse
+  };
+  enum {
+    kMaxFillDimensions=20
+  };
+  struct FillPlanEntry {
+    TObject* fHist;     // histogram
+    Int_t fType;        // EFillType
+    Int_t fNVars;       // number of variables (without the weight)
+    Int_t fFirstVar;    // index of the first variable in fFillPlanVars
+    Int_t fVarW;        // weight variable (kNothing if unweighted)
+  };
+  Bool_t fFillPlanValid;                              //! fill plan is up to date with the booked histograms
+  std::vector<THashList*> fFillPlanLists;             //! histogram class list for each handle
+  std::vector<std::vector<FillPlanEntry> > fFillPlan; //! fill plan for each handle
+  std::vector<Int_t> fFillPlanVars;                   //! variable indices of all the plan entries
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
   
   ClassDef(AliHistogramManager, 4)
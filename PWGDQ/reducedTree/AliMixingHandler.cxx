@@ -11,6 +11,7 @@
 #endif
 
 #include <iostream>
+#include <vector>
 using std::cout;
 using std::endl;
 using std::flush;
@@ -408,7 +409,12 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
+  // resolve the histogram classes once, the pairs are filled through their handles
   TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  std::vector<Int_t> histClassHandles(histClassArr->GetEntriesFast());
+  for(Int_t i=0; i<histClassArr->GetEntriesFast(); ++i)
+    histClassHandles[i] = fHistos->GetHistClassHandle(histClassArr->At(i)->GetName());
+  delete histClassArr;
   
   TIter iterEv1Leg1Pool(leg1Pool);
   TIter iterEv1Leg2Pool(leg2Pool);
@@ -448,11 +454,11 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!IsPairSelected(values, 1)) continue;   // fill histograms only if pair cuts are fulfilled
           for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) { 
-              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
+              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(histClassHandles[ibit*3+1], values);
               if(fMixingSetup==kMixCorrelation) {
                 Int_t pairType = (reinterpret_cast<AliReducedPairInfo*>(ev1Leg1))->PairType();
-                if (fMixLikeSign) fHistos->FillHistClass(histClassArr->At(ibit*3+pairType)->GetName(), values);
-                else              fHistos->FillHistClass(histClassArr->At(ibit)->GetName(), values);
+                if (fMixLikeSign) fHistos->FillHistClass(histClassHandles[ibit*3+pairType], values);
+                else              fHistos->FillHistClass(histClassHandles[ibit], values);
               }
             }
           }  
@@ -473,7 +479,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!IsPairSelected(values, 0)) continue;   // fill histograms only if pair cuts are fulfilled
 	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
+              fHistos->FillHistClass(histClassHandles[ibit*3+0], values);
           }  
 	}  // end loop over the ev2-leg1 list
       }  // end loop over the ev1-leg1 list
@@ -501,7 +507,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!IsPairSelected(values, 2)) continue;   // fill histograms only if pair cuts are fulfilled
 	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
+              fHistos->FillHistClass(histClassHandles[ibit*3+2], values);
           }  
 	}  // end loop over the ev2-leg2 list
       }  // end loop over the ev1-leg2 list
@@ -15,6 +15,7 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
+    fTreeCacheSize(0),
     fReducedEvent(0)
 {
   // Default constructor
@@ -24,6 +25,7 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
+  fTreeCacheSize(0),
   fReducedEvent(0)
  {
     // Constructor
@@ -46,6 +48,9 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
     SwitchOffBranches();
     SwitchOnBranches();
     
+    // read the baskets of the used branches in blocks instead of one request per basket
+    if (fTreeCacheSize>0) fTree->SetCacheSize(fTreeCacheSize);
+    
     // Get pointer to the event
     if (!fReducedEvent) {
        switch(fEventInputOption) {
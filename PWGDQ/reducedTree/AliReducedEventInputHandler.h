@@ -33,16 +33,21 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
              
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
+                 // size of the TTreeCache of the input tree (0: not set here); the branches read in the first events are
+                 // prefetched in blocks, branches switched off with SetInactiveBranches() (e.g. "fCandidates*") are not read at all
+                 void                                SetTreeCacheSize(Long64_t size) {fTreeCacheSize = size;}
+                 Long64_t                            GetTreeCacheSize() const {return fTreeCacheSize;}
                  
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
     AliReducedEventInputHandler& operator=(const AliReducedEventInputHandler& handler);      
     
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
+    Long64_t fTreeCacheSize;                           // size of the TTreeCache of the input tree, if larger than 0
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 3);
 };
 
 #endif
@@ -143,6 +143,7 @@ TString AliReducedVarManager::fgVariableUnits[AliReducedVarManager::kNVars] = {"
 AliReducedBaseEvent* AliReducedVarManager::fgEvent = 0x0;
 AliReducedEventPlaneInfo* AliReducedVarManager::fgEventPlane = 0x0;
 Bool_t AliReducedVarManager::fgUsedVars[AliReducedVarManager::kNVars] = {kFALSE};
+Bool_t AliReducedVarManager::fgUsedBlocks[AliReducedVarManager::kNVariableBlocks] = {kFALSE};
 TH2F* AliReducedVarManager::fgTPCelectronCentroidMap = 0x0;
 TH2F* AliReducedVarManager::fgTPCelectronWidthMap = 0x0;
 AliReducedVarManager::Variables AliReducedVarManager::fgVarDependencyX = kNothing;
@@ -353,6 +354,28 @@ void AliReducedVarManager::SetVariableDependencies() {
     fgUsedVars[kNTPCclusters] = kTRUE;
     fgUsedVars[kNTPCclustersFromPileup] = kTRUE;
   }
+  
+  SetBlockUsage();
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetBlockUsage() {
+  //
+  // Flag the groups of variables which have at least one used variable
+  //
+  fgUsedBlocks[kTrackingStatusBlock] = IsAnyVarUsed(kTrackingStatus, kNTrackingStatus);
+  fgUsedBlocks[kTPCdEdxInfoBlock]    = IsAnyVarUsed(kTPCdEdxQmax, kTPCnSig-kTPCdEdxQmax);
+  fgUsedBlocks[kTRDGTUBlock]         = IsAnyVarUsed(kTRDGTUtracklets, kTRDGTUPID-kTRDGTUtracklets+1);
+}
+
+//__________________________________________________________________
+Bool_t AliReducedVarManager::IsAnyVarUsed(Int_t firstVar, Int_t nVars) {
+  //
+  // check whether any of the variables firstVar ... firstVar+nVars-1 is used
+  //
+  for(Int_t i=firstVar; i<firstVar+nVars; ++i)
+    if(fgUsedVars[i]) return kTRUE;
+  return kFALSE;
 }
 
 //__________________________________________________________________
@@ -1673,10 +1696,12 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   values[kTPCcrossedRows] = pinfo->TPCCrossedRows();
   values[kTPCsignal]      = pinfo->TPCsignal();
   values[kTPCsignalN]     = pinfo->TPCsignalN();
-  for(Int_t i=0; i<4; ++i) {
-     values[kTPCdEdxQmax+i] = pinfo->TPCdEdxInfoQmax(i);
-     values[kTPCdEdxQtot+i] = pinfo->TPCdEdxInfoQtot(i);
-     values[kTPCdEdxQmaxOverQtot+i] = ( values[kTPCdEdxQtot+i]>1.0e-7 ? values[kTPCdEdxQmax+i] / values[kTPCdEdxQtot+i] : -999. );
+  if(fgUsedBlocks[kTPCdEdxInfoBlock]) {
+    for(Int_t i=0; i<4; ++i) {
+       values[kTPCdEdxQmax+i] = pinfo->TPCdEdxInfoQmax(i);
+       values[kTPCdEdxQtot+i] = pinfo->TPCdEdxInfoQtot(i);
+       values[kTPCdEdxQmaxOverQtot+i] = ( values[kTPCdEdxQtot+i]>1.0e-7 ? values[kTPCdEdxQmax+i] / values[kTPCdEdxQtot+i] : -999. );
+    }
   }
   values[kTPCchi2] = pinfo->TPCchi2();
   if(fgUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
@@ -1724,11 +1749,13 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   values[kTRDntrackletsPID] = pinfo->TRDntracklets(1);
 
   // TRD GTU online tracks
-  values[kTRDGTUtracklets]   = pinfo->TRDGTUtracklets();
-  values[kTRDGTUlayermask]   = pinfo->TRDGTUlayermask();
-  values[kTRDGTUpt]          = pinfo->TRDGTUpt();
-  values[kTRDGTUsagitta]     = pinfo->TRDGTUsagitta();
-  values[kTRDGTUPID]         = pinfo->TRDGTUPID();
+  if(fgUsedBlocks[kTRDGTUBlock]) {
+    values[kTRDGTUtracklets]   = pinfo->TRDGTUtracklets();
+    values[kTRDGTUlayermask]   = pinfo->TRDGTUlayermask();
+    values[kTRDGTUpt]          = pinfo->TRDGTUpt();
+    values[kTRDGTUsagitta]     = pinfo->TRDGTUsagitta();
+    values[kTRDGTUPID]         = pinfo->TRDGTUPID();
+  }
 
 
   if(fgUsedVars[kEMCALmatchedEnergy] || fgUsedVars[kEMCALmatchedEOverP] || fgUsedVars[kEMCALmatchedM02] || fgUsedVars[kEMCALmatchedM20]) {
@@ -1745,7 +1772,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
     }
   }  
 
-  FillTrackingStatus(pinfo,values);
+  if(fgUsedBlocks[kTrackingStatusBlock]) FillTrackingStatus(pinfo,values);
   //FillTrackingFlags(pinfo,values);
 
   if(fgUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
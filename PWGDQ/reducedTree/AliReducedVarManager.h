@@ -676,7 +676,7 @@ class AliReducedVarManager : public TObject {
   static void SetEvent(AliReducedBaseEvent* const ev) {fgEvent = ev;};
   static void SetEventPlane(AliReducedEventPlaneInfo* const ev) {fgEventPlane = ev;};
   static void SetUseVariable(Variables var) {fgUsedVars[var] = kTRUE; SetVariableDependencies();}
-  static void SetUseVars(Bool_t* usedVars) {
+  static void SetUseVars(const Bool_t* usedVars) {
     for(Int_t i=0;i<kNVars;++i) {
       if(usedVars[i]) fgUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
     }
@@ -751,6 +751,17 @@ class AliReducedVarManager : public TObject {
                                                  //   when a variable is used
   static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
   
+  // groups of variables filled together, skipped in the Fill functions when none of their variables is used
+  enum VariableBlocks {
+    kTrackingStatusBlock=0,     // kTrackingStatus ... kTrackingStatus+kNTrackingStatus-1
+    kTPCdEdxInfoBlock,          // kTPCdEdxQmax, kTPCdEdxQtot, kTPCdEdxQmaxOverQtot
+    kTRDGTUBlock,               // kTRDGTUtracklets ... kTRDGTUPID
+    kNVariableBlocks
+  };
+  static Bool_t fgUsedBlocks[kNVariableBlocks];  // toggled when at least one variable of the block is used
+  static void SetBlockUsage();                 // update fgUsedBlocks from fgUsedVars
+  static Bool_t IsAnyVarUsed(Int_t firstVar, Int_t nVars);
+  
 
   static Double_t DeltaPhi(Double_t phi1, Double_t phi2);  
   static void GetThetaPhiCM(AliReducedBaseTrack* leg1, AliReducedBaseTrack* leg2,
@@ -91,7 +91,9 @@ AliResonanceFits::AliResonanceFits() :
   fFitValues(),
   fMatchingIsDone(kFALSE),
   fMinuitFitter(0x0),
-  fResidualFitFunc(0x0)
+  fResidualFitFunc(0x0),
+  fUseProjectionCache(kFALSE),
+  fProjectionCache()
 {
   //
   // Default constructor
@@ -119,6 +121,7 @@ AliResonanceFits::~AliResonanceFits()
   if(fSEOS_MCtruth) delete fSEOS_MCtruth;
   if(fMinuitFitter) delete fMinuitFitter;
   if(fResidualFitFunc) delete fResidualFitFunc;
+  ClearProjectionCache();
 }
 
 //_______________________________________________________________________________
@@ -133,6 +136,18 @@ void AliResonanceFits::SetHistograms(THnF* seos, THnF* meos /*=0x0*/,
   fSELSleg1 = selsLeg1; fSELSleg2 = selsLeg2;
   fMELSleg1 = melsLeg1; fMELSleg2 = melsLeg2;
   fMatchingIsDone = kFALSE;
+  ClearProjectionCache();
+}
+
+//_______________________________________________________________________________
+void AliResonanceFits::ClearProjectionCache()
+{
+  //
+  // Delete the cached slice projections
+  //
+  for(std::map<std::string, TH1*>::iterator it=fProjectionCache.begin(); it!=fProjectionCache.end(); ++it)
+     delete it->second;
+  fProjectionCache.clear();
 }
 
 //_______________________________________________________________________________
@@ -469,7 +484,7 @@ void AliResonanceFits::AddSlice() {
    // NOTE: Remember, last variable in array is mass (fNVariables-1), and next to last, if its the case, is pt (fNVariables-2) 
    if(fgOptionUse2DMatching || fUserEnabledPtFitRange) {
       // SE-OS slices
-      projSEOS = (TH2D*)fSEOS->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
+      projSEOS = ProjectSlice(fSEOS, fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
       projSEOS->SetName(Form("projSEOS_%.6f", gRandom->Rndm()));
       if(!fgOptionUse2DMatching) 
          projSEOS_ptRange = ((TH2D*)projSEOS)->ProjectionX(Form("projSEOS_ptRange_%.6f", gRandom->Rndm()), 
@@ -477,7 +492,7 @@ void AliResonanceFits::AddSlice() {
                                                                                 projSEOS->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       // ME-OS slices
       if(fMEOS) {
-         projMEOS = (TH2D*)fMEOS->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
+         projMEOS = ProjectSlice(fMEOS, fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
          projMEOS->SetName(Form("projMEOS_%.6f", gRandom->Rndm()));
          if(!fgOptionUse2DMatching)
             projMEOS_ptRange = ((TH2D*)projMEOS)->ProjectionX(Form("projMEOS_ptRange_%.6f", gRandom->Rndm()), 
@@ -487,7 +502,7 @@ void AliResonanceFits::AddSlice() {
       
       // SE-LS slices
       if(fSELSleg1) {
-         projSELSleg1 = (TH2D*)fSELSleg1->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
+         projSELSleg1 = ProjectSlice(fSELSleg1, fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
          projSELSleg1->SetName(Form("projSELSleg1_%.6f", gRandom->Rndm()));
          
          if(!fgOptionUse2DMatching)
@@ -496,7 +511,7 @@ void AliResonanceFits::AddSlice() {
                                                                                                 projSELSleg1->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       }
       if(fSELSleg2) {
-         projSELSleg2 = (TH2D*)fSELSleg2->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
+         projSELSleg2 = ProjectSlice(fSELSleg2, fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
          projSELSleg2->SetName(Form("projSELSleg2_%.6f", gRandom->Rndm()));
          if(!fgOptionUse2DMatching)
             projSELSleg2_ptRange = ((TH2D*)projSELSleg2)->ProjectionX(Form("projSELSleg2_ptRange_%.6f", gRandom->Rndm()), 
@@ -506,7 +521,7 @@ void AliResonanceFits::AddSlice() {
       
       // ME-LS slices
       if(fMELSleg1) {
-         projMELSleg1 = (TH2D*)fMELSleg1->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
+         projMELSleg1 = ProjectSlice(fMELSleg1, fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
          projMELSleg1->SetName(Form("projMELSleg1_%.6f", gRandom->Rndm()));
          if(!fgOptionUse2DMatching) {
             projMELSleg1_ptRange = ((TH2D*)projMELSleg1)->ProjectionX(Form("projMELSleg1_ptRange_%.6f", gRandom->Rndm()), 
@@ -515,7 +530,7 @@ void AliResonanceFits::AddSlice() {
          }
       }
       if(fMELSleg2) {
-         projMELSleg2 = (TH2D*)fMELSleg2->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
+         projMELSleg2 = ProjectSlice(fMELSleg2, fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
          projMELSleg2->SetName(Form("projMELSleg2_%.6f", gRandom->Rndm()));
          if(!fgOptionUse2DMatching)
             projMELSleg2_ptRange = ((TH2D*)projMELSleg2)->ProjectionX(Form("projMELSleg2_ptRange_%.6f", gRandom->Rndm()), 
@@ -524,27 +539,27 @@ void AliResonanceFits::AddSlice() {
       }
    }        // end if fgOptionUse2DMatching || fUserEnabledPtFitRange
    else {        // use just 1D matching
-      projSEOS = (TH1D*)fSEOS->Projection(fVarIndices[fNVariables-1]);
+      projSEOS = ProjectSlice(fSEOS, fVarIndices[fNVariables-1]);
       projSEOS->SetName(Form("projSEOS_%.6f", gRandom->Rndm()));
       
       if(fMEOS) {
-         projMEOS = (TH1D*)fMEOS->Projection(fVarIndices[fNVariables-1]);
+         projMEOS = ProjectSlice(fMEOS, fVarIndices[fNVariables-1]);
          projMEOS->SetName(Form("projMEOS_%.6f", gRandom->Rndm()));
       }
       if(fSELSleg1) {
-         projSELSleg1 = (TH1D*)fSELSleg1->Projection(fVarIndices[fNVariables-1]);
+         projSELSleg1 = ProjectSlice(fSELSleg1, fVarIndices[fNVariables-1]);
          projSELSleg1->SetName(Form("projSELSleg1_%.6f", gRandom->Rndm()));
       }
       if(fSELSleg2) {
-         projSELSleg2 = (TH1D*)fSELSleg2->Projection(fVarIndices[fNVariables-1]);
+         projSELSleg2 = ProjectSlice(fSELSleg2, fVarIndices[fNVariables-1]);
          projSELSleg2->SetName(Form("projSELSleg2_%.6f", gRandom->Rndm()));
       }
       if(fMELSleg1) {
-         projMELSleg1 = (TH1D*)fMELSleg1->Projection(fVarIndices[fNVariables-1]);
+         projMELSleg1 = ProjectSlice(fMELSleg1, fVarIndices[fNVariables-1]);
          projMELSleg1->SetName(Form("projMELSleg1_%.6f", gRandom->Rndm()));
       }
       if(fMELSleg2) {
-         projMELSleg2 = (TH1D*)fMELSleg2->Projection(fVarIndices[fNVariables-1]);
+         projMELSleg2 = ProjectSlice(fMELSleg2, fVarIndices[fNVariables-1]);
          projMELSleg2->SetName(Form("projMELSleg2_%.6f", gRandom->Rndm()));
       }
    }          // end else
@@ -649,6 +664,36 @@ void AliResonanceFits::AddSlice() {
    if(projMELSleg2_ptRange) delete projMELSleg2_ptRange;
 }
 
+//_____________________________________________________________________________________________
+TH1* AliResonanceFits::ProjectSlice(THnF* h, Int_t dim1, Int_t dim2 /*=-1*/) {
+   //
+   // Projection of h on dim1 (and dim2, for dim2>=0) in the current ranges of its axes, as THnBase::Projection()
+   // If the projection cache is used, the projection is taken only the first time for a given set of ranges,
+   //   a copy of the cached projection is returned afterwards
+   // The caller owns the returned histogram
+   //
+   if(!fUseProjectionCache) {
+      if(dim2<0) return h->Projection(dim1);
+      return h->Projection(dim1, dim2);
+   }
+   
+   TString key = Form("%p:%d:%d", (void*)h, dim1, dim2);
+   for(Int_t iAxis=0; iAxis<h->GetNdimensions(); ++iAxis) {
+      TAxis* axis = h->GetAxis(iAxis);
+      key += Form(":%d,%d,%d", axis->GetFirst(), axis->GetLast(), (axis->TestBit(TAxis::kAxisRange) ? 1 : 0));
+   }
+   
+   std::map<std::string, TH1*>::iterator found = fProjectionCache.find(key.Data());
+   if(found==fProjectionCache.end()) {
+      TH1* proj = (dim2<0 ? (TH1*)h->Projection(dim1) : (TH1*)h->Projection(dim1, dim2));
+      TH1* cached = (TH1*)proj->Clone(Form("%s_cached", proj->GetName()));
+      cached->SetDirectory(0x0);
+      fProjectionCache[key.Data()] = cached;
+      return proj;
+   }
+   return (TH1*)found->second->Clone(found->second->GetName());
+}
+
 //_____________________________________________________________________________________________
 TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0*/, TH1* melsLeg1 /*=0x0*/, TH1* melsLeg2 /*=0x0*/) {
    //
@@ -83,6 +83,9 @@
 #ifndef ALIRESONANCEFITS_H
 #define ALIRESONANCEFITS_H
 
+#include <map>
+#include <string>
+
 #include <TObject.h>
 #include <THn.h>
 #include <TF1.h>
@@ -146,10 +149,14 @@ class AliResonanceFits : public TObject {
   // User input
   void SetHistograms(THnF* seos, THnF* meos = 0x0, 
 		     THnF* selsLeg1=0x0, THnF* selsLeg2=0x0, THnF* melsLeg1=0x0, THnF* melsLeg2=0x0);
-  void SetSEOSHistogram(THnF* hist) {fSEOS = hist; fMatchingIsDone = kFALSE;};
-  void SetSELSHistograms(THnF* hLeg1, THnF* hLeg2) {fSELSleg1 = hLeg1; fSELSleg2 = hLeg2; fMatchingIsDone = kFALSE;};
-  void SetMEOSHistogram(THnF* hist) {fMEOS = hist; fMatchingIsDone = kFALSE;};
-  void SetMELSHistograms(THnF* hLeg1, THnF* hLeg2) {fMELSleg1 = hLeg1; fMELSleg2 = hLeg2; fMatchingIsDone = kFALSE;}
+  void SetSEOSHistogram(THnF* hist) {fSEOS = hist; fMatchingIsDone = kFALSE; ClearProjectionCache();};
+  void SetSELSHistograms(THnF* hLeg1, THnF* hLeg2) {fSELSleg1 = hLeg1; fSELSleg2 = hLeg2; fMatchingIsDone = kFALSE; ClearProjectionCache();};
+  void SetMEOSHistogram(THnF* hist) {fMEOS = hist; fMatchingIsDone = kFALSE; ClearProjectionCache();};
+  void SetMELSHistograms(THnF* hLeg1, THnF* hLeg2) {fMELSleg1 = hLeg1; fMELSleg2 = hLeg2; fMatchingIsDone = kFALSE; ClearProjectionCache();}
+  // keep the slice projections of the THnF's between calls of Process(), useful when the signal extraction is repeated
+  // for several matching / fit options with the same variable ranges (the cache is cleared when the histograms are changed)
+  void SetUseProjectionCache(Bool_t use=kTRUE) {fUseProjectionCache = use; if(!use) ClearProjectionCache();}
+  void ClearProjectionCache();
   void SetSEOSMCHistogram(THnF* hist) {fSEOS_MCtruth = hist;}
   void SetSignalMCshape(TH1* shape) {fSignalMCshape = shape;}
   
@@ -312,6 +319,9 @@ class AliResonanceFits : public TObject {
    ///////////////////////////////////////////////////
    TF1*      fResidualFitFunc;            // fit function used to fit the combinatorial bkg subtracted minv distribution
    
+   Bool_t    fUseProjectionCache;         // if true, keep the slice projections in fProjectionCache (default is false)
+   std::map<std::string, TH1*> fProjectionCache;   //! slice projections, by histogram, projected axes and ranges of all axes
+   
    ////////////////////////////////////////////////////
    
    // Private utility functions
@@ -319,6 +329,7 @@ class AliResonanceFits : public TObject {
    void Slice();
    void ApplyUserRanges(THnF* h);
    void AddSlice();
+   TH1* ProjectSlice(THnF* h, Int_t dim1, Int_t dim2=-1);
    TH1* BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos=0x0, TH1* melsLeg1=0x0, TH1* melsLeg2=0x0);
    void SqrtTH1(TH1* h, Bool_t is2D=kFALSE);
    void  ComputeEntryScale(TH1* signal, TH1* bkg);
@@ -331,7 +342,7 @@ class AliResonanceFits : public TObject {
    void FitResidualBkg();
    static Double_t GlobalFitFunction(Double_t *x, Double_t* par);
 
-   ClassDef(AliResonanceFits, 5);
+   ClassDef(AliResonanceFits, 6);
 };
 
 #endif
@@ -72,6 +72,10 @@ fNAssocPtBins(0),               fAssocPtBinLimit(),
 fNTrigPtBins(0),                fTrigPtBinLimit(),
 fCorrelVzBin(0),
 fListMixTrackEvents(),          fListMixCaloEvents(),
+fMixTrackPt(),                  fMixTrackEta(),        fMixTrackPhi(),
+fMixTrackAssocBin(),            fMixTrackOffset(),
+fMixCachePool(0),               fMixCacheFirst(0),
+fMixCachePoolSize(0),           fMixCacheEvent(-1),
 fUseMixStoredInReader(0),       fFillNeutralEventMixPool(0),
 fM02MaxCut(0),                  fM02MinCut(0),
 fSelectLeadingHadronAngle(0),   fFillLeadHadOppositeHisto(0),
@@ -1266,6 +1270,7 @@ void AliAnaParticleHadronCorrelation::FillChargedEventMixPool()
   fhEventMBBin->Fill(eventBin, GetEventWeight());
   
   TObjArray * mixEventTracks = new TObjArray;
+  mixEventTracks->SetOwner(kTRUE); // tracks deleted with the event when it leaves the pool
   
   if ( fUseMixStoredInReader )
   {
@@ -1347,6 +1352,7 @@ void AliAnaParticleHadronCorrelation::FillNeutralEventMixPool()
   if ( eventBin < 0 ) return;
   
   TObjArray * mixEventCalo = new TObjArray;
+  mixEventCalo->SetOwner(kTRUE); // clusters deleted with the event when it leaves the pool
   
   if ( fUseMixStoredInReader )
   {
@@ -4774,6 +4780,54 @@ void  AliAnaParticleHadronCorrelation::MakeChargedCorrelation(AliCaloTrackPartic
   }
 }
 
+//_________________________________________________________________________________________________________
+/// Store the pT, eta, phi and associated pT bin of the tracks of all the events in the pool,
+/// so that they are calculated once per event and not for each trigger.
+//_________________________________________________________________________________________________________
+void AliAnaParticleHadronCorrelation::CacheMixedTracksKinematics(TList * pool)
+{
+  fMixTrackPt      .clear();
+  fMixTrackEta     .clear();
+  fMixTrackPhi     .clear();
+  fMixTrackAssocBin.clear();
+  fMixTrackOffset  .assign(1,0);
+  
+  TIter next(pool);
+  while ( TObjArray * bgTracks = static_cast<TObjArray*>(next()) )
+  {
+    Int_t nTracks = bgTracks->GetEntriesFast();
+    for(Int_t j1 = 0;j1 <nTracks; j1++ )
+    {
+      AliCaloTrackParticle *track = (AliCaloTrackParticle*) bgTracks->At(j1) ;
+      
+      if ( !track ) continue;
+      
+      Double_t ptAssoc  = track->Pt();
+      Double_t phiAssoc = track->Phi() ;
+      if ( phiAssoc < 0 ) phiAssoc+=TMath::TwoPi();
+      
+      // Set the pt associated bin for the defined bins
+      Int_t assocBin   = -1;
+      for(Int_t i = 0 ; i < fNAssocPtBins ; i++)
+      {
+        if ( ptAssoc > fAssocPtBinLimit[i] && ptAssoc < fAssocPtBinLimit[i+1] ) assocBin= i;
+      }
+      
+      fMixTrackPt      .push_back(ptAssoc);
+      fMixTrackEta     .push_back(track->Eta());
+      fMixTrackPhi     .push_back(phiAssoc);
+      fMixTrackAssocBin.push_back(assocBin);
+    }
+    
+    fMixTrackOffset.push_back(fMixTrackPt.size());
+  }
+  
+  fMixCachePool     = pool;
+  fMixCacheFirst    = pool->First();
+  fMixCachePoolSize = pool->GetSize();
+  fMixCacheEvent    = GetEventNumber();
+}
+
 //_________________________________________________________________________________________________________
 /// Mix current trigger with tracks in another Minimum Bias event.
 //_________________________________________________________________________________________________________
@@ -4824,6 +4878,11 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
   if ( neutralMix && !poolCalo )
     AliWarning("Careful, cluster pool not available");
   
+  // Pooled tracks kinematics, same for all the triggers of the event
+  if ( pool != fMixCachePool || pool->First() != fMixCacheFirst ||
+       pool->GetSize() != fMixCachePoolSize || GetEventNumber() != fMixCacheEvent )
+    CacheMixedTracksKinematics(pool);
+  
   Double_t ptTrig  = aodParticle->Pt();
   Double_t etaTrig = aodParticle->Eta();
   Double_t phiTrig = aodParticle->Phi();
@@ -4886,18 +4945,16 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
     //
     // Check if the trigger is leading of mixed event
     //
-    Int_t nTracks=bgTracks->GetEntriesFast();
+    const Int_t firstTrack = fMixTrackOffset[ev];
+    const Int_t lastTrack  = fMixTrackOffset[ev+1];
     
     if ( fMakeNearSideLeading || fMakeAbsoluteLeading )
     {
       Bool_t leading = kTRUE;
-      for(Int_t jlead = 0;jlead < nTracks; jlead++ )
+      for(Int_t jlead = firstTrack;jlead < lastTrack; jlead++ )
       {
-        AliCaloTrackParticle *track = (AliCaloTrackParticle*) bgTracks->At(jlead) ;
-        
-        ptAssoc  = track->Pt();
-        phiAssoc = track->Phi() ;
-        if ( phiAssoc < 0 ) phiAssoc+=TMath::TwoPi();
+        ptAssoc  = fMixTrackPt [jlead];
+        phiAssoc = fMixTrackPhi[jlead];
         
         if ( fMakeNearSideLeading )
         {
@@ -4981,16 +5038,11 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
     //
     // Correlation histograms
     //
-    for(Int_t j1 = 0;j1 <nTracks; j1++ )
+    for(Int_t j1 = firstTrack;j1 <lastTrack; j1++ )
     {
-      AliCaloTrackParticle *track = (AliCaloTrackParticle*) bgTracks->At(j1) ;
-      
-      if ( !track ) continue;
-      
-      ptAssoc  = track->Pt();
-      etaAssoc = track->Eta();
-      phiAssoc = track->Phi() ;
-      if ( phiAssoc < 0 ) phiAssoc+=TMath::TwoPi();
+      ptAssoc  = fMixTrackPt [j1];
+      etaAssoc = fMixTrackEta[j1];
+      phiAssoc = fMixTrackPhi[j1];
       
       deltaPhi = phiTrig-phiAssoc;
       if ( deltaPhi <  -TMath::PiOver2() ) deltaPhi+=TMath::TwoPi();
@@ -5037,12 +5089,8 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
         fhMixXEUeCharged->Fill(ptTrig, uexE, GetEventWeight());
       }
       
-      // Set the pt associated bin for the defined bins
-      Int_t assocBin   = -1;
-      for(Int_t i = 0 ; i < fNAssocPtBins ; i++)
-      {
-        if ( ptAssoc > fAssocPtBinLimit[i] && ptAssoc < fAssocPtBinLimit[i+1] ) assocBin= i;
-      }
+      // Associated pt bin, from the cache
+      Int_t assocBin   = fMixTrackAssocBin[j1];
       
       //
       // Assign to the histogram array a bin corresponding to a combination of pTa and vz bins
@@ -21,6 +21,8 @@
 /// \author Xiangrong Zhu <Xiangrong.Zhu@cern.ch>, CCNU, mixing implementation.
 //_________________________________________________________________________
 
+#include <vector>
+
 #include "AliAnaCaloTrackCorrBaseClass.h"
 class AliCaloTrackParticleCorrelation ;
 
@@ -62,6 +64,8 @@ public:
   
   void         MakeChargedMixCorrelation(AliCaloTrackParticleCorrelation * particle) ;
   
+  void         CacheMixedTracksKinematics(TList * pool) ;
+  
   // Filling histogram methods
   
   void         FillChargedAngularCorrelationHistograms  (Float_t ptAssoc,  Float_t ptTrig,      Int_t   assocBin,
@@ -316,6 +320,17 @@ private:
   /// Containers for calo clusters in stored events for mixing.
   TList **     fListMixCaloEvents ;                      //![GetNCentrBin()*GetNZvertBin()*GetNRPBin()]
   
+  /// Kinematics of the tracks of the mixing pool used in the current event, shared by all triggers.
+  std::vector<Double_t> fMixTrackPt;                     //!<! pT of the pooled tracks.
+  std::vector<Double_t> fMixTrackEta;                    //!<! Pseudorapidity of the pooled tracks.
+  std::vector<Double_t> fMixTrackPhi;                    //!<! Azimuth of the pooled tracks, in [0,2pi].
+  std::vector<Int_t>    fMixTrackAssocBin;               //!<! Associated pT bin of the pooled tracks.
+  std::vector<Int_t>    fMixTrackOffset;                 //!<! Index of the first cached track of each pooled event.
+  TList *      fMixCachePool;                            //!<! Pool the cache was filled from.
+  TObject *    fMixCacheFirst;                           //!<! First event of the pool when the cache was filled.
+  Int_t        fMixCachePoolSize;                        //!<! Size of the pool when the cache was filled.
+  Int_t        fMixCacheEvent;                           //!<! Event number when the cache was filled.
+  
   Bool_t       fUseMixStoredInReader;                    ///<  Signal if in the current event the pool was filled.
   
   Bool_t       fFillNeutralEventMixPool;                 ///<  Add clusters to pool if requested.
@@ -689,7 +704,7 @@ private:
   AliAnaParticleHadronCorrelation & operator = (const AliAnaParticleHadronCorrelation & ph) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaParticleHadronCorrelation,37) ;
+  ClassDef(AliAnaParticleHadronCorrelation,38) ;
   /// \endcond
   
 } ;
@@ -23,6 +23,7 @@
 #include "TClonesArray.h"
 #include "TObjString.h"
 #include "TDatabasePDG.h"
+#include <vector>
 
 //---- AliRoot system ----
 #include "AliAnaPi0.h"
@@ -4605,6 +4606,20 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
       return;
     }
     
+    // The pT selection and the (super) module of the photons, obtained from the
+    // geometry, do not change from one mixed pair to the other, get them once
+    // for the current event and once per mixed event
+    std::vector<Int_t> modules1(nPhot,-1) ;
+    for(Int_t i1 = 0; i1 < nPhot; i1++)
+    {
+      AliCaloTrackParticle * p1 = (AliCaloTrackParticle*) (GetInputAODBranch()->At(i1)) ;
+      if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
+      modules1[i1] = GetModuleNumber(p1);
+    }
+    
+    std::vector<Bool_t> inPtRange2 ;
+    std::vector<Int_t>  modules2   ;
+    
     Int_t nMixed = evMixList->GetSize() ;
     for(Int_t ii=0; ii<nMixed; ii++)
     {
@@ -4615,6 +4630,16 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
       
       fhEventMixBin->Fill(eventbin, GetEventWeight()) ;
       
+      inPtRange2.assign(nPhot2,kFALSE) ;
+      modules2  .assign(nPhot2,-1) ;
+      for(Int_t i2 = 0; i2 < nPhot2; i2++)
+      {
+        AliCaloTrackParticle * p2 = (AliCaloTrackParticle*) (ev2->At(i2)) ;
+        if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+        inPtRange2[i2] = kTRUE ;
+        modules2  [i2] = GetModuleNumber(p2);
+      }
+      
       //---------------------------------
       // First loop on photons/clusters
       //---------------------------------
@@ -4630,29 +4655,30 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
         
         //Get kinematics of cluster and (super) module of this cluster
         fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
-        module1 = GetModuleNumber(p1);
+        module1 = modules1[i1];
         
         //---------------------------------
         // Second loop on other mixed event photons/clusters
         //---------------------------------
         for(Int_t i2 = 0; i2 < nPhot2; i2++)
         {
-          AliCaloTrackParticle * p2 = (AliCaloTrackParticle*) (ev2->At(i2)) ;
-          
           // Select photons within a pT range
-          if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+          if ( !inPtRange2[i2] ) continue ;
+          
+          AliCaloTrackParticle * p2 = (AliCaloTrackParticle*) (ev2->At(i2)) ;
           
           // Get kinematics of second cluster and calculate those of the pair
           fPhotonMom2.SetPxPyPzE(p2->Px(),p2->Py(),p2->Pz(),p2->E());
-          m           = (fPhotonMom1+fPhotonMom2).M() ;
-          Double_t pt = (fPhotonMom1 + fPhotonMom2).Pt();
+          TLorentzVector pairMom = fPhotonMom1 + fPhotonMom2;
+          m           = pairMom.M() ;
+          Double_t pt = pairMom.Pt();
           Double_t a  = TMath::Abs(p1->E()-p2->E())/(p1->E()+p2->E()) ;
           
           // Check if opening angle is too large or too small compared to what is expected
           Double_t angle   = fPhotonMom1.Angle(fPhotonMom2.Vect());
-          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow((fPhotonMom1+fPhotonMom2).E(),angle+0.05))
+          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow(pairMom.E(),angle+0.05))
           {
-            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), (fPhotonMom1+fPhotonMom2).E()));
+            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), pairMom.E()));
             continue;
           }
           
@@ -4675,7 +4701,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), p2->Pt(), pt,m,a));
           
           // In case we want only pairs in same (super) module, check their origin.
-          module2 = GetModuleNumber(p2);
+          module2 = modules2[i2];
                     
           //-------------------------------------------------------------------------------------------------
           // Fill module dependent histograms, put a cut on assymmetry on the first available cut in the array
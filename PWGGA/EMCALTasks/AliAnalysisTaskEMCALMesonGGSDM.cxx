@@ -58,6 +58,7 @@
 
 // EMCAL includes
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliEMCALGeometry.h"
 #include "AliTrackerBase.h"
 #include "AliEMCALCalibTimeDepCorrection.h" // Run dependent
@@ -1472,7 +1473,7 @@ void AliAnalysisTaskEMCALMesonGGSDM::UserExec(Option_t *)
 	  
 	  AliExternalTrackParam *trackParam =  const_cast<AliExternalTrackParam*>(esdTrack->GetInnerParam());
 	  if(!trackParam) continue;
-	  AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trackParam, 440., fMass, fStepSurface, etaproj, phiproj, pttrackproj);
+	  AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(trackParam, 440., fMass, fStepSurface, etaproj, phiproj, pttrackproj);
 	  
 	  double dR_clusttrk = sqrt((phiproj-clusterPosition.Phi())*(phiproj-clusterPosition.Phi()) + 
 				    (etaproj-clusterPosition.Eta())*(etaproj-clusterPosition.Eta()) );
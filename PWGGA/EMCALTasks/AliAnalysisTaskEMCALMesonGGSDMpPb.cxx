@@ -48,6 +48,7 @@
 
 // EMCAL includes
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliEMCALGeometry.h"
 #include "AliTrackerBase.h"
 #include "AliEMCALCalibTimeDepCorrection.h" // Run dependent
@@ -1112,7 +1113,7 @@ void AliAnalysisTaskEMCALMesonGGSDMpPb::UserExec(Option_t *)
 
 	  AliExternalTrackParam *trackParam =  const_cast<AliExternalTrackParam*>(esdTrack->GetInnerParam());
 	  if(!trackParam) continue;
-	  AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trackParam, 440., fMass, fStepSurface, etaproj, phiproj, pttrackproj);
+	  AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(trackParam, 440., fMass, fStepSurface, etaproj, phiproj, pttrackproj);
 	  
 	  double dR_clusttrk = sqrt((phiproj-clusterPosition.Phi())*(phiproj-clusterPosition.Phi()) + 
 				    (etaproj-clusterPosition.Eta())*(etaproj-clusterPosition.Eta()) );
@@ -1200,7 +1201,7 @@ void AliAnalysisTaskEMCALMesonGGSDMpPb::UserExec(Option_t *)
 	  
 	  AliExternalTrackParam *trackParam =  const_cast<AliExternalTrackParam*>(aodTrack->GetInnerParam());
 	  if(!trackParam) continue;
-	  AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trackParam, 440., fMass, fStepSurface, etaproj, phiproj, pttrackproj);
+	  AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(trackParam, 440., fMass, fStepSurface, etaproj, phiproj, pttrackproj);
 	  
 	  double dR_clusttrk = sqrt((phiproj-clusterPosition.Phi())*(phiproj-clusterPosition.Phi()) + 
 				    (etaproj-clusterPosition.Eta())*(etaproj-clusterPosition.Eta()) );
@@ -32,6 +32,7 @@
 #include "AliAODMCHeader.h"
 #include "AliAODEvent.h"
 #include "AliMultSelection.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 
 class iostream;
 
@@ -888,7 +889,7 @@ void AliAnalysisTaskClusterQA::ProcessTracksAndMatching(AliVCluster* clus, Long_
     Float_t eta, phi, pt;
 
     //propagate tracks to emc surfaces
-    if (!AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt)) {
+    if (!AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt)) {
       delete trackParam;
       continue;
     }
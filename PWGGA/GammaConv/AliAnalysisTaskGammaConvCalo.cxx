@@ -4875,18 +4875,12 @@ void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
         if (gamma1==NULL) continue;
 
         if (gamma1->GetIsCaloPhoton()){
+          // the clusters are only read here, no copy needed
           AliVCluster* cluster = NULL;
-          if(fInputEvent->IsA()==AliESDEvent::Class()){
-            if(arrClustersMesonCand)
-              cluster = new AliESDCaloCluster(*(AliESDCaloCluster*)arrClustersMesonCand->At(gamma1->GetCaloClusterRef()));
-            else
-              cluster = fInputEvent->GetCaloCluster(gamma1->GetCaloClusterRef());
-          } else if(fInputEvent->IsA()==AliAODEvent::Class()){
-            if(arrClustersMesonCand)
-              cluster = new AliAODCaloCluster(*(AliAODCaloCluster*)arrClustersMesonCand->At(gamma1->GetCaloClusterRef()));
-            else
-              cluster = fInputEvent->GetCaloCluster(gamma1->GetCaloClusterRef());
-          }
+          if(arrClustersMesonCand)
+            cluster = (AliVCluster*)arrClustersMesonCand->At(gamma1->GetCaloClusterRef());
+          else
+            cluster = fInputEvent->GetCaloCluster(gamma1->GetCaloClusterRef());
 
           matched = ((AliCaloPhotonCuts*)fClusterCutArray->At(fiCut))->MatchConvPhotonToCluster(gamma0,cluster, fInputEvent, fWeightJetJetMC);
           if(fDoConvGammaShowerShapeTree && matched){
@@ -4904,7 +4898,6 @@ void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
             tESDClusterNLM = ((AliCaloPhotonCuts*)fClusterCutArray->At(fiCut))->GetNumberOfLocalMaxima(cluster, fInputEvent);
             tESDGammaERM02[fiCut]->Fill();
           }
-          if(arrClustersMesonCand) delete cluster;
         }
 
         AliAODConversionMother *pi0cand = new AliAODConversionMother(gamma0,gamma1);
@@ -5009,17 +5002,10 @@ void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
             Double_t tempIM = pi0cand->M();
             if( (tempIM > 0.05 && tempIM < 0.2) || (tempIM > 0.4 && tempIM < 0.6) ){
               AliVCluster* cluster = NULL;
-              if(fInputEvent->IsA()==AliESDEvent::Class()){
-                if(arrClustersMesonCand)
-                  cluster = new AliESDCaloCluster(*(AliESDCaloCluster*)arrClustersMesonCand->At(gamma1->GetCaloClusterRef()));
-                else
-                  cluster = fInputEvent->GetCaloCluster(gamma1->GetCaloClusterRef());
-              } else if(fInputEvent->IsA()==AliAODEvent::Class()){
-                if(arrClustersMesonCand)
-                  cluster = new AliAODCaloCluster(*(AliAODCaloCluster*)arrClustersMesonCand->At(gamma1->GetCaloClusterRef()));
-                else
-                  cluster = fInputEvent->GetCaloCluster(gamma1->GetCaloClusterRef());
-              }
+              if(arrClustersMesonCand)
+                cluster = (AliVCluster*)arrClustersMesonCand->At(gamma1->GetCaloClusterRef());
+              else
+                cluster = fInputEvent->GetCaloCluster(gamma1->GetCaloClusterRef());
               if(cluster->E()>1.){
                 tESDIMMesonInvMass = pi0cand->M();
                 tESDIMMesonPt = pi0cand->Pt();
@@ -5044,26 +5030,13 @@ void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
                   if( tESDmapIsClusterAcceptedWithoutTrackMatch[j] != 1 ) continue;
 
                   AliVCluster* secondClus = NULL;
-                  if(fInputEvent->IsA()==AliESDEvent::Class()){
-                    if(arrClustersMesonCand)
-                      secondClus = new AliESDCaloCluster(*(AliESDCaloCluster*)arrClustersMesonCand->At(j));
-                    else
-                      secondClus = new AliESDCaloCluster(*(AliESDCaloCluster*)fInputEvent->GetCaloCluster(j));
-                  } else if(fInputEvent->IsA()==AliAODEvent::Class()){
-                    if(arrClustersMesonCand)
-                      secondClus = new AliAODCaloCluster(*(AliAODCaloCluster*)arrClustersMesonCand->At(j));
-                    else
-                      secondClus = new AliAODCaloCluster(*(AliAODCaloCluster*)fInputEvent->GetCaloCluster(j));;
-                  }
+                  if(arrClustersMesonCand)
+                    secondClus = (AliVCluster*)arrClustersMesonCand->At(j);
+                  else
+                    secondClus = fInputEvent->GetCaloCluster(j);
 
-                  if(!secondClus){
-                    if(arrClustersMesonCand) delete secondClus;
-                    continue;
-                  }
-                  if(secondClus->GetID() == cluster->GetID()) {
-                    if(arrClustersMesonCand) delete secondClus;
-                    continue;
-                  }
+                  if(!secondClus) continue;
+                  if(secondClus->GetID() == cluster->GetID()) continue;
                   secondClus->GetPosition(secondClsPos);
                   TVector3 secondClsPosVec(secondClsPos);
 
@@ -5073,7 +5046,6 @@ void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
                     secondClus->GetMomentum(clusterVector,vertex);
                     sum_Et += clusterVector.Et();
                   }
-                  delete secondClus;
                 }
                 tESDIMClusterIsoSumClusterEt = sum_Et;
 
@@ -5112,7 +5084,6 @@ void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
 
                 tESDInvMassShowerShape[fiCut]->Fill();
               }
-              if(arrClustersMesonCand) delete cluster;
             }
           }
 
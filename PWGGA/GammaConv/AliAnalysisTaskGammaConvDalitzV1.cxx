@@ -2034,6 +2034,9 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
 
   vector<Int_t> lGoodElectronIndexPrev(0);
   vector<Int_t> lGoodPositronIndexPrev(0);
+  // Track wrappers of the selected candidates, kept for the pair loops below instead of being recreated for every pair
+  vector<std::unique_ptr<AliDalitzAODESD>> lGoodElectronPrev;
+  vector<std::unique_ptr<AliDalitzAODESD>> lGoodPositronPrev;
 
   for(UInt_t i = 0; i < fSelectorElectronIndex.size(); i++){
     std::unique_ptr<AliDalitzAODESD> electronCandidate = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(fSelectorElectronIndex[i]));
@@ -2088,6 +2091,7 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
         }
       }
     }
+    lGoodElectronPrev.push_back( std::move(electronCandidate) );
   }
 
   for(UInt_t i = 0; i < fSelectorPositronIndex.size(); i++){
@@ -2133,6 +2137,7 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
         }
       }
     }
+    lGoodPositronPrev.push_back( std::move(positronCandidate) );
   }
 
   vector<Bool_t> lElectronPsiIndex(lGoodElectronIndexPrev.size(), kTRUE);
@@ -2140,12 +2145,10 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
 
   if( ((AliDalitzElectronCuts*)fCutElectronArray->At(fiCut))->DoPsiPairCut() == kTRUE ){
     for( UInt_t i = 0; i < lGoodElectronIndexPrev.size(); i++ ) {
-         std::unique_ptr<AliDalitzAODESD> electronCandidate = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodElectronIndexPrev[i]));
-      //AliESDtrack *electronCandidate = fESDEvent->GetTrack(lGoodElectronIndexPrev[i]);
+      AliDalitzAODESD *electronCandidate = lGoodElectronPrev[i].get();
       for(UInt_t j = 0; j <  lGoodPositronIndexPrev.size(); j++){
-        //AliESDtrack *positronCandidate = fESDEvent->GetTrack(lGoodPositronIndexPrev[j]);
-          std::unique_ptr<AliDalitzAODESD> positronCandidate = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodPositronIndexPrev[j]));
-        Double_t psiPair = GetPsiPair(positronCandidate.get(),electronCandidate.get());
+        AliDalitzAODESD *positronCandidate = lGoodPositronPrev[j].get();
+        Double_t psiPair = GetPsiPair(positronCandidate,electronCandidate);
         Double_t deltaPhi = magField * TVector2::Phi_mpi_pi( electronCandidate->GetPhiG()-positronCandidate->GetPhiG());
 
         if( ((AliDalitzElectronCuts*)fCutElectronArray->At(fiCut))->IsFromGammaConversion(psiPair,deltaPhi) ){
@@ -2159,32 +2162,52 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
   vector<Int_t> lGoodElectronIndex(0);
   vector<Int_t> lGoodPositronIndex(0);
 
+  // The KF particles and four-momenta needed by the pair loops are built once per selected track
+  const Double_t electronMass = TDatabasePDG::Instance()->GetParticle(  ::kElectron   )->Mass();
+  const Double_t positronMass = TDatabasePDG::Instance()->GetParticle(  ::kPositron   )->Mass();
+  vector<AliDalitzAODESD*> lGoodElectron;
+  vector<AliDalitzAODESD*> lGoodPositron;
+  vector<AliKFParticle> lGoodElectronKF;
+  vector<AliKFParticle> lGoodPositronKF;
+  vector<TLorentzVector> lGoodElectronTLV;
+  vector<TLorentzVector> lGoodPositronTLV;
+
   for( UInt_t i = 0; i < lGoodElectronIndexPrev.size(); i++ ) {
-    if(  lElectronPsiIndex[i] == kTRUE )
-    lGoodElectronIndex.push_back(   lGoodElectronIndexPrev[i]  );
+    if(  lElectronPsiIndex[i] == kTRUE ){
+      lGoodElectronIndex.push_back(   lGoodElectronIndexPrev[i]  );
+      AliDalitzAODESD *electronCandidate = lGoodElectronPrev[i].get();
+      lGoodElectron.push_back( electronCandidate );
+      //NOTE Change GetParamG, GetDalitzVTrack
+      lGoodElectronKF.push_back( AliKFParticle( *electronCandidate->GetDalitzVTrack(),::kElectron ) );
+      TLorentzVector electronCandidateTLV;
+      electronCandidateTLV.SetXYZM(electronCandidate->GetPxG(),electronCandidate->GetPyG(),electronCandidate->GetPzG(),electronMass);
+      lGoodElectronTLV.push_back( electronCandidateTLV );
+    }
   }
 
   for( UInt_t i = 0; i < lGoodPositronIndexPrev.size(); i++ ) {
-    if(  lPositronPsiIndex[i] == kTRUE )
-    lGoodPositronIndex.push_back(   lGoodPositronIndexPrev[i]  );
+    if(  lPositronPsiIndex[i] == kTRUE ){
+      lGoodPositronIndex.push_back(   lGoodPositronIndexPrev[i]  );
+      AliDalitzAODESD *positronCandidate = lGoodPositronPrev[i].get();
+      lGoodPositron.push_back( positronCandidate );
+      //NOTE Change GetParamG, GetDalitzVTrack
+      lGoodPositronKF.push_back( AliKFParticle( *positronCandidate->GetDalitzVTrack(),::kPositron ) );
+      TLorentzVector positronCandidateTLV;
+      positronCandidateTLV.SetXYZM(positronCandidate->GetPxG(),positronCandidate->GetPyG(),positronCandidate->GetPzG(),positronMass);
+      lGoodPositronTLV.push_back( positronCandidateTLV );
+    }
   }
 
   for(UInt_t i = 0; i < lGoodElectronIndex.size(); i++){
-    std::unique_ptr<AliDalitzAODESD> electronCandidate = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodElectronIndex[i]));
-    //AliESDtrack *electronCandidate = fESDEvent->GetTrack(lGoodElectronIndex[i]);
-    AliKFParticle electronCandidateKF( *electronCandidate->GetDalitzVTrack(),::kElectron );
-    //NOTE Change GetParamG, GetDalitzVTrack
-    TLorentzVector electronCandidateTLV;
-    electronCandidateTLV.SetXYZM(electronCandidate->GetPxG(),electronCandidate->GetPyG(),electronCandidate->GetPzG(),TDatabasePDG::Instance()->GetParticle(  ::kElectron   )->Mass());
+    AliDalitzAODESD *electronCandidate = lGoodElectron[i];
+    const AliKFParticle &electronCandidateKF = lGoodElectronKF[i];
+    const TLorentzVector &electronCandidateTLV = lGoodElectronTLV[i];
 
     for(UInt_t j = 0; j < lGoodPositronIndex.size(); j++){
 
-      std::unique_ptr<AliDalitzAODESD> positronCandidate = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodPositronIndex[j]));
-      AliKFParticle positronCandidateKF( *positronCandidate->GetDalitzVTrack(),::kPositron );
-      //NOTE Change GetParamG, GetDalitzVTrack
-      TLorentzVector positronCandidateTLV;
-
-      positronCandidateTLV.SetXYZM(positronCandidate->GetPxG(),positronCandidate->GetPyG(),positronCandidate->GetPzG(),TDatabasePDG::Instance()->GetParticle(  ::kPositron   )->Mass());
+      AliDalitzAODESD *positronCandidate = lGoodPositron[j];
+      const AliKFParticle &positronCandidateKF = lGoodPositronKF[j];
+      const TLorentzVector &positronCandidateTLV = lGoodPositronTLV[j];
       TLorentzVector *virtualPhotonTLV = 0;
       AliKFConversionPhoton* virtualPhoton = NULL;
       AliAODConversionPhoton *vphoton;
@@ -2241,15 +2264,11 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
   //Computing mixing event
   if(  fDoMesonQA > 0 ) {
     for(UInt_t i = 0; i < lGoodElectronIndex.size(); i++){
-      std::unique_ptr<AliDalitzAODESD> electronCandidate1 = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodElectronIndex[i]));
-      AliKFParticle electronCandidate1KF( *electronCandidate1->GetDalitzVTrack(), ::kElectron );
-      //NOTE Change GetParamG, GetDalitzVTrack
+      const AliKFParticle &electronCandidate1KF = lGoodElectronKF[i];
 
       for(UInt_t j = i+1; j < lGoodElectronIndex.size(); j++){
 
-        std::unique_ptr<AliDalitzAODESD> electronCandidate2 = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodElectronIndex[j]));
-        AliKFParticle electronCandidate2KF( *electronCandidate2->GetDalitzVTrack(), ::kElectron );
-        //NOTE Change GetParamG, GetDalitzVTrack
+        const AliKFParticle &electronCandidate2KF = lGoodElectronKF[j];
         AliKFConversionPhoton* virtualPhoton = new AliKFConversionPhoton(electronCandidate1KF,electronCandidate2KF);
 
         //AliKFVertex primaryVertexImproved(*fInputEvent->GetPrimaryVertex());
@@ -2266,14 +2285,10 @@ void AliAnalysisTaskGammaConvDalitzV1::ProcessElectronCandidates(){
     }
 
     for(UInt_t i = 0; i < lGoodPositronIndex.size(); i++){
-      std::unique_ptr<AliDalitzAODESD> positronCandidate1 = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodPositronIndex[i]));
-      AliKFParticle positronCandidate1KF( *positronCandidate1->GetDalitzVTrack(), ::kPositron );
-      //NOTE Change GetParamG, GetDalitzVTrack
+      const AliKFParticle &positronCandidate1KF = lGoodPositronKF[i];
       for(UInt_t j = i+1; j < lGoodPositronIndex.size(); j++){
 
-        std::unique_ptr<AliDalitzAODESD> positronCandidate2 = std::unique_ptr<AliDalitzAODESD>(fAODESDEvent->GetTrack(lGoodPositronIndex[j]));
-        AliKFParticle positronCandidate2KF( *positronCandidate2->GetDalitzVTrack(), ::kPositron );
-        //NOTE Change GetParamG, GetDalitzVTrack
+        const AliKFParticle &positronCandidate2KF = lGoodPositronKF[j];
         AliKFConversionPhoton* virtualPhoton = new AliKFConversionPhoton(positronCandidate1KF,positronCandidate2KF);
         //AliKFVertex primaryVertexImproved(*fInputEvent->GetPrimaryVertex());
         //primaryVertexImproved+=*virtualPhoton;
@@ -3354,15 +3369,8 @@ void AliAnalysisTaskGammaConvDalitzV1::SetLogBinningXTH2(TH2* histoRebin){
 
 
 //_________________________________________________________________________________
-Bool_t AliAnalysisTaskGammaConvDalitzV1::CheckVectorForDoubleCount(vector<Int_t> &vec, Int_t tobechecked) {
-  if(tobechecked > -1){
-    vector<Int_t>::iterator it;
-    it = find (vec.begin(), vec.end(), tobechecked);
-    if (it != vec.end()) return true;
-    else{
-      vec.push_back(tobechecked);
-      return false;
-    }
-  }
+Bool_t AliAnalysisTaskGammaConvDalitzV1::CheckVectorForDoubleCount(std::unordered_set<Int_t> &vec, Int_t tobechecked) {
+  // insert() tells whether the label was already there, without scanning all labels seen so far
+  if(tobechecked > -1) return !vec.insert(tobechecked).second;
   return false;
 }
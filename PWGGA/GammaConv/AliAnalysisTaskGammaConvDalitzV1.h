@@ -16,6 +16,7 @@
 #include "TProfile2D.h"
 #include <vector>
 #include <memory>
+#include <unordered_set>
 using  std::unique_ptr;
 #include "AliDalitzAODESD.h"
 #include "AliDalitzData.h"
@@ -103,7 +104,7 @@ class AliAnalysisTaskGammaConvDalitzV1: public AliAnalysisTaskSE {
 
     Bool_t IsDalitz(AliDalitzAODESDMC *fMCMother) const;
     Bool_t IsPi0DalitzDaughter( Int_t label ) const;
-    Bool_t CheckVectorForDoubleCount(vector<Int_t> &vec, Int_t tobechecked);
+    Bool_t CheckVectorForDoubleCount(std::unordered_set<Int_t> &vec, Int_t tobechecked);
 
     AliV0ReaderV1                     *fV0Reader;
     TString                           fV0ReaderName;
@@ -295,9 +296,9 @@ class AliAnalysisTaskGammaConvDalitzV1: public AliAnalysisTaskSE {
     TH2F                              **fHistoDoubleCountTruePi0InvMassPt;      //! array of histos with double counted pi0s, invMass, pT
     TH2F                              **fHistoDoubleCountTrueEtaInvMassPt;      //! array of histos with double counted etas, invMass, pT
     TH2F                              **fHistoDoubleCountTrueConvGammaRPt;        //! array of histos with double counted photons, R, pT
-    vector<Int_t>                     fVectorDoubleCountTruePi0s;            //! vector containing labels of validated pi0
-    vector<Int_t>                     fVectorDoubleCountTrueEtas;            //! vector containing labels of validated eta
-    vector<Int_t>                     fVectorDoubleCountTrueConvGammas;          //! vector containing labels of validated photons
+    std::unordered_set<Int_t>         fVectorDoubleCountTruePi0s;            //! labels of validated pi0
+    std::unordered_set<Int_t>         fVectorDoubleCountTrueEtas;            //! labels of validated eta
+    std::unordered_set<Int_t>         fVectorDoubleCountTrueConvGammas;          //! labels of validated photons
 
     TRandom3                          fRandom;
     Double_t                          fEventPlaneAngle;
@@ -331,7 +332,7 @@ class AliAnalysisTaskGammaConvDalitzV1: public AliAnalysisTaskSE {
     AliAnalysisTaskGammaConvDalitzV1( const AliAnalysisTaskGammaConvDalitzV1& ); // Not implemented
     AliAnalysisTaskGammaConvDalitzV1& operator=( const AliAnalysisTaskGammaConvDalitzV1& ); // Not implemented
 
-  ClassDef( AliAnalysisTaskGammaConvDalitzV1, 8 );
+  ClassDef( AliAnalysisTaskGammaConvDalitzV1, 9 );
 };
 
 #endif // ALIANALYSISTASKGAMMACONVDALITZV1_H
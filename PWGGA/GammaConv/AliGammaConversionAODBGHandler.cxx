@@ -20,6 +20,8 @@
 //---------------------------------------------
 ////////////////////////////////////////////////
 
+#include <new>
+#include "TMath.h"
 #include "AliGammaConversionAODBGHandler.h"
 #include "AliKFParticle.h"
 #include "AliAODConversionPhoton.h"
@@ -29,6 +31,28 @@ using namespace std;
 
 ClassImp(AliGammaConversionAODBGHandler)
 
+namespace {
+  /// Fill a pool slot with copies of the photons of the new event. The photons
+  /// left in the slot by the event it replaces are rebuilt in place
+  /// (AliAODConversionPhoton::operator= does not copy), only the photons
+  /// beyond those are allocated.
+  template <class TColl>
+  void RefillPhotonSlot(std::vector<AliAODConversionPhoton*> &slot, TColl * const photons, Int_t nPhotons){
+    Int_t nReused = TMath::Min(nPhotons,(Int_t)slot.size());
+    for(Int_t i = 0; i < nReused; i++){
+      slot[i]->~AliAODConversionPhoton();
+      new(slot[i]) AliAODConversionPhoton(*(AliAODConversionPhoton*)(photons->At(i)));
+    }
+    for(UInt_t d = nReused; d < slot.size(); d++){
+      delete slot[d];
+    }
+    slot.resize(nReused);
+    for(Int_t i = nReused; i < nPhotons; i++){
+      slot.push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(photons->At(i))));
+    }
+  }
+}
+
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	TObject(),
@@ -614,16 +638,8 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
 
 	//  cout<<"The size of this vector is: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-    for(UInt_t d=0;d<fBGEvents[z][m][eventCounter].size();d++){
-		delete (AliAODConversionPhoton*)(fBGEvents[z][m][eventCounter][d]);
-	}
-	fBGEvents[z][m][eventCounter].clear();
-	
-	// add the gammas to the vector
-	for(Int_t i=0; i< eventGammas->GetEntries();i++){
-		//    AliKFParticle *t = new AliKFParticle(*(AliKFParticle*)(eventGammas->At(i)));
-		fBGEvents[z][m][eventCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventGammas->At(i))));
-	}
+	// replace the old gammas by the new ones
+	RefillPhotonSlot(fBGEvents[z][m][eventCounter],eventGammas,eventGammas->GetEntries());
 	fBGEventCounter[z][m]++;
 }
 //_____________________________________________________________________________________________________________________________
@@ -706,17 +722,8 @@ void AliGammaConversionAODBGHandler::AddElectronEvent(TClonesArray* const eventE
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
 
 	//  cout<<"The size of this vector is: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-    for(UInt_t d=0;d<fBGEventsENeg[z][m][eventENegCounter].size();d++){
-		delete (AliAODConversionPhoton*)(fBGEventsENeg[z][m][eventENegCounter][d]);
-	}
-
-	fBGEventsENeg[z][m][eventENegCounter].clear();
-
-	// add the electron to the vector
-	for(Int_t i=0; i< eventENeg->GetEntriesFast();i++){
-		//    AliKFParticle *t = new AliKFParticle(*(AliKFParticle*)(eventGammas->At(i)));
-		fBGEventsENeg[z][m][eventENegCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventENeg->At(i))));
-	}
+	// replace the old electrons by the new ones
+	RefillPhotonSlot(fBGEventsENeg[z][m][eventENegCounter],eventENeg,eventENeg->GetEntriesFast());
 	fBGEventENegCounter[z][m]++;
 }
 
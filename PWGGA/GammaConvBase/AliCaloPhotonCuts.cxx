@@ -58,6 +58,7 @@
 #include "AliESDtrackCuts.h"
 #include "AliCaloTrackMatcher.h"
 #include "AliPhotonIsolation.h"
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -67,6 +68,32 @@ using namespace std;
 
 ClassImp(AliCaloPhotonCuts)
 
+namespace {
+  /// key: cluster type, local maxima settings, then id and amplitude of each cell of the cluster
+  typedef std::vector<Double_t> SharedClusterNLMKey;
+  /// number of local maxima of the clusters of the current event, shared by all the cut objects of the process
+  struct SharedClusterNLMTable {
+    SharedClusterNLMTable() : fEvent(0x0), fEntry(-1), fEventId(0), fNLM() {}
+    const AliVEvent* fEvent;                      ///< event the clusters belong to
+    Long64_t fEntry;                              ///< entry of the analysis manager
+    ULong64_t fEventId;                           ///< bunch crossing and time stamp of the event
+    std::map<SharedClusterNLMKey,Int_t> fNLM;     ///< number of local maxima by key
+  };
+  std::map<SharedClusterNLMKey,Int_t>& GetSharedClusterNLM(const AliVEvent* ev) {
+    static SharedClusterNLMTable table;
+    AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+    const Long64_t entry=mgr ? mgr->GetCurrentEntry() : -1;
+    const ULong64_t evid=((ULong64_t)(ev->GetBunchCrossNumber())<<32) + ev->GetTimeStamp();
+    if(table.fEvent!=ev || table.fEntry!=entry || table.fEventId!=evid){
+      table.fNLM.clear();
+      table.fEvent=ev;
+      table.fEntry=entry;
+      table.fEventId=evid;
+    }
+    return table.fNLM;
+  }
+}
+
 
 const char* AliCaloPhotonCuts::fgkCutNames[AliCaloPhotonCuts::kNCuts] = {
   "ClusterType",          //0    0: all,    1: EMCAL,   2: PHOS
@@ -281,7 +308,10 @@ AliCaloPhotonCuts::AliCaloPhotonCuts(Int_t isMC, const char *name,const char *ti
   fHistMatchedTrackPClusETruePi0Clus(NULL),
   fNMaxDCalModules(8),
   fgkDCALCols(32),
-  fIsAcceptedForBasic(kFALSE)
+  fIsAcceptedForBasic(kFALSE),
+  fBadChannelDistanceCache(),
+  fBadChannelDistanceCacheRun(-1),
+  fShareClusterNLM(kFALSE)
 {
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
   fCutString=new TObjString((GetCutNumber()).Data());
@@ -479,7 +509,10 @@ AliCaloPhotonCuts::AliCaloPhotonCuts(const AliCaloPhotonCuts &ref) :
   fHistMatchedTrackPClusETruePi0Clus(NULL),
   fNMaxDCalModules(ref.fNMaxDCalModules),
   fgkDCALCols(ref.fgkDCALCols),
-  fIsAcceptedForBasic(ref.fIsAcceptedForBasic)
+  fIsAcceptedForBasic(ref.fIsAcceptedForBasic),
+  fBadChannelDistanceCache(),
+  fBadChannelDistanceCacheRun(-1),
+  fShareClusterNLM(ref.fShareClusterNLM)
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -2632,11 +2665,31 @@ Int_t AliCaloPhotonCuts::GetNumberOfLocalMaxima(AliVCluster* cluster, AliVEvent
 
   const Int_t   nc = cluster->GetNCells();
 
+  // the result only depends on the cells of the cluster and the local maxima settings,
+  // other cut objects may already have computed it for this event
+  SharedClusterNLMKey key;
+  if(fShareClusterNLM){
+    AliVCaloCells* cells = (fClusterType == 2) ? event->GetPHOSCells() : event->GetEMCALCells();
+    key.reserve(3+2*nc);
+    key.push_back(fClusterType);
+    key.push_back(fLocMaxCutEDiff);
+    key.push_back(fSeedEnergy);
+    for (Int_t iCell = 0;iCell < nc;iCell++){
+      key.push_back(cluster->GetCellsAbsId()[iCell]);
+      key.push_back(cells->GetCellAmplitude(cluster->GetCellsAbsId()[iCell]));
+    }
+    std::map<SharedClusterNLMKey,Int_t> &shared = GetSharedClusterNLM(event);
+    std::map<SharedClusterNLMKey,Int_t>::const_iterator it = shared.find(key);
+    if(it != shared.end()) return it->second;
+  }
+
   Int_t   absCellIdList[nc];
   Float_t maxEList[nc];
 
   Int_t nMax = GetNumberOfLocalMaxima(cluster, event, absCellIdList, maxEList);
 
+  if(fShareClusterNLM) GetSharedClusterNLM(event)[key] = nMax;
+
   return nMax;
 }
 
@@ -3001,18 +3054,6 @@ Bool_t AliCaloPhotonCuts::CheckDistanceToBadChannel(AliVCluster* cluster, AliVEv
   Int_t largestCellID = FindLargestCellInCluster(cluster,event);
   if(largestCellID==-1) AliFatal("CheckDistanceToBadChannel: FindLargestCellInCluster found cluster with NCells<1?");
 
-  Int_t largestCellicol = -1, largestCellirow = -1;
-  Int_t rowdiff =  0, coldiff =  0;
-
-  Int_t largestCelliMod = GetModuleNumberAndCellPosition(largestCellID, largestCellicol, largestCellirow);
-  if(largestCelliMod < 0) AliFatal("CheckDistanceToBadChannel: GetModuleNumberAndCellPosition found SM with ID<0?");
-
-  Int_t nMinRows = 0, nMaxRows = 0;
-  Int_t nMinCols = 0, nMaxCols = 0;
-
-  Bool_t checkNextSM = kFALSE;
-  Int_t distanceForLoop = fMinDistanceToBadChannel+1;
-
   Bool_t isDCal = kFALSE;
   if(fClusterType == 4){
     Float_t clusPos[3]={0,0,0};
@@ -3026,6 +3067,35 @@ Bool_t AliCaloPhotonCuts::CheckDistanceToBadChannel(AliVCluster* cluster, AliVEv
       isDCal = kTRUE;
   }
 
+  // the result only depends on the leading cell and the bad channel map of the run,
+  // compute it once per cell and run
+  if(fBadChannelDistanceCacheRun != event->GetRunNumber()){
+    fBadChannelDistanceCache.assign(fBadChannelDistanceCache.size(),-1);
+    fBadChannelDistanceCacheRun = event->GetRunNumber();
+  }
+  UInt_t cacheIndex = 2*largestCellID + (isDCal ? 1 : 0);
+  if(cacheIndex >= fBadChannelDistanceCache.size()) fBadChannelDistanceCache.resize(cacheIndex+1,-1);
+  if(fBadChannelDistanceCache[cacheIndex] < 0)
+    fBadChannelDistanceCache[cacheIndex] = CheckDistanceToBadChannelForCell(largestCellID,isDCal) ? 1 : 0;
+
+  return fBadChannelDistanceCache[cacheIndex] == 1;
+}
+
+//________________________________________________________________________
+Bool_t AliCaloPhotonCuts::CheckDistanceToBadChannelForCell(Int_t largestCellID, Bool_t isDCal)
+{
+  Int_t largestCellicol = -1, largestCellirow = -1;
+  Int_t rowdiff =  0, coldiff =  0;
+
+  Int_t largestCelliMod = GetModuleNumberAndCellPosition(largestCellID, largestCellicol, largestCellirow);
+  if(largestCelliMod < 0) AliFatal("CheckDistanceToBadChannel: GetModuleNumberAndCellPosition found SM with ID<0?");
+
+  Int_t nMinRows = 0, nMaxRows = 0;
+  Int_t nMinCols = 0, nMaxCols = 0;
+
+  Bool_t checkNextSM = kFALSE;
+  Int_t distanceForLoop = fMinDistanceToBadChannel+1;
+
   if( fClusterType == 1 || (fClusterType == 4 && !isDCal)){
     nMinRows = largestCellirow - distanceForLoop;
     nMaxRows = largestCellirow + distanceForLoop;
@@ -336,6 +336,7 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     Int_t       FindLargestCellInCluster(AliVCluster* cluster, AliVEvent* event);
     Int_t       FindSecondLargestCellInCluster(AliVCluster* cluster, AliVEvent* event);
     Bool_t      CheckDistanceToBadChannel(AliVCluster* cluster, AliVEvent* event);
+    Bool_t      CheckDistanceToBadChannelForCell(Int_t largestCellID, Bool_t isDCal);
     Int_t       ClassifyClusterForTMEffi(AliVCluster* cluster, AliVEvent* event, AliMCEvent* mcEvent, Bool_t isESD);
 
     std::vector<Int_t> GetVectorMatchedTracksToCluster(AliVEvent* event, AliVCluster* cluster);
@@ -357,6 +358,8 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     // Set basic merging cuts
     void        SetSeedEnergy(Double_t seed)                    {fSeedEnergy      = seed; return;}
     void        SetLocMaxCutEDiff(Double_t diffCut)             {fLocMaxCutEDiff  = diffCut; return;}
+    // share the number of local maxima of the clusters with the other cut objects of the process
+    void        SetShareClusterNLM(Bool_t share = kTRUE)         {fShareClusterNLM = share; return;}
 
     // Set Individual Cuts
     Bool_t      SetClusterTypeCut(Int_t);
@@ -620,9 +623,13 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     Int_t      fgkDCALCols;                             // Number of columns in DCal
     Bool_t     fIsAcceptedForBasic;                     // basic counting
 
+    std::vector<Char_t> fBadChannelDistanceCache;       //! per leading cell (x2 for DCal): -1 not computed, 0 away from, 1 close to a bad channel
+    Int_t      fBadChannelDistanceCacheRun;             //! run for which fBadChannelDistanceCache was filled
+    Bool_t     fShareClusterNLM;                        // look up the number of local maxima in the table shared by all cut objects
+
   private:
 
-    ClassDef(AliCaloPhotonCuts,85)
+    ClassDef(AliCaloPhotonCuts,87)
 };
 
 #endif
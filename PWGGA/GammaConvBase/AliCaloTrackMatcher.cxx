@@ -24,6 +24,8 @@
 #include "AliAODEvent.h"
 #include "AliCaloTrackMatcher.h"
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALClusterGrid.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliESDEvent.h"
 #include "AliESDtrack.h"
 #include "AliESDtrackCuts.h"
@@ -282,6 +284,19 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     }
   }
 
+  // index of the cluster positions, so that for each track only the clusters inside the matching window are looked at
+  AliEMCALClusterGrid clusterGrid;
+  clusterGrid.Reset(fMatchingWindow);
+  Float_t gridClsPos[3] = {0.,0.,0.};
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    AliVCluster* cluster = arrClusters ? dynamic_cast<AliVCluster*>(arrClusters->At(iclus)) : event->GetCaloCluster(iclus);
+    if (!cluster) continue;
+    cluster->GetPosition(gridClsPos);
+    clusterGrid.AddCluster(iclus, gridClsPos);
+  }
+  clusterGrid.Build();
+  std::vector<Int_t> clusterCandidates;
+
   for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){
     AliExternalTrackParam *trackParam = 0;
     AliVTrack *inTrack = 0x0;
@@ -360,7 +375,7 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
 
     //propagate tracks to emc surfaces
     if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
-      if (!AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt)) {
+      if (!AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt)) {
         delete trackParam;
         fHistControlMatches->Fill(2.,inTrack->Pt());
         continue;
@@ -425,7 +440,9 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     // cout << "eta/phi: " << eta << ", " << phi << endl;
     // cout << "nClus: " << nClus << endl;
     Int_t nClusterMatchesToTrack = 0;
-    for(Int_t iclus=0;iclus < nClus;iclus++){
+    clusterGrid.FindClusters(exPos, fMatchingWindow, clusterCandidates);
+    for(UInt_t icand=0;icand < clusterCandidates.size();icand++){
+      Int_t iclus = clusterCandidates[icand];
       AliVCluster* cluster = NULL;
       if(arrClusters){
         if(esdev){
@@ -640,7 +657,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 
   if(cluster->IsEMCAL()){
     Float_t eta = 0;Float_t phi = 0;Float_t pt = 0;
-    propagated = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt);
+    propagated = AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt);
     if(propagated){
       if( TMath::Abs(eta) > 0.8 ) {
         delete trackParam;
@@ -18,6 +18,8 @@
 
 #include <exception>
 #include <iostream>
+#include <new>
+#include "TMath.h"
 #include "AliLog.h"
 #include "AliEventplane.h"
 #include "AliConversionAODBGHandlerRP.h"
@@ -26,6 +28,28 @@ using namespace std;
 
 ClassImp(AliConversionAODBGHandlerRP);
 
+namespace {
+  /// Fill a pool slot with copies of the photons of the new event. The photons
+  /// left in the slot by the event it replaces are rebuilt in place
+  /// (AliAODConversionPhoton::operator= does not copy), only the photons
+  /// beyond those are allocated.
+  template <class TColl>
+  void RefillPhotonSlot(std::vector<AliAODConversionPhoton*> &slot, TColl * const photons, Int_t nPhotons){
+    Int_t nReused = TMath::Min(nPhotons,(Int_t)slot.size());
+    for(Int_t i = 0; i < nReused; i++){
+      slot[i]->~AliAODConversionPhoton();
+      new(slot[i]) AliAODConversionPhoton(*(AliAODConversionPhoton*)(photons->At(i)));
+    }
+    for(UInt_t d = nReused; d < slot.size(); d++){
+      delete slot[d];
+    }
+    slot.resize(nReused);
+    for(Int_t i = nReused; i < nPhotons; i++){
+      slot.push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(photons->At(i))));
+    }
+  }
+}
+
 //________________________________________________________________________
 AliConversionAODBGHandlerRP::AliConversionAODBGHandlerRP(Bool_t IsHeavyIon,Bool_t UseChargedTrackMult,Int_t NEvents) : TObject(),
   fIsHeavyIon(IsHeavyIon),
@@ -298,17 +322,8 @@ void AliConversionAODBGHandlerRP::AddEvent(TObjArray * const eventGammas,AliVEve
 
     Int_t eventCounter = fBGEventCounter[psi][z];
 
-    //clear the vector for old gammas
-    for(UInt_t d = 0; d < fBGEvents[psi][z][eventCounter].size(); d++){
-      delete (AliAODConversionPhoton*)(fBGEvents[psi][z][eventCounter][d]);
-    }
-
-    fBGEvents[psi][z][eventCounter].clear();
-
-    // add the gammas to the vector
-    for(Int_t i = 0; i < eventGammas->GetEntriesFast(); i++){
-      fBGEvents[psi][z][eventCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventGammas->At(i))));
-    }
+    // replace the old gammas by the new ones
+    RefillPhotonSlot(fBGEvents[psi][z][eventCounter],eventGammas,eventGammas->GetEntriesFast());
 
     fBGEventCounter[psi][z]++;
   }
@@ -333,17 +348,8 @@ void AliConversionAODBGHandlerRP::AddEvent(TList * const eventGammas,AliVEvent *
 
     Int_t eventCounter = fBGEventCounter[psi][z];
 
-    //clear the vector for old gammas
-    for(UInt_t d = 0; d < fBGEvents[psi][z][eventCounter].size(); d++){
-      delete (AliAODConversionPhoton*)(fBGEvents[psi][z][eventCounter][d]);
-    }
-
-    fBGEvents[psi][z][eventCounter].clear();
-
-    // add the gammas to the vector
-    for(Int_t i = 0; i < eventGammas->GetEntries(); i++){
-      fBGEvents[psi][z][eventCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventGammas->At(i))));
-    }
+    // replace the old gammas by the new ones
+    RefillPhotonSlot(fBGEvents[psi][z][eventCounter],eventGammas,eventGammas->GetEntries());
 
     fBGEventCounter[psi][z]++;
   }
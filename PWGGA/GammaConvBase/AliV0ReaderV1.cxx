@@ -39,6 +39,8 @@
 // AODTrack->GetID() == GetTrackLabelPositive() (GetTrackLabelNagative()).
 
 #include <vector>
+#include <map>
+#include <tuple>
 #include <TGeoGlobalMagField.h>
 
 #include "AliV0ReaderV1.h"
@@ -80,6 +82,48 @@ using namespace std;
 
 ClassImp(AliV0ReaderV1)
 
+namespace {
+  /// photon built from one V0 by the first V0 reader, reused by the readers with the same settings
+  struct SharedV0Photon {
+    SharedV0Photon() : fConstructed(0x0), fCompleted(0x0), fConvPointOk(kFALSE), fInvMassPair(0) {}
+    AliKFConversionPhoton *fConstructed;          ///< photon right after the KF construction
+    AliKFConversionPhoton *fCompleted;            ///< photon after the vertex, conversion point and psi pair updates
+    Bool_t  fConvPointOk;                         ///< conversion point found
+    Float_t fInvMassPair;                         ///< invariant mass of the pair
+  };
+  /// key: V0 index, positive and negative track labels, reconstruction settings
+  typedef std::tuple<Int_t,Int_t,Int_t,Int_t> SharedV0PhotonKey;
+  /// photons of the current event, shared by all the V0 readers of the process
+  struct SharedV0PhotonTable {
+    SharedV0PhotonTable() : fEvent(0x0), fEntry(-1), fEventId(0), fPhotons() {}
+    ~SharedV0PhotonTable() { Clear(); }
+    void Clear() {
+      for(std::map<SharedV0PhotonKey,SharedV0Photon>::iterator it=fPhotons.begin(); it!=fPhotons.end(); ++it){
+        delete it->second.fConstructed;
+        delete it->second.fCompleted;
+      }
+      fPhotons.clear();
+    }
+    const AliVEvent* fEvent;                      ///< event the photons belong to
+    Long64_t fEntry;                              ///< entry of the analysis manager
+    ULong64_t fEventId;                           ///< bunch crossing and time stamp of the event
+    std::map<SharedV0PhotonKey,SharedV0Photon> fPhotons; ///< photons by key
+  };
+  SharedV0Photon& GetSharedV0Photon(const AliVEvent* ev, const SharedV0PhotonKey& key) {
+    static SharedV0PhotonTable table;
+    AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+    const Long64_t entry=mgr ? mgr->GetCurrentEntry() : -1;
+    const ULong64_t evid=((ULong64_t)(ev->GetBunchCrossNumber())<<32) + ev->GetTimeStamp();
+    if(table.fEvent!=ev || table.fEntry!=entry || table.fEventId!=evid){
+      table.Clear();
+      table.fEvent=ev;
+      table.fEntry=entry;
+      table.fEventId=evid;
+    }
+    return table.fPhotons[key];
+  }
+}
+
 //________________________________________________________________________
 AliV0ReaderV1::AliV0ReaderV1(const char *name) : AliAnalysisTaskSE(name),
   kAddv0sInESDFilter(kFALSE),
@@ -164,7 +208,8 @@ AliV0ReaderV1::AliV0ReaderV1(const char *name) : AliAnalysisTaskSE(name),
   fImpactParamTree(NULL),
   fVectorFoundGammas(0),
   fCurrentFileName(""),
-  fMCFileChecked(kFALSE)
+  fMCFileChecked(kFALSE),
+  fShareV0Photons(kFALSE)
 {
   // Default constructor
 
@@ -839,13 +884,25 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
   //    cout << currentTrackLabels[0] << "\t" << currentTrackLabels[1] << endl;
   //    cout << "construct gamma " <<fUseConstructGamma << endl;
 
+  // Photon of the readers with the same settings, if already built
+  SharedV0Photon *shared=NULL;
+  if(fShareV0Photons){
+    const Int_t settings=(fUseConstructGamma?1:0)|(fUseImprovedVertex?2:0)|(fUseOwnXYZCalculation?4:0)|(fImprovedPsiPair<<3);
+    shared=&GetSharedV0Photon(fInputEvent,SharedV0PhotonKey(currentV0Index,currentTrackLabels[0],currentTrackLabels[1],settings));
+  }
+
   // Reconstruct Gamma
-  if(fUseConstructGamma){
-    fCurrentMotherKF = new AliKFConversionPhoton();
-    fCurrentMotherKF->ConstructGamma(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+  if(shared && shared->fConstructed){
+    fCurrentMotherKF = new AliKFConversionPhoton(*(shared->fConstructed));
   }else{
-    fCurrentMotherKF = new AliKFConversionPhoton(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
-    fCurrentMotherKF->SetMassConstraint(0,0.0001);
+    if(fUseConstructGamma){
+      fCurrentMotherKF = new AliKFConversionPhoton();
+      fCurrentMotherKF->ConstructGamma(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+    }else{
+      fCurrentMotherKF = new AliKFConversionPhoton(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+      fCurrentMotherKF->SetMassConstraint(0,0.0001);
+    }
+    if(shared) shared->fConstructed = new AliKFConversionPhoton(*fCurrentMotherKF);
   }
 
   // PID Cuts- positive track
@@ -890,6 +947,60 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
     }
   }
 
+  // Vertex, conversion point, psi pair and mass
+  Bool_t convPointOk=kFALSE;
+  if(shared && shared->fCompleted){
+    delete fCurrentMotherKF;
+    fCurrentMotherKF = new AliKFConversionPhoton(*(shared->fCompleted));
+    convPointOk=shared->fConvPointOk;
+    if(convPointOk) fCurrentInvMassPair=shared->fInvMassPair;
+  }else{
+    convPointOk=CompleteV0Photon(fCurrentMotherKF,fCurrentV0,fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+    if(shared){
+      shared->fCompleted = new AliKFConversionPhoton(*fCurrentMotherKF);
+      shared->fConvPointOk=convPointOk;
+      shared->fInvMassPair=fCurrentInvMassPair;
+    }
+  }
+  if(!convPointOk){
+    fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kConvPointFail);
+    delete fCurrentMotherKF;
+    fCurrentMotherKF=NULL;
+    return 0x0;
+  }
+
+  // apply possible Kappa cut
+  if (!fConversionCuts->KappaCuts(fCurrentMotherKF,fInputEvent)){
+    fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kdEdxCuts);
+    delete fCurrentMotherKF;
+    fCurrentMotherKF=NULL;
+    return 0x0;
+  }
+
+  // Apply Photon Cuts
+  if(!fConversionCuts->PhotonCuts(fCurrentMotherKF,fInputEvent)){
+    fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kPhotonCuts);
+    delete fCurrentMotherKF;
+    fCurrentMotherKF=NULL;
+    return 0x0;
+  }
+
+  //    cout << currentV0Index <<" \t after: \t" <<fCurrentMotherKF->GetPx() << "\t" << fCurrentMotherKF->GetPy() << "\t" << fCurrentMotherKF->GetPz()  << endl;
+
+  if(fProduceImpactParamHistograms) FillImpactParamHistograms(posTrack, negTrack, fCurrentV0, fCurrentMotherKF);
+
+  fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kPhotonOut);
+  return fCurrentMotherKF;
+}
+
+///________________________________________________________________________
+Bool_t AliV0ReaderV1::CompleteV0Photon(AliKFConversionPhoton *fCurrentMotherKF,const AliESDv0 *fCurrentV0,
+                                       const AliExternalTrackParam *fCurrentExternalTrackParamPositive,const AliExternalTrackParam *fCurrentExternalTrackParamNegative,
+                                       const AliKFParticle &fCurrentNegativeKFParticle,const AliKFParticle &fCurrentPositiveKFParticle)
+{
+  // Update the vertex, conversion point, psi pair and mass of the photon built from the V0,
+  // returns kFALSE if the conversion point cannot be calculated
+
   // Update Vertex (moved for same eta compared to old)
   //      cout << currentV0Index <<" \t before: \t" << fCurrentMotherKF->GetPx() << "\t" << fCurrentMotherKF->GetPy() << "\t" << fCurrentMotherKF->GetPz()  << endl;
   if(fUseImprovedVertex == kTRUE){
@@ -909,12 +1020,7 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
   Double_t dca[2]={0,0};
   if(fUseOwnXYZCalculation){
     //    Double_t convpos[3]={0,0,0};
-    if(!GetConversionPoint(fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,convpos,dca)){
-      fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kConvPointFail);
-      delete fCurrentMotherKF;
-      fCurrentMotherKF=NULL;
-      return 0x0;
-    }
+    if(!GetConversionPoint(fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,convpos,dca)) return kFALSE;
 
     fCurrentMotherKF->SetConversionPoint(convpos);
   }
@@ -942,28 +1048,7 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
   fCurrentMotherKFForMass.GetPt(Pt,Pt_width);
   fCurrentInvMassPair=mass;
 
-  // apply possible Kappa cut
-  if (!fConversionCuts->KappaCuts(fCurrentMotherKF,fInputEvent)){
-    fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kdEdxCuts);
-    delete fCurrentMotherKF;
-    fCurrentMotherKF=NULL;
-    return 0x0;
-  }
-
-  // Apply Photon Cuts
-  if(!fConversionCuts->PhotonCuts(fCurrentMotherKF,fInputEvent)){
-    fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kPhotonCuts);
-    delete fCurrentMotherKF;
-    fCurrentMotherKF=NULL;
-    return 0x0;
-  }
-
-  //    cout << currentV0Index <<" \t after: \t" <<fCurrentMotherKF->GetPx() << "\t" << fCurrentMotherKF->GetPy() << "\t" << fCurrentMotherKF->GetPz()  << endl;
-
-  if(fProduceImpactParamHistograms) FillImpactParamHistograms(posTrack, negTrack, fCurrentV0, fCurrentMotherKF);
-
-  fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kPhotonOut);
-  return fCurrentMotherKF;
+  return kTRUE;
 }
 
 ///________________________________________________________________________
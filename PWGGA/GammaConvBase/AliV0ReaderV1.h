@@ -108,6 +108,7 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
 
     void               SetUseOwnXYZCalculation(Bool_t flag)             {fUseOwnXYZCalculation=flag; return;}
     void               SetUseConstructGamma(Bool_t flag)                {fUseConstructGamma=flag; return;}
+    void               SetShareV0Photons(Bool_t flag=kTRUE)             {fShareV0Photons=flag; return;}
     void               SetUseAODConversionPhoton(Bool_t b)              {if(b){ cout<<"Setting Outputformat to AliAODConversionPhoton "<<endl;}
                                                                          else { cout<<"Setting Outputformat to AliKFConversionPhoton "<<endl;}
                                                                          kUseAODConversionPhoton=b; return;}
@@ -180,6 +181,9 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     // Reconstruct Gammas
     Bool_t                  ProcessESDV0s();
     AliKFConversionPhoton*  ReconstructV0(AliESDv0* fCurrentV0,Int_t currentV0Index);
+    Bool_t                  CompleteV0Photon(AliKFConversionPhoton *fCurrentMotherKF, const AliESDv0 *fCurrentV0,
+                                             const AliExternalTrackParam *fCurrentExternalTrackParamPositive, const AliExternalTrackParam *fCurrentExternalTrackParamNegative,
+                                             const AliKFParticle &fCurrentNegativeKFParticle, const AliKFParticle &fCurrentPositiveKFParticle);
     void                    FillAODOutput();
     void                    FindDeltaAODBranchName();
     Bool_t                  GetAODConversionGammas();
@@ -280,13 +284,14 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     vector<Int_t>  fVectorFoundGammas;            // vector with found MC labels of gammas
     TString       fCurrentFileName;               // current file name
     Bool_t        fMCFileChecked;                 // vector with MC file names which are broken
+    Bool_t        fShareV0Photons;                // reuse the photons built from the same V0 by another V0 reader with the same settings in this event
 
   private:
     AliV0ReaderV1(AliV0ReaderV1 &original);
     AliV0ReaderV1 &operator=(const AliV0ReaderV1 &ref);
 
 
-    ClassDef(AliV0ReaderV1, 22)
+    ClassDef(AliV0ReaderV1, 23)
 
 };
 
@@ -76,6 +76,20 @@
 #include "AliPHOSTriggerHelper.h"
 #include "AliAnalysisTaskPHOSPi0EtaToGammaGamma.h"
 
+namespace {
+  const Int_t kNModulePairs = 6;//PHOS modules 1-4 (+ margin)
+
+  //histogram of a module pair, looked up in the list only once per call of FillMixMgg
+  TH2 *ModulePairHistogram(TList *list, const char *format, Int_t m1, Int_t m2, TH2 *cache[kNModulePairs][kNModulePairs], Bool_t found[kNModulePairs][kNModulePairs])
+  {
+    if(!found[m1][m2]){
+      cache[m1][m2] = dynamic_cast<TH2*>(list->FindObject(Form(format,m1,m2)));
+      found[m1][m2] = kTRUE;
+    }
+    return cache[m1][m2];
+  }
+}
+
 // Author: Daiki Sekihata (Hiroshima University)
 
 ClassImp(AliAnalysisTaskPHOSPi0EtaToGammaGamma)
@@ -155,7 +169,10 @@ AliAnalysisTaskPHOSPi0EtaToGammaGamma::AliAnalysisTaskPHOSPi0EtaToGammaGamma(con
   fMinPtPi0(0),
   fMinPtChPi(0),
   fMaxR(999.),
-  fPIDStudy(kFALSE)
+  fPIDStudy(kFALSE),
+  fPackedPhotons(),
+  fPackedMixPhotons(),
+  fHistRegistry()
 {
   // Constructor
 
@@ -1003,6 +1020,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserCreateOutputObjects()
     }
   }
 
+  fHistRegistry.SetList(fOutputContainer);
+
   PostData(1,fOutputContainer);
 
 }
@@ -2132,86 +2151,82 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMixMgg()
 {
   TList *prevPHOS = fPHOSEvents[fZvtx][fEPBin];
 
-  const Int_t multClust = fPHOSClusterArray->GetEntriesFast();
-
-  TLorentzVector p12, p12core;
   Double_t m12=0,pt12=0,asym=0;
   Double_t phi = -999, dphi = -999.;
   Double_t weight = 1., w1 = 1., w2 = 1.;
   Double_t value[4] = {};
   Double_t sp1 = -999;
 
-  Double_t eff1=1, eff2=1, eff12=1;
+  Double_t eff12=1;
   Double_t e1=0,e2=0;
-  TF1 *f1tof = GetTOFCutEfficiencyFunction();
 
   Double_t trgeff1=1;
   Double_t trgeff2=1;
   Double_t trgeff12=1;
-  TF1 *f1trg = GetTriggerEfficiencyFunction();
 
-  for(Int_t i1=0;i1<multClust;i1++){
-    AliCaloPhoton *ph1 = (AliCaloPhoton*)fPHOSClusterArray->At(i1);
-    if(!fPHOSClusterCuts->AcceptPhoton(ph1)) continue;
-    if(!CheckMinimumEnergy(ph1)) continue;
+  const Bool_t isTAP = !fIsMC && fIsPHOSTriggerAnalysis && fTRFM == AliAnalysisTaskPHOSPi0EtaToGammaGamma::kTAP;
+  const Bool_t isRFE = fIsPHOSTriggerAnalysis && fTRFM == AliAnalysisTaskPHOSPi0EtaToGammaGamma::kRFE;
+
+  //the photon selection and the single photon efficiencies are evaluated once per photon, not once per pair
+  PackPhotons(fPHOSClusterArray,fPackedPhotons,isTAP,isRFE || fForceActiveTRU);
+  const Int_t nMix = prevPHOS->GetSize();
+  if((Int_t)fPackedMixPhotons.size() < nMix) fPackedMixPhotons.resize(nMix);
+  Int_t maxMult = 0;
+  for(Int_t ev=0;ev<nMix;ev++){
+    PackPhotons(static_cast<TClonesArray*>(prevPHOS->At(ev)),fPackedMixPhotons[ev],isTAP,isRFE || fForceActiveTRU);
+    maxMult = TMath::Max(maxMult,fPackedMixPhotons[ev].GetSize());
+  }
+  std::vector<Double_t> m12s(maxMult), pt12s(maxMult), phi12s(maxMult), asyms(maxMult);
 
-    for(Int_t ev=0;ev<prevPHOS->GetSize();ev++){
-      TClonesArray *mixPHOS = static_cast<TClonesArray*>(prevPHOS->At(ev));
+  THnSparse *hSparse    = dynamic_cast<THnSparse*>(fOutputContainer->FindObject("hSparseMixMgg"));
+  THnSparse *hSparseTOF = dynamic_cast<THnSparse*>(fOutputContainer->FindObject("hSparseMixMgg_TOF"));
+  TH2 *hModule[kNModulePairs][kNModulePairs] = {}, *hModuleTOF[kNModulePairs][kNModulePairs] = {};
+  Bool_t foundModule[kNModulePairs][kNModulePairs] = {}, foundModuleTOF[kNModulePairs][kNModulePairs] = {};
 
-      for(Int_t i2=0;i2<mixPHOS->GetEntriesFast();i2++){
-        AliCaloPhoton *ph2 = (AliCaloPhoton*)mixPHOS->At(i2);
-        if(!fPHOSClusterCuts->AcceptPhoton(ph2)) continue;
-        if(!CheckMinimumEnergy(ph2)) continue;
+  const AliPHOSPhotonPairs &photons1 = fPackedPhotons;
+  for(Int_t i1=0;i1<photons1.GetSize();i1++){
+    AliCaloPhoton *ph1 = photons1.GetPhoton(i1);
+
+    for(Int_t ev=0;ev<nMix;ev++){
+      const AliPHOSPhotonPairs &photons2 = fPackedMixPhotons[ev];
+      const Int_t mult2 = photons2.GetSize();
+      photons1.PairKinematics(i1,photons2,0,mult2,m12s.data(),pt12s.data(),phi12s.data(),asyms.data());
 
+      for(Int_t i2=0;i2<mult2;i2++){
         if(fIsPHOSTriggerAnalysis){
-          if(!fIsMC && (!ph1->IsTrig() && !ph2->IsTrig())) continue;//it is meaningless to reconstruct invariant mass with FALSE-FALSE combination in PHOS triggered data.
-          if(fTRFM == AliAnalysisTaskPHOSPi0EtaToGammaGamma::kRFE && (!fPHOSTriggerHelper->IsOnActiveTRUChannel(ph1) || !fPHOSTriggerHelper->IsOnActiveTRUChannel(ph2))) continue;//use cluster pairs only on active TRU both in data and M.C.
+          if(!fIsMC && (!photons1.HasFlag(i1,AliPHOSPhotonPairs::kTrig) && !photons2.HasFlag(i2,AliPHOSPhotonPairs::kTrig))) continue;//it is meaningless to reconstruct invariant mass with FALSE-FALSE combination in PHOS triggered data.
+          if(isRFE && (!photons1.HasFlag(i1,AliPHOSPhotonPairs::kActiveTRU) || !photons2.HasFlag(i2,AliPHOSPhotonPairs::kActiveTRU))) continue;//use cluster pairs only on active TRU both in data and M.C.
         }
 
         if(fForceActiveTRU 
-            && (!fPHOSTriggerHelper->IsOnActiveTRUChannel(ph1) || !fPHOSTriggerHelper->IsOnActiveTRUChannel(ph2))
+            && (!photons1.HasFlag(i1,AliPHOSPhotonPairs::kActiveTRU) || !photons2.HasFlag(i2,AliPHOSPhotonPairs::kActiveTRU))
           ) continue;//only for kINT7
 
-        e1 = ph1->Energy();
-        e2 = ph2->Energy();
+        e1 = photons1.GetE(i1);
+        e2 = photons2.GetE(i2);
 
-        p12  = *ph1 + *ph2;
-        m12  = p12.M();
-        pt12 = p12.Pt();
-        phi  = p12.Phi();
-        asym = TMath::Abs((ph1->Energy()-ph2->Energy())/(ph1->Energy()+ph2->Energy()));
+        m12  = m12s[i2];
+        pt12 = pt12s[i2];
+        phi  = phi12s[i2];
+        asym = asyms[i2];
 
-        if(fUseCoreEnergy){
-          p12core = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-          m12     = p12core.M();
-          pt12    = p12core.Pt();
-          phi     = p12core.Phi();
-
-          e1 = (ph1->GetMomV2())->Energy();
-          e2 = (ph2->GetMomV2())->Energy();
-          asym = TMath::Abs(e1 - e2) / (e1 + e2);
-
-        }
-
-        eff1 = f1tof->Eval(e1);
-        eff2 = f1tof->Eval(e2);
-        eff12 = eff1 * eff2;
+        eff12 = photons1.GetTOFEfficiency(i1) * photons2.GetTOFEfficiency(i2);
         weight = 1.;
 
-        if(!fIsMC && fIsPHOSTriggerAnalysis && fTRFM == AliAnalysisTaskPHOSPi0EtaToGammaGamma::kTAP){
-          if((!ph1->IsTrig() || e1 < fEnergyThreshold)
-          && (!ph2->IsTrig() || e2 < fEnergyThreshold)
+        if(isTAP){
+          if((!photons1.HasFlag(i1,AliPHOSPhotonPairs::kTrig) || e1 < fEnergyThreshold)
+          && (!photons2.HasFlag(i2,AliPHOSPhotonPairs::kTrig) || e2 < fEnergyThreshold)
             ) continue;
 
-          trgeff1  = f1trg->Eval(e1);
-          trgeff2  = f1trg->Eval(e2);
+          trgeff1  = photons1.GetTriggerEfficiency(i1);
+          trgeff2  = photons2.GetTriggerEfficiency(i2);
           trgeff12 = trgeff1 + trgeff2 - (trgeff1 * trgeff2);//logical OR
 
         }
 
         if(fIsMC){
-          w1= ph1->GetWeight();
-          w2 = ph2->GetWeight();
+          w1 = photons1.GetWeight(i1);
+          w2 = photons2.GetWeight(i2);
 
           weight = w1*w2;
 
@@ -2237,20 +2252,33 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMixMgg()
         value[2] = asym;
 
         if(fIsOAStudy){
-          Double_t oa = TMath::Abs(ph1->Angle(ph2->Vect())) * 1e+3;//rad->mrad
+          Double_t oa = TMath::Abs(ph1->Angle(photons2.GetPhoton(i2)->Vect())) * 1e+3;//rad->mrad
           FillHistogramTH3(fOutputContainer,"hMixMgg_OA",m12,pt12,oa,weight);
         }
 
         if(m12 > 0.96) continue;//reduce entry in THnSparse
 
-        FillSparse(fOutputContainer,"hSparseMixMgg",value,weight * 1/trgeff12);
+        if(hSparse) hSparse->Fill(value,weight * 1/trgeff12);
+        else        FillSparse(fOutputContainer,"hSparseMixMgg",value,weight * 1/trgeff12);
+
+        const Int_t mod1 = photons1.GetModule(i1);
+        const Int_t mod2 = photons2.GetModule(i2);
+        const Int_t modMin = TMath::Min(mod1,mod2), modMax = TMath::Max(mod1,mod2);
+        const Bool_t closeModules = TMath::Abs(mod1-mod2) < 2;
+        //module pair fast path: histogram pointers cached instead of formatting and looking up the name per pair
+        const Bool_t cachedModules = modMin >= 0 && modMax < kNModulePairs;
+        TH2 *hMod = (closeModules && cachedModules) ? ModulePairHistogram(fOutputContainer,"hMixMgg_M%d%d",modMin,modMax,hModule,foundModule) : 0x0;
 
-        if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fOutputContainer,Form("hMixMgg_M%d%d",TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12, weight * 1/trgeff12);
+        if(hMod) hMod->Fill(m12,pt12, weight * 1/trgeff12);
+        else if(closeModules) FillHistogramTH2(fOutputContainer,Form("hMixMgg_M%d%d",modMin,modMax),m12,pt12, weight * 1/trgeff12);
 
-        if(ph1->IsTOFOK() && ph2->IsTOFOK()){
-          FillSparse(fOutputContainer,"hSparseMixMgg_TOF",value,1/eff12 * weight * 1/trgeff12);
+        if(photons1.HasFlag(i1,AliPHOSPhotonPairs::kTOFOK) && photons2.HasFlag(i2,AliPHOSPhotonPairs::kTOFOK)){
+          if(hSparseTOF) hSparseTOF->Fill(value,1/eff12 * weight * 1/trgeff12);
+          else           FillSparse(fOutputContainer,"hSparseMixMgg_TOF",value,1/eff12 * weight * 1/trgeff12);
 
-          if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fOutputContainer,Form("hMixMgg_M%d%d_TOF",TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,1/eff12 * weight * 1/trgeff12);
+          TH2 *hModTOF = (closeModules && cachedModules) ? ModulePairHistogram(fOutputContainer,"hMixMgg_M%d%d_TOF",modMin,modMax,hModuleTOF,foundModuleTOF) : 0x0;
+          if(hModTOF) hModTOF->Fill(m12,pt12,1/eff12 * weight * 1/trgeff12);
+          else if(closeModules) FillHistogramTH2(fOutputContainer,Form("hMixMgg_M%d%d_TOF",modMin,modMax),m12,pt12,1/eff12 * weight * 1/trgeff12);
 
         }//end of TOF cut
 
@@ -2262,6 +2290,32 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMixMgg()
 
 }
 //________________________________________________________________________
+void AliAnalysisTaskPHOSPi0EtaToGammaGamma::PackPhotons(TClonesArray *array, AliPHOSPhotonPairs &photons, Bool_t withTrgEff, Bool_t withTRU)
+{
+  //accepted photons of one event with the quantities used in the pair loops
+  photons.Clear();
+  if(!array) return;
+
+  TF1 *f1tof = GetTOFCutEfficiencyFunction();
+  TF1 *f1trg = GetTriggerEfficiencyFunction();
+
+  for(Int_t i=0;i<array->GetEntriesFast();i++){
+    AliCaloPhoton *ph = (AliCaloPhoton*)array->At(i);
+    if(!fPHOSClusterCuts->AcceptPhoton(ph)) continue;
+    if(!CheckMinimumEnergy(ph)) continue;
+
+    Double_t e = ph->Energy();
+    if(fUseCoreEnergy) e = (ph->GetMomV2())->Energy();
+
+    UInt_t flags = 0;
+    if(ph->IsTOFOK()) flags |= AliPHOSPhotonPairs::kTOFOK;
+    if(ph->IsTrig())  flags |= AliPHOSPhotonPairs::kTrig;
+    if(withTRU && fPHOSTriggerHelper->IsOnActiveTRUChannel(ph)) flags |= AliPHOSPhotonPairs::kActiveTRU;
+
+    photons.AddPhoton(ph,fUseCoreEnergy,flags,f1tof->Eval(e),withTrgEff ? f1trg->Eval(e) : 1.);
+  }
+}
+//________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillM3pi() 
 {
   const Int_t trackMult = fEvent->GetNumberOfTracks();
@@ -3953,7 +4007,7 @@ Int_t AliAnalysisTaskPHOSPi0EtaToGammaGamma::FindCommonParent(Int_t iPart, Int_t
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH1(TList *list, const Char_t *hname, Double_t x, Double_t w, Option_t *opt) const
 {
   //FillHistogram
-  TH1 * hist = dynamic_cast<TH1*>(list->FindObject(hname));
+  TH1 * hist = list == fHistRegistry.GetList() ? fHistRegistry.FindTH1(hname) : dynamic_cast<TH1*>(list->FindObject(hname));
   if(!hist){
     AliError(Form("can not find histogram (of instance TH1) <%s> ",hname));
     return;
@@ -3977,7 +4031,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH1(TList *list, const
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH2(TList *list, const Char_t *name, Double_t x, Double_t y, Double_t w, Option_t *opt) const
 {
-  TH2 * hist = dynamic_cast<TH2*>(list->FindObject(name));
+  TH2 * hist = list == fHistRegistry.GetList() ? fHistRegistry.FindTH2(name) : dynamic_cast<TH2*>(list->FindObject(name));
   if(!hist){
     AliError(Form("can not find histogram (of instance TH2) <%s> ",name));
     return;
@@ -4000,7 +4054,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH2(TList *list, const
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH3(TList *list, const Char_t *name, Double_t x, Double_t y, Double_t z, Double_t w, Option_t *opt) const
 {
-  TH3 * hist = dynamic_cast<TH3*>(list->FindObject(name));
+  TH3 * hist = list == fHistRegistry.GetList() ? fHistRegistry.FindTH3(name) : dynamic_cast<TH3*>(list->FindObject(name));
   if(!hist){
     AliError(Form("can not find histogram (of instance TH3) <%s> ",name));
     return;
@@ -4027,7 +4081,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH3(TList *list, const
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillProfile(TList *list, const Char_t *name, Double_t x, Double_t y) const
 {
-  TProfile * hist = dynamic_cast<TProfile*>(list->FindObject(name));
+  TProfile * hist = list == fHistRegistry.GetList() ? fHistRegistry.FindTProfile(name) : dynamic_cast<TProfile*>(list->FindObject(name));
   if(!hist){
     AliError(Form("can not find histogram (of instance TH3) <%s> ",name));
     return;
@@ -4041,7 +4095,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillProfile(TList *list, const Char_
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillSparse(TList *list, const Char_t *name, Double_t *x, Double_t w) const
 {
-  THnSparse * hist = dynamic_cast<THnSparse*>(list->FindObject(name));
+  THnSparse * hist = list == fHistRegistry.GetList() ? fHistRegistry.FindTHnSparse(name) : dynamic_cast<THnSparse*>(list->FindObject(name));
   if(!hist){
     AliError(Form("can not find histogram (of instance THnSparse) <%s> ",name));
     return;
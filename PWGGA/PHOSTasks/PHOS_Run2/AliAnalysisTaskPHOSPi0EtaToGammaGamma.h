@@ -22,6 +22,8 @@ class AliQnCorrectionsManager;
 #include "AliPHOSEventCuts.h"
 #include "AliPHOSClusterCuts.h"
 #include "AliPHOSJetJetMC.h"
+#include "AliPHOSPhotonPairs.h"
+#include "THistRegistry.h"
 
 class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
   public:
@@ -324,6 +326,7 @@ class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
     virtual void FillPhoton();
     virtual void FillMgg();
     virtual void FillMixMgg();
+    void PackPhotons(TClonesArray *array, AliPHOSPhotonPairs &photons, Bool_t withTrgEff, Bool_t withTRU);
     virtual void FillM3pi();//omega->pi0 pi+ pi-
     virtual void EstimatePIDCutEfficiency();
     void EstimateTOFCutEfficiency();
@@ -518,13 +521,16 @@ class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
     Double_t fMinPtChPi;//only for omega->3pi
     Double_t fMaxR;//only for omega->3pi
     Bool_t fPIDStudy;
+    AliPHOSPhotonPairs fPackedPhotons;//! accepted photons of this event, for the mixing
+    std::vector<AliPHOSPhotonPairs> fPackedMixPhotons;//! accepted photons of the pool events, refilled for each event
+    mutable THistRegistry fHistRegistry;//! histograms of fOutputContainer by name, resolved once for the Fill* helpers
 
 
   private:
     AliAnalysisTaskPHOSPi0EtaToGammaGamma(const AliAnalysisTaskPHOSPi0EtaToGammaGamma&);
     AliAnalysisTaskPHOSPi0EtaToGammaGamma& operator=(const AliAnalysisTaskPHOSPi0EtaToGammaGamma&);
 
-    ClassDef(AliAnalysisTaskPHOSPi0EtaToGammaGamma, 72);
+    ClassDef(AliAnalysisTaskPHOSPi0EtaToGammaGamma, 74);
 };
 
 #endif
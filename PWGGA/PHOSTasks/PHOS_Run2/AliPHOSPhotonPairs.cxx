@@ -0,0 +1,80 @@
+#include "TMath.h"
+#include "TLorentzVector.h"
+#include "AliCaloPhoton.h"
+#include "AliPHOSPhotonPairs.h"
+
+//________________________________________________________________________
+AliPHOSPhotonPairs::AliPHOSPhotonPairs():
+  fPhoton(),
+  fPx(),
+  fPy(),
+  fPz(),
+  fE(),
+  fModule(),
+  fFlags(),
+  fWeight(),
+  fTOFEff(),
+  fTrgEff()
+{
+  //Constructor
+
+}
+//________________________________________________________________________
+void AliPHOSPhotonPairs::Clear()
+{
+  //keeps the capacity for the next event
+  fPhoton.clear();
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fE.clear();
+  fModule.clear();
+  fFlags.clear();
+  fWeight.clear();
+  fTOFEff.clear();
+  fTrgEff.clear();
+}
+//________________________________________________________________________
+void AliPHOSPhotonPairs::AddPhoton(AliCaloPhoton *ph, Bool_t useCore, UInt_t flags, Double_t tofeff, Double_t trgeff)
+{
+  const TLorentzVector *p = useCore ? ph->GetMomV2() : ph;
+
+  fPhoton.push_back(ph);
+  fPx.push_back(p->Px());
+  fPy.push_back(p->Py());
+  fPz.push_back(p->Pz());
+  fE.push_back(p->E());
+  fModule.push_back(ph->Module());
+  fFlags.push_back(flags);
+  fWeight.push_back(ph->GetWeight());
+  fTOFEff.push_back(tofeff);
+  fTrgEff.push_back(trgeff);
+}
+//________________________________________________________________________
+void AliPHOSPhotonPairs::PairKinematics(Int_t i1, const AliPHOSPhotonPairs &photons2, Int_t first, Int_t last,
+                                        Double_t *m12, Double_t *pt12, Double_t *phi12, Double_t *asym) const
+{
+  const Double_t px1 = fPx[i1];
+  const Double_t py1 = fPy[i1];
+  const Double_t pz1 = fPz[i1];
+  const Double_t e1  = fE[i1];
+
+  const Double_t *px2 = photons2.fPx.data();
+  const Double_t *py2 = photons2.fPy.data();
+  const Double_t *pz2 = photons2.fPz.data();
+  const Double_t *e2  = photons2.fE.data();
+
+  for(Int_t i2=first;i2<last;i2++){
+    const Double_t px = px1 + px2[i2];
+    const Double_t py = py1 + py2[i2];
+    const Double_t pz = pz1 + pz2[i2];
+    const Double_t e  = e1  + e2[i2];
+
+    //same operations as TLorentzVector::M(), Pt() and Phi()
+    const Double_t mm = e*e - (px*px + py*py + pz*pz);
+    m12[i2 - first]   = mm < 0. ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm);
+    pt12[i2 - first]  = TMath::Sqrt(px*px + py*py);
+    phi12[i2 - first] = (px == 0. && py == 0.) ? 0. : TMath::ATan2(py,px);
+    asym[i2 - first]  = TMath::Abs(e1 - e2[i2]) / e;
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef AliPHOSPhotonPairs_cxx
+#define AliPHOSPhotonPairs_cxx
+
+//this class holds a packed copy of the accepted photons of one event
+//(momentum, module, per-photon selection bits and efficiencies)
+//and computes the pair kinematics for blocks of pairs.
+//It is refilled for each event, the storage is reused.
+
+#include <vector>
+#include "Rtypes.h"
+
+class AliCaloPhoton;
+
+class AliPHOSPhotonPairs {
+
+  public:
+    enum PhotonFlag {
+      kTOFOK     = BIT(0),
+      kTrig      = BIT(1),
+      kActiveTRU = BIT(2)
+    };
+
+    AliPHOSPhotonPairs();
+    virtual ~AliPHOSPhotonPairs() {}
+
+    void Clear();
+    void AddPhoton(AliCaloPhoton *ph, Bool_t useCore, UInt_t flags, Double_t tofeff, Double_t trgeff);
+
+    Int_t GetSize() const {return fE.size();}
+    AliCaloPhoton *GetPhoton(Int_t i) const {return fPhoton[i];}
+    Double_t GetE(Int_t i) const {return fE[i];}
+    Int_t GetModule(Int_t i) const {return fModule[i];}
+    Bool_t HasFlag(Int_t i, UInt_t flag) const {return (fFlags[i] & flag) == flag;}
+    Double_t GetWeight(Int_t i) const {return fWeight[i];}
+    Double_t GetTOFEfficiency(Int_t i) const {return fTOFEff[i];}
+    Double_t GetTriggerEfficiency(Int_t i) const {return fTrgEff[i];}
+
+    //m, pT, phi and energy asymmetry of the pairs (i1, [first,last) of photons2),
+    //computed as with the sum of the TLorentzVector
+    void PairKinematics(Int_t i1, const AliPHOSPhotonPairs &photons2, Int_t first, Int_t last,
+                        Double_t *m12, Double_t *pt12, Double_t *phi12, Double_t *asym) const;
+
+  private:
+    std::vector<AliCaloPhoton*> fPhoton;//original photon, for the rarely used quantities
+    std::vector<Double_t> fPx;//full or core momentum
+    std::vector<Double_t> fPy;
+    std::vector<Double_t> fPz;
+    std::vector<Double_t> fE;
+    std::vector<Int_t> fModule;
+    std::vector<UInt_t> fFlags;//PhotonFlag bits
+    std::vector<Double_t> fWeight;
+    std::vector<Double_t> fTOFEff;
+    std::vector<Double_t> fTrgEff;
+
+};
+
+#endif
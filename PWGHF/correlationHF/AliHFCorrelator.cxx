@@ -91,7 +91,11 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fTrackCacheEvent(0x0),
+fCachedTracks(),
+fCachedD0(),
+fCachedWeight()
 {
 	// default constructor	
 }
@@ -142,7 +146,11 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fTrackCacheEvent(0x0),
+fCachedTracks(),
+fCachedD0(),
+fCachedWeight()
 {
 	fhadcuts = cuts;
      if(!fDMesonCutObject) AliInfo("D meson cut object not loaded - if using centrality the estimator will be V0M!");
@@ -192,7 +200,11 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fTrackCacheEvent(0x0),
+fCachedTracks(),
+fCachedD0(),
+fCachedWeight()
 {
 	fhadcuts = cuts;
     fDMesonCutObject = cutObject;
@@ -484,44 +496,64 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
   //*******************************************************
   // use reconstruction
   if(fUseReco){
-    for (Int_t iTrack=0; iTrack<nTracks; ++iTrack) {
-      AliAODTrack* track = dynamic_cast<AliAODTrack*>(inputEvent->GetTrack(iTrack));
-      if (!track) continue;
-      if(!fhadcuts->IsHadronSelected(track,&vESD,Bz)) continue; // apply ESD level selections
+    // the selection not depending on the trigger candidate (including the propagation to the DCA,
+    // which modifies the track) is done once per event; the cached tracks are reused for the other candidates
+    if(fTrackCacheEvent!=inputEvent){
+      fCachedTracks.clear();
+      fCachedD0.clear();
+      fCachedWeight.clear();
+      for (Int_t iTrack=0; iTrack<nTracks; ++iTrack) {
+        AliAODTrack* track = dynamic_cast<AliAODTrack*>(inputEvent->GetTrack(iTrack));
+        if (!track) continue;
+        if(!fhadcuts->IsHadronSelected(track,&vESD,Bz)) continue; // apply ESD level selections
+
+        Double_t pT = track->Pt();
+
+        //compute impact parameter
+        Double_t d0z0[2],covd0z0[3];
+        Double_t d0=-999999.;
+        if(fUseImpactParameter) track->PropagateToDCA(vtx,Bz,100,d0z0,covd0z0);
+        else d0z0[0] = 1. ; // random number - be careful with the cuts you applied
+
+        if(fUseImpactParameter==1) d0 = TMath::Abs(d0z0[0]); // use impact parameter
+        if(fUseImpactParameter==2) { // use impact parameter over resolution
+          if(TMath::Abs(covd0z0[0])>0.00000001) d0 = TMath::Abs(d0z0[0])/TMath::Sqrt(covd0z0[0]);
+          else d0 = -1.; // if the resoultion is Zero, rejects the track - to be on the safe side
+
+        }
+
+        if(fmontecarlo) {// THIS TO BE CHECKED
+          Int_t hadLabel = track->GetLabel();
+          if(hadLabel < 0) continue;
+        }
+
+        if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
+
+        if(fselect ==kKaon){
+          if(!fhadcuts->CheckKaonCompatibility(track,fmontecarlo,fmcArray,fPIDmode)) continue; // check if it is a Kaon - data and MC
+        }
+        weight=fhadcuts->GetTrackWeight(pT,track->Eta(),pos[2]);
+
+        fCachedTracks.push_back(track);
+        fCachedD0.push_back(d0);
+        fCachedWeight.push_back(weight);
+      } // end loop on tracks
+      fTrackCacheEvent = inputEvent;
+    }
+
+    for (UInt_t iCached=0; iCached<fCachedTracks.size(); ++iCached) {
+      AliAODTrack* track = fCachedTracks[iCached];
       if(!fhadcuts->Charge(fDCharge,track)) continue; // apply selection on charge, if required
 
       Double_t pT = track->Pt();
-      
-      //compute impact parameter
-      Double_t d0z0[2],covd0z0[3];
-      Double_t d0=-999999.;
-      if(fUseImpactParameter) track->PropagateToDCA(vtx,Bz,100,d0z0,covd0z0);
-      else d0z0[0] = 1. ; // random number - be careful with the cuts you applied
-      
-      if(fUseImpactParameter==1) d0 = TMath::Abs(d0z0[0]); // use impact parameter
-      if(fUseImpactParameter==2) { // use impact parameter over resolution
-	if(TMath::Abs(covd0z0[0])>0.00000001) d0 = TMath::Abs(d0z0[0])/TMath::Sqrt(covd0z0[0]); 
-	else d0 = -1.; // if the resoultion is Zero, rejects the track - to be on the safe side
-	
-      }
-      
-      if(fmontecarlo) {// THIS TO BE CHECKED
-        Int_t hadLabel = track->GetLabel();
-	if(hadLabel < 0) continue;	
-      }
-      
-      if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
+      Double_t d0 = fCachedD0[iCached];
+      weight = fCachedWeight[iCached];
       Bool_t rejectsoftpi = kTRUE;// TO BE CHECKED: DO WE WANT IT TO kTRUE AS A DEFAULT?
       if(fD0cand && !fmixing) rejectsoftpi = fhadcuts->InvMassDstarRejection(fD0cand,track,fhypD0); // TO BE CHECKED: WHY NOT FOR EM?
-      
-      
-      if(fselect ==kKaon){	
-	if(!fhadcuts->CheckKaonCompatibility(track,fmontecarlo,fmcArray,fPIDmode)) continue; // check if it is a Kaon - data and MC
-      }
-      weight=fhadcuts->GetTrackWeight(pT,track->Eta(),pos[2]);
+
       if(fStoreInfoSoftPiME) tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,rejectsoftpi,track->Charge(),weight,track->Px(),track->Py(),track->Pz(),track->E(0.1396)));
       else tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,rejectsoftpi,track->Charge(),weight));
-    } // end loop on tracks
+    } // end loop on cached tracks
   } // end if use reconstruction kTRUE
   
   //*******************************************************
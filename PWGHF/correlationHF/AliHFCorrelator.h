@@ -30,6 +30,8 @@
 
 /* $Id: AliHFCorrelator.h 63605 2013-07-19 13:08:41Z arossi $ */
 
+#include <vector>
+
 #include "AliHFAssociatedTrackCuts.h"
 #include "AliEventPoolManager.h"
 #include "AliVParticle.h"
@@ -75,7 +77,7 @@ class AliHFCorrelator : public TNamed
 	
 	
 	void SetAssociatedParticleType(Int_t type){fselect = type;}
-	void SetAODEvent(AliAODEvent* inputevent){fAODEvent = inputevent;}
+	void SetAODEvent(AliAODEvent* inputevent){fAODEvent = inputevent; fTrackCacheEvent = 0x0;}
 	void SetMCArray(TClonesArray* mcArray){fmcArray = mcArray;}
 	void SetUseMC(Bool_t useMC){fmontecarlo = useMC;}
 	void SetApplyDisplacementCut(Int_t applycut){fUseImpactParameter = applycut;}
@@ -176,7 +178,12 @@ class AliHFCorrelator : public TNamed
 
     Bool_t fStoreInfoSoftPiME; //save info on px, py, pz, E to use soft-pi cut in ME online analysis
 
-	ClassDef(AliHFCorrelator,4); // class for HF correlations
+	AliAODEvent* fTrackCacheEvent; //! event the cached track selection below was built for
+	std::vector<AliAODTrack*> fCachedTracks; //! tracks passing the candidate-independent selection
+	std::vector<Double_t> fCachedD0; //! impact parameter of the cached tracks
+	std::vector<Double_t> fCachedWeight; //! efficiency weight of the cached tracks
+
+	ClassDef(AliHFCorrelator,5); // class for HF correlations
 };
 
 
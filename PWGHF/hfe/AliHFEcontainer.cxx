@@ -20,6 +20,7 @@
 // Author:
 //   Markus Fasel <M.Fasel@gsi.de>
 //
+#include <cstring>
 #include <iostream>
 #include <TAxis.h>
 #include <TClass.h>
@@ -46,7 +47,8 @@ AliHFEcontainer::AliHFEcontainer():
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(0),
-  fNEvents(0)
+  fNEvents(0),
+  fStepCache(NULL)
 {
   //
   // Default constructor
@@ -60,7 +62,8 @@ AliHFEcontainer::AliHFEcontainer(const Char_t *name):
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(0),
-  fNEvents(0)
+  fNEvents(0),
+  fStepCache(NULL)
 {
   //
   // Default constructor
@@ -76,7 +79,8 @@ AliHFEcontainer::AliHFEcontainer(const Char_t *name, UInt_t nVar):
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(0),
-  fNEvents(0)
+  fNEvents(0),
+  fStepCache(NULL)
 {
   //
   // Constructor
@@ -94,7 +98,8 @@ AliHFEcontainer::AliHFEcontainer(const AliHFEcontainer &ref):
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(ref.fNVars),
-  fNEvents(ref.fNEvents)
+  fNEvents(ref.fNEvents),
+  fStepCache(NULL)
 {
   //
   // Copy constructor
@@ -136,6 +141,7 @@ AliHFEcontainer &AliHFEcontainer::operator=(const AliHFEcontainer &ref){
   if(this == &ref) return *this;
   this->~AliHFEcontainer(); // cleanup old object before creating the new onwe
   TNamed::operator=(ref);
+  fStepCache = NULL;
   fContainers = new THashList();
   fCorrelationMatrices = NULL;
   fNVars = ref.fNVars;
@@ -179,6 +185,7 @@ AliHFEcontainer::~AliHFEcontainer(){
   //
   delete fContainers;
   if(fCorrelationMatrices) delete fCorrelationMatrices;
+  delete fStepCache;
   if(fVariables){
     fVariables->Delete();
     delete fVariables;
@@ -332,21 +339,38 @@ void AliHFEcontainer::FillCFContainerStepname(const Char_t *name, const Char_t *
   //
   // Fill container
   //
-  AliCFContainer *cont = GetCFContainer(name);
-  if(!cont) return;
-  // find the matching step title
+  // resolve (container, step) once, the cached step is only taken if its title still matches
+  AliCFContainer *cont = NULL;
   Int_t mystep = -1;
-  for(Int_t istep = 0; istep < cont->GetNStep(); istep++){
-    TString tstept = cont->GetStepTitle(istep);
-    if(!tstept.CompareTo(steptitle)){
-      mystep = istep;
-      break;
+  std::string key;
+  if(steptitle){
+    key = name ? name : "";
+    key += '\n';
+    key += steptitle;
+    if(!fStepCache) fStepCache = new std::map<std::string, std::pair<AliCFContainer *, Int_t> >;
+    std::map<std::string, std::pair<AliCFContainer *, Int_t> >::const_iterator cached = fStepCache->find(key);
+    if(cached != fStepCache->end() && !strcmp(cached->second.first->GetStepTitle(cached->second.second), steptitle)){
+      cont = cached->second.first;
+      mystep = cached->second.second;
     }
   }
-  if(mystep < 0){
-    // step not found
-    AliDebug(1, Form("Step %s not found in container %s", steptitle, name));
-    return;
+  if(!cont){
+    cont = GetCFContainer(name);
+    if(!cont) return;
+    // find the matching step title
+    for(Int_t istep = 0; istep < cont->GetNStep(); istep++){
+      TString tstept = cont->GetStepTitle(istep);
+      if(!tstept.CompareTo(steptitle)){
+        mystep = istep;
+        break;
+      }
+    }
+    if(mystep < 0){
+      // step not found
+      AliDebug(1, Form("Step %s not found in container %s", steptitle, name));
+      return;
+    }
+    if(steptitle) (*fStepCache)[key] = std::make_pair(cont, mystep);
   }
   AliDebug(1, Form("Filling step %s(%d) for container %s", steptitle, mystep, name));
   cont->Fill(content, mystep, weight);
@@ -32,6 +32,10 @@
 #include <TArrayD.h>
 #endif
 
+#include <map>
+#include <string>
+#include <utility>
+
 class TArrayF;
 template <class X>
 class THnSparseT;
@@ -102,8 +106,9 @@ class AliHFEcontainer : public TNamed{
     TObjArray *fVariables;      // Variable Information
     UInt_t fNVars;              // Number of Variables
     Int_t fNEvents;             // Number of Events
+    mutable std::map<std::string, std::pair<AliCFContainer *, Int_t> > *fStepCache; //! (container, step) by container name and step title, filled on demand
 
-    ClassDef(AliHFEcontainer, 1)  // HFE Efficiency Container
+    ClassDef(AliHFEcontainer, 2)  // HFE Efficiency Container
 };
 
 //__________________________________________________________________
@@ -251,6 +251,17 @@ Bool_t AliHFEpid::IsSelected(const AliHFEpidObject * const track, AliHFEcontaine
   //
   Bool_t isSelected = kTRUE;
   AliDebug(1, Form("Particle used for PID, QA available: %s", pidqa ? "Yes" : "No"));
+  // container names and correlation matrix do not depend on the detector, resolve them once per track
+  Bool_t fillSteps = fVarManager && cont && fVarManager->IsSignalTrack();
+  TString reccontname, mccontname;
+  THnSparseF *correlationTOF = NULL;
+  if(fillSteps){
+    reccontname = contname; reccontname += "Reco";
+    if(HasMCData()){
+      mccontname = contname; mccontname += "MC";
+      correlationTOF = cont->GetCorrelationMatrix("correlationstepafterTOF");
+    }
+  }
   for(UInt_t idet = 0; idet < fNPIDdetectors; idet++){
     AliDebug(2, Form("Using Detector %s\n", SortedDetectorName(idet)));
     if(TMath::Abs(fDetectorPID[fSortedOrder[idet]]->IsSelected(track, pidqa)) != 11){
@@ -258,24 +269,15 @@ Bool_t AliHFEpid::IsSelected(const AliHFEpidObject * const track, AliHFEcontaine
       break;
     }
     AliDebug(2, "Particlae selected by detector");
-    if(fVarManager && cont){
-      TString reccontname = contname; reccontname += "Reco";
+    if(fillSteps){
       AliDebug(2, Form("Filling container %s", reccontname.Data()));
-      if(fVarManager->IsSignalTrack())
-        fVarManager->FillContainerStepname(cont, reccontname.Data(), SortedDetectorName(idet));
+      fVarManager->FillContainerStepname(cont, reccontname.Data(), SortedDetectorName(idet));
       if(HasMCData()){
-        TString mccontname = contname; mccontname += "MC";
         AliDebug(2, Form("MC Information available, Filling container %s", mccontname.Data()));
-        if(fVarManager->IsSignalTrack()) {
-          fVarManager->FillContainerStepname(cont, mccontname.Data(), SortedDetectorName(idet), kTRUE);
-	        if(cont->GetCorrelationMatrix("correlationstepafterTOF")){
-	          TString tstept("TOFPID"); 
-	          if(!tstept.CompareTo(SortedDetectorName(idet))) {
-	            fVarManager->FillCorrelationMatrix(cont->GetCorrelationMatrix("correlationstepafterTOF"));
-	            //printf("Step %s\n",(const char*) SortedDetectorName(idet));
-	          }
-	        }
-	      }
+        fVarManager->FillContainerStepname(cont, mccontname.Data(), SortedDetectorName(idet), kTRUE);
+        if(correlationTOF && !strcmp(SortedDetectorName(idet), "TOFPID")) {
+          fVarManager->FillCorrelationMatrix(correlationTOF);
+        }
       }
       // The PID will NOT fill the double counting information
     }
@@ -59,6 +59,7 @@ fThresholdIP(0.008),
 fDoDeltaPtWithSignal(kFALSE),
 fDiamond(0x0),
 fVertexer(0x0),
+fVerticesWithoutTrack(),
 fDoJetProbabilityAnalysis(kFALSE),
 fDoPtRelAnalysis(0),
 fDoSelectionPtRel(0),
@@ -384,6 +385,8 @@ fUseCorrPt(kTRUE),
 fUsePicoTracks(kTRUE),
 fEnableV0GammaRejection(0),
 fV0CandidateArray(0x0),
+fV0DaughterIDs(),
+fV0DaughterIDsReady(kFALSE),
 fUtils(new AliAnalysisUtils()),
 fJetContainerMC(0x0),
 fJetContainerData(0x0),
@@ -433,6 +436,7 @@ fHistDispersion3Pronglf(0x0)
 		fResolutionFunctionb[i]=0x0;
 		fResolutionFunctionc[i]=0x0;
 		fResolutionFunctionlf[i]=0x0;
+		for(int k=0; k<4; k++) fResolutionNorm[k][i]=-1;
 	}
 }
 // ######################################################################################## CONSTRUCTORS
@@ -449,6 +453,7 @@ AliAnalysisTaskBJetTC::AliAnalysisTaskBJetTC(const char *name): AliAnalysisTaskE
 		fDoDeltaPtWithSignal(kFALSE),
 		fDiamond(0x0),
 		fVertexer(0x0),
+		fVerticesWithoutTrack(),
 		//Bjet Cuts
 		fTCMinTrackPt(0.5),
 		fTCMinClusTPC(80),
@@ -773,6 +778,8 @@ AliAnalysisTaskBJetTC::AliAnalysisTaskBJetTC(const char *name): AliAnalysisTaskE
 		fUsePicoTracks(kTRUE),
 		fEnableV0GammaRejection(0),
 		fV0CandidateArray(0x0),
+		fV0DaughterIDs(),
+		fV0DaughterIDsReady(kFALSE),
 		fUtils(new AliAnalysisUtils()),
 		fJetContainerMC(0x0),
 		fJetContainerData(0x0),
@@ -822,6 +829,7 @@ AliAnalysisTaskBJetTC::AliAnalysisTaskBJetTC(const char *name): AliAnalysisTaskE
 		fResolutionFunctionb[i]=0x0;
 		fResolutionFunctionc[i]=0x0;
 		fResolutionFunctionlf[i]=0x0;
+		for(int k=0; k<4; k++) fResolutionNorm[k][i]=-1;
 	}
 }
 //#######################################
@@ -845,6 +853,7 @@ AliAnalysisTaskBJetTC::~AliAnalysisTaskBJetTC()
 	delete fRespoPID;
 	delete fUtils;
 	delete fRandom;
+	ClearVerticesWithoutTrack();
 	delete fVertexer;
 	delete fDiamond;
 }
@@ -893,6 +902,7 @@ Bool_t AliAnalysisTaskBJetTC::Run()
 	}
 
 
+	ClearVerticesWithoutTrack();
 	fVertexer = new AliVertexerTracks(fAODIn->GetMagneticField());
 	fVertexer->SetITSMode();
 	fVertexer->SetMinClusters(3);
@@ -2083,26 +2093,31 @@ Double_t AliAnalysisTaskBJetTC::CalculateTrackProb(Double_t significance, Int_t
  	 switch(jetFlavor)
 	 {
 		case 0:
-  		      trackprob = fResolutionFunctionlf[trclass]->Integral(-100,-TMath::Abs(significance))/fResolutionFunctionlf[trclass]->Integral(-100,0);
-		      break;
 		case 1:
-  		      trackprob = fResolutionFunctionlf[trclass]->Integral(-100,-TMath::Abs(significance))/fResolutionFunctionlf[trclass]->Integral(-100,0);
+  		      trackprob = ResolutionProb(fResolutionFunctionlf[trclass],fResolutionNorm[3][trclass],significance);
 		      break;
 		case 2:
-  		      trackprob = fResolutionFunctionc[trclass]->Integral(-100,-TMath::Abs(significance))/fResolutionFunctionc[trclass]->Integral(-100,0);
+  		      trackprob = ResolutionProb(fResolutionFunctionc[trclass],fResolutionNorm[2][trclass],significance);
 			break;
 		case 3:
-  		      trackprob = fResolutionFunctionb[trclass]->Integral(-100,-TMath::Abs(significance))/fResolutionFunctionb[trclass]->Integral(-100,0);
+  		      trackprob = ResolutionProb(fResolutionFunctionb[trclass],fResolutionNorm[1][trclass],significance);
 			break;
 		default:
 			break;
 	  }
   }else
-  	trackprob = fResolutionFunction[trclass]->Integral(-100,-TMath::Abs(significance))/fResolutionFunction[trclass]->Integral(-100,0);
+  	trackprob = ResolutionProb(fResolutionFunction[trclass],fResolutionNorm[0][trclass],significance);
 
   if(fMinTrackProb)  trackprob=TMath::Max(trackprob,fMinTrackProb);
   return trackprob;
 }
+// ######################################################################################## Track probability from one resolution function
+Double_t AliAnalysisTaskBJetTC::ResolutionProb(TF1 *f, Double_t &norm, Double_t significance) const
+{
+  // the normalisation does not depend on the track, it is integrated once per function
+  if(norm<0) norm = f->Integral(-100,0);
+  return f->Integral(-100,-TMath::Abs(significance))/norm;
+}
 // ######################################################################################## Jet Probability Function
 Double_t AliAnalysisTaskBJetTC::CalculateJetProb(AliEmcalJet *jet, Int_t jetFlavor)
 {
@@ -3617,27 +3632,19 @@ void AliAnalysisTaskBJetTC::UserCreateOutputObjects(){
 Bool_t AliAnalysisTaskBJetTC::CalculateTrackImpactParameter(AliAODTrack * track,double *impar, double * cov)
 {
 	AliAODVertex *vtxAODNew=0x0;
-	AliESDVertex *vtxESDNew =0x0;
+	const AliESDVertex *vtxESDNew =0x0;
 	Bool_t recalculate = kFALSE;
 	if( fPrimaryVertex->GetNContributors() < 30){
 		recalculate=kTRUE;
-		Int_t skipped[1] = {-1};
 		Int_t id = (Int_t)track->GetID();
 		if(id<0) return kFALSE;
-		skipped[0] = id;
-		fVertexer->SetSkipTracks(1,skipped);
-		vtxESDNew = fVertexer->FindPrimaryVertex(fAODIn);
+		vtxESDNew = GetVertexWithoutTrack(id);
 		if(!vtxESDNew) return kFALSE;
-		if(vtxESDNew->GetNContributors()<=0) {
-			delete vtxESDNew; vtxESDNew=NULL;
-			return kFALSE;
-		}
 		// convert to AliAODVertex
 		Double_t pos[3],cova[6],chi2perNDF;
 		vtxESDNew->GetXYZ(pos); // position
 		vtxESDNew->GetCovMatrix(cova); //covariance matrix
 		chi2perNDF = vtxESDNew->GetChi2toNDF();
-		delete vtxESDNew; vtxESDNew=NULL;
 		vtxAODNew = new AliAODVertex(pos,cova,chi2perNDF);
 	}
 	// Calculate Impact Parameters
@@ -3699,17 +3706,10 @@ Bool_t AliAnalysisTaskBJetTC::CalculateTrackImpactParameterTruth(AliAODTrack * t
 
 Bool_t AliAnalysisTaskBJetTC::CalculateJetSignedTrackImpactParameter(AliAODTrack * track,AliEmcalJet * jet ,double *impar, double * cov, double &sign, double &dcajetrack, double &lineardecaylength){
 
-	Int_t skipped[1] = {-1};
 	Int_t id = (Int_t)track->GetID();
 	if(id<0) return kFALSE;
-	skipped[0] = id;
-	fVertexer->SetSkipTracks(1,skipped);
-	AliESDVertex *vtxESDNew = fVertexer->FindPrimaryVertex(fAODIn);
+	const AliESDVertex *vtxESDNew = GetVertexWithoutTrack(id);
 	if(!vtxESDNew) return kFALSE;
-	if(vtxESDNew->GetNContributors()<=0) {
-		vtxESDNew=NULL; delete vtxESDNew; 
-		return kFALSE;
-	}
 	// convert to AliAODVertex
 	Double_t pos[3],cova[6],chi2perNDF;
 	vtxESDNew->GetXYZ(pos); // position
@@ -3753,15 +3753,36 @@ Bool_t AliAnalysisTaskBJetTC::CalculateJetSignedTrackImpactParameter(AliAODTrack
 						(xyzb[1] - xyz[1]) * (xyzb[1] - xyz[1]) +
 						(xyzb[2] - xyz[2]) * (xyzb[2] - xyz[2]));
 		if(bdecaylength>0) lineardecaylength=bdecaylength;
-		delete vtxESDNew;
 		return kTRUE;
 	}
 	else{
-		delete vtxESDNew;
 		return kFALSE;
 
 	}
 }
+// ######################################################################################## Primary vertex without a given track
+const AliESDVertex *AliAnalysisTaskBJetTC::GetVertexWithoutTrack(Int_t id)
+{
+	// The refit only depends on the event and the skipped track: it is done once per track
+	// and event, a track shared by several jets reuses it. Owned by the cache.
+	std::map<Int_t, AliESDVertex*>::const_iterator found = fVerticesWithoutTrack.find(id);
+	if(found != fVerticesWithoutTrack.end()) return found->second;
+
+	Int_t skipped[1] = {id};
+	fVertexer->SetSkipTracks(1,skipped);
+	AliESDVertex *vtxESDNew = fVertexer->FindPrimaryVertex(fAODIn);
+	if(vtxESDNew && vtxESDNew->GetNContributors()<=0) {
+		delete vtxESDNew; vtxESDNew=NULL;
+	}
+	fVerticesWithoutTrack[id] = vtxESDNew;
+	return vtxESDNew;
+}
+// ######################################################################################## Reset the refitted vertices of the previous event
+void AliAnalysisTaskBJetTC::ClearVerticesWithoutTrack()
+{
+	for(std::map<Int_t, AliESDVertex*>::iterator it = fVerticesWithoutTrack.begin(); it != fVerticesWithoutTrack.end(); ++it) delete it->second;
+	fVerticesWithoutTrack.clear();
+}
 // ######################################################################################## Post-process ImpPar
 Double_t AliAnalysisTaskBJetTC::GetValImpactParameter(TTypeImpPar type,double *impar, double * cov)
 {
@@ -4063,29 +4084,23 @@ Bool_t AliAnalysisTaskBJetTC::IsV0PhotonFromBeamPipeDaughter(const AliAODTrack*
 Bool_t AliAnalysisTaskBJetTC::IsV0Daughter(const AliAODTrack* track)
 {
 	if(!track)return kFALSE;
-	AliAODv0* v0aod = 0x0;
-	int posid = -1;
-	int negid = -1;
-	int trackid = -1;
-
 
 	if(!fV0CandidateArray) {cout<<"No V0 Candidates \n"; return kFALSE;}
-	
-	for(int i = 0; i < fV0CandidateArray->GetEntriesFast(); ++i) {
-
-		v0aod = dynamic_cast<AliAODv0*>(fV0CandidateArray->At(i));
-		if(!v0aod) continue;
 
-		posid = v0aod->GetPosID();
-		negid = v0aod->GetNegID();
-		trackid = track->GetID();
-
-		if(posid == trackid || negid == trackid) {return kTRUE; }
+	// the daughter IDs of the candidates are collected once per event and searched for each track
+	if(!fV0DaughterIDsReady){
+		fV0DaughterIDs.clear();
+		for(int i = 0; i < fV0CandidateArray->GetEntriesFast(); ++i) {
+			AliAODv0* v0aod = dynamic_cast<AliAODv0*>(fV0CandidateArray->At(i));
+			if(!v0aod) continue;
+			fV0DaughterIDs.push_back(v0aod->GetPosID());
+			fV0DaughterIDs.push_back(v0aod->GetNegID());
+		}
+		std::sort(fV0DaughterIDs.begin(), fV0DaughterIDs.end());
+		fV0DaughterIDsReady = kTRUE;
 	}
 
-
-
-	return kFALSE;
+	return std::binary_search(fV0DaughterIDs.begin(), fV0DaughterIDs.end(), (int)track->GetID());
 }
 //=============================================================================
 Bool_t AliAnalysisTaskBJetTC::SelectV0CandidateVIT()
@@ -4100,6 +4115,7 @@ Bool_t AliAnalysisTaskBJetTC::SelectV0CandidateVIT()
   Int_t iNV0CandALambda = 0; // counter of Lambda candidates at the end
 
   fV0CandidateArray->Delete();//Reset the TClonesArray
+  fV0DaughterIDsReady = kFALSE;
 
 
 
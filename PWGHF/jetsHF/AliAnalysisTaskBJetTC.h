@@ -1,5 +1,7 @@
 #ifndef ALIANALYSISTASKBJETTC_H
 #define ALIANALYSISTASKBJETTC_H
+#include <map>
+#include <vector>
 #include "AliAnalysisTaskEmcalJet.h"
 #include "AliV0ReaderV1.h"
 #include "AliConvEventCuts.h"
@@ -21,6 +23,7 @@ class AliPIDResponse;
 class AliHFJetsTaggingVertex;
 class AliRDHFJetsCutsVertex;
 class AliVertexerTracks;
+class AliESDVertex;
 
 
 
@@ -90,18 +93,22 @@ public:
 
 	Bool_t SetResFunction(TF1 *f, Int_t j){
 	    fResolutionFunction[j] = f;
+	    fResolutionNorm[0][j] = -1;
 	    return kTRUE;
 	}
 	Bool_t SetResFunctionb(TF1 *f, Int_t j){
 	    fResolutionFunctionb[j] = f;
+	    fResolutionNorm[1][j] = -1;
 	    return kTRUE;
 	}
 	Bool_t SetResFunctionc(TF1 *f, Int_t j){
 	    fResolutionFunctionc[j] = f;
+	    fResolutionNorm[2][j] = -1;
 	    return kTRUE;
 	}
 	Bool_t SetResFunctionlf(TF1 *f, Int_t j){
 	    fResolutionFunctionlf[j] = f;
+	    fResolutionNorm[3][j] = -1;
 	    return kTRUE;
 	}
 
@@ -149,6 +156,8 @@ private:
 	Bool_t CalculateTrackImpactParameter(AliAODTrack * track,double *impar, double * cov); // Removes track from Vertex calculation first
 	Bool_t CalculateTrackImpactParameterTruth(AliAODTrack * track,double *impar, double * cov); // calculates DCA on MC particle/event information
 	Bool_t CalculateJetSignedTrackImpactParameter(AliAODTrack * track,AliEmcalJet * jet ,double *impar, double * cov, double &sign, double &dcajetrack, double &lineardecaylength);
+	const AliESDVertex *GetVertexWithoutTrack(Int_t id); // primary vertex refitted without the track, cached per event
+	void ClearVerticesWithoutTrack();
 	Double_t GetValImpactParameter(TTypeImpPar type,double *impar, double * cov);
 	Bool_t IsV0PhotonFromBeamPipeDaughter(const AliAODTrack* track);
 	Bool_t IsV0Daughter(const AliAODTrack* track);
@@ -161,6 +170,7 @@ private:
 	void   SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, int matching=0); //jet matching function 3/4
 	void   GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const; //jet matching function 4/4
   	Double_t CalculateTrackProb(Double_t significance, Int_t trclass, Int_t jetFlavor);
+  	Double_t ResolutionProb(TF1 *f, Double_t &norm, Double_t significance) const;
   	Double_t CalculateJetProb(AliEmcalJet * jet, Int_t jetFlavor);//!
   	void FillResolutionFunctionHists(AliAODTrack * track,AliEmcalJet * jet, Int_t jetFlavor);
 
@@ -182,6 +192,7 @@ private:
 
 	AliESDVertex* fDiamond;//!
 	AliVertexerTracks *fVertexer;//!
+	std::map<Int_t, AliESDVertex*> fVerticesWithoutTrack;//! refitted vertices of the event by skipped track ID, NULL if the refit failed
 
   	AliPIDResponse   *fRespoPID;//!
 
@@ -597,6 +608,8 @@ private:
   Bool_t fApplyV0RejectionAll;//
 
   TClonesArray* fV0CandidateArray;//!
+  std::vector<Int_t> fV0DaughterIDs;//! sorted IDs of the daughters of fV0CandidateArray
+  Bool_t fV0DaughterIDsReady;//! fV0DaughterIDs is filled for the current candidates
   AliJetContainer       *fJetContainerMC;  //! Container with reconstructed jets
   AliJetContainer       *fJetContainerData;//! Container with reconstructed jets
   AliAODEvent*		fAODIn;//! AOD Input Event
@@ -606,6 +619,7 @@ private:
   TF1* fResolutionFunctionb[7];//
   TF1* fResolutionFunctionc[7];//
   TF1* fResolutionFunctionlf[7];//
+  Double_t fResolutionNorm[4][7];//! integral of the resolution functions (inclusive, b, c, lf) from -100 to 0, -1 if not computed
 
   //Secondary Vertex
   Bool_t fDoSVAnalysis;//
@@ -658,7 +672,7 @@ private:
   static const Double_t fgkMassProton;  //
   static const Int_t fgkiNCategV0 = 18; // number of V0 selection steps
 
-	ClassDef(AliAnalysisTaskBJetTC, 57)
+	ClassDef(AliAnalysisTaskBJetTC, 60)
 };
 #endif
  //
@@ -78,6 +78,7 @@
 #include "AliRhoParameter.h"
 #include "AliAnalysisTaskSEHFTreeCreator.h"
 #include "AliAODPidHF.h"
+#include "AliHFBoostedTrees.h"
 
 using std::cout;
 using std::endl;
@@ -197,7 +198,11 @@ fFillpTD(false),
 fFillMass(false),
 fFillMatchingJetID(false),
 fEnableNsigmaTPCDataCorr(false),
-fSystemForNsigmaTPCDataCorr(AliAODPidHF::kNone)
+fSystemForNsigmaTPCDataCorr(AliAODPidHF::kNone),
+fMLModelFile(),
+fMLMinScore(),
+fMLBkgPrescale(),
+fMLModel()
 {
 
 /// Default constructor
@@ -316,7 +321,11 @@ fFillpTD(false),
 fFillMass(false),
 fFillMatchingJetID(false),
 fEnableNsigmaTPCDataCorr(false),
-fSystemForNsigmaTPCDataCorr(AliAODPidHF::kNone)
+fSystemForNsigmaTPCDataCorr(AliAODPidHF::kNone),
+fMLModelFile(),
+fMLMinScore(),
+fMLBkgPrescale(),
+fMLModel()
 {
     /// Standard constructor
   
@@ -526,6 +535,12 @@ AliAnalysisTaskSEHFTreeCreator::~AliAnalysisTaskSEHFTreeCreator()
       delete fEvSelectionCuts;
       fEvSelectionCuts = 0x0;
     }
+    for(Int_t i=0; i<kNMLTrees; i++) {
+      if (fMLModel[i]) {
+        delete fMLModel[i];
+        fMLModel[i] = 0x0;
+      }
+    }
     if (fNentries){
         delete fNentries;
         fNentries = 0x0;
@@ -608,6 +623,20 @@ AliAnalysisTaskSEHFTreeCreator::~AliAnalysisTaskSEHFTreeCreator()
     
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSEHFTreeCreator::ConfigureMLSelection(AliHFTreeHandler* handler, Int_t tree)
+{
+    /// Load the ML model of the tree, if any, and pass it to the tree handler
+
+    if(!handler || fMLModelFile[tree].Length()==0) return;
+    if(fMLModel[tree]) delete fMLModel[tree];
+    fMLModel[tree] = AliHFBoostedTrees::LoadModel(fMLModelFile[tree]);
+    if(!fMLModel[tree]) {
+        AliFatal(Form("ML model %s could not be loaded",fMLModelFile[tree].Data()));
+        return;
+    }
+    handler->SetMLSelection(fMLModel[tree],fMLMinScore[tree],fMLBkgPrescale[tree]);
+}
 //________________________________________________________________________
 void AliAnalysisTaskSEHFTreeCreator::Init()
 {
@@ -728,6 +757,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fReadMC && fWriteOnlySignal) fTreeHandlerD0->SetFillOnlySignal(fWriteOnlySignal);
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerD0->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fVariablesTreeD0 = (TTree*)fTreeHandlerD0->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerD0,kMLD0);
         fVariablesTreeD0->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeD0);
       
@@ -749,6 +779,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerDs->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fTreeHandlerDs->SetMassKKOption(fDsMassKKOpt);
         fVariablesTreeDs = (TTree*)fTreeHandlerDs->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerDs,kMLDs);
         fVariablesTreeDs->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeDs);
       
@@ -769,6 +800,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fReadMC && fWriteOnlySignal) fTreeHandlerDplus->SetFillOnlySignal(fWriteOnlySignal);
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerDplus->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fVariablesTreeDplus = (TTree*)fTreeHandlerDplus->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerDplus,kMLDplus);
         fVariablesTreeDplus->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeDplus);
       if(fFillMCGenTrees && fReadMC) {
@@ -788,6 +820,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fReadMC && fWriteOnlySignal) fTreeHandlerLctopKpi->SetFillOnlySignal(fWriteOnlySignal);
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerLctopKpi->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fVariablesTreeLctopKpi = (TTree*)fTreeHandlerLctopKpi->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerLctopKpi,kMLLctopKpi);
         fVariablesTreeLctopKpi->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeLctopKpi);
       if(fFillMCGenTrees && fReadMC) {
@@ -807,6 +840,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fReadMC && fWriteOnlySignal) fTreeHandlerBplus->SetFillOnlySignal(fWriteOnlySignal);
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerBplus->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fVariablesTreeBplus = (TTree*)fTreeHandlerBplus->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerBplus,kMLBplus);
         fVariablesTreeBplus->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeBplus);
         if(fFillMCGenTrees && fReadMC) {
@@ -826,6 +860,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fReadMC && fWriteOnlySignal) fTreeHandlerDstar->SetFillOnlySignal(fWriteOnlySignal);
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerDstar->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fVariablesTreeDstar = (TTree*)fTreeHandlerDstar->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerDstar,kMLDstar);
         fVariablesTreeDstar->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeDstar);
         if(fFillMCGenTrees && fReadMC) {
@@ -846,6 +881,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
         if(fEnableNsigmaTPCDataCorr) fTreeHandlerLc2V0bachelor->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
         fTreeHandlerLc2V0bachelor->SetCalcSecoVtx(fLc2V0bachelorCalcSecoVtx);
         fVariablesTreeLc2V0bachelor = (TTree*)fTreeHandlerLc2V0bachelor->BuildTree(nameoutput,nameoutput);
+        ConfigureMLSelection(fTreeHandlerLc2V0bachelor,kMLLc2V0bachelor);
         fVariablesTreeLc2V0bachelor->SetMaxVirtualSize(1.e+8/nEnabledTrees);
         fTreeEvChar->AddFriend(fVariablesTreeLc2V0bachelor);
         if(fFillMCGenTrees && fReadMC) {
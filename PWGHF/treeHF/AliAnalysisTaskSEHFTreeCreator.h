@@ -54,6 +54,7 @@ class AliAODEvent;
 class TClonesArray;
 class AliEmcalJet;
 class AliRhoParameter;
+class AliHFBoostedTrees;
 
 class AliAnalysisTaskSEHFTreeCreator : public AliAnalysisTaskSE
 {
@@ -112,6 +113,16 @@ public:
     void SetLc2V0bachelorCalcSecoVtx(Int_t opt=1) {fLc2V0bachelorCalcSecoVtx=opt;}
   
     void SetTreeSingleTrackVarsOpt(Int_t opt) {fTreeSingleTrackVarsOpt=opt;}
+
+    /// ML selection of the candidates stored in the trees: only candidates with a score of the model
+    /// in modelfile above minscore are written, plus one every bkgprescale rejected ones
+    enum mltree {kMLD0, kMLDs, kMLDplus, kMLLctopKpi, kMLBplus, kMLDstar, kMLLc2V0bachelor, kNMLTrees};
+    void SetMLSelection(Int_t tree, TString modelfile, Float_t minscore, Int_t bkgprescale=0) {
+      if(tree<0 || tree>=kNMLTrees) return;
+      fMLModelFile[tree]=modelfile;
+      fMLMinScore[tree]=minscore;
+      fMLBkgPrescale[tree]=bkgprescale;
+    }
   
     Int_t  GetSystem() const {return fSys;}
     Bool_t GetWriteOnlySignalTree() const {return fWriteOnlySignal;}
@@ -146,6 +157,7 @@ private:
     
     AliAnalysisTaskSEHFTreeCreator(const AliAnalysisTaskSEHFTreeCreator&);
     AliAnalysisTaskSEHFTreeCreator& operator=(const AliAnalysisTaskSEHFTreeCreator&);
+    void ConfigureMLSelection(AliHFTreeHandler* handler, Int_t tree);
     
     
     unsigned int            fEventNumber;
@@ -294,8 +306,13 @@ private:
     bool fEnableNsigmaTPCDataCorr; /// flag to enable data-driven NsigmaTPC correction
     int fSystemForNsigmaTPCDataCorr; /// system for data-driven NsigmaTPC correction
 
+    TString fMLModelFile[kNMLTrees]; /// file with the ML model selecting the candidates of each tree (empty: no ML selection)
+    Float_t fMLMinScore[kNMLTrees]; /// minimum ML score of the stored candidates
+    Int_t fMLBkgPrescale[kNMLTrees]; /// prescale of the candidates rejected by the ML selection (0: none stored)
+    AliHFBoostedTrees* fMLModel[kNMLTrees]; //!<! ML models
+
     /// \cond CLASSIMP
-    ClassDef(AliAnalysisTaskSEHFTreeCreator,13);
+    ClassDef(AliAnalysisTaskSEHFTreeCreator,14);
     /// \endcond
 };
 
@@ -28,6 +28,10 @@
 #include "AliESDtrack.h"
 #include "TMath.h"
 #include "AliAODPidHF.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "AliHFBoostedTrees.h"
+#include "TRegexp.h"
 
 using std::array;
 
@@ -70,7 +74,21 @@ AliHFTreeHandler::AliHFTreeHandler():
   fSigmaNsigmaTPCKaonData{},
   fSigmaNsigmaTPCProtonData{},
   fPlimitsNsigmaTPCDataCorr{},
-  fNPbinsNsigmaTPCDataCorr(0)
+  fNPbinsNsigmaTPCDataCorr(0),
+  fAutoFlush(0),
+  fBasketSize(0),
+  fBranchCompression(),
+  fNbitsPID(0),
+  fUseScorePreselection(false),
+  fMinScore(0.),
+  fTreeOptApplied(nullptr),
+  fMLModel(nullptr),
+  fMLMinScore(0.),
+  fMLBkgPrescale(0),
+  fMLNRejected(0),
+  fMLScore(-9999.),
+  fMLLeaves(),
+  fMLFeatures()
 {
   //
   // Default constructor
@@ -146,7 +164,21 @@ AliHFTreeHandler::AliHFTreeHandler(int PIDopt):
   fSigmaNsigmaTPCKaonData{},
   fSigmaNsigmaTPCProtonData{},
   fPlimitsNsigmaTPCDataCorr{},
-  fNPbinsNsigmaTPCDataCorr(0)
+  fNPbinsNsigmaTPCDataCorr(0),
+  fAutoFlush(0),
+  fBasketSize(0),
+  fBranchCompression(),
+  fNbitsPID(0),
+  fUseScorePreselection(false),
+  fMinScore(0.),
+  fTreeOptApplied(nullptr),
+  fMLModel(nullptr),
+  fMLMinScore(0.),
+  fMLBkgPrescale(0),
+  fMLNRejected(0),
+  fMLScore(-9999.),
+  fMLLeaves(),
+  fMLFeatures()
 {
   //
   // Standard constructor
@@ -308,7 +340,7 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
         if(!useDet[iDet]) continue;
         for(unsigned int iPartHypo=0; iPartHypo<knMaxHypo4Pid; iPartHypo++) {
           if(!useHypo[iPartHypo]) continue;
-          if(fPidOpt==kNsigmaPID || fPidOpt==kNsigmaPIDfloatandint || fPidOpt==kRawAndNsigmaPID) fTreeVar->Branch(Form("nsig%s_%s_%d",detName[iDet].Data(),partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][iDet][iPartHypo]);
+          if(fPidOpt==kNsigmaPID || fPidOpt==kNsigmaPIDfloatandint || fPidOpt==kRawAndNsigmaPID) AddFloatBranch(Form("nsig%s_%s_%d",detName[iDet].Data(),partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][iDet][iPartHypo],fNbitsPID);
           if(fPidOpt==kNsigmaPIDint || fPidOpt==kNsigmaPIDfloatandint) fTreeVar->Branch(Form("nsig%s_%s_%d",detName[iDet].Data(),partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaIntVector[iProng][iDet][iPartHypo]);
         }
       }
@@ -316,14 +348,14 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
     if(fPidOpt>=kNsigmaCombPID && fPidOpt<=kNsigmaCombPIDfloatandint) {
       for(unsigned int iPartHypo=0; iPartHypo<knMaxHypo4Pid; iPartHypo++) {
         if(!useHypo[iPartHypo]) continue;
-        if(fPidOpt==kNsigmaCombPID || fPidOpt==kNsigmaCombPIDfloatandint) fTreeVar->Branch(Form("nsigComb_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][0][iPartHypo]);
+        if(fPidOpt==kNsigmaCombPID || fPidOpt==kNsigmaCombPIDfloatandint) AddFloatBranch(Form("nsigComb_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaVector[iProng][0][iPartHypo],fNbitsPID);
         if(fPidOpt==kNsigmaCombPIDint || fPidOpt==kNsigmaCombPIDfloatandint) fTreeVar->Branch(Form("int_nsigComb_%s_%d",partHypoName[iPartHypo].Data(),iProng),&fPIDNsigmaIntVector[iProng][0][iPartHypo]);
       }
     }
     if(fPidOpt==kRawPID || fPidOpt==kRawAndNsigmaPID) {
       for(unsigned int iDet=0; iDet<knMaxDet4Pid; iDet++) {
         if(!useDet[iDet]) continue;
-        fTreeVar->Branch(Form("%s_%d",rawPidName[iDet].Data(),iProng),&fPIDrawVector[iProng][iDet]);
+        AddFloatBranch(Form("%s_%d",rawPidName[iDet].Data(),iProng),&fPIDrawVector[iProng][iDet],fNbitsPID);
       }
       if(useTPC) fTreeVar->Branch(Form("pTPC_prong%d",iProng),&fTPCPProng[iProng]);
       if(useTOF) {
@@ -335,6 +367,70 @@ void AliHFTreeHandler::AddPidBranches(bool usePionHypo, bool useKaonHypo, bool u
   }
 }
 
+//________________________________________________________________
+void AliHFTreeHandler::AddFloatBranch(TString name, float *var, int nbits)
+{
+  //add a float branch, stored as Float16_t with nbits of mantissa if nbits>0
+
+  if(nbits>0) fTreeVar->Branch(name.Data(),var,Form("%s/f[0,0,%d]",name.Data(),nbits));
+  else fTreeVar->Branch(name.Data(),var);
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::ApplyOutputOptions()
+{
+  //apply autoflush, basket size and per-branch compression settings to the tree
+
+  fTreeOptApplied=fTreeVar;
+  if(fMLModel) {
+    const std::vector<std::string> &features = fMLModel->GetFeatureNames();
+    fMLLeaves.clear();
+    for(auto &name : features) {
+      TLeaf* leaf=fTreeVar->GetLeaf(name.c_str());
+      if(!leaf) {
+        AliError(Form("Variable %s of the ML model not in the tree, ML selection disabled",name.c_str()));
+        fMLModel=nullptr;
+        fMLLeaves.clear();
+        break;
+      }
+      fMLLeaves.push_back(leaf);
+    }
+    fMLFeatures.resize(fMLLeaves.size());
+    if(fMLModel) fTreeVar->Branch("ml_score",&fMLScore);
+  }
+  if(fAutoFlush!=0) fTreeVar->SetAutoFlush(fAutoFlush);
+  if(fBasketSize>0) fTreeVar->SetBasketSize("*",fBasketSize);
+  if(fBranchCompression.empty()) return;
+
+  TIter next(fTreeVar->GetListOfBranches());
+  TBranch* br=nullptr;
+  while((br=(TBranch*)next())) {
+    TString brname=br->GetName();
+    for(auto &comp : fBranchCompression) {
+      TRegexp re(comp.first,kTRUE);
+      Ssiz_t len=0;
+      if(re.Index(brname,&len)==0 && len==brname.Length()) br->SetCompressionSettings(comp.second);
+    }
+  }
+}
+
+//________________________________________________________________
+bool AliHFTreeHandler::PassMLSelection()
+{
+  //evaluate the ML model on the current candidate variables
+
+  for(size_t iFeat=0; iFeat<fMLLeaves.size(); iFeat++) fMLFeatures[iFeat]=fMLLeaves[iFeat]->GetValue();
+  fMLScore=fMLModel->Evaluate(fMLFeatures.data());
+  if(fMLScore>=fMLMinScore) return true;
+
+  fMLNRejected++;
+  if(fMLBkgPrescale>0 && fMLNRejected%fMLBkgPrescale==0) {
+    fCandType |= kMLPrescaled;
+    return true;
+  }
+  return false;
+}
+
 //________________________________________________________________
 bool AliHFTreeHandler::SetSingleTrackVars(AliAODTrack* prongtracks[]) {
 
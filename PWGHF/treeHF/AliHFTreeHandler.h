@@ -21,12 +21,18 @@
 // G. Luparello, grazia.luparello@cern.ch
 /////////////////////////////////////////////////////////////
 
+#include <vector>
+#include <utility>
 #include <TTree.h>
+#include <TString.h>
 #include "AliAODTrack.h"
 #include "AliPIDResponse.h"
 #include "AliAODRecoDecayHF.h"
 #include "AliAODMCParticle.h"
 
+class TLeaf;
+class AliHFBoostedTrees;
+
 class AliHFTreeHandler : public TObject
 {
   public:
@@ -40,7 +46,8 @@ class AliHFTreeHandler : public TObject
       kRefl            = BIT(5),
       kSelectedTopo    = BIT(6),
       kSelectedPID     = BIT(7),
-      kSelectedTracks  = BIT(8) //up to BIT(10) included for general flags, following BITS particle-specific
+      kSelectedTracks  = BIT(8),
+      kMLPrescaled     = BIT(9) //up to BIT(10) included for general flags, following BITS particle-specific
     };
   
     enum optpid {
@@ -83,6 +90,11 @@ class AliHFTreeHandler : public TObject
         fCandType=0;
       }
       else {      
+        if(fTreeOptApplied!=fTreeVar) ApplyOutputOptions();
+        if(fMLModel && !PassMLSelection()) { //ML selection applied on the variables set for the candidate
+          fCandType=0;
+          return;
+        }
         fTreeVar->Fill(); 
         fCandType=0;
         fRunNumberPrevCand = fRunNumber;
@@ -93,6 +105,22 @@ class AliHFTreeHandler : public TObject
     void SetOptPID(int PIDopt) {fPidOpt=PIDopt;}
     void SetOptSingleTrackVars(int opt) {fSingleTrackOpt=opt;}
     void SetFillOnlySignal(bool fillopt=true) {fFillOnlySignal=fillopt;}
+    //output options, applied to the tree at the first fill
+    void SetAutoFlush(Long64_t autof) {fAutoFlush=autof;}
+    void SetBasketSize(int size) {fBasketSize=size;}
+    void SetBranchCompression(TString pattern, int settings) {fBranchCompression.push_back(std::make_pair(pattern,settings));} //wildcard pattern of branch names, e.g. "nsig*"
+    void SetNbitsPIDVars(int nbits) {fNbitsPID=nbits;} //float PID variables stored with truncated mantissa, to be set before BuildTree
+    //candidate preselection on a score (e.g. ML output), to be checked before SetVariables
+    void SetScorePreselection(float minscore) {fUseScorePreselection=true; fMinScore=minscore;}
+    bool IsPreselected(float score) const {return !fUseScorePreselection || score>=fMinScore;}
+    //ML selection: the model is evaluated in FillTree on the branches named as its features, only candidates
+    //with score>=minscore are stored (plus one every bkgprescale rejected ones, flagged with kMLPrescaled)
+    void SetMLSelection(AliHFBoostedTrees* model, float minscore, int bkgprescale=0) {
+      fMLModel=model;
+      fMLMinScore=minscore;
+      fMLBkgPrescale=bkgprescale;
+    }
+    unsigned int GetNMLRejected() const {return fMLNRejected;}
 
     void SetCandidateType(bool issignal, bool isbkg, bool isprompt, bool isFD, bool isreflected);
     void SetIsSelectedStd(bool isselected, bool isselectedTopo, bool isselectedPID, bool isselectedTracks) {
@@ -172,6 +200,9 @@ class AliHFTreeHandler : public TObject
     float GetTOFmomentum(AliAODTrack* track, AliPIDResponse* pidrespo);
   
     void GetNsigmaTPCMeanSigmaData(float &mean, float &sigma, AliPID::EParticleType species, float pTPC);
+    void ApplyOutputOptions();
+    bool PassMLSelection();
+    void AddFloatBranch(TString name, float *var, int nbits);
 
     TTree* fTreeVar; /// tree with variables
     unsigned int fNProngs; /// number of prongs
@@ -224,9 +255,23 @@ class AliHFTreeHandler : public TObject
     float fSigmaNsigmaTPCProtonData[100]; /// array of NsigmaTPC proton mean in data 
     float fPlimitsNsigmaTPCDataCorr[101]; /// array of p limits for data-driven NsigmaTPC correction
     int fNPbinsNsigmaTPCDataCorr;/// number of p bins for data-driven NsigmaTPC correction
+    Long64_t fAutoFlush; /// autoflush of the tree (0: TTree default)
+    int fBasketSize; /// basket size of the branches (0: TTree default)
+    std::vector<std::pair<TString,int> > fBranchCompression; /// compression settings per branch name pattern
+    int fNbitsPID; /// bits of the mantissa of the float PID variables (0: full float)
+    bool fUseScorePreselection; /// flag to enable the candidate preselection on a score
+    float fMinScore; /// minimum score of the preselected candidates
+    TTree* fTreeOptApplied; //!<! tree to which the output options were applied
+    AliHFBoostedTrees* fMLModel; //!<! model for the ML selection (not owned)
+    float fMLMinScore; /// minimum ML score of the stored candidates
+    int fMLBkgPrescale; /// store one every fMLBkgPrescale candidates rejected by the ML selection (0: none)
+    unsigned int fMLNRejected; /// number of candidates rejected by the ML selection
+    float fMLScore; /// ML score of the candidate
+    std::vector<TLeaf*> fMLLeaves; //!<! leaves of the model features
+    std::vector<float> fMLFeatures; //!<! model features of the candidate
 
   /// \cond CLASSIMP
-  ClassDef(AliHFTreeHandler,6); ///
+  ClassDef(AliHFTreeHandler,7); ///
   /// \endcond
 };
 #endif
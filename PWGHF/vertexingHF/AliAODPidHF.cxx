@@ -34,13 +34,43 @@
 #include "AliAODpidUtil.h"
 #include "AliESDtrack.h"
 
+#include "AliAnalysisManager.h"
 #include "array"
+#include <unordered_map>
 using std::array;
 
 /// \cond CLASSIMP
 ClassImp(AliAODPidHF);
 /// \endcond
 
+namespace {
+  /// n sigma of one track for ITS, TPC and TOF, filled on request
+  struct NSigmaEntry {
+    const AliAODTrack* fTrack;                    ///< track the values belong to
+    UShort_t fFilled[3];                          ///< bit i set when species i is computed
+    Float_t  fNSigma[3][AliPID::kSPECIESC];       ///< raw n sigma from the PID response
+  };
+  /// n sigma of the tracks of the current event, shared by all the AliAODPidHF objects
+  struct SharedNSigmaTable {
+    SharedNSigmaTable() : fPidResponse(0x0), fEvent(0x0), fEntry(-1), fEventId(0), fTracks() {}
+    const AliPIDResponse* fPidResponse;           ///< response used to compute the values
+    const AliVEvent* fEvent;                      ///< event the values belong to
+    Long64_t fEntry;                              ///< entry of the analysis manager
+    ULong64_t fEventId;                           ///< bunch crossing and time stamp of the event
+    std::unordered_map<Int_t,NSigmaEntry> fTracks; ///< values by track ID
+  };
+  SharedNSigmaTable& GetSharedNSigmaTable() {
+    static SharedNSigmaTable table;
+    return table;
+  }
+  /// n sigma from the PID response, iDet 0 = ITS, 1 = TPC, 2 = TOF
+  Float_t ComputeNSigma(AliPIDResponse* pidResp, Int_t iDet, AliAODTrack* track, AliPID::EParticleType species) {
+    if(iDet==0) return pidResp->NumberOfSigmasITS(track,species);
+    if(iDet==1) return pidResp->NumberOfSigmasTPC(track,species);
+    return pidResp->NumberOfSigmasTOF(track,species);
+  }
+}
+
 //------------------------------
 AliAODPidHF::AliAODPidHF():
 TObject(),
@@ -93,7 +123,8 @@ fSigmaNsigmaTPCPionData{},
 fSigmaNsigmaTPCKaonData{},
 fSigmaNsigmaTPCProtonData{},
 fPlimitsNsigmaTPCDataCorr{},
-fNPbinsNsigmaTPCDataCorr(0)
+fNPbinsNsigmaTPCDataCorr(0),
+fUseSharedNSigmaTable(kFALSE)
 {
   ///
   /// Default constructor
@@ -210,7 +241,8 @@ fCombDetectors(pid.fCombDetectors),
 fUseCombined(pid.fUseCombined),
 fDefaultPriors(pid.fDefaultPriors),
 fApplyNsigmaTPCDataCorr(pid.fApplyNsigmaTPCDataCorr),
-fNPbinsNsigmaTPCDataCorr(pid.fNPbinsNsigmaTPCDataCorr)
+fNPbinsNsigmaTPCDataCorr(pid.fNPbinsNsigmaTPCDataCorr),
+fUseSharedNSigmaTable(pid.fUseSharedNSigmaTable)
 {
   
   fnSigmaCompat=new Double_t[fnNSigmaCompat];
@@ -658,7 +690,7 @@ Int_t AliAODPidHF::MatchTPCTOF(AliAODTrack *track, Int_t specie){
     
     Double_t nSigmaTPC=0.;
     if(okTPC) {
-      nSigmaTPC = fPidResponse->NumberOfSigmasTPC(track, (AliPID::EParticleType)specie);
+      nSigmaTPC = GetRawNSigma(AliPIDResponse::kTPC,track,(AliPID::EParticleType)specie);
       if(fApplyNsigmaTPCDataCorr && nSigmaTPC>-990.) { 
         Float_t mean=0., sigma=1.; 
         GetNsigmaTPCMeanSigmaData(mean, sigma, (AliPID::EParticleType)specie, track->GetTPCmomentum());
@@ -668,7 +700,7 @@ Int_t AliAODPidHF::MatchTPCTOF(AliAODTrack *track, Int_t specie){
     }
     Double_t nSigmaTOF=0.;
     if(okTOF) {
-      nSigmaTOF=fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)specie);
+      nSigmaTOF=GetRawNSigma(AliPIDResponse::kTOF,track,(AliPID::EParticleType)specie);
     }
     Int_t iPart=specie-2; //species is 2 for pions,3 for kaons and 4 for protons
     if(iPart<0 || iPart>2) return -1;
@@ -916,7 +948,7 @@ Int_t AliAODPidHF::GetnSigmaITS(AliAODTrack *track,Int_t species, Double_t &nsig
   else { // new pid
     
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaITS = fPidResponse->NumberOfSigmasITS(track,type);
+    nsigmaITS = GetRawNSigma(AliPIDResponse::kITS,track,type);
     
   } //new pid
   
@@ -946,7 +978,7 @@ Int_t AliAODPidHF::GetnSigmaTPC(AliAODTrack *track, Int_t species, Double_t &nsi
   } else{
     if(!fPidResponse) return -1;
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+    nsigmaTPC = GetRawNSigma(AliPIDResponse::kTPC,track,type);
     if(fApplyNsigmaTPCDataCorr && nsigmaTPC>-990.) {
       Float_t mean=0., sigma=1.; 
       GetNsigmaTPCMeanSigmaData(mean, sigma, type, track->GetTPCmomentum());
@@ -965,7 +997,7 @@ Int_t AliAODPidHF::GetnSigmaTOF(AliAODTrack *track,Int_t species, Double_t &nsig
   if(!CheckTOFPIDStatus(track)) return -1;
   
   if(fPidResponse){
-    nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    nsigma = GetRawNSigma(AliPIDResponse::kTOF,track,(AliPID::EParticleType)species);
     return 1;
   }else{
     AliFatal("To use TOF PID you need to attach AliPIDResponseTask");
@@ -1331,12 +1363,12 @@ Float_t AliAODPidHF::NumberOfSigmas(AliPID::EParticleType specie, AliPIDResponse
   switch (detector) {
     case AliPIDResponse::kITS:
     {
-      return fPidResponse->NumberOfSigmasITS(track, specie);
+      return GetRawNSigma(AliPIDResponse::kITS,track,specie);
       break;
     }
     case AliPIDResponse::kTPC:
     {
-      Double_t nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track, specie);
+      Double_t nsigmaTPC = GetRawNSigma(AliPIDResponse::kTPC,track,specie);
       if(fApplyNsigmaTPCDataCorr && nsigmaTPC>-990.) {
         Float_t mean=0., sigma=1.; 
         GetNsigmaTPCMeanSigmaData(mean, sigma, specie, track->GetTPCmomentum());
@@ -1347,7 +1379,7 @@ Float_t AliAODPidHF::NumberOfSigmas(AliPID::EParticleType specie, AliPIDResponse
     }
     case AliPIDResponse::kTOF:
     {
-      return fPidResponse->NumberOfSigmasTOF(track, specie);
+      return GetRawNSigma(AliPIDResponse::kTOF,track,specie);
       break;
     }
     default:
@@ -1725,4 +1757,51 @@ void AliAODPidHF::SetNsigmaTPCDataDrivenCorrection(Int_t run, Int_t system, Int_
     std::copy(sigmaKaon.begin(),sigmaKaon.end(),sigmaNsigmaTPCkaon);
     std::copy(sigmaProton.begin(),sigmaProton.end(),sigmaNsigmaTPCproton);
   }
-}
\ No newline at end of file
+}
+//------------------
+Float_t AliAODPidHF::GetRawNSigma(AliPIDResponse::EDetector detector, AliAODTrack *track, AliPID::EParticleType species) const {
+  /// n sigma from the PID response for ITS, TPC or TOF. With fUseSharedNSigmaTable the value
+  /// is computed once per event and track and then shared by all the AliAODPidHF objects
+  /// (e.g. of the different cut objects of a train); the cuts and the
+  /// data-driven corrections of each object are applied on top of it
+
+  Int_t iDet=-1;
+  if(detector==AliPIDResponse::kITS) iDet=0;
+  else if(detector==AliPIDResponse::kTPC) iDet=1;
+  else if(detector==AliPIDResponse::kTOF) iDet=2;
+  if(iDet<0) return -999.;
+
+  const AliVEvent* ev=track->GetEvent();
+  if(!fUseSharedNSigmaTable || !ev || species<0 || species>=AliPID::kSPECIESC){
+    return ComputeNSigma(fPidResponse,iDet,track,species);
+  }
+
+  SharedNSigmaTable& table=GetSharedNSigmaTable();
+  AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry=mgr ? mgr->GetCurrentEntry() : -1;
+  const ULong64_t evid=((ULong64_t)(ev->GetBunchCrossNumber())<<32) + ev->GetTimeStamp();
+  if(table.fEvent!=ev || table.fEntry!=entry || table.fEventId!=evid || table.fPidResponse!=fPidResponse){
+    table.fTracks.clear();
+    table.fEvent=ev;
+    table.fEntry=entry;
+    table.fEventId=evid;
+    table.fPidResponse=fPidResponse;
+  }
+
+  std::pair<std::unordered_map<Int_t,NSigmaEntry>::iterator,Bool_t> ins=table.fTracks.insert(std::make_pair(track->GetID(),NSigmaEntry()));
+  NSigmaEntry &entryTr=ins.first->second;
+  if(ins.second){
+    entryTr.fTrack=track;
+    entryTr.fFilled[0]=entryTr.fFilled[1]=entryTr.fFilled[2]=0;
+  }
+  if(entryTr.fTrack!=track){
+    // another track with the same ID, not cached
+    return ComputeNSigma(fPidResponse,iDet,track,species);
+  }
+  const UShort_t bit=1<<species;
+  if(!(entryTr.fFilled[iDet]&bit)){
+    entryTr.fNSigma[iDet][species]=ComputeNSigma(fPidResponse,iDet,track,species);
+    entryTr.fFilled[iDet]|=bit;
+  }
+  return entryTr.fNSigma[iDet][species];
+}
@@ -204,6 +204,7 @@ public:
   void SetPriorsHistos(TString priorFileName);
   void SetUpCombinedPID();
   void SetUseCombined(Bool_t useCombined=kTRUE) {fUseCombined=useCombined;}
+  void SetUseSharedNSigmaTable(Bool_t useShared=kTRUE) {fUseSharedNSigmaTable=useShared;}
   void SetUseDefaultPriors(Bool_t defaultP)	    {fDefaultPriors=defaultP;}
   Int_t ApplyPidTPCRaw(AliAODTrack *track,Int_t specie) const;
   Int_t ApplyPidTOFRaw(AliAODTrack *track,Int_t specie) const;
@@ -244,6 +245,7 @@ private:
   AliAODPidHF& operator=(const AliAODPidHF& pid);
 
   void GetNsigmaTPCMeanSigmaData(Float_t &mean, Float_t &sigma, AliPID::EParticleType species, Float_t pTPC) const;
+  Float_t GetRawNSigma(AliPIDResponse::EDetector detector, AliAODTrack *track, AliPID::EParticleType species) const;
 
   Int_t fnNSigma; /// number of sigmas
   /// sigma for the raw signal PID: 0-2 for TPC, 3 for TOF, 4 for ITS
@@ -313,9 +315,10 @@ private:
   Float_t fSigmaNsigmaTPCProtonData[100]; /// array of NsigmaTPC proton mean in data 
   Float_t fPlimitsNsigmaTPCDataCorr[101]; /// array of p limits for data-driven NsigmaTPC correction
   Int_t fNPbinsNsigmaTPCDataCorr;/// number of p bins for data-driven NsigmaTPC correction
+  Bool_t fUseSharedNSigmaTable; /// take the n sigma from the per-event table shared by all the AliAODPidHF objects
 
   /// \cond CLASSIMP
-  ClassDef(AliAODPidHF,25); /// AliAODPid for heavy flavor PID
+  ClassDef(AliAODPidHF,26); /// AliAODPid for heavy flavor PID
   /// \endcond
 
 };
@@ -33,6 +33,7 @@
 #include "AliKFVertex.h"
 #include "AliVVertex.h"
 #include "AliESDVertex.h"
+#include "AliESDtrack.h"
 
 /// \cond CLASSIMP
 ClassImp(AliAODRecoDecayHF);
@@ -333,6 +334,57 @@ AliAODVertex* AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod)
   return vtxAODNew;
 }
 //-----------------------------------------------------------------------------------
+AliAODVertex* AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod,AliESDVertex *fullVtx) {
+  //
+  // Same as RemoveDaughtersFromPrimaryVtx(aod), but the vertex is not refitted:
+  // the contributions of the daughter tracks are subtracted from the full fit
+  // (AliVertexerTracks::RemoveTracksFromVertex). fullVtx is the primary vertex
+  // of the event with the indices of its contributors, see
+  // AliRDHFCuts::GetPrimaryVtxForRemoval(). Daughters which were not used in
+  // the vertex fit are ignored.
+  //
+
+  if(!fullVtx) return 0;
+
+  AliVertexerTracks vertexer(aod->GetMagneticField());
+
+  Int_t ndg = GetNDaughters();
+  TObjArray rmArray(ndg);
+  UShort_t rmId[10];
+  Int_t nTrksToRemove=0;
+  for(Int_t i=0; i<ndg && nTrksToRemove<10; i++) {
+    AliAODTrack *t = dynamic_cast<AliAODTrack*>(GetDaughter(i));
+    if(!t || t->GetID()<0) continue;
+    if(!fullVtx->UsesTrack(t->GetID())) continue;
+    rmArray.AddLast(new AliESDtrack(t));
+    rmId[nTrksToRemove++] = (UShort_t)t->GetID();
+  }
+
+  Float_t diamondxy[2]={static_cast<Float_t>(aod->GetDiamondX()),static_cast<Float_t>(aod->GetDiamondY())};
+  // nothing to subtract if none of the daughters contributed to the fit
+  AliESDVertex *vtxESDNew = nTrksToRemove>0 ? vertexer.RemoveTracksFromVertex(fullVtx,&rmArray,rmId,diamondxy) : new AliESDVertex(*fullVtx);
+  rmArray.Delete();
+
+  if(!vtxESDNew) return 0;
+  if(vtxESDNew->GetNContributors()<=0) { 
+    delete vtxESDNew; vtxESDNew=NULL;
+    return 0;
+  }
+
+  // convert to AliAODVertex
+  Double_t pos[3],cov[6],chi2perNDF;
+  vtxESDNew->GetXYZ(pos); // position
+  vtxESDNew->GetCovMatrix(cov); //covariance matrix
+  chi2perNDF = vtxESDNew->GetChi2toNDF();
+  delete vtxESDNew; vtxESDNew=NULL;
+
+  AliAODVertex *vtxAODNew = new AliAODVertex(pos,cov,chi2perNDF);
+
+  RecalculateImpPars(vtxAODNew,aod);
+
+  return vtxAODNew;
+}
+//-----------------------------------------------------------------------------------
 void AliAODRecoDecayHF::RecalculateImpPars(AliAODVertex *vtxAODNew,AliAODEvent* aod) {
   //
   // now recalculate the daughters impact parameters
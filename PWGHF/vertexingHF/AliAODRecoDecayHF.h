@@ -16,6 +16,7 @@
 #include "AliAODRecoDecay.h"
 
 class AliAODEvent;
+class AliESDVertex;
 class AliRDHFCuts;
 class AliKFParticle;
 
@@ -51,6 +52,7 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   void UnsetOwnSecondaryVtx() {if(fOwnSecondaryVtx) {delete fOwnSecondaryVtx; fOwnSecondaryVtx=0;} return;}
   AliAODVertex* GetPrimaryVtx() const { return (GetOwnPrimaryVtx() ? GetOwnPrimaryVtx() : GetPrimaryVtxRef()); }
   AliAODVertex* RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod);  
+  AliAODVertex* RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod,AliESDVertex *fullVtx);
   void          RecalculateImpPars(AliAODVertex *vtxAODNew,AliAODEvent *aod);
 
   void     SetIsFilled(Int_t filled){fIsFilled=filled;}
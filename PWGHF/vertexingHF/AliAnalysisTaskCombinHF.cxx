@@ -46,6 +46,11 @@
 ClassImp(AliAnalysisTaskCombinHF);
 /// \endcond
 
+namespace {
+  /// margin (GeV^2) on the mass range for the fast preselection of the mixed-event combinations
+  const Double_t kMixMassMargin2=1.e-6;
+}
+
 //________________________________________________________________________
 AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF():
   AliAnalysisTaskSE(),
@@ -136,14 +141,13 @@ AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF():
   fNMultPoolsLimSize(2),
   fMultPoolLims(0x0),
   fNOfPools(1),
-  fEventBuffer(0x0),
-  fEventInfo(new TObjString("")),
+  fEventPools(),
   fVtxZ(0),
   fMultiplicity(0),
   fMinMultiplicity(-0.5),
   fMaxMultiplicity(199.5),
-  fKaonTracks(0x0),
-  fPionTracks(0x0)
+  fKaonTracks(),
+  fPionTracks()
 {
   /// default constructor
 }
@@ -238,14 +242,13 @@ AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF(Int_t meson, AliRDHFCuts* analy
   fNMultPoolsLimSize(2),
   fMultPoolLims(0x0),
   fNOfPools(1),
-  fEventBuffer(0x0),
-  fEventInfo(new TObjString("")),
+  fEventPools(),
   fVtxZ(0),
   fMultiplicity(0),
   fMinMultiplicity(-0.5),
   fMaxMultiplicity(199.5),
-  fKaonTracks(0x0),
-  fPionTracks(0x0)
+  fKaonTracks(),
+  fPionTracks()
 {
   /// standard constructor
 
@@ -306,16 +309,6 @@ AliAnalysisTaskCombinHF::~AliAnalysisTaskCombinHF()
   delete fTrackCutsKaon;
   delete fPidHF;
   delete fAnalysisCuts;
-  if(fKaonTracks) fKaonTracks->Delete();
-  if(fPionTracks) fPionTracks->Delete();
-  delete fKaonTracks;
-  delete fPionTracks;
-
-  if(fEventBuffer){
-    for(Int_t i=0; i<fNOfPools; i++) delete fEventBuffer[i];
-    delete fEventBuffer;
-  }
-  delete fEventInfo;
   delete [] fzVertPoolLims;
   delete [] fMultPoolLims;
 }
@@ -604,20 +597,7 @@ void AliAnalysisTaskCombinHF::UserCreateOutputObjects()
   PostData(3, fListCuts);
 
   
-  fKaonTracks = new TObjArray();
-  fPionTracks=new TObjArray();
-  fKaonTracks->SetOwner();
-  fPionTracks->SetOwner();
-
-  fEventBuffer = new TTree*[fNOfPools];
-  for(Int_t i=0; i<fNOfPools; i++){
-    fEventBuffer[i]=new TTree(Form("EventBuffer_%d",i), "Temporary buffer for event mixing");
-    fEventBuffer[i]->Branch("zVertex", &fVtxZ);
-    fEventBuffer[i]->Branch("multiplicity", &fMultiplicity);
-    fEventBuffer[i]->Branch("eventInfo", "TObjString",&fEventInfo);
-    fEventBuffer[i]->Branch("karray", "TObjArray", &fKaonTracks);
-    fEventBuffer[i]->Branch("parray", "TObjArray", &fPionTracks);
-  }
+  fEventPools.assign(fNOfPools,MixPool());
 
   PostData(1,fOutput);
   PostData(2,fCounter);
@@ -793,8 +773,10 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
   Double_t tmpp[3];
   Double_t px[3],py[3],pz[3];
   Int_t dgLabels[3];
-  fKaonTracks->Delete();
-  fPionTracks->Delete();
+  fKaonTracks.clear();
+  fPionTracks.clear();
+  Double_t massKaon=TDatabasePDG::Instance()->GetParticle(321)->Mass();
+  Double_t massPion=TDatabasePDG::Instance()->GetParticle(211)->Mass();
  
   for(Int_t iTr1=0; iTr1<ntracks; iTr1++){
     AliAODTrack* trK=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr1));
@@ -804,8 +786,8 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
     }
     if((status[iTr1] & 1)==0) continue;
     if(fDoEventMixing>0){
-      if(status[iTr1] & 2) fKaonTracks->AddLast(new TLorentzVector(trK->Px(),trK->Py(),trK->Pz(),trK->Charge()));
-      if(status[iTr1] & 4) fPionTracks->AddLast(new TLorentzVector(trK->Px(),trK->Py(),trK->Pz(),trK->Charge()));
+      if(status[iTr1] & 2) fKaonTracks.push_back(MakeMixTrack(trK,massKaon));
+      if(status[iTr1] & 4) fPionTracks.push_back(MakeMixTrack(trK,massPion));
     }
     if((status[iTr1] & 2)==0) continue;
     Int_t chargeK=trK->Charge();
@@ -910,20 +892,21 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
   
   fCounter->StoreCandidates(aod,nFiltered,kTRUE);
   fCounter->StoreCandidates(aod,nSelected,kFALSE);
-  fEventInfo->SetString(Form("Ev%d_esd%d_Pi%d_K%d",mgr->GetNcalls(),((AliAODHeader*)aod->GetHeader())->GetEventNumberESDFile(),fPionTracks->GetEntries(),fKaonTracks->GetEntries()));
+  Int_t evId=mgr->GetNcalls();
+  Int_t esdId=((AliAODHeader*)aod->GetHeader())->GetEventNumberESDFile();
   if(fDoEventMixing==1){
     Int_t ind=GetPoolIndex(fVtxZ,fMultiplicity);
     if(ind>=0 && ind<fNOfPools){
       fEventsPerPool->Fill(fVtxZ,fMultiplicity);
-      fEventBuffer[ind]->Fill();
-      if(fEventBuffer[ind]->GetEntries() >= fNumberOfEventsForMixing){
+      AddEventToPool(ind,evId,esdId);
+      if((Int_t)fEventPools[ind].fEvents.size() >= fNumberOfEventsForMixing){
 	fMixingsPerPool->Fill(fVtxZ,fMultiplicity);
 	  DoMixingWithPools(ind);
 	  ResetPool(ind);
       }
     }
   }else if(fDoEventMixing==2){ // mix with cuts, no pools
-      fEventBuffer[0]->Fill();
+      AddEventToPool(0,evId,esdId);
   }
   PostData(1,fOutput);
   PostData(2,fCounter);
@@ -1343,16 +1326,60 @@ Int_t AliAnalysisTaskCombinHF::GetPoolIndex(Double_t zvert, Double_t mult){
   return fNMultPools*theBinZ+theBinM;
 }
 //_________________________________________________________________
+AliAnalysisTaskCombinHF::MixTrack AliAnalysisTaskCombinHF::MakeMixTrack(AliAODTrack* track, Double_t mass){
+  /// copy of the track kinematics for the event mixing, energy computed for the given mass
+  MixTrack mtr;
+  mtr.fPx=track->Px();
+  mtr.fPy=track->Py();
+  mtr.fPz=track->Pz();
+  mtr.fE=TMath::Sqrt(mass*mass+mtr.fPx*mtr.fPx+mtr.fPy*mtr.fPy+mtr.fPz*mtr.fPz);
+  mtr.fCharge=track->Charge();
+  return mtr;
+}
+//_________________________________________________________________
+Double_t AliAnalysisTaskCombinHF::MixInvMass2(const MixTrack &t1, const MixTrack &t2){
+  /// squared invariant mass of two tracks, used to skip the combinations outside the mass range
+  Double_t e=t1.fE+t2.fE;
+  Double_t px=t1.fPx+t2.fPx;
+  Double_t py=t1.fPy+t2.fPy;
+  Double_t pz=t1.fPz+t2.fPz;
+  return e*e-px*px-py*py-pz*pz;
+}
+//_________________________________________________________________
+Double_t AliAnalysisTaskCombinHF::MixInvMass2(const MixTrack &t1, const MixTrack &t2, const MixTrack &t3){
+  /// squared invariant mass of three tracks, used to skip the combinations outside the mass range
+  Double_t e=t1.fE+t2.fE+t3.fE;
+  Double_t px=t1.fPx+t2.fPx+t3.fPx;
+  Double_t py=t1.fPy+t2.fPy+t3.fPy;
+  Double_t pz=t1.fPz+t2.fPz+t3.fPz;
+  return e*e-px*px-py*py-pz*pz;
+}
+//_________________________________________________________________
+void AliAnalysisTaskCombinHF::AddEventToPool(Int_t poolIndex, Int_t evId, Int_t esdId){
+  /// append the kaons and pions of the current event to the pool
+  if(poolIndex<0 || poolIndex>=(Int_t)fEventPools.size()) return;
+  MixPool &pool=fEventPools[poolIndex];
+  MixEvent ev;
+  ev.fZVertex=fVtxZ;
+  ev.fMult=fMultiplicity;
+  ev.fEvId=evId;
+  ev.fESDId=esdId;
+  ev.fFirstKaon=pool.fKaons.size();
+  ev.fNKaons=fKaonTracks.size();
+  ev.fFirstPion=pool.fPions.size();
+  ev.fNPions=fPionTracks.size();
+  pool.fKaons.insert(pool.fKaons.end(),fKaonTracks.begin(),fKaonTracks.end());
+  pool.fPions.insert(pool.fPions.end(),fPionTracks.begin(),fPionTracks.end());
+  pool.fEvents.push_back(ev);
+  return;
+}
+//_________________________________________________________________
 void AliAnalysisTaskCombinHF::ResetPool(Int_t poolIndex){
-  /// delete the contets of the pool
-  if(poolIndex<0 || poolIndex>=fNOfPools) return;
-  delete fEventBuffer[poolIndex];
-  fEventBuffer[poolIndex]=new TTree(Form("EventBuffer_%d",poolIndex), "Temporary buffer for event mixing");
-  fEventBuffer[poolIndex]->Branch("zVertex", &fVtxZ);
-  fEventBuffer[poolIndex]->Branch("multiplicity", &fMultiplicity);
-  fEventBuffer[poolIndex]->Branch("eventInfo", "TObjString",&fEventInfo);
-  fEventBuffer[poolIndex]->Branch("karray", "TObjArray", &fKaonTracks);
-  fEventBuffer[poolIndex]->Branch("parray", "TObjArray", &fPionTracks);
+  /// delete the contets of the pool, the allocated memory is kept for the next events
+  if(poolIndex<0 || poolIndex>=(Int_t)fEventPools.size()) return;
+  fEventPools[poolIndex].fEvents.clear();
+  fEventPools[poolIndex].fKaons.clear();
+  fEventPools[poolIndex].fPions.clear();
   return;
 }
 //_________________________________________________________________
@@ -1367,115 +1394,75 @@ void AliAnalysisTaskCombinHF::DoMixingWithCuts(){
   /// perform mixed event analysis
 
   if(fDoEventMixing==0) return;
-  Int_t nEvents=fEventBuffer[0]->GetEntries();
+  if(fEventPools.empty()) return;
+  const MixPool &pool=fEventPools[0];
+  Int_t nEvents=pool.fEvents.size();
   if(fDebug > 1) printf("AnalysisTaskCombinHF::DoMixingWithCuts Start Event Mixing of %d events\n",nEvents);
 
-  TObjArray* karray=0x0;
-  TObjArray* parray=0x0;
-  Double_t zVertex,mult;
-  TObjString* eventInfo=0x0;
-  fEventBuffer[0]->SetBranchAddress("karray", &karray);
-  fEventBuffer[0]->SetBranchAddress("parray", &parray);
-  fEventBuffer[0]->SetBranchAddress("eventInfo",&eventInfo);
-  fEventBuffer[0]->SetBranchAddress("zVertex", &zVertex);
-  fEventBuffer[0]->SetBranchAddress("multiplicity", &mult);
   Double_t d02[2]={0.,0.};
-  Double_t d03[3]={0.,0.,0.};
   AliAODRecoDecay* tmpRD2 = new AliAODRecoDecay(0x0,2,0,d02);
-  AliAODRecoDecay* tmpRD3 = new AliAODRecoDecay(0x0,3,1,d03);
   UInt_t pdg0[2]={321,211};
-  //  UInt_t pdgp[3]={321,211,211};
   Double_t px[3],py[3],pz[3];
-  Int_t evId1,esdId1,nk1,np1;
-  Int_t evId2,esdId2,nk2,np2;
+  // the mass range is checked again (with the standard computation) when filling the histos
+  Double_t minMass2=fMinMass*fMinMass-kMixMassMargin2;
+  Double_t maxMass2=fMaxMass*fMaxMass+kMixMassMargin2;
 
   for(Int_t iEv1=0; iEv1<nEvents; iEv1++){
-    fEventBuffer[0]->GetEvent(iEv1);
-    TObjArray* karray1=(TObjArray*)karray->Clone();
-    Double_t zVertex1=zVertex;
-    Double_t mult1=mult;
-    Int_t nKaons=karray1->GetEntries();
-    Int_t nPionsForCheck=parray->GetEntries();
-    sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId1,&esdId1,&np1,&nk1);
-    if(nk1!=nKaons || np1!=nPionsForCheck){ 
-      printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: read event does not match to the stored one\n");
-      delete karray1;
-      continue;
-    }
+    const MixEvent &ev1=pool.fEvents[iEv1];
+    const MixTrack* kaons1=pool.fKaons.data()+ev1.fFirstKaon;
+    Int_t nKaons=ev1.fNKaons;
     for(Int_t iEv2=0; iEv2<fNumberOfEventsForMixing; iEv2++){
       Int_t iToMix=iEv1+iEv2+1;
       if(iEv1>=(nEvents-fNumberOfEventsForMixing)) iToMix=iEv1-iEv2-1;
       if(iToMix<0) continue;
       if(iToMix==iEv1) continue;
       if(iToMix<iEv1) continue;
-      fEventBuffer[0]->GetEvent(iToMix);
-      Double_t zVertex2=zVertex;
-      Double_t mult2=mult;
-      if(TMath::Abs(zVertex2-zVertex1)<0.0001 && TMath::Abs(mult2-mult1)<0.001){
-	printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,zVertex1,zVertex2,mult1,mult2);
-	continue;
-      }
-      TObjArray* parray2=(TObjArray*)parray->Clone();
-      Int_t nPions=parray2->GetEntries();
-      Int_t nKaonsForCheck=karray->GetEntries();
-      sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId2,&esdId2,&np2,&nk2);
-      if(nk2!=nKaonsForCheck || np2!=nPions){ 
-	printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: read event does not match to the stored one\n");
-	delete parray2;
+      const MixEvent &ev2=pool.fEvents[iToMix];
+      if(TMath::Abs(ev2.fZVertex-ev1.fZVertex)<0.0001 && TMath::Abs(ev2.fMult-ev1.fMult)<0.001){
+	printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,ev1.fZVertex,ev2.fZVertex,ev1.fMult,ev2.fMult);
 	continue;
       }
-      if(evId2==evId1 && esdId2==esdId1){
- 	printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",evId1,evId2,nKaons,nKaonsForCheck,nPionsForCheck,nPions);
-	delete parray2;
+      if(ev2.fEvId==ev1.fEvId && ev2.fESDId==ev1.fESDId){
+ 	printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",ev1.fEvId,ev2.fEvId,nKaons,ev2.fNKaons,ev1.fNPions,ev2.fNPions);
 	continue;
       }
-      if(CanBeMixed(zVertex1,zVertex2,mult1,mult2)){
-	for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
-	  TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
-	  Double_t chargeK=trK->T();
-	  px[0] = trK->Px();
-	  py[0] = trK->Py();
-	  pz[0] = trK->Pz();
-	  for(Int_t iTr2=0; iTr2<nPions; iTr2++){
-	    TLorentzVector* trPi1=(TLorentzVector*)parray2->At(iTr2);
-	    Double_t chargePi1=trPi1->T();
-	    px[1] = trPi1->Px();
-	    py[1] = trPi1->Py();
-	    pz[1] = trPi1->Pz();
-	    if(fMeson==kDzero && chargePi1*chargeK<0){
-	      FillMEHistos(421,2,tmpRD2,px,py,pz,pdg0);
-	    }	  
-	    if(fMeson==kDzero && chargePi1*chargeK>0){
-	      FillMEHistosLS(421,2,tmpRD2,px,py,pz,pdg0,(Int_t)chargePi1);
-	    }
+      if(fMeson!=kDzero) continue;
+      if(!CanBeMixed(ev1.fZVertex,ev2.fZVertex,ev1.fMult,ev2.fMult)) continue;
+      const MixTrack* pions2=pool.fPions.data()+ev2.fFirstPion;
+      Int_t nPions=ev2.fNPions;
+      for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
+	const MixTrack &trK=kaons1[iTr1];
+	px[0] = trK.fPx;
+	py[0] = trK.fPy;
+	pz[0] = trK.fPz;
+	for(Int_t iTr2=0; iTr2<nPions; iTr2++){
+	  const MixTrack &trPi1=pions2[iTr2];
+	  Double_t minv2=MixInvMass2(trK,trPi1);
+	  if(minv2<minMass2 || minv2>maxMass2) continue;
+	  px[1] = trPi1.fPx;
+	  py[1] = trPi1.fPy;
+	  pz[1] = trPi1.fPz;
+	  if(trPi1.fCharge*trK.fCharge<0){
+	    FillMEHistos(421,2,tmpRD2,px,py,pz,pdg0);
+	  }else if(trPi1.fCharge*trK.fCharge>0){
+	    FillMEHistosLS(421,2,tmpRD2,px,py,pz,pdg0,trPi1.fCharge);
 	  }
 	}
       }
-      delete parray2;
     }
-    delete karray1;
   }
   delete tmpRD2;
-  delete tmpRD3;
 }
 //_________________________________________________________________
 void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
   /// perform mixed event analysis
 
   if(fDoEventMixing==0) return;
-  if(poolIndex<0 || poolIndex>fNzVertPools*fNMultPools) return;
+  if(poolIndex<0 || poolIndex>=(Int_t)fEventPools.size()) return;
 
-  Int_t nEvents=fEventBuffer[poolIndex]->GetEntries();
+  const MixPool &pool=fEventPools[poolIndex];
+  Int_t nEvents=pool.fEvents.size();
   if(fDebug > 1) printf("AliAnalysisTaskCombinHF::DoMixingWithPools Start Event Mixing of %d events\n",nEvents);
-  TObjArray* karray=0x0;
-  TObjArray* parray=0x0;
-  Double_t zVertex,mult;
-  TObjString* eventInfo=0x0;
-  fEventBuffer[poolIndex]->SetBranchAddress("karray", &karray);
-  fEventBuffer[poolIndex]->SetBranchAddress("parray", &parray);
-  fEventBuffer[poolIndex]->SetBranchAddress("eventInfo",&eventInfo);
-  fEventBuffer[poolIndex]->SetBranchAddress("zVertex", &zVertex);
-  fEventBuffer[poolIndex]->SetBranchAddress("multiplicity", &mult);
 
   // dummy values of track impact parameter, needed to build an AliAODRecoDecay object
   Double_t d02[2]={0.,0.};
@@ -1486,111 +1473,94 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
   UInt_t pdgp[3]={321,211,211};
   UInt_t pdgs[3]={321,211,321};
   Double_t px[3],py[3],pz[3];
-  Int_t evId1,esdId1,nk1,np1;
-  Int_t evId2,esdId2,nk2,np2;
+  Double_t massPhi=TDatabasePDG::Instance()->GetParticle(333)->Mass();
+  // the mass range is checked again (with the standard computation) when filling the histos
+  Double_t minMass2=fMinMass*fMinMass-kMixMassMargin2;
+  Double_t maxMass2=fMaxMass*fMaxMass+kMixMassMargin2;
 
   for(Int_t iEv1=0; iEv1<nEvents; iEv1++){
-    fEventBuffer[poolIndex]->GetEvent(iEv1);
-    TObjArray* karray1=(TObjArray*)karray->Clone();
-    Double_t zVertex1=zVertex;
-    Double_t mult1=mult;
-    Int_t nKaons=karray1->GetEntries();
-    Int_t nPionsForCheck=parray->GetEntries();
-    sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId1,&esdId1,&np1,&nk1);
-    if(nk1!=nKaons || np1!=nPionsForCheck){ 
-      printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: read event does not match to the stored one\n");
-      delete karray1;
-      continue;
-    }
+    const MixEvent &ev1=pool.fEvents[iEv1];
+    const MixTrack* kaons1=pool.fKaons.data()+ev1.fFirstKaon;
+    Int_t nKaons=ev1.fNKaons;
     for(Int_t iEv2=0; iEv2<nEvents; iEv2++){
       if(iEv2==iEv1) continue;
-      fEventBuffer[poolIndex]->GetEvent(iEv2);
-      Double_t zVertex2=zVertex;
-      Double_t mult2=mult;
-      if(TMath::Abs(zVertex2-zVertex1)<0.0001 && TMath::Abs(mult2-mult1)<0.001){
-	printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,zVertex1,zVertex2,mult1,mult2);
+      const MixEvent &ev2=pool.fEvents[iEv2];
+      if(TMath::Abs(ev2.fZVertex-ev1.fZVertex)<0.0001 && TMath::Abs(ev2.fMult-ev1.fMult)<0.001){
+	printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,ev1.fZVertex,ev2.fZVertex,ev1.fMult,ev2.fMult);
 	continue;
       }
-      TObjArray* parray2=(TObjArray*)parray->Clone();
-      Int_t nPions=parray2->GetEntries();
-      Int_t nKaonsForCheck=karray->GetEntries();
-      sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId2,&esdId2,&np2,&nk2);
-      if(nk2!=nKaonsForCheck || np2!=nPions){ 
-	printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: read event does not match to the stored one\n");
-	delete parray2;
+      if(ev2.fEvId==ev1.fEvId && ev2.fESDId==ev1.fESDId){
+ 	printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",ev1.fEvId,ev2.fEvId,nKaons,ev2.fNKaons,ev1.fNPions,ev2.fNPions);
 	continue;
       }
-      if(evId2==evId1 && esdId2==esdId1){
- 	printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",evId1,evId2,nKaons,nKaonsForCheck,nPionsForCheck,nPions);
-	delete parray2;
-	continue;
-      }     
-      TObjArray* parray3=0x0;
+      const MixTrack* pions2=pool.fPions.data()+ev2.fFirstPion;
+      Int_t nPions=ev2.fNPions;
+      const MixTrack* pions3=0x0;
       Int_t nPions3=0;
-      if(fMeson!=kDzero && fMeson!=kDs){
+      if(fMeson==kDplus){
 	Int_t iEv3=iEv2+1;
 	if(iEv3==iEv1) iEv3=iEv2+2;
 	if(iEv3>=nEvents) iEv3=iEv2-3;
 	if(nEvents==2) iEv3=iEv1;
 	if(iEv3<0) iEv3=iEv2-1;
-	fEventBuffer[poolIndex]->GetEvent(iEv3);
-	parray3=(TObjArray*)parray->Clone();
-	nPions3=parray3->GetEntries();
+	const MixEvent &ev3=pool.fEvents[iEv3];
+	pions3=pool.fPions.data()+ev3.fFirstPion;
+	nPions3=ev3.fNPions;
       }
       for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
-	TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
-	Double_t chargeK=trK->T();
-	px[0] = trK->Px();
-	py[0] = trK->Py();
-	pz[0] = trK->Pz();
+	const MixTrack &trK=kaons1[iTr1];
+	px[0] = trK.fPx;
+	py[0] = trK.fPy;
+	pz[0] = trK.fPz;
 	for(Int_t iTr2=0; iTr2<nPions; iTr2++){
-	  TLorentzVector* trPi1=(TLorentzVector*)parray2->At(iTr2);
-	  Double_t chargePi1=trPi1->T();
-	  px[1] = trPi1->Px();
-	  py[1] = trPi1->Py();
-	  pz[1] = trPi1->Pz();
-	  if(chargePi1*chargeK<0){
-	    if(fMeson==kDzero){
-	      FillMEHistos(421,2,tmpRD2,px,py,pz,pdg0);
-      }else if(fMeson==kDs) {
-        for(Int_t iTr3=iTr1+1; iTr3<nKaons; iTr3++){
-          TLorentzVector* trK2=(TLorentzVector*)karray1->At(iTr3);
-          Double_t chargeK2=trK2->T();
-          px[2] = trK2->Px();
-          py[2] = trK2->Py();
-          pz[2] = trK2->Pz();
-          Double_t massKK=ComputeInvMassKK(trK,trK2);
-          Double_t deltaMass=massKK-TDatabasePDG::Instance()->GetParticle(333)->Mass();
-          Double_t cos1=CosPiKPhiRFrame(trK,trK2,trPi1);
-          Double_t kincutPiKPhi=TMath::Abs(cos1*cos1*cos1);
-          Double_t cosPiDsLabFrame=CosPiDsLabFrame(trK,trK2,trPi1);
-          if(chargeK2*chargeK<0 && TMath::Abs(deltaMass)<fPhiMassCut && kincutPiKPhi>fCutCos3PiKPhiRFrame && cosPiDsLabFrame<fCutCosPiDsLabFrame){
-            FillMEHistos(431,3,tmpRD3,px,py,pz,pdgs);
-          }
-        }
-      } else{
-	      if(parray3){
-		for(Int_t iTr3=iTr2+1; iTr3<nPions3; iTr3++){
-		  TLorentzVector* trPi2=(TLorentzVector*)parray3->At(iTr3);
-		  Double_t chargePi2=trPi2->T();
-		  px[2] = trPi2->Px();
-		  py[2] = trPi2->Py();
-		  pz[2] = trPi2->Pz();
-		  if(chargePi2*chargeK<0){
-		    if(fMeson==kDplus) FillMEHistos(411,3,tmpRD3,px,py,pz,pdgp);
-		  }
-		}
+	  const MixTrack &trPi1=pions2[iTr2];
+	  px[1] = trPi1.fPx;
+	  py[1] = trPi1.fPy;
+	  pz[1] = trPi1.fPz;
+	  if(fMeson==kDzero){
+	    Double_t minv2=MixInvMass2(trK,trPi1);
+	    if(minv2<minMass2 || minv2>maxMass2) continue;
+	    if(trPi1.fCharge*trK.fCharge<0) FillMEHistos(421,2,tmpRD2,px,py,pz,pdg0);
+	    else if(trPi1.fCharge*trK.fCharge>0) FillMEHistosLS(421,2,tmpRD2,px,py,pz,pdg0,trPi1.fCharge);
+	  }else if(fMeson==kDs){
+	    if(trPi1.fCharge*trK.fCharge>=0) continue;
+	    for(Int_t iTr3=iTr1+1; iTr3<nKaons; iTr3++){
+	      const MixTrack &trK2=kaons1[iTr3];
+	      if(trK2.fCharge*trK.fCharge>=0) continue;
+	      Double_t minv2=MixInvMass2(trK,trPi1,trK2);
+	      if(minv2<minMass2 || minv2>maxMass2) continue;
+	      px[2] = trK2.fPx;
+	      py[2] = trK2.fPy;
+	      pz[2] = trK2.fPz;
+	      // the charge is stored in T(), as expected by the helper functions
+	      TLorentzVector vK1(trK.fPx,trK.fPy,trK.fPz,trK.fCharge);
+	      TLorentzVector vK2(trK2.fPx,trK2.fPy,trK2.fPz,trK2.fCharge);
+	      TLorentzVector vPi(trPi1.fPx,trPi1.fPy,trPi1.fPz,trPi1.fCharge);
+	      Double_t massKK=ComputeInvMassKK(&vK1,&vK2);
+	      Double_t deltaMass=massKK-massPhi;
+	      Double_t cos1=CosPiKPhiRFrame(&vK1,&vK2,&vPi);
+	      Double_t kincutPiKPhi=TMath::Abs(cos1*cos1*cos1);
+	      Double_t cosPiDsLabFrame=CosPiDsLabFrame(&vK1,&vK2,&vPi);
+	      if(TMath::Abs(deltaMass)<fPhiMassCut && kincutPiKPhi>fCutCos3PiKPhiRFrame && cosPiDsLabFrame<fCutCosPiDsLabFrame){
+		FillMEHistos(431,3,tmpRD3,px,py,pz,pdgs);
 	      }
 	    }
-	  }else if(chargePi1*chargeK>0){
-	    if(fMeson==kDzero) FillMEHistosLS(421,2,tmpRD2,px,py,pz,pdg0,(Int_t)chargePi1);
+	  }else if(fMeson==kDplus){
+	    if(trPi1.fCharge*trK.fCharge>=0) continue;
+	    for(Int_t iTr3=iTr2+1; iTr3<nPions3; iTr3++){
+	      const MixTrack &trPi2=pions3[iTr3];
+	      if(trPi2.fCharge*trK.fCharge>=0) continue;
+	      Double_t minv2=MixInvMass2(trK,trPi1,trPi2);
+	      if(minv2<minMass2 || minv2>maxMass2) continue;
+	      px[2] = trPi2.fPx;
+	      py[2] = trPi2.fPy;
+	      pz[2] = trPi2.fPz;
+	      FillMEHistos(411,3,tmpRD3,px,py,pz,pdgp);
+	    }
 	  }
 	}
       }
-      delete parray3;
-      delete parray2;
     }
-    delete karray1;
   }
   delete tmpRD2;
   delete tmpRD3;
@@ -1604,7 +1574,7 @@ void AliAnalysisTaskCombinHF::FinishTaskOutput()
 
   if(fDoEventMixing==1){
     for(Int_t i=0; i<fNOfPools; i++){
-      Int_t nEvents=fEventBuffer[i]->GetEntries();
+      Int_t nEvents=fEventPools[i].fEvents.size();
       if(nEvents>1) DoMixingWithPools(i);	  
     }
   }else if(fDoEventMixing==2){
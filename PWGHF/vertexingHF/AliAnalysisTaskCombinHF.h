@@ -13,6 +13,7 @@
 /// \author Authors: F. Prino, A. Rossi
 //////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TH1F.h>
 #include <TH3F.h>
 #include <TObjString.h>
@@ -130,6 +131,7 @@ public:
   void FillGenHistos(TClonesArray* arrayMC, Bool_t isEvSel);
   Bool_t CheckAcceptance(TClonesArray* arrayMC, Int_t nProng, Int_t *labDau); 
   Int_t GetPoolIndex(Double_t zvert, Double_t mult);
+  void AddEventToPool(Int_t poolIndex, Int_t evId, Int_t esdId);
   void ResetPool(Int_t poolIndex);
   void DoMixingWithPools(Int_t poolIndex);
   void DoMixingWithCuts();
@@ -147,6 +149,35 @@ private:
   Double_t CosPiKPhiRFrame(TLorentzVector* dauK1, TLorentzVector* dauK2, TLorentzVector* daupi) const;
   Double_t CosPiDsLabFrame(TLorentzVector* dauK1, TLorentzVector* dauK2, TLorentzVector* daupi) const;
 
+  /// compact copy of a kaon or pion candidate kept for the event mixing
+  struct MixTrack {
+    Double_t fPx;     ///< momentum x
+    Double_t fPy;     ///< momentum y
+    Double_t fPz;     ///< momentum z
+    Double_t fE;      ///< energy with the mass hypothesis of the list the track is in
+    Int_t    fCharge; ///< charge
+  };
+  /// event of a mixing pool, its tracks are ranges of the track vectors of the pool
+  struct MixEvent {
+    Double_t fZVertex;   ///< zVertex
+    Double_t fMult;      ///< multiplicity
+    Int_t    fEvId;      ///< call number, to check that two events are different
+    Int_t    fESDId;     ///< event number in the ESD file
+    Int_t    fFirstKaon; ///< index of the first kaon in the pool
+    Int_t    fNKaons;    ///< number of kaons
+    Int_t    fFirstPion; ///< index of the first pion in the pool
+    Int_t    fNPions;    ///< number of pions
+  };
+  /// mixing pool, cleared (keeping the allocated storage) after each mixing
+  struct MixPool {
+    std::vector<MixEvent> fEvents; ///< stored events
+    std::vector<MixTrack> fKaons;  ///< kaons of all events
+    std::vector<MixTrack> fPions;  ///< pions of all events
+  };
+  static MixTrack MakeMixTrack(AliAODTrack* track, Double_t mass);
+  static Double_t MixInvMass2(const MixTrack &t1, const MixTrack &t2);
+  static Double_t MixInvMass2(const MixTrack &t1, const MixTrack &t2, const MixTrack &t3);
+
   TList *fOutput;             //!<! list with output histograms
   TList *fListCuts;           //!<! list with cut values 
   TH1F *fHistNEvents;         //!<!hist. for No. of events
@@ -240,17 +271,16 @@ private:
   Int_t fNMultPoolsLimSize; /// number of pools in multiplicity for event mixing +1
   Double_t* fMultPoolLims; //[fNMultPoolsLimSize] limits of the pools in multiplicity
   Int_t  fNOfPools; /// number of pools
-  TTree** fEventBuffer;   //!<! structure for event mixing
-  TObjString* fEventInfo;  /// unique event Id for event mixing checks
+  std::vector<MixPool> fEventPools; //!<! in-memory pools for event mixing
   Double_t fVtxZ;         /// zVertex
   Double_t fMultiplicity; /// multiplicity
   Double_t fMinMultiplicity;  /// lower limit for multiplcities in MC histos
   Double_t fMaxMultiplicity; /// upper limit for multiplcities in MC histos
-  TObjArray* fKaonTracks; /// array of kaon-compatible tracks (TLorentzVectors)
-  TObjArray* fPionTracks; /// array of pion-compatible tracks (TLorentzVectors)
+  std::vector<MixTrack> fKaonTracks; //!<! kaon-compatible tracks of the current event
+  std::vector<MixTrack> fPionTracks; //!<! pion-compatible tracks of the current event
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskCombinHF,19); /// D0D+ task from AOD tracks
+  ClassDef(AliAnalysisTaskCombinHF,20); /// D0D+ task from AOD tracks
   /// \endcond
 };
 
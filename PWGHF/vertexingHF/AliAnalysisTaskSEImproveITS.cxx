@@ -221,6 +221,7 @@ AliAnalysisTaskSEImproveITS::AliAnalysisTaskSEImproveITS()
   ,fPt1ResKUpgSA_PbPb2018_kOnlySecond(0) 
   ,fPt1ResPiUpgSA_PbPb2018_kOnlySecond(0) 
   ,fPt1ResEUpgSA_PbPb2018_kOnlySecond(0) 
+  ,fGraphLUTs()
 {
   //
   // Default constructor.
@@ -439,6 +440,7 @@ AliAnalysisTaskSEImproveITS::AliAnalysisTaskSEImproveITS(const char *name,
   ,fPt1ResKUpgSA_PbPb2018_kOnlySecond(0) 
   ,fPt1ResPiUpgSA_PbPb2018_kOnlySecond(0) 
   ,fPt1ResEUpgSA_PbPb2018_kOnlySecond(0) 
+  ,fGraphLUTs()
 {
   //
   // Constructor to be used to create the task.
@@ -1335,13 +1337,7 @@ void AliAnalysisTaskSEImproveITS::UserExec(Option_t*) {
     // Smear all tracks
     fMCs=static_cast<TClonesArray*>(ev->GetList()->FindObject(AliAODMCParticle::StdBranchName()));
     if (!fMCs) return;
-    if (fImproveTracks) {
-      for(Int_t itrack=0;itrack<ev->GetNumberOfTracks();++itrack) {
-	AliAODTrack * trk = dynamic_cast<AliAODTrack*>(ev->GetTrack(itrack));
-	if(!trk) AliFatal("Not a standard AOD");
-	SmearTrack(trk,bz);
-      }
-    }
+    if (fImproveTracks) SmearTracks(ev,bz);
 
     // TODO: recalculated primary vertex
     AliVVertex *primaryVertex=ev->GetPrimaryVertex();
@@ -1547,17 +1543,28 @@ void AliAnalysisTaskSEImproveITS::UserExec(Option_t*) {
     // In case of ESD: only smear all tracks
     //
     if (!fMCEvent) return;
-    if (fImproveTracks) {
-      for(Int_t itrack=0;itrack<evesd->GetNumberOfTracks();++itrack) {
-	AliESDtrack * trk = dynamic_cast<AliESDtrack*>(evesd->GetTrack(itrack));
-	if(!trk) AliFatal("No a standard ESD");
-	SmearTrack(trk,bz);
-      }
-    }    
+    if (fImproveTracks) SmearTracks(evesd,bz);
   }// end ESD
   
 }
 
+void AliAnalysisTaskSEImproveITS::SmearTracks(AliVEvent *event,Double_t bz) {
+  //
+  // Smear all the tracks of the event
+  //
+  for(Int_t itrack=0;itrack<event->GetNumberOfTracks();++itrack) {
+    AliVTrack *trk=0x0;
+    if(fIsAOD) {
+      trk = dynamic_cast<AliAODTrack*>(event->GetTrack(itrack));
+      if(!trk) AliFatal("Not a standard AOD");
+    } else {
+      trk = dynamic_cast<AliESDtrack*>(event->GetTrack(itrack));
+      if(!trk) AliFatal("No a standard ESD");
+    }
+    SmearTrack(trk,bz);
+  }
+}
+
 void AliAnalysisTaskSEImproveITS::SmearTrack(AliVTrack *track,Double_t bz) {
 
   // flags for PbPb 2018 
@@ -1966,13 +1973,71 @@ Double_t AliAnalysisTaskSEImproveITS::EvalGraph(Double_t x,const TGraph *graph,c
   Double_t xmin=graph->GetX()[0  ];
   Double_t xmax=graph->GetX()[n-1];
   if (x<xmin) {
-    if(!graphSA) return graph->Eval(xmin);
+    if(!graphSA) return EvalLinear(xmin,graph);
     Double_t xminSA=graphSA->GetX()[0];
-    if(x<xminSA) return graphSA->Eval(xminSA);
-    return graphSA->Eval(x);
+    if(x<xminSA) return EvalLinear(xminSA,graphSA);
+    return EvalLinear(x,graphSA);
+  }
+  if (x>xmax) return EvalLinear(xmax,graph);
+  return EvalLinear(x,graph);
+}
+
+Double_t AliAnalysisTaskSEImproveITS::EvalLinear(Double_t x,const TGraph *graph) const {
+  //
+  // Same linear interpolation as TGraph::Eval for x within the graph range,
+  // with the segment taken from the lookup table instead of a scan of
+  // all the points
+  //
+  const GraphLUT &lut=GetGraphLUT(graph);
+  if(lut.fSegment.empty()) return graph->Eval(x);
+
+  const Double_t *gx=graph->GetX();
+  const Double_t *gy=graph->GetY();
+  Int_t n=graph->GetN();
+  Int_t cell=(Int_t)((x-lut.fX0)*lut.fInvStep);
+  if(cell<0) cell=0;
+  if(cell>=(Int_t)lut.fSegment.size()) cell=lut.fSegment.size()-1;
+  Int_t low=lut.fSegment[cell];
+  while(low>0 && gx[low]>x) low--;
+  while(low<n-2 && gx[low+1]<x) low++;
+  Int_t up=low+1;
+  if(gx[low]==gx[up]) return gy[low];
+  return gy[up]+(x-gx[up])*(gy[low]-gy[up])/(gx[low]-gx[up]);
+}
+
+const AliAnalysisTaskSEImproveITS::GraphLUT& AliAnalysisTaskSEImproveITS::GetGraphLUT(const TGraph *graph) const {
+  //
+  // Lookup table of the segments of a graph, built at the first use.
+  // The grid step is the smallest distance between two points, so that
+  // each cell overlaps at most two segments
+  //
+  std::map<const TGraph*,GraphLUT>::iterator it=fGraphLUTs.find(graph);
+  if(it!=fGraphLUTs.end()) return it->second;
+
+  GraphLUT &lut=fGraphLUTs[graph];
+  lut.fX0=0.;
+  lut.fInvStep=0.;
+  Int_t n=graph->GetN();
+  if(n<2) return lut;
+  const Double_t *gx=graph->GetX();
+  Double_t minStep=gx[n-1]-gx[0];
+  for(Int_t i=0;i<n-1;i++){
+    Double_t step=gx[i+1]-gx[i];
+    if(step<0.) return lut; // not sorted, TGraph::Eval is used
+    if(step>0. && step<minStep) minStep=step;
+  }
+  if(minStep<=0.) return lut;
+  Int_t nCells=TMath::Min(TMath::CeilNint((gx[n-1]-gx[0])/minStep),10000);
+  lut.fX0=gx[0];
+  lut.fInvStep=nCells/(gx[n-1]-gx[0]);
+  lut.fSegment.resize(nCells);
+  Int_t low=0;
+  for(Int_t icell=0;icell<nCells;icell++){
+    Double_t xcell=gx[0]+icell/lut.fInvStep;
+    while(low<n-2 && gx[low+1]<=xcell) low++;
+    lut.fSegment[icell]=low;
   }
-  if (x>xmax) return graph->Eval(xmax);
-  return graph->Eval(x);
+  return lut;
 }
 
 //________________________________________________________________________
@@ -5,6 +5,8 @@
 #ifndef ALI_ANALYSIS_TASK_SE_IMPROVE_ITS_H
 #define ALI_ANALYSIS_TASK_SE_IMPROVE_ITS_H
 
+#include <map>
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 
 /// \class AliAnalysisTaskSEImproveITS
@@ -16,6 +18,7 @@ class TClonesArray;
 class TObjArray;
 class AliESDVertex;
 class AliVVertex;
+class AliVEvent;
 
 class TNtuple;
 
@@ -49,10 +52,20 @@ private:
 
   /// Helper functions
   Double_t EvalGraph(Double_t x,const TGraph *graph,const TGraph *graphSA=0) const; 
+  Double_t EvalLinear(Double_t x,const TGraph *graph) const;
   void SmearTrack(AliVTrack *track, Double_t bz);
+  void SmearTracks(AliVEvent *event, Double_t bz);
   AliESDVertex* RecalculateVertex(const AliVVertex *old,TObjArray *tracks,Double_t bField);
   Int_t PhiBin(Double_t phi) const;
 
+  /// Segments of a graph looked up on a uniform grid in x, used by EvalLinear
+  struct GraphLUT {
+    Double_t fX0;                ///< first x of the graph
+    Double_t fInvStep;           ///< inverse of the grid step
+    std::vector<Int_t> fSegment; ///< segment containing the lower edge of each grid cell, empty if the graph is not sorted in x
+  };
+  const GraphLUT& GetGraphLUT(const TGraph *graph) const;
+
   TGraph *fD0ZResPCur  ; /// old pt dep. d0 res. in z for protons
   TGraph *fD0ZResKCur  ; /// old pt dep. d0 res. in z for kaons
   TGraph *fD0ZResPiCur ; /// old pt dep. d0 res. in z for pions
@@ -262,9 +275,10 @@ private:
   TNtuple *fDebugNtuple; //!<! debug send on output slot 1
   Float_t *fDebugVars;   //!<! variables to store as degug info 
   Int_t   fNDebug;       /// Max number of debug entries into Ntuple
+  mutable std::map<const TGraph*,GraphLUT> fGraphLUTs; //!<! lookup tables of the graphs evaluated so far
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskSEImproveITS,11);
+  ClassDef(AliAnalysisTaskSEImproveITS,12);
   /// \endcond
 };
 
@@ -70,6 +70,9 @@
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
 #include <cstring>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisVertexingHF);
@@ -138,6 +141,7 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fNThreads(1),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -157,7 +161,8 @@ fMassDplus(0.),
 fMassDs(0.),
 fMassLambdaC(0.),
 fMassDstar(0.),
-fMassJpsi(0.)
+fMassJpsi(0.),
+fDCACache()
 {
   /// Default constructor
 
@@ -233,6 +238,7 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fNThreads(source.fNThreads),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -252,7 +258,8 @@ fMassDplus(source.fMassDplus),
 fMassDs(source.fMassDs),
 fMassLambdaC(source.fMassLambdaC),
 fMassDstar(source.fMassDstar),
-fMassJpsi(source.fMassJpsi)
+fMassJpsi(source.fMassJpsi),
+fDCACache()
 {
   ///
   /// Copy constructor
@@ -327,6 +334,7 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fNThreads = source.fNThreads;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -617,6 +625,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
+  fDCACache.clear();
+  if(fNThreads>1) FillDCACache(seleTrksArray,tracksAtVertex,nSeleTrks,seleFlags,evtNumber);
 
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
@@ -867,7 +877,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       negtrack1->GetPxPyPz(momneg1);
 
       // DCA between the two tracks
-      dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+      dcap1n1 = GetDCAAtVertex(postrack1,iTrkP1,negtrack1,iTrkN1);
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
 
       // Vertexing
@@ -1131,9 +1141,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
-	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+	dcap2n1 = GetDCAAtVertex(postrack2,iTrkP2,negtrack1,iTrkN1);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
-	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
+	dcap1p2 = GetDCAAtVertex(postrack2,iTrkP2,postrack1,iTrkP1);
 	if(dcap1p2>dcaMax) { postrack2=0; continue; }
 
 	// check invariant mass cuts for D+,Ds,Lc
@@ -1275,9 +1285,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
-	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	    dcap1n2 = GetDCAAtVertex(postrack1,iTrkP1,negtrack2,iTrkN2);
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
-            dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+            dcap2n2 = GetDCAAtVertex(postrack2,iTrkP2,negtrack2,iTrkN2);
             if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
 
 
@@ -1409,9 +1419,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
-	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	dcap1n2 = GetDCAAtVertex(postrack1,iTrkP1,negtrack2,iTrkN2);
 	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
-	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	dcan1n2 = GetDCAAtVertex(negtrack1,iTrkN1,negtrack2,iTrkN2);
 	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
 
 	threeTrackArray->AddAt(negtrack1,0);
@@ -1547,6 +1557,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   delete [] seleFlags; seleFlags=NULL;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
   tracksAtVertex.Delete();
+  fDCACache.clear();
 
   if(fInputAOD) {
     seleTrksArray.Delete();
@@ -1969,6 +1980,38 @@ Bool_t AliAnalysisVertexingHF::FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF
   return kTRUE;
 }
 //---------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::ResetRefilledCand(AliAODRecoDecayHF *rd){
+  /// Bring a candidate refilled on-the-fly (IsFilled==2) back to its reduced
+  /// dAOD state, so that the next FillRecoCand/FillRecoCasc rebuilds it.
+  /// The refilled candidates live in the delta-AOD branches and are therefore
+  /// shared by all the wagons of a train: the first FillRecoCand of the event
+  /// fills them and the later wagons reuse the vertices. A wagon which modifies
+  /// the tracks afterwards (e.g. ImproveITS smearing) has to invalidate them.
+  if(!rd || rd->GetIsFilled()!=2) return kFALSE;
+  AliAODVertex *vtx = (AliAODVertex*)rd->GetSecondaryVtx();
+  if(vtx) {delete vtx; vtx=0;}
+  rd->SetSecondaryVtx(0);
+  rd->UnsetOwnPrimaryVtx();
+  rd->SetIsFilled(0);
+  return kTRUE;
+}
+//---------------------------------------------------------------------------
+Int_t AliAnalysisVertexingHF::ResetRefilledCandidates(AliVEvent *event){
+  /// Invalidate all the candidates of the event refilled on-the-fly,
+  /// see ResetRefilledCand. Returns the number of candidates reset
+  if(!event) return 0;
+  Int_t nReset=0;
+  const char* branches[4]={"D0toKpi","Charm3Prong","Dstar","CascadesHF"};
+  for(Int_t ibr=0; ibr<4; ibr++){
+    TClonesArray *arr=(TClonesArray*)event->GetList()->FindObject(branches[ibr]);
+    if(!arr) continue;
+    for(Int_t icand=0; icand<arr->GetEntriesFast(); icand++){
+      if(ResetRefilledCand((AliAODRecoDecayHF*)arr->UncheckedAt(icand))) nReset++;
+    }
+  }
+  return nReset;
+}
+//---------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::RecoSecondaryVertexForCascades(AliVEvent *event, AliAODRecoCascadeHF *rc)
 {
   ///
@@ -3706,6 +3749,74 @@ void AliAnalysisVertexingHF::SetParametersAtVertex(AliESDtrack* esdt, const AliE
   return;
 }
 //-----------------------------------------------------------------------------
+Double_t AliAnalysisVertexingHF::GetDCAAtVertex(AliESDtrack *trk1,Int_t iTrk1,AliESDtrack *trk2,Int_t iTrk2){
+  /// DCA between two selected tracks (index in the array of selected tracks),
+  /// both with their parameters at the primary vertex (SetParametersAtVertex).
+  /// The same pair enters many triplets and quadruplets, so the value is
+  /// computed once per event and then taken from fDCACache
+
+  Long64_t key=((Long64_t)iTrk1<<32)|(UInt_t)iTrk2;
+  std::map<Long64_t,Double_t>::const_iterator it=fDCACache.find(key);
+  if(it!=fDCACache.end()) return it->second;
+  Double_t xdummy,ydummy;
+  Double_t dca=trk1->GetDCA(trk2,fBzkG,xdummy,ydummy);
+  fDCACache[key]=dca;
+  return dca;
+}
+//-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::FillDCACache(const TObjArray &seleTrksArray,const TObjArray &tracksAtVertex,
+					  Int_t nSeleTrks,const UChar_t *seleFlags,const Int_t *evtNumber){
+  /// Compute in fNThreads threads the DCAs of the track pairs tried in the
+  /// candidate loops of FindCandidates: opposite-sign (and, with like-sign, same-sign)
+  /// pairs of displaced tracks, and for 3 prongs the same-sign pairs in the order
+  /// of the 2nd loops. The DCA is computed from the parameters at the primary vertex
+  /// with the same track order as in the loops, so the values are identical to the
+  /// ones computed there. The vertexing itself stays sequential: it shares the
+  /// vertexer, the cut objects and the output arrays.
+
+  std::vector<std::pair<Int_t,Int_t> > pairs;
+  for(Int_t i=0; i<nSeleTrks; i++) {
+    if(!TESTBIT(seleFlags[i],kBitDispl)) continue;
+    Short_t chargei=((AliESDtrack*)seleTrksArray.UncheckedAt(i))->Charge();
+    for(Int_t j=0; j<nSeleTrks; j++) {
+      if(j==i || !TESTBIT(seleFlags[j],kBitDispl)) continue;
+      if(fMixEvent && evtNumber[i]==evtNumber[j]) continue;
+      Short_t chargej=((AliESDtrack*)seleTrksArray.UncheckedAt(j))->Charge();
+      Bool_t tried=kFALSE;
+      if(chargei>0 && chargej<0) tried=kTRUE; // (p1,n1), (p2,n1), (p1,n2), (p2,n2)
+      else if(chargei==chargej) {
+	if(fLikeSign && j>i) tried=kTRUE; // like-sign (p1,n1)
+	Bool_t for3Prong=f3Prong && TESTBIT(seleFlags[i],kBit3Prong) && TESTBIT(seleFlags[j],kBit3Prong);
+	if(for3Prong && chargei>0 && i>j) tried=kTRUE; // (p2,p1)
+	if(for3Prong && chargei<0 && i<j) tried=kTRUE; // (n1,n2)
+      }
+      if(tried) pairs.push_back(std::make_pair(i,j));
+    }
+  }
+
+  std::vector<Double_t> dcas(pairs.size());
+  std::atomic<size_t> next(0);
+  const size_t kChunk=256;
+  auto worker=[&]() {
+    Double_t xdummy,ydummy;
+    for(size_t first=next.fetch_add(kChunk); first<pairs.size(); first=next.fetch_add(kChunk)) {
+      size_t last=TMath::Min(first+kChunk,pairs.size());
+      for(size_t ip=first; ip<last; ip++) {
+	const AliExternalTrackParam *trk1=(const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(pairs[ip].first);
+	const AliExternalTrackParam *trk2=(const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(pairs[ip].second);
+	dcas[ip]=trk1->GetDCA(trk2,fBzkG,xdummy,ydummy);
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for(Int_t it=1; it<fNThreads; it++) threads.push_back(std::thread(worker));
+  worker();
+  for(size_t it=0; it<threads.size(); it++) threads[it].join();
+
+  for(size_t ip=0; ip<pairs.size(); ip++)
+    fDCACache[((Long64_t)pairs[ip].first<<32)|(UInt_t)pairs[ip].second]=dcas[ip];
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SetMasses(){
   /// Set the hadron mass values from TDatabasePDG
 
@@ -13,6 +13,7 @@
 /// \author Contact: andrea.dainese@pd.infn.it
 //-------------------------------------------------------------------------
 
+#include <map>
 #include <TNamed.h>
 #include <TList.h>
 
@@ -71,6 +72,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3Prong *rd3);
   Bool_t FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd2);
   Bool_t FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rc,Bool_t isDStar,Bool_t recoSecVtx=kFALSE);
+  static Bool_t ResetRefilledCand(AliAODRecoDecayHF *rd);
+  static Int_t ResetRefilledCandidates(AliVEvent *event);
   Bool_t RecoSecondaryVertexForCascades(AliVEvent *event, AliAODRecoCascadeHF *rc);
   void PrintStatus() const;
   void SetSecVtxWithKF() { fSecVtxWithKF=kTRUE; }
@@ -179,6 +182,8 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  void SetNThreads(Int_t n=1) { fNThreads=n; }
+  Int_t GetNThreads() const { return fNThreads; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -326,6 +331,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Int_t  fNThreads; /// number of threads computing the track-pair DCAs
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -350,6 +356,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Double_t fMassDstar;
   Double_t fMassJpsi;
 
+  /// DCAs between pairs of selected tracks at the primary vertex, reused within one event
+  std::map<Long64_t,Double_t> fDCACache; //!
 
   //
   void AddRefs(AliAODVertex *v,AliAODRecoDecayHF *rd,const AliVEvent *event,
@@ -413,6 +421,9 @@ class AliAnalysisVertexingHF : public TNamed {
 				   Int_t &nSeleTrks,
 				   UChar_t *seleFlags,Int_t *evtNumber);
   void SetParametersAtVertex(AliESDtrack* esdt, const AliExternalTrackParam* extpar) const;
+  Double_t GetDCAAtVertex(AliESDtrack *trk1,Int_t iTrk1,AliESDtrack *trk2,Int_t iTrk2);
+  void   FillDCACache(const TObjArray &seleTrksArray,const TObjArray &tracksAtVertex,
+		      Int_t nSeleTrks,const UChar_t *seleFlags,const Int_t *evtNumber);
 
   Bool_t SingleTrkCuts(AliESDtrack *trk,Float_t centralityperc, Bool_t &okDisplaced,Bool_t &okSoftPi, Bool_t &ok3prong, Bool_t &okBachelor) const;
 
@@ -422,7 +433,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,28);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
@@ -0,0 +1,226 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////
+//
+// Class to evaluate gradient-boosted decision trees on HF candidates
+//
+// Usage:
+// AliHFBoostedTrees *bdt = AliHFBoostedTrees::LoadModel(FILE); // ROOT file or text dump
+// bdt->Evaluate(features);                                     // features in the order of GetFeatureNames()
+// bdt->EvaluateBatch(features, nCand, scores);                 // nCand x nFeatures, candidate-major
+//
+/////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <sstream>
+#include <TFile.h>
+#include <TMath.h>
+#include <TSystem.h>
+
+#include "AliLog.h"
+#include "AliHFBoostedTrees.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFBoostedTrees);
+/// \endcond
+
+//--------------------------------------------------------------------------
+AliHFBoostedTrees::AliHFBoostedTrees(const char* name, const char* title) :
+  TNamed(name,title),
+  fFeatureNames(),
+  fTreeRoot(),
+  fFeature(),
+  fThreshold(),
+  fChildren(),
+  fValue(),
+  fBaseScore(0.),
+  fApplySigmoid(kFALSE)
+{
+  //
+  /// Default constructor
+  //
+}
+
+//--------------------------------------------------------------------------
+AliHFBoostedTrees* AliHFBoostedTrees::LoadModel(TString fileName, TString objName) {
+  //
+  /// Read a model from a ROOT file (first AliHFBoostedTrees found if no
+  /// object name is given) or, for other extensions, from a text dump
+  //
+
+  if (fileName.EndsWith(".root")) {
+    TFile *f = TFile::Open(fileName.Data());
+    if (!f || f->IsZombie()) {
+      AliErrorClass(Form("Cannot open the model file %s",fileName.Data()));
+      delete f;
+      return 0x0;
+    }
+    AliHFBoostedTrees *model = 0x0;
+    if (objName.Length()>0) model = dynamic_cast<AliHFBoostedTrees*>(f->Get(objName.Data()));
+    else {
+      TIter next(f->GetListOfKeys());
+      TObject *key = 0x0;
+      while ((key = next()) && !model) model = dynamic_cast<AliHFBoostedTrees*>(f->Get(key->GetName()));
+    }
+    f->Close(); delete f;
+    if (!model) AliErrorClass(Form("No model found in %s",fileName.Data()));
+    return model;
+  }
+
+  AliHFBoostedTrees *model = new AliHFBoostedTrees(objName.Length()>0 ? objName.Data() : "HFBoostedTrees");
+  if (!model->ReadTextModel(fileName)) {
+    delete model;
+    return 0x0;
+  }
+  return model;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFBoostedTrees::ReadTextModel(TString fileName) {
+  //
+  /// Read the model from a text file with the format:
+  ///   features name0 name1 ...
+  ///   base_score margin
+  ///   sigmoid 0|1
+  ///   tree nNodes
+  ///   node feature threshold left right value   (nNodes lines, node ids within the tree)
+  /// with feature -1 for the leaves. Lines starting with # are ignored
+  //
+
+  gSystem->ExpandPathName(fileName);
+  std::ifstream in(fileName.Data());
+  if (!in.good()) {
+    AliError(Form("Cannot open the model file %s",fileName.Data()));
+    return kFALSE;
+  }
+
+  fFeatureNames.clear(); fTreeRoot.clear(); fFeature.clear();
+  fThreshold.clear(); fChildren.clear(); fValue.clear();
+
+  std::string line;
+  while (std::getline(in,line)) {
+    if (line.empty() || line[0]=='#') continue;
+    std::istringstream ss(line);
+    std::string keyword;
+    ss >> keyword;
+    if (keyword=="features") {
+      std::string name;
+      while (ss >> name) fFeatureNames.push_back(name);
+    } else if (keyword=="base_score") {
+      ss >> fBaseScore;
+    } else if (keyword=="sigmoid") {
+      Int_t sigmoid = 0;
+      ss >> sigmoid;
+      fApplySigmoid = (sigmoid!=0);
+    } else if (keyword=="tree") {
+      Int_t nNodes = 0;
+      ss >> nNodes;
+      if (nNodes<=0) continue;
+      std::vector<Int_t> feature(nNodes,-1), left(nNodes,-1), right(nNodes,-1);
+      std::vector<Float_t> threshold(nNodes,0.), value(nNodes,0.);
+      for (Int_t iNode=0; iNode<nNodes; iNode++) {
+        if (!std::getline(in,line)) {
+          AliError(Form("Truncated tree in %s",fileName.Data()));
+          return kFALSE;
+        }
+        std::istringstream ssNode(line);
+        Int_t id = -1;
+        ssNode >> id;
+        if (id<0 || id>=nNodes) {
+          AliError(Form("Wrong node id %d in %s",id,fileName.Data()));
+          return kFALSE;
+        }
+        ssNode >> feature[id] >> threshold[id] >> left[id] >> right[id] >> value[id];
+      }
+      AddTree(nNodes,feature.data(),threshold.data(),left.data(),right.data(),value.data());
+    } else {
+      AliWarning(Form("Unknown keyword %s in %s",keyword.c_str(),fileName.Data()));
+    }
+  }
+  AliInfo(Form("Read %d trees with %d nodes from %s",GetNTrees(),GetNNodes(),fileName.Data()));
+  return GetNTrees()>0;
+}
+
+//--------------------------------------------------------------------------
+void AliHFBoostedTrees::AddTree(Int_t nNodes, const Int_t *feature, const Float_t *threshold,
+                                const Int_t *left, const Int_t *right, const Float_t *value) {
+  //
+  /// Append a tree given with node ids within the tree (root = 0)
+  //
+
+  Int_t offset = fFeature.size();
+  fTreeRoot.push_back(offset);
+  for (Int_t iNode=0; iNode<nNodes; iNode++) {
+    Bool_t isLeaf = (feature[iNode]<0 || left[iNode]<0 || right[iNode]<0);
+    fFeature.push_back(isLeaf ? -1 : feature[iNode]);
+    fThreshold.push_back(threshold[iNode]);
+    fChildren.push_back(isLeaf ? -1 : offset+left[iNode]);
+    fChildren.push_back(isLeaf ? -1 : offset+right[iNode]);
+    fValue.push_back(value[iNode]);
+  }
+}
+
+//--------------------------------------------------------------------------
+Double_t AliHFBoostedTrees::Evaluate(const Float_t *features) const {
+  //
+  /// Score of one candidate, features in the order of GetFeatureNames()
+  //
+
+  Double_t margin = fBaseScore;
+  for (size_t iTree=0; iTree<fTreeRoot.size(); iTree++) {
+    Int_t node = fTreeRoot[iTree];
+    while (fFeature[node]>=0) {
+      // missing values (NaN) follow the left branch
+      node = fChildren[2*node + (features[fFeature[node]]>=fThreshold[node] ? 1 : 0)];
+    }
+    margin += fValue[node];
+  }
+  return Transform(margin);
+}
+
+//--------------------------------------------------------------------------
+void AliHFBoostedTrees::EvaluateBatch(const Float_t *features, Int_t nCand, Double_t *scores) const {
+  //
+  /// Scores of nCand candidates, features[iCand*GetNFeatures()+iFeature].
+  /// The loop runs over the candidates inside the loop over the trees,
+  /// so that the nodes of a tree stay in cache for the whole batch
+  //
+
+  const Int_t nFeatures = GetNFeatures();
+  for (Int_t iCand=0; iCand<nCand; iCand++) scores[iCand] = fBaseScore;
+  for (size_t iTree=0; iTree<fTreeRoot.size(); iTree++) {
+    const Int_t root = fTreeRoot[iTree];
+    for (Int_t iCand=0; iCand<nCand; iCand++) {
+      const Float_t *candFeatures = features + iCand*nFeatures;
+      Int_t node = root;
+      while (fFeature[node]>=0) {
+        node = fChildren[2*node + (candFeatures[fFeature[node]]>=fThreshold[node] ? 1 : 0)];
+      }
+      scores[iCand] += fValue[node];
+    }
+  }
+  for (Int_t iCand=0; iCand<nCand; iCand++) scores[iCand] = Transform(scores[iCand]);
+}
+
+//--------------------------------------------------------------------------
+Double_t AliHFBoostedTrees::Transform(Double_t margin) const {
+  //
+  /// Probability from the margin for binary:logistic models
+  //
+
+  if (!fApplySigmoid) return margin;
+  return 1./(1.+TMath::Exp(-margin));
+}
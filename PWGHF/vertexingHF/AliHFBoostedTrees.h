@@ -0,0 +1,65 @@
+#ifndef ALIHFBOOSTEDTREES_H
+#define ALIHFBOOSTEDTREES_H
+
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/////////////////////////////////////////////////////////////
+///
+/// \class AliHFBoostedTrees
+/// \brief Evaluation of gradient-boosted decision tree models
+///  (e.g. trained with XGBoost) on HF candidates
+///
+/// The nodes of all the trees are stored in flat arrays, the children
+/// of a node are referenced by their index in the arrays. The model is
+/// read from a ROOT file (object written with Write) or from a text
+/// dump with one node per line, see ReadTextModel.
+///
+/////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <string>
+#include <TNamed.h>
+
+class AliHFBoostedTrees : public TNamed {
+ public:
+
+  AliHFBoostedTrees(const char* name="HFBoostedTrees", const char* title="");
+  virtual ~AliHFBoostedTrees() {}
+
+  static AliHFBoostedTrees* LoadModel(TString fileName, TString objName="");
+
+  Bool_t ReadTextModel(TString fileName);
+  void   AddTree(Int_t nNodes, const Int_t *feature, const Float_t *threshold,
+                 const Int_t *left, const Int_t *right, const Float_t *value);
+  void   SetFeatureNames(const std::vector<std::string> &names) { fFeatureNames = names; }
+  void   SetBaseScore(Float_t base) { fBaseScore = base; }
+  void   SetApplySigmoid(Bool_t sigmoid=kTRUE) { fApplySigmoid = sigmoid; }
+
+  Int_t  GetNTrees() const { return fTreeRoot.size(); }
+  Int_t  GetNNodes() const { return fFeature.size(); }
+  Int_t  GetNFeatures() const { return fFeatureNames.size(); }
+  const std::vector<std::string>& GetFeatureNames() const { return fFeatureNames; }
+
+  Double_t Evaluate(const Float_t *features) const;
+  void     EvaluateBatch(const Float_t *features, Int_t nCand, Double_t *scores) const;
+
+ private:
+
+  Double_t Transform(Double_t margin) const;
+
+  std::vector<std::string> fFeatureNames; /// names of the input features
+  std::vector<Int_t>   fTreeRoot;         /// index of the root node of each tree
+  std::vector<Int_t>   fFeature;          /// feature tested by the node, -1 for leaves
+  std::vector<Float_t> fThreshold;        /// go left if feature < threshold (or missing)
+  std::vector<Int_t>   fChildren;         /// left at 2*node, right at 2*node+1
+  std::vector<Float_t> fValue;            /// leaf value
+  Float_t fBaseScore;                     /// margin added to the sum of the trees
+  Bool_t  fApplySigmoid;                  /// return the probability (binary:logistic) instead of the margin
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFBoostedTrees,1); /// evaluation of boosted decision trees
+  /// \endcond
+};
+
+#endif
@@ -25,6 +25,7 @@
 // syst.SetRunNumber(YEAR);     // YEAR = two last numbers of the year (is 10 for 2010)
 // syst.SetCollisionType(TYPE);  // TYPE =  0 is pp, 1 is PbPb
 // syst.SetCentrality(CENT);     // CENT is centrality, 0100 for MB, 020 (4080) for 0-20 (40-80) CC...
+// syst.SetSystFile(FILE);       // optional, FILE with the tables written by WriteTable
 // syst.Init(DECAY);             // DECAY = 1 for D0, 2, for D+, 3 for D*
 // syst.DrawErrors(); // to see a plot of the error contributions
 // syst.GetTotalSystErr(pt); // to get the total err at pt
@@ -39,6 +40,9 @@
 #include <TH2F.h>
 #include <TLegend.h>
 #include <TColor.h>
+#include <TFile.h>
+#include <TList.h>
+#include <TSystem.h>
 
 #include "AliLog.h"
 #include "AliHFSystErr.h"
@@ -69,7 +73,8 @@ AliHFSystErr::AliHFSystErr(const Char_t* name, const Char_t* title) :
   fIsBDTAnalysis(false),
   fIsCentScan(false),
   fStandardBins(false),
-  fIsRapidityScan(false)
+  fIsRapidityScan(false),
+  fSystFileName("")
 {
   //
   /// Default Constructor
@@ -104,6 +109,8 @@ void AliHFSystErr::Init(Int_t decay){
   //    AliFatal("Only settings for 2010 and the low energy runs are implemented so far");
   //  }
 
+  if (fSystFileName.Length()>0 && LoadTable(decay)) return;
+
   switch(decay) {
     case 1: // D0->Kpi
       if (fCollisionType==0) {
@@ -475,6 +482,90 @@ void AliHFSystErr::Init(Int_t decay){
 
 }
 
+//--------------------------------------------------------------------------
+TString AliHFSystErr::GetTableKey(Int_t decay) const {
+  //
+  /// Key of the table in the systematics file: decay, system, year,
+  /// centrality, rapidity and the analysis flags, i.e. all what selects
+  /// the Init* function in Init
+  //
+
+  Int_t flags = 0;
+  if (fIsLowEnergy)     flags |= 1<<0;
+  if (fIsLowPtAnalysis) flags |= 1<<1;
+  if (fIsPass4Analysis) flags |= 1<<2;
+  if (fIs5TeVAnalysis)  flags |= 1<<3;
+  if (fIsBDTAnalysis)   flags |= 1<<4;
+  if (fIsCentScan)      flags |= 1<<5;
+  if (fStandardBins)    flags |= 1<<6;
+  if (fIsRapidityScan)  flags |= 1<<7;
+  return Form("syst_%d_%d_%d_%s_%s_%d",decay,fCollisionType,fRunNumber,
+              fCentralityClass.Data(),fRapidityRange.Data(),flags);
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFSystErr::LoadTable(Int_t decay) {
+  //
+  /// Read only the table of the requested configuration from the systematics
+  /// file. Returns kFALSE if the file or the table is not there, in which
+  /// case Init uses the hard-coded values
+  //
+
+  TString fileName = fSystFileName;
+  gSystem->ExpandPathName(fileName);
+  TFile *f = TFile::Open(fileName.Data());
+  if (!f || f->IsZombie()) {
+    AliWarning(Form("Systematics file %s not found, using the built-in values",fileName.Data()));
+    delete f;
+    return kFALSE;
+  }
+  TString key = GetTableKey(decay);
+  TList *table = dynamic_cast<TList*>(f->Get(key.Data()));
+  if (!table) {
+    AliInfo(Form("Table %s not found in %s, using the built-in values",key.Data(),fileName.Data()));
+    f->Close(); delete f;
+    return kFALSE;
+  }
+
+  TH1F **hists[8] = {&fNorm,&fRawYield,&fTrackingEff,&fBR,&fCutsEff,&fPIDEff,&fMCPtShape,&fPartAntipart};
+  const char *names[8] = {"fNorm","fRawYield","fTrackingEff","fBR","fCutsEff","fPIDEff","fMCPtShape","fPartAntipart"};
+  for (Int_t i=0; i<8; i++) {
+    TH1F *h = dynamic_cast<TH1F*>(table->FindObject(names[i]));
+    *hists[i] = 0;
+    if (!h) continue;
+    h->SetDirectory(0);
+    table->Remove(h);
+    *hists[i] = h;
+  }
+  table->SetOwner();
+  delete table;
+  f->Close(); delete f;
+  AliInfo(Form("Systematics %s read from %s",key.Data(),fileName.Data()));
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFSystErr::WriteTable(Int_t decay, TString fileName) const {
+  //
+  /// Add the current histograms (i.e. after Init(decay)) to a systematics
+  /// file, under the key of the current configuration
+  //
+
+  TFile *f = TFile::Open(fileName.Data(),"UPDATE");
+  if (!f || f->IsZombie()) {
+    AliError(Form("Cannot open %s",fileName.Data()));
+    delete f;
+    return kFALSE;
+  }
+  TList table;
+  TH1F *hists[8] = {fNorm,fRawYield,fTrackingEff,fBR,fCutsEff,fPIDEff,fMCPtShape,fPartAntipart};
+  for (Int_t i=0; i<8; i++) if (hists[i]) table.Add(hists[i]);
+  f->cd();
+  table.Write(GetTableKey(decay).Data(),TObject::kSingleKey|TObject::kOverwrite);
+  f->Close(); delete f;
+  return kTRUE;
+}
+
 //--------------------------------------------------------------------------
 void AliHFSystErr::InitD0toKpi2010pp() {
   //
@@ -119,6 +119,14 @@ class AliHFSystErr : public TNamed
   /// Function to initialize the variables/histograms
   void Init(Int_t decay);
 
+  /// File with the tables of the systematics, looked up in Init before the
+  /// hard-coded Init* functions
+  void SetSystFile(TString fileName) { fSystFileName = fileName; }
+  TString GetSystFile() const { return fSystFileName; }
+  TString GetTableKey(Int_t decay) const;
+  Bool_t LoadTable(Int_t decay);
+  Bool_t WriteTable(Int_t decay, TString fileName) const;
+
   void InitD0toKpi2010PbPb010CentScan();
   void InitD0toKpi2010PbPb1020CentScan();
   void InitD0toKpi2010PbPb2040CentScan();
@@ -374,9 +382,10 @@ class AliHFSystErr : public TNamed
   Bool_t fIsCentScan;      /// flag fot the PbPb centrality scan
   Bool_t fStandardBins;    /// flag for the standard bins in pp@5TeV and pPb@5TeV
   Bool_t fIsRapidityScan;  /// flag for the pPb vs y measurement
+  TString fSystFileName;   /// file with the tables of the systematics, empty to use the Init* functions
 
   /// \cond CLASSIMP    
-  ClassDef(AliHFSystErr,10);  /// class for systematic errors of charm hadrons
+  ClassDef(AliHFSystErr,11);  /// class for systematic errors of charm hadrons
   /// \endcond
 };
 
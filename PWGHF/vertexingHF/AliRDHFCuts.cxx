@@ -92,6 +92,10 @@ fPidHF(0),
 fWhyRejection(0),
 fEvRejectionBits(0),
 fRemoveDaughtersFromPrimary(kFALSE),
+fRemoveDaughtersWithoutRefit(kFALSE),
+fPrimVtxForRemoval(0x0),
+fPrimVtxForRemovalRun(-1),
+fPrimVtxForRemovalEvent(0),
 fUseMCVertex(kFALSE),
 fUsePhysicsSelection(kTRUE),
 fOptPileup(0),
@@ -180,6 +184,10 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fWhyRejection(source.fWhyRejection),
   fEvRejectionBits(source.fEvRejectionBits),
   fRemoveDaughtersFromPrimary(source.fRemoveDaughtersFromPrimary),
+  fRemoveDaughtersWithoutRefit(source.fRemoveDaughtersWithoutRefit),
+  fPrimVtxForRemoval(0x0),
+  fPrimVtxForRemovalRun(-1),
+  fPrimVtxForRemovalEvent(0),
   fUseMCVertex(source.fUseMCVertex),
   fUsePhysicsSelection(source.fUsePhysicsSelection),
   fOptPileup(source.fOptPileup),
@@ -282,6 +290,10 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fWhyRejection=source.fWhyRejection;
   fEvRejectionBits=source.fEvRejectionBits;
   fRemoveDaughtersFromPrimary=source.fRemoveDaughtersFromPrimary;
+  fRemoveDaughtersWithoutRefit=source.fRemoveDaughtersWithoutRefit;
+  if(fPrimVtxForRemoval) {delete fPrimVtxForRemoval; fPrimVtxForRemoval=0x0;}
+  fPrimVtxForRemovalRun=-1;
+  fPrimVtxForRemovalEvent=0;
   fUseMCVertex=source.fUseMCVertex;
   fUsePhysicsSelection=source.fUsePhysicsSelection;
   fOptPileup=source.fOptPileup;
@@ -369,6 +381,7 @@ AliRDHFCuts::~AliRDHFCuts() {
     f1CutMinNCrossedRowsTPCPtDep = 0;
   }
   delete fAliEventCuts;
+  if(fPrimVtxForRemoval) {delete fPrimVtxForRemoval; fPrimVtxForRemoval=0x0;}
 }
 //---------------------------------------------------------------------------
 Int_t AliRDHFCuts::IsEventSelectedInCentrality(AliVEvent *event) {
@@ -1446,6 +1459,7 @@ void AliRDHFCuts::PrintAll() const {
   printf("Min SPD mult %d\n",fMinSPDMultiplicity);
   printf("Use PID %d  OldPid=%d\n",(Int_t)fUsePID,fPidHF ? fPidHF->GetOldPid() : -1);
   printf("Remove daughters from vtx %d\n",(Int_t)fRemoveDaughtersFromPrimary);
+  if(fRemoveDaughtersWithoutRefit) printf("  (subtracted from the full vertex fit, no refit)\n");
   printf("Physics selection: %s\n",fUsePhysicsSelection ? "Yes" : "No");
   printf("Pileup rejection: %s\n",(fOptPileup > 0) ? "Yes" : "No");
   if(fOptPileup==1) printf(" -- Reject pileup event");
@@ -1917,7 +1931,12 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
     return 0;
   }   
 
-  AliAODVertex *recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+  AliAODVertex *recvtx=0x0;
+  if(fRemoveDaughtersWithoutRefit) {
+    recvtx=d->RemoveDaughtersFromPrimaryVtx(aod,GetPrimaryVtxForRemoval(aod));
+  } else {
+    recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+  }
   if(!recvtx){
     AliDebug(2,"Removal of daughter tracks failed");
     return kFALSE;
@@ -1931,6 +1950,56 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
   return kTRUE;
 }
 //--------------------------------------------------------------------------
+AliESDVertex* AliRDHFCuts::GetPrimaryVtxForRemoval(AliAODEvent *aod) const
+{
+  //
+  // Primary vertex of the event as AliESDVertex with the indices of the
+  // tracks used in the fit, needed to subtract the daughters from it.
+  // Built once per event and kept for the following candidates
+  //
+
+  AliAODVertex *vtxAOD = aod->GetPrimaryVertex();
+  if(!vtxAOD) return 0x0;
+  TString title=vtxAOD->GetTitle();
+  if(!title.Contains("VertexerTracks")) return 0x0;
+
+  ULong64_t evId = aod->GetHeader() ? aod->GetHeader()->GetEventIdAsLong() : 0;
+  if(fPrimVtxForRemoval &&
+     fPrimVtxForRemovalRun==aod->GetRunNumber() &&
+     fPrimVtxForRemovalEvent==evId &&
+     fPrimVtxForRemoval->GetX()==vtxAOD->GetX() &&
+     fPrimVtxForRemoval->GetY()==vtxAOD->GetY() &&
+     fPrimVtxForRemoval->GetZ()==vtxAOD->GetZ()) return fPrimVtxForRemoval;
+
+  if(fPrimVtxForRemoval) {delete fPrimVtxForRemoval; fPrimVtxForRemoval=0x0;}
+
+  Int_t ntracks=aod->GetNumberOfTracks();
+  UShort_t *indices = new UShort_t[ntracks>0 ? ntracks : 1];
+  Int_t nindices=0;
+  for(Int_t i=0; i<ntracks; i++) {
+    AliAODTrack *t = dynamic_cast<AliAODTrack*>(aod->GetTrack(i));
+    if(!t || t->GetID()<0) continue;
+    if(t->GetUsedForPrimVtxFit()) indices[nindices++]=(UShort_t)t->GetID();
+  }
+
+  // same as done for the input vertex in AliAnalysisVertexingHF
+  Double_t pos[3],cov[6];
+  vtxAOD->GetXYZ(pos);
+  vtxAOD->GetCovarianceMatrix(cov);
+  Int_t ncontr=nindices;
+  if(title.Contains("WithConstraint")) ncontr += 1;
+  Double_t chi2=vtxAOD->GetChi2perNDF()*(2.*(Double_t)ncontr-3.);
+  fPrimVtxForRemoval = new AliESDVertex(pos,cov,chi2,ncontr,vtxAOD->GetName());
+  fPrimVtxForRemoval->SetTitle(vtxAOD->GetTitle());
+  fPrimVtxForRemoval->SetIndices(nindices,indices);
+  delete [] indices;
+
+  fPrimVtxForRemovalRun=aod->GetRunNumber();
+  fPrimVtxForRemovalEvent=evId;
+
+  return fPrimVtxForRemoval;
+}
+//--------------------------------------------------------------------------
 Bool_t AliRDHFCuts::SetMCPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const
 {
   //
@@ -227,6 +227,7 @@ class AliRDHFCuts : public AliAnalysisCuts
     fPidHF=new AliAODPidHF(*pidObj);
   }
   void SetRemoveDaughtersFromPrim(Bool_t removeDaughtersPrim) {fRemoveDaughtersFromPrimary=removeDaughtersPrim;}
+  void SetRemoveDaughtersWithoutRefit(Bool_t flag=kTRUE) {fRemoveDaughtersWithoutRefit=flag;}
   void SetMinPtCandidate(Double_t ptCand=-1.) {fMinPtCand=ptCand; return;}
   void SetMaxPtCandidate(Double_t ptCand=1000.) {fMaxPtCand=ptCand; return;}
   void SetMaxRapidityCandidate(Double_t ycand) {fMaxRapidityCand=ycand; return;}
@@ -290,6 +291,7 @@ class AliRDHFCuts : public AliAnalysisCuts
   }
   Bool_t  GetUseTrackSelectionWithFilterBits() const{return fUseTrackSelectionWithFilterBits;}
   Bool_t  GetIsPrimaryWithoutDaughters() const {return fRemoveDaughtersFromPrimary;}
+  Bool_t  GetRemoveDaughtersWithoutRefit() const {return fRemoveDaughtersWithoutRefit;}
   Bool_t GetOptPileUp() const {return fOptPileup;}
   Int_t GetUseCentrality() const {return fUseCentrality;}
   Float_t GetMinCentrality() const {return fMinCentrality;}
@@ -394,6 +396,7 @@ class AliRDHFCuts : public AliAnalysisCuts
   Bool_t GetUseMCVertex() const { return fUseMCVertex; }
 
   Bool_t RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const;
+  AliESDVertex* GetPrimaryVtxForRemoval(AliAODEvent *aod) const;
   Bool_t SetMCPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const;
   void   CleanOwnPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod,AliAODVertex *origownvtx) const;
 
@@ -463,6 +466,10 @@ class AliRDHFCuts : public AliAnalysisCuts
   Int_t fWhyRejection; /// used to code the step at which candidate was rejected
   UInt_t fEvRejectionBits; //bit map storing the full info about event rejection
   Bool_t fRemoveDaughtersFromPrimary; /// flag to switch on the removal of duaghters from the primary vertex computation
+  Bool_t fRemoveDaughtersWithoutRefit; /// remove the daughters by subtracting them from the full vertex fit instead of refitting
+  mutable AliESDVertex *fPrimVtxForRemoval; //! primary vertex of the current event with its contributors, for the removal without refit
+  mutable Int_t fPrimVtxForRemovalRun; //! run of fPrimVtxForRemoval
+  mutable ULong64_t fPrimVtxForRemovalEvent; //! event id of fPrimVtxForRemoval
   Bool_t fUseMCVertex; /// use MC primary vertex 
   Bool_t fUsePhysicsSelection; /// use Physics selection criteria
   Int_t  fOptPileup;      /// option for pielup selection
@@ -518,7 +525,7 @@ class AliRDHFCuts : public AliAnalysisCuts
   Int_t fSystemForNsigmaTPCDataCorr; /// system for data-driven NsigmaTPC correction
 
   /// \cond CLASSIMP    
-  ClassDef(AliRDHFCuts,48);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,49);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
@@ -450,14 +450,21 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
   Float_t RCeta = 0;
   Float_t RCphi = 0;
 
+  // the accepted constituents are collected once for all the cones of the event
+  std::vector<Float_t> consEta;
+  std::vector<Float_t> consPhi;
+  std::vector<Double_t> consPt;
+
   if (fTracksCont || fCaloClustersCont) {
 
+    GetConeConstituents(fTracksCont, fCaloClustersCont, consEta, consPhi, consPt);
+
     for (Int_t i = 0; i < fRCperEvent; i++) {
       // Simple random cones
       RCpt = 0;
       RCeta = 0;
       RCphi = 0;
-      GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, 0);
+      GetRandomCone(RCpt, RCeta, RCphi, consEta, consPhi, consPt, 0);
       if (RCpt > 0) {
         fHistRCPhiEta->Fill(RCeta, RCphi);
         fHistRhoVSRCPt[fCentBin]->Fill(fJetsCont->GetRhoVal() * rcArea, RCpt);
@@ -479,7 +486,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
         RCpt = 0;
         RCeta = 0;
         RCphi = 0;
-        GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet);
+        GetRandomCone(RCpt, RCeta, RCphi, consEta, consPhi, consPt, jet);
         if (RCpt > 0) {
           if (jet) {
             Float_t dphi = RCphi - jet->Phi();
@@ -497,7 +504,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
           RCpt = 0;
           RCeta = 0;
           RCphi = 0;
-          GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kTRUE);
+          GetRandomCone(RCpt, RCeta, RCphi, consEta, consPhi, consPt, jet, kTRUE);
 
           if (RCpt > 0) {
             if (jet) {
@@ -595,6 +602,63 @@ void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &p
   if (!tracks && !clusters)
     return;
 
+  std::vector<Float_t> consEta;
+  std::vector<Float_t> consPhi;
+  std::vector<Double_t> consPt;
+  GetConeConstituents(tracks, clusters, consEta, consPhi, consPt);
+
+  GetRandomCone(pt, eta, phi, consEta, consPhi, consPt, jet, bPartialExclusion);
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskDeltaPt::GetConeConstituents(AliParticleContainer* tracks, AliClusterContainer* clusters,
+    std::vector<Float_t> &eta, std::vector<Float_t> &phi, std::vector<Double_t> &pt) const
+{
+  // Accepted clusters and tracks (in this order) as summed in the random cones.
+
+  eta.clear();
+  phi.clear();
+  pt.clear();
+
+  if (clusters) {
+    clusters->ResetCurrentID();
+    AliVCluster* cluster = clusters->GetNextAcceptCluster();
+    while (cluster) {     
+      TLorentzVector nPart;
+      cluster->GetMomentum(nPart, const_cast<Double_t*>(fVertex));
+
+      eta.push_back(nPart.Eta());
+      phi.push_back(nPart.Phi());
+      pt.push_back(nPart.Pt());
+
+      cluster = clusters->GetNextAcceptCluster();
+    }
+  }
+
+  if (tracks) {
+    tracks->ResetCurrentID();
+    AliVParticle* track = tracks->GetNextAcceptParticle(); 
+    while(track) { 
+      eta.push_back(track->Eta());
+      phi.push_back(track->Phi());
+      pt.push_back(track->Pt());
+
+      track = tracks->GetNextAcceptParticle(); 
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi,
+    const std::vector<Float_t> &consEta, const std::vector<Float_t> &consPhi, const std::vector<Double_t> &consPt,
+    AliEmcalJet *jet, Bool_t bPartialExclusion) const
+{
+  // Get rigid cone from the constituents given by GetConeConstituents.
+
+  eta = -999;
+  phi = -999;
+  pt = 0;
+
   Float_t LJeta = 999;
   Float_t LJphi = 999;
 
@@ -642,47 +706,19 @@ void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &p
     return;
   }
 
-  if (clusters) {
-    clusters->ResetCurrentID();
-    AliVCluster* cluster = clusters->GetNextAcceptCluster();
-    while (cluster) {     
-      TLorentzVector nPart;
-      cluster->GetMomentum(nPart, const_cast<Double_t*>(fVertex));
-
-      Float_t cluseta = nPart.Eta();
-      Float_t clusphi = nPart.Phi();
-
-      if (TMath::Abs(clusphi - phi) > TMath::Abs(clusphi - phi + 2 * TMath::Pi()))
-        clusphi += 2 * TMath::Pi();
-      if (TMath::Abs(clusphi - phi) > TMath::Abs(clusphi - phi - 2 * TMath::Pi()))
-        clusphi -= 2 * TMath::Pi();
-
-      Float_t d = TMath::Sqrt((cluseta - eta) * (cluseta - eta) + (clusphi - phi) * (clusphi - phi));
-      if (d <= fConeRadius) 
-        pt += nPart.Pt();
-
-      cluster = clusters->GetNextAcceptCluster();
-    }
-  }
-
-  if (tracks) {
-    tracks->ResetCurrentID();
-    AliVParticle* track = tracks->GetNextAcceptParticle(); 
-    while(track) { 
-      Float_t tracketa = track->Eta();
-      Float_t trackphi = track->Phi();
+  const Int_t nCons = consPt.size();
+  for (Int_t iCons = 0; iCons < nCons; iCons++) {
+    Float_t conseta = consEta[iCons];
+    Float_t consphi = consPhi[iCons];
 
-      if (TMath::Abs(trackphi - phi) > TMath::Abs(trackphi - phi + 2 * TMath::Pi()))
-        trackphi += 2 * TMath::Pi();
-      if (TMath::Abs(trackphi - phi) > TMath::Abs(trackphi - phi - 2 * TMath::Pi()))
-        trackphi -= 2 * TMath::Pi();
+    if (TMath::Abs(consphi - phi) > TMath::Abs(consphi - phi + 2 * TMath::Pi()))
+      consphi += 2 * TMath::Pi();
+    if (TMath::Abs(consphi - phi) > TMath::Abs(consphi - phi - 2 * TMath::Pi()))
+      consphi -= 2 * TMath::Pi();
 
-      Float_t d = TMath::Sqrt((tracketa - eta) * (tracketa - eta) + (trackphi - phi) * (trackphi - phi));
-      if (d <= fConeRadius)
-        pt += track->Pt();
-
-      track = tracks->GetNextAcceptParticle(); 
-    }
+    Float_t d = TMath::Sqrt((conseta - eta) * (conseta - eta) + (consphi - phi) * (consphi - phi));
+    if (d <= fConeRadius)
+      pt += consPt[iCons];
   }
 }
 
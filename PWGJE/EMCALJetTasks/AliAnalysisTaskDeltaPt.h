@@ -12,6 +12,8 @@ class AliJetContainer;
 class AliParticleContainer;
 class AliClusterContainer;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
@@ -42,6 +44,11 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   void                        DoEmbClusterLoop()                                                                            ;
   void                        GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi, AliParticleContainer* tracks, AliClusterContainer* clusters,
 					    AliEmcalJet *jet = 0, Bool_t bPartialExclusion = 0) const;
+  void                        GetConeConstituents(AliParticleContainer* tracks, AliClusterContainer* clusters,
+                                                  std::vector<Float_t> &eta, std::vector<Float_t> &phi, std::vector<Double_t> &pt) const;
+  void                        GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi,
+                                            const std::vector<Float_t> &consEta, const std::vector<Float_t> &consPhi, const std::vector<Double_t> &consPt,
+                                            AliEmcalJet *jet = 0, Bool_t bPartialExclusion = 0) const;
   Double_t                    GetNColl() const;
 
 
@@ -26,7 +26,8 @@ ClassImp(AliAnalysisTaskRho)
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho() : 
   AliAnalysisTaskRhoBase("AliAnalysisTaskRho"),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fRhoVec()
 {
   // Constructor.
 }
@@ -34,7 +35,8 @@ AliAnalysisTaskRho::AliAnalysisTaskRho() :
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho(const char *name, Bool_t histo) :
   AliAnalysisTaskRhoBase(name, histo),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fRhoVec()
 {
   // Constructor.
 }
@@ -84,7 +86,8 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
-  static Double_t rhovec[999];
+  if (fRhoVec.size() < static_cast<size_t>(Njets)) fRhoVec.resize(Njets);
+  Double_t *rhovec = fRhoVec.data();
   Int_t NjetAcc = 0;
 
   // push all jets within selected acceptance into stack
@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <vector>
+
 #include "AliAnalysisTaskRhoBase.h"
 
 class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
@@ -30,10 +32,11 @@ class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
   Bool_t           Run();
 
   UInt_t           fNExclLeadJets;                 // number of leading jets to be excluded from the median calculation
+  std::vector<Double_t> fRhoVec;                  //! pt/area of the accepted jets, storage kept between events
 
   AliAnalysisTaskRho(const AliAnalysisTaskRho&);             // not implemented
   AliAnalysisTaskRho& operator=(const AliAnalysisTaskRho&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRho, 10); // Rho task
+  ClassDef(AliAnalysisTaskRho, 11); // Rho task
 };
 #endif
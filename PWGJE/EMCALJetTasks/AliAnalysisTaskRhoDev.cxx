@@ -15,8 +15,11 @@
 
 #include "AliAnalysisTaskRhoDev.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
 #include <TMath.h>
+#include <TVector2.h>
 
 #include <AliLog.h>
 #include <AliVEventHandler.h>
@@ -38,6 +41,15 @@ AliAnalysisTaskRhoDev::AliAnalysisTaskRhoDev() :
   fNExclLeadJets(0),
   fRhoSparse(kFALSE),
   fExclJetOverlap(),
+  fRhoMode(kKtJetMedian),
+  fGridPatchSize(0.4),
+  fGridEtaMin(-0.9),
+  fGridEtaMax(0.9),
+  fOutRhoMassName(),
+  fOutRhoMass(nullptr),
+  fGridPt(),
+  fGridMt(),
+  fRhoVec(),
   fOccupancyFactor(0),
   fHistOccCorrvsCent(nullptr)
 {
@@ -54,6 +66,15 @@ AliAnalysisTaskRhoDev::AliAnalysisTaskRhoDev(const char *name, Bool_t histo) :
   fNExclLeadJets(0),
   fRhoSparse(kFALSE),
   fExclJetOverlap(),
+  fRhoMode(kKtJetMedian),
+  fGridPatchSize(0.4),
+  fGridEtaMin(-0.9),
+  fGridEtaMax(0.9),
+  fOutRhoMassName(),
+  fOutRhoMass(nullptr),
+  fGridPt(),
+  fGridMt(),
+  fRhoVec(),
   fOccupancyFactor(0),
   fHistOccCorrvsCent(nullptr)
 {
@@ -73,6 +94,28 @@ void AliAnalysisTaskRhoDev::UserCreateOutputObjects()
   fOutput->Add(fHistOccCorrvsCent);
 }
 
+/**
+ * Execute once for the first event. Creates the rho_m object in grid mode
+ * and attaches it to the event if requested.
+ */
+void AliAnalysisTaskRhoDev::ExecOnce()
+{
+  if (fRhoMode == kGridMedian && !fOutRhoMassName.IsNull() && !fOutRhoMass) {
+    fOutRhoMass = new AliRhoParameter(fOutRhoMassName, 0);
+
+    if (fAttachToEvent) {
+      if (!(InputEvent()->FindListObject(fOutRhoMassName))) {
+        InputEvent()->AddObject(fOutRhoMass);
+      } else {
+        AliFatal(Form("%s: Container with same name %s already present. Aborting", GetName(), fOutRhoMassName.Data()));
+        return;
+      }
+    }
+  }
+
+  AliAnalysisTaskRhoBaseDev::ExecOnce();
+}
+
 /**
  * Finds the first two leading jets
  * @return A pair with the leading and sub-leading jets respectively as first and second element
@@ -100,17 +143,24 @@ std::pair<AliEmcalJet*, AliEmcalJet*> AliAnalysisTaskRhoDev::GetLeadingJets()
  */
 void AliAnalysisTaskRhoDev::CalculateRho()
 {
+  if (fRhoMode == kGridMedian) {
+    CalculateRhoGrid();
+    return;
+  }
+
   if (fJetCollArray.empty()) return;
 
   auto maxJets = GetLeadingJets();
 
-  static Double_t rhovec[999];
   Int_t NjetAcc = 0;
   Double_t TotaljetArea = 0; // Total area of background jets (including ghost jets)
   Double_t TotaljetAreaPhys = 0; // Total area of physical background jets (excluding ghost jets)
   // Ghost jet is a jet made only of ghost particles
 
   AliJetContainer* bkgJetCont = fJetCollArray["Background"];
+  const Int_t Njets = bkgJetCont->GetNEntries();
+  if (fRhoVec.size() < static_cast<size_t>(Njets)) fRhoVec.resize(Njets);
+  Double_t *rhovec = fRhoVec.data();
   AliJetContainer* sigJetCont = nullptr;
   if (!fExclJetOverlap.IsNull()) {
     auto sigJetContIt = fJetCollArray.find(fExclJetOverlap.Data());
@@ -163,6 +213,69 @@ void AliAnalysisTaskRhoDev::CalculateRho()
   }
 }
 
+/**
+ * Calculates the average background as the median of the pt density of the
+ * patches of a fixed eta-phi grid, filled with all accepted particles and clusters.
+ * Empty patches are included in the median, as in the grid median estimator of FastJet.
+ * rho_m is calculated in the same way from the sum of mt - pt of each patch.
+ * Rho is stored in fOutRho, rho_m in fOutRhoMass if requested.
+ */
+void AliAnalysisTaskRhoDev::CalculateRhoGrid()
+{
+  if (fOutRhoMass) fOutRhoMass->SetVal(0);
+
+  const Double_t etaRange = fGridEtaMax - fGridEtaMin;
+  if (etaRange <= 0 || fGridPatchSize <= 0) return;
+
+  const Int_t nEta = TMath::Max(1, TMath::Nint(etaRange / fGridPatchSize));
+  const Int_t nPhi = TMath::Max(1, TMath::Nint(TMath::TwoPi() / fGridPatchSize));
+  const Double_t invEtaSize = nEta / etaRange;
+  const Double_t invPhiSize = nPhi / TMath::TwoPi();
+  const Double_t patchArea = etaRange / nEta * TMath::TwoPi() / nPhi;
+
+  fGridPt.assign(nEta * nPhi, 0);
+  fGridMt.assign(nEta * nPhi, 0);
+
+  std::vector<AliEmcalContainer*> conts;
+  for (auto partCont : fParticleCollArray) conts.push_back(partCont.second);
+  for (auto clusCont : fClusterCollArray) conts.push_back(clusCont.second);
+
+  for (auto cont : conts) {
+    for (auto mom : cont->accepted_momentum()) {
+      Double_t eta = mom.first.Eta();
+      if (eta < fGridEtaMin || eta >= fGridEtaMax) continue;
+      Int_t iEta = TMath::Min(static_cast<Int_t>((eta - fGridEtaMin) * invEtaSize), nEta - 1);
+      Int_t iPhi = TMath::Min(static_cast<Int_t>(TVector2::Phi_0_2pi(mom.first.Phi()) * invPhiSize), nPhi - 1);
+      Int_t iPatch = iEta * nPhi + iPhi;
+      fGridPt[iPatch] += mom.first.Pt();
+      fGridMt[iPatch] += mom.first.Mt() - mom.first.Pt();
+    }
+  }
+
+  fOutRho->SetVal(GetGridMedian(fGridPt) / patchArea);
+  if (fOutRhoMass) fOutRhoMass->SetVal(GetGridMedian(fGridMt) / patchArea);
+}
+
+/**
+ * Median of the values of the grid patches, as TMath::Median() (average of the two
+ * central values for an even number of patches). The order of the values is changed.
+ * @param values Values of the grid patches
+ * @return The median
+ */
+Double_t AliAnalysisTaskRhoDev::GetGridMedian(std::vector<Double_t>& values)
+{
+  if (values.empty()) return 0;
+
+  auto mid = values.begin() + values.size() / 2;
+  std::nth_element(values.begin(), mid, values.end());
+  Double_t median = *mid;
+  if (values.size() % 2 == 0) {
+    median = (median + *std::max_element(values.begin(), mid)) / 2;
+  }
+
+  return median;
+}
+
 /**
  * Fill histograms.
  */
@@ -182,6 +295,15 @@ Bool_t AliAnalysisTaskRhoDev::FillHistograms()
  */
 Bool_t AliAnalysisTaskRhoDev::VerifyContainers()
 {
+  if (fRhoMode == kGridMedian) {
+    // the background jets (if any) are not used, see RemoveJetContainer("Background")
+    if (fParticleCollArray.empty() && fClusterCollArray.empty()) {
+      AliError("No particle or cluster collection found. Task will not run!");
+      return kFALSE;
+    }
+    return kTRUE;
+  }
+
   if (fJetCollArray.count("Background") == 0) {
     AliError("No signal jet collection found. Task will not run!");
     return kFALSE;
@@ -16,6 +16,7 @@
 #define ALIANALYSISTASKRHODEV_H
 
 #include <utility>
+#include <vector>
 
 #include "AliAnalysisTaskRhoBaseDev.h"
 
@@ -28,12 +29,23 @@
  * of the pt density of kt clusters. More details at: https://arxiv.org/pdf/0707.1378.pdf.
  * If scale function is given the scaled rho will be exported
  * with the name as "fOutRhoName".Apppend("_Scaled").
+ *
+ * Alternatively (SetRhoMode(kGridMedian)), the average background is calculated
+ * directly from the accepted particles and clusters, as the median of the pt density of
+ * the patches of a fixed eta-phi grid, without a kt clustering (see CalculateRhoGrid()).
+ * In this mode also rho_m can be exported (see SetOutRhoMassName()).
  * This is a development version. The stable version of this class
  * is AliAnalysisTaskRho.
  */
 class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
 
  public:
+  /// Method used to calculate the average background
+  enum ERhoMode_t {
+    kKtJetMedian = 0,    ///< median of the pt density of the kt jets
+    kGridMedian  = 1     ///< median of the pt density of the patches of an eta-phi grid
+  };
+
   AliAnalysisTaskRhoDev();
   AliAnalysisTaskRhoDev(const char *name, Bool_t histo=kFALSE);
   virtual ~AliAnalysisTaskRhoDev() {}
@@ -43,6 +55,10 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
   void             SetExcludeLeadJets(UInt_t n)    { fNExclLeadJets = n    ; }
   void             SetRhoSparse(Bool_t b)          { fRhoSparse     = b    ; }
   void             SetExclJetOverlap(TString n)    { fExclJetOverlap= n    ; }
+  void             SetRhoMode(ERhoMode_t m)        { fRhoMode       = m    ; }
+  void             SetGridPatchSize(Double_t s)    { fGridPatchSize = s    ; }
+  void             SetGridEtaRange(Double_t min, Double_t max) { fGridEtaMin = min ; fGridEtaMax = max ; }
+  void             SetOutRhoMassName(const char *name) { fOutRhoMassName = name ; }
 
   static AliAnalysisTaskRhoDev* AddTaskRhoDev(
      TString        nTracks                        = "usedefault",
@@ -59,7 +75,10 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
   );
 
  protected:
+  void          ExecOnce();
   void          CalculateRho();
+  void          CalculateRhoGrid();
+  static Double_t GetGridMedian(std::vector<Double_t>& values);
   Bool_t        FillHistograms();
   Bool_t        VerifyContainers();
 
@@ -69,6 +88,16 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
   UInt_t           fNExclLeadJets;                 ///< number of leading jets to be excluded from the median calculation
   Bool_t           fRhoSparse;                     ///< flag to run CMS method as described in https://arxiv.org/abs/1207.2392
   TString          fExclJetOverlap;                ///< name of the jet collection that should be used to reject jets that are considered "signal"
+  ERhoMode_t       fRhoMode;                       ///< method used to calculate the average background
+  Double_t         fGridPatchSize;                 ///< approximate size of the grid patches in eta and phi (grid mode)
+  Double_t         fGridEtaMin;                    ///< minimum eta of the grid (grid mode)
+  Double_t         fGridEtaMax;                    ///< maximum eta of the grid (grid mode)
+  TString          fOutRhoMassName;                ///< name of the output rho_m object (grid mode), not exported if empty
+
+  AliRhoParameter *fOutRhoMass;                    //!<!output rho_m object
+  std::vector<Double_t> fGridPt;                   //!<!sum of pt in each grid patch
+  std::vector<Double_t> fGridMt;                   //!<!sum of mt - pt in each grid patch
+  std::vector<Double_t> fRhoVec;                   //!<!pt/area of the accepted jets (median mode)
 
   Double_t         fOccupancyFactor;               //!<!occupancy correction factor for sparse events
   TH2F            *fHistOccCorrvsCent;             //!<!occupancy correction vs. centrality
@@ -77,7 +106,7 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
   AliAnalysisTaskRhoDev& operator=(const AliAnalysisTaskRhoDev&);  // not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskRhoDev, 2);
+  ClassDef(AliAnalysisTaskRhoDev, 4);
   /// \endcond
 };
 #endif
@@ -24,7 +24,10 @@ AliAnalysisTaskRhoMass::AliAnalysisTaskRhoMass() :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhomVec(),
+  fEVec(),
+  fMVec()
 {
   // Constructor.
 }
@@ -35,7 +38,10 @@ AliAnalysisTaskRhoMass::AliAnalysisTaskRhoMass(const char *name, Bool_t histo) :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhomVec(),
+  fEVec(),
+  fMVec()
 {
   // Constructor.
 }
@@ -101,9 +107,14 @@ Bool_t AliAnalysisTaskRhoMass::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
+  if (fRhomVec.size() < static_cast<size_t>(Njets)) {
+    fRhomVec.resize(Njets);
+    fEVec.resize(Njets);
+    fMVec.resize(Njets);
+  }
+  Double_t *rhomvec = fRhomVec.data();
+  Double_t *Evec = fEVec.data();
+  Double_t *Mvec = fMVec.data();
   Int_t NjetAcc = 0;
 
   // push all jets within selected acceptance into stack
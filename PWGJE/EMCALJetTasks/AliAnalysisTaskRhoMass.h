@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <vector>
+
 #include "AliAnalysisTaskRhoMassBase.h"
 
 class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
@@ -36,10 +38,13 @@ class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
   Bool_t           fPionMassClusters;              // assume pion mass for clusters
 
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
+  std::vector<Double_t> fRhomVec;                 //! Md/area of the accepted jets, storage kept between events
+  std::vector<Double_t> fEVec;                    //! energy of the accepted jets
+  std::vector<Double_t> fMVec;                    //! mass of the accepted jets
 
   AliAnalysisTaskRhoMass(const AliAnalysisTaskRhoMass&);             // not implemented
   AliAnalysisTaskRhoMass& operator=(const AliAnalysisTaskRhoMass&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMass, 2); // Rho_m task
+  ClassDef(AliAnalysisTaskRhoMass, 3); // Rho_m task
 };
 #endif
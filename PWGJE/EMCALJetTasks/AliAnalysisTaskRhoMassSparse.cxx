@@ -25,7 +25,10 @@ AliAnalysisTaskRhoMassSparse::AliAnalysisTaskRhoMassSparse() :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhomVec(),
+  fEVec(),
+  fMVec()
 {
   // Constructor.
 }
@@ -36,7 +39,10 @@ AliAnalysisTaskRhoMassSparse::AliAnalysisTaskRhoMassSparse(const char *name, Boo
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhomVec(),
+  fEVec(),
+  fMVec()
 {
   // Constructor.
 }
@@ -137,9 +143,14 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
+  if (fRhomVec.size() < static_cast<size_t>(Njets)) {
+    fRhomVec.resize(Njets);
+    fEVec.resize(Njets);
+    fMVec.resize(Njets);
+  }
+  Double_t *rhomvec = fRhomVec.data();
+  Double_t *Evec = fEVec.data();
+  Double_t *Mvec = fMVec.data();
   Int_t NjetAcc = 0;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
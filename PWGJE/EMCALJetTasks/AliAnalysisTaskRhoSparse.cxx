@@ -28,7 +28,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse() :
   fRhoCMS(0),
   fUseTPCArea(0),
   fExcludeAreaExcludedJets(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fRhoVec()
 {
   // Constructor.
 }
@@ -41,7 +42,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse(const char *name, Bool_t hist
   fRhoCMS(0),
   fUseTPCArea(0),
   fExcludeAreaExcludedJets(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fRhoVec()
 {
   // Constructor.
 }
@@ -131,7 +133,8 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     }
   }
 
-  static Double_t rhovec[999];
+  if (fRhoVec.size() < static_cast<size_t>(Njets)) fRhoVec.resize(Njets);
+  Double_t *rhovec = fRhoVec.data();
   Int_t NjetAcc = 0;
   Double_t TotaljetAreaPhys=0;
   Double_t TotalAreaCovered=0;
@@ -38,6 +38,8 @@
  * \date Oct 11, 2018
  */
 
+#include <vector>
+
 #include "AliAnalysisTaskRhoBase.h"
 
 class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
@@ -82,10 +84,11 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
   Bool_t           fUseTPCArea;                                       ///< use the full TPC area for the denominator of the occupancy calculation
   Bool_t           fExcludeAreaExcludedJets;                          ///<
   TH2F            *fHistOccCorrvsCent;            				                //!<! occupancy correction vs. centrality
+  std::vector<Double_t> fRhoVec;                                     //!<! pt/area of the accepted jets, storage kept between events
 
   AliAnalysisTaskRhoSparse(const AliAnalysisTaskRhoSparse&);           ///< not implemented
   AliAnalysisTaskRhoSparse& operator=(const AliAnalysisTaskRhoSparse&);///< not implemented
   
-  ClassDef(AliAnalysisTaskRhoSparse, 2);                               ///< Rho task
+  ClassDef(AliAnalysisTaskRhoSparse, 3);                               ///< Rho task
 };
 #endif
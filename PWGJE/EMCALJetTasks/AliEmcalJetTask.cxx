@@ -14,6 +14,10 @@
  **************************************************************************/
 
 #include <vector>
+#include <map>
+#include <string>
+#include <future>
+#include <utility>
 
 #include <TClonesArray.h>
 #include <TMath.h>
@@ -39,6 +43,7 @@
 #include "AliClusterContainer.h"
 #include "AliEmcalClusterJetConstituent.h"
 #include "AliEmcalParticleJetConstituent.h"
+#include "AliEmcalJetConstituentBlock.h"
 
 #include "AliEmcalJetTask.h"
 
@@ -52,6 +57,36 @@ ClassImp(AliEmcalJetTask);
 
 const Int_t AliEmcalJetTask::fgkConstIndexShift = 100000;
 
+namespace {
+  /**
+   * @struct AliEmcalJetTaskSharedInput
+   * @brief Input vectors of the current event, shared by the jet finders with the same shared input name
+   */
+  struct AliEmcalJetTaskSharedInput {
+    AliEmcalJetTaskSharedInput() : fEvent(0), fEntry(-1), fSignature(), fInputs() {}
+
+    const AliVEvent                *fEvent;      ///< event the input vectors belong to
+    Long64_t                        fEntry;      ///< entry the input vectors belong to
+    TString                         fSignature;  ///< constituent containers used to build the input vectors
+    std::vector<fastjet::PseudoJet> fInputs;     ///< input vectors
+  };
+  std::map<std::string, AliEmcalJetTaskSharedInput> gSharedJetInputs;
+
+  /**
+   * @struct AliEmcalJetTaskParallelGroup
+   * @brief Jet finders running their clustering concurrently, and the clusterings pending in the current event
+   */
+  struct AliEmcalJetTaskParallelGroup {
+    AliEmcalJetTaskParallelGroup() : fEvent(0), fEntry(-1), fMembers(), fPending() {}
+
+    const AliVEvent                *fEvent;      ///< event of the pending clusterings
+    Long64_t                        fEntry;      ///< entry of the pending clusterings
+    std::vector<AliEmcalJetTask*>   fMembers;    ///< jet finders of the group, in execution order
+    std::vector<std::pair<AliEmcalJetTask*, std::future<Int_t> > > fPending; ///< clusterings started in the current event
+  };
+  std::map<std::string, AliEmcalJetTaskParallelGroup> gParallelJetFinders;
+}
+
 /**
  * Default constructor. This constructor is only for ROOT I/O and
  * not to be used by users.
@@ -78,6 +113,7 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fRandom(0),
   fLocked(0),
   fFillConstituents(kTRUE),
+  fFillConstituentBlock(kFALSE),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -85,7 +121,11 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fSharedInputName(),
+  fSharedInputSignature(),
+  fParallelGroupName(),
   fJets(0),
+  fConstituentBlock(nullptr),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
@@ -118,6 +158,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fRandom(0),
   fLocked(0),
   fFillConstituents(kTRUE),
+  fFillConstituentBlock(kFALSE),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -125,7 +166,11 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fSharedInputName(),
+  fSharedInputSignature(),
+  fParallelGroupName(),
   fJets(0),
+  fConstituentBlock(nullptr),
   fFastJetWrapper(name,name),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
@@ -218,8 +263,14 @@ void AliEmcalJetTask::TerminateUtilities()
 Bool_t AliEmcalJetTask::Run()
 {
   InitEvent();
+  // clusterings of the parallel group left over from a previous event must not end up in this event
+  if (!fParallelGroupName.IsNull()) DiscardStaleParallelGroup();
   // clear the jet array (normally a null operation)
   fJets->Delete();
+  if (fConstituentBlock) fConstituentBlock->Clear();
+
+  if (!fParallelGroupName.IsNull()) return RunParallel();
+
   Int_t n = FindJets();
 
   if (n == 0) return kFALSE;
@@ -237,16 +288,115 @@ Bool_t AliEmcalJetTask::Run()
  * @return Total number of jets found.
  */
 Int_t AliEmcalJetTask::FindJets()
+{
+  if (!PrepareInputVectors()) return 0;
+
+  // run jet finder
+  fFastJetWrapper.Run();
+
+  return fFastJetWrapper.GetInclusiveJets().size();
+}
+
+/**
+ * Runs the jet finding of a jet finder belonging to a parallel group. The input vectors
+ * are prepared here, while the clustering is started in a separate thread. The last
+ * jet finder of the group in the event waits for all the clusterings of the group
+ * and fills the jet branches.
+ * @return kFALSE if there are no input vectors or, for the last jet finder of the group,
+ * if it did not find any jet. The other jet finders of the group only know their number
+ * of jets once the group is finished and return kTRUE if they have input vectors.
+ */
+Bool_t AliEmcalJetTask::RunParallel()
+{
+  AliEmcalJetTaskParallelGroup &group = gParallelJetFinders[fParallelGroupName.Data()];
+
+  group.fEvent = InputEvent();
+  group.fEntry = Entry();
+  Bool_t hasInput = PrepareInputVectors();
+  if (hasInput) {
+    AliFJWrapper *wrapper = &fFastJetWrapper;
+    group.fPending.push_back(std::make_pair(this, std::async(std::launch::async, [wrapper]() { return wrapper->Run(); })));
+  }
+
+  if (group.fMembers.empty() || group.fMembers.back() == this) {
+    FinishParallelGroup();
+    return hasInput && fFastJetWrapper.GetInclusiveJets().size() > 0;
+  }
+
+  return hasInput;
+}
+
+/**
+ * Waits for the clusterings pending in the parallel group of this jet finder if they
+ * were started in a previous event (i.e. the last jet finder of the group did not run
+ * in that event) and drops their results without filling any jet branch.
+ */
+void AliEmcalJetTask::DiscardStaleParallelGroup()
+{
+  AliEmcalJetTaskParallelGroup &group = gParallelJetFinders[fParallelGroupName.Data()];
+  if (group.fPending.empty() || (group.fEvent == InputEvent() && group.fEntry == Entry())) return;
+
+  AliDebug(2,Form("Discarding %d clusterings of parallel group '%s' left over from a previous event", (Int_t)group.fPending.size(), fParallelGroupName.Data()));
+  for (auto &pending : group.fPending) pending.second.wait();
+  group.fPending.clear();
+}
+
+/**
+ * Waits for the clusterings pending in the parallel group of this jet finder
+ * and fills the jet branches of the corresponding jet finders, in the order
+ * in which they were started.
+ */
+void AliEmcalJetTask::FinishParallelGroup()
+{
+  AliEmcalJetTaskParallelGroup &group = gParallelJetFinders[fParallelGroupName.Data()];
+  for (auto &pending : group.fPending) {
+    AliEmcalJetTask *task = pending.first;
+    pending.second.get();
+    if (task->fFastJetWrapper.GetInclusiveJets().size() > 0) task->FillJetBranch();
+  }
+  group.fPending.clear();
+}
+
+/**
+ * Fills the FastJet wrapper with the input vectors for this event, either from
+ * the particle and cluster containers or from the input shared with other jet finders.
+ * @return kTRUE if there is at least one input vector
+ */
+Bool_t AliEmcalJetTask::PrepareInputVectors()
 {
   if (fParticleCollArray.GetEntriesFast() == 0 && fClusterCollArray.GetEntriesFast() == 0){
     AliError("No tracks or clusters, returning.");
-    return 0;
+    return kFALSE;
   }
 
   fFastJetWrapper.Clear();
 
   AliDebug(2,Form("Jet type = %d", fJetType));
 
+  // input vectors already built by another jet finder for this event
+  Bool_t isSharedInputFilled = kFALSE;
+  std::vector<fastjet::PseudoJet> *sharedInput = fSharedInputName.IsNull() ? 0 : GetSharedInput(isSharedInputFilled);
+  if (sharedInput && isSharedInputFilled) {
+    AliDebug(2,Form("Using %d input vectors shared as '%s'", (Int_t)sharedInput->size(), fSharedInputName.Data()));
+    for (std::vector<fastjet::PseudoJet>::const_iterator it = sharedInput->begin(); it != sharedInput->end(); ++it) {
+      fFastJetWrapper.AddInputVector(it->px(), it->py(), it->pz(), it->E(), it->user_index());
+    }
+  }
+  else {
+    FillInputVectors();
+    if (sharedInput) *sharedInput = fFastJetWrapper.GetInputVectors();
+  }
+
+  return fFastJetWrapper.GetInputVectors().size() > 0;
+}
+
+/**
+ * Loops over all particle and cluster containers that were provided when the task
+ * was initialized and adds all accepted objects (tracks, particle, clusters)
+ * as input vectors to the FastJet wrapper.
+ */
+void AliEmcalJetTask::FillInputVectors()
+{
   Int_t iColl = 1;
   TIter nextPartColl(&fParticleCollArray);
   AliParticleContainer* tracks = 0;
@@ -287,13 +437,35 @@ Int_t AliEmcalJetTask::FindJets()
     }
     iColl++;
   }
+}
 
-  if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
-
-  // run jet finder
-  fFastJetWrapper.Run();
-
-  return fFastJetWrapper.GetInclusiveJets().size();
+/**
+ * Returns the input vectors shared among the jet finders with the same shared input name.
+ * The first jet finder running in an event finds them empty (isFilled = kFALSE) and
+ * is expected to fill them, the following ones in the same event only copy them.
+ * @param isFilled Set to kTRUE if the input vectors are already built for the current event
+ * @return Pointer to the shared input vectors, or null if this task cannot use them
+ */
+std::vector<fastjet::PseudoJet>* AliEmcalJetTask::GetSharedInput(Bool_t &isFilled)
+{
+  isFilled = kFALSE;
+  AliEmcalJetTaskSharedInput &shared = gSharedJetInputs[fSharedInputName.Data()];
+  if (shared.fSignature.IsNull()) shared.fSignature = fSharedInputSignature;
+  if (shared.fSignature != fSharedInputSignature) {
+    AliError(Form("%s: shared input '%s' is built from containers '%s', this task uses '%s'. Input vectors will not be shared.",
+        GetName(), fSharedInputName.Data(), shared.fSignature.Data(), fSharedInputSignature.Data()));
+    fSharedInputName = "";
+    return 0;
+  }
+  if (shared.fEvent == InputEvent() && shared.fEntry == Entry()) {
+    isFilled = kTRUE;
+  }
+  else {
+    shared.fEvent = InputEvent();
+    shared.fEntry = Entry();
+    shared.fInputs.clear();
+  }
+  return &shared.fInputs;
 }
 
 /**
@@ -312,6 +484,8 @@ void AliEmcalJetTask::FillJetBranch()
   GetSortedArray(indexes, jets_incl);
 
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
+  // each input vector ends up in at most one jet
+  if (fConstituentBlock) fConstituentBlock->Reserve(fFastJetWrapper.GetInputVectors().size());
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
     AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
@@ -428,6 +602,17 @@ void AliEmcalJetTask::ExecOnce()
     return;
   }
 
+  if (fFillConstituentBlock) {
+    TString blockName = GetConstituentBlockName();
+    if (!(InputEvent()->FindListObject(blockName))) {
+      fConstituentBlock = new PWG::JETFW::AliEmcalJetConstituentBlock(blockName);
+      InputEvent()->AddObject(fConstituentBlock);
+    }
+    else {
+      AliError(Form("%s: Object with name %s already in event! The constituent block will not be filled.", GetName(), blockName.Data()));
+    }
+  }
+
   // setup fj wrapper
   fFastJetWrapper.SetAreaType(fastjet::active_area_explicit_ghosts);
   fFastJetWrapper.SetGhostArea(fGhostArea);
@@ -450,6 +635,25 @@ void AliEmcalJetTask::ExecOnce()
   // containers' arrays are setup.
   fClusterContainerIndexMap.CopyMappingFrom(AliClusterContainer::GetEmcalContainerIndexMap(), fClusterCollArray);
   fParticleContainerIndexMap.CopyMappingFrom(AliParticleContainer::GetEmcalContainerIndexMap(), fParticleCollArray);
+
+  // Input vectors can only be shared among jet finders using the same containers in the same order,
+  // and not if tracks are randomly discarded by each jet finder
+  if (!fSharedInputName.IsNull()) {
+    if (fApplyArtificialTrackingEfficiency) {
+      AliWarning(Form("%s: Artificial tracking efficiency is applied, input vectors will not be shared as '%s'.", GetName(), fSharedInputName.Data()));
+      fSharedInputName = "";
+    }
+    else {
+      fSharedInputSignature = "";
+      TIter nextPartColl(&fParticleCollArray);
+      TObject* cont = 0;
+      while ((cont = nextPartColl())) fSharedInputSignature += Form("p:%s;", cont->GetName());
+      TIter nextClusColl(&fClusterCollArray);
+      while ((cont = nextClusColl())) fSharedInputSignature += Form("c:%s;", cont->GetName());
+    }
+  }
+
+  if (!fParallelGroupName.IsNull()) gParallelJetFinders[fParallelGroupName.Data()].fMembers.push_back(this);
 }
 
 /**
@@ -483,6 +687,19 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
   jet->SetNumberOfTracks(constituents.size());
   jet->SetNumberOfClusters(constituents.size());
 
+  if (fFillConstituents) {
+    UInt_t nParticleConstituents = 0, nClusterConstituents = 0;
+    for (auto &constituent : constituents) {
+      if (constituent.user_index() >= fgkConstIndexShift) ++nParticleConstituents;
+      else if (constituent.user_index() <= -fgkConstIndexShift) ++nClusterConstituents;
+    }
+    jet->ReserveConstituents(nParticleConstituents, nClusterConstituents);
+  }
+
+  // the compact block is only filled for the jets of the branch of this jet finder
+  PWG::JETFW::AliEmcalJetConstituentBlock *block = flag == 0 ? fConstituentBlock : nullptr;
+  Int_t blockOffset = block ? block->GetNConstituents() : -1;
+
   for (UInt_t ic = 0; ic < constituents.size(); ++ic) {
 
     if (flag == 0) {
@@ -537,6 +754,9 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
       if(fFillConstituents){
         jet->AddParticleConstituent(t, partCont->GetIsEmbedding(), fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid));
       }
+      if (block) {
+        block->AddConstituent(t->Px(), t->Py(), t->Pz(), t->E(), t->Charge(), iColl, fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid));
+      }
 
       Double_t cEta = t->Eta();
       Double_t cPhi = t->Phi();
@@ -602,6 +822,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
       Double_t cP   = nP.P();
       Double_t pvec[3] = {nP.Px(), nP.Py(), nP.Pz()};
       if(fFillConstituents) jet->AddClusterConstituent(c, (AliVCluster::VCluUserDefEnergy_t)clusCont->GetDefaultClusterEnergy(), pvec, clusCont->GetIsEmbedding(), fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid));
+      if (block) block->AddConstituent(nP.Px(), nP.Py(), nP.Pz(), nP.E(), 0, -1 - iColl, fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid));
 
       neutralE += cP;
       if (cPt > maxNe) maxNe = cPt;
@@ -654,6 +875,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
   jet->SetNumberOfNeutrals(nneutral);
   jet->SetMCPt(mcpt);
   jet->SetPtEmc(emcpt);
+  if (block) jet->SetConstituentBlockRange(blockOffset, block->GetNConstituents() - blockOffset);
   jet->SortConstituents();
 }
 
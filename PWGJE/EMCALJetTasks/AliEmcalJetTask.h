@@ -27,6 +27,12 @@ namespace fastjet {
   class PseudoJet;
 }
 
+namespace PWG {
+namespace JETFW {
+  class AliEmcalJetConstituentBlock;
+}
+}
+
 /**
  * @class AliEmcalJetTask
  * @brief General jet finder task implementing a wrapper for FastJet
@@ -47,6 +53,18 @@ namespace fastjet {
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
  * deriving a new class from AliEmcalJetUtility to interface functionalities of the FastJet contribs.
+ *
+ * Jet finders running on the same constituents (e.g. with different radii) can share
+ * the input vectors via SetSharedInputName(const char*): the first jet finder in each event
+ * builds them from the containers, the other ones with the same name copy them.
+ *
+ * Jet finders can also be put in a parallel group via SetParallelGroupName(const char*).
+ * Each of them prepares its input as usual and starts the clustering in a separate
+ * thread; the last jet finder of the group in the event waits for all of them and fills
+ * all the jet branches, so the jets are available to the tasks added after the group.
+ * The jet finders of a group must therefore be added one after the other to the
+ * analysis manager. If the last jet finder does not run in an event, the clusterings of
+ * that event are discarded. This requires FastJet to be built with thread safety enabled.
  */
 class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  public:
@@ -83,6 +101,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
+  void                   SetSharedInputName(const char *n)          { if (IsLocked()) return; fSharedInputName  = n     ; }
+  void                   SetParallelGroupName(const char *n)        { if (IsLocked()) return; fParallelGroupName = n    ; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
   void                   SetMinJetClusPt(Double_t min);
@@ -106,6 +126,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Double_t               GetMinJetPt()                    { return fMinJetPt          ; }
   Int_t                  GetMinMCLabel()                  { return fMinMCLabel        ; }
   Double_t               GetRadius()                      { return fRadius            ; }
+  const char*            GetSharedInputName()             { return fSharedInputName.Data(); }
+  const char*            GetParallelGroupName()           { return fParallelGroupName.Data(); }
   Int_t                  GetRecombScheme()                { return fRecombScheme      ; }
   Double_t               GetTrackEfficiency()             { return fTrackEfficiency   ; }
   Bool_t                 GetTrackEfficiencyOnlyForEmbedding() { return fTrackEfficiencyOnlyForEmbedding; }
@@ -133,6 +155,20 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
    */
   void                   SetFillJetConsituents(Bool_t doFill) { fFillConstituents = doFill; }
 
+  /**
+   * @brief Switch for whether to fill the compact constituent block of the jet branch
+   *
+   * If enabled, the momenta, charges, container ids and global indices of the constituents of
+   * all jets are stored in flat arrays in a PWG::JETFW::AliEmcalJetConstituentBlock added to the
+   * event with the name of the jet branch followed by "_constituents" (see GetConstituentBlockName()).
+   * Each jet refers to its constituents in the block via AliEmcalJet::GetConstituentBlockOffset()
+   * and AliEmcalJet::GetConstituentBlockLength(). Disabled by default.
+   *
+   * @param doFill Switch for filling the constituent block
+   */
+  void                   SetFillConstituentBlock(Bool_t doFill) { if (IsLocked()) return; fFillConstituentBlock = doFill; }
+  TString                GetConstituentBlockName() const      { return fJetsName + "_constituents"; }
+
   static AliEmcalJetTask* AddTaskEmcalJet(
       const TString nTracks                      = "usedefault",
       const TString nClusters                    = "usedefault",
@@ -157,6 +193,10 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  protected:
 
   Int_t                  FindJets();
+  Bool_t                 RunParallel();
+  void                   FinishParallelGroup();
+  void                   DiscardStaleParallelGroup();
+  Bool_t                 PrepareInputVectors();
   void                   FillJetBranch();
   void                   ExecOnce();
   void                   InitEvent();
@@ -169,6 +209,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 IsJetInDcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInPhos(Double_t eta, Double_t phi, Double_t r);
+  void                   FillInputVectors();
+  std::vector<fastjet::PseudoJet>* GetSharedInput(Bool_t &isFilled);
 
   TString                fJetsTag;                ///< tag of jet collection (usually = "Jets")
 
@@ -191,6 +233,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   TRandom3               fRandom;                 //!<! Random number generator for artificial tracking efficiency
   Bool_t                 fLocked;                 ///< true if lock is set
   Bool_t	          fFillConstituents;		 ///< If true jet consituents will be filled to the AliEmcalJet
+  Bool_t                 fFillConstituentBlock;   ///< If true the compact constituent block of the jet branch is filled
 
   TString                fJetsName;               //!<!name of jet collection
   Bool_t                 fIsInit;                 //!<!=true if already initialized
@@ -199,8 +242,12 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 fEnableAliBasicParticleCompatibility; ///< Flag to allow compatibility with AliBasicParticle constituents
   Bool_t                 fLegacyMode;             //!<!=true to enable FJ 2.x behavior
   Bool_t                 fFillGhost;              ///< =true ghost particles will be filled in AliEmcalJet obj
+  TString                fSharedInputName;        ///< jet finders with the same name (and constituent containers) share the input vectors built once per event
+  TString                fSharedInputSignature;   //!<!ordered names of the constituent containers, must match among jet finders sharing the input
+  TString                fParallelGroupName;      ///< jet finders with the same name run their clustering concurrently, the jets are filled by the last one
 
   TClonesArray          *fJets;                   //!<!jet collection
+  PWG::JETFW::AliEmcalJetConstituentBlock *fConstituentBlock; //!<!compact constituents of all jets of the event
   AliFJWrapper           fFastJetWrapper;         //!<!fastjet wrapper
 
   static const Int_t     fgkConstIndexShift;      //!<!contituent index shift
@@ -216,7 +263,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 29);
+  ClassDef(AliEmcalJetTask, 32);
   /// \endcond
 };
 #endif
@@ -18,7 +18,8 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor() :
   fJetsSub(0x0),
   fParticlesSub(0x0),
   fRhoParam(0),
-  fRhomParam(0)
+  fRhomParam(0),
+  fNSubtractionThreads(1)
 {
   // Dummy constructor.
 
@@ -39,7 +40,8 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor(const char*
   fRhoParam(0),
   fRhomParam(0),
   fAlpha(0),
-  fMaxDelR(-1)
+  fMaxDelR(-1),
+  fNSubtractionThreads(1)
 {
   // Default constructor.
 }
@@ -59,7 +61,8 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor(const AliEm
   fRhoParam(other.fRhoParam),
   fRhomParam(other.fRhomParam),
   fAlpha(0),
-  fMaxDelR(-1)
+  fMaxDelR(-1),
+  fNSubtractionThreads(other.fNSubtractionThreads)
 {
   // Copy constructor.
 }
@@ -82,6 +85,7 @@ AliEmcalJetUtilityConstSubtractor& AliEmcalJetUtilityConstSubtractor::operator=(
   fParticlesSub = other.fParticlesSub;
   fRhoParam = other.fRhoParam;
   fRhomParam = other.fRhomParam;
+  fNSubtractionThreads = other.fNSubtractionThreads;
   return *this;
 }
 
@@ -168,6 +172,7 @@ void AliEmcalJetUtilityConstSubtractor::Prepare(AliFJWrapper& fjw)
   fjw.SetUseExternalBkg(fUseExternalBkg, fRho, fRhom);
   fjw.SetAlpha(fAlpha);
   fjw.SetMaxDelR(fMaxDelR);
+  fjw.SetNSubtractionThreads(fNSubtractionThreads);
   fjw.DoConstituentSubtraction();
 }
 
@@ -190,8 +195,7 @@ void AliEmcalJetUtilityConstSubtractor::Terminate(AliFJWrapper& fjw)
   }
 
 #ifdef FASTJET_VERSION
-  std::vector<fastjet::PseudoJet> jets_sub;
-  jets_sub = fjw.GetConstituentSubtrJets();
+  const std::vector<fastjet::PseudoJet>& jets_sub = fjw.GetConstituentSubtrJets();
   AliDebug(1,Form("%d constituent subtracted jets found", (Int_t)jets_sub.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_sub.size(); ++ijet) {
     //Only storing 4-vector and jet area of unsubtracted jet
@@ -20,6 +20,7 @@ AliEmcalJetUtility(),
   fRMax(0.4),
   fDRStep(0.04),
   fPtMinGR(40.),
+  fNSubtractionThreads(1),
   fRhoParam(0),
   fRhomParam(0)
 {
@@ -42,6 +43,7 @@ AliEmcalJetUtilityGenSubtractor::AliEmcalJetUtilityGenSubtractor(const char* nam
   fRMax(0.4),
   fDRStep(0.04),
   fPtMinGR(40.),
+  fNSubtractionThreads(1),
   fRhoParam(0),
   fRhomParam(0)
 {
@@ -63,6 +65,7 @@ AliEmcalJetUtilityGenSubtractor::AliEmcalJetUtilityGenSubtractor(const AliEmcalJ
   fRMax(other.fRMax),
   fDRStep(other.fDRStep),
   fPtMinGR(other.fPtMinGR),
+  fNSubtractionThreads(other.fNSubtractionThreads),
   fRhoParam(other.fRhoParam),
   fRhomParam(other.fRhomParam)
 {
@@ -88,6 +91,7 @@ AliEmcalJetUtilityGenSubtractor& AliEmcalJetUtilityGenSubtractor::operator=(cons
   fRMax = other.fRMax;
   fDRStep = other.fDRStep;
   fPtMinGR = other.fPtMinGR;
+  fNSubtractionThreads = other.fNSubtractionThreads;
   fRhoParam = other.fRhoParam;
   fRhomParam = other.fRhomParam;
   return *this;
@@ -136,7 +140,9 @@ void AliEmcalJetUtilityGenSubtractor::Prepare(AliFJWrapper& fjw)
   if (fRhoParam) fRho = fRhoParam->GetVal();
   if (fRhomParam) fRhom = fRhomParam->GetVal();
 
-  //run generic subtractor
+  fjw.SetNSubtractionThreads(fNSubtractionThreads);
+
+  //run generic subtractor, all shapes of a group in one pass over the jets
   if (fDoGenericSubtractionJetMass) {
     fjw.SetUseExternalBkg(fUseExternalBkg,fRho,fRhom);
     fjw.DoGenericSubtractionJetMass();
@@ -144,29 +150,12 @@ void AliEmcalJetUtilityGenSubtractor::Prepare(AliFJWrapper& fjw)
  
  if (fDoGenericSubtractionExtraJetShapes) {
    fjw.SetUseExternalBkg(fUseExternalBkg,fRho,fRhom);
-   fjw.DoGenericSubtractionJetAngularity();
-   fjw.DoGenericSubtractionJetpTD();
-   fjw.DoGenericSubtractionJetCircularity();
-   fjw.DoGenericSubtractionJetSigma2();
-   fjw.DoGenericSubtractionJetConstituent();
-   fjw.DoGenericSubtractionJetLeSub();
+   fjw.DoGenericSubtractionExtraJetShapes();
  }
  
  if  (fDoGenericSubtractionNsubjettiness) {
    fjw.SetUseExternalBkg(fUseExternalBkg,fRho,fRhom);
-   fjw.DoGenericSubtractionJet1subjettiness_kt();
-   fjw.DoGenericSubtractionJet2subjettiness_kt();
-   fjw.DoGenericSubtractionJet3subjettiness_kt();
-   fjw.DoGenericSubtractionJetOpeningAngle_kt();
-   fjw.DoGenericSubtractionJet1subjettiness_ca();
-   fjw.DoGenericSubtractionJet2subjettiness_ca();
-   fjw.DoGenericSubtractionJetOpeningAngle_ca();
-   fjw.DoGenericSubtractionJet1subjettiness_akt02();
-   fjw.DoGenericSubtractionJet2subjettiness_akt02();
-   fjw.DoGenericSubtractionJetOpeningAngle_akt02();
-   fjw.DoGenericSubtractionJet1subjettiness_onepassca();
-   fjw.DoGenericSubtractionJet2subjettiness_onepassca();
-   fjw.DoGenericSubtractionJetOpeningAngle_onepassca();
+   fjw.DoGenericSubtractionNsubjettiness();
  }
 }
 
@@ -180,7 +169,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
 #ifdef FASTJET_VERSION
 
   if (fDoGenericSubtractionJetMass) {
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetMassInfo = fjw.GetGenSubtractorInfoJetMass();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetMassInfo = fjw.GetGenSubtractorInfoJetMass();
     Int_t n = (Int_t)jetMassInfo.size();
     if(n > ij && n > 0) {
       jet->GetShapeProperties()->SetFirstDerivative(jetMassInfo[ij].first_derivative());
@@ -219,7 +208,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
   }
 
   if (fDoGenericSubtractionExtraJetShapes) {
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetAngularityInfo = fjw.GetGenSubtractorInfoJetAngularity();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetAngularityInfo = fjw.GetGenSubtractorInfoJetAngularity();
     Int_t na = (Int_t)jetAngularityInfo.size();
     if(na > ij && na > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeAngularity(jetAngularityInfo[ij].first_derivative());
@@ -228,7 +217,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtractedAngularity(jetAngularityInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetpTDInfo = fjw.GetGenSubtractorInfoJetpTD();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetpTDInfo = fjw.GetGenSubtractorInfoJetpTD();
     Int_t np = (Int_t)jetpTDInfo.size();
     if(np > ij && np > 0) {
       jet->GetShapeProperties()->SetFirstDerivativepTD(jetpTDInfo[ij].first_derivative());
@@ -237,7 +226,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtractedpTD(jetpTDInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetCircularityInfo = fjw.GetGenSubtractorInfoJetCircularity();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetCircularityInfo = fjw.GetGenSubtractorInfoJetCircularity();
     Int_t nc = (Int_t)jetCircularityInfo.size();
     if(nc > ij && nc > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeCircularity(jetCircularityInfo[ij].first_derivative());
@@ -246,7 +235,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtractedCircularity(jetCircularityInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetSigma2Info = fjw.GetGenSubtractorInfoJetSigma2();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetSigma2Info = fjw.GetGenSubtractorInfoJetSigma2();
     Int_t ns = (Int_t)jetSigma2Info.size();
     if (ns > ij && ns > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeSigma2(jetSigma2Info[ij].first_derivative());
@@ -256,7 +245,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
     }
 
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetConstituentInfo = fjw.GetGenSubtractorInfoJetConstituent();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetConstituentInfo = fjw.GetGenSubtractorInfoJetConstituent();
     Int_t nco = (Int_t)jetConstituentInfo.size();
     if(nco > ij && nco > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeConstituent(jetConstituentInfo[ij].first_derivative());
@@ -265,7 +254,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtractedConstituent(jetConstituentInfo[ij].second_order_subtracted());
     }
     
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetLeSubInfo = fjw.GetGenSubtractorInfoJetLeSub();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetLeSubInfo = fjw.GetGenSubtractorInfoJetLeSub();
     Int_t nlsub = (Int_t)jetLeSubInfo.size();
     if(nlsub > ij && nlsub > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeLeSub(jetLeSubInfo[ij].first_derivative());
@@ -276,7 +265,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
   }
 
   if (fDoGenericSubtractionNsubjettiness) {
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet1subjettinessktInfo = fjw.GetGenSubtractorInfoJet1subjettiness_kt();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet1subjettinessktInfo = fjw.GetGenSubtractorInfoJet1subjettiness_kt();
     Int_t n1subjettiness_kt = (Int_t)jet1subjettinessktInfo.size();
     if(n1subjettiness_kt > ij && n1subjettiness_kt > 0) {
       jet->GetShapeProperties()->SetFirstDerivative1subjettiness_kt(jet1subjettinessktInfo[ij].first_derivative());
@@ -285,7 +274,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted1subjettiness_kt(jet1subjettinessktInfo[ij].second_order_subtracted());
     }
           
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet2subjettinessktInfo = fjw.GetGenSubtractorInfoJet2subjettiness_kt();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet2subjettinessktInfo = fjw.GetGenSubtractorInfoJet2subjettiness_kt();
     Int_t n2subjettiness_kt = (Int_t)jet2subjettinessktInfo.size();
     if(n2subjettiness_kt > ij && n2subjettiness_kt > 0) {
       jet->GetShapeProperties()->SetFirstDerivative2subjettiness_kt(jet2subjettinessktInfo[ij].first_derivative());
@@ -294,7 +283,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted2subjettiness_kt(jet2subjettinessktInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet3subjettinessktInfo = fjw.GetGenSubtractorInfoJet3subjettiness_kt();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet3subjettinessktInfo = fjw.GetGenSubtractorInfoJet3subjettiness_kt();
     Int_t n3subjettiness_kt = (Int_t)jet3subjettinessktInfo.size();
     if(n3subjettiness_kt > ij && n3subjettiness_kt > 0) {
       jet->GetShapeProperties()->SetFirstDerivative3subjettiness_kt(jet3subjettinessktInfo[ij].first_derivative());
@@ -303,7 +292,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted3subjettiness_kt(jet3subjettinessktInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetOpeningAnglektInfo = fjw.GetGenSubtractorInfoJetOpeningAngle_kt();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetOpeningAnglektInfo = fjw.GetGenSubtractorInfoJetOpeningAngle_kt();
     Int_t nOpeningAngle_kt = (Int_t)jetOpeningAnglektInfo.size();
     if(nOpeningAngle_kt > ij && nOpeningAngle_kt > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeOpeningAngle_kt(jetOpeningAnglektInfo[ij].first_derivative());
@@ -311,7 +300,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetFirstOrderSubtractedOpeningAngle_kt(jetOpeningAnglektInfo[ij].first_order_subtracted());
       jet->GetShapeProperties()->SetSecondOrderSubtractedOpeningAngle_kt(jetOpeningAnglektInfo[ij].second_order_subtracted());
     }
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet1subjettinesscaInfo = fjw.GetGenSubtractorInfoJet1subjettiness_ca();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet1subjettinesscaInfo = fjw.GetGenSubtractorInfoJet1subjettiness_ca();
     Int_t n1subjettiness_ca = (Int_t)jet1subjettinesscaInfo.size();
     if(n1subjettiness_ca > ij && n1subjettiness_ca > 0) {
       jet->GetShapeProperties()->SetFirstDerivative1subjettiness_ca(jet1subjettinesscaInfo[ij].first_derivative());
@@ -320,7 +309,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted1subjettiness_ca(jet1subjettinesscaInfo[ij].second_order_subtracted());
     }
           
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet2subjettinesscaInfo = fjw.GetGenSubtractorInfoJet2subjettiness_ca();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet2subjettinesscaInfo = fjw.GetGenSubtractorInfoJet2subjettiness_ca();
     Int_t n2subjettiness_ca = (Int_t)jet2subjettinesscaInfo.size();
     if(n2subjettiness_ca > ij && n2subjettiness_ca > 0) {
       jet->GetShapeProperties()->SetFirstDerivative2subjettiness_ca(jet2subjettinesscaInfo[ij].first_derivative());
@@ -329,7 +318,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted2subjettiness_ca(jet2subjettinesscaInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetOpeningAnglecaInfo = fjw.GetGenSubtractorInfoJetOpeningAngle_ca();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetOpeningAnglecaInfo = fjw.GetGenSubtractorInfoJetOpeningAngle_ca();
     Int_t nOpeningAngle_ca = (Int_t)jetOpeningAnglecaInfo.size();
     if(nOpeningAngle_ca > ij && nOpeningAngle_ca > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeOpeningAngle_ca(jetOpeningAnglecaInfo[ij].first_derivative());
@@ -337,7 +326,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetFirstOrderSubtractedOpeningAngle_ca(jetOpeningAnglecaInfo[ij].first_order_subtracted());
       jet->GetShapeProperties()->SetSecondOrderSubtractedOpeningAngle_ca(jetOpeningAnglecaInfo[ij].second_order_subtracted());
     }
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet1subjettinessakt02Info = fjw.GetGenSubtractorInfoJet1subjettiness_akt02();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet1subjettinessakt02Info = fjw.GetGenSubtractorInfoJet1subjettiness_akt02();
     Int_t n1subjettiness_akt02 = (Int_t)jet1subjettinessakt02Info.size();
     if(n1subjettiness_akt02 > ij && n1subjettiness_akt02 > 0) {
       jet->GetShapeProperties()->SetFirstDerivative1subjettiness_akt02(jet1subjettinessakt02Info[ij].first_derivative());
@@ -346,7 +335,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted1subjettiness_akt02(jet1subjettinessakt02Info[ij].second_order_subtracted());
     }
           
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet2subjettinessakt02Info = fjw.GetGenSubtractorInfoJet2subjettiness_akt02();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet2subjettinessakt02Info = fjw.GetGenSubtractorInfoJet2subjettiness_akt02();
     Int_t n2subjettiness_akt02 = (Int_t)jet2subjettinessakt02Info.size();
     if(n2subjettiness_akt02 > ij && n2subjettiness_akt02 > 0) {
       jet->GetShapeProperties()->SetFirstDerivative2subjettiness_akt02(jet2subjettinessakt02Info[ij].first_derivative());
@@ -355,7 +344,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted2subjettiness_akt02(jet2subjettinessakt02Info[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetOpeningAngleakt02Info = fjw.GetGenSubtractorInfoJetOpeningAngle_akt02();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetOpeningAngleakt02Info = fjw.GetGenSubtractorInfoJetOpeningAngle_akt02();
     Int_t nOpeningAngle_akt02 = (Int_t)jetOpeningAngleakt02Info.size();
     if(nOpeningAngle_akt02 > ij && nOpeningAngle_akt02 > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeOpeningAngle_akt02(jetOpeningAngleakt02Info[ij].first_derivative());
@@ -363,7 +352,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetFirstOrderSubtractedOpeningAngle_akt02(jetOpeningAngleakt02Info[ij].first_order_subtracted());
       jet->GetShapeProperties()->SetSecondOrderSubtractedOpeningAngle_akt02(jetOpeningAngleakt02Info[ij].second_order_subtracted());
     }
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet1subjettinessonepasscaInfo = fjw.GetGenSubtractorInfoJet1subjettiness_onepassca();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet1subjettinessonepasscaInfo = fjw.GetGenSubtractorInfoJet1subjettiness_onepassca();
     Int_t n1subjettiness_onepassca = (Int_t)jet1subjettinessonepasscaInfo.size();
     if(n1subjettiness_onepassca > ij && n1subjettiness_onepassca > 0) {
       jet->GetShapeProperties()->SetFirstDerivative1subjettiness_onepassca(jet1subjettinessonepasscaInfo[ij].first_derivative());
@@ -372,7 +361,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted1subjettiness_onepassca(jet1subjettinessonepasscaInfo[ij].second_order_subtracted());
     }
           
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jet2subjettinessonepasscaInfo = fjw.GetGenSubtractorInfoJet2subjettiness_onepassca();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jet2subjettinessonepasscaInfo = fjw.GetGenSubtractorInfoJet2subjettiness_onepassca();
     Int_t n2subjettiness_onepassca = (Int_t)jet2subjettinessonepasscaInfo.size();
     if(n2subjettiness_onepassca > ij && n2subjettiness_onepassca > 0) {
       jet->GetShapeProperties()->SetFirstDerivative2subjettiness_onepassca(jet2subjettinessonepasscaInfo[ij].first_derivative());
@@ -381,7 +370,7 @@ void AliEmcalJetUtilityGenSubtractor::ProcessJet(AliEmcalJet* jet, Int_t ij, Ali
       jet->GetShapeProperties()->SetSecondOrderSubtracted2subjettiness_onepassca(jet2subjettinessonepasscaInfo[ij].second_order_subtracted());
     }
 
-    std::vector<fastjet::contrib::GenericSubtractorInfo> jetOpeningAngleonepasscaInfo = fjw.GetGenSubtractorInfoJetOpeningAngle_onepassca();
+    const std::vector<fastjet::contrib::GenericSubtractorInfo>& jetOpeningAngleonepasscaInfo = fjw.GetGenSubtractorInfoJetOpeningAngle_onepassca();
     Int_t nOpeningAngle_onepassca = (Int_t)jetOpeningAngleonepasscaInfo.size();
     if(nOpeningAngle_onepassca > ij && nOpeningAngle_onepassca > 0) {
       jet->GetShapeProperties()->SetFirstDerivativeOpeningAngle_onepassca(jetOpeningAngleonepasscaInfo[ij].first_derivative());
@@ -35,7 +35,8 @@ AliAnalysisTaskEmcalJet("AliEmcalPicoTrackInGridMaker",kTRUE),
   fNCells(-1),
   fNCellsEMCal(-1),
   fNCellsDCal(-1),
-  fMultVsRho(0)
+  fMultVsRho(0),
+  fPatchRho()
 {
   // Constructor.
 
@@ -99,7 +100,8 @@ AliEmcalPicoTrackInGridMaker::AliEmcalPicoTrackInGridMaker(const char *name) :
   fNCells(-1),
   fNCellsEMCal(-1),
   fNCellsDCal(-1),
-  fMultVsRho(0)
+  fMultVsRho(0),
+  fPatchRho()
 {
   // Constructor.
 
@@ -410,7 +412,8 @@ Double_t AliEmcalPicoTrackInGridMaker::CalculateMedian(const Int_t patchType, co
   Int_t stepSize = GetTriggerPatchIdStepSizeNoOverlap(GetPatchDim(patchType),level);
   //Printf("patchType: %d dim: %d stepSizeNoOverlap: %d ",patchType,GetPatchDim(patchType),stepSize);
 
-  static Double_t arr[999];
+  if(fPatchRho.size()<static_cast<size_t>(n)) fPatchRho.resize(n);
+  Double_t *arr = fPatchRho.data();
   Int_t c = 0;
 
   //find patch with highest energy
@@ -467,8 +470,10 @@ Bool_t AliEmcalPicoTrackInGridMaker::CreateGridCells() {
   trackCont->ResetCurrentID();
   while((track = trackCont->GetNextAcceptParticle())) {
     if(track->Pt()<fMinCellE) continue;
-    Int_t id = GetGridID(track);
-    Int_t type = GetCellType(track);
+    const Double_t eta = track->Eta();
+    const Double_t phi = track->Phi();
+    Int_t id = GetGridID(eta,phi);
+    Int_t type = GetCellType(eta,phi);
     if(id>-1)
       fCellGrid[type].AddAt(fCellGrid[type].At(id)+track->Pt(),id);
     }
@@ -529,22 +534,31 @@ Bool_t AliEmcalPicoTrackInGridMaker::CreateGridPatches(const Int_t dim, const In
   //loop over edges of mini patches
   for(Int_t type = 0; type<2; type++) {
     Int_t np = 0; //patch number
-      for(Int_t j = 0; j<=(GetNColMiniPatches(type)-nm); j+=stepm) {
-    for(Int_t i = 0; i<=(GetNRowMiniPatches(type)-nm); i+=stepm) {
+    const Int_t nColMP = GetNColMiniPatches(type);
+    const Int_t nRowMP = GetNRowMiniPatches(type);
+      for(Int_t j = 0; j<=(nColMP-nm); j+=stepm) {
+    for(Int_t i = 0; i<=(nRowMP-nm); i+=stepm) {
       //      for(Int_t j = 0; j<=(GetNColMiniPatches(type)-nm); j+=stepm) {
-	//loop over mini patches in patch
+	//loop over mini patches in patch, summing in the same order as when adding to the grid directly
+	Double_t patchE = fPatchGrid[type][pt].At(np);
+	Int_t activeMPP = fActiveAreaMPP[type][pt].At(np);
+	Int_t activeCP = fActiveAreaCP[type][pt].At(np);
 	for(Int_t k = 0; k<nm; k++) {
 	  for(Int_t l = 0; l<nm; l++) {
 	    Int_t row = i+k;
 	    Int_t col = j+l;
-	    Int_t id = GetMiniPatchID(row,col,type);
-	    fPatchGrid[type][pt].AddAt(fPatchGrid[type][pt].At(np)+fMiniPatchGrid[type].At(id),np);
-	    if(fMiniPatchGrid[type].At(id)>0.) {
-	      fActiveAreaMPP[type][pt].AddAt(fActiveAreaMPP[type][pt].At(np)+1,np);
-	      fActiveAreaCP[type][pt].AddAt(fActiveAreaCP[type][pt].At(np)+fActiveAreaMP[type].At(id),np);
+	    Int_t id = row*nColMP + col; //GetMiniPatchID(row,col,type)
+	    const Double_t miniPatchE = fMiniPatchGrid[type].At(id);
+	    patchE += miniPatchE;
+	    if(miniPatchE>0.) {
+	      activeMPP++;
+	      activeCP += fActiveAreaMP[type].At(id);
 	    }
 	  }
 	}
+	fPatchGrid[type][pt].AddAt(patchE,np);
+	fActiveAreaMPP[type][pt].AddAt(activeMPP,np);
+	fActiveAreaCP[type][pt].AddAt(activeCP,np);
 	np++;
       }
     }
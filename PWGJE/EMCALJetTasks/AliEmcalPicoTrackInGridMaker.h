@@ -8,6 +8,8 @@ class TProfile;
 class TH3F;
 class AliEmcalJet;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
@@ -134,6 +136,8 @@ class AliEmcalPicoTrackInGridMaker : public AliAnalysisTaskEmcalJet {
 
   TH2F              *fMultVsRho;            //! track multiplicity vs rho from EMCal
 
-  ClassDef(AliEmcalPicoTrackInGridMaker, 3); // Task to make PicoTracks in a grid corresponding to EMCAL/DCAL acceptance
+  std::vector<Double_t> fPatchRho;          //! rho of the patches used for the median, storage kept between events
+
+  ClassDef(AliEmcalPicoTrackInGridMaker, 4); // Task to make PicoTracks in a grid corresponding to EMCAL/DCAL acceptance
 };
 #endif
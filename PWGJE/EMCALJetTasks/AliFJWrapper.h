@@ -4,6 +4,7 @@
 #if !defined(__CINT__)
 
 #include <vector>
+#include <functional>
 #include <TString.h>
 #include "AliLog.h"
 #include "FJ_includes.h"
@@ -53,28 +54,28 @@ class AliFJWrapper
   Double_t                                NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
   Double32_t                              NSubjettinessDerivativeSub(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Double_t JetR, fastjet::PseudoJet jet, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
 #ifdef FASTJET_VERSION
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetMass()        const {return fGenSubtractorInfoJetMass        ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetAngularity()  const {return fGenSubtractorInfoJetAngularity  ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetpTD()         const {return fGenSubtractorInfoJetpTD         ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetCircularity() const {return fGenSubtractorInfoJetCircularity ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetSigma2()      const {return fGenSubtractorInfoJetSigma2      ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetConstituent() const {return fGenSubtractorInfoJetConstituent ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetLeSub()       const {return fGenSubtractorInfoJetLeSub       ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet1subjettiness_kt()       const {return fGenSubtractorInfoJet1subjettiness_kt ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet2subjettiness_kt()       const {return fGenSubtractorInfoJet2subjettiness_kt ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet3subjettiness_kt()       const {return fGenSubtractorInfoJet3subjettiness_kt ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetOpeningAngle_kt()       const {return fGenSubtractorInfoJetOpeningAngle_kt ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet1subjettiness_ca()       const {return fGenSubtractorInfoJet1subjettiness_ca ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet2subjettiness_ca()       const {return fGenSubtractorInfoJet2subjettiness_ca ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetOpeningAngle_ca()       const {return fGenSubtractorInfoJetOpeningAngle_ca ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet1subjettiness_akt02()       const {return fGenSubtractorInfoJet1subjettiness_akt02 ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet2subjettiness_akt02()       const {return fGenSubtractorInfoJet2subjettiness_akt02 ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetOpeningAngle_akt02()       const {return fGenSubtractorInfoJetOpeningAngle_akt02 ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet1subjettiness_onepassca()       const {return fGenSubtractorInfoJet1subjettiness_onepassca ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet2subjettiness_onepassca()       const {return fGenSubtractorInfoJet2subjettiness_onepassca ; }
-  const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetOpeningAngle_onepassca()       const {return fGenSubtractorInfoJetOpeningAngle_onepassca ; }
-  const std::vector<fastjet::PseudoJet>                      GetConstituentSubtrJets()            const {return fConstituentSubtrJets            ; }
-  const std::vector<fastjet::PseudoJet>                      GetGroomedJets()            const {return fGroomedJets            ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetMass()        const {return fGenSubtractorInfoJetMass        ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetAngularity()  const {return fGenSubtractorInfoJetAngularity  ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetpTD()         const {return fGenSubtractorInfoJetpTD         ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetCircularity() const {return fGenSubtractorInfoJetCircularity ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetSigma2()      const {return fGenSubtractorInfoJetSigma2      ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetConstituent() const {return fGenSubtractorInfoJetConstituent ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetLeSub()       const {return fGenSubtractorInfoJetLeSub       ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet1subjettiness_kt()       const {return fGenSubtractorInfoJet1subjettiness_kt ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet2subjettiness_kt()       const {return fGenSubtractorInfoJet2subjettiness_kt ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet3subjettiness_kt()       const {return fGenSubtractorInfoJet3subjettiness_kt ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetOpeningAngle_kt()       const {return fGenSubtractorInfoJetOpeningAngle_kt ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet1subjettiness_ca()       const {return fGenSubtractorInfoJet1subjettiness_ca ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet2subjettiness_ca()       const {return fGenSubtractorInfoJet2subjettiness_ca ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetOpeningAngle_ca()       const {return fGenSubtractorInfoJetOpeningAngle_ca ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet1subjettiness_akt02()       const {return fGenSubtractorInfoJet1subjettiness_akt02 ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet2subjettiness_akt02()       const {return fGenSubtractorInfoJet2subjettiness_akt02 ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetOpeningAngle_akt02()       const {return fGenSubtractorInfoJetOpeningAngle_akt02 ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet1subjettiness_onepassca()       const {return fGenSubtractorInfoJet1subjettiness_onepassca ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJet2subjettiness_onepassca()       const {return fGenSubtractorInfoJet2subjettiness_onepassca ; }
+  const std::vector<fastjet::contrib::GenericSubtractorInfo>& GetGenSubtractorInfoJetOpeningAngle_onepassca()       const {return fGenSubtractorInfoJetOpeningAngle_onepassca ; }
+  const std::vector<fastjet::PseudoJet>&                     GetConstituentSubtrJets()            const {return fConstituentSubtrJets            ; }
+  const std::vector<fastjet::PseudoJet>&                     GetGroomedJets()            const {return fGroomedJets            ; }
   Int_t CreateGenSub();          // fastjet::contrib::GenericSubtractor
   Int_t CreateConstituentSub();  // fastjet::contrib::ConstituentSubtractor
   Int_t CreateEventConstituentSub(); //fastjet::contrib::ConstituentSubtractor
@@ -90,6 +91,9 @@ class AliFJWrapper
   virtual Int_t Run();
   virtual Int_t Filter();
   virtual void  DoGenericSubtraction(const fastjet::FunctionOfPseudoJet<Double32_t>& jetshape, std::vector<fastjet::contrib::GenericSubtractorInfo>& output);
+  virtual void  DoGenericSubtraction(const std::vector<const fastjet::FunctionOfPseudoJet<Double32_t>*>& jetshapes, const std::vector<std::vector<fastjet::contrib::GenericSubtractorInfo>*>& outputs);
+  virtual Int_t DoGenericSubtractionExtraJetShapes();
+  virtual Int_t DoGenericSubtractionNsubjettiness();
   virtual Int_t DoGenericSubtractionJetMass();
   virtual Int_t DoGenericSubtractionGR(Int_t ijet);
   virtual Int_t DoGenericSubtractionJetAngularity();
@@ -143,6 +147,9 @@ class AliFJWrapper
   void SetEventSub(Bool_t b) {fEventSub = b;}
   void SetMaxDelR(Double_t r)  {fMaxDelR = r;}
   void SetAlpha(Double_t a)  {fAlpha = a;}
+  // number of threads over which the jets are distributed in the generic and constituent subtraction;
+  // only used with an external background (thread-safe subtractors) and a FastJet built with thread safety
+  void SetNSubtractionThreads(Int_t n) {fNSubtractionThreads = n;}
 
  protected:
   TString                                fName;               //!
@@ -194,6 +201,7 @@ class AliFJWrapper
   Bool_t                                 fEventSub;
   Double_t                               fMaxDelR;
   Double_t                               fAlpha;
+  Int_t                                  fNSubtractionThreads; //!
 #ifdef FASTJET_VERSION
   fastjet::JetMedianBackgroundEstimator   *fBkrdEstimator;    //!
   //from contrib package
@@ -237,6 +245,8 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominatorSub; //!
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  Bool_t         CanRunSubtractionInParallel() const;
+  void           ForEachInclusiveJet(const std::function<void(UInt_t)>& process, Bool_t parallel);
 
  private:
   AliFJWrapper();
@@ -253,6 +263,9 @@ class AliFJWrapper
 #pragma GCC system_header
 #endif
 
+#include <atomic>
+#include <thread>
+
 namespace fj = fastjet;
 
 //_________________________________________________________________________________________________
@@ -299,6 +312,7 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fEventSub          (kFALSE)
   , fMaxDelR           (-1)
   , fAlpha             (0)
+  , fNSubtractionThreads (1)
 #ifdef FASTJET_VERSION
   , fBkrdEstimator     (0)
   , fGenSubtractor     (0)
@@ -398,6 +412,7 @@ void AliFJWrapper::CopySettingsFrom(const AliFJWrapper& wrapper)
   fUseExternalBkg   = wrapper.fUseExternalBkg;
   fRho              = wrapper.fRho;
   fRhom             = wrapper.fRhom;
+  fNSubtractionThreads = wrapper.fNSubtractionThreads;
 }
 
 //_________________________________________________________________________________________________
@@ -887,19 +902,131 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
 
 //_________________________________________________________________________________________________
 void AliFJWrapper::DoGenericSubtraction(const fastjet::FunctionOfPseudoJet<Double32_t>& jetshape, std::vector<fastjet::contrib::GenericSubtractorInfo>& output) {
-  //Do generic subtraction for 1subjettiness
+  //Do generic subtraction for one jet shape
+#ifdef FASTJET_VERSION
+  std::vector<const fj::FunctionOfPseudoJet<Double32_t>*> jetshapes(1, &jetshape);
+  std::vector<std::vector<fj::contrib::GenericSubtractorInfo>*> outputs(1, &output);
+  DoGenericSubtraction(jetshapes, outputs);
+#endif
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::DoGenericSubtraction(const std::vector<const fastjet::FunctionOfPseudoJet<Double32_t>*>& jetshapes, const std::vector<std::vector<fastjet::contrib::GenericSubtractorInfo>*>& outputs) {
+  // Do generic subtraction for several jet shapes in one pass over the jets,
+  // distributed over fNSubtractionThreads threads if possible.
+  // The result for shape k and jet i is (*outputs[k])[i], i.e. it has the
+  // index of the jet in fInclusiveJets, like with the single shape version
 #ifdef FASTJET_VERSION
   CreateGenSub();
-  
-  // clear the generic subtractor info vector
-  output.clear();
-  for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
-    fj::contrib::GenericSubtractorInfo info_jetshape;
-    if(fInclusiveJets[i].perp()>1.e-4)
-      double subtracted_shape = (*fGenSubtractor)(jetshape, fInclusiveJets[i], info_jetshape);
-    output.push_back(info_jetshape);
+
+  // reset the generic subtractor info vectors, keeping their memory
+  const UInt_t nShapes = jetshapes.size() < outputs.size() ? jetshapes.size() : outputs.size();
+  for (UInt_t k = 0; k < nShapes; k++) {
+    outputs[k]->assign(fInclusiveJets.size(), fj::contrib::GenericSubtractorInfo());
   }
+
+  ForEachInclusiveJet([&](UInt_t i) {
+    if (fInclusiveJets[i].perp() <= 1.e-4) return;
+    for (UInt_t k = 0; k < nShapes; k++) {
+      (*fGenSubtractor)(*jetshapes[k], fInclusiveJets[i], (*outputs[k])[i]);
+    }
+  }, CanRunSubtractionInParallel());
+#endif
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::DoGenericSubtractionExtraJetShapes() {
+  // Do generic subtraction for angularity, pTD, circularity, sigma2,
+  // number of constituents and LeSub in one pass over the jets
+#ifdef FASTJET_VERSION
+  AliJetShapeAngularity shapeAngularity;
+  AliJetShapepTD shapepTD;
+  AliJetShapeCircularity shapecircularity;
+  AliJetShapeSigma2 shapesigma2;
+  AliJetShapeConstituent shapeconst;
+  AliJetShapeLeSub shapeLeSub;
+
+  std::vector<const fj::FunctionOfPseudoJet<Double32_t>*> jetshapes = {
+    &shapeAngularity, &shapepTD, &shapecircularity, &shapesigma2, &shapeconst, &shapeLeSub
+  };
+  std::vector<std::vector<fj::contrib::GenericSubtractorInfo>*> outputs = {
+    &fGenSubtractorInfoJetAngularity, &fGenSubtractorInfoJetpTD, &fGenSubtractorInfoJetCircularity,
+    &fGenSubtractorInfoJetSigma2, &fGenSubtractorInfoJetConstituent, &fGenSubtractorInfoJetLeSub
+  };
+  DoGenericSubtraction(jetshapes, outputs);
 #endif
+  return 0;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::DoGenericSubtractionNsubjettiness() {
+  // Do generic subtraction for all the N-subjettiness and opening angle shapes in one pass over the jets
+#ifdef FASTJET_VERSION
+  AliJetShape1subjettiness_kt shape1subjettiness_kt;
+  AliJetShape2subjettiness_kt shape2subjettiness_kt;
+  AliJetShape3subjettiness_kt shape3subjettiness_kt;
+  AliJetShapeOpeningAngle_kt shapeOpeningAngle_kt;
+  AliJetShape1subjettiness_ca shape1subjettiness_ca;
+  AliJetShape2subjettiness_ca shape2subjettiness_ca;
+  AliJetShapeOpeningAngle_ca shapeOpeningAngle_ca;
+  AliJetShape1subjettiness_akt02 shape1subjettiness_akt02;
+  AliJetShape2subjettiness_akt02 shape2subjettiness_akt02;
+  AliJetShapeOpeningAngle_akt02 shapeOpeningAngle_akt02;
+  AliJetShape1subjettiness_onepassca shape1subjettiness_onepassca;
+  AliJetShape2subjettiness_onepassca shape2subjettiness_onepassca;
+  AliJetShapeOpeningAngle_onepassca shapeOpeningAngle_onepassca;
+
+  std::vector<const fj::FunctionOfPseudoJet<Double32_t>*> jetshapes = {
+    &shape1subjettiness_kt, &shape2subjettiness_kt, &shape3subjettiness_kt, &shapeOpeningAngle_kt,
+    &shape1subjettiness_ca, &shape2subjettiness_ca, &shapeOpeningAngle_ca,
+    &shape1subjettiness_akt02, &shape2subjettiness_akt02, &shapeOpeningAngle_akt02,
+    &shape1subjettiness_onepassca, &shape2subjettiness_onepassca, &shapeOpeningAngle_onepassca
+  };
+  std::vector<std::vector<fj::contrib::GenericSubtractorInfo>*> outputs = {
+    &fGenSubtractorInfoJet1subjettiness_kt, &fGenSubtractorInfoJet2subjettiness_kt, &fGenSubtractorInfoJet3subjettiness_kt, &fGenSubtractorInfoJetOpeningAngle_kt,
+    &fGenSubtractorInfoJet1subjettiness_ca, &fGenSubtractorInfoJet2subjettiness_ca, &fGenSubtractorInfoJetOpeningAngle_ca,
+    &fGenSubtractorInfoJet1subjettiness_akt02, &fGenSubtractorInfoJet2subjettiness_akt02, &fGenSubtractorInfoJetOpeningAngle_akt02,
+    &fGenSubtractorInfoJet1subjettiness_onepassca, &fGenSubtractorInfoJet2subjettiness_onepassca, &fGenSubtractorInfoJetOpeningAngle_onepassca
+  };
+  DoGenericSubtraction(jetshapes, outputs);
+#endif
+  return 0;
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliFJWrapper::CanRunSubtractionInParallel() const {
+  // The subtractors only read their state when the background is given externally
+  // (the background estimator computes rho lazily); the PseudoJet reference counting
+  // is only thread-safe if FastJet was built with --enable-thread-safety
+#if defined(FASTJET_VERSION) && defined(FASTJET_HAVE_THREAD_SAFETY)
+  return fUseExternalBkg && fNSubtractionThreads > 1;
+#else
+  return kFALSE;
+#endif
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ForEachInclusiveJet(const std::function<void(UInt_t)>& process, Bool_t parallel) {
+  // Call process(i) for all inclusive jets i, distributed dynamically over
+  // fNSubtractionThreads threads (jets with many constituents take much longer)
+
+  const UInt_t nJets = fInclusiveJets.size();
+  UInt_t nThreads = parallel && fNSubtractionThreads > 1 ? fNSubtractionThreads : 1;
+  if (nThreads > nJets) nThreads = nJets;
+
+  if (nThreads <= 1) {
+    for (UInt_t i = 0; i < nJets; i++) process(i);
+    return;
+  }
+
+  std::atomic<UInt_t> nextJet(0);
+  auto worker = [&]() {
+    for (UInt_t i = nextJet++; i < nJets; i = nextJet++) process(i);
+  };
+  std::vector<std::thread> workers;
+  for (UInt_t t = 1; t < nThreads; t++) workers.emplace_back(worker);
+  worker();
+  for (auto& w : workers) w.join();
 }
 
 //_________________________________________________________________________________________________
@@ -1234,14 +1361,12 @@ Int_t AliFJWrapper::DoConstituentSubtraction() {
   // fConstituentSubtractor->set_alpha(/* double alpha */);
   // fConstituentSubtractor->set_max_deltaR(/* double max_deltaR */);
 
-  //clear constituent subtracted jets
-  fConstituentSubtrJets.clear();
-  for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
-    fj::PseudoJet subtracted_jet(0.,0.,0.,0.);
+  //reset constituent subtracted jets, same index as the inclusive jets
+  fConstituentSubtrJets.assign(fInclusiveJets.size(), fj::PseudoJet(0.,0.,0.,0.));
+  ForEachInclusiveJet([&](UInt_t i) {
     if(fInclusiveJets[i].perp()>0.)
-      subtracted_jet = (*fConstituentSubtractor)(fInclusiveJets[i]);
-    fConstituentSubtrJets.push_back(subtracted_jet);
-  }
+      fConstituentSubtrJets[i] = (*fConstituentSubtractor)(fInclusiveJets[i]);
+  }, CanRunSubtractionInParallel());
   if(fConstituentSubtractor) { delete fConstituentSubtractor; fConstituentSubtractor = NULL; }
 
 #endif
@@ -12,6 +12,7 @@
 // ROOT
 #include <TFile.h>
 #include <TTree.h>
+#include <TBranch.h>
 #include <TClonesArray.h>
 #include <TObjArray.h>
 #include <TObjString.h>
@@ -87,6 +88,8 @@ AliJetEmbeddingFromAODTask::AliJetEmbeddingFromAODTask() :
   fCurrentAODFile(0),
   fPicoTrackVersion(0),
   fCurrentAODTree(0),
+  fAODHeaderBranch(0),
+  fAODVertexBranch(0),
   fAODHeader(0),
   fAODVertex(0),
   fAODTracks(0),
@@ -160,6 +163,8 @@ AliJetEmbeddingFromAODTask::AliJetEmbeddingFromAODTask(const char *name, Bool_t
   fCurrentAODFile(0),
   fPicoTrackVersion(0),
   fCurrentAODTree(0),
+  fAODHeaderBranch(0),
+  fAODVertexBranch(0),
   fAODHeader(0),
   fAODVertex(0),
   fAODTracks(0),
@@ -285,6 +290,9 @@ Bool_t AliJetEmbeddingFromAODTask::OpenNextFile()
     delete fCurrentAODFile;
     fCurrentAODFile = 0;
   }
+  fCurrentAODTree = 0;
+  fAODHeaderBranch = 0;
+  fAODVertexBranch = 0;
 
   Int_t i = 0;
 
@@ -317,23 +325,40 @@ Bool_t AliJetEmbeddingFromAODTask::OpenNextFile()
     return kFALSE;
   }
 
-  if (!fAODHeaderName.IsNull()) 
+  // Only the branches used for the embedding are read and decompressed
+  fCurrentAODTree->SetBranchStatus("*", 0);
+
+  if (!fAODHeaderName.IsNull()) {
+    fCurrentAODTree->SetBranchStatus(fAODHeaderName + "*", 1);
     fCurrentAODTree->SetBranchAddress(fAODHeaderName, &fAODHeader);
+    fAODHeaderBranch = fCurrentAODTree->GetBranch(fAODHeaderName);
+  }
   
-  if (!fAODVertexName.IsNull()) 
+  if (!fAODVertexName.IsNull()) {
+    fCurrentAODTree->SetBranchStatus(fAODVertexName + "*", 1);
     fCurrentAODTree->SetBranchAddress(fAODVertexName, &fAODVertex);
+    fAODVertexBranch = fCurrentAODTree->GetBranch(fAODVertexName);
+  }
       
-  if (!fAODTrackName.IsNull()) 
+  if (!fAODTrackName.IsNull()) {
+    fCurrentAODTree->SetBranchStatus(fAODTrackName + "*", 1);
     fCurrentAODTree->SetBranchAddress(fAODTrackName, &fAODTracks);
+  }
   
-  if (!fAODClusName.IsNull()) 
+  if (!fAODClusName.IsNull()) {
+    fCurrentAODTree->SetBranchStatus(fAODClusName + "*", 1);
     fCurrentAODTree->SetBranchAddress(fAODClusName, &fAODClusters);
+  }
   
-  if (!fAODCellsName.IsNull()) 
+  if (!fAODCellsName.IsNull()) {
+    fCurrentAODTree->SetBranchStatus(fAODCellsName + "*", 1);
     fCurrentAODTree->SetBranchAddress(fAODCellsName, &fAODCaloCells);
+  }
   
-  if (!fAODMCParticlesName.IsNull()) 
+  if (!fAODMCParticlesName.IsNull()) {
+    fCurrentAODTree->SetBranchStatus(fAODMCParticlesName + "*", 1);
     fCurrentAODTree->SetBranchAddress(fAODMCParticlesName, &fAODMCParticles);
+  }
   
   if (fRandomAccess) {
     fFirstAODEntry = TMath::Nint(gRandom->Rndm()*fCurrentAODTree->GetEntries())-1;
@@ -402,6 +427,7 @@ TFile* AliJetEmbeddingFromAODTask::GetNextFile()
 Bool_t AliJetEmbeddingFromAODTask::GetNextEntry() 
 {
   Int_t attempts = -1;
+  Bool_t headerSelected = kFALSE;
 
   do {
     if (fCurrentAODEntry+1 >= fLastAODEntry) { // in case it did not start from the first entry, it will go back
@@ -422,13 +448,21 @@ Bool_t AliJetEmbeddingFromAODTask::GetNextEntry()
     }
     
     fCurrentAODEntry++;
-    fCurrentAODTree->GetEntry(fCurrentAODEntry);
+
+    // The header and the vertex are read first: the other branches
+    // (tracks, clusters, cells...) are read only for the events passing
+    // the trigger, centrality and vertex selection
+    fCurrentAODTree->LoadTree(fCurrentAODEntry);
+    if (fAODHeaderBranch) fAODHeaderBranch->GetEntry(fCurrentAODEntry);
+    if (fAODVertexBranch) fAODVertexBranch->GetEntry(fCurrentAODEntry);
+    headerSelected = IsAODHeaderSelected();
+    if (headerSelected) fCurrentAODTree->GetEntry(fCurrentAODEntry);
 
     attempts++;
     if (attempts == 1000) 
       AliWarning("After 1000 attempts no event has been accepted by the event selection (trigger, centrality...)!");
 
-  } while (!IsAODEventSelected());
+  } while (!headerSelected || !IsAODEventSelected());
 
   if (fHistRejectedEvents)
     fHistRejectedEvents->Fill(attempts);
@@ -451,9 +485,9 @@ Bool_t AliJetEmbeddingFromAODTask::GetNextEntry()
 }
 
 //________________________________________________________________________
-Bool_t AliJetEmbeddingFromAODTask::IsAODEventSelected()
+Bool_t AliJetEmbeddingFromAODTask::IsAODHeaderSelected()
 {
-  // AOD event selection.
+  // AOD event selection based on the header and the vertex only.
 
   if (!fEsdTreeMode && fAODHeader) {
     AliAODHeader *aodHeader = static_cast<AliAODHeader*>(fAODHeader);
@@ -499,6 +533,17 @@ Bool_t AliJetEmbeddingFromAODTask::IsAODEventSelected()
       
   }
 
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliJetEmbeddingFromAODTask::IsAODEventSelected()
+{
+  // AOD event selection.
+
+  if (!IsAODHeaderSelected())
+    return kFALSE;
+
   // Particle selection
   if ((fParticleSelection == 1 && FindParticleInRange(fAODTracks)==kFALSE) ||
       (fParticleSelection == 2 && FindParticleInRange(fAODClusters)==kFALSE) ||
@@ -9,6 +9,7 @@
 // $Id$
 
 class TFile;
+class TBranch;
 class TObjArray;
 class TClonesArray;
 class TString;
@@ -67,6 +68,7 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   virtual Bool_t  OpenNextFile()        ;// open next file
   virtual Bool_t  GetNextEntry()        ;// get next entry in current tree
   virtual Bool_t  IsAODEventSelected()  ;// AOD event trigger/centrality selection
+  Bool_t          IsAODHeaderSelected() ;// AOD event trigger/centrality/vertex selection, needs only the header and vertex branches
   TLorentzVector  GetLeadingJet(TClonesArray *tracks, TClonesArray *clusters=0);  // get the leading jet
   Bool_t          FindParticleInRange(TClonesArray *array);// Find particle in array within range (fParticleMinPt, fParticleMaxPt)
 
@@ -112,6 +114,8 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   TFile         *fCurrentAODFile      ;//! Current open file
   Int_t          fPicoTrackVersion    ;//! Version of the PicoTrack class (if any) in fCurrentAODFile
   TTree         *fCurrentAODTree      ;//! Current open tree
+  TBranch       *fAODHeaderBranch     ;//! Header branch of the current tree, read before the full entry
+  TBranch       *fAODVertexBranch     ;//! Vertex branch of the current tree, read before the full entry
   AliVHeader    *fAODHeader           ;//! AOD header
   TClonesArray  *fAODVertex           ;//! AOD vertex
   TClonesArray  *fAODTracks           ;//! AOD track collection
@@ -133,6 +137,6 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   AliJetEmbeddingFromAODTask(const AliJetEmbeddingFromAODTask&);            // not implemented
   AliJetEmbeddingFromAODTask &operator=(const AliJetEmbeddingFromAODTask&); // not implemented
 
-  ClassDef(AliJetEmbeddingFromAODTask, 13) // Jet embedding from AOD task
+  ClassDef(AliJetEmbeddingFromAODTask, 14) // Jet embedding from AOD task
 };
 #endif
@@ -215,10 +215,9 @@ void AliJetFastSimulation::SimulateTracks()
     if(!accept) continue;
 
     AliPicoTrack *track = NULL;
-    if(fUseTrPtResolutionSmearing) {
-      track = SmearPt(picotrack,eff,rnd);
-      (*fTracksOut)[it] = track;
-    } else
+    if(fUseTrPtResolutionSmearing)
+      track = SmearPt(picotrack,eff,rnd,it);
+    else
       track = new ((*fTracksOut)[it]) AliPicoTrack(*picotrack);
 
     track->SetBit(TObject::kBitMask,1);
@@ -254,9 +253,9 @@ Bool_t AliJetFastSimulation::DiceEfficiency(AliPicoTrack *vp, Double_t eff[3], D
 }
 
 //________________________________________________________________________
-AliPicoTrack* AliJetFastSimulation::SmearPt(AliPicoTrack *vp, Double_t eff[3], Double_t rnd)
+AliPicoTrack* AliJetFastSimulation::SmearPt(AliPicoTrack *vp, Double_t eff[3], Double_t rnd, Int_t iout)
 {
-  //Smear momentum of generated particle
+  //Smear momentum of generated particle, the smeared track is created at position iout of fTracksOut
   Double_t smear = 1.;
   Double_t  pT = vp->Pt();
   //Select hybrid track category
@@ -277,7 +276,7 @@ AliPicoTrack* AliJetFastSimulation::SmearPt(AliPicoTrack *vp, Double_t eff[3], D
   Double_t pTrec = fRandom->Gaus(vp->Pt(),sigma);
   fh2PtGenPtSmeared->Fill(vp->Pt(),pTrec);
 
-  AliPicoTrack *picotrack = new AliPicoTrack(pTrec,
+  AliPicoTrack *picotrack = new ((*fTracksOut)[iout]) AliPicoTrack(pTrec,
 					     vp->Eta(),
 					     vp->Phi(),
 					     vp->Charge(),
@@ -298,10 +297,11 @@ Double_t AliJetFastSimulation::GetMomentumSmearing(Int_t cat, Double_t pt) {
   // Get smearing on generated momentum
   //
 
+  // the resolution profiles are only read, no need to clone them for each particle
   TProfile *fMomRes = 0x0;
-  if(cat==1 && fMomResH1) fMomRes = (TProfile*)fMomResH1->Clone("fMomRes");
-  if(cat==2 && fMomResH2) fMomRes = (TProfile*)fMomResH2->Clone("fMomRes");
-  if(cat==3 && fMomResH3) fMomRes = (TProfile*)fMomResH3->Clone("fMomRes");
+  if(cat==1 && fMomResH1) fMomRes = fMomResH1;
+  if(cat==2 && fMomResH2) fMomRes = fMomResH2;
+  if(cat==3 && fMomResH3) fMomRes = fMomResH3;
 
   if(!fMomRes)
     return 0.;
@@ -316,8 +316,6 @@ Double_t AliJetFastSimulation::GetMomentumSmearing(Int_t cat, Double_t pt) {
     Int_t bin = fMomRes->FindBin(pt);
     smear = fRandom->Gaus(fMomRes->GetBinContent(bin),fMomRes->GetBinError(bin));
   }
-  
-  if(fMomRes) delete fMomRes;
 
   return smear;
 }
@@ -35,7 +35,7 @@ class AliJetFastSimulation : public AliAnalysisTaskEmcal {
 
   void                   SimulateTracks();
   Bool_t                 DiceEfficiency(AliPicoTrack *vp, Double_t eff[3], Double_t rnd);
-  AliPicoTrack          *SmearPt(AliPicoTrack *vp, Double_t eff[3], Double_t rnd);
+  AliPicoTrack          *SmearPt(AliPicoTrack *vp, Double_t eff[3], Double_t rnd, Int_t iout);
   Double_t               GetMomentumSmearing(Int_t cat, Double_t pt);
   void                   FitMomentumResolution();
   void                   LoadTrEfficiencyRootFileFromOADB();
@@ -19,6 +19,7 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
 #include <TClonesArray.h>
 #include <TH2F.h>
 #include <THnSparse.h>
@@ -120,7 +121,11 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fHistDeltaMCPtvsArea1(0),
   fHistDeltaMCPtvsArea2(0),
   fHistDeltaMCPtvsDeltaArea(0),
-  fHistJet1MCPtvsJet2Pt(0)
+  fHistJet1MCPtvsJet2Pt(0),
+  fSortedJet1(0),
+  fSortedJet1Matching(kNoMatching),
+  fSortedJet1Tracks(),
+  fSortedJet1Clusters()
 {
   // Default constructor.
 
@@ -209,7 +214,11 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fHistDeltaMCPtvsArea1(0),
   fHistDeltaMCPtvsArea2(0),
   fHistDeltaMCPtvsDeltaArea(0),
-  fHistJet1MCPtvsJet2Pt(0)
+  fHistJet1MCPtvsJet2Pt(0),
+  fSortedJet1(0),
+  fSortedJet1Matching(kNoMatching),
+  fSortedJet1Tracks(),
+  fSortedJet1Clusters()
 {
   // Standard constructor.
 
@@ -1426,6 +1435,9 @@ void AliJetResponseMaker::DoJetLoop()
   AliEmcalJet* jet1 = 0;
   AliEmcalJet* jet2 = 0;
 
+  // jet objects are reused from one event to the next
+  fSortedJet1 = 0;
+
   jets2->ResetCurrentID();
   while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
 
@@ -1534,29 +1546,17 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
     }
   }
 
+  SortJet1Constituents(jet1, kMCLabel);
+
   for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
     Bool_t track2Found = kFALSE;
     Int_t index2 = jet2->TrackAt(iTrack2);
 
     // now look for common particles in the track array
-    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+    for (std::vector<std::pair<Int_t, Int_t> >::const_iterator it = std::lower_bound(fSortedJet1Tracks.begin(), fSortedJet1Tracks.end(), std::make_pair(index2, -1));
+         it != fSortedJet1Tracks.end() && it->first == index2; ++it) {
+      Int_t iTrack = it->second;
       AliVParticle *track = jet1->Track(iTrack);
-      if (!track) {
-        AliWarning(Form("Could not find track %d!", iTrack));
-        continue;
-      }
-      Int_t MClabel = TMath::Abs(track->GetLabel());
-      MClabel -= fMCLabelShift;	  
-      if (MClabel <= 0) continue;
-
-      Int_t index = -1;
-      index = tracks2->GetIndexFromLabel(MClabel);
-      if (index < 0) {
-        AliDebug(2,Form("Track %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
-        continue;
-      }
-
-      if (index2 != index) continue;
 
       // found common particle
       d1 -= track->Pt();
@@ -1564,7 +1564,7 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
       if (!track2Found) {
         AliVParticle *MCpart = jet2->Track(iTrack2);
         AliDebug(3,Form("Track %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
-            iTrack,track->Pt(),track->Eta(),track->Phi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
+            iTrack,track->Pt(),track->Eta(),track->Phi(),TMath::Abs(track->GetLabel())-fMCLabelShift,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
         d2 -= MCpart->Pt();
       }
 
@@ -1690,26 +1690,29 @@ void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, Ali
 
   if (tracks1 && tracks2) {
 
+    SortJet1Constituents(jet1, kSameCollections);
+
     for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
       Int_t index2 = jet2->TrackAt(iTrack2);
-      for (Int_t iTrack1 = 0; iTrack1 < jet1->GetNumberOfTracks(); iTrack1++) {
-        Int_t index1 = jet1->TrackAt(iTrack1);
-        if (index2 == index1) { // found common particle
-          AliVParticle *part1 = jet1->Track(iTrack1);
-          if (!part1) {
-            AliWarning(Form("Could not find track %d!", index1));
-            continue;
-          }
-          AliVParticle *part2 = jet2->Track(iTrack2);
-          if (!part2) {
-            AliWarning(Form("Could not find track %d!", index2));
-            continue;
-          }
-
-          d1 -= part1->Pt();
-          d2 -= part2->Pt();
-          break;
+      // tracks of jet 1 with the same index, in their order in jet 1
+      for (std::vector<std::pair<Int_t, Int_t> >::const_iterator it = std::lower_bound(fSortedJet1Tracks.begin(), fSortedJet1Tracks.end(), std::make_pair(index2, -1));
+           it != fSortedJet1Tracks.end() && it->first == index2; ++it) {
+        Int_t iTrack1 = it->second;
+        // found common particle
+        AliVParticle *part1 = jet1->Track(iTrack1);
+        if (!part1) {
+          AliWarning(Form("Could not find track %d!", index2));
+          continue;
+        }
+        AliVParticle *part2 = jet2->Track(iTrack2);
+        if (!part2) {
+          AliWarning(Form("Could not find track %d!", index2));
+          continue;
         }
+
+        d1 -= part1->Pt();
+        d2 -= part2->Pt();
+        break;
       }
     }
 
@@ -1820,29 +1823,32 @@ void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, Ali
       }
     }
     else {
+      SortJet1Constituents(jet1, kSameCollections);
+
       for (Int_t iClus2 = 0; iClus2 < jet2->GetNumberOfClusters(); iClus2++) {
         Int_t index2 = jet2->ClusterAt(iClus2);
-        for (Int_t iClus1 = 0; iClus1 < jet1->GetNumberOfClusters(); iClus1++) {
-          Int_t index1 = jet1->ClusterAt(iClus1);
-          if (index2 == index1) { // found common particle
-            AliVCluster *clus1 = jet1->Cluster(iClus1);
-            if (!clus1) {
-              AliWarning(Form("Could not find cluster %d!", index1));
-              continue;
-            }
-            AliVCluster *clus2 =  jet2->Cluster(iClus2);
-            if (!clus2) {
-              AliWarning(Form("Could not find cluster %d!", index2));
-              continue;
-            }
-            TLorentzVector part1, part2;
-            clus1->GetMomentum(part1, fVertex);
-            clus2->GetMomentum(part2, fVertex);
-
-            d1 -= part1.Pt();
-            d2 -= part2.Pt();
-            break;
+        // clusters of jet 1 with the same index, in their order in jet 1
+        for (std::vector<std::pair<Int_t, Int_t> >::const_iterator it = std::lower_bound(fSortedJet1Clusters.begin(), fSortedJet1Clusters.end(), std::make_pair(index2, -1));
+             it != fSortedJet1Clusters.end() && it->first == index2; ++it) {
+          Int_t iClus1 = it->second;
+          // found common particle
+          AliVCluster *clus1 = jet1->Cluster(iClus1);
+          if (!clus1) {
+            AliWarning(Form("Could not find cluster %d!", index2));
+            continue;
+          }
+          AliVCluster *clus2 =  jet2->Cluster(iClus2);
+          if (!clus2) {
+            AliWarning(Form("Could not find cluster %d!", index2));
+            continue;
           }
+          TLorentzVector part1, part2;
+          clus1->GetMomentum(part1, fVertex);
+          clus2->GetMomentum(part2, fVertex);
+
+          d1 -= part1.Pt();
+          d2 -= part2.Pt();
+          break;
         }
       }
     }
@@ -1865,6 +1871,55 @@ void AliJetResponseMaker::GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, Ali
     d2 = -1;
 }
 
+//________________________________________________________________________
+void AliJetResponseMaker::SortJet1Constituents(AliEmcalJet *jet1, MatchingType matching) const
+{
+  // Sort the constituents of jet 1 by index, once for all the jets 2 it is compared to.
+  // For kMCLabel the track index is the one of the associated MC particle in tracks 2,
+  // tracks without it are left out. Equal indexes keep their order in jet 1.
+
+  if (jet1 == fSortedJet1 && matching == fSortedJet1Matching) return;
+
+  fSortedJet1 = jet1;
+  fSortedJet1Matching = matching;
+  fSortedJet1Tracks.clear();
+  fSortedJet1Clusters.clear();
+
+  if (matching == kMCLabel) {
+    AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+    AliParticleContainer *tracks2 = jets2->GetParticleContainer();
+
+    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+      AliVParticle *track = jet1->Track(iTrack);
+      if (!track) {
+        AliWarning(Form("Could not find track %d!", iTrack));
+        continue;
+      }
+      Int_t MClabel = TMath::Abs(track->GetLabel());
+      MClabel -= fMCLabelShift;
+      if (MClabel <= 0) continue;
+
+      Int_t index = tracks2->GetIndexFromLabel(MClabel);
+      if (index < 0) {
+        AliDebug(2,Form("Track %d (pT = %f) does not have an associated MC particle (MClabel = %d)!",iTrack,track->Pt(),MClabel));
+        continue;
+      }
+      fSortedJet1Tracks.push_back(std::make_pair(index, iTrack));
+    }
+  }
+  else {
+    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+      fSortedJet1Tracks.push_back(std::make_pair(jet1->TrackAt(iTrack), iTrack));
+    }
+    for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+      fSortedJet1Clusters.push_back(std::make_pair(jet1->ClusterAt(iClus), iClus));
+    }
+  }
+
+  std::sort(fSortedJet1Tracks.begin(), fSortedJet1Tracks.end());
+  std::sort(fSortedJet1Clusters.begin(), fSortedJet1Clusters.end());
+}
+
 //________________________________________________________________________
 void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, MatchingType matching) 
 {
@@ -1922,6 +1977,8 @@ Bool_t AliJetResponseMaker::FillHistograms()
   AliEmcalJet* jet1 = 0;  
   AliEmcalJet* jet2 = 0;
 
+  fSortedJet1 = 0;
+
   jets2->ResetCurrentID();
   while ((jet2 = jets2->GetNextJet())) {
 
@@ -24,6 +24,9 @@ class TH2;
 class THnSparse;
 class AliNamedArrayI;
 
+#include <vector>
+#include <utility>
+
 #include "AliEmcalJet.h"
 #include "AliAnalysisTaskEmcalJet.h"
 #include "AliEmcalEmbeddingQA.h"
@@ -100,6 +103,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const;
   void                        GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
   void                        GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
+  void                        SortJet1Constituents(AliEmcalJet *jet1, MatchingType matching) const;
   void                        FillMatchingHistos(AliEmcalJet* jet1, AliEmcalJet* jet2, Double_t d, Double_t CE1, Double_t CE2);
   void                        FillJetHisto(AliEmcalJet* jet, Int_t Set);
   void                        AllocateTH2();
@@ -200,10 +204,16 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   TH2                        *fHistDeltaMCPtvsDeltaArea;               //!jet 1 MC pt - jet2 pt vs delta area
   TH2                        *fHistJet1MCPtvsJet2Pt;                   //!correlation jet 1 MC pt vs jet 2 pt
 
+  // Constituents of the last jet 1 given to the matching level functions (reset for each event)
+  mutable const AliEmcalJet  *fSortedJet1;                             //!jet 1 of the sorted constituents
+  mutable MatchingType        fSortedJet1Matching;                     //!matching type the constituents were sorted for
+  mutable std::vector<std::pair<Int_t, Int_t> > fSortedJet1Tracks;    //!(index, position in jet 1) of the tracks, index in tracks 2 for kMCLabel
+  mutable std::vector<std::pair<Int_t, Int_t> > fSortedJet1Clusters;  //!(index, position in jet 1) of the clusters
+
  private:
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 29) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
@@ -1488,12 +1488,18 @@ TH2D* AliJetFlowTools::MatrixMultiplication(TH2D* a, TH2D* b, TString name)
     // multiply two matrices
     if (a->GetNbinsX() != b->GetNbinsY()) return 0x0;
     TH2D* c = (TH2D*)a->Clone("c");
+    // read the bin contents directly from the arrays (bin = x + (nx+2)*y) rather than
+    // through GetBinContent, which dominates for the fine binning of the dpt response
+    const Int_t strideA(a->GetNbinsX()+2), strideB(b->GetNbinsX()+2);
+    const Double_t* contentA(a->GetArray());
+    const Double_t* contentB(b->GetArray());
     for (Int_t y1 = 1; y1 <= a->GetNbinsY(); y1++) {
+        const Double_t* rowA(contentA + strideA*y1);
         for (Int_t x2 = 1; x2 <= b->GetNbinsX(); x2++) {
             Double_t val = 0;
             for (Int_t x1 = 1; x1 <= a->GetNbinsX(); x1++) {
                 Int_t y2 = x1;
-	        val += a->GetBinContent(x1, y1) * b->GetBinContent(x2, y2);
+	        val += rowA[x1] * contentB[x2 + strideB*y2];
             }
             c->SetBinContent(x2, y1, val);
             c->SetBinError(x2, y1, 0.);
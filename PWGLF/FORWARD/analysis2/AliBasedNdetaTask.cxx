@@ -20,6 +20,7 @@
 #include <TParameter.h>
 #include <TColor.h>
 #include <TLatex.h>
+#include <vector>
 
 //====================================================================
 namespace {
@@ -772,20 +773,53 @@ AliBasedNdetaTask::ScaleToCoverage(TH2D* copy, const TH1D* norm)
 {
   // Normalize to the acceptance -
   // dndeta->Divide(accNorm);
-  for (Int_t i = 1; i <= copy->GetNbinsX(); i++) { 
+  Int_t nX = copy->GetNbinsX();
+  Int_t nY = copy->GetNbinsY();
+  if (copy->GetBinErrorOption() != TH1::kNormal) { 
+    for (Int_t i = 1; i <= nX; i++) { 
+      Double_t a = norm->GetBinContent(i);
+      for (Int_t j = 1; j <= nY; j++) { 
+	if (a <= 0) { 
+	  copy->SetBinContent(i,j,0);
+	  copy->SetBinError(i,j,0);
+	  continue;
+	}
+	Double_t c = copy->GetBinContent(i, j);
+	Double_t e = copy->GetBinError(i, j);
+	copy->SetBinContent(i, j, c / a);
+	copy->SetBinError(i, j, e / a);
+      }
+    }
+    return;
+  }
+  // Same as above, but directly on the content and sum of squared
+  // weights arrays rather than through Get/SetBinContent and
+  // Get/SetBinError for each bin
+  if (copy->GetSumw2N() <= 0) copy->Sumw2();
+  Double_t* cnt    = copy->GetArray();
+  Double_t* sumw2  = copy->GetSumw2()->GetArray();
+  Int_t     stride = nX + 2;
+  for (Int_t i = 1; i <= nX; i++) { 
     Double_t a = norm->GetBinContent(i);
-    for (Int_t j = 1; j <= copy->GetNbinsY(); j++) { 
+    for (Int_t j = 1; j <= nY; j++) { 
+      Int_t bin = i + stride * j;
       if (a <= 0) { 
-	copy->SetBinContent(i,j,0);
-	copy->SetBinError(i,j,0);
+	cnt[bin]   = 0;
+	sumw2[bin] = 0;
 	continue;
       }
-      Double_t c = copy->GetBinContent(i, j);
-      Double_t e = copy->GetBinError(i, j);
-      copy->SetBinContent(i, j, c / a);
-      copy->SetBinError(i, j, e / a);
+      Double_t e = TMath::Sqrt(sumw2[bin]) / a;
+      cnt[bin]   = cnt[bin] / a;
+      sumw2[bin] = e * e;
     }
   }
+  // SetBinContent counts an entry per call, and invalidates the
+  // statistics
+  Double_t entries = copy->GetEntries() + Double_t(nX) * nY;
+  Double_t stats[TH1::kNstat];
+  for (Int_t i = 0; i < TH1::kNstat; i++) stats[i] = 0;
+  copy->PutStats(stats);
+  copy->SetEntries(entries);
 }
 //________________________________________________________________________
 void
@@ -856,30 +890,44 @@ AliBasedNdetaTask::ProjectX(const TH2D* h,
     
   }
 
-  // Loop over X bins 
+  // Loop over Y bins, and sum the X bins of each row at once - the
+  // rows are contiguous in the histogram arrays
   //DMSG(fDebug,3,"Projecting bins [%d,%d] of %s", first, last, h->GetName()));
   Int_t ybins = (last-first+1);
-  for (Int_t xbin = 0; xbin <= xaxis->GetNbins()+1; xbin++) { 
-    Double_t content = 0;
-    Double_t error2  = 0;
-    Int_t    nbins   = 0;
-    
-    
-    for (Int_t ybin = first; ybin <= last; ybin++) { 
-      Double_t c1 = h->GetBinContent(h->GetBin(xbin, ybin));
-      Double_t e1 = h->GetBinError(h->GetBin(xbin, ybin));
+  Int_t nx    = xaxis->GetNbins()+2;
+  std::vector<Double_t> contents(nx, 0);
+  std::vector<Double_t> errors2(nx, 0);
+  std::vector<Int_t>    nBins(nx, 0);
+  const Double_t* cnt   = h->GetArray();
+  const Double_t* sumw2 = (h->GetSumw2N() > 0 ? h->GetSumw2()->GetArray() : 0);
+  Bool_t          plain = (h->GetBinErrorOption() == TH1::kNormal);
+  for (Int_t ybin = first; ybin <= last; ybin++) { 
+    Int_t off = ybin * nx;
+    for (Int_t xbin = 0; xbin < nx; xbin++) { 
+      Int_t    bin = off + xbin;
+      Double_t c1  = cnt[bin];
 
       // Ignore empty bins 
       if (c1 < 1e-12) continue;
+      Double_t e1 = (!plain ? h->GetBinError(bin) : 
+		     sumw2  ? TMath::Sqrt(sumw2[bin]) : 
+		     TMath::Sqrt(TMath::Abs(c1)));
       if (e1 < 1e-12) {
 	if (error) continue; 
 	e1 = 1;
       }
 
-      content    += c1;
-      error2     += e1*e1;
-      nbins++;
-    } // for (ybin)
+      contents[xbin] += c1;
+      errors2[xbin]  += e1*e1;
+      nBins[xbin]++;
+    } // for (xbin)
+  } // for (ybin)
+
+  // Loop over X bins 
+  for (Int_t xbin = 0; xbin < nx; xbin++) { 
+    Double_t content = contents[xbin];
+    Double_t error2  = errors2[xbin];
+    Int_t    nbins   = nBins[xbin];
     if(content > 0 && nbins > 0) {
       Double_t factor = (corr ? Double_t(ybins) / nbins : 1);
 #if 0
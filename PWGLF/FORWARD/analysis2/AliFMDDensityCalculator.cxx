@@ -60,7 +60,12 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fNTableBins(0),
+    fCutTable(),
+    fWeightTable(),
+    fFitTable(),
+    fAccTable()
 {
   // 
   // Constructor 
@@ -98,7 +103,12 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fNTableBins(0),
+    fCutTable(),
+    fWeightTable(),
+    fFitTable(),
+    fAccTable()
 {
   // 
   // Constructor 
@@ -167,7 +177,12 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fNTableBins(o.fNTableBins),
+  fCutTable(o.fCutTable),
+  fWeightTable(o.fWeightTable),
+  fFitTable(o.fFitTable),
+  fAccTable(o.fAccTable)
 {
   // 
   // Copy constructor 
@@ -232,6 +247,11 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fNTableBins         = o.fNTableBins;
+  fCutTable           = o.fCutTable;
+  fWeightTable        = o.fWeightTable;
+  fFitTable           = o.fFitTable;
+  fAccTable           = o.fAccTable;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -306,6 +326,15 @@ namespace {
     ret = h->GetBinContent(xbin,ybin);					
     return ret;
   }
+  Int_t Rng2Idx(UShort_t d, Char_t r)
+  {
+    switch (d) { 
+    case 1: return 0;
+    case 2: return (r=='i' || r=='I') ? 1 : 2;
+    case 3: return (r=='i' || r=='I') ? 3 : 4;
+    }
+    return -1;
+  }
 }
 
 //____________________________________________________________________
@@ -395,6 +424,13 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
   // Double_t ipR        = TMath::Sqrt(TMath::Power(ip.X(),2)+
   //                       TMath::Power(ip.Y(),2));
   START_TIMER(totalT);
+
+  if (fNTableBins <= 0) { 
+    AliError("Look-up tables not set up, SetupForData not called?");
+    return false;
+  }
+  const AliFMDCorrELossFit* elossFit = 
+    AliForwardCorrectionManager::Instance().GetELossFit();
   
   Double_t etaCache[20*512]; // Same number of strips per ring 
   Double_t phiCache[20*512]; // whether it is inner our outer. 
@@ -416,6 +452,19 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	fRingHistos.ls();
 	return false;
       }
+      // Per-ring look-up tables, see CacheMaxWeights
+      const Double_t* cutTable = (fCutTable.GetArray() + 
+				  Rng2Idx(d,r) * fNTableBins);
+      const Float_t*  accTable = fAccTable.GetArray() + (q == 0 ? 0 : 512);
+      // With Poisson, the energy loss estimate is only kept for the
+      // comparison below - fill it directly into the cache histogram
+      TH2D* hclone = fCache.Get(d,r);
+      TH2D* heloss = h;
+      if (fUsePoisson) { 
+	hclone->Reset();
+	h->Reset();
+	heloss = hclone;
+      }
       // rh->fPoisson.SetObject(d,r,vtxbin,cent);
       rh->fPoisson.Reset(0);
       rh->fTotal->Reset();
@@ -485,18 +534,21 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 
 	  // --- Apply phi corner correction to eloss ----------------
 	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
-	    mult *= AcceptanceCorrection(r,t);
+	    mult *= accTable[t];
 
 	  // --- Get the low multiplicity cut ------------------------
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  if (eta != AliESDFMD::kInvalidEta) 
+	    cut = cutTable[fLowCuts->GetXaxis()->FindFixBin(eta)];
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
 	  // --- Now caluculate Nch for this strip using fits --------
 	  START_TIMER(timer);
 	  Double_t n   = 0;
-	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
+	  if (cut > 0 && mult > cut) 
+	    n = TableNParticles(mult,d,r,eta,
+				elossFit->FindEtaBin(Float_t(eta)),lowFlux);
 	  rh->fELoss->Fill(mult);
 	  // rh->fEvsN->Fill(mult,n);
 	  // rh->fEtaVsN->Fill(eta, n);
@@ -507,7 +559,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // Temporary stuff - remove Correction call 
 	  Double_t c = 1;
 	  if (fUsePhiAcceptance == kPhiCorrectNch) 
-	    c = AcceptanceCorrection(r,t);
+	    c = accTable[t];
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
 	  ADD_TIMER(timer,corrTime);
 	  fCorrections->Fill(c);
@@ -529,7 +581,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	    rh->fSignal->Fill(eta, mult);
 	  }
 	  rh->fPoisson.Fill(t,s,hit,1./c);
-	  h->Fill(eta,phi,n);
+	  heloss->Fill(eta,phi,n);
 
 	  // --- If we use ELoss fits, apply now ---------------------
 	  if (!fUsePoisson) rh->fDensity->Fill(eta,phi,n);
@@ -540,22 +592,10 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // This is very fast, so we do not bother to time it 
       rh->fGood->Divide(rh->fGood, rh->fTotal, 1, 1, "B");
 
-      // --- Make a copy and reset as needed -------------------------
+      // --- Reset the cache as needed ------------------------------
+      // With Poisson, the cache already holds the energy loss estimate
       START_TIMER(timer);
-      TH2D* hclone = fCache.Get(d,r);
-      // hclone->Reset();
-      // TH2D* hclone = static_cast<TH2D*>(h->Clone("hclone"));
       if (!fUsePoisson) hclone->Reset();
-      else { 
-	for (Int_t i = 0; i <= h->GetNbinsX()+1; i++) { 
-	  for (Int_t j = 0; j <= h->GetNbinsY()+1; j++) {
-	    hclone->SetBinContent(i,j,h->GetBinContent(i,j));
-	    hclone->SetBinError(i,j,h->GetBinError(i,j));
-	  }
-	}
-	// hclone->Add(h); 
-	h->Reset(); 
-      }
       ADD_TIMER(timer,copyTime);
       
       // --- Store Poisson result ------------------------------------
@@ -771,6 +811,32 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
 
   // Cache cuts in histogram
   fCuts.FillHistogram(fLowCuts);
+
+  // Flatten the look-ups done for each strip in Calculate.  The bins
+  // include under- and overflow, so that the tables are indexed
+  // directly by the result of FindBin
+  fNTableBins = nEta + 2;
+  fCutTable.Set(5 * fNTableBins);
+  fWeightTable.Set(5 * fNTableBins);
+  fFitTable.Clear();
+  fFitTable.Expand(5 * fNTableBins);
+  for (UShort_t d = 1; d <= 3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q = 0; q < nr; q++) { 
+      Char_t r   = (q == 0 ? 'I' : 'O');
+      Int_t  off = Rng2Idx(d, r) * fNTableBins;
+      for (Int_t b = 0; b < fNTableBins; b++) { 
+	fCutTable[off+b]    = Rng2Cut(d, r, b, fLowCuts);
+	fWeightTable[off+b] = (b >= 1 && b <= nEta ? GetMaxWeight(d, r, b-1) : -1);
+	fFitTable.AddAt(cor->FindFit(d, r, b, -1), off+b);
+      }
+    }
+  }
+  fAccTable.Set(2 * 512);
+  for (UShort_t t = 0; t < 512; t++) { 
+    fAccTable[t]     = (fAccI ? AcceptanceCorrection('I', t) : 1);
+    fAccTable[512+t] = (fAccO && t < 256 ? AcceptanceCorrection('O', t) : 1);
+  }
 }
 
 //_____________________________________________________________________
@@ -890,6 +956,60 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   return ret;
 }
 
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::TableNParticles(Float_t  mult, 
+					 UShort_t d, 
+					 Char_t   r, 
+					 Float_t  eta,
+					 Int_t    etaBin,
+					 Bool_t   lowFlux) const
+{
+  // 
+  // Get the number of particles corresponding to the signal mult,
+  // from the tables made in CacheMaxWeights
+  // 
+  // Parameters:
+  //    mult     Signal
+  //    d        Detector
+  //    r        Ring 
+  //    eta      Pseudo-rapidity (for messages)
+  //    etaBin   Eta bin of the energy loss fits (0 if out of range)
+  //    lowFlux  Low-flux flag 
+  // 
+  // Return:
+  //    The number of particles 
+  //
+  if (lowFlux) return 1;
+
+  Int_t idx = Rng2Idx(d,r) * fNTableBins + (etaBin < 0 ? 0 : etaBin);
+  AliFMDCorrELossFit::ELossFit* fit = 
+    static_cast<AliFMDCorrELossFit::ELossFit*>(fFitTable.At(idx));
+  if (!fit) { 
+    AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
+		    d, r, eta, fMinQuality));
+    return 0;
+  }
+  
+  Int_t    m   = fWeightTable[idx];
+  if (m < 1) { 
+    AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
+    return 0;
+  }
+  
+  UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
+  Double_t ret = fit->EvaluateWeighted(mult, n);
+  
+  if (fDebug > 10) {
+    AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
+  }
+    
+  fWeightedSum->Fill(ret);
+  fSumOfWeights->Fill(ret);
+  
+  return ret;
+}
+
 //_____________________________________________________________________
 Float_t 
 AliFMDDensityCalculator::Correction(UShort_t d, 
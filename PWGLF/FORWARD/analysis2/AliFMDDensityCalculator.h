@@ -16,6 +16,9 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayD.h>
+#include <TArrayF.h>
+#include <TObjArray.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -292,7 +295,9 @@ protected:
 		      UShort_t d, Char_t r, Double_t iEta) const;
 
   /** 
-   * Find the max weights and cache them 
+   * Find the max weights and cache them.  Also fills the per-ring
+   * look-up tables of low cuts, fits, max weights and acceptance
+   * corrections used for each strip in Calculate.
    * 
    * @param axis Default @f$\eta@f$ axis from parent task 
    */  
@@ -336,6 +341,26 @@ protected:
 			     Char_t   r, 
 			     Float_t  eta, 
 			     Bool_t   lowFlux) const;
+  /** 
+   * Get the number of particles corresponding to the signal mult,
+   * using the look-up tables made by CacheMaxWeights.  Same as
+   * NParticles, without the look-ups of the fit and max weight.
+   * 
+   * @param mult     Signal
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * @param etaBin   Bin of @a eta in the energy loss fits @f$\eta@f$ axis
+   * @param lowFlux  Low-flux flag 
+   * 
+   * @return The number of particles 
+   */
+  Float_t TableNParticles(Float_t  mult, 
+			  UShort_t d, 
+			  Char_t   r, 
+			  Float_t  eta,
+			  Int_t    etaBin,
+			  Bool_t   lowFlux) const;
   /** 
    * Get the inverse correction factor.  This consist of
    * 
@@ -504,8 +529,13 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Int_t     fNTableBins;   //! Number of eta bins per ring in the tables 
+  TArrayD   fCutTable;     //! Low cuts per ring and eta bin (with under/overflow)
+  TArrayI   fWeightTable;  //! Max weights per ring and fit eta bin 
+  TObjArray fFitTable;     //! Energy loss fits per ring and fit eta bin (not owned)
+  TArrayF   fAccTable;     //! Acceptance correction per ring type and strip
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
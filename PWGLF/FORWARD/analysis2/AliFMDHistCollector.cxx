@@ -51,9 +51,11 @@ AliFMDHistCollector::AliFMDHistCollector()
     fBgAndHitMaps(false),
     fVtxList(0), 
     fByCent(0),
-    fDoByCent(false)
+    fDoByCent(false),
+    fScratch()
 {
   DGUARD(fDebug, 3, "Default CTOR of AliFMDHistCollector");
+  fScratch.SetOwner();
 }
 
 //____________________________________________________________________
@@ -72,9 +74,11 @@ AliFMDHistCollector::AliFMDHistCollector(const char* title)
     fBgAndHitMaps(false),
     fVtxList(0), 
     fByCent(0),
-    fDoByCent(false)
+    fDoByCent(false),
+    fScratch()
 {
   DGUARD(fDebug, 3, "Named CTOR of AliFMDHistCollector: %s", title);
+  fScratch.SetOwner();
 }
 //____________________________________________________________________
 AliFMDHistCollector::AliFMDHistCollector(const AliFMDHistCollector& o)
@@ -92,9 +96,11 @@ AliFMDHistCollector::AliFMDHistCollector(const AliFMDHistCollector& o)
     fBgAndHitMaps(o.fBgAndHitMaps),
     fVtxList(o.fVtxList), 
     fByCent(o.fByCent),
-    fDoByCent(o.fDoByCent)
+    fDoByCent(o.fDoByCent),
+    fScratch()
 {
   DGUARD(fDebug, 3, "Copy CTOR of AliFMDHistCollector");
+  fScratch.SetOwner();
 }
 
 //____________________________________________________________________
@@ -492,7 +498,7 @@ AliFMDHistCollector::Collect(const AliForwardUtil::Histos& hists,
   if (!bin) return false;
   Bool_t   ret     = bin->Collect(hists, sums, out, fSumRings, fSkipped, cent, 
 				  fMergeMethod, fSkipFMDRings,
-				  fByCent, eta2phi, add);
+				  fByCent, eta2phi, add, fScratch);
 
   return ret;
 }
@@ -762,6 +768,37 @@ AliFMDHistCollector::VtxBin::GetLast(Int_t  idx) const
   printf("\n");								\
   } while (false)
 
+namespace {
+  /*
+   * Copy the content, errors and statistics of @a h into the scratch
+   * histogram at @a idx, reusing its storage. The scratch histogram
+   * is (re)made from @a h if missing or binned differently
+   */
+  TH2D* CopyToScratch(const TH2D* h, TObjArray& scratch, Int_t idx)
+  {
+    TH2D* t = static_cast<TH2D*>(scratch.At(idx));
+    if (!t || 
+	t->GetNbinsX() != h->GetNbinsX() || 
+	t->GetNbinsY() != h->GetNbinsY() ||
+	t->GetXaxis()->GetXmin() != h->GetXaxis()->GetXmin() ||
+	t->GetXaxis()->GetXmax() != h->GetXaxis()->GetXmax() ||
+	(t->GetSumw2N() > 0) != (h->GetSumw2N() > 0)) {
+      delete t;
+      t = static_cast<TH2D*>(h->Clone(Form("%s_tmp", h->GetName())));
+      t->SetDirectory(0);
+      scratch.AddAtAndExpand(t, idx);
+      return t;
+    }
+    static_cast<TArrayD&>(*t) = static_cast<const TArrayD&>(*h);
+    if (h->GetSumw2N() > 0) *(t->GetSumw2()) = *(h->GetSumw2());
+    Double_t stats[TH1::kNstat];
+    h->GetStats(stats);
+    t->PutStats(stats);
+    t->SetEntries(h->GetEntries());
+    return t;
+  }
+}
+
 //____________________________________________________________________
 Bool_t
 AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists, 
@@ -774,7 +811,8 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 				     UShort_t                      skips,
 				     TList*                        byCent,
 				     Bool_t                        eta2phi,
-				     Bool_t                        add)
+				     Bool_t                        add,
+				     TObjArray&                    scratch)
 {
   for (UShort_t d=1; d<=3; d++) { 
     UShort_t nr = (d == 1 ? 1 : 2);
@@ -790,7 +828,7 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	continue;
       }
       TH2D*       o = sums.Get(d, r);
-      TH2D*       t = static_cast<TH2D*>(h->Clone(Form("FMD%d%c_tmp",d,r)));
+      TH2D*       t = CopyToScratch(h, scratch, i-1);
       
       // Get valid range 
       Int_t first = 0;
@@ -864,14 +902,12 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	} // if (byCent)
       } // if (add)
 
-      // Outer rings have better phi segmentation - rebin to same as inner. 
-      if (q == 1) {
-	// PRINT_OVERFLOW(d, r, "before", t);
-	t->RebinY(2);	
-	// PRINT_OVERFLOW(d, r, "after", t);
-      }
-
-      nY = t->GetNbinsY();
+      // Outer rings have better phi segmentation - merge pairs of phi
+      // bins to get the same as inner (like TH2::RebinY(2), but
+      // without changing the scratch histogram)
+      Int_t nGroup = (q == 1 ? 2 : 1);
+      Int_t nYt    = t->GetNbinsY();
+      nY           = nYt / nGroup;
 
       // Now update profile output 
       for (Int_t iEta = first; iEta <= last; iEta++) { 
@@ -919,7 +955,7 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 
 	// Fill phi acceptance for this event into the phi overflow bin
 	Float_t oop      = out.GetBinContent(iEta,nY+1);
-	Float_t nop      = t->GetBinContent(iEta,nY+1);
+	Float_t nop      = t->GetBinContent(iEta,nYt+1);
 #if 0
 	Info("", "etaBin=%3d Setting phi acceptance to %f(%f+%f)=%f", 
 	     iEta, fac, oop, nop, fac*(oop+nop));
@@ -928,8 +964,22 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 
 	// Should we loop over h or t Y bins - I think it's t
 	for (Int_t iPhi = 1; iPhi <= nY; iPhi++) { 
-	  Double_t c  = t->GetBinContent(iEta,iPhi);
-	  Double_t e  = t->GetBinError(iEta,iPhi);
+	  Double_t c  = 0;
+	  Double_t e  = 0;
+	  if (nGroup == 1) {
+	    c = t->GetBinContent(iEta,iPhi);
+	    e = t->GetBinError(iEta,iPhi);
+	  }
+	  else {
+	    Double_t e2 = 0;
+	    for (Int_t k = 1; k <= nGroup; k++) {
+	      Int_t bin = t->GetBin(iEta,(iPhi-1)*nGroup+k);
+	      c  += t->GetBinContent(bin);
+	      e2 += (t->GetSumw2N() ? t->GetSumw2()->At(bin) 
+		     : TMath::Abs(t->GetBinContent(bin)));
+	    }
+	    e = TMath::Sqrt(e2);
+	  }
 	  Double_t ee = t->GetXaxis()->GetBinCenter(iEta);
 	  sumRings->Fill(ee, i, c);
 
@@ -956,8 +1006,6 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	  out.SetBinError(iEta,iPhi, re);
 	}
       }
-      // Remove temporary histogram 
-      delete t;
     } // for r
   } // for d 
   return true;
@@ -17,12 +17,12 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TObjArray.h>
 #include "AliForwardUtil.h"
 class AliESDFMD;
 class TH2;
 class TH2D;
 class TH1D;
-class TObjArray;
 
 /** 
  * This class collects the event histograms into single histograms, 
@@ -387,6 +387,7 @@ protected:
      * @param byCent     List (or null) of per centrality sums
      * @param eta2phi    Copy eta coverage to phi acceptance 
      * @param add      If true, add to internal caches
+     * @param scratch  Per-ring scratch histograms, reused between events
      *
      * @return true on success
      */
@@ -400,7 +401,8 @@ protected:
 		   UShort_t                      skips,
 		   TList*                        byCent,
 		   Bool_t                        eta2phi,
-		   Bool_t                        add);
+		   Bool_t                        add,
+		   TObjArray&                    scratch);
     /** 
      * Check if there's an overlap between detector @a d, ring @a r
      * and some other ring for the given @f$\eta@f$ @a bin.  If so,
@@ -509,7 +511,8 @@ protected:
   TObjArray*  fVtxList;         //! Per-vertex list
   TList*      fByCent;          // By centrality sums
   Bool_t      fDoByCent;        // Whether to do by centrality sum
-  ClassDef(AliFMDHistCollector,6); // Calculate Nch density 
+  TObjArray   fScratch;         //! Per-ring copies of the input (owned)
+  ClassDef(AliFMDHistCollector,7); // Calculate Nch density 
 };
 
 
@@ -17,6 +17,7 @@
 #include "TVector2.h"
 #include "TVector3.h"
 #include "AliAODv0.h"
+#include "AliNuclexCandidates.h"
 #include "TRandom.h"
 #include "TChain.h"
 #include "TMath.h"
@@ -35,6 +36,7 @@ fAODeventCuts(),
 fUtils(NULL),
 fFillTri(kTRUE),
 fFillHypTri(kTRUE),
+fUseSharedCandidates(kFALSE),
 fQAList(NULL),
 // TreeEventSelection(NULL),
 fOutputList(NULL),
@@ -263,6 +265,7 @@ fAODeventCuts(),
 fUtils(NULL),
 fFillTri(kTRUE),
 fFillHypTri(kTRUE),
+fUseSharedCandidates(kFALSE),
 fQAList(NULL),
 fOutputList(NULL),
 // TreeEventSelection(NULL),
@@ -516,6 +519,12 @@ void AliAnalysisTaskReducedTreeNuclei::UserCreateOutputObjects()
 
   fAODeventCuts.AddQAplotsToList(fQAList); /// Add event selection QA plots
 
+  if (fUseSharedCandidates) {
+    // windows containing the ones of IsHeliumCandidate and IsTritonCandidate
+    AliNuclexCandidates::Instance().Require(AliNuclexCandidates::kHe3,-6.,1.e10);
+    AliNuclexCandidates::Instance().Require(AliNuclexCandidates::kTriton,-6.,6.);
+  }
+
   //   TreeEventSelection = new TTree("TreeEventSelection","TreeEventSelection");
   //   TreeEventSelection -> Branch("SelectionStep",&SelectionStep,"SelectionStep/I");
   // //   TreeEventSelection -> Branch("multPercentile_V0A",&multPercentile_V0A,"multPercentile_V0A/D");
@@ -907,11 +916,15 @@ void AliAnalysisTaskReducedTreeNuclei::UserExec(Option_t *)
   if(fAODevent->GetMagneticField() < 0) magFieldSign = -1;
   if(fAODevent->GetMagneticField() > 0) magFieldSign = 1;
 
+  //Shared light-nuclei candidates of the event, all tracks otherwise
+  const AliNuclexCandidates *candidates = fUseSharedCandidates ? &AliNuclexCandidates::Instance().Update(fAODevent,fPIDResponse) : 0x0;
+  const Int_t nTracks = candidates ? candidates->GetNCandidates() : fAODevent->GetNumberOfTracks();
+
   //Loop over Reconstructed Tracks
-  for (Int_t i=0 ; i<fAODevent->GetNumberOfTracks() ; i++)  {
+  for (Int_t i=0 ; i<nTracks ; i++)  {
 
     //Track Selection
-    AliAODTrack *track = (AliAODTrack*) fAODevent -> GetTrack(i);
+    AliAODTrack *track = (AliAODTrack*) fAODevent -> GetTrack(candidates ? candidates->GetTrackIndex(i) : i);
     if ( !track ) continue;
     if ( !PassedBasicTrackQualityCuts (track)) continue;
     if ( !(IsHeliumCandidate (track) || IsTritonCandidate (track))) continue;
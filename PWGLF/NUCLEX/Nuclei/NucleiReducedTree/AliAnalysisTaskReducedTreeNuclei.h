@@ -28,6 +28,7 @@ public:
    
    void FillTritonTree(Bool_t fillTri){ fFillTri=fillTri; }
    void FillHypTritonTree(Bool_t fillHypTri){ fFillHypTri=fillHypTri; }
+   void UseSharedCandidates(Bool_t use=kTRUE){ fUseSharedCandidates=use; } // loop only on the AliNuclexCandidates of the event
    
    
 
@@ -50,6 +51,7 @@ private:
    // globle varibles
    Bool_t fFillTri;
    Bool_t fFillHypTri;
+   Bool_t fUseSharedCandidates;
 
    TList          *fQAList;//!
    
@@ -324,6 +326,6 @@ private:
    AliAnalysisTaskReducedTreeNuclei(const AliAnalysisTaskReducedTreeNuclei&);
    AliAnalysisTaskReducedTreeNuclei& operator=(const AliAnalysisTaskReducedTreeNuclei&);
    
-  ClassDef(AliAnalysisTaskReducedTreeNuclei, 4);
+  ClassDef(AliAnalysisTaskReducedTreeNuclei, 5);
 };
 #endif
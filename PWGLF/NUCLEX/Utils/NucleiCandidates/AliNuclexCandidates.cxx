@@ -0,0 +1,131 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include "AliAnalysisManager.h"
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+
+#include "AliNuclexCandidates.h"
+
+namespace {
+  /// AliPID species of the ESpecies
+  const AliPID::EParticleType kPIDSpecies[AliNuclexCandidates::kNSpecies] = {
+    AliPID::kDeuteron, AliPID::kTriton, AliPID::kHe3, AliPID::kAlpha
+  };
+}
+
+//--------------------------------------------------------------------------
+AliNuclexCandidates& AliNuclexCandidates::Instance() {
+  //
+  /// Candidate list shared by all the tasks of the process
+  //
+
+  static AliNuclexCandidates candidates;
+  return candidates;
+}
+
+//--------------------------------------------------------------------------
+AliNuclexCandidates::AliNuclexCandidates() :
+  fEvent(0x0),
+  fPidResponse(0x0),
+  fEntry(-1),
+  fEventId(0),
+  fBuilt(kFALSE),
+  fIndex(),
+  fNSigmaTPC()
+{
+  //
+  /// Default constructor, no window requested
+  //
+
+  for (Int_t iSp=0; iSp<kNSpecies; iSp++) {
+    fMin[iSp] = 1.;
+    fMax[iSp] = -1.;
+  }
+}
+
+//--------------------------------------------------------------------------
+void AliNuclexCandidates::Require(ESpecies species, Float_t nSigmaMin, Float_t nSigmaMax) {
+  //
+  /// Widen the TPC window of a species so that it contains [nSigmaMin,nSigmaMax]
+  //
+
+  if (species<0 || species>=kNSpecies || nSigmaMin>nSigmaMax) return;
+  if (Covers(species,nSigmaMin,nSigmaMax)) return;
+  if (fMin[species]>fMax[species]) {
+    fMin[species] = nSigmaMin;
+    fMax[species] = nSigmaMax;
+  } else {
+    if (nSigmaMin<fMin[species]) fMin[species] = nSigmaMin;
+    if (nSigmaMax>fMax[species]) fMax[species] = nSigmaMax;
+  }
+  fBuilt = kFALSE;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliNuclexCandidates::Covers(ESpecies species, Float_t nSigmaMin, Float_t nSigmaMax) const {
+  //
+  /// Whether all the tracks with n sigma in [nSigmaMin,nSigmaMax] are candidates
+  //
+
+  if (species<0 || species>=kNSpecies) return kFALSE;
+  return fMin[species]<=fMax[species] && fMin[species]<=nSigmaMin && nSigmaMax<=fMax[species];
+}
+
+//--------------------------------------------------------------------------
+const AliNuclexCandidates& AliNuclexCandidates::Update(const AliVEvent *event, AliPIDResponse *pidResponse) {
+  //
+  /// Build the list if not yet done for this event. The tracks without
+  /// TPC PID are never candidates (their n sigma is -999)
+  //
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  const ULong64_t evid = event ? ((ULong64_t)(event->GetBunchCrossNumber())<<32) + event->GetTimeStamp() : 0;
+  if (fBuilt && fEvent==event && fEntry==entry && fEventId==evid && fPidResponse==pidResponse) return *this;
+
+  fEvent = event;
+  fEntry = entry;
+  fEventId = evid;
+  fPidResponse = pidResponse;
+  fBuilt = kTRUE;
+  fIndex.clear();
+  fNSigmaTPC.clear();
+  if (!event || !pidResponse) return *this;
+
+  Float_t nSigma[kNSpecies];
+  const Int_t nTracks = event->GetNumberOfTracks();
+  for (Int_t iTr=0; iTr<nTracks; iTr++) {
+    AliVTrack *track = dynamic_cast<AliVTrack*>(event->GetTrack(iTr));
+    if (!track) continue;
+    if (pidResponse->CheckPIDStatus(AliPIDResponse::kTPC,track)!=AliPIDResponse::kDetPidOk) continue;
+    Bool_t accept = kFALSE;
+    for (Int_t iSp=0; iSp<kNSpecies; iSp++) {
+      if (fMin[iSp]>fMax[iSp]) continue;
+      nSigma[iSp] = pidResponse->NumberOfSigmasTPC(track,kPIDSpecies[iSp]);
+      if (nSigma[iSp]>=fMin[iSp] && nSigma[iSp]<=fMax[iSp]) accept = kTRUE;
+    }
+    if (!accept) continue;
+    // the species without window are computed only for the candidates
+    for (Int_t iSp=0; iSp<kNSpecies; iSp++) {
+      if (fMin[iSp]>fMax[iSp]) nSigma[iSp] = pidResponse->NumberOfSigmasTPC(track,kPIDSpecies[iSp]);
+    }
+    fIndex.push_back(iTr);
+    fNSigmaTPC.insert(fNSigmaTPC.end(),nSigma,nSigma+kNSpecies);
+  }
+  return *this;
+}
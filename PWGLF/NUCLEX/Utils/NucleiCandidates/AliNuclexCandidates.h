@@ -0,0 +1,66 @@
+#ifndef ALINUCLEXCANDIDATES_H
+#define ALINUCLEXCANDIDATES_H
+
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/////////////////////////////////////////////////////////////
+///
+/// \class AliNuclexCandidates
+/// \brief Light-nuclei candidates of the current event, shared by the
+///  NUCLEX tasks of a train
+///
+/// The TPC n sigma for d, t, 3He and 4He are computed once per event and
+/// track with the PID response; the tracks inside the union of the TPC
+/// windows requested by the tasks (Require) are kept together with their
+/// n sigma. Each task then loops over the candidates and applies its own
+/// selection, which has to be tighter than the window it requested.
+///
+/// Usage:
+/// ~~~{.cxx}
+/// AliNuclexCandidates::Instance().Require(AliNuclexCandidates::kHe3,-6.,1.e10); // UserCreateOutputObjects
+/// const AliNuclexCandidates& cand = AliNuclexCandidates::Instance().Update(event,pidResponse); // UserExec
+/// for (Int_t i=0; i<cand.GetNCandidates(); i++) event->GetTrack(cand.GetTrackIndex(i));
+/// ~~~
+///
+/////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <Rtypes.h>
+
+class AliVEvent;
+class AliPIDResponse;
+
+class AliNuclexCandidates {
+ public:
+
+  enum ESpecies { kDeuteron=0, kTriton, kHe3, kHe4, kNSpecies };
+
+  static AliNuclexCandidates& Instance();
+
+  void     Require(ESpecies species, Float_t nSigmaMin, Float_t nSigmaMax);
+  Bool_t   Covers(ESpecies species, Float_t nSigmaMin, Float_t nSigmaMax) const;
+  const AliNuclexCandidates& Update(const AliVEvent *event, AliPIDResponse *pidResponse);
+
+  Int_t    GetNCandidates() const { return fIndex.size(); }
+  Int_t    GetTrackIndex(Int_t i) const { return fIndex[i]; }
+  Float_t  GetNSigmaTPC(Int_t i, ESpecies species) const { return fNSigmaTPC[i*kNSpecies+species]; }
+
+ private:
+
+  AliNuclexCandidates();
+  AliNuclexCandidates(const AliNuclexCandidates&);
+  AliNuclexCandidates& operator=(const AliNuclexCandidates&);
+
+  Float_t  fMin[kNSpecies];                 /// lower edge of the TPC n sigma window
+  Float_t  fMax[kNSpecies];                 /// upper edge of the TPC n sigma window
+  const AliVEvent      *fEvent;             /// event the list was built for
+  const AliPIDResponse *fPidResponse;       /// response used to build the list
+  Long64_t  fEntry;                         /// entry of the analysis manager
+  ULong64_t fEventId;                       /// bunch crossing and time stamp of the event
+  Bool_t    fBuilt;                         /// list valid for the current windows
+  std::vector<Int_t>   fIndex;              /// index of the candidates in the event
+  std::vector<Float_t> fNSigmaTPC;          /// n sigma of the candidates, kNSpecies per candidate
+};
+
+#endif
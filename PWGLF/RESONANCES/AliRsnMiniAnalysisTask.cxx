@@ -13,6 +13,8 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 
 #include <Riostream.h>
+#include <algorithm>
+#include <vector>
 
 #include <TH1.h>
 #include <TList.h>
@@ -71,6 +73,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fMaxDiffMult(10),
    fMaxDiffVz(1.0),
    fMaxDiffAngle(1E20),
+   fStreamingMix(kFALSE),
    fOutput(0x0),
    fHistograms("AliRsnMiniOutput", 0),
    fValues("AliRsnMiniValue", 0),
@@ -106,7 +109,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fComputeSpherocity(kFALSE),
    fSpherocity(-10),
    fTrackFilter(0x0),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fMixEventCount(0),
+   fMixPools()
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -133,6 +138,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fMaxDiffMult(10),
    fMaxDiffVz(1.0),
    fMaxDiffAngle(1E20),
+   fStreamingMix(kFALSE),
    fOutput(0x0),
    fHistograms("AliRsnMiniOutput", 0),
    fValues("AliRsnMiniValue", 0),
@@ -168,7 +174,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fComputeSpherocity(kFALSE),
    fSpherocity(-10),
    fTrackFilter(0x0),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fMixEventCount(0),
+   fMixPools()
 {
 //
 // Default constructor.
@@ -201,6 +209,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fMaxDiffMult(copy.fMaxDiffMult),
    fMaxDiffVz(copy.fMaxDiffVz),
    fMaxDiffAngle(copy.fMaxDiffAngle),
+   fStreamingMix(copy.fStreamingMix),
    fOutput(0x0),
    fHistograms(copy.fHistograms),
    fValues(copy.fValues),
@@ -236,7 +245,9 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fComputeSpherocity(copy.fComputeSpherocity),
    fSpherocity(copy.fSpherocity),
    fTrackFilter(copy.fTrackFilter),
-   fResonanceFinders(copy.fResonanceFinders)
+   fResonanceFinders(copy.fResonanceFinders),
+   fMixEventCount(0),
+   fMixPools()
 {
 //
 // Copy constructor.
@@ -274,6 +285,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fMaxDiffMult = copy.fMaxDiffMult;
    fMaxDiffVz = copy.fMaxDiffVz;
    fMaxDiffAngle = copy.fMaxDiffAngle;
+   fStreamingMix = copy.fStreamingMix;
    fHistograms = copy.fHistograms;
    fValues = copy.fValues;
    fHEventStat = copy.fHEventStat;
@@ -322,6 +334,7 @@ AliRsnMiniAnalysisTask::~AliRsnMiniAnalysisTask()
       delete fOutput;
       delete fEvBuffer;
    }
+   ClearMixPools();
 }
 
 //__________________________________________________________________________________________________
@@ -441,11 +454,14 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
    }
 
    // create temporary tree for filtered events
+   // (with streaming mixing only if it has to be saved)
    if (fMiniEvent) SafeDelete(fMiniEvent);
-   if (fRsnTreeInFile) OpenFile(2);
-   fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");
    fMiniEvent = new AliRsnMiniEvent();
-   fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
+   if (!fStreamingMix || fRsnTreeInFile) {
+      if (fRsnTreeInFile) OpenFile(2);
+      fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");
+      fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
+   }
    
    // create one histogram per each stored definition (event histograms)
    Int_t i, ndef = fHistograms.GetEntries();
@@ -471,7 +487,8 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
 // Computation loop.
 // In this case, it checks if the event is acceptable, and eventually
 // creates the corresponding mini-event and stores it in the buffer.
-// The real histogram filling is done at the end, in "FinishTaskOutput".
+// The real histogram filling is done at the end, in "FinishTaskOutput",
+// except with streaming mixing, where it is done here.
 //
    // increment event counter
    fEvNum++;
@@ -506,6 +523,12 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
    // if the event is not empty, store it
    if (fMiniEvent->IsEmpty()) {
       AliDebugClass(2, Form("Rejecting empty event #%d", fEvNum));
+   } else if (fStreamingMix) {
+      fMiniEvent->ID() = fMixEventCount++;
+      AliDebugClass(2, Form("Processing event #%d with ID = %d", fEvNum, fMiniEvent->ID()));
+      FillSingleEvent(fMiniEvent);
+      if (fNMix > 0) MixWithPools();
+      if (fEvBuffer) fEvBuffer->Fill();
    } else {
       Int_t id = fEvBuffer->GetEntries();
       AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
@@ -526,17 +549,23 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
 // and then the buffer will be full with all the corresponding mini-events,
 // each one containing all tracks selected by each of the available track cuts.
 // Here a loop is done on each of these events, and both single-event and mixing are computed
+// (with streaming mixing everything is already done in UserExec)
 //
 
+   if (fStreamingMix) {
+      AliInfo(Form("[%s] Streaming mixing: %d events processed", GetName(), fMixEventCount));
+      ClearMixPools();
+      PostData(1, fOutput);
+      if (fRsnTreeInFile) PostData(2, fEvBuffer);
+      return;
+   }
+
    // security code: reassign the buffer to the mini-event cursor
    fEvBuffer->SetBranchAddress("events", &fMiniEvent);
    TStopwatch timer;
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
-   Int_t idef, nDefs   = fHistograms.GetEntries();
    Int_t imix, iloop, ifill;
-   AliRsnMiniOutput *def = 0x0;
-   AliRsnMiniOutput::EComputation compType;
 
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
@@ -558,41 +587,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
       }
       // fill
-      for (idef = 0; idef < nDefs; idef++) {
-         def = (AliRsnMiniOutput *)fHistograms[idef];
-         if (!def) continue;
-         compType = def->GetComputation();
-         // execute computation in the appropriate way
-         switch (compType) {
-            case AliRsnMiniOutput::kEventOnly:
-               //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", ievt, def->GetName()));
-               ifill = 1;
-               def->FillEvent(fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTruePair:
-               //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPair:
-               //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated1:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated2:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            default:
-               // other kinds are processed elsewhere
-               ifill = 0;
-               AliDebugClass(2, Form("Computation = %d", (Int_t)compType));
-         }
-         // message
-         AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", ievt, def->GetName(), ifill));
-      }
+      FillSingleEvent(fMiniEvent);
    }
 
    // if no mixing is required, stop here and post the output
@@ -663,16 +658,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       while ( (os = (TObjString *)next()) ) {
          imix = os->GetString().Atoi();
          fEvBuffer->GetEntry(imix);
-         for (idef = 0; idef < nDefs; idef++) {
-            def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
-            if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
-            if (!def->IsSymmetric()) {
-               AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
-            }
-         }
+         ifill += FillMixedPair(&evMain, fMiniEvent);
       }
       delete list;
    }
@@ -1613,6 +1599,216 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::FillSingleEvent(AliRsnMiniEvent *event)
+{
+//
+// Fill all outputs computed on one event only,
+// using the appropriate procedure depending on their type.
+// Pair definitions building the same pairs are filled together.
+//
+
+   Int_t idef, jdef, nDefs = fHistograms.GetEntries(), ifill;
+   AliRsnMiniOutput *def = 0x0, *other = 0x0;
+   AliRsnMiniOutput::EComputation compType;
+   std::vector<Bool_t> done(nDefs, kFALSE);
+   std::vector<AliRsnMiniOutput *> group;
+
+   for (idef = 0; idef < nDefs; idef++) {
+      if (done[idef]) continue;
+      def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      compType = def->GetComputation();
+      // execute computation in the appropriate way
+      switch (compType) {
+         case AliRsnMiniOutput::kEventOnly:
+            //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", event->ID(), def->GetName()));
+            ifill = 1;
+            def->FillEvent(event, &fValues);
+            break;
+         case AliRsnMiniOutput::kTruePair:
+         case AliRsnMiniOutput::kTrackPair:
+         case AliRsnMiniOutput::kTrackPairRotated1:
+         case AliRsnMiniOutput::kTrackPairRotated2:
+            //AliDebugClass(1, Form("Event %d, def '%s': pair histogram filling", event->ID(), def->GetName()));
+            group.assign(1, def);
+            for (jdef = idef + 1; jdef < nDefs; jdef++) {
+               other = (AliRsnMiniOutput *)fHistograms[jdef];
+               if (!other || done[jdef] || !IsSingleEventPair(other)) continue;
+               if (!def->SamePairs(other)) continue;
+               group.push_back(other);
+               done[jdef] = kTRUE;
+            }
+            ifill = AliRsnMiniOutput::FillPairs(group.size(), group.data(), event, event, &fValues);
+            break;
+         default:
+            // other kinds are processed elsewhere
+            ifill = 0;
+            AliDebugClass(2, Form("Computation = %d", (Int_t)compType));
+      }
+      // message
+      AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", event->ID(), def->GetName(), ifill));
+   }
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::IsSingleEventPair(const AliRsnMiniOutput *def) const
+{
+//
+// Pair definitions filled in FillSingleEvent
+//
+
+   switch (def->GetComputation()) {
+      case AliRsnMiniOutput::kTruePair:
+      case AliRsnMiniOutput::kTrackPair:
+      case AliRsnMiniOutput::kTrackPairRotated1:
+      case AliRsnMiniOutput::kTrackPairRotated2:
+         return kTRUE;
+      default:
+         return kFALSE;
+   }
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniAnalysisTask::FillMixedPair(AliRsnMiniEvent *evMain, AliRsnMiniEvent *evMix)
+{
+//
+// Fill all mixing outputs with the pairs of two events,
+// and return the number of fills.
+// Definitions building the same pairs are filled together.
+//
+
+   Int_t idef, jdef, nDefs = fHistograms.GetEntries(), ifill = 0;
+   AliRsnMiniOutput *def = 0x0, *other = 0x0;
+   std::vector<Bool_t> done(nDefs, kFALSE);
+   std::vector<AliRsnMiniOutput *> group;
+   for (idef = 0; idef < nDefs; idef++) {
+      if (done[idef]) continue;
+      def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      if (!def->IsTrackPairMix()) continue;
+      group.assign(1, def);
+      for (jdef = idef + 1; jdef < nDefs; jdef++) {
+         other = (AliRsnMiniOutput *)fHistograms[jdef];
+         if (!other || done[jdef] || !other->IsTrackPairMix()) continue;
+         if (!def->SamePairs(other)) continue;
+         group.push_back(other);
+         done[jdef] = kTRUE;
+      }
+      ifill += AliRsnMiniOutput::FillPairs(group.size(), group.data(), evMain, evMix, &fValues, kTRUE);
+      // same charges and daughters in the group, so all symmetric or none
+      if (!def->IsSymmetric()) {
+         AliDebugClass(2, "Reflecting non symmetric pair");
+         ifill += AliRsnMiniOutput::FillPairs(group.size(), group.data(), evMix, evMain, &fValues, kFALSE);
+      }
+   }
+   return ifill;
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::MixWithPools()
+{
+//
+// Streaming mixing of the current mini-event.
+// It is mixed with the most recent matching events of the pools, as long
+// as both have less than fNMix matches (like in FinishTaskOutput), then
+// kept in the pool of its (vz, mult, angle) bin if it still needs matches.
+// Events with enough matches are dropped, and each pool keeps at most
+// fNMix events, so that the memory does not grow with the statistics.
+// With continuous mixing, the neighbouring bins are searched too: the bin
+// sizes are the max differences, EventsMatch does the final check.
+//
+
+   Int_t ivz    = (Int_t)(fMiniEvent->Vz()    / fMaxDiffVz);
+   Int_t imult  = (Int_t)(fMiniEvent->Mult()  / fMaxDiffMult);
+   Int_t iangle = (Int_t)(fMiniEvent->Angle() / fMaxDiffAngle);
+   Int_t range  = fContinuousMix ? 1 : 0;
+
+   // collect the matching events from the pools, most recent first
+   std::vector<std::deque<MixEntry>*> pools;
+   std::vector<MixEntry*> candidates;
+   for (Int_t jvz = ivz - range; jvz <= ivz + range; jvz++) {
+      for (Int_t jmult = imult - range; jmult <= imult + range; jmult++) {
+         for (Int_t jangle = iangle - range; jangle <= iangle + range; jangle++) {
+            std::map<Long64_t, std::deque<MixEntry> >::iterator it = fMixPools.find(MixPoolKey(jvz, jmult, jangle));
+            if (it == fMixPools.end()) continue;
+            pools.push_back(&it->second);
+            for (std::deque<MixEntry>::iterator entry = it->second.begin(); entry != it->second.end(); ++entry) {
+               if (EventsMatch(fMiniEvent, entry->fEvent)) candidates.push_back(&(*entry));
+            }
+         }
+      }
+   }
+   std::sort(candidates.begin(), candidates.end(),
+             [](const MixEntry *a, const MixEntry *b) { return a->fEvent->ID() > b->fEvent->ID(); });
+
+   // mix
+   Int_t nmatched = 0, ifill = 0;
+   for (size_t i = 0; i < candidates.size() && nmatched < fNMix; i++) {
+      ifill += FillMixedPair(fMiniEvent, candidates[i]->fEvent);
+      candidates[i]->fNMixed++;
+      nmatched++;
+   }
+   AliDebugClass(1, Form("Event %6d: mixed with %d events, fills = %d", fMiniEvent->ID(), nmatched, ifill));
+
+   // drop the events mixed enough times
+   for (size_t i = 0; i < pools.size(); i++) {
+      std::deque<MixEntry> &pool = *pools[i];
+      for (std::deque<MixEntry>::iterator entry = pool.begin(); entry != pool.end(); ) {
+         if (entry->fNMixed < fNMix) { ++entry; continue; }
+         delete entry->fEvent;
+         entry = pool.erase(entry);
+      }
+   }
+
+   // keep the current event for the next ones
+   if (nmatched < fNMix) {
+      std::deque<MixEntry> &pool = fMixPools[MixPoolKey(ivz, imult, iangle)];
+      if ((Int_t)pool.size() >= fNMix) {
+         delete pool.front().fEvent;
+         pool.pop_front();
+      }
+      MixEntry entry;
+      entry.fEvent = new AliRsnMiniEvent(*fMiniEvent);
+      // the input event will not be there anymore
+      entry.fEvent->SetRef(0x0);
+      entry.fEvent->SetRefMC(0x0);
+      entry.fEvent->SetQnVector(0x0);
+      entry.fNMixed = nmatched;
+      pool.push_back(entry);
+   }
+
+   // remove the empty pools
+   for (std::map<Long64_t, std::deque<MixEntry> >::iterator it = fMixPools.begin(); it != fMixPools.end(); ) {
+      if (it->second.empty()) fMixPools.erase(it++);
+      else ++it;
+   }
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::ClearMixPools()
+{
+//
+// Delete the mini-events kept for the streaming mixing
+//
+
+   for (std::map<Long64_t, std::deque<MixEntry> >::iterator it = fMixPools.begin(); it != fMixPools.end(); ++it) {
+      for (std::deque<MixEntry>::iterator entry = it->second.begin(); entry != it->second.end(); ++entry) delete entry->fEvent;
+   }
+   fMixPools.clear();
+}
+
+//__________________________________________________________________________________________________
+Long64_t AliRsnMiniAnalysisTask::MixPoolKey(Int_t ivz, Int_t imult, Int_t iangle) const
+{
+//
+// Key of the pool of a (vz, mult, angle) bin, 21 bits per bin index
+//
+
+   const Long64_t offset = 1 << 20;
+   return ((ivz + offset) << 42) | ((imult + offset) << 21) | (iangle + offset);
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
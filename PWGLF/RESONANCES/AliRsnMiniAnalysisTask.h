@@ -12,6 +12,8 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <map>
+#include <deque>
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -57,6 +59,7 @@ public:
    void                UseMultiplicity(const char *type)  {fUseCentrality = kFALSE; fCentralityType = type; if(!fCentralityType.Contains("AliMultSelection")) fCentralityType.ToUpper();}
    void                UseContinuousMix()                 {fContinuousMix = kTRUE;}
    void                UseBinnedMix()                     {fContinuousMix = kFALSE;}
+   void                UseStreamingMix(Bool_t yn = kTRUE) {fStreamingMix = yn;}
    void                SetNMix(Int_t nmix)                {fNMix = nmix;}
    void                SetMaxDiffMult (Double_t val)      {fMaxDiffMult  = val;}
    void                SetMaxDiffVz   (Double_t val)      {fMaxDiffVz    = val;}
@@ -112,6 +115,12 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   void     FillSingleEvent(AliRsnMiniEvent *event);
+   Int_t    FillMixedPair(AliRsnMiniEvent *evMain, AliRsnMiniEvent *evMix);
+   Bool_t   IsSingleEventPair(const AliRsnMiniOutput *def) const;
+   void     MixWithPools();
+   void     ClearMixPools();
+   Long64_t MixPoolKey(Int_t ivz, Int_t imult, Int_t iangle) const;
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -134,6 +143,7 @@ private:
    Double_t             fMaxDiffMult;     //  mixing --> max difference in multiplicity
    Double_t             fMaxDiffVz;       //  mixing --> max difference in Vz of prim vert
    Double_t             fMaxDiffAngle;    //  mixing --> max difference in reaction plane angle
+   Bool_t               fStreamingMix;    //  mixing --> done in UserExec with the pools below, no event buffer
 
    TList               *fOutput;          //  output list
    TClonesArray         fHistograms;      //  list of histogram definitions
@@ -174,7 +184,15 @@ private:
    Double_t             fSpherocity; // stores value of spherocity
    TObjArray            fResonanceFinders; // list of AliRsnMiniResonanceFinder objects
 
-   ClassDef(AliRsnMiniAnalysisTask, 18);   // AliRsnMiniAnalysisTask
+   /// mini-event kept for the streaming mixing, with the number of events mixed with it
+   struct MixEntry {
+      AliRsnMiniEvent *fEvent;
+      Int_t            fNMixed;
+   };
+   Int_t                fMixEventCount;   //! number of mini-events accepted by the streaming mixing
+   std::map<Long64_t, std::deque<MixEntry> > fMixPools; //! per (vz, mult, angle) bin, at most fNMix events, oldest first
+
+   ClassDef(AliRsnMiniAnalysisTask, 19);   // AliRsnMiniAnalysisTask
 };
 
 
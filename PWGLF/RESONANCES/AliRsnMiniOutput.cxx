@@ -8,6 +8,8 @@
 //
 
 #include "Riostream.h"
+#include <algorithm>
+#include <vector>
 
 #include "TH1.h"
 #include "TH2.h"
@@ -515,48 +517,93 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 // Last argument tells if the reference event for event-based values is the first or the second.
 //
 
+   AliRsnMiniOutput *self = this;
+   return FillPairs(1, &self, event1, event2, valueList, refFirst);
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::SamePairs(const AliRsnMiniOutput *other) const
+{
+//
+// Check if the other definition builds exactly the same pairs as this one
+// (daughter selection, masses, rotation), so that both can be filled
+// from the same pair loop in FillPairs. Everything applied after the
+// pair is built (true-pair checks, pair cuts, values) can differ.
+//
+
+   if (!other) return kFALSE;
+   if (IsTrackPairMix() != other->IsTrackPairMix()) return kFALSE;
+   Bool_t rot1 = (fComputation == kTrackPairRotated1), otherRot1 = (other->fComputation == kTrackPairRotated1);
+   Bool_t rot2 = (fComputation == kTrackPairRotated2), otherRot2 = (other->fComputation == kTrackPairRotated2);
+   if (rot1 != otherRot1 || rot2 != otherRot2) return kFALSE;
+   if (fMotherMass != other->fMotherMass) return kFALSE;
+   for (Int_t i = 0; i < 2; i++) {
+      if (fCutID[i] != other->fCutID[i]) return kFALSE;
+      if (fCharge[i] != other->fCharge[i]) return kFALSE;
+      if (fDaughter[i] != other->fDaughter[i]) return kFALSE;
+      if (fUseStoredMass[i] != other->fUseStoredMass[i]) return kFALSE;
+   }
+   return kTRUE;
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniOutput::FillPairs(Int_t nOutputs, AliRsnMiniOutput **outputs, AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst)
+{
+//
+// Fill a group of pair-based definitions building the same pairs (see SamePairs).
+// The particle selection and the pair kinematics are done once, following the first
+// definition of the group, then each definition applies its own checks and cuts,
+// and fills with its values. The values which are the same for all definitions
+// are computed once per pair.
+// Returns the number of successful fillings, summed over the definitions.
+//
+
+   if (nOutputs < 1 || !outputs[0]) return 0;
+   AliRsnMiniOutput *lead = outputs[0];
+
    // check computation type
-   Bool_t okComp = kFALSE;
-   if (fComputation == kTrackPair)         okComp = kTRUE;
-   if (fComputation == kTrackPairMix)      okComp = kTRUE;
-   if (fComputation == kTrackPairRotated1) okComp = kTRUE;
-   if (fComputation == kTrackPairRotated2) okComp = kTRUE;
-   if (fComputation == kTruePair)          okComp = kTRUE;
-   if (!okComp) {
-      AliError(Form("[%s] This method can be called only for pair-based computations", GetName()));
-      return kFALSE;
+   for (Int_t iout = 0; iout < nOutputs; iout++) {
+      EComputation comp = outputs[iout]->fComputation;
+      if (comp != kTrackPair && comp != kTrackPairMix && comp != kTrackPairRotated1 && comp != kTrackPairRotated2 && comp != kTruePair) {
+         AliErrorClass(Form("[%s] This method can be called only for pair-based computations", outputs[iout]->GetName()));
+         return 0;
+      }
    }
 
    // loop variables
-   Int_t i1, i2, start, nadded = 0;
+   Int_t i1, i2, start, iout, nadded = 0;
    AliRsnMiniParticle *p1, *p2;
    Double_t mass1, mass2;
 
    // it is necessary to know if criteria for the two daughters are the same
    // and if the two events are the same or not (mixing)
    //Bool_t sameCriteria = ((fCharge[0] == fCharge[1]) && (fCutID[0] == fCutID[1]));
-   Bool_t sameCriteria = ((fCharge[0] == fCharge[1]) && (fDaughter[0] == fDaughter[1]));
+   Bool_t sameCriteria = ((lead->fCharge[0] == lead->fCharge[1]) && (lead->fDaughter[0] == lead->fDaughter[1]));
    Bool_t sameEvent = (event1->ID() == event2->ID());
 
    TString selList1  = "";
    TString selList2  = "";
-   Int_t   n1 = event1->CountParticles(fSel1, fCharge[0], fCutID[0]);
-   Int_t   n2 = event2->CountParticles(fSel2, fCharge[1], fCutID[1]);
-   for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", fSel1[i1]));
-   for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", fSel2[i2]));
-   AliDebugClass(1, Form("[%10s] Part #1: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event1->ID(), fCharge[0], fCutID[0], n1, selList1.Data()));
-   AliDebugClass(1, Form("[%10s] Part #2: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", GetName(), (event1 == event2 ? "def" : "mix"), event2->ID(), fCharge[1], fCutID[1], n2, selList2.Data()));
+   Int_t   n1 = event1->CountParticles(lead->fSel1, lead->fCharge[0], lead->fCutID[0]);
+   Int_t   n2 = event2->CountParticles(lead->fSel2, lead->fCharge[1], lead->fCutID[1]);
+   for (i1 = 0; i1 < n1; i1++) selList1.Append(Form("%d ", lead->fSel1[i1]));
+   for (i2 = 0; i2 < n2; i2++) selList2.Append(Form("%d ", lead->fSel2[i2]));
+   AliDebugClass(1, Form("[%10s] Part #1: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", lead->GetName(), (event1 == event2 ? "def" : "mix"), event1->ID(), lead->fCharge[0], lead->fCutID[0], n1, selList1.Data()));
+   AliDebugClass(1, Form("[%10s] Part #2: [%s] -- evID %6d -- charge = %c -- cut ID = %d --> %4d tracks (%s)", lead->GetName(), (event1 == event2 ? "def" : "mix"), event2->ID(), lead->fCharge[1], lead->fCutID[1], n2, selList2.Data()));
    if (!n1 || !n2) {
       AliDebugClass(1, "No pairs to mix");
       return 0;
    }
 
+   // pair shared by the definitions, and values computed on it
+   AliRsnMiniPair pair;
+   Int_t nval = valueList->GetEntries();
+   std::vector<Float_t> cache(nval, 0.0);
+   std::vector<Char_t>  cached(nval, 0);
+   AliRsnMiniEvent *refEvent = (refFirst ? event1 : event2);
+
    // external loop
    for (i1 = 0; i1 < n1; i1++) {
-      p1 = event1->GetParticle(fSel1[i1]);
-      //p1 = event1->GetParticle(i1);
-      //if (p1->Charge() != fCharge[0]) continue;
-      //if (!p1->HasCutBit(fCutID[0])) continue;
+      p1 = event1->GetParticle(lead->fSel1[i1]);
       // define starting point for inner loop
       // if daughter selection criteria (charge, cuts) are the same
       // and the two events coincide, internal loop must start from
@@ -566,88 +613,101 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
       AliDebugClass(2, Form("Start point = %d", start));
       // internal loop
       for (i2 = start; i2 < n2; i2++) {
-         p2 = event2->GetParticle(fSel2[i2]);
-         //p2 = event2->GetParticle(i2);
-         //if (p2->Charge() != fCharge[1]) continue;
-         //if (!p2->HasCutBit(fCutID[1])) continue;
+         p2 = event2->GetParticle(lead->fSel2[i2]);
          // avoid to mix a particle with itself
          if (sameEvent && (p1->Index() == p2->Index()) && (!p1->IsResonance())) {
             AliDebugClass(2, "Skipping same index");
             continue;
          }
          // sum momenta
-          
          mass1 = p1->StoredMass(kFALSE);
-         if(!fUseStoredMass[0] || mass1 < 0.0) mass1 = GetMass(0);
+         if(!lead->fUseStoredMass[0] || mass1 < 0.0) mass1 = lead->GetMass(0);
          mass2 = p2->StoredMass(kFALSE);
-         if(!fUseStoredMass[1] || mass2 < 0.0) mass2 = GetMass(1);
-         fPair.Fill(p1, p2, mass1, mass2, fMotherMass);
-	 
+         if(!lead->fUseStoredMass[1] || mass2 < 0.0) mass2 = lead->GetMass(1);
+         pair.Fill(p1, p2, mass1, mass2, lead->fMotherMass);
+
          // do rotation if needed
-         if (fComputation == kTrackPairRotated1) fPair.InvertP(kTRUE);
-         if (fComputation == kTrackPairRotated2) fPair.InvertP(kFALSE);
-         // if required, check that this is a true pair
-         if (fComputation == kTruePair) {
-            if (fPair.Mother() < 0)  {
-               continue;
-            } else if (fPair.MotherPDG() != fMotherPDG) {
-               continue;
-            }
-            Bool_t decayMatch = kFALSE;
-            if (AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(0))
-		&& AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(1)))
-               decayMatch = kTRUE;
-            if (AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(0))
-		&& AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(1)))
-               decayMatch = kTRUE;
-            if (!decayMatch) continue;
-	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) continue;
-	    if ( fCheckP &&(TMath::Abs(fPair.PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(fPair.PmotherX())+1.e-13)) > 0.00001 &&
-		          (TMath::Abs(fPair.PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(fPair.PmotherY())+1.e-13)) > 0.00001 &&
-     			  (TMath::Abs(fPair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(fPair.PmotherZ())+1.e-13)) > 0.00001 ) continue;
-	    if ( fCheckFeedDown ){
-	    		Int_t pdgGranma = 0;
-	  		Bool_t isFromB=kFALSE;
-	  		Bool_t isQuarkFound=kFALSE;
-			
-			if(fPair.IsFromB() == kTRUE) isFromB = kTRUE;
-			if(fPair.IsQuarkFound() == kTRUE) isQuarkFound = kTRUE;
-	  		if(fRejectIfNoQuark && !isQuarkFound) pdgGranma = -99999;
-	  		if(isFromB){
-	  		  if (!fKeepDfromB) pdgGranma = -9999; //skip particle if come from a B meson.
-	  		}
-	  		else{
-	  		  if (fKeepDfromBOnly) pdgGranma = -999;
-			  }
-	  		if (pdgGranma == -99999){
-	  			AliDebug(2,"This particle does not have a quark in his genealogy\n");
-	  			continue;
-	  		}
-	  		if (pdgGranma == -9999){
-	  			AliDebug(2,"This particle come from a B decay channel but according to the settings of the task, we keep only the prompt charm particles\n");
-	  			continue;
-	  		}
-	 
-	  		if (pdgGranma == -999){
-	  			AliDebug(2,"This particle come from a prompt charm particles but according to the settings of the task, we want only the ones coming from B\n");
-	  			continue;
-	  		}
-		    }
+         if (lead->fComputation == kTrackPairRotated1) pair.InvertP(kTRUE);
+         if (lead->fComputation == kTrackPairRotated2) pair.InvertP(kFALSE);
+
+         // check, get computed values & fill histogram of each definition
+         std::fill(cached.begin(), cached.end(), 0);
+         for (iout = 0; iout < nOutputs; iout++) {
+            AliRsnMiniOutput *out = outputs[iout];
+            if (!out->AcceptPair(p1, p2, pair)) continue;
+            nadded++;
+            out->ComputePairValues(pair, refEvent, valueList, cache.data(), cached.data());
+            out->FillHistogram();
          }
-         // check pair against cuts
-         if (fPairCuts) {
-            if (!fPairCuts->IsSelected(&fPair)) continue;
-         }
-         // get computed values & fill histogram
-         nadded++;
-         if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
-         FillHistogram();
       } // end internal loop
    } // end external loop
 
    AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
    return nadded;
 }
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::AcceptPair(AliRsnMiniParticle *p1, AliRsnMiniParticle *p2, AliRsnMiniPair &pair)
+{
+//
+// Checks of this definition on a pair built by FillPairs:
+// true pair requirements if needed, and pair cuts
+//
+
+   // if required, check that this is a true pair
+   if (fComputation == kTruePair) {
+      if (pair.Mother() < 0)  {
+         return kFALSE;
+      } else if (pair.MotherPDG() != fMotherPDG) {
+         return kFALSE;
+      }
+      Bool_t decayMatch = kFALSE;
+      if (AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(0))
+          && AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(1)))
+         decayMatch = kTRUE;
+      if (AliRsnDaughter::IsEquivalentPDGCode(p2->PDGAbs() , GetPDG(0))
+          && AliRsnDaughter::IsEquivalentPDGCode(p1->PDGAbs() , GetPDG(1)))
+         decayMatch = kTRUE;
+      if (!decayMatch) return kFALSE;
+      if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) return kFALSE;
+      if ( fCheckP &&(TMath::Abs(pair.PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(pair.PmotherX())+1.e-13)) > 0.00001 &&
+           (TMath::Abs(pair.PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(pair.PmotherY())+1.e-13)) > 0.00001 &&
+           (TMath::Abs(pair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(pair.PmotherZ())+1.e-13)) > 0.00001 ) return kFALSE;
+      if ( fCheckFeedDown ){
+         Int_t pdgGranma = 0;
+         Bool_t isFromB=kFALSE;
+         Bool_t isQuarkFound=kFALSE;
+
+         if(pair.IsFromB() == kTRUE) isFromB = kTRUE;
+         if(pair.IsQuarkFound() == kTRUE) isQuarkFound = kTRUE;
+         if(fRejectIfNoQuark && !isQuarkFound) pdgGranma = -99999;
+         if(isFromB){
+            if (!fKeepDfromB) pdgGranma = -9999; //skip particle if come from a B meson.
+         }
+         else{
+            if (fKeepDfromBOnly) pdgGranma = -999;
+         }
+         if (pdgGranma == -99999){
+            AliDebug(2,"This particle does not have a quark in his genealogy\n");
+            return kFALSE;
+         }
+         if (pdgGranma == -9999){
+            AliDebug(2,"This particle come from a B decay channel but according to the settings of the task, we keep only the prompt charm particles\n");
+            return kFALSE;
+         }
+
+         if (pdgGranma == -999){
+            AliDebug(2,"This particle come from a prompt charm particles but according to the settings of the task, we want only the ones coming from B\n");
+            return kFALSE;
+         }
+      }
+   }
+   // check pair against cuts
+   if (fPairCuts) {
+      if (!fPairCuts->IsSelected(&pair)) return kFALSE;
+   }
+   return kTRUE;
+}
 //___________________________________________________________
 void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
 {
@@ -711,6 +771,59 @@ void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *value
    }
 }
 
+//________________________________________________________________________________________
+void AliRsnMiniOutput::ComputePairValues(AliRsnMiniPair &pair, AliRsnMiniEvent *event, TClonesArray *valueList, Float_t *cache, Char_t *cached)
+{
+//
+// Same as ComputeValues, for a pair shared with other definitions (FillPairs).
+// Values already computed on the pair by another definition are taken from 'cache'.
+// CosThetaStar boosts the first daughter of the pair it is computed on: it is
+// computed on a private copy (the 'fPair' data member), which is then used for
+// the following values, like when each definition built its own pair.
+// PhiV is random, it is never taken from the cache.
+//
+
+   // check size of computed array
+   Int_t size = fAxes.GetEntries();
+   if (fComputed.GetSize() != size) fComputed.Set(size);
+
+   Int_t i, ival, nval = valueList->GetEntries();
+   AliRsnMiniPair *current = &pair;
+
+   for (i = 0; i < size; i++) {
+      fComputed[i] = 1E20;
+      AliRsnMiniAxis *axis = (AliRsnMiniAxis *)fAxes[i];
+      if (!axis) {
+         AliError("Null axis");
+         continue;
+      }
+      ival = axis->GetValueID();
+      if (ival < 0 || ival >= nval) {
+         AliError(Form("Required value #%d, while maximum is %d", ival, nval));
+         continue;
+      }
+      AliRsnMiniValue *val = (AliRsnMiniValue *)valueList->At(ival);
+      if (!val) {
+         AliError(Form("Value in position #%d is NULL", ival));
+         continue;
+      }
+      AliRsnMiniValue::EType type = val->GetType();
+      if (type == AliRsnMiniValue::kCosThetaStar && current == &pair) {
+         fPair = pair;
+         current = &fPair;
+      }
+      if (current == &pair && type != AliRsnMiniValue::kPhiV) {
+         if (!cached[ival]) {
+            cache[ival] = val->Eval(current, event);
+            cached[ival] = 1;
+         }
+         fComputed[i] = cache[ival];
+      } else {
+         fComputed[i] = val->Eval(current, event);
+      }
+   }
+}
+
 //________________________________________________________________________________________
 void AliRsnMiniOutput::FillHistogram()
 {
@@ -110,12 +110,16 @@ public:
    Bool_t          FillMotherInAcceptance(const AliRsnMiniPair *pair, AliRsnMiniEvent *event, TClonesArray *valueList);
    Bool_t          FillEvent(AliRsnMiniEvent *event, TClonesArray *valueList);
    Int_t           FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst = kTRUE);
+   Bool_t          SamePairs(const AliRsnMiniOutput *other) const;
+   static Int_t    FillPairs(Int_t nOutputs, AliRsnMiniOutput **outputs, AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst = kTRUE);
 
 private:
 
    void   CreateHistogram(const char *name);
    void   CreateHistogramSparse(const char *name);
    void   ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList);
+   void   ComputePairValues(AliRsnMiniPair &pair, AliRsnMiniEvent *event, TClonesArray *valueList, Float_t *cache, Char_t *cached);
+   Bool_t AcceptPair(AliRsnMiniParticle *p1, AliRsnMiniParticle *p2, AliRsnMiniPair &pair);
    void   FillHistogram();
 
    EOutputType      fOutputType;       //  type of output
@@ -56,7 +56,9 @@
 #include "TMath.h"
 #include "TProfile.h"
 #include "TTree.h"
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #ifdef USETREECLASS
 #include "AliAnTOFevent.h"
 #include "AliAnTOFtrack.h"
@@ -275,8 +277,11 @@ AliAnalysisTaskTOFSpectra::AliAnalysisTaskTOFSpectra(const TString taskname, con
   Init();
 
   //Objects for cut variation
-  for (Int_t cut = 0; cut < nCutVars; cut++)
+  for (Int_t cut = 0; cut < nCutVars; cut++) {
     fCutVar[cut] = 0x0;
+    fCutVarOrder[cut] = cut;
+    fCutVarNested[cut] = kFALSE;
+  }
 
   //Objects for TOF calibration
   if (fRecalibrateTOF) {
@@ -3017,22 +3022,21 @@ Bool_t AliAnalysisTaskTOFSpectra::AnalyseCutVariation(const AliESDtrack* track)
   if (!track) {
     return kFALSE;
   }
-  Int_t index = 0;
   hCutVariation->Fill(19); //All tracks
-  for (UInt_t cut = 0; cut < nCuts; cut++) {
-    for (UInt_t i = 1; i < CutIndex[cut]; i++) { //Loose cuts are already passed -> Skipping!
-      if (fCutVar[index]->AcceptTrack(track)) {
-        hCutVariation->Fill(index);
-        AliDebug(2, Form("Track passed the cut %s (%s) at %f this will switch the bit %i !", fCutVar[index]->GetName(), fCutVar[index]->GetTitle(), CutValues[cut][i], index));
-        SetTrkCutMaskBit((fTrkCutMaskIndex)index, 1);
-      }
-      index++;
+  //The cut variations on the same variable are checked from loose to tight: a track failing one of them fails also the tighter ones
+  Bool_t failed = kFALSE;
+  for (Int_t iVar = 0; iVar < nCutVars; iVar++) {
+    const Int_t index = fCutVarOrder[iVar];
+    if (fCutVarNested[iVar] && failed)
+      continue;
+    failed = !fCutVar[index]->AcceptTrack(track);
+    if (!failed) {
+      hCutVariation->Fill(index);
+      AliDebug(2, Form("Track passed the cut %s (%s) this will switch the bit %i !", fCutVar[index]->GetName(), fCutVar[index]->GetTitle(), index));
+      SetTrkCutMaskBit((fTrkCutMaskIndex)index, 1);
     }
   }
 
-  if (index != nCutVars)
-    AliFatal(Form("Wrong final index (%i should be %i)", index, nCutVars));
-
   return kTRUE;
 }
 
@@ -3149,6 +3153,28 @@ void AliAnalysisTaskTOFSpectra::SetCutVar()
           AliInfo(Form("Setting Cut %s (%s) to accept loose cuts for %s value: #%i %s", cuts->GetName(), cuts->GetTitle(), Cuts[cut].Data(), i, c.Data()));
       }
     }
+    if (index != nCutVars)
+      AliFatal(Form("Wrong final index (%i should be %i)", index, nCutVars));
+
+    //Order of the checks: each cut variation only sets one threshold, the variations on the same variable are sorted from loose to tight
+    index = 0;
+    Int_t iVar = 0;
+    for (UInt_t cut = 0; cut < nCuts; cut++) {
+      std::vector<std::pair<Double_t, Int_t> > tightness;
+      for (UInt_t i = 1; i < CutIndex[cut]; i++) {
+        if (cut == kGeo) //Several parameters, the variations are not nested
+          tightness.push_back(std::make_pair(0., index++));
+        else //Minimum number of rows, maximum chi2 and DCA
+          tightness.push_back(std::make_pair(cut == kTPCrows ? CutValues[cut][i] : -CutValues[cut][i], index++));
+      }
+      if (cut != kGeo)
+        std::stable_sort(tightness.begin(), tightness.end());
+      for (UInt_t i = 0; i < tightness.size(); i++) {
+        fCutVarOrder[iVar] = tightness[i].second;
+        fCutVarNested[iVar] = (i > 0 && cut != kGeo);
+        iVar++;
+      }
+    }
   }
 }
 
@@ -397,6 +397,8 @@ class AliAnalysisTaskTOFSpectra : public AliAnalysisTaskSE {
   AliESDEvent* fESD;                  //!<! ESD object
   AliMCEvent* fMCEvt;                 //!<! MC event
   AliESDtrackCuts* fCutVar[nCutVars]; //!<! basic cut variables cut variations
+  Int_t fCutVarOrder[nCutVars];       //!<! order in which the cut variations are checked, from loose to tight within each cut type
+  Bool_t fCutVarNested[nCutVars];     //!<! the cut variation is tighter than the previous one in fCutVarOrder on the same variable
   AliMultSelection* fMultSel;         //!<! Multiplicity selection
 
   //TOF specific objects
@@ -768,7 +770,7 @@ class AliAnalysisTaskTOFSpectra : public AliAnalysisTaskSE {
   AliAnalysisTaskTOFSpectra(const AliAnalysisTaskTOFSpectra&);            //! Copy constructor
   AliAnalysisTaskTOFSpectra& operator=(const AliAnalysisTaskTOFSpectra&); //! Not implemented
 
-  ClassDef(AliAnalysisTaskTOFSpectra, 15); //AliAnalysisTaskTOFSpectra used for the Pi/K/p analysis with TOF
+  ClassDef(AliAnalysisTaskTOFSpectra, 16); //AliAnalysisTaskTOFSpectra used for the Pi/K/p analysis with TOF
 };
 
 #endif
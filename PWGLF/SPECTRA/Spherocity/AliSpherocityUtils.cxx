@@ -49,6 +49,7 @@
 #include <TFile.h>
 #include "AliAODHeader.h"
 // STL includes
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
@@ -66,6 +67,7 @@ AliSpherocityUtils::AliSpherocityUtils():TObject(),
 	fAODFilterGlobal(0),
 	fMinMult(3),
 	fSizeStep(0.1),
+	fUseExactAxis(kFALSE),
 	fIsAbsEta(kTRUE),
 	fEtaMaxCut(0.8),
 	fEtaMinCut(0.0),
@@ -90,6 +92,7 @@ AliSpherocityUtils::AliSpherocityUtils(const AliSpherocityUtils &c) :
 	fAODFilterGlobal(0),
 	fMinMult(3),
 	fSizeStep(0.1),
+	fUseExactAxis(kFALSE),
 	fIsAbsEta(kTRUE),
 	fEtaMaxCut(0.8),
 	fEtaMinCut(0.0),
@@ -376,6 +379,15 @@ Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, con
 
 	}
 
+	// transverse momentum components, the same for all the axes
+	vector<Float_t> px(fNrec), py(fNrec);
+	for(Int_t i1 = 0; i1 < fNrec; ++i1){
+		px[i1] = pt[i1] * TMath::Cos( phi[i1] );
+		py[i1] = pt[i1] * TMath::Sin( phi[i1] );
+	}
+
+	if(fUseExactAxis) return AnalyseGetSpherocityExact( px, py, sumapt );
+
 	//Getting thrust
 	for(Int_t i = 0; i < 360/(fSizeStep); ++i){
 		Float_t numerador = 0;
@@ -387,10 +399,7 @@ Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, con
 		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
 		for(Int_t i1 = 0; i1 < fNrec; ++i1){
 
-			Float_t pxA = pt[i1] * TMath::Cos( phi[i1] );
-			Float_t pyA = pt[i1] * TMath::Sin( phi[i1] );
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
+			numerador += TMath::Abs( ny * px[i1] - nx * py[i1] );//product between p  proyection in XY plane and the unitary vector
 		}
 		pFull=TMath::Power( (numerador / sumapt),2 );
 		if(pFull < Spherocity)//maximization of pFull
@@ -404,6 +413,56 @@ Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, con
 
 	return spherocity;
 
+}
+//_____________________________________________________________________
+Float_t AliSpherocityUtils::AnalyseGetSpherocityExact( const vector<Float_t> &px, const vector<Float_t> &py, Float_t sumapt ){
+
+	// Sum_i |p_i x n| is concave in the axis angle between two track directions,
+	// so the minimum is reached along one of them: only these axes are tried.
+	// For the axis along track j the tracks in the half plane (phi_j, phi_j+pi)
+	// enter with a + sign, the others with a - sign; with the tracks sorted in
+	// phi the two sums are prefix sums over a window moving with j.
+
+	Int_t n = fNrec;
+
+	vector< pair<Double_t,Int_t> > order(n);
+	for(Int_t i1 = 0; i1 < n; ++i1){
+		Double_t angle = TMath::ATan2( py[i1], px[i1] );
+		if(angle < 0) angle += TMath::TwoPi();
+		order[i1] = make_pair( angle, i1 );
+	}
+	sort( order.begin(), order.end() );
+
+	// angles and prefix sums over two turns, to follow the half plane past 2pi
+	vector<Double_t> angle(2*n), sumx(2*n+1,0.), sumy(2*n+1,0.);
+	for(Int_t k = 0; k < 2*n; ++k){
+		Int_t i1 = order[k%n].second;
+		angle[k] = order[k%n].first + (k<n ? 0. : TMath::TwoPi());
+		sumx[k+1] = sumx[k] + px[i1];
+		sumy[k+1] = sumy[k] + py[i1];
+	}
+	Double_t totx = sumx[n];
+	Double_t toty = sumy[n];
+
+	Double_t minimum = -1;
+	Int_t end = 0;
+	for(Int_t j = 0; j < n; ++j){
+		if(end < j+1) end = j+1;
+		while(end < j+n && angle[end] < angle[j] + TMath::Pi()) ++end;
+		Double_t inx = sumx[end] - sumx[j+1];
+		Double_t iny = sumy[end] - sumy[j+1];
+		Double_t nx = TMath::Cos( angle[j] );
+		Double_t ny = TMath::Sin( angle[j] );
+		Double_t value = TMath::Abs( 2*( nx*iny - ny*inx ) - ( nx*toty - ny*totx ) );
+		if(minimum < 0 || value < minimum) minimum = value;
+	}
+
+	Float_t pFull = TMath::Power( (minimum / sumapt),2 );
+	Float_t Spherocity = 2;
+	if(pFull < Spherocity) Spherocity = pFull;
+
+	return ((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
+
 }
 //_____________________________________________________________________
 Float_t AliSpherocityUtils::GetSpherocity( TH1D * hphi, TH1D *heta )
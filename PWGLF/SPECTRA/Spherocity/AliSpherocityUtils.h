@@ -39,6 +39,7 @@ class AliSpherocityUtils : public TObject {
 
   void  SetMinMult(Int_t minnch)        {fMinMult    = minnch;}
   void  SetStepSize(Float_t sizestep)   {fSizeStep   = sizestep;}
+  void  SetUseExactAxis(Bool_t exact)   {fUseExactAxis = exact;} // minimise over the track directions instead of the fSizeStep grid
   void  SetIsEtaAbs(Bool_t isabseta)    {fIsAbsEta   = isabseta;}
   void  SetTrackEtaMin(Float_t etaminF) {fEtaMinCut  = etaminF;}
   void  SetTrackEtaMax(Float_t etamaxF) {fEtaMaxCut  = etamaxF;}
@@ -65,6 +66,10 @@ class AliSpherocityUtils : public TObject {
 		  const std::vector<Float_t> &phi);
 
 
+  Float_t AnalyseGetSpherocityExact(const std::vector<Float_t> &px,
+		  const std::vector<Float_t> &py,
+		  Float_t sumapt);
+
   //EvSel Snippets
   Float_t MinVal( Float_t A, Float_t B ); 
 
@@ -79,6 +84,7 @@ class AliSpherocityUtils : public TObject {
 
   Int_t   fMinMult;
   Float_t fSizeStep;
+  Bool_t  fUseExactAxis;
   Bool_t  fIsAbsEta;
   Float_t fEtaMaxCut;
   Float_t fEtaMinCut;
@@ -86,7 +92,7 @@ class AliSpherocityUtils : public TObject {
   Float_t fPtMinCut;
   Int_t   fRunNumber; // for control of run changes
 
-  ClassDef(AliSpherocityUtils,2) // base helper class
+  ClassDef(AliSpherocityUtils,3) // base helper class
 };
 #endif
 
@@ -63,6 +63,7 @@ class AliESDv0;
 class AliAODv0;
 
 #include <Riostream.h>
+#include <algorithm>
 #include "TList.h"
 #include "TH1.h"
 #include "TH2.h"
@@ -122,6 +123,25 @@ using std::endl;
 
 ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 
+namespace {
+    //Variables of the configuration pre-selection (CutLattice)
+    enum EV0LatticeVariable {
+        kV0LatV0Radius = 0, kV0LatMaxV0Radius, kV0LatDCANegToPV, kV0LatDCAPosToPV,
+        kV0LatDCAV0Daughters, kV0LatV0CosPA, kV0LatCrossedRows, kV0LatCrossedRowsOverFindable,
+        kNV0LatVariables
+    };
+    enum ECascadeLatticeVariable {
+        kCascLatDCANegToPV = 0, kCascLatDCAPosToPV, kCascLatDCAV0Daughters, kCascLatV0CosPA,
+        kCascLatV0Radius, kCascLatDCAV0ToPV, kCascLatDCABachToPV, kCascLatDCACascDaughters,
+        kCascLatCascCosPA, kCascLatCascRadius, kCascLatLeastNbrClusters,
+        kNCascLatVariables
+    };
+    
+    Bool_t ThresholdBelow(const std::pair<Double_t,Int_t> &lCut, Double_t lValue){
+        return lCut.first < lValue;
+    }
+}
+
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
 : AliAnalysisTaskSE(), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
@@ -471,7 +491,9 @@ fTreeCascVarMagneticField(0),
 
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+fV0CutLattice(),
+fCascadeCutLattice()
 //------------------------------------------------
 // Tree Variables
 {
@@ -826,7 +848,9 @@ fTreeCascVarMagneticField(0),
 //Histos
 fHistEventCounter(0),
 fHistEventCounterDifferential(0),
-fHistCentrality(0)
+fHistCentrality(0),
+fV0CutLattice(),
+fCascadeCutLattice()
 {
     
     //Re-vertex: Will only apply for cascade candidates
@@ -2159,7 +2183,21 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             lValidConfigurations++;
         }
         
+        //Pre-selection: one binary search per variable instead of one check per configuration
+        if( fV0CutLattice.fNConfigs != lValidConfigurations ) BuildV0CutLattice(lPointers, lValidConfigurations);
+        Double_t lV0LatticeValues[kNV0LatVariables];
+        lV0LatticeValues[kV0LatV0Radius]       =  fTreeVariableV0Radius;
+        lV0LatticeValues[kV0LatMaxV0Radius]    = -fTreeVariableV0Radius;
+        lV0LatticeValues[kV0LatDCANegToPV]     =  fTreeVariableDcaNegToPrimVertex;
+        lV0LatticeValues[kV0LatDCAPosToPV]     =  fTreeVariableDcaPosToPrimVertex;
+        lV0LatticeValues[kV0LatDCAV0Daughters] = -fTreeVariableDcaV0Daughters;
+        lV0LatticeValues[kV0LatV0CosPA]        =  fTreeVariableV0CosineOfPointingAngle;
+        lV0LatticeValues[kV0LatCrossedRows]    =  fTreeVariableLeastNbrCrossedRows;
+        lV0LatticeValues[kV0LatCrossedRowsOverFindable] = fTreeVariableLeastRatioCrossedRowsOverFindable;
+        fV0CutLattice.Select(lV0LatticeValues);
+        
         for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
+            if( !fV0CutLattice.IsSelected(lcfg) ) continue;
             lV0Result = lPointers[lcfg];
             histoout  = lV0Result->GetHistogram();
             
@@ -3185,28 +3223,54 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         AliCascadeResult *lPointers[50000];
         Long_t lValidConfigurations=0;
         
-        if( lValidXiMinus )
-            for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidXiPlus )
-            for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaMinus )
-            for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaPlus )
-            for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
-                lValidConfigurations++;
-            }
+        //all configurations are listed (fixed order for the pre-selection),
+        //those of the invalid hypotheses are deselected below
+        Long_t lFirstConfiguration[5];
+        
+        lFirstConfiguration[0] = lValidConfigurations;
+        for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
+            lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
+            lValidConfigurations++;
+        }
+        lFirstConfiguration[1] = lValidConfigurations;
+        for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
+            lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
+            lValidConfigurations++;
+        }
+        lFirstConfiguration[2] = lValidConfigurations;
+        for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
+            lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
+            lValidConfigurations++;
+        }
+        lFirstConfiguration[3] = lValidConfigurations;
+        for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
+            lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
+            lValidConfigurations++;
+        }
+        lFirstConfiguration[4] = lValidConfigurations;
+        
+        //Pre-selection: one binary search per variable instead of one check per configuration
+        if( fCascadeCutLattice.fNConfigs != lValidConfigurations ) BuildCascadeCutLattice(lPointers, lValidConfigurations);
+        Double_t lCascLatticeValues[kNCascLatVariables];
+        lCascLatticeValues[kCascLatDCANegToPV]       =  fTreeCascVarDCANegToPrimVtx;
+        lCascLatticeValues[kCascLatDCAPosToPV]       =  fTreeCascVarDCAPosToPrimVtx;
+        lCascLatticeValues[kCascLatDCAV0Daughters]   = -fTreeCascVarDCAV0Daughters;
+        lCascLatticeValues[kCascLatV0CosPA]          =  fTreeCascVarV0CosPointingAngle;
+        lCascLatticeValues[kCascLatV0Radius]         =  fTreeCascVarV0Radius;
+        lCascLatticeValues[kCascLatDCAV0ToPV]        =  fTreeCascVarDCAV0ToPrimVtx;
+        lCascLatticeValues[kCascLatDCABachToPV]      =  fTreeCascVarDCABachToPrimVtx;
+        lCascLatticeValues[kCascLatDCACascDaughters] = -fTreeCascVarDCACascDaughters;
+        lCascLatticeValues[kCascLatCascCosPA]        =  fTreeCascVarCascCosPointingAngle;
+        lCascLatticeValues[kCascLatCascRadius]       =  fTreeCascVarCascRadius;
+        lCascLatticeValues[kCascLatLeastNbrClusters] =  fTreeCascVarLeastNbrClusters;
+        fCascadeCutLattice.Select(lCascLatticeValues);
+        if( !lValidXiMinus    ) fCascadeCutLattice.Deselect(lFirstConfiguration[0], lFirstConfiguration[1]);
+        if( !lValidXiPlus     ) fCascadeCutLattice.Deselect(lFirstConfiguration[1], lFirstConfiguration[2]);
+        if( !lValidOmegaMinus ) fCascadeCutLattice.Deselect(lFirstConfiguration[2], lFirstConfiguration[3]);
+        if( !lValidOmegaPlus  ) fCascadeCutLattice.Deselect(lFirstConfiguration[3], lFirstConfiguration[4]);
         
         for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
+            if( !fCascadeCutLattice.IsSelected(lcfg) ) continue;
             lCascadeResult = lPointers[lcfg];
             Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
             histoout  = lCascadeResult->GetHistogram();
@@ -3676,6 +3740,100 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildV0CutLattice( AliV0Result **lResults, Int_t lNConfigs )
+{
+    //Only the cuts not depending on the mass hypothesis nor on the candidate pT.
+    //Upper cuts are stored negated. A variable V0 CosPA can only tighten the
+    //fixed cut, which is then a necessary condition (as Float_t, like in the check)
+    fV0CutLattice.Reset(lNConfigs, kNV0LatVariables);
+    for(Int_t lcfg=0; lcfg<lNConfigs; lcfg++){
+        AliV0Result *lV0Result = lResults[lcfg];
+        fV0CutLattice.SetThreshold(kV0LatV0Radius,       lcfg,  lV0Result->GetCutV0Radius());
+        fV0CutLattice.SetThreshold(kV0LatMaxV0Radius,    lcfg, -lV0Result->GetCutMaxV0Radius());
+        fV0CutLattice.SetThreshold(kV0LatDCANegToPV,     lcfg,  lV0Result->GetCutDCANegToPV());
+        fV0CutLattice.SetThreshold(kV0LatDCAPosToPV,     lcfg,  lV0Result->GetCutDCAPosToPV());
+        fV0CutLattice.SetThreshold(kV0LatDCAV0Daughters, lcfg, -lV0Result->GetCutDCAV0Daughters());
+        fV0CutLattice.SetThreshold(kV0LatV0CosPA,        lcfg,  (Float_t) lV0Result->GetCutV0CosPA());
+        fV0CutLattice.SetThreshold(kV0LatCrossedRows,    lcfg,  lV0Result->GetCutLeastNumberOfCrossedRows());
+        fV0CutLattice.SetThreshold(kV0LatCrossedRowsOverFindable, lcfg, lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable());
+    }
+    fV0CutLattice.Build();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildCascadeCutLattice( AliCascadeResult **lResults, Int_t lNConfigs )
+{
+    //Same as for the V0s. Variable cascade/V0 CosPA and DCA cascade daughters
+    //only tighten the fixed cuts; the bachelor-baryon CosPA can loosen and is left out
+    fCascadeCutLattice.Reset(lNConfigs, kNCascLatVariables);
+    for(Int_t lcfg=0; lcfg<lNConfigs; lcfg++){
+        AliCascadeResult *lCascadeResult = lResults[lcfg];
+        fCascadeCutLattice.SetThreshold(kCascLatDCANegToPV,       lcfg,  lCascadeResult->GetCutDCANegToPV());
+        fCascadeCutLattice.SetThreshold(kCascLatDCAPosToPV,       lcfg,  lCascadeResult->GetCutDCAPosToPV());
+        fCascadeCutLattice.SetThreshold(kCascLatDCAV0Daughters,   lcfg, -lCascadeResult->GetCutDCAV0Daughters());
+        fCascadeCutLattice.SetThreshold(kCascLatV0CosPA,          lcfg,  (Float_t) lCascadeResult->GetCutV0CosPA());
+        fCascadeCutLattice.SetThreshold(kCascLatV0Radius,         lcfg,  lCascadeResult->GetCutV0Radius());
+        fCascadeCutLattice.SetThreshold(kCascLatDCAV0ToPV,        lcfg,  lCascadeResult->GetCutDCAV0ToPV());
+        fCascadeCutLattice.SetThreshold(kCascLatDCABachToPV,      lcfg,  lCascadeResult->GetCutDCABachToPV());
+        fCascadeCutLattice.SetThreshold(kCascLatDCACascDaughters, lcfg, -(Float_t) lCascadeResult->GetCutDCACascDaughters());
+        fCascadeCutLattice.SetThreshold(kCascLatCascCosPA,        lcfg,  (Float_t) lCascadeResult->GetCutCascCosPA());
+        fCascadeCutLattice.SetThreshold(kCascLatCascRadius,       lcfg,  lCascadeResult->GetCutCascRadius());
+        fCascadeCutLattice.SetThreshold(kCascLatLeastNbrClusters, lcfg,  lCascadeResult->GetCutLeastNumberOfClusters());
+    }
+    fCascadeCutLattice.Build();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CutLattice::Reset( Int_t lNConfigs, Int_t lNVariables )
+{
+    fNConfigs = lNConfigs;
+    fCuts.assign(lNVariables, std::vector< std::pair<Double_t,Int_t> >(lNConfigs));
+    fSelected.assign((lNConfigs+63)/64, 0);
+    fScratch.assign((lNConfigs+63)/64, 0);
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CutLattice::Build()
+{
+    for(size_t ivar=0; ivar<fCuts.size(); ivar++) std::sort(fCuts[ivar].begin(), fCuts[ivar].end());
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CutLattice::Select( const Double_t *lValues )
+{
+    //Configurations with threshold < value are the first ones of each sorted
+    //array: set them (or clear the others), whichever is less work
+    const size_t lNWords = fSelected.size();
+    if( lNWords == 0 ) return;
+    fSelected.assign(lNWords, ~0ULL);
+    if( fNConfigs%64 ) fSelected[lNWords-1] = (1ULL<<(fNConfigs%64))-1;
+    
+    for(size_t ivar=0; ivar<fCuts.size(); ivar++){
+        const std::vector< std::pair<Double_t,Int_t> > &lCuts = fCuts[ivar];
+        //a NaN value passes nothing, as in the full check
+        const Int_t lNPass = std::lower_bound(lCuts.begin(), lCuts.end(), lValues[ivar], ThresholdBelow) - lCuts.begin();
+        if( lNPass == fNConfigs ) continue;
+        if( lNPass == 0 ){
+            fSelected.assign(lNWords, 0);
+            return;
+        }
+        if( lNPass < fNConfigs-lNPass ){
+            fScratch.assign(lNWords, 0);
+            for(Int_t i=0; i<lNPass; i++) fScratch[lCuts[i].second>>6] |= 1ULL<<(lCuts[i].second&63);
+            for(size_t iw=0; iw<lNWords; iw++) fSelected[iw] &= fScratch[iw];
+        } else {
+            for(Int_t i=lNPass; i<fNConfigs; i++) fSelected[lCuts[i].second>>6] &= ~(1ULL<<(lCuts[i].second&63));
+        }
+    }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CutLattice::Deselect( Int_t lFirst, Int_t lLast )
+{
+    for(Int_t lcfg=lFirst; lcfg<lLast; lcfg++) fSelected[lcfg>>6] &= ~(1ULL<<(lcfg&63));
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
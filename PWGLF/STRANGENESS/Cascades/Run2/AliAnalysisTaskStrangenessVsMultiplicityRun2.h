@@ -48,6 +48,8 @@ class AliExternalTrackParam;
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
+#include <vector>
+#include <utility>
 #include "AliAnalysisTaskSE.h"
 #include "AliEventCuts.h"
 
@@ -655,10 +657,39 @@ private:
     TH1D *fHistEventCounterDifferential; //!
     TH1D *fHistCentrality; //!
 
+//===========================================================================================
+//   Configuration pre-selection
+//===========================================================================================
+    //The thresholds of the registered configurations, sorted per variable:
+    //a candidate is compared once per variable (binary search) and only the
+    //configurations passing all of them go through the full list of checks
+    struct CutLattice {
+        Int_t fNConfigs;
+        std::vector< std::vector< std::pair<Double_t,Int_t> > > fCuts; //(threshold, configuration), sorted per variable
+        std::vector<ULong64_t> fSelected; //bit per configuration, passing the last Select()
+        std::vector<ULong64_t> fScratch;
+        
+        CutLattice() : fNConfigs(-1), fCuts(), fSelected(), fScratch() {}
+        void Reset(Int_t lNConfigs, Int_t lNVariables);
+        //Configuration passes variable if value > threshold (negate both for upper cuts)
+        void SetThreshold(Int_t lVariable, Int_t lConfig, Double_t lThreshold){
+            fCuts[lVariable][lConfig] = std::make_pair(lThreshold, lConfig);
+        }
+        void Build();
+        void Select(const Double_t *lValues);
+        void Deselect(Int_t lFirst, Int_t lLast);
+        Bool_t IsSelected(Int_t lConfig) const { return (fSelected[lConfig>>6]>>(lConfig&63))&1; }
+    };
+    void BuildV0CutLattice(AliV0Result **lResults, Int_t lNConfigs);
+    void BuildCascadeCutLattice(AliCascadeResult **lResults, Int_t lNConfigs);
+    
+    CutLattice fV0CutLattice;      //! V0 configurations, compiled at the first candidate
+    CutLattice fCascadeCutLattice; //! cascade configurations, compiled at the first candidate
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 4);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 5);
     //1: first implementation
 };
 
@@ -102,12 +102,19 @@ class AliAODv0;
 #include "AliESDInputHandler.h"
 #include "AliLog.h"
 #include "AliTrackerBase.h"
+#include <atomic>
+#include <thread>
 
 using std::cout;
 using std::endl;
 
 ClassImp(AliAnalysisTaskWeakDecayVertexer)
 
+namespace {
+    //number of V0 daughter pairs propagated together in Tracks2V0vertices
+    const Long_t kV0PairBatchSize = 4096;
+}
+
 AliAnalysisTaskWeakDecayVertexer::AliAnalysisTaskWeakDecayVertexer()
 : AliAnalysisTaskSE(), fListHist(0), fPIDResponse(0), fEventCuts(), fTrackTriggerCuts(nullptr), fTriggerParticleType(), fTriggerNsigma(5),
 //________________________________________________
@@ -155,6 +162,7 @@ fMinPtCascade(   0.3 ),
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
 fMinXforXYtest( -3.0 ),
+fNThreads( 1 ),
 //________________________________________________
 //Histos
 fHistEventCounter(0),
@@ -216,6 +224,7 @@ fMinPtCascade(   0.3 ), //pre-selection
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
 fMinXforXYtest( -3.0 ),
+fNThreads( 1 ),
 //________________________________________________
 //Histos
 fHistEventCounter(0),
@@ -643,7 +652,6 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     
     Double_t xPrimaryVertex=vtxT3D->GetX();
     Double_t yPrimaryVertex=vtxT3D->GetY();
-    Double_t zPrimaryVertex=vtxT3D->GetZ();
     
     Long_t nentr=event->GetNumberOfTracks();
     Double_t b=event->GetMagneticField();
@@ -652,6 +660,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
 
     std::vector<Long_t> indices[2][2]; /// 0 -> negative, 1 -> positive, 0 -> normal, 1 -> triggered
 
+    //XY pre-screen: same condition as fkSkipLargeXYDCA in GetDCAV0Dau, evaluated before any propagation
+    Bool_t lPreScreenXY = fkDoImprovedDCAV0DauPropagation && fkSkipLargeXYDCA;
+    std::vector<Double_t> lHelixCircles; /// x, y of the center and radius for each track
+    if (lPreScreenXY) lHelixCircles.assign(3*nentr, 0.);
+
     Long_t i;
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdTrack=event->GetTrack(i);
@@ -669,6 +682,8 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fV0VertexerSels[2]) continue;
         if (TMath::Abs(d)>fV0VertexerSels[6]) continue;
         
+        if (lPreScreenXY) GetHelixCircle(esdTrack, &lHelixCircles[3*i], b);
+        
         int isPos = esdTrack->GetSign() > 0.;
         indices[isPos][0].push_back(i);
         if (fTrackTriggerCuts) {
@@ -681,6 +696,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
 
     Long_t nvtx{0l};
     int useTrigger = fTrackTriggerCuts ? 1 : 0;
+    //Pairs passing the cheap selections are collected in batches: the propagation to the
+    //DCA runs on fNThreads threads, the V0s are then built and stored in the pair order
+    std::vector<V0Pair> lPairs;
+    lPairs.reserve(kV0PairBatchSize);
     for (int trgIter = 0; trgIter < 1 + useTrigger; ++trgIter) {
         for (Long_t nidx : indices[0][trgIter % 2]) {
             AliESDtrack *ntrk=event->GetTrack(nidx);
@@ -692,138 +711,223 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
                 
                 fHistV0Statistics->Fill(0.5); //number of considered pairs
                 
-                Double_t lNegMassForTracking = ntrk->GetMassForTracking();
-                Double_t lPosMassForTracking = ptrk->GetMassForTracking();
-                
                 if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
                     if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
                 
                 fHistV0Statistics->Fill(1.5); //pass distance to PV
                 
-                AliExternalTrackParam nt(*ntrk), pt(*ptrk);
-                Bool_t lUsedOptimalParams = kFALSE;
-                
-                if( fkUseOptimalTrackParams ){
-                    //reroute to pointers obtained with on-the-fly finding, please
-                    map<pair<int,int>, int>::iterator iter = fOTFMap.find(make_pair(nidx,pidx));
-                    if(iter != fOTFMap.end())
-                    {
-                        Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
-                        AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
-                        if(!v0_otf){
-                            AliWarning(Form("Invalid V0 at position %i!", lEquivalentOTFV0));
-                            fHistV0OptimalTrackParamUse->Fill(2.5);
-                        }else{
-                            AliExternalTrackParam ptimproved(*(v0_otf->GetParamP()));
-                            AliExternalTrackParam ntimproved(*(v0_otf->GetParamN()));
-                            if( v0_otf->GetParamP()->Charge() > 0 && v0_otf->GetParamN()->Charge() < 0 ) {
-                                //V0 daughter track swapping is required! Note: everything is swapped here... P->N, N->P
-                                pt = ptimproved;
-                                nt = ntimproved;
-                            }else{
-                                //swap charges if charges are swapped
-                                pt = ntimproved;
-                                nt = ptimproved;
-                            }
-                            fHistV0OptimalTrackParamUse->Fill(1.5);
-                            lUsedOptimalParams=kTRUE;
-                        }
-                    }else{
-                        //OTF not available for this pair
-                        fHistV0OptimalTrackParamUse->Fill(0.5);
-                    }
-                }
-                AliExternalTrackParam *ntp=&nt, *ptp=&pt;
-                Double_t xn, xp, dca;
-                
-                //Improved call: use own function, including XY-pre-opt stage
-                
-                //Re-propagate to closest position to the primary vertex if asked to do so
-                if (fkResetInitialPositions){
-                    Double_t dztemp[2], covartemp[3];
-                    //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
-                    ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-                    ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+                V0Pair lPair;
+                lPair.fNidx = nidx;
+                lPair.fPidx = pidx;
+                lPairs.push_back(lPair);
+                if ((Long_t)lPairs.size() >= kV0PairBatchSize) {
+                    nvtx += ProcessV0Pairs(event, lPairs, lHelixCircles);
+                    lPairs.clear();
                 }
-                
-                if( fkDoImprovedDCAV0DauPropagation ){
-                    //Improved: use own call
-                    dca=GetDCAV0Dau(ptp, ntp, xp, xn, b, lNegMassForTracking, lPosMassForTracking);
-                }else{
-                    //Old: use old call
-                    dca=nt.GetDCA(&pt,b,xn,xp);
-                }
-                
-                if (dca > fV0VertexerSels[3]) continue;
-                
-                fHistV0Statistics->Fill(2.5); //pass dca
-                
-                if ((xn+xp) > 2*fV0VertexerSels[6] && fkPreselectX) continue;
-                if ((xn+xp) < 2*fV0VertexerSels[5] && fkPreselectX) continue;
-                
-                fHistV0Statistics->Fill(3.5); //pass X within R2D cut
-                
-                if(!fkDoMaterialCorrection){
-                    nt.PropagateTo(xn,b);
-                    pt.PropagateTo(xp,b);
+            }
+        }
+    }
+    nvtx += ProcessV0Pairs(event, lPairs, lHelixCircles);
+    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx);
+    return nvtx;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::PropagateV0Pair(AliESDEvent *event, V0Pair &lPair, const std::vector<Double_t> &lHelixCircles) {
+    //--------------------------------------------------------------------
+    // Daughter DCA of one pair of Tracks2V0vertices: choice of the track
+    // parameters, XY pre-screen and propagation. Does not fill histograms
+    // nor modify the task, so that it can run on several threads
+    //--------------------------------------------------------------------
+    const AliESDVertex *vtxT3D=event->GetPrimaryVertex();
+    Double_t b=event->GetMagneticField();
+    
+    AliESDtrack *ntrk=event->GetTrack(lPair.fNidx);
+    AliESDtrack *ptrk=event->GetTrack(lPair.fPidx);
+    Double_t lNegMassForTracking = ntrk->GetMassForTracking();
+    Double_t lPosMassForTracking = ptrk->GetMassForTracking();
+    
+    lPair.fOTFStatus = -1;
+    lPair.fOTFIndex = -1;
+    lPair.fUsedOptimalParams = kFALSE;
+    lPair.fDCA = 1e+33;
+    lPair.fNt = *ntrk;
+    lPair.fPt = *ptrk;
+    
+    if( fkUseOptimalTrackParams ){
+        //reroute to pointers obtained with on-the-fly finding, please
+        map<pair<int,int>, int>::const_iterator iter = fOTFMap.find(make_pair(lPair.fNidx,lPair.fPidx));
+        if(iter != fOTFMap.end())
+        {
+            Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
+            AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
+            lPair.fOTFIndex = lEquivalentOTFV0;
+            if(!v0_otf){
+                lPair.fOTFStatus = 2;
+            }else{
+                AliExternalTrackParam ptimproved(*(v0_otf->GetParamP()));
+                AliExternalTrackParam ntimproved(*(v0_otf->GetParamN()));
+                if( v0_otf->GetParamP()->Charge() > 0 && v0_otf->GetParamN()->Charge() < 0 ) {
+                    //V0 daughter track swapping is required! Note: everything is swapped here... P->N, N->P
+                    lPair.fPt = ptimproved;
+                    lPair.fNt = ntimproved;
                 }else{
-                    AliExternalTrackParam *ntp=&nt, *ptp=&pt;
-                    AliTrackerBase::PropagateTrackTo(ntp, xn, lNegMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
-                    AliTrackerBase::PropagateTrackTo(ptp, xp, lPosMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
+                    //swap charges if charges are swapped
+                    lPair.fPt = ntimproved;
+                    lPair.fNt = ptimproved;
                 }
-                
-                //select maximum eta range (after propagation)
-                if (TMath::Abs(nt.Eta())>0.8&&fkExtraCleanup) continue;
-                if (TMath::Abs(pt.Eta())>0.8&&fkExtraCleanup) continue;
-                
-                fHistV0Statistics->Fill(4.5); //pass eta cut
-                
-                AliESDv0 vertex(nt,nidx,pt,pidx);
-                
-                //Experimental: refit V0 if asked to do so
-                if( fkDoV0Refit ) vertex.Refit();
-                
-                //No selection: it was not previously applied, don't  apply now.
-                //if (vertex.GetChi2V0() > fChi2max) continue;
-                
-                Double_t x=vertex.Xv(), y=vertex.Yv();
-                Double_t r2=x*x + y*y;
-                if (r2 < fV0VertexerSels[5]*fV0VertexerSels[5]) continue;
-                if (r2 > fV0VertexerSels[6]*fV0VertexerSels[6]) continue;
-                
-                fHistV0Statistics->Fill(5.5); //pass radius cut
-                
-                Float_t cpa=vertex.GetV0CosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex);
-                
-                //Simple cosine cut (no pt dependence for now)
-                if (cpa < fV0VertexerSels[4]) continue;
-                
-                fHistV0Statistics->Fill(6.5); //pass cosPA
-                
-                vertex.SetDcaV0Daughters(dca);
-                vertex.SetV0CosineOfPointingAngle(cpa);
-                vertex.ChangeMassHypothesis(kK0Short);
-                
-                //pre-select on pT
-                Double_t lMomX       = 0. , lMomY = 0., lMomZ = 0.;
-                Double_t lTransvMom  = 0. ;
-                vertex.GetPxPyPz( lMomX, lMomY, lMomZ );
-                lTransvMom      = TMath::Sqrt( lMomX*lMomX   + lMomY*lMomY );
-                if(lTransvMom<fMinPtV0) continue;
-                if(lTransvMom>fMaxPtV0) continue;
-                
-                fHistV0Statistics->Fill(7.5); //within pT range
-                if (lUsedOptimalParams) fHistV0Statistics->Fill(8.5); //good V0, used OTF params
-                
-                event->AddV0(&vertex);
-                
-                nvtx++;
-                
-                //if ( nvtx % 10000 ) gObjectTable->Print(); //debug, REMOVE ME PLEASE
+                lPair.fOTFStatus = 1;
+                lPair.fUsedOptimalParams=kTRUE;
             }
+        }else{
+            //OTF not available for this pair
+            lPair.fOTFStatus = 0;
         }
     }
-    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx);
+    
+    //circles apart: would be rejected by GetDCAV0Dau, skip the propagation
+    if (!lHelixCircles.empty() && !lPair.fUsedOptimalParams &&
+        AreHelixCirclesApart(&lHelixCircles[3*lPair.fNidx], &lHelixCircles[3*lPair.fPidx])) return;
+    
+    AliExternalTrackParam *ntp=&lPair.fNt, *ptp=&lPair.fPt;
+    
+    //Improved call: use own function, including XY-pre-opt stage
+    
+    //Re-propagate to closest position to the primary vertex if asked to do so
+    if (fkResetInitialPositions){
+        Double_t dztemp[2], covartemp[3];
+        //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
+        ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+        ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+    }
+    
+    if( fkDoImprovedDCAV0DauPropagation ){
+        //Improved: use own call
+        lPair.fDCA=GetDCAV0Dau(ptp, ntp, lPair.fXp, lPair.fXn, b, lNegMassForTracking, lPosMassForTracking);
+    }else{
+        //Old: use old call
+        lPair.fDCA=lPair.fNt.GetDCA(&lPair.fPt,b,lPair.fXn,lPair.fXp);
+    }
+}
+
+//________________________________________________________________________
+Long_t AliAnalysisTaskWeakDecayVertexer::ProcessV0Pairs(AliESDEvent *event, std::vector<V0Pair> &lPairs, const std::vector<Double_t> &lHelixCircles) {
+    //--------------------------------------------------------------------
+    // Propagate a batch of pairs of Tracks2V0vertices, on fNThreads
+    // threads, then build the V0s in the order of the pairs: the output
+    // does not depend on the number of threads. The material correction
+    // uses the (not thread-safe) geometry manager: single thread then
+    //--------------------------------------------------------------------
+    if (lPairs.empty()) return 0;
+    
+    const AliESDVertex *vtxT3D=event->GetPrimaryVertex();
+    Double_t xPrimaryVertex=vtxT3D->GetX();
+    Double_t yPrimaryVertex=vtxT3D->GetY();
+    Double_t zPrimaryVertex=vtxT3D->GetZ();
+    Double_t b=event->GetMagneticField();
+    
+    Int_t lNThreads = fkDoMaterialCorrection ? 1 : fNThreads;
+    if (lNThreads > 1) {
+        std::atomic<size_t> lNext(0);
+        const size_t kChunk=64;
+        auto worker=[&]() {
+            for(size_t lFirst=lNext.fetch_add(kChunk); lFirst<lPairs.size(); lFirst=lNext.fetch_add(kChunk)) {
+                size_t lLast=TMath::Min(lFirst+kChunk,lPairs.size());
+                for(size_t ip=lFirst; ip<lLast; ip++) PropagateV0Pair(event, lPairs[ip], lHelixCircles);
+            }
+        };
+        std::vector<std::thread> lThreads;
+        for(Int_t it=1; it<lNThreads; it++) lThreads.push_back(std::thread(worker));
+        worker();
+        for(size_t it=0; it<lThreads.size(); it++) lThreads[it].join();
+    } else {
+        for(size_t ip=0; ip<lPairs.size(); ip++) PropagateV0Pair(event, lPairs[ip], lHelixCircles);
+    }
+    
+    Long_t nvtx=0;
+    for(size_t ip=0; ip<lPairs.size(); ip++) {
+        V0Pair &lPair = lPairs[ip];
+        Long_t nidx = lPair.fNidx, pidx = lPair.fPidx;
+        AliESDtrack *ntrk=event->GetTrack(nidx);
+        AliESDtrack *ptrk=event->GetTrack(pidx);
+        Double_t lNegMassForTracking = ntrk->GetMassForTracking();
+        Double_t lPosMassForTracking = ptrk->GetMassForTracking();
+        
+        if (lPair.fOTFStatus == 0) fHistV0OptimalTrackParamUse->Fill(0.5);
+        if (lPair.fOTFStatus == 1) fHistV0OptimalTrackParamUse->Fill(1.5);
+        if (lPair.fOTFStatus == 2) {
+            AliWarning(Form("Invalid V0 at position %i!", lPair.fOTFIndex));
+            fHistV0OptimalTrackParamUse->Fill(2.5);
+        }
+        Bool_t lUsedOptimalParams = lPair.fUsedOptimalParams;
+        AliExternalTrackParam &nt = lPair.fNt, &pt = lPair.fPt;
+        Double_t xn = lPair.fXn, xp = lPair.fXp, dca = lPair.fDCA;
+        
+        if (dca > fV0VertexerSels[3]) continue;
+        
+        fHistV0Statistics->Fill(2.5); //pass dca
+        
+        if ((xn+xp) > 2*fV0VertexerSels[6] && fkPreselectX) continue;
+        if ((xn+xp) < 2*fV0VertexerSels[5] && fkPreselectX) continue;
+        
+        fHistV0Statistics->Fill(3.5); //pass X within R2D cut
+        
+        if(!fkDoMaterialCorrection){
+            nt.PropagateTo(xn,b);
+            pt.PropagateTo(xp,b);
+        }else{
+            AliExternalTrackParam *ntp=&nt, *ptp=&pt;
+            AliTrackerBase::PropagateTrackTo(ntp, xn, lNegMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
+            AliTrackerBase::PropagateTrackTo(ptp, xp, lPosMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
+        }
+        
+        //select maximum eta range (after propagation)
+        if (TMath::Abs(nt.Eta())>0.8&&fkExtraCleanup) continue;
+        if (TMath::Abs(pt.Eta())>0.8&&fkExtraCleanup) continue;
+        
+        fHistV0Statistics->Fill(4.5); //pass eta cut
+        
+        AliESDv0 vertex(nt,nidx,pt,pidx);
+        
+        //Experimental: refit V0 if asked to do so
+        if( fkDoV0Refit ) vertex.Refit();
+        
+        //No selection: it was not previously applied, don't  apply now.
+        //if (vertex.GetChi2V0() > fChi2max) continue;
+        
+        Double_t x=vertex.Xv(), y=vertex.Yv();
+        Double_t r2=x*x + y*y;
+        if (r2 < fV0VertexerSels[5]*fV0VertexerSels[5]) continue;
+        if (r2 > fV0VertexerSels[6]*fV0VertexerSels[6]) continue;
+        
+        fHistV0Statistics->Fill(5.5); //pass radius cut
+        
+        Float_t cpa=vertex.GetV0CosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex);
+        
+        //Simple cosine cut (no pt dependence for now)
+        if (cpa < fV0VertexerSels[4]) continue;
+        
+        fHistV0Statistics->Fill(6.5); //pass cosPA
+        
+        vertex.SetDcaV0Daughters(dca);
+        vertex.SetV0CosineOfPointingAngle(cpa);
+        vertex.ChangeMassHypothesis(kK0Short);
+        
+        //pre-select on pT
+        Double_t lMomX       = 0. , lMomY = 0., lMomZ = 0.;
+        Double_t lTransvMom  = 0. ;
+        vertex.GetPxPyPz( lMomX, lMomY, lMomZ );
+        lTransvMom      = TMath::Sqrt( lMomX*lMomX   + lMomY*lMomY );
+        if(lTransvMom<fMinPtV0) continue;
+        if(lTransvMom>fMaxPtV0) continue;
+        
+        fHistV0Statistics->Fill(7.5); //within pT range
+        if (lUsedOptimalParams) fHistV0Statistics->Fill(8.5); //good V0, used OTF params
+        
+        event->AddV0(&vertex);
+        
+        nvtx++;
+    }
     return nvtx;
 }
 
@@ -887,6 +991,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event)
     TArrayI neg(nentr);
     TArrayI pos(nentr);
     
+    //XY pre-screen: same condition as fkSkipLargeXYDCA in GetDCAV0Dau, evaluated before any propagation
+    Bool_t lPreScreenXY = fkDoImprovedDCAV0DauPropagation && fkSkipLargeXYDCA;
+    std::vector<Double_t> lHelixCircles; /// x, y of the center and radius for each track
+    if (lPreScreenXY) lHelixCircles.assign(3*nentr, 0.);
+    
     Long_t nneg=0, npos=0, nvtx=0;
     
     //Particles of interest
@@ -927,6 +1036,8 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event)
         if (TMath::Abs(d)<fV0VertexerSels[2]) continue;
         if (TMath::Abs(d)>fV0VertexerSels[6]) continue;
         
+        if (lPreScreenXY) GetHelixCircle(esdTrack, &lHelixCircles[3*i], b);
+        
         if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
         else pos[npos++]=i;
     }
@@ -995,6 +1106,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event)
                     fHistV0OptimalTrackParamUse->Fill(0.5);
                 }
             }
+            
+            //circles apart: would be rejected by GetDCAV0Dau, skip the propagation
+            if (lPreScreenXY && !lUsedOptimalParams &&
+                AreHelixCirclesApart(&lHelixCircles[3*nidx], &lHelixCircles[3*pidx])) continue;
+            
             AliExternalTrackParam *ntp=&nt, *ptp=&pt;
             Double_t xn, xp, dca;
             
@@ -2853,6 +2969,34 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     return;
 }
 
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(const AliExternalTrackParam *track,Double_t circle[3], Double_t b){
+    // Center and radius of the track helix in the XY plane
+    // Radius 0 (never screened) for straight tracks
+    circle[0] = circle[1] = circle[2] = 0.;
+    Double_t lCurvature = track->GetC(b);
+    if( TMath::Abs(lCurvature) < 1e-15 ) return;
+    GetHelixCenter( track, circle, b);
+    circle[2] = TMath::Abs(1./lCurvature);
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::AreHelixCirclesApart(const Double_t nCircle[3], const Double_t pCircle[3]) const {
+    // kTRUE if the XY circles of the two daughters are farther apart than the
+    // window of the fkSkipLargeXYDCA check in GetDCAV0Dau: the pair would be
+    // rejected there anyway. The small margin covers the rounding after the
+    // re-propagation of the tracks (the helix itself does not change)
+    if( nCircle[2] <= 0. || pCircle[2] <= 0. ) return kFALSE;
+    const Double_t lMargin = 1e-4; // cm
+    Double_t lWindow = 2*fV0VertexerSels[3] + lMargin;
+    Double_t dx = nCircle[0] - pCircle[0];
+    Double_t dy = nCircle[1] - pCircle[1];
+    Double_t lDist = TMath::Sqrt( dx*dx + dy*dy );
+    if( lDist > nCircle[2] + pCircle[2] + lWindow ) return kTRUE;
+    if( lDist < TMath::Abs(nCircle[2] - pCircle[2]) - lWindow ) return kTRUE;
+    return kFALSE;
+}
+
 ///________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::SelectiveResetV0s(AliESDEvent *event, Int_t lType){
     //Selectively reset V0s
@@ -34,9 +34,11 @@ class AliPhysicsSelection;
 class AliESDtrackCuts;
 
 #include "AliEventCuts.h"
+#include "AliExternalTrackParam.h"
 #include <AliPID.h>
 //For mapping functionality
 #include <map>
+#include <vector>
 
 using namespace std;
 
@@ -219,6 +221,10 @@ public:
     void SetSkipLargeXYDCA( Bool_t lOpt = kTRUE) {
         fkSkipLargeXYDCA=lOpt;
     }
+    //Number of threads propagating the V0 daughter pairs (output identical to a single thread)
+    void SetNThreads( Int_t lNThreads = 1) {
+        fNThreads=lNThreads;
+    }
     void SetUseMonteCarloAssociation( Bool_t lOpt = kTRUE) {
         fkMonteCarlo=lOpt;
     }
@@ -284,6 +290,25 @@ public:
     //Improved DCA V0 Dau
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
+    //Fast XY pre-screen of the V0 daughter pairs
+    void GetHelixCircle(const AliExternalTrackParam *track,Double_t circle[3], Double_t b);
+    Bool_t AreHelixCirclesApart(const Double_t nCircle[3], const Double_t pCircle[3]) const;
+    //---------------------------------------------------------------------------------------
+    //Multi-threaded V0 daughter propagation
+    struct V0Pair {
+        Long_t fNidx;                 //negative track index
+        Long_t fPidx;                 //positive track index
+        Int_t  fOTFStatus;            //-1: not requested, 0: not found, 1: used, 2: invalid OTF V0
+        Int_t  fOTFIndex;             //index of the OTF V0
+        Bool_t fUsedOptimalParams;    //OTF parameters used
+        Double_t fDCA;                //DCA between the daughters
+        Double_t fXn;                 //X of the negative daughter at the DCA
+        Double_t fXp;                 //X of the positive daughter at the DCA
+        AliExternalTrackParam fNt;    //negative daughter after the DCA propagation
+        AliExternalTrackParam fPt;    //positive daughter after the DCA propagation
+    };
+    void PropagateV0Pair(AliESDEvent *event, V0Pair &lPair, const std::vector<Double_t> &lHelixCircles);
+    Long_t ProcessV0Pairs(AliESDEvent *event, std::vector<V0Pair> &lPairs, const std::vector<Double_t> &lHelixCircles);
     //---------------------------------------------------------------------------------------
     
     //---------------------------------------------------------------------------------------
@@ -369,6 +394,7 @@ private:
     Double_t fMassWindowAroundCascade;
     
     Double_t fMinXforXYtest; //min X allowed for XY-plane preopt test
+    Int_t fNThreads; //number of threads for the V0 daughter propagation
     
     Double_t  fV0VertexerSels[7];        // Array to store the 7 values for the different selections V0 related
     Double_t  fCascadeVertexerSels[8];   // Array to store the 8 values for the different selections Casc. related
@@ -395,7 +421,7 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
 };
 
@@ -10,6 +10,7 @@
 #include "AliAnalysisEtReconstructed.h"
 #include "AliAnalysisEtCuts.h"
 #include "AliESDtrack.h"
+#include "AliExternalTrackParam.h"
 #include "AliEMCALTrack.h"
 #include "AliESDCaloCluster.h"
 #include "TVector3.h"
@@ -681,6 +682,7 @@ void AliAnalysisEtReconstructed::Init()
 
 bool AliAnalysisEtReconstructed::TrackHitsCalorimeter(AliVParticle* track, Double_t magField)
 { // propagate track to detector radius
+  // a copy of the track parameters is propagated, the input track is left untouched
     if (!track) {
         cout<<"Warning: track empty"<<endl;
         return kFALSE;
@@ -692,10 +694,11 @@ bool AliAnalysisEtReconstructed::TrackHitsCalorimeter(AliVParticle* track, Doubl
     }
     // Printf("Propagating track: eta: %f, phi: %f, pt: %f", esdTrack->Eta(), esdTrack->Phi(), esdTrack->Pt());
 
-    Bool_t prop = esdTrack->PropagateTo(fDetectorRadius, magField);
+    AliExternalTrackParam trackParam(*esdTrack);
+    Bool_t prop = trackParam.PropagateTo(fDetectorRadius, magField);
 
-    // if (prop) Printf("Track propagated, eta: %f, phi: %f, pt: %f", esdTrack->Eta(), esdTrack->Phi(), esdTrack->Pt());
-    return prop && fSelector->CutGeometricalAcceptance(*esdTrack);
+    // if (prop) Printf("Track propagated, eta: %f, phi: %f, pt: %f", trackParam.Eta(), trackParam.Phi(), trackParam.Pt());
+    return prop && fSelector->CutGeometricalAcceptance(trackParam);
 }
 
 void AliAnalysisEtReconstructed::FillOutputList(TList* list)
@@ -35,6 +35,7 @@
 */
 
 #include "iostream"
+#include <algorithm>
 #include "TSystem.h"
 #include <TPDGCode.h>
 #include <TDatabasePDG.h>
@@ -134,6 +135,7 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fPtResCentPtTPCITS(0)
   , fCurrentFileName("")
   , fDummyTrack(0)
+  , fTrackSelection()
 {
   // Constructor
 
@@ -314,6 +316,8 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     Printf("ERROR: ESD event not available");
     return;
   }
+  // track selection decisions are evaluated on demand
+  fTrackSelection.assign(fESD->GetNumberOfTracks(),0);
   //if MC info available - use it.
   fMC = MCEvent();
   if (fMC){  
@@ -684,8 +688,8 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       AliESDtrack *track = esdEvent->GetTrack(iTrack);
       if(!track) continue;
       if(track->Charge()==0) continue;
-      if(!esdTrackCuts->AcceptTrack(track)) continue;
-      if(!accCuts->AcceptTrack(track)) continue;
+      if(!AcceptTrackCuts(iTrack,track)) continue;
+      if(!AcceptAccCuts(iTrack,track)) continue;
 
       // downscale low-pT tracks
       Double_t scalempt= TMath::Min(track->Pt(),10.);
@@ -983,8 +987,8 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
       } //this guy can be NULL
       if(!track) continue;
       if(track->Charge()==0) continue;
-      if(!esdTrackCuts->AcceptTrack(track)) continue;
-      if(!accCuts->AcceptTrack(track)) continue;
+      if(!AcceptTrackCuts(iTrack,track)) continue;
+      if(!AcceptAccCuts(iTrack,track)) continue;
 
       // downscale low-pT tracks
       Double_t scalempt= TMath::Min(track->Pt(),10.);
@@ -1697,6 +1701,21 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
     Double_t runNumber = esdEvent->GetRunNumber();
     Double_t evtTimeStamp = esdEvent->GetTimeStamp();
     Int_t evtNumberInFile = esdEvent->GetEventNumberInFile();
+
+    // (|label|, index) of the charged tracks, sorted, to find the tracks of a particle
+    std::vector<std::pair<Int_t,Int_t> > trackLabels;
+    trackLabels.reserve(esdEvent->GetNumberOfTracks());
+    for (Int_t iTrack = 0; iTrack < esdEvent->GetNumberOfTracks(); iTrack++)
+    {
+      AliESDtrack *track = esdEvent->GetTrack(iTrack);
+      if(!track) continue;
+      if(track->Charge()==0) continue;
+      Int_t label =  TMath::Abs(track->GetLabel());
+      if (label >= mcStackSize) continue;
+      trackLabels.push_back(std::make_pair(label,iTrack));
+    }
+    std::sort(trackLabels.begin(),trackLabels.end());
+
     // loop over MC stack
     for (Int_t iMc = 0; iMc < mcStackSize; ++iMc) 
     {
@@ -1732,32 +1751,26 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
       Int_t nFakes = 0;  // how many times reconstructed as a fake track
       AliESDtrack *recTrack = NULL; 
 
-      for (Int_t iTrack = 0; iTrack < esdEvent->GetNumberOfTracks(); iTrack++)
+      // tracks with label iMc, in increasing track index
+      std::vector<std::pair<Int_t,Int_t> >::const_iterator itLabel = std::lower_bound(trackLabels.begin(),trackLabels.end(),std::make_pair(iMc,-1));
+      for (; itLabel != trackLabels.end() && itLabel->first == iMc; ++itLabel)
       {
+        Int_t iTrack = itLabel->second;
         AliESDtrack *track = esdEvent->GetTrack(iTrack);
-        if(!track) continue;
-        if(track->Charge()==0) continue;
-        //
-        Int_t label =  TMath::Abs(track->GetLabel());
-        if (label >= mcStackSize) continue;
-        if(label == iMc) {	  
-          Bool_t isAcc=esdTrackCuts->AcceptTrack(track);
-          if (isAcc) isESDtrackCut=1;
-          if (accCuts->AcceptTrack(track)) isAccCuts=1;
-          isRec = kTRUE;
-          trackIndex = iTrack;
-
-          if (recTrack){
-            if (track->GetTPCncls()<recTrack->GetTPCncls()) continue; // in case looper tracks use longer track
-            if (!isAcc) continue;
-            trackLoopIndex = iTrack;
-          }
-          recTrack = esdEvent->GetTrack(trackIndex); 
-          nRec++;
-          if(track->GetLabel()<0) nFakes++;
+        Bool_t isAcc=AcceptTrackCuts(iTrack,track);
+        if (isAcc) isESDtrackCut=1;
+        if (AcceptAccCuts(iTrack,track)) isAccCuts=1;
+        isRec = kTRUE;
+        trackIndex = iTrack;
 
-          continue;
-        }        
+        if (recTrack){
+          if (track->GetTPCncls()<recTrack->GetTPCncls()) continue; // in case looper tracks use longer track
+          if (!isAcc) continue;
+          trackLoopIndex = iTrack;
+        }
+        recTrack = esdEvent->GetTrack(trackIndex); 
+        nRec++;
+        if(track->GetLabel()<0) nFakes++;
       }
 
       // Store information in the output tree
@@ -1842,6 +1855,36 @@ Bool_t AliAnalysisTaskFilteredTree::IsHighDeDxParticle(AliESDtrack * track) {
   return kFALSE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskFilteredTree::AcceptTrackCuts(Int_t iTrack, AliESDtrack *const track)
+{
+  //
+  // esd track cuts, evaluated once per track and event
+  //
+  if (iTrack<0 || iTrack>=(Int_t)fTrackSelection.size()) return fEsdTrackCuts->AcceptTrack(track);
+  UChar_t &bits = fTrackSelection[iTrack];
+  if (!(bits & kTrackCutsDone)) {
+    bits |= kTrackCutsDone;
+    if (fEsdTrackCuts->AcceptTrack(track)) bits |= kTrackCutsOK;
+  }
+  return (bits & kTrackCutsOK) != 0;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskFilteredTree::AcceptAccCuts(Int_t iTrack, AliESDtrack *const track)
+{
+  //
+  // acceptance cuts, evaluated once per track and event
+  //
+  if (iTrack<0 || iTrack>=(Int_t)fTrackSelection.size()) return fFilteredTreeAcceptanceCuts->AcceptTrack(track);
+  UChar_t &bits = fTrackSelection[iTrack];
+  if (!(bits & kAccCutsDone)) {
+    bits |= kAccCutsDone;
+    if (fFilteredTreeAcceptanceCuts->AcceptTrack(track)) bits |= kAccCutsOK;
+  }
+  return (bits & kAccCutsOK) != 0;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEvent * const mcEvent, AliESDfriend *const esdFriend)
 {
@@ -2176,8 +2219,8 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       }
       
       if(track->Charge()==0) continue;
-      if(!esdTrackCuts->AcceptTrack(track)) continue;
-      if(!accCuts->AcceptTrack(track)) continue;
+      if(!AcceptTrackCuts(iTrack,track)) continue;
+      if(!AcceptAccCuts(iTrack,track)) continue;
 
       if(!IsHighDeDxParticle(track)) continue;
       TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
@@ -31,6 +31,7 @@ class TTreeSRedirector;
 class TParticle;
 class TH3D;
 #include <string>
+#include <vector>
 
 #include "AliTriggerAnalysis.h"
 #include "AliAnalysisTaskSE.h"
@@ -98,6 +99,10 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   Bool_t IsV0Downscaled(AliESDv0 *const v0);
   Bool_t IsHighDeDxParticle(AliESDtrack * const track);
 
+  // track selection, the decisions are cached per event and shared by the Process* functions
+  Bool_t AcceptTrackCuts(Int_t iTrack, AliESDtrack *const track);
+  Bool_t AcceptAccCuts(Int_t iTrack, AliESDtrack *const track);
+
   void SetLowPtTrackDownscaligF(Double_t fact) { fLowPtTrackDownscaligF = fact; }
   void SetLowPtV0DownscaligF(Double_t fact)    { fLowPtV0DownscaligF = fact; }
   void SetFriendDownscaling(Double_t fact)    { fFriendDownscaling = fact; }
@@ -175,9 +180,12 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TObjString fCurrentFileName; // cached value of current file name
   AliESDtrack* fDummyTrack; //! dummy track for tree init
 
+  enum ETrackSelection { kTrackCutsDone=BIT(0), kTrackCutsOK=BIT(1), kAccCutsDone=BIT(2), kAccCutsOK=BIT(3) };
+  std::vector<UChar_t> fTrackSelection; //! ETrackSelection bits of the tracks of the current event
+
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
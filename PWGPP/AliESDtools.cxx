@@ -33,6 +33,11 @@
   tree->Draw(">>entryList","SPDVertex.fNContributors>100&&Tracks@.GetEntries()/PrimaryVertex.fNContributors>10","entrylist");
    tree->SetEntryList(entryList)
    tree->Scan("AliESDtools::GetTrackMatchEff(0,0):AliESDtools::GetTrackCounters(0,0):AliESDtools::GetTrackCounters(4,0):AliESDtools::GetMeanHisTPCVertexA():AliESDtools::GetMeanHisTPCVertexC():Entry$","AliESDtools::SCalculateEventVariables(Entry$)")
+
+  /// batch mode - event variables calculated once for all entries and used as friend tree
+  tools.FillEventVariables("eventVariables.root");
+  tree->AddFriend("eventVariables","eventVariables.root");
+  tree->Draw("eventVariables.trackCounters.fElements[4]:eventVariables.trackCounters.fElements[0]","eventVariables.trackMatchEff.fElements[2]>0.5")
 */
 
 
@@ -386,6 +391,52 @@ Int_t AliESDtools::CalculateEventVariables() {
   return 1;
 }
 
+/// Batch evaluation of the event variables - one pass over the entries [firstEntry, lastEntry]
+/// instead of the TTreeFormula callbacks (SCalculateEventVariables, GetTrackCounters ...) per drawn entry.
+/// The cached vectors and the TPC vertex means are written to the tree "eventVariables" in outputFile,
+/// which is an entry by entry friend of the input tree for the full range (default).
+/// For a sub-range the input entry number is stored in the branch "entry".
+/// \param outputFile   - output file name
+/// \param firstEntry   - first entry to process
+/// \param lastEntry    - last entry to process (-1 - till the end of the tree)
+/// \return             - number of processed entries
+Long64_t AliESDtools::FillEventVariables(const char *outputFile, Long64_t firstEntry, Long64_t lastEntry){
+  if (fESDtree==nullptr || fEvent==nullptr) {
+    ::Error("AliESDtools::FillEventVariables","Tree not initialized - call Init(tree) first");
+    return 0;
+  }
+  Long64_t nEntries=fESDtree->GetEntries();
+  if (lastEntry<0 || lastEntry>=nEntries) lastEntry=nEntries-1;
+  if (firstEntry<0) firstEntry=0;
+  TStopwatch timer;
+  TTreeSRedirector *pcstream = new TTreeSRedirector(outputFile,"recreate");
+  Long64_t nProcessed=0;
+  for (Long64_t entry=firstEntry; entry<=lastEntry; entry++){
+    fESDtree->GetEntry(entry);
+    CalculateEventVariables();
+    Double_t meanTPCVertexA=fHisTPCVertexA->GetMean();
+    Double_t meanTPCVertexC=fHisTPCVertexC->GetMean();
+    (*pcstream)<<"eventVariables"<<
+      "entry="<<entry<<
+      "trackCounters.="<<fCacheTrackCounters<<
+      "trackTPCCountersZ.="<<fCacheTrackTPCCountersZ<<
+      "trackdEdxRatio.="<<fCacheTrackdEdxRatio<<
+      "trackNcl.="<<fCacheTrackNcl<<
+      "trackChi2.="<<fCacheTrackChi2<<
+      "trackMatchEff.="<<fCacheTrackMatchEff<<
+      "meanTPCVertexA="<<meanTPCVertexA<<
+      "meanTPCVertexC="<<meanTPCVertexC<<
+      "\n";
+    nProcessed++;
+  }
+  delete pcstream;
+  if (fVerbose&0x1) {
+    ::Info("AliESDtools::FillEventVariables","%lld entries processed",nProcessed);
+    timer.Print();
+  }
+  return nProcessed;
+}
+
 
 ///
 /// \param trackMatch    -  input track parameter
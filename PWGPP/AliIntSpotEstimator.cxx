@@ -22,7 +22,7 @@ AliIntSpotEstimator::AliIntSpotEstimator(const char* name,Double_t outcut,Int_t
 					 Int_t ntrBins,Int_t ntMn,Int_t ntMx,
 					 Int_t nPBins,Double_t pmn,Double_t pmx,Bool_t ntuple) 
 : TNamed(name,""),
-  fEvProc(0),fIPCenterStat(0),fMinTracksForIP(ntrIP>2?ntrIP:2),fOutlierCut(outcut),
+  fEvProc(0),fIPCenterStat(0),fMinTracksForIP(ntrIP>2?ntrIP:2),fRefitVertex(kFALSE),fOutlierCut(outcut),
   fIPCenIni(),
   fIPCenter(),
   fIPCen2(),
@@ -35,7 +35,7 @@ AliIntSpotEstimator::AliIntSpotEstimator(const char* name,Double_t outcut,Int_t
 //______________________________________________________________________________________                                    
 AliIntSpotEstimator::AliIntSpotEstimator(Bool_t initDef) 
   : TNamed("IPEstimator",""),
-    fEvProc(0),fIPCenterStat(0),fMinTracksForIP(2),fOutlierCut(1e-4),
+    fEvProc(0),fIPCenterStat(0),fMinTracksForIP(2),fRefitVertex(kFALSE),fOutlierCut(1e-4),
     fIPCenIni(),
     fIPCenter(),
     fIPCen2(),    
@@ -128,14 +128,14 @@ Bool_t AliIntSpotEstimator::ProcessTracks()
   AliExternalTrackParam *selTrack,*movTrack=0;
   UShort_t selTrackID,movTrackID=0;
   //
-  AliESDVertex* recNewVtx = fVertexer->VertexForSelectedTracks(fTracks,trackID,kTRUE,kFALSE,kFALSE);
-  if (!recNewVtx || ((nTracks=recNewVtx->GetNIndices())<GetMinTracks())) {
-    if (recNewVtx) delete recNewVtx;
+  AliESDVertex* fullVtx = fVertexer->VertexForSelectedTracks(fTracks,trackID,kTRUE,kFALSE,kFALSE);
+  if (!fullVtx || ((nTracks=fullVtx->GetNIndices())<GetMinTracks())) {
+    if (fullVtx) delete fullVtx;
     fTracks->Clear();
     delete[] trackID;
     return kFALSE;
   }
-  if (nTracks>=fMinTracksForIP) ProcessIPCenter(recNewVtx);
+  if (nTracks>=fMinTracksForIP) ProcessIPCenter(fullVtx);
   //
   double pmn = GetTrackMinP();
   double pmx = GetTrackMaxP();
@@ -145,19 +145,32 @@ Bool_t AliIntSpotEstimator::ProcessTracks()
     double pTrack = selTrack->GetP();
     if (!IsZero(fieldVal) && (pTrack<pmn || pTrack>pmx)) continue;
     selTrackID = trackID[itr];
+    double told = selTrack->GetX();  // store the original track position
     //
-    if (itr<nTracks1) {
-      movTrack   = (AliExternalTrackParam*) (*fTracks)[nTracks1];   // save the track
-      movTrackID = trackID[nTracks1];
-      (*fTracks)[itr] = movTrack;  
-      trackID[itr] = movTrackID;
+    AliESDVertex* recNewVtx = 0;
+    if (fRefitVertex) {
+      if (itr<nTracks1) {
+	movTrack   = (AliExternalTrackParam*) (*fTracks)[nTracks1];   // save the track
+	movTrackID = trackID[nTracks1];
+	(*fTracks)[itr] = movTrack;  
+	trackID[itr] = movTrackID;
+      }
+      fTracks->RemoveAt(nTracks1);     // move the last track in the place of the probed one
+      //
+      // refit the vertex w/o the probed track
+      recNewVtx = fVertexer->VertexForSelectedTracks(fTracks,trackID,kTRUE,kFALSE,kFALSE);
+      //
+      // restore the track indices
+      (*fTracks)[itr] = selTrack; 
+      trackID[itr] = selTrackID;
+      if (itr<nTracks1) {
+	(*fTracks)[nTracks1] = movTrack; 
+	trackID[nTracks1] = movTrackID;
+      }
     }
-    fTracks->RemoveAt(nTracks1);     // move the last track in the place of the probed one
+    else recNewVtx = RemoveTrackFromVertex(fullVtx,selTrack,selTrackID); // subtract the probed track from the full fit
     //
-    // refit the vertex w/o the probed track
-    recNewVtx = fVertexer->VertexForSelectedTracks(fTracks,trackID,kTRUE,kFALSE,kFALSE);
     if (recNewVtx) {
-      double told = selTrack->GetX();  // store the original track position
       selTrack->PropagateToDCA(recNewVtx,fieldVal,1e4,ddca,covdca); // in principle, done in the vertexer
       selTrack->GetXYZ(xyzDCA);
       //
@@ -167,7 +180,6 @@ Bool_t AliIntSpotEstimator::ProcessTracks()
       double trDCA = (xyzDCA[0]-fIPCenIni[0])         *sn - (xyzDCA[1]-fIPCenIni[1])         *cs;  // track signed DCA to origin
       double vtDCA = (recNewVtx->GetX()-fIPCenIni[0])*sn - (recNewVtx->GetY()-fIPCenIni[1])*cs;  // vertex signed DCA to origin
       UpdateEstimators(vtDCA,trDCA, nTracks1, pTrack, phiTrack);
-      selTrack->PropagateTo(told,fieldVal);    // restore the track
       if (fNtuple) {
 	static float ntf[8];
 	ntf[0] = float(nTracks1);
@@ -181,22 +193,31 @@ Bool_t AliIntSpotEstimator::ProcessTracks()
 	fNtuple->Fill(ntf);
       }
     }
+    selTrack->PropagateTo(told,fieldVal);    // restore the track
     delete recNewVtx;
-    // restore the track indices
-    (*fTracks)[itr] = selTrack; 
-    trackID[itr] = selTrackID;
-    if (itr<nTracks1) {
-      (*fTracks)[nTracks1] = movTrack; 
-      trackID[nTracks1] = movTrackID;
-    }
   }
   //
+  delete fullVtx;
   fTracks->Clear();
   delete[] trackID;
   return kTRUE;
   //
 }
 
+//______________________________________________________________________________________
+AliESDVertex* AliIntSpotEstimator::RemoveTrackFromVertex(AliESDVertex* vtx, AliExternalTrackParam* trc, UShort_t id) const
+{
+  // get the vertex w/o the track id by subtracting its weight from the fit of vtx,
+  // which is much cheaper than a refit of the remaining tracks.
+  // The track is propagated to the vertex, the caller has to restore it if needed
+  if (!vtx->UsesTrack(id)) return 0;
+  TObjArray rmArray(1);
+  rmArray.AddLast(trc);
+  UShort_t rmId[1] = {id};
+  Float_t vtxXY[2] = {static_cast<Float_t>(vtx->GetX()),static_cast<Float_t>(vtx->GetY())}; // linearize at the full vertex
+  return fVertexer->RemoveTracksFromVertex(vtx,&rmArray,rmId,vtxXY);
+}
+
 //______________________________________________________________________________________
 void AliIntSpotEstimator::UpdateEstimators(double rvD, double rtD, double nTracks, double pTrack, double phiTrack)
 {
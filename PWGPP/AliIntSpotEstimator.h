@@ -13,6 +13,7 @@ class TCanvas;
 class AliESDEvent;
 class AliESDtrack;
 class AliESDVertex;
+class AliExternalTrackParam;
 class AliVertexerTracks;
 
 class AliIntSpotEstimator : public TNamed {
@@ -49,6 +50,8 @@ class AliIntSpotEstimator : public TNamed {
   void          SetOutlierCut(Double_t v=1e-4)                            {fOutlierCut = v;}
   void          SetIPCenIni(Double_t *xyz)                                {for (int i=3;i--;) fIPCenIni[i] = xyz[i];}
   void          SetMinTracksForIP(Int_t ntr=2)                            {fMinTracksForIP = ntr>2 ? ntr : 2;}
+  void          SetRefitVertex(Bool_t v=kTRUE)                            {fRefitVertex = v;}
+  Bool_t        GetRefitVertex()                                   const  {return fRefitVertex;}
   //
   TH2F*         GetHistoIP()                                       const  {return fEstimIP;}
   TH2F*         GetHistoVtx()                                      const  {return fEstimVtx;}
@@ -77,6 +80,7 @@ class AliIntSpotEstimator : public TNamed {
   Bool_t        ProcessTracks();
   Bool_t        ProcessIPCenter(const AliESDVertex* vtx);
   Bool_t        ProcessEstimators(const AliESDEvent* esd);
+  AliESDVertex* RemoveTrackFromVertex(AliESDVertex* vtx, AliExternalTrackParam* trc, UShort_t id) const;
   void          UpdateEstimators(double rvD, double rtD, double nTracks, double pTrack, double phiTrack);
   //
  private :
@@ -88,6 +92,7 @@ class AliIntSpotEstimator : public TNamed {
   Int_t         fEvProc;                         // number of events processed
   Int_t         fIPCenterStat;                   // number of events used for fIPCenter
   Int_t         fMinTracksForIP;                 // account IP estimator only for vertices with >= tracks
+  Bool_t        fRefitVertex;                    // refit the vertex w/o the probed track instead of removing it from the full fit
   Double_t      fOutlierCut;                     // cut on outliers
   Double_t      fIPCenIni[3];                    // mean IP position XYZ (initial)
   Double_t      fIPCenter[3];                    // IP position XYZ
@@ -102,7 +107,7 @@ class AliIntSpotEstimator : public TNamed {
   AliVertexerTracks* fVertexer;                  //! vertex fitter
   TObjArray    *fTracks;                         //! storage for processed tracks
   //
- ClassDef(AliIntSpotEstimator,1)
+ ClassDef(AliIntSpotEstimator,2)
 };
 
 
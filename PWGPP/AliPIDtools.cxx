@@ -8,7 +8,20 @@ std::map<Int_t, AliTPCPIDResponse *> AliPIDtools::pidTPC;     /// we should use
 std::map<Int_t, AliPIDResponse *> AliPIDtools::pidAll;        /// we should use better hash map
 AliESDtrack  AliPIDtools::dummyTrack;/// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global varaible t avoid object constructions
 
-AliTPCPIDResponse* AliPIDtools::GetTPCPID(Int_t hash ) {return pidTPC[hash];}
+Int_t AliPIDtools::fgLastHash=0;
+AliTPCPIDResponse *AliPIDtools::fgLastTPCPID=nullptr;
+
+/// GetTPCPID - map lookup only if the hash changed since the last call
+/// \param hash       - hash value of the PID version
+/// \return           - TPC PID response (0 if not loaded)
+AliTPCPIDResponse* AliPIDtools::GetTPCPID(Int_t hash ) {
+  if (fgLastTPCPID!=nullptr && hash==fgLastHash) return fgLastTPCPID;
+  std::map<Int_t, AliTPCPIDResponse *>::const_iterator it=pidTPC.find(hash);
+  if (it==pidTPC.end()) return nullptr;
+  fgLastHash=hash;
+  fgLastTPCPID=it->second;
+  return fgLastTPCPID;
+}
 Int_t AliPIDtools::GetHash(Int_t run, Int_t passNumber, TString recoPass,Bool_t isMC){
   recoPass+=run;
   recoPass+=passNumber;
@@ -17,7 +30,7 @@ Int_t AliPIDtools::GetHash(Int_t run, Int_t passNumber, TString recoPass,Bool_t
 }
 
 Double_t AliPIDtools::BetheBlochAleph(Int_t hash, Double_t bg){
-  AliTPCPIDResponse *tpcPID=pidTPC[hash];
+  AliTPCPIDResponse *tpcPID=GetTPCPID(hash);
   if (tpcPID) return tpcPID->Bethe(bg);
   return 0;
 }
@@ -30,13 +43,31 @@ Double_t AliPIDtools::GetExpectedTPCSignal(Int_t hash, Double_t p, AliPID::EPart
   Double_t xyz[3] = {0., 0., 0.};
   Double_t pxyz[3] = {0, 0., 0.};
   Double_t cv[21] = {0.}; // dummy parameters for dummy tracks
-  AliTPCPIDResponse *tpcPID=pidTPC[hash];
+  AliTPCPIDResponse *tpcPID=GetTPCPID(hash);
   if (tpcPID==0) return 0;
   pxyz[0]=p;
   dummyTrack.Set(xyz, pxyz, cv, 1);
   Double_t dEdx = tpcPID->GetExpectedSignal(&dummyTrack, particle, AliTPCPIDResponse::kdEdxDefault, kFALSE, kTRUE);
   return dEdx;
 }
+/// GetExpectedTPCSignal for an array of momenta - PID resolved once
+/// \param hash       - hash value of the PID version
+/// \param n          - number of momenta
+/// \param p          - momenta
+/// \param particle   - particle type
+/// \param dEdx       - output mean TPCdedx (0 if the PID is not loaded)
+void AliPIDtools::GetExpectedTPCSignal(Int_t hash, Int_t n, const Double_t *p, AliPID::EParticleType particle, Double_t *dEdx) {
+  Double_t xyz[3] = {0., 0., 0.};
+  Double_t pxyz[3] = {0, 0., 0.};
+  Double_t cv[21] = {0.}; // dummy parameters for dummy tracks
+  AliTPCPIDResponse *tpcPID=GetTPCPID(hash);
+  for (Int_t i=0; i<n; i++) {
+    if (tpcPID==0) { dEdx[i]=0; continue; }
+    pxyz[0]=p[i];
+    dummyTrack.Set(xyz, pxyz, cv, 1);
+    dEdx[i] = tpcPID->GetExpectedSignal(&dummyTrack, particle, AliTPCPIDResponse::kdEdxDefault, kFALSE, kTRUE);
+  }
+}
 /// Load and reguster PID objects in hash maps
 /// \param run
 /// \param passNumber
@@ -55,5 +86,6 @@ Int_t AliPIDtools::LoadPID(Int_t run, Int_t passNumber, TString recoPass, Bool_t
   Int_t  hash=GetHash(run,passNumber, recoPass,isMC);
   pidAll[hash]=pid;     /// we should clone them
   pidTPC[hash]=&tpcpid;  ///
+  fgLastTPCPID=nullptr;  /// reset the last used PID - the hash could be reloaded
   return hash;
 }
@@ -33,9 +33,12 @@ public:
   static AliTPCPIDResponse *GetTPCPID(Int_t hash);
   static Double_t BetheBlochAleph(Int_t hash, Double_t bg);
   static Double_t GetExpectedTPCSignal(Int_t hash, Double_t p, AliPID::EParticleType particle);
+  static void GetExpectedTPCSignal(Int_t hash, Int_t n, const Double_t *p, AliPID::EParticleType particle, Double_t *dEdx);
   static std::map<Int_t, AliTPCPIDResponse *> pidTPC;     /// we should use better hash map
   static std::map<Int_t, AliPIDResponse *> pidAll;        /// we should use better hash map
 private:
+  static Int_t fgLastHash;                       /// hash of the last PID used - TTreeFormula calls are usually with the same hash
+  static AliTPCPIDResponse *fgLastTPCPID;        /// TPC PID of the last hash used
   static AliESDtrack  dummyTrack;/// dummy value to save CPU - unfortunately PID object use AliVtrack - for the moment create global varaible t avoid object constructions
 };
 
@@ -78,7 +78,11 @@ AliCentralityGlauberFit::AliCentralityGlauberFit(const char *filename) :
   fOutrootfilename(0),
   fOutntuplename(0),
   fAncfilename("ancestor_hists.root"),
-  fHistnames()
+  fHistnames(),
+  fGlauNpart(),
+  fGlauNcoll(),
+  fGlauB(),
+  fGlauTaa()
 {
   // Standard constructor.
   TFile *f = 0;
@@ -371,13 +375,11 @@ TH1F *AliCentralityGlauberFit::GlauberHisto(Double_t mu, Double_t k, Double_t al
     ntuple = new TNtuple("gnt", "Glauber ntuple", "Npart:Ncoll:B:tAA:ntot");
   } 
 
-  Int_t nents = 0;
-  if (fGlauntuple)
-    nents = fGlauntuple->GetEntries(); 
+  Int_t nents = LoadGlauberNtuple();
 
   for (Int_t i=0;i<fNevents;++i) {
     if (fGlauntuple)
-      fGlauntuple->GetEntry(i % nents);
+      GetGlauberEntry(i % nents);
     else {
       fNpart = 2;
       fNcoll = 1;
@@ -415,6 +417,42 @@ TH1F *AliCentralityGlauberFit::GlauberHisto(Double_t mu, Double_t k, Double_t al
   return h1;
 }
 
+//--------------------------------------------------------------------------------------------------
+Int_t AliCentralityGlauberFit::LoadGlauberNtuple()
+{
+  // Read the glauber ntuple once into memory, the scans then loop
+  // over the entries for each parameter point without GetEntry.
+
+  if (!fGlauntuple) return 0;
+
+  Int_t nents = fGlauntuple->GetEntries();
+  if ((Int_t)fGlauNpart.size() == nents) return nents;
+
+  fGlauNpart.resize(nents);
+  fGlauNcoll.resize(nents);
+  fGlauB.resize(nents);
+  fGlauTaa.resize(nents);
+  for (Int_t i=0;i<nents;++i) {
+    fGlauntuple->GetEntry(i);
+    fGlauNpart[i] = fNpart;
+    fGlauNcoll[i] = fNcoll;
+    fGlauB[i]     = fB;
+    fGlauTaa[i]   = fTaa;
+  }
+  return nents;
+}
+
+//--------------------------------------------------------------------------------------------------
+void AliCentralityGlauberFit::GetGlauberEntry(Int_t i)
+{
+  // Set the branch variables to the values of entry i, as GetEntry does.
+
+  fNpart = fGlauNpart[i];
+  fNcoll = fGlauNcoll[i];
+  fB     = fGlauB[i];
+  fTaa   = fGlauTaa[i];
+}
+
 //--------------------------------------------------------------------------------------------------
 Double_t AliCentralityGlauberFit::CalculateChi2(TH1F *hDATA, TH1F *thistGlau) 
 {
@@ -588,9 +626,9 @@ TH1F *AliCentralityGlauberFit::MakeAncestor(Double_t alpha)
   
   fhAncestor = new TH1F(hname,hname,3000,0,3000);
   fhAncestor->SetDirectory(0);
-  Int_t nents = fGlauntuple->GetEntries(); 
+  Int_t nents = LoadGlauberNtuple();
   for (Int_t i=0;i<nents;++i) {
-    fGlauntuple->GetEntry(i % nents);
+    GetGlauberEntry(i % nents);
     Int_t n=0;
     if (fAncestor == 1)    n = (Int_t) (TMath::Power(fNpart,alpha));
     //if (fAncestor == 1)      n = (Int_t) (TMath::Power(fNcoll,alpha));
@@ -85,11 +85,17 @@ class AliCentralityGlauberFit : public TObject {
   TString fOutntuplename;           // output Glauber ntuple
   TString fAncfilename;             // ancestor file name
   std::vector<TString> fHistnames;  // histogram names
+  std::vector<Float_t> fGlauNpart;  //! Npart of the glauber ntuple entries
+  std::vector<Float_t> fGlauNcoll;  //! Ncoll of the glauber ntuple entries
+  std::vector<Float_t> fGlauB;      //! B of the glauber ntuple entries
+  std::vector<Float_t> fGlauTaa;    //! tAA of the glauber ntuple entries
 
   Double_t  CalculateChi2(TH1F *hDATA, TH1F *thistGlau);
   TH1F     *GetTriggerEfficiencyFunction(TH1F *hist1, TH1F *hist2);
   Double_t  GetTriggerEfficiencyIntegral(TH1F *hist1, TH1F *hist2); 
+  void      GetGlauberEntry(Int_t i);
   TH1F     *GlauberHisto(Double_t mu, Double_t k, Double_t alpha, TH1F *hDATA, Bool_t save=kFALSE); 
+  Int_t     LoadGlauberNtuple();
   TH1F     *MakeAncestor(Double_t alpha);
   Double_t  NBD(Int_t n, Double_t mu, Double_t k) const;
   TH1F     *NBDhist(Double_t mu, Double_t k);
@@ -102,6 +108,6 @@ class AliCentralityGlauberFit : public TObject {
   AliCentralityGlauberFit(const AliCentralityGlauberFit&);
   AliCentralityGlauberFit &operator=(const AliCentralityGlauberFit&);
 
-  ClassDef(AliCentralityGlauberFit, 1)  
+  ClassDef(AliCentralityGlauberFit, 2)  
 };
 #endif
@@ -381,6 +381,15 @@ void AliTrackletAlg::Reconstruct(TTree* clusterTree, Float_t* vtx, Float_t* /* v
   //
 }
 
+//____________________________________________________________________
+static Int_t GridCell(Double_t x, Double_t width, Int_t n)
+{
+  // cell of x in a grid of n cells of given width starting at 0
+  // (values outside the grid go to the first or last cell)
+  Int_t cell = (x > 0) ? Int_t(x/width) : 0;
+  return (cell < n) ? cell : n-1;
+}
+
 //____________________________________________________________________
 void AliTrackletAlg::FindTracklets(const Float_t *vtx) 
 {
@@ -483,6 +492,50 @@ void AliTrackletAlg::FindTracklets(const Float_t *vtx)
     clPar[kClPh] = TMath::Pi() + TMath::ATan2(-y,-x);  // Store Phi    
 //    Printf("ClPar2 %f %f ", clPar[0],clPar[1]);
   }  
+
+  // Sort the layer 2 clusters in a theta-phi grid with cells at least as
+  // large as the association window, so that only the neighbouring cells
+  // of a layer 1 cluster have to be tested. The candidates passing the
+  // window are the same as with the full loop, ties in the distance are
+  // resolved towards the lower cluster index as there.
+  // Not used with the histograms, which are filled for all the pairs, nor
+  // with a rotated inner layer, for which the phi difference is not folded
+  // into [0,pi]
+  const Bool_t useGrid = !fHistOn && fPhiRotationAngle == 0 && fNClustersLay2 > 0 &&
+                         fPhiWindow > 0 && fThetaWindow > 0;
+  Int_t nPhiCells = 1, nThetaCells = 1;
+  Double_t phiCellWidth = 2.*pi, thetaCellWidth = pi;
+  Int_t* cellStart = 0;
+  Int_t* cellClusters = 0;
+  if (useGrid) {
+    // cells slightly larger than the reach in phi and theta
+    nPhiCells = Int_t(2.*pi/((TMath::Abs(dPhiShift) + fPhiWindow)*1.001));
+    if (nPhiCells < 3) nPhiCells = 1;
+    if (nPhiCells > 256) nPhiCells = 256;
+    nThetaCells = Int_t(pi/(fThetaWindow*1.001));
+    if (nThetaCells < 3) nThetaCells = 1;
+    if (nThetaCells > 256) nThetaCells = 256;
+    phiCellWidth = 2.*pi/nPhiCells;
+    thetaCellWidth = pi/nThetaCells;
+
+    const Int_t nCells = nPhiCells*nThetaCells;
+    Int_t* clusterCell = new Int_t[fNClustersLay2];
+    cellStart = new Int_t[nCells+1];
+    cellClusters = new Int_t[fNClustersLay2];
+    for (Int_t i=0; i<=nCells; i++) cellStart[i] = 0;
+    for (Int_t iC2=0; iC2<fNClustersLay2; iC2++) {
+      float* clPar2 = GetClusterLayer2(iC2);
+      clusterCell[iC2] = GridCell(clPar2[kClPh],phiCellWidth,nPhiCells)*nThetaCells + GridCell(clPar2[kClTh],thetaCellWidth,nThetaCells);
+      cellStart[clusterCell[iC2]+1]++;
+    }
+    for (Int_t i=0; i<nCells; i++) cellStart[i+1] += cellStart[i];
+    // fill in increasing cluster index within each cell
+    Int_t* cellFill = new Int_t[nCells];
+    for (Int_t i=0; i<nCells; i++) cellFill[i] = cellStart[i];
+    for (Int_t iC2=0; iC2<fNClustersLay2; iC2++) cellClusters[cellFill[clusterCell[iC2]]++] = iC2;
+    delete[] cellFill;
+    delete[] clusterCell;
+  }
   
   //###########################################################
   Int_t found = 1;
@@ -508,6 +561,44 @@ void AliTrackletAlg::FindTracklets(const Float_t *vtx)
       float* clPar1 = GetClusterLayer1(iC1);
 //      Printf("ClPar1 %f %f ", clPar1[0],clPar1[1]);
 
+      if (useGrid) {
+        const Int_t iPhiCell = GridCell(clPar1[kClPh],phiCellWidth,nPhiCells);
+        const Int_t iThetaCell = GridCell(clPar1[kClTh],thetaCellWidth,nThetaCells);
+        const Int_t dPhiCell = (nPhiCells > 1) ? 1 : 0;
+        const Int_t thetaCellMin = TMath::Max(iThetaCell-1,0);
+        const Int_t thetaCellMax = TMath::Min(iThetaCell+1,nThetaCells-1);
+        for (Int_t jPhi=-dPhiCell; jPhi<=dPhiCell; jPhi++) {
+          const Int_t phiCell = (iPhiCell+jPhi+nPhiCells)%nPhiCells;
+          for (Int_t thetaCell=thetaCellMin; thetaCell<=thetaCellMax; thetaCell++) {
+            const Int_t cell = phiCell*nThetaCells + thetaCell;
+            for (Int_t k=cellStart[cell]; k<cellStart[cell+1]; k++) {
+              const Int_t iC2 = cellClusters[k];
+              float* clPar2 = GetClusterLayer2(iC2);
+
+              // same distance as in the loop below
+              Double_t dTheta = TMath::Abs(clPar2[kClTh] - clPar1[kClTh]); 
+              Double_t dPhi   = TMath::Abs(clPar2[kClPh] - clPar1[kClPh]);
+              if (dPhi>pi) dPhi=2.*pi-dPhi;
+              dPhi -= dPhiShift;
+              Float_t d = dPhi*dPhi/dPhiWindow2 + dTheta*dTheta/dThetaWindow2;
+              if (!(d<1 && (d<minDist || (d==minDist && iC2<iC2WithBestDist)))) continue;
+
+              if (blacklist[iC1]) {
+                Bool_t blacklisted = kFALSE;
+                for (Int_t i=blacklist[iC1]->GetSize(); i--;) {
+                  if (blacklist[iC1]->At(i) == iC2) {
+                    blacklisted = kTRUE;
+                    break;
+                  }
+                }
+                if (blacklisted) continue;
+              }
+              minDist=d;
+              iC2WithBestDist = iC2;
+            }
+          }
+        }
+      } else
       // Loop on layer 2 
       for (Int_t iC2=0; iC2<fNClustersLay2; iC2++) {      
 //        Printf("looping on cl 2...");
@@ -689,6 +780,8 @@ void AliTrackletAlg::FindTracklets(const Float_t *vtx)
   delete[] partners;
   delete[] minDists;
   delete[] associatedLay1;
+  delete[] cellStart;
+  delete[] cellClusters;
 
   for (Int_t i=0; i<fNClustersLay1; i++)
     if (blacklist[i])
@@ -203,6 +203,7 @@
 #pragma link C++ class  AliAnalysisTaskVdM::TreeData+;
 #pragma link C++ class  AliAnalysisTaskVdM::EventInfo+;
 #pragma link C++ class  AliAnalysisTaskVdM::ADV0+;
+#pragma link C++ class  AliAnalysisTaskVdM::VertexInfo+;
 #pragma link C++ class  AliAnalysisTaskVdM+;
 #pragma link C++ class  AliXMLEngine::NodeIterator+;
 #pragma link C++ class  AliXMLEngine::Node+;
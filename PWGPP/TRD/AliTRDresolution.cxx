@@ -53,6 +53,7 @@
 #include <TStyle.h>
 #include <TROOT.h>
 #include <TObjArray.h>
+#include <TArrayL64.h>
 #include <TH3.h>
 #include <TH2.h>
 #include <TH1.h>
@@ -1712,6 +1713,8 @@ Bool_t AliTRDresolution::MakeProjectionCluster(Bool_t mc)
 
   AliTRDrecoProjection *pr0(NULL), *pr1(NULL);
   Int_t ly(0), ch(0), rcBin(as?as->FindBin(0.):-1), chBin(apt?apt->FindBin(0.):-1), ioff(0), cen(0), npad(0);
+  // selection for which the projection name was already checked, per projection
+  TArrayL64 checked(ih); checked.Reset(-1); Long64_t key(0);
   for (Long64_t ib(0); ib < H->GetNbins(); ib++) {
     v = H->GetBinContent(ib, coord); if(v<1.) continue;
     ly = coord[kBC]-1;
@@ -1744,9 +1747,13 @@ Bool_t AliTRDresolution::MakeProjectionCluster(Bool_t mc)
       AliError(Form("Missing projection %d", ioff));
       return kFALSE;
     }
-    if(strcmp(pr0->H()->GetName(), Form("H%sClY%c%d%d%d", mc?"MC":"", chName[ch], ly, cen, npad))!=0){
-      AliError(Form("Projection mismatch :: request[H%sClY%c%d%d%d] found[%s]", mc?"MC":"", chName[ch], ly, cen, npad, pr0->H()->GetName()));
-      return kFALSE;
+    key = ((Long64_t(ch)*100+ly+1)*100+cen)*100+npad;
+    if(checked[ioff]!=key){
+      if(strcmp(pr0->H()->GetName(), Form("H%sClY%c%d%d%d", mc?"MC":"", chName[ch], ly, cen, npad))!=0){
+        AliError(Form("Projection mismatch :: request[H%sClY%c%d%d%d] found[%s]", mc?"MC":"", chName[ch], ly, cen, npad, pr0->H()->GetName()));
+        return kFALSE;
+      }
+      checked[ioff]=key;
     }
     for(Int_t jh(0); jh<np[isel]; jh++) ((AliTRDrecoProjection*)php.At(ioff+jh))->Increment(coord, v);
   }
@@ -2229,6 +2236,8 @@ Bool_t AliTRDresolution::MakeProjectionTracklet(Bool_t mc)
 
   AliTRDrecoProjection *pr0(NULL), *pr1(NULL);
   Int_t ly(0), ch(0), sp(2), rcBin(as?as->FindBin(0.):-1), pt(0), cen(0), ioff(0), jspc(nSpc*nCh+1), kspc(nSpc*nCh*3/*4*/+1);
+  // selection for which the projection name was already checked, per projection
+  TArrayL64 checked(ih); checked.Reset(-1); Long64_t key(0);
   for (Long64_t ib(0); ib < H->GetNbins(); ib++) {
     v = H->GetBinContent(ib, coord);
     if(v<1.) continue;
@@ -2264,16 +2273,20 @@ Bool_t AliTRDresolution::MakeProjectionTracklet(Bool_t mc)
       AliError(Form("Missing projection %d", ioff));
       return kFALSE;
     }
-    if(sp>=0){
-      if(strcmp(pr0->H()->GetName(), Form("H%sTrkltY%c%c%d%d%d", mc?"MC":"", chName[ch], ptName[pt], sp, UseLYselectTrklt()?fLYselect:ly, cen))!=0){
-        AliError(Form("Projection mismatch :: request[H%sTrkltY%c%c%d%d%d] found[%s]", mc?"MC":"", chName[ch], ptName[pt], sp, UseLYselectTrklt()?fLYselect:ly, cen, pr0->H()->GetName()));
-        return kFALSE;
-      }
-    } else {
-      if(strcmp(pr0->H()->GetName(), Form("H%sTrkltRCZ%c%d%d", mc?"MC":"", ptName[pt], UseLYselectTrklt()?fLYselect:ly, cen))!=0){
-        AliError(Form("Projection mismatch :: request[H%sTrkltRCZ%c%d%d] found[%s]", mc?"MC":"", ptName[pt], UseLYselectTrklt()?fLYselect:ly, cen, pr0->H()->GetName()));
-        return kFALSE;
+    key = (((Long64_t(sp+1)*100+ch)*100+pt)*100+ly+1)*100+cen;
+    if(checked[ioff]!=key){
+      if(sp>=0){
+        if(strcmp(pr0->H()->GetName(), Form("H%sTrkltY%c%c%d%d%d", mc?"MC":"", chName[ch], ptName[pt], sp, UseLYselectTrklt()?fLYselect:ly, cen))!=0){
+          AliError(Form("Projection mismatch :: request[H%sTrkltY%c%c%d%d%d] found[%s]", mc?"MC":"", chName[ch], ptName[pt], sp, UseLYselectTrklt()?fLYselect:ly, cen, pr0->H()->GetName()));
+          return kFALSE;
+        }
+      } else {
+        if(strcmp(pr0->H()->GetName(), Form("H%sTrkltRCZ%c%d%d", mc?"MC":"", ptName[pt], UseLYselectTrklt()?fLYselect:ly, cen))!=0){
+          AliError(Form("Projection mismatch :: request[H%sTrkltRCZ%c%d%d] found[%s]", mc?"MC":"", ptName[pt], UseLYselectTrklt()?fLYselect:ly, cen, pr0->H()->GetName()));
+          return kFALSE;
+        }
       }
+      checked[ioff]=key;
     }
     for(Int_t jh(0); jh<np[isel]; jh++) ((AliTRDrecoProjection*)php.At(ioff+jh))->Increment(coord, v);
   }
@@ -2638,6 +2651,8 @@ Bool_t AliTRDresolution::MakeProjectionTrackIn(Bool_t mc, Bool_t v0)
   // fill projections
   Int_t ch(0), pt(0), p(0), sp(1), rcBin(as?as->FindBin(0.):-1), ioff(0), joff(0), jsel(0), ksel(0);
   AliTRDrecoProjection *pr0(NULL), *pr1(NULL);
+  // selection for which the projection name was already checked, per projection
+  TArrayL64 checked(ih); checked.Reset(-1); Long64_t key(0);
   for (Long64_t ib(0); ib < H->GetNbins(); ib++) {
     v = H->GetBinContent(ib, coord);
     if(v<1.) continue;
@@ -2678,18 +2693,22 @@ Bool_t AliTRDresolution::MakeProjectionTrackIn(Bool_t mc, Bool_t v0)
       AliError(Form("Missing projection @ %d", ioff));
       return kFALSE;
     }
-    if(ch<2){
-      if(strcmp(pr0->H()->GetName(), Form("H%sTrkInY%c%c%d", prefix, chName[ch], ptName[pt], sp))!=0){
-        printf("ch[%d] pt[%d] sp[%d] sel[%d] \"%s\"\n", ch, pt, sp, isel, pr0->H()->GetName());
-        AliError(Form("Projection mismatch :: request[H%sTrkInY%c%c%d] found[%s]", prefix, chName[ch], ptName[pt], sp, pr0->H()->GetName()));
-        return kFALSE;
-      }
-    } else {
-      if(strcmp(pr0->H()->GetName(), Form("H%sTrkInRCZ%c", prefix, ptName[pt]))!=0){
-        printf("RC pt[%d] sp[%d] sel[%d] \"%s\"\n", pt, sp, isel, pr0->H()->GetName());
-        AliError(Form("Projection mismatch :: request[H%sTrkltRCZ%c] found[%s]", prefix, ptName[pt], pr0->H()->GetName()));
-        return kFALSE;
+    key = (Long64_t(ch)*100+pt)*100+sp+1;
+    if(checked[ioff]!=key){
+      if(ch<2){
+        if(strcmp(pr0->H()->GetName(), Form("H%sTrkInY%c%c%d", prefix, chName[ch], ptName[pt], sp))!=0){
+          printf("ch[%d] pt[%d] sp[%d] sel[%d] \"%s\"\n", ch, pt, sp, isel, pr0->H()->GetName());
+          AliError(Form("Projection mismatch :: request[H%sTrkInY%c%c%d] found[%s]", prefix, chName[ch], ptName[pt], sp, pr0->H()->GetName()));
+          return kFALSE;
+        }
+      } else {
+        if(strcmp(pr0->H()->GetName(), Form("H%sTrkInRCZ%c", prefix, ptName[pt]))!=0){
+          printf("RC pt[%d] sp[%d] sel[%d] \"%s\"\n", pt, sp, isel, pr0->H()->GetName());
+          AliError(Form("Projection mismatch :: request[H%sTrkltRCZ%c] found[%s]", prefix, ptName[pt], pr0->H()->GetName()));
+          return kFALSE;
+        }
       }
+      checked[ioff]=key;
     }
     AliDebug(2, Form("Found %s for selection sp[%d] ch[%d] pt[%d]", pr0->H()->GetName(), sp, ch, pt));
     for(Int_t jh(0); jh<np[isel]; jh++){
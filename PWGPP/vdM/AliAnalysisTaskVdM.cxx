@@ -25,10 +25,11 @@ ClassImp(AliAnalysisTaskVdM);
 ClassImp(AliAnalysisTaskVdM::TreeData);
 
 // code from RS for obtaining an unconstrained vertex
-Bool_t revertex(AliESDEvent* esdEv, Bool_t kVtxConstr=kTRUE, Int_t algo=6, const Double_t* cuts=0, Bool_t useSA=kTRUE);
-Bool_t revertex(AliESDEvent* esdEv, Bool_t kVtxConstr, Int_t algo, const Double_t *cuts, Bool_t useSA)
+Bool_t revertex(AliESDEvent* esdEv, Bool_t kVtxConstr=kTRUE, Int_t algo=6, const Double_t* cuts=0, Bool_t useSA=kTRUE, AliESDVertex* refitVertex=0);
+Bool_t revertex(AliESDEvent* esdEv, Bool_t kVtxConstr, Int_t algo, const Double_t *cuts, Bool_t useSA, AliESDVertex* refitVertex)
 {
   // Refit ESD VertexTracks and redo tracks->RelateToVertex
+  // If refitVertex is given, the refit is only copied there (with -1 contributors if it fails) and the ESD is left untouched
   // Default vertexin algorithm is 6 (multivertexer). To use old vertexed, use algo=1
   //
   static AliVertexerTracks* vtFinder = 0;
@@ -86,17 +87,25 @@ Bool_t revertex(AliESDEvent* esdEv, Bool_t kVtxConstr, Int_t algo, const Double_
   }
   //
   // reset old vertex info
-  if (esdEv->GetPileupVerticesTracks()) esdEv->GetPileupVerticesTracks()->Clear();
-  ((AliESDVertex*)esdEv->GetPrimaryVertexTracks())->SetNContributors(-1);
+  if (refitVertex) {
+    *refitVertex = *esdEv->GetPrimaryVertexTracks();
+    refitVertex->SetNContributors(-1);
+  }
+  else {
+    if (esdEv->GetPileupVerticesTracks()) esdEv->GetPileupVerticesTracks()->Clear();
+    ((AliESDVertex*)esdEv->GetPrimaryVertexTracks())->SetNContributors(-1);
+  }
   //
   AliESDVertex *pvtx=vtFinder->FindPrimaryVertex(esdEv);
   if (pvtx) {
     if (pvtx->GetStatus()) {
-      esdEv->SetPrimaryVertexTracks(pvtx);
-      for (Int_t i=esdEv->GetNumberOfTracks(); i--;) {
-        AliESDtrack *t = esdEv->GetTrack(i);
-        Double_t x[3]; t->GetXYZ(x);
-        t->RelateToVertex(pvtx, bkgauss, kVeryBig);
+      if (refitVertex) *refitVertex = *pvtx;
+      else {
+        esdEv->SetPrimaryVertexTracks(pvtx);
+        for (Int_t i=esdEv->GetNumberOfTracks(); i--;) {
+          AliESDtrack *t = esdEv->GetTrack(i);
+          t->RelateToVertex(pvtx, bkgauss, kVeryBig);
+        }
       }
     }
     delete pvtx;
@@ -125,6 +134,21 @@ void AliAnalysisTaskVdM::EventInfo::Fill(const AliVEvent* vEvent) {
   fTimeStamp       = vHeader->GetTimeStamp();
 }
 
+void AliAnalysisTaskVdM::VertexInfo::Fill(const AliESDVertex* vtx) {
+  if (!vtx) {
+    *this = VertexInfo();
+    return;
+  }
+  vtx->GetXYZ(fPosition);
+  Double_t cov[6];
+  vtx->GetCovMatrix(cov);
+  for (Int_t i=0; i<6; ++i)
+    fCov[i] = cov[i];
+  fChi2          = vtx->GetChi2();
+  fNContributors = vtx->GetNContributors();
+  fStatus        = vtx->GetStatus();
+}
+
 void AliAnalysisTaskVdM::ADV0::FillInvalid() {
   fTime[0] = fTime[1] = -10240.0f;
   fBB[0] = fBG[0] = fBB[1] = fBG[1] = -1;
@@ -202,6 +226,7 @@ void AliAnalysisTaskVdM::ADV0::FillV0(const AliVEvent *vEvent, AliTriggerAnalysi
 AliAnalysisTaskVdM::AliAnalysisTaskVdM(const char *name)
   : AliAnalysisTaskSE(name)
   , fTreeBranchNames("")
+  , fRelateTracks(kFALSE)
   , fTriggerAnalysis()
   , fList(nullptr)
   , fTE(nullptr)
@@ -211,6 +236,11 @@ AliAnalysisTaskVdM::AliAnalysisTaskVdM(const char *name)
   , fVertexTPC()
   , fVertexTracks()
   , fVertexTracksUnconstrained()
+  , fCompactVertices(kFALSE)
+  , fVertexInfoSPD()
+  , fVertexInfoTPC()
+  , fVertexInfoTracks()
+  , fVertexInfoTracksUnconstrained()
   , fTriggerIRs("AliTriggerIR", 3)
   , fFiredTriggerClasses()
   , fTreeData()
@@ -240,14 +270,26 @@ void AliAnalysisTaskVdM::SetBranches(TTree* t) {
     t->Branch("IR1InteractionMap", &fIR1InteractionMap, 32000, 0);
     t->Branch("IR2InteractionMap", &fIR2InteractionMap, 32000, 0);
   }
-  if (fTreeBranchNames.Contains("VertexSPD"))
-    t->Branch("VertexSPD", &fVertexSPD, 32000, 0);
-  if (fTreeBranchNames.Contains("VertexTPC"))
-    t->Branch("VertexTPC", &fVertexTPC, 32000, 0);
-  if (fTreeBranchNames.Contains("VertexTracks"))
-    t->Branch("VertexTracks", &fVertexTracks, 32000, 0);
-  if (fTreeBranchNames.Contains("VertexTracksUnconstrained"))
+  fCompactVertices = fTreeBranchNames.Contains("CompactVertex");
+  if (fCompactVertices) {
+    if (fTreeBranchNames.Contains("VertexSPD"))
+      t->Branch("VertexSPD", &fVertexInfoSPD);
+    if (fTreeBranchNames.Contains("VertexTPC"))
+      t->Branch("VertexTPC", &fVertexInfoTPC);
+    if (fTreeBranchNames.Contains("VertexTracks"))
+      t->Branch("VertexTracks", &fVertexInfoTracks);
+    if (fTreeBranchNames.Contains("VertexTracksUnconstrained"))
+      t->Branch("VertexTracksUnconstrained", &fVertexInfoTracksUnconstrained);
+  } else {
+    if (fTreeBranchNames.Contains("VertexSPD"))
+      t->Branch("VertexSPD", &fVertexSPD, 32000, 0);
+    if (fTreeBranchNames.Contains("VertexTPC"))
+      t->Branch("VertexTPC", &fVertexTPC, 32000, 0);
+    if (fTreeBranchNames.Contains("VertexTracks"))
+      t->Branch("VertexTracks", &fVertexTracks, 32000, 0);
+    if (fTreeBranchNames.Contains("VertexTracksUnconstrained"))
       t->Branch("VertexTracksUnconstrained", &fVertexTracksUnconstrained, 32000, 0);
+  }
   if (fTreeBranchNames.Contains("TriggerIR"))
     t->Branch("TriggerIRs", &fTriggerIRs, 32000, 0);
 }
@@ -351,11 +393,24 @@ void AliAnalysisTaskVdM::UserExec(Option_t *)
   fTreeData.fV0Info.FillV0(vEvent, fTriggerAnalysis);
   fTreeData.fADInfo.FillAD(vEvent, fTriggerAnalysis);
 
-  fVertexSPD    = *esdEvent->GetPrimaryVertexSPD();
-  fVertexTPC    = *esdEvent->GetPrimaryVertexTPC();
-  fVertexTracks = *esdEvent->GetPrimaryVertexTracks();
-  revertex(esdEvent, kFALSE);
-  fVertexTracksUnconstrained = *esdEvent->GetPrimaryVertexTracks();
+  if (fCompactVertices) {
+    fVertexInfoSPD.Fill(esdEvent->GetPrimaryVertexSPD());
+    fVertexInfoTPC.Fill(esdEvent->GetPrimaryVertexTPC());
+    fVertexInfoTracks.Fill(esdEvent->GetPrimaryVertexTracks());
+  } else {
+    fVertexSPD    = *esdEvent->GetPrimaryVertexSPD();
+    fVertexTPC    = *esdEvent->GetPrimaryVertexTPC();
+    fVertexTracks = *esdEvent->GetPrimaryVertexTracks();
+  }
+  // the tree holds no track information, so by default the refitted vertex is not
+  // installed in the ESD and the tracks are not related to it
+  AliESDVertex vertexUnconstrained;
+  revertex(esdEvent, kFALSE, 6, 0, kTRUE, fRelateTracks ? 0 : &vertexUnconstrained);
+  const AliESDVertex *vtxUnconstrained = fRelateTracks ? esdEvent->GetPrimaryVertexTracks() : &vertexUnconstrained;
+  if (fCompactVertices)
+    fVertexInfoTracksUnconstrained.Fill(vtxUnconstrained);
+  else
+    fVertexTracksUnconstrained = *vtxUnconstrained;
 
   TClonesArrayGuard guardTriggerIR(fTriggerIRs);
   FillTriggerIR(dynamic_cast<const AliESDHeader*>(vHeader));
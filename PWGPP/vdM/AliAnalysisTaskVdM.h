@@ -24,6 +24,9 @@ class AliESDHeader;
 //  * constrained and unconstrained vertex -> non-separation analysis
 //  * timing information for V0 and for AD -> bkgd estimation
 //
+// with "CompactVertex" in the branch names the vertices are stored as
+// split VertexInfo branches instead of full AliESDVertex objects
+//
 class AliAnalysisTaskVdM : public AliAnalysisTaskSE {
 public:
 
@@ -36,6 +39,7 @@ public:
   virtual void NotifyRun();
 
   void SetBranchNames(TString options) { fTreeBranchNames = options; }
+  void SetRelateTracksToVertex(Bool_t b=kTRUE) { fRelateTracks = b; }
 
   TString GetListName() const { return "TL"; }
   TString GetTreeName() const { return "TE"; }
@@ -99,6 +103,24 @@ public:
     Double32_t fPFBGC[21];          //[0,32,5]
   } ;
 
+  struct VertexInfo {
+    VertexInfo()
+      : fChi2(0)
+      , fNContributors(-1)
+      , fStatus(kFALSE) {
+      for (Int_t i=0; i<3; ++i) fPosition[i] = 0;
+      for (Int_t i=0; i<6; ++i) fCov[i] = 0;
+    }
+
+    void Fill(const AliESDVertex *);
+
+    Double_t   fPosition[3];   // x,y,z
+    Double32_t fCov[6];        // covariance matrix, lower triangle
+    Double32_t fChi2;          //
+    Int_t      fNContributors; //
+    Bool_t     fStatus;        //
+  } ;
+
   class TreeData : public TObject {
   public:
     TreeData()
@@ -128,6 +150,7 @@ private:
   AliAnalysisTaskVdM& operator=(const AliAnalysisTaskVdM&); // not implemented
 
   TString          fTreeBranchNames;     //
+  Bool_t           fRelateTracks;        // install the unconstrained vertex in the ESD and relate the tracks to it
 
   AliTriggerAnalysis fTriggerAnalysis;   //!
 
@@ -140,11 +163,16 @@ private:
   AliESDVertex     fVertexTPC;           //!
   AliESDVertex     fVertexTracks;        //!
   AliESDVertex     fVertexTracksUnconstrained; //!
+  Bool_t           fCompactVertices;     //!
+  VertexInfo       fVertexInfoSPD;       //!
+  VertexInfo       fVertexInfoTPC;       //!
+  VertexInfo       fVertexInfoTracks;    //!
+  VertexInfo       fVertexInfoTracksUnconstrained; //!
   TClonesArray     fTriggerIRs;          //!
   TString          fFiredTriggerClasses; //!
   TreeData         fTreeData;            //!
 
-  ClassDef(AliAnalysisTaskVdM, 2);
+  ClassDef(AliAnalysisTaskVdM, 3);
 } ;
 
 #endif // ALIANALYSISTASKVDM_H
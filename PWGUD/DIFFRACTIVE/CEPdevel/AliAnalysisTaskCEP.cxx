@@ -1169,8 +1169,8 @@ void AliAnalysisTaskCEP::UserExec(Option_t *)
       // the original track
       AliESDtrack *tmptrk = (AliESDtrack*) fTracks->At(trkIndex);
 
-      // create new CEPTrackBuffer and fill it
-      CEPTrackBuffer *trk = new CEPTrackBuffer();
+      // get the next (reused) CEPTrackBuffer and fill it
+      CEPTrackBuffer *trk = fCEPEvent->NextTrack();
       
       trk->SetTrackIndex((UInt_t) trkIndex);
       trk->SetTrackStatus(fTrackStatus->At(trkIndex));
@@ -50,7 +50,7 @@ CEPEventBuffer::CEPEventBuffer()
   , fMCGenerator("")
   , fMCProcessType(AliCEPBase::kdumval)
   , fMCVtxPos(TVector3(CEPTrackBuffer::kdumval,CEPTrackBuffer::kdumval,CEPTrackBuffer::kdumval))
-  , fCEPTracks(new TObjArray())
+  , fCEPTracks(new TClonesArray("CEPTrackBuffer"))
 {
 
   for (Int_t ii=0; ii<6; ii++) fnITSCluster[ii] = 0;
@@ -64,8 +64,6 @@ CEPEventBuffer::~CEPEventBuffer()
 
 	// delete fCEPTracks and all the tracks it contains
   if (fCEPTracks) {
-		fCEPTracks->SetOwner(kTRUE);
-		fCEPTracks->Clear();
 		delete fCEPTracks;
 		fCEPTracks = 0x0;
 	}
@@ -123,16 +121,35 @@ void CEPEventBuffer::Reset()
   fMCVtxPos      = TVector3(CEPTrackBuffer::kdumval,CEPTrackBuffer::kdumval,CEPTrackBuffer::kdumval);
     
   // clear the track list
-  fCEPTracks->SetOwner(kTRUE);
+  // the track buffers are kept and reset when reused, see NextTrack
   fCEPTracks->Clear();
  }
 
+// ----------------------------------------------------------------------------
+CEPTrackBuffer* CEPEventBuffer::NextTrack()
+{
+
+  // buffer of the next track, allocated only if no track buffer of a
+  // previous event can be reused
+  CEPTrackBuffer *trk = (CEPTrackBuffer*) fCEPTracks->ConstructedAt(fnTracks);
+  trk->Reset();
+
+  return trk;
+
+}
+
 // ----------------------------------------------------------------------------
 void CEPEventBuffer::AddTrack(CEPTrackBuffer* trk)
 {
   
   // add track to next element
-  fCEPTracks->Add(trk);
+  // trk is already in place if it was obtained with NextTrack
+  CEPTrackBuffer *slot = (CEPTrackBuffer*) fCEPTracks->ConstructedAt(fnTracks);
+  if (trk != slot) {
+    *slot = *trk;
+    delete trk;
+    trk = slot;
+  }
   fnTracks++;
   
   // update track counters
@@ -169,9 +186,7 @@ Bool_t CEPEventBuffer::RemoveTrack(Int_t ind)
   CEPTrackBuffer *trk = NULL;
 
   if (fCEPTracks->GetEntries() > ind) {
-    trk = (CEPTrackBuffer*) fCEPTracks->RemoveAt(ind);
-    fCEPTracks->Compress();
-    //printf("ntracks left %i ...",fCEPTracks->GetEntries());
+    trk = (CEPTrackBuffer*) fCEPTracks->At(ind);
 
     // update track counters
     fnTracks--;
@@ -181,8 +196,10 @@ Bool_t CEPEventBuffer::RemoveTrack(Int_t ind)
       fnTracksCombined--;
     }
     
-    // free memory
-    delete trk;
+    // the TClonesArray destroys the track
+    fCEPTracks->RemoveAt(ind);
+    fCEPTracks->Compress();
+    //printf("ntracks left %i ...",fCEPTracks->GetEntries());
     
     done = kTRUE;
   }
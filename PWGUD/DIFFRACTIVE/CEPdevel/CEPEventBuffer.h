@@ -3,6 +3,7 @@
 
 #include "TObject.h"
 #include "TObjArray.h"
+#include "TClonesArray.h"
 #include "TArrayI.h"
 #include "AliVEvent.h"
 #include "AliVVZERO.h"
@@ -77,7 +78,9 @@ class CEPEventBuffer : public TObject {
     Int_t fnMCParticles[6];
     
     // list of tracks
-    TObjArray *fCEPTracks;
+    // the CEPTrackBuffer objects are kept across events and reset in place,
+    // the TClonesArray also allows the track members to be split in the tree
+    TClonesArray *fCEPTracks;
     // tracklet - track associations
     TObjArray *fTrl2Tr;
     
@@ -116,6 +119,10 @@ class CEPEventBuffer : public TObject {
  
     // fnTracks, fnTracksCombined, and fnTracksITSpure are incremented
     // automatically when tracks are added with the method AddTrack
+    // NextTrack returns the reset buffer of the next track, which is to be
+    // filled and then passed to AddTrack. Tracks created elsewhere are copied
+    // by AddTrack and deleted
+    CEPTrackBuffer* NextTrack();
     void AddTrack(CEPTrackBuffer* trk);
     
     // the number of tracklets and residuals, as well as the enumber
@@ -245,7 +252,7 @@ class CEPEventBuffer : public TObject {
     CEPTrackBuffer* GetTrack(Int_t ind);
     Bool_t RemoveTrack(Int_t ind);
 
-    ClassDef(CEPEventBuffer, 5)     // CEP event buffer
+    ClassDef(CEPEventBuffer, 6)     // CEP event buffer
 
 };
 
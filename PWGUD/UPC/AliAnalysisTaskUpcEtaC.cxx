@@ -105,7 +105,8 @@ AliAnalysisTaskUpcEtaC::AliAnalysisTaskUpcEtaC()
   f2KstarScalarSumP(0),f1KstarScalarSumP(0),f0KstarScalarSumP(0),f2RhoScalarSumP(0),f4PionScalarSumP(0),f3PiPiScalarSumP(0),f4KaonScalarSumP(0),fK0sScalarSumP(0),
   f2KstarVectorSumPt(0),f1KstarVectorSumPt(0),f0KstarVectorSumPt(0),f2RhoVectorSumPt(0),f4PionVectorSumPt(0),f3PiPiVectorSumPt(0),f4KaonVectorSumPt(0),fK0sVectorSumPt(0),
   fHistZDCAenergy(0),fHistZDCCenergy(0),fHistZDCAtime(0),fHistZDCCtime(0),fHistZDCImpactParameter(0),fHistZDCAImpactParameter(0),fHistZDCCImpactParameter(0),
-  fListSystematics(0),fListJPsiLoose(0),fListJPsiTight(0),fListEtaCLoose(0),fListEtaCTight(0)
+  fListSystematics(0),fListJPsiLoose(0),fListJPsiTight(0),fListEtaCLoose(0),fListEtaCTight(0),
+  fTrackDCAStatus(),fTrackDCA()
 
 {
 
@@ -155,7 +156,8 @@ AliAnalysisTaskUpcEtaC::AliAnalysisTaskUpcEtaC(const char *name)
   f2KstarScalarSumP(0),f1KstarScalarSumP(0),f0KstarScalarSumP(0),f2RhoScalarSumP(0),f4PionScalarSumP(0),f3PiPiScalarSumP(0),f4KaonScalarSumP(0),fK0sScalarSumP(0),
   f2KstarVectorSumPt(0),f1KstarVectorSumPt(0),f0KstarVectorSumPt(0),f2RhoVectorSumPt(0),f4PionVectorSumPt(0),f3PiPiVectorSumPt(0),f4KaonVectorSumPt(0),fK0sVectorSumPt(0),
   fHistZDCAenergy(0),fHistZDCCenergy(0),fHistZDCAtime(0),fHistZDCCtime(0),fHistZDCImpactParameter(0),fHistZDCAImpactParameter(0),fHistZDCCImpactParameter(0),
-  fListSystematics(0),fListJPsiLoose(0),fListJPsiTight(0),fListEtaCLoose(0),fListEtaCTight(0)
+  fListSystematics(0),fListJPsiLoose(0),fListJPsiTight(0),fListEtaCLoose(0),fListEtaCTight(0),
+  fTrackDCAStatus(),fTrackDCA()
 
 {
 
@@ -1208,12 +1210,39 @@ void AliAnalysisTaskUpcEtaC::UserExec(Option_t *)
 	}
 
   if( fType == 1 ){
+	fTrackDCAStatus.clear(); //new event, the track DCAs are propagated again on demand
   	RunAODtrig(); 
   	if(fRunHist) RunAODhist();
 	if(fRunTree) RunAODtree();
 	}
 
 }//UserExec
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskUpcEtaC::GetTrackDCA(AliAODEvent *aod, Int_t itr, AliAODTrack *trk, Double_t dca[2])
+{
+  //DCA of track itr to the primary vertex, from a propagated clone of the track.
+  //The track loops of the event run over the same tracks several times,
+  //the propagation is done once per track and event.
+  if(fTrackDCAStatus.size() != (UInt_t)aod->GetNumberOfTracks()){
+    fTrackDCAStatus.assign(aod->GetNumberOfTracks(),-1);
+    fTrackDCA.assign(2*aod->GetNumberOfTracks(),0.);
+  }
+
+  if(fTrackDCAStatus[itr] < 0){
+    Double_t dcaTrk[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
+    AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
+    fTrackDCAStatus[itr] = trk_clone->PropagateToDCA(aod->GetPrimaryVertex(),aod->GetMagneticField(),300.,dcaTrk,cov) ? 1 : 0;
+    delete trk_clone;
+    fTrackDCA[2*itr] = dcaTrk[0];
+    fTrackDCA[2*itr+1] = dcaTrk[1];
+  }
+  if(fTrackDCAStatus[itr] == 0) return kFALSE;
+
+  dca[0] = fTrackDCA[2*itr];
+  dca[1] = fTrackDCA[2*itr+1];
+  return kTRUE;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskUpcEtaC::RunAODtrig()
 {
@@ -1414,10 +1443,8 @@ void AliAnalysisTaskUpcEtaC::RunAODhist()
       if(!(trk->GetStatus() & AliESDtrack::kITSrefit) ) continue;
       if(trk->GetTPCNcls() < 50)continue;
       if(trk->Chi2perNDF() > 4)continue;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       if(TMath::Abs(dca[1]) > 2) continue;
       Double_t cut_DCAxy = 4*(0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       if(TMath::Abs(dca[0]) > cut_DCAxy) continue;
@@ -2556,10 +2583,8 @@ void AliAnalysisTaskUpcEtaC::RunAODhist()
       if(!(trk->GetStatus() & AliESDtrack::kITSrefit) ) continue;
       if(trk->GetTPCNcls() < 50)continue;
       if(trk->Chi2perNDF() > 4)continue;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       if(TMath::Abs(dca[1]) > 2) continue;
       Double_t cut_DCAxy = 4*(0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       if(TMath::Abs(dca[0]) > cut_DCAxy) continue;
@@ -2888,11 +2913,9 @@ void AliAnalysisTaskUpcEtaC::RunAODhist()
       }
       if(trk->GetTPCNcls() < 50)continue;
       if(trk->Chi2perNDF() > 4)continue;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
+      Double_t dca[2] = {0.0,0.0};
       if(!skipTrack) {
-	if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-	delete trk_clone;
+	if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       }
       if(!skipTrack) { //Only apply DCA and ITS hit requirements on primary tracks, not on K0s daughters
         if(TMath::Abs(dca[1]) > 2) continue;
@@ -3341,10 +3364,8 @@ void AliAnalysisTaskUpcEtaC::RunAODtree()
       if(!(trk->GetStatus() & AliAODTrack::kITSrefit) ) continue;
       if(trk->GetTPCNcls() < 50)continue;
       if(trk->Chi2perNDF() > 4)continue;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       if(TMath::Abs(dca[1]) > 2) continue;
       Double_t cut_DCAxy = 4*(0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       if(TMath::Abs(dca[0]) > cut_DCAxy) continue;
@@ -3400,10 +3421,8 @@ void AliAnalysisTaskUpcEtaC::RunAODtree()
 	    if(fAODVertex->HasDaughter(trk) && trk->GetUsedForVtxFit())fIsVtxContributor[i] = kTRUE;
 	    else fIsVtxContributor[i] = kFALSE;
 	    
-	    Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-	    AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-	    if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-	    delete trk_clone;
+	    Double_t dca[2] = {0.0,0.0};
+	    if(!GetTrackDCA(aod,trackIndex[i],trk,dca)) continue;
 	    
 	    new((*fEtaCAODTracks)[i]) AliAODTrack(*trk);
 	    ((AliAODTrack*)((*fEtaCAODTracks)[i]))->SetDCA(dca[0],dca[1]);//to get DCAxy trk->DCA(); to get DCAz trk->ZAtDCA();
@@ -4391,8 +4410,6 @@ void AliAnalysisTaskUpcEtaC::RunAODsystematics(AliAODEvent* aod)
   Double_t fRecTPCsignal[5], fRecTPCsignalDist;
   Int_t fChannel = 0;
 
-  AliAODVertex *fAODVertex = aod->GetPrimaryVertex();
-  
   TDatabasePDG *pdgdat = TDatabasePDG::Instance();
   
   TParticlePDG *partKaon = pdgdat->GetParticle( 321 );
@@ -4426,10 +4443,8 @@ for(Int_t i=0; i<5; i++){
       if(!(trk->GetStatus() & AliESDtrack::kTPCrefit) ) continue;
       if(!(trk->GetStatus() & AliESDtrack::kITSrefit) ) continue;
       if(i!=4){ if((!trk->HasPointOnITSLayer(0))&&(!trk->HasPointOnITSLayer(1))) continue;}
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       Double_t cut_DCAxy = (0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       
       if(trk->GetTPCNcls() < fJPsiSels[0])continue;
@@ -4497,10 +4512,8 @@ for(Int_t i=0; i<4; i++){
       if(!(trk->GetStatus() & AliESDtrack::kTPCrefit) ) continue;
       if(!(trk->GetStatus() & AliESDtrack::kITSrefit) ) continue;
       if((!trk->HasPointOnITSLayer(0))&&(!trk->HasPointOnITSLayer(1))) continue;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       Double_t cut_DCAxy = (0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       
       if(trk->GetTPCNcls() < fJPsiSels[0])continue;
@@ -4603,10 +4616,8 @@ for(Int_t i=0; i<5; i++){
       if(!(trk->GetStatus() & AliESDtrack::kTPCrefit) ) continue;
       if(!(trk->GetStatus() & AliESDtrack::kITSrefit) ) continue;
       if((trk->HasPointOnITSLayer(0))||(trk->HasPointOnITSLayer(1))) nSpdHits++;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       Double_t cut_DCAxy = (0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       
       if(trk->GetTPCNcls() < fJPsiSels[0])continue;
@@ -4684,10 +4695,8 @@ for(Int_t i=0; i<4; i++){
       if(!(trk->GetStatus() & AliESDtrack::kTPCrefit) ) continue;
       if(!(trk->GetStatus() & AliESDtrack::kITSrefit) ) continue;
       if((trk->HasPointOnITSLayer(0))||(trk->HasPointOnITSLayer(1))) nSpdHits++;
-      Double_t dca[2] = {0.0,0.0}, cov[3] = {0.0,0.0,0.0};
-      AliAODTrack* trk_clone=(AliAODTrack*)trk->Clone("trk_clone");
-      if(!trk_clone->PropagateToDCA(fAODVertex,aod->GetMagneticField(),300.,dca,cov)) continue;
-      delete trk_clone;
+      Double_t dca[2] = {0.0,0.0};
+      if(!GetTrackDCA(aod,itr,trk,dca)) continue;
       Double_t cut_DCAxy = (0.0182 + 0.0350/TMath::Power(trk->Pt(),1.01));
       
       if(trk->GetTPCNcls() < fJPsiSels[0])continue;
@@ -12,10 +12,12 @@ class TH2;
 class TList;
 class AliPIDResponse;
 class AliAODEvent;
+class AliAODTrack;
 class AliESDEvent;
 class AliTOFTriggerMask;
 
 #define ntrg 17
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 
 class AliAnalysisTaskUpcEtaC : public AliAnalysisTaskSE {
@@ -46,6 +48,7 @@ class AliAnalysisTaskUpcEtaC : public AliAnalysisTaskSE {
   Double_t GetMedian(Double_t *daArray);
   Bool_t CheckMeritCutWinner(int cutChoice, double oldPars[3], double newPars[3]);
   void BoostCut(TLorentzVector d1, TLorentzVector d2, TLorentzVector parent, Double_t *boostInfo);
+  Bool_t GetTrackDCA(AliAODEvent *aod, Int_t itr, AliAODTrack *trk, Double_t dca[2]);
 
 
  private:
@@ -414,11 +417,14 @@ class AliAnalysisTaskUpcEtaC : public AliAnalysisTaskSE {
   TList *fListJPsiTight;
   TList *fListEtaCLoose;
   TList *fListEtaCTight;
+
+  std::vector<Char_t> fTrackDCAStatus; //! per track of the event: -1 not propagated yet, 0 propagation failed, 1 done
+  std::vector<Double_t> fTrackDCA; //! per track of the event: dca xy and z to the primary vertex
   
   AliAnalysisTaskUpcEtaC(const AliAnalysisTaskUpcEtaC&); //not implemented
   AliAnalysisTaskUpcEtaC& operator =(const AliAnalysisTaskUpcEtaC&); //not implemented
   
-  ClassDef(AliAnalysisTaskUpcEtaC, 5); 
+  ClassDef(AliAnalysisTaskUpcEtaC, 6); 
 };
 
 #endif
@@ -43,6 +43,20 @@
 
 ClassImp(AliMultiplicityCorrection)
 
+namespace {
+  void CopyBinContents(const TH2* source, TH2* target)
+  {
+    // copies contents and errors of all bins (including under/overflow) of source into target
+    for (Int_t i=0; i<=source->GetNbinsX()+1; ++i)
+      for (Int_t j=0; j<=source->GetNbinsY()+1; ++j)
+      {
+        target->SetBinContent(i, j, source->GetBinContent(i, j));
+        target->SetBinError(i, j, source->GetBinError(i, j));
+      }
+    target->SetEntries(source->GetEntries());
+  }
+}
+
 // Defined where the efficiency drops below 1/3
 // |eta| < 1.4 --> -0.3 ... 0.8
 // |eta| < 1.3 --> -1.9 ... 2.4
@@ -1480,11 +1494,26 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
   TH1** results = new TH1*[kErrorIterations];
 
+  // the projections are the same for all iterations: they are done once and the response
+  // is restored from a copy for each iteration. If the response is not randomized its
+  // normalized version (bayesian method) is kept as well
+  SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
+  TH2* response = (TH2*) fCurrentCorrelation->Clone("responseCopy");
+  response->SetDirectory(0);
+  TH2* normalizedResponse = 0;
+  Bool_t firstIteration = kTRUE;
+
   for (Int_t n=0; n<kErrorIterations; ++n)
   {
     Printf("Iteration %d of %d...", n, kErrorIterations);
 
-    SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
+    Bool_t useNormalizedResponse = (methodType == AliUnfolding::kBayesian && !randomizeResponse && normalizedResponse);
+    if (!firstIteration)
+    {
+      fMultiplicityESDCorrected[correlationID]->Reset();
+      CopyBinContents(useNormalizedResponse ? normalizedResponse : response, fCurrentCorrelation);
+    }
+    firstIteration = kFALSE;
 
     TH1* measured = (TH1*) fCurrentESD->Clone("measured");
 
@@ -1511,7 +1540,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
     }
 
     // only for bayesian method we have to do it before the call to Unfold...
-    if (methodType == AliUnfolding::kBayesian)
+    if (methodType == AliUnfolding::kBayesian && !useNormalizedResponse)
     {
       for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
       {
@@ -1538,6 +1567,12 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
           }
         }
       }
+
+      if (!randomizeResponse)
+      {
+        normalizedResponse = (TH2*) fCurrentCorrelation->Clone("normalizedResponseCopy");
+        normalizedResponse->SetDirectory(0);
+      }
     }
 
     TH1* result = 0;
@@ -1586,6 +1621,9 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
     results[n] = result;
   }
 
+  delete response;
+  delete normalizedResponse;
+
   // find covariance matrix
   // results[n] is X_x
   // cov. matrix is M_xy = E ( (X_x - E(X_x)) * (X_y - E(X_y))), with E() = expectation value
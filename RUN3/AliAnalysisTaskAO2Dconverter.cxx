@@ -18,8 +18,11 @@
  * Convert Run 2 ESDs to Run 3 prototype AODs (AliAO2D.root).
  */
 
+#include <cstring>
+
 #include "TChain.h"
 #include "TTree.h"
+#include "TFile.h"
 #include "AliAnalysisTask.h"
 #include "AliAnalysisManager.h"
 #include "AliESDEvent.h"
@@ -60,6 +63,18 @@ ULong64_t GetEventIdAsLong(AliVHeader *header)
           (ULong64_t)header->GetPeriodNumber() * 16777215 * 3564);
 }
 
+// Keep the nbits most significant bits of the mantissa of x
+Float_t TruncateFloatFraction(Float_t x, Int_t nbits)
+{
+  if (nbits >= 23 || nbits < 0)
+    return x;
+  UInt_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  bits &= 0xFFFFFFFFu << (23 - nbits);
+  std::memcpy(&x, &bits, sizeof(bits));
+  return x;
+}
+
 } // namespace
 
 AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter(const char* name)
@@ -106,6 +121,12 @@ void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
 {
   if (!fTreeStatus[t])
     return;
+  if (fTreeStatistics) {
+    fTreeTimer[t].Start(kFALSE);
+    fTree[t]->Fill();
+    fTreeTimer[t].Stop();
+    return;
+  }
   fTree[t]->Fill();
 }
 
@@ -120,7 +141,12 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   }
 
   // create output objects
-  OpenFile(1); // Necessary for large outputs
+  TFile* file = OpenFile(1); // Necessary for large outputs
+  if (file && fCompression >= 0)
+    file->SetCompressionSettings(fCompression); // Inherited by the branches created below
+
+  for (Int_t i = 0; i < kTrees; i++)
+    fTreeTimer[i].Reset();
 
   // Associate branches for fEventTree
   TTree* Events = CreateTree(kEvents);
@@ -229,6 +255,12 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   }
   PostTree(kKinematics);
 
+  if (fBasketSize > 0) { // Fewer and larger writes
+    for (Int_t i = 0; i < kTrees; i++)
+      if (fTreeStatus[i])
+        fTree[i]->SetBasketSize("*", fBasketSize);
+  }
+
   Prune(); //Removing all unwanted branches (if any)
 }
 
@@ -257,6 +289,12 @@ void AliAnalysisTaskAO2Dconverter::Prune()
 
 void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
 {
+  if (fFirstEvent >= 0 || fLastEvent >= 0) { // Conversion of a range of the input
+    Long64_t entry = fInputHandler ? fInputHandler->GetReadEntry() : Entry();
+    if ((fFirstEvent >= 0 && entry < fFirstEvent) || (fLastEvent >= 0 && entry > fLastEvent))
+      return;
+  }
+
   fESD = dynamic_cast<AliESDEvent *>(InputEvent());
   if (!fESD) {
     ::Fatal("AliAnalysisTaskAO2Dconverter::UserExec", "Something is wrong with the event handler");
@@ -376,6 +414,12 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
     fC1PtTgl = track->GetSigma1PtTgl();
     fC1Pt21Pt2 = track->GetSigma1Pt2();
 
+    if (fTruncate) {
+      Float_t* cov[15] = { &fCYY, &fCZY, &fCZZ, &fCSnpY, &fCSnpZ, &fCSnpSnp, &fCTglY, &fCTglZ, &fCTglSnp, &fCTglTgl, &fC1PtY, &fC1PtZ, &fC1PtSnp, &fC1PtTgl, &fC1Pt21Pt2 };
+      for (Int_t i = 0; i < 15; i++)
+        *cov[i] = TruncateFloatFraction(*cov[i], fCovMantissaBits);
+    }
+
     const AliExternalTrackParam *intp = track->GetTPCInnerParam();
     fTPCinnerP = (intp ? intp->GetP() : 0); // Set the momentum to 0 if the track did not reach TPC
 
@@ -395,6 +439,11 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
     fTOFsignal = track->GetTOFsignal();
     fLength = track->GetIntegratedLength();
 
+    if (fTruncate) {
+      fTPCsignal = TruncateFloatFraction(fTPCsignal, fSignalMantissaBits);
+      fTRDsignal = TruncateFloatFraction(fTRDsignal, fSignalMantissaBits);
+    }
+
     fTOFncls = track->GetNTOFclusters();
 
     if (fTOFncls > 0) {
@@ -490,10 +539,34 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
     PostTree((TreeIndex)i);
 }
 
+void AliAnalysisTaskAO2Dconverter::FinishTaskOutput()
+{
+  // Called on the worker after the last event, before the trees are written
+  if (!fTreeStatistics)
+    return;
+  for (Int_t i = 0; i < kTrees; i++) {
+    if (!fTreeStatus[i] || !fTree[i])
+      continue;
+    fTree[i]->FlushBaskets(); // The compressed size is known only for the written baskets
+    fTreeEntries[i] = fTree[i]->GetEntries();
+    fTreeTotBytes[i] = fTree[i]->GetTotBytes();
+    fTreeZipBytes[i] = fTree[i]->GetZipBytes();
+  }
+}
+
 void AliAnalysisTaskAO2Dconverter::Terminate(Option_t *)
 {
   // terminate
   // called at the END of the analysis (when all events are processed)
+  if (!fTreeStatistics)
+    return;
+  for (Int_t i = 0; i < kTrees; i++) {
+    if (!fTreeStatus[i] || fTreeEntries[i] == 0)
+      continue;
+    AliInfo(Form("%-10s %10lld entries, fill time %8.2f s, size %10lld bytes, compressed %10lld bytes (factor %.2f)",
+                 TreeName[i].Data(), fTreeEntries[i], fTreeTimer[i].RealTime(), fTreeTotBytes[i], fTreeZipBytes[i],
+                 fTreeZipBytes[i] > 0 ? (Double_t)fTreeTotBytes[i] / fTreeZipBytes[i] : 0.));
+  }
 }
 
 AliAnalysisTaskAO2Dconverter *AliAnalysisTaskAO2Dconverter::AddTask(TString suffix)
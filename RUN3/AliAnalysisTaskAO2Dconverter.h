@@ -12,6 +12,7 @@
 #include <TString.h>
 
 #include "TClass.h"
+#include "TStopwatch.h"
 
 #include <Rtypes.h>
 
@@ -30,9 +31,22 @@ public:
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
   virtual void Terminate(Option_t *option);
+  virtual void FinishTaskOutput();
 
   void SetNumberOfEventsPerCluster(int n) { fNumberOfEventsPerCluster = n; }
 
+  // Output size and speed tuning, all off by default
+  void SetBasketSize(Int_t size) { fBasketSize = size; }                // Buffer size (bytes) of all the branches, 0 = ROOT default
+  void SetCompression(Int_t settings) { fCompression = settings; }      // Compression settings (algorithm*100+level) of the output file, -1 = unchanged
+  void SetTruncation(Bool_t trunc = kTRUE) { fTruncate = trunc; }       // Truncate the mantissa of the covariance and dE/dx columns
+  void SetMantissaBits(Int_t cov, Int_t signal) { fCovMantissaBits = cov; fSignalMantissaBits = signal; } // Mantissa bits kept when truncating (23 = no truncation)
+  void SetTreeStatistics(Bool_t stat = kTRUE) { fTreeStatistics = stat; } // Measure the filling time and size of the trees, printed at Terminate
+
+  // Convert only the input entries in [first, last] (-1 = no limit), to split a large input over several jobs.
+  // The trees are associated through fEventId, computed from the event header, so the outputs
+  // of the different ranges can be merged as they are, without remapping any index
+  void SetEventRange(Long64_t first, Long64_t last) { fFirstEvent = first; fLastEvent = last; }
+
   static AliAnalysisTaskAO2Dconverter* AddTask(TString suffix = "");
   enum TreeIndex { // Index of the output trees
     kEvents = 0,
@@ -88,6 +102,20 @@ private:
   TString fPruneList = "";                // Names of the branches that will not be saved to output file
   Bool_t fTreeStatus[kTrees] = { kTRUE }; // Status of the trees i.e. kTRUE (enabled) or kFALSE (disabled)
   int fNumberOfEventsPerCluster = 1000;   // Maximum basket size of the trees
+  Int_t fBasketSize = 0;                  // Buffer size (bytes) of all the branches, 0 = ROOT default
+  Int_t fCompression = -1;                // Compression settings of the output file, -1 = unchanged
+  Bool_t fTruncate = kFALSE;              // Truncate the mantissa of the covariance and dE/dx columns
+  Int_t fCovMantissaBits = 10;            // Mantissa bits kept for the covariance matrix elements
+  Int_t fSignalMantissaBits = 12;         // Mantissa bits kept for the dE/dx signals
+  Bool_t fTreeStatistics = kFALSE;        // Measure the filling time and size of the trees
+  Long64_t fFirstEvent = -1;              // First input entry to convert, -1 = from the beginning
+  Long64_t fLastEvent = -1;               // Last input entry to convert, -1 = up to the end
+
+  // Tree statistics, filled at FinishTaskOutput
+  TStopwatch fTreeTimer[kTrees];          //! Time spent filling each tree
+  Long64_t fTreeEntries[kTrees] = { 0 };  //! Number of entries of each tree
+  Long64_t fTreeTotBytes[kTrees] = { 0 }; //! Uncompressed size of each tree
+  Long64_t fTreeZipBytes[kTrees] = { 0 }; //! Compressed size of each tree
 
   TaskModes fTaskMode = kStandard; // Running mode of the task. Useful to set for e.g. MC mode
 
@@ -199,7 +227,7 @@ private:
   Float_t fTime = -999.f;       /// Cell time
   Char_t fType = -1;            /// Cell type (-1 is undefined, 0 is PHOS, 1 is EMCAL)
 
-  ClassDef(AliAnalysisTaskAO2Dconverter, 1);
+  ClassDef(AliAnalysisTaskAO2Dconverter, 3);
 };
 
 #endif
@@ -23,6 +23,7 @@
 #include "AliAnalysisManager.h"
 #include "AliCDBManager.h"
 #include "AliESDEvent.h"
+#include "AliESDtrack.h"
 #include "AliESDInputHandler.h"
 #include "AliLog.h"
 
@@ -41,7 +42,8 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fTrackKernels()
 {
 // Dummy constructor
 }
@@ -58,7 +60,8 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fTrackKernels()
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -148,7 +151,8 @@ void AliTender::UserCreateOutputObjects()
 void AliTender::UserExec(Option_t* option)
 {
 //
-// Execute all supplied analysis of one event. Notify run change via RunChanged().
+// Execute all supplied analysis of one event. Notify run change via RunChanged()
+// and AliTenderSupply::RunInit().
   if (fDebug > 1) {
     Long64_t entry = fESDhandler->GetReadEntry();
     Printf("AliTender::Exec() %s ==> processing event %lld\n", fESDhandler->GetTree()->GetCurrentFile()->GetName(),entry);
@@ -170,9 +174,35 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
-  TIter next(fSupplies);
-  AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  Int_t nsupplies = fSupplies ? fSupplies->GetEntriesFast() : 0;
+  Int_t isupply;
+  if (fRunChanged) {
+    for (isupply=0; isupply<nsupplies; isupply++)
+      ((AliTenderSupply*)fSupplies->UncheckedAt(isupply))->RunInit();
+  }
+  isupply = 0;
+  while (isupply < nsupplies) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->UncheckedAt(isupply);
+    if (!supply->HasTrackKernel()) {
+      supply->ProcessEvent();
+      isupply++;
+      continue;
+    }
+    // Consecutive supplies with a track kernel are run in a single loop over the tracks
+    fTrackKernels.clear();
+    for (; isupply<nsupplies; isupply++) {
+      supply = (AliTenderSupply*)fSupplies->UncheckedAt(isupply);
+      if (!supply->HasTrackKernel()) break;
+      if (supply->BeginTrackLoop()) fTrackKernels.push_back(supply);
+    }
+    if (fTrackKernels.empty()) continue;
+    Int_t ntracks = fESD->GetNumberOfTracks();
+    for (Int_t itrack=0; itrack<ntracks; itrack++) {
+      AliESDtrack *track = fESD->GetTrack(itrack);
+      for (UInt_t ikernel=0; ikernel<fTrackKernels.size(); ikernel++)
+        fTrackKernels[ikernel]->ProcessTrack(track, itrack);
+    }
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -13,6 +13,8 @@
 //      during pass1 reconstruction.
 //==============================================================================
 
+#include <vector>
+
 #ifndef ALIANALYSISTASKSE_H
 #include "AliAnalysisTaskSE.h"
 #endif
@@ -43,6 +45,7 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  std::vector<AliTenderSupply*> fTrackKernels; //! Supplies running in the current track loop
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
@@ -75,6 +78,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
@@ -15,6 +15,7 @@
 #endif
 
 class AliTender;
+class AliESDtrack;
 
 class AliTenderSupply : public TNamed {
 
@@ -30,8 +31,17 @@ public:
 
   // Run control
   virtual void              Init() = 0;
+  virtual void              RunInit() {}
   virtual void              ProcessEvent() = 0;
   
+  // Track kernel. Supplies returning kTRUE in HasTrackKernel() are executed by the
+  // tender as BeginTrackLoop() once per event (returning kFALSE skips the event) and
+  // ProcessTrack() for each ESD track, instead of ProcessEvent(). Consecutive supplies
+  // of this kind share one loop over the tracks.
+  virtual Bool_t            HasTrackKernel() const {return kFALSE;}
+  virtual Bool_t            BeginTrackLoop() {return kTRUE;}
+  virtual void              ProcessTrack(AliESDtrack */*track*/, Int_t /*itrack*/) {}
+  
   void                      SetTender(const AliTender *tender) {fTender = tender;}
     
   ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
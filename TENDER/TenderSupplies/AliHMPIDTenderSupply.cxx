@@ -74,30 +74,37 @@ void AliHMPIDTenderSupply::ProcessEvent()
   
   // re-evaluate the HMPIDpid bit for all tracks
   Int_t ntracks=event->GetNumberOfTracks();
-  for(Int_t itrack = 0; itrack < ntracks; itrack++){
-    AliESDtrack *track=event->GetTrack(itrack);
-    if (!itrack) continue;
-    //reset pid bit first
-    track->ResetStatus(AliESDtrack::kHMPIDpid);
+  for(Int_t itrack = 0; itrack < ntracks; itrack++)
+    ProcessTrack(event->GetTrack(itrack), itrack);
+  
+  
+}
 
-    Float_t xPc=0., yPc=0., xMip=0., yMip=0., thetaTrk=0., phiTrk=0.;
-    Int_t nPhot=0, qMip=0;
+//_____________________________________________________
+void AliHMPIDTenderSupply::ProcessTrack(AliESDtrack *track, Int_t itrack)
+{
+  //
+  // re-evaluate the HMPIDpid bit of one track
+  //
+
+  if (!itrack) return;
+  //reset pid bit first
+  track->ResetStatus(AliESDtrack::kHMPIDpid);
+
+  Float_t xPc=0., yPc=0., xMip=0., yMip=0., thetaTrk=0., phiTrk=0.;
+  Int_t nPhot=0, qMip=0;
  
-    track->GetHMPIDtrk(xPc,yPc,thetaTrk,phiTrk);
-    track->GetHMPIDmip(xMip,yMip,qMip,nPhot);
-    //
-    //make cuts, just an example, THIS NEEDS TO BE CHANGED
-    //
-    //if ((track->GetStatus()&AliESDtrack::kHMPIDout)!=AliESDtrack::kHMPIDout) continue;
+  track->GetHMPIDtrk(xPc,yPc,thetaTrk,phiTrk);
+  track->GetHMPIDmip(xMip,yMip,qMip,nPhot);
+  //
+  //make cuts, just an example, THIS NEEDS TO BE CHANGED
+  //
+  //if ((track->GetStatus()&AliESDtrack::kHMPIDout)!=AliESDtrack::kHMPIDout) return;
    
-    Float_t dist = TMath::Sqrt((xPc-xMip)*(xPc-xMip) + (yPc-yMip)*(yPc-yMip));    
+  Float_t dist = TMath::Sqrt((xPc-xMip)*(xPc-xMip) + (yPc-yMip)*(yPc-yMip));    
 
-    if(dist > 0.7 || nPhot> 30 || qMip < 100  ) continue;
+  if(dist > 0.7 || nPhot> 30 || qMip < 100  ) return;
 
-    //set pid bit, track was accepted
-    track->SetStatus(AliESDtrack::kHMPIDpid);
-    
-  }
-  
-  
+  //set pid bit, track was accepted
+  track->SetStatus(AliESDtrack::kHMPIDpid);
 }
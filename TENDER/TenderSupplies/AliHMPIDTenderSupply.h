@@ -26,6 +26,9 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+  
+  virtual Bool_t            HasTrackKernel() const {return kTRUE;}
+  virtual void              ProcessTrack(AliESDtrack *track, Int_t itrack);
 
 
 private:
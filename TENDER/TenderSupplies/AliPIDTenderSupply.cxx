@@ -24,6 +24,7 @@
 
 #include <AliESDpid.h>
 #include <AliESDEvent.h>
+#include <AliESDtrack.h>
 #include <AliESDInputHandler.h>
 #include "AliTender.h"
 
@@ -33,7 +34,8 @@ ClassImp(AliPIDTenderSupply)
 
 AliPIDTenderSupply::AliPIDTenderSupply() :
   AliTenderSupply(),
-  fCachePID(kFALSE)
+  fCachePID(kFALSE),
+  fESDpid(0x0)
 {
   //
   // default ctor
@@ -43,7 +45,8 @@ AliPIDTenderSupply::AliPIDTenderSupply() :
 //_____________________________________________________
 AliPIDTenderSupply::AliPIDTenderSupply(const char *name, const AliTender *tender) :
   AliTenderSupply(name,tender),
-  fCachePID(kFALSE)
+  fCachePID(kFALSE),
+  fESDpid(0x0)
 {
   //
   // named ctor
@@ -57,21 +60,40 @@ void AliPIDTenderSupply::ProcessEvent()
   // Combine PID information
   //
 
+  if (!BeginTrackLoop()) return;
+  
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  Int_t ntracks=event->GetNumberOfTracks();
+  for(Int_t itrack = 0; itrack < ntracks; itrack++)
+    ProcessTrack(event->GetTrack(itrack), itrack);
+  
+}
 
-  AliESDpid *pid=fTender->GetESDhandler()->GetESDpid();
-  if (!pid) return;
+//_____________________________________________________
+Bool_t AliPIDTenderSupply::BeginTrackLoop()
+{
+  //
+  // Get the PID response of this event, called by the tender before ProcessTrack
+  //
+
+  AliESDEvent *event=fTender->GetEvent();
+  if (!event) return kFALSE;
+
+  fESDpid=fTender->GetESDhandler()->GetESDpid();
+  if (!fESDpid) return kFALSE;
   // chache pid if requested
   if (fCachePID) {
-    pid->FillTrackDetectorPID();
+    fESDpid->FillTrackDetectorPID();
   }
-  
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliPIDTenderSupply::ProcessTrack(AliESDtrack *track, Int_t /*itrack*/)
+{
   //
   // recalculate combined PID probabilities
   //
-  Int_t ntracks=event->GetNumberOfTracks();
-  for(Int_t itrack = 0; itrack < ntracks; itrack++)
-    pid->CombinePID(event->GetTrack(itrack));
-  
+
+  fESDpid->CombinePID(track);
 }
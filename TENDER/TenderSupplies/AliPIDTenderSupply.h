@@ -14,6 +14,8 @@
 
 #include <AliTenderSupply.h>
 
+class AliESDpid;
+
 class AliPIDTenderSupply: public AliTenderSupply {
   
 public:
@@ -24,15 +26,20 @@ public:
   
   virtual void              Init(){;}
   virtual void              ProcessEvent();
+  
+  virtual Bool_t            HasTrackKernel() const {return kTRUE;}
+  virtual Bool_t            BeginTrackLoop();
+  virtual void              ProcessTrack(AliESDtrack *track, Int_t itrack);
 
   void SetCachePID(Bool_t cachePID) { fCachePID=cachePID; }
 private:
   Bool_t fCachePID;                    // Cache PID values in transient object
+  AliESDpid *fESDpid;                  //! PID response of the current event
   
   AliPIDTenderSupply(const AliPIDTenderSupply&c);
   AliPIDTenderSupply& operator= (const AliPIDTenderSupply&c);
   
-  ClassDef(AliPIDTenderSupply, 2);  // PID tender task
+  ClassDef(AliPIDTenderSupply, 3);  // PID tender task
 };
 
 
@@ -55,6 +55,26 @@ AliVtxTenderSupply::AliVtxTenderSupply(const char *name, const AliTender *tender
   //
 }
 
+//_____________________________________________________
+void AliVtxTenderSupply::RunInit()
+{
+  //
+  // Get the mean vertex of the new run, called by the tender on run change
+  //
+
+  if (fRefitAlgo >=0 ) return; // the refit uses the diamond stored in ESD
+
+  fDiamond=0x0;
+  AliCDBEntry *meanVertex=fTender->GetCDBManager()->Get("GRP/Calib/MeanVertex",fTender->GetRun());
+  if (!meanVertex) {
+    AliError("No new MeanVertex entry found");
+    return;
+  } else {
+    fDiamond=(AliESDVertex*)meanVertex->GetObject();
+  }
+  //printf("\nRun %d, sigmaX %f, sigmaY %f\n",fTender->GetRun(),fDiamond->GetXRes(),fDiamond->GetYRes());
+}
+
 //_____________________________________________________
 void AliVtxTenderSupply::ProcessEvent()
 {
@@ -72,18 +92,6 @@ void AliVtxTenderSupply::ProcessEvent()
   }
   //
 
-  if (fTender->RunChanged()){
-    fDiamond=0x0;
-    AliCDBEntry *meanVertex=fTender->GetCDBManager()->Get("GRP/Calib/MeanVertex",fTender->GetRun());
-    if (!meanVertex) {
-      AliError("No new MeanVertex entry found");
-      return;
-    } else {
-      fDiamond=(AliESDVertex*)meanVertex->GetObject();
-    }
-    //printf("\nRun %d, sigmaX %f, sigmaY %f\n",fTender->GetRun(),fDiamond->GetXRes(),fDiamond->GetYRes());
-  }
-
   if (!fDiamond) return;
 
   // Redo the primary with the constraint ONLY if the updated mean vertex was found in the OCDB
@@ -23,6 +23,7 @@ public:
   virtual ~AliVtxTenderSupply(){;}
   
   virtual void              Init(){;}
+  virtual void              RunInit();
   virtual void              ProcessEvent();
   //
   Int_t   GetRefitAlgo()              const {return fRefitAlgo;}